@@ -13,11 +13,14 @@
 #include <SWIG_CGAL/Kernel/Point_3.h>
 #include <SWIG_CGAL/Kernel/Plane_3.h>
 #include <SWIG_CGAL/AABB_tree/Object.h>
+#include <SWIG_CGAL/AABB_tree/Query_batch.h>
 #include <SWIG_CGAL/Kernel/Segment_3.h>
 #include <SWIG_CGAL/Kernel/Triangle_3.h>
 #include <SWIG_CGAL/Kernel/Ray_3.h>
 #include <SWIG_CGAL/Common/Input_iterator_wrapper.h>
 #include <SWIG_CGAL/Common/Output_iterator_wrapper.h>
+#include <SWIG_CGAL/Common/Freeze_state.h>
+#include <SWIG_CGAL/Common/Memory_usage.h>
 #include <boost/shared_ptr.hpp>
 
 template <class Primitive>
@@ -63,6 +66,7 @@ class AABB_tree_wrapper
   Self deepcopy();
   void deepcopy(const Self&);
   int primitive_counter_id;
+  SWIG_CGAL::Freeze_state freeze_state;
 
   template <class InputIterator>
   void internal_insert(InputIterator begin, InputIterator end){
@@ -104,21 +108,44 @@ public:
 //Operations
   #if !SWIG_CGAL_NON_SUPPORTED_TARGET_LANGUAGE
   void insert_from_array(boost::shared_ptr<std::vector<typename Primitive_object::cpp_base> > input){
+    freeze_state.check_not_frozen("insert_from_array");
     internal_insert(input->begin(),input->end(),
                     typename Enable_inserton_from_array<Primitive_object>::type());
   }
   #endif
   void rebuild(Primitive_range range){
+    freeze_state.check_not_frozen("rebuild");
     clear();
     internal_insert(SWIG_CGAL::get_begin(range),SWIG_CGAL::get_end(range));
     data.build();
   }
   void clear(){
+    freeze_state.check_not_frozen("clear");
     primitive_counter_id=-1;
     data.clear();
   }
+  //the hierarchy is otherwise built by the first query
+  void build(){
+    freeze_state.check_not_frozen("build");
+    data.build();
+  }
+  //constructs the hierarchy and, unless disabled, the search tree of the
+  //distance queries if they are not constructed yet, so that the first
+  //queries do not pay for their construction
+  void prepare(){
+    freeze_state.build_if_not_frozen([this](){ SWIG_AABB_tree::prepare(data); });
+  }
+  //prepares the tree, which can then be queried from several threads at the
+  //same time; the functions modifying the tree throw afterwards
+  void freeze(){
+    freeze_state.freeze([this](){ SWIG_AABB_tree::prepare(data); });
+  }
+  bool is_frozen() const { return freeze_state.is_frozen(); }
   SWIG_CGAL_FORWARD_CALL_0(int,size)
   SWIG_CGAL_FORWARD_CALL_0(bool,empty)
+  //the primitives, and the hierarchy and the search tree of the distance
+  //queries as search index, counted as if the tree was prepared
+  SWIG_CGAL::Memory_usage memory_usage() const {return SWIG_CGAL::internal::memory_usage_of(data);}
 //Intersection Tests
   //do_intersect
   SWIG_CGAL_FORWARD_CALL_1(bool,do_intersect,Segment_3)
@@ -217,11 +244,36 @@ public:
     return Point_and_primitive_id(SWIG_CGAL_extract_data(this->get_data()).closest_point_and_primitive(Point_3::cpp_base(x,y,z)));
   }
 //Accelerating the Distance Queries
-  SWIG_CGAL_FORWARD_CALL_0(bool,accelerate_distance_queries)
+  bool accelerate_distance_queries(){
+    freeze_state.check_not_frozen("accelerate_distance_queries");
+    return data.accelerate_distance_queries();
+  }
+  //distance queries then traverse the hierarchy only
+  void do_not_accelerate_distance_queries(){
+    freeze_state.check_not_frozen("do_not_accelerate_distance_queries");
+    data.do_not_accelerate_distance_queries();
+  }
   SWIG_CGAL_FORWARD_CALL_2(double,squared_distance,Point_3,Point_3)
   SWIG_CGAL_FORWARD_CALL_AND_REF_2(Point_3,closest_point,Point_3,Point_3)
   SWIG_CGAL_FORWARD_CALL_AND_REF_2(Point_and_primitive_id,closest_point_and_primitive,Point_3,Point_and_primitive_id)
-  void accelerate_distance_queries (Point_range range) {data.accelerate_distance_queries(SWIG_CGAL::get_begin(range),SWIG_CGAL::get_end(range));}
+  void accelerate_distance_queries (Point_range range) {freeze_state.check_not_frozen("accelerate_distance_queries"); data.accelerate_distance_queries(SWIG_CGAL::get_begin(range),SWIG_CGAL::get_end(range));}
+//Batched Queries (trees with integer primitive ids), run concurrently on (n,3) arrays
+  #if !SWIG_CGAL_NON_SUPPORTED_TARGET_LANGUAGE
+  Ray_hit_batch first_intersection_batch(SWIG_CGAL::Buffer<double> origins, SWIG_CGAL::Buffer<double> directions){
+    return SWIG_AABB_tree::first_intersection_batch(data,origins,directions);
+  }
+  Closest_point_batch closest_point_batch(SWIG_CGAL::Buffer<double> points){
+    prepare();
+    return SWIG_AABB_tree::closest_point_batch(data,points);
+  }
+  SWIG_CGAL::Buffer<double> squared_distance_batch(SWIG_CGAL::Buffer<double> points){
+    prepare();
+    return SWIG_AABB_tree::squared_distance_batch(data,points);
+  }
+  Primitive_intersection_batch plane_intersections_batch(SWIG_CGAL::Buffer<double> planes){
+    return SWIG_AABB_tree::plane_intersections_batch(data,planes);
+  }
+  #endif
 };
 
 
@@ -26,12 +26,15 @@ SWIG_CGAL_package_common()
   #include  <SWIG_CGAL/Kernel/Triangle_3.h>
   #include  <SWIG_CGAL/Kernel/Segment_3.h>
   #include  <SWIG_CGAL/Polyhedron_3/all_includes.h>
+  #include  <SWIG_CGAL/Surface_mesh/all_includes.h>
   #include  <SWIG_CGAL/AABB_tree/all_includes.h>
   #include  <SWIG_CGAL/AABB_tree/Object.h>
 %}
 
 //import definitions of Polyhedron objects
 %import "SWIG_CGAL/Polyhedron_3/CGAL_Polyhedron_3.i"
+//import definitions of Surface_mesh objects
+%import "SWIG_CGAL/Surface_mesh/CGAL_Surface_mesh.i"
 
 //definitions
 %include "SWIG_CGAL/AABB_tree/AABB_tree.h"
@@ -126,21 +129,112 @@ SWIG_CGAL_declare_generic_output_iterator(Object_and_Integer_output_iterator,Obj
 %include "SWIG_CGAL/typemaps.i"
 SWIG_CGAL_array_of_array6_of_double_to_vector_of_segment_3_typemap_in
 SWIG_CGAL_array_of_array9_of_double_to_vector_of_triangle_3_typemap_in
+SWIG_CGAL_buffer_of_double_typemap_in
+SWIG_CGAL_buffer_of_double_typemap_out
+SWIG_CGAL_buffer_of_int_typemap_in
+SWIG_CGAL_buffer_of_int_typemap_out
+SWIG_CGAL_buffer_of_signed_char_typemap_out
+SWIG_CGAL_buffer_of_unsigned_char_typemap_in
+SWIG_CGAL_buffer_of_unsigned_char_typemap_out
+%include "SWIG_CGAL/AABB_tree/Query_batch.h"
+%include "SWIG_CGAL/AABB_tree/Virtual_scanner.h"
+SWIG_CGAL_release_gil(AABB_tree_wrapper::first_intersection_batch)
+SWIG_CGAL_release_gil(AABB_tree_wrapper::closest_point_batch)
+SWIG_CGAL_release_gil(AABB_tree_wrapper::squared_distance_batch)
+SWIG_CGAL_release_gil(AABB_tree_wrapper::plane_intersections_batch)
+//tree on a shared vertex array
+SWIG_CGAL_release_gil(AABB_tree_indexed_Triangle_3_soup::AABB_tree_indexed_Triangle_3_soup)
+SWIG_CGAL_release_gil(AABB_tree_indexed_Triangle_3_soup::build)
+SWIG_CGAL_release_gil(AABB_tree_indexed_Triangle_3_soup::prepare)
+SWIG_CGAL_release_gil(AABB_tree_indexed_Triangle_3_soup::freeze)
+SWIG_CGAL_release_gil(AABB_tree_indexed_Triangle_3_soup::do_intersect)
+SWIG_CGAL_release_gil(AABB_tree_indexed_Triangle_3_soup::number_of_intersected_primitives)
+SWIG_CGAL_release_gil(AABB_tree_indexed_Triangle_3_soup::any_intersected_primitive)
+SWIG_CGAL_release_gil(AABB_tree_indexed_Triangle_3_soup::squared_distance)
+SWIG_CGAL_release_gil(AABB_tree_indexed_Triangle_3_soup::closest_point)
+SWIG_CGAL_release_gil(AABB_tree_indexed_Triangle_3_soup::closest_point_and_primitive)
+SWIG_CGAL_release_gil(AABB_tree_indexed_Triangle_3_soup::accelerate_distance_queries)
+SWIG_CGAL_release_gil(AABB_tree_indexed_Triangle_3_soup::first_intersection_batch)
+SWIG_CGAL_release_gil(AABB_tree_indexed_Triangle_3_soup::closest_point_batch)
+SWIG_CGAL_release_gil(AABB_tree_indexed_Triangle_3_soup::squared_distance_batch)
+SWIG_CGAL_release_gil(AABB_tree_indexed_Triangle_3_soup::plane_intersections_batch)
+SWIG_CGAL_release_gil(AABB_tree_indexed_Triangle_3_soup::render_depth)
+SWIG_CGAL_release_gil(AABB_tree_indexed_Triangle_3_soup::simulate_lidar)
+%typemap(javaimports) AABB_tree_indexed_Triangle_3_soup %{import CGAL.Kernel.Triangle_3; import CGAL.Kernel.Segment_3; import CGAL.Kernel.Plane_3; import CGAL.Kernel.Ray_3; import CGAL.Kernel.Point_3;%}
+%include "SWIG_CGAL/AABB_tree/Indexed_triangle_soup.h"
+SWIG_CGAL_release_gil(Flat_AABB_tree_3::build)
+SWIG_CGAL_release_gil(Flat_AABB_tree_3::save)
+SWIG_CGAL_release_gil(Flat_AABB_tree_3::load)
+SWIG_CGAL_release_gil(Flat_AABB_tree_3::first_intersection_batch)
+SWIG_CGAL_release_gil(Flat_AABB_tree_3::closest_point_batch)
+SWIG_CGAL_release_gil(Flat_AABB_tree_3::squared_distance_batch)
+SWIG_CGAL_release_gil(Flat_AABB_tree_3::render_depth)
+SWIG_CGAL_release_gil(Flat_AABB_tree_3::simulate_lidar)
+%include "SWIG_CGAL/AABB_tree/Flat_AABB_tree.h"
+//tree on the faces of a Surface_mesh_3
+SWIG_CGAL_release_gil(AABB_tree_Surface_mesh_3::AABB_tree_Surface_mesh_3)
+SWIG_CGAL_release_gil(AABB_tree_Surface_mesh_3::build)
+SWIG_CGAL_release_gil(AABB_tree_Surface_mesh_3::prepare)
+SWIG_CGAL_release_gil(AABB_tree_Surface_mesh_3::freeze)
+SWIG_CGAL_release_gil(AABB_tree_Surface_mesh_3::do_intersect)
+SWIG_CGAL_release_gil(AABB_tree_Surface_mesh_3::number_of_intersected_primitives)
+SWIG_CGAL_release_gil(AABB_tree_Surface_mesh_3::any_intersected_primitive)
+SWIG_CGAL_release_gil(AABB_tree_Surface_mesh_3::squared_distance)
+SWIG_CGAL_release_gil(AABB_tree_Surface_mesh_3::closest_point)
+SWIG_CGAL_release_gil(AABB_tree_Surface_mesh_3::closest_point_and_primitive)
+SWIG_CGAL_release_gil(AABB_tree_Surface_mesh_3::accelerate_distance_queries)
+SWIG_CGAL_release_gil(AABB_tree_Surface_mesh_3::first_intersection_batch)
+SWIG_CGAL_release_gil(AABB_tree_Surface_mesh_3::closest_point_batch)
+SWIG_CGAL_release_gil(AABB_tree_Surface_mesh_3::squared_distance_batch)
+SWIG_CGAL_release_gil(AABB_tree_Surface_mesh_3::plane_intersections_batch)
+SWIG_CGAL_release_gil(AABB_tree_Surface_mesh_3::render_depth)
+SWIG_CGAL_release_gil(AABB_tree_Surface_mesh_3::simulate_lidar)
+%typemap(javaimports) AABB_tree_Surface_mesh_3 %{import CGAL.Kernel.Triangle_3; import CGAL.Kernel.Segment_3; import CGAL.Kernel.Plane_3; import CGAL.Kernel.Ray_3; import CGAL.Kernel.Point_3; import CGAL.Surface_mesh.Surface_mesh_3;%}
+%include "SWIG_CGAL/AABB_tree/Surface_mesh_tree.h"
 #endif
 
+SWIG_CGAL_release_gil(AABB_tree_wrapper::build)
+SWIG_CGAL_release_gil(AABB_tree_wrapper::prepare)
+SWIG_CGAL_release_gil(AABB_tree_wrapper::accelerate_distance_queries())
+//queries that can run concurrently on a frozen tree (the others write to a target language list)
+SWIG_CGAL_release_gil(AABB_tree_wrapper::freeze)
+SWIG_CGAL_release_gil(AABB_tree_wrapper::do_intersect)
+SWIG_CGAL_release_gil(AABB_tree_wrapper::number_of_intersected_primitives)
+SWIG_CGAL_release_gil(AABB_tree_wrapper::any_intersected_primitive)
+SWIG_CGAL_release_gil(AABB_tree_wrapper::any_intersection)
+SWIG_CGAL_release_gil(AABB_tree_wrapper::squared_distance)
+SWIG_CGAL_release_gil(AABB_tree_wrapper::closest_point)
+SWIG_CGAL_release_gil(AABB_tree_wrapper::closest_point_and_primitive)
+
 %ignore AABB_tree_wrapper<CGAL_PTP_Tree,Polyhedron_3_Facet_handle_SWIG_wrapper,Polyhedron_3_Facet_handle_SWIG_wrapper >::insert_from_array;
 %ignore AABB_tree_wrapper<CGAL_PSP_Tree,Polyhedron_3_Edge_handle_SWIG_wrapper,Polyhedron_3_Edge_handle_SWIG_wrapper >::insert_from_array;
+//batched queries report integer primitive ids
+%ignore AABB_tree_wrapper<CGAL_PTP_Tree,Polyhedron_3_Facet_handle_SWIG_wrapper,Polyhedron_3_Facet_handle_SWIG_wrapper >::first_intersection_batch;
+%ignore AABB_tree_wrapper<CGAL_PTP_Tree,Polyhedron_3_Facet_handle_SWIG_wrapper,Polyhedron_3_Facet_handle_SWIG_wrapper >::closest_point_batch;
+%ignore AABB_tree_wrapper<CGAL_PSP_Tree,Polyhedron_3_Edge_handle_SWIG_wrapper,Polyhedron_3_Edge_handle_SWIG_wrapper >::first_intersection_batch;
+%ignore AABB_tree_wrapper<CGAL_PSP_Tree,Polyhedron_3_Edge_handle_SWIG_wrapper,Polyhedron_3_Edge_handle_SWIG_wrapper >::closest_point_batch;
+%ignore AABB_tree_wrapper<CGAL_PTP_Tree,Polyhedron_3_Facet_handle_SWIG_wrapper,Polyhedron_3_Facet_handle_SWIG_wrapper >::plane_intersections_batch;
+%ignore AABB_tree_wrapper<CGAL_PSP_Tree,Polyhedron_3_Edge_handle_SWIG_wrapper,Polyhedron_3_Edge_handle_SWIG_wrapper >::plane_intersections_batch;
 
 //Declaration of the main classes
-%typemap(javaimports)      AABB_tree_wrapper%{import CGAL.Polyhedron_3.Polyhedron_3_Facet_handle; import CGAL.Kernel.Triangle_3; import CGAL.Kernel.Segment_3; import CGAL.Kernel.Plane_3; import CGAL.Kernel.Ray_3; import CGAL.Kernel.Point_3; import java.util.Iterator; import java.util.Collection;%}
+%typemap(javaimports)      AABB_tree_wrapper%{import CGAL.Kernel.Memory_usage; import CGAL.Polyhedron_3.Polyhedron_3_Facet_handle; import CGAL.Kernel.Triangle_3; import CGAL.Kernel.Segment_3; import CGAL.Kernel.Plane_3; import CGAL.Kernel.Ray_3; import CGAL.Kernel.Point_3; import java.util.Iterator; import java.util.Collection;%}
 SWIG_CGAL_declare_identifier_of_template_class(AABB_tree_Polyhedron_3_Facet_handle,AABB_tree_wrapper<CGAL_PTP_Tree,Polyhedron_3_Facet_handle_SWIG_wrapper,Polyhedron_3_Facet_handle_SWIG_wrapper >)
-%typemap(javaimports)      AABB_tree_wrapper%{import CGAL.Polyhedron_3.Polyhedron_3_Edge_handle; import CGAL.Kernel.Triangle_3; import CGAL.Kernel.Segment_3; import CGAL.Kernel.Plane_3; import CGAL.Kernel.Ray_3; import CGAL.Kernel.Point_3; import java.util.Iterator; import java.util.Collection;%}
+%typemap(javaimports)      AABB_tree_wrapper%{import CGAL.Kernel.Memory_usage; import CGAL.Polyhedron_3.Polyhedron_3_Edge_handle; import CGAL.Kernel.Triangle_3; import CGAL.Kernel.Segment_3; import CGAL.Kernel.Plane_3; import CGAL.Kernel.Ray_3; import CGAL.Kernel.Point_3; import java.util.Iterator; import java.util.Collection;%}
 SWIG_CGAL_declare_identifier_of_template_class(AABB_tree_Polyhedron_3_Edge_handle,AABB_tree_wrapper<CGAL_PSP_Tree,Polyhedron_3_Edge_handle_SWIG_wrapper,Polyhedron_3_Edge_handle_SWIG_wrapper >)
-%typemap(javaimports)      AABB_tree_wrapper%{import CGAL.Kernel.Triangle_3; import CGAL.Kernel.Segment_3; import CGAL.Kernel.Plane_3; import CGAL.Kernel.Ray_3; import CGAL.Kernel.Point_3; import java.util.Iterator; import java.util.Collection;%}
+%typemap(javaimports)      AABB_tree_wrapper%{import CGAL.Kernel.Memory_usage; import CGAL.Kernel.Triangle_3; import CGAL.Kernel.Segment_3; import CGAL.Kernel.Plane_3; import CGAL.Kernel.Ray_3; import CGAL.Kernel.Point_3; import java.util.Iterator; import java.util.Collection;%}
 
 SWIG_CGAL_declare_identifier_of_template_class(AABB_tree_Segment_3_soup,AABB_tree_wrapper<CGAL_SSP_Tree,Segment_3,int >)
 SWIG_CGAL_declare_identifier_of_template_class(AABB_tree_Triangle_3_soup,AABB_tree_wrapper<CGAL_TSP_Tree,Triangle_3,int >)
 
+#ifdef SWIGPYTHON
+//pickling and shared memory transport, see CGAL.add_pickle_support()
+%pythoncode %{
+import CGAL as _CGAL
+_CGAL.add_pickle_support(AABB_tree_indexed_Triangle_3_soup)
+_CGAL.add_pickle_support(Flat_AABB_tree_3)
+%}
+#endif
+
 #ifdef SWIG_CGAL_HAS_AABB_tree_USER_PACKAGE
 %include "SWIG_CGAL/User_packages/AABB_tree/extensions.i"
 #endif
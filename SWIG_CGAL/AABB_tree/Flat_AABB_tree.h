@@ -0,0 +1,728 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+
+#ifndef SWIG_CGAL_AABB_TREE_FLAT_AABB_TREE_H
+#define SWIG_CGAL_AABB_TREE_FLAT_AABB_TREE_H
+
+#include <SWIG_CGAL/Common/Buffer.h>
+#include <SWIG_CGAL/Common/Macros.h>
+#include <SWIG_CGAL/Common/Shared_memory.h>
+#include <SWIG_CGAL/AABB_tree/Query_batch.h>
+#include <SWIG_CGAL/AABB_tree/Virtual_scanner.h>
+
+#include <CGAL/for_each.h>
+
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/task_group.h>
+#endif
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Bounding volume hierarchy on the triangles of a (F,3) array of vertex
+// indices in a (V,3) array of vertices, stored in flat arrays so that a
+// built tree can be saved and mapped back in memory by load() without any
+// construction: the pages of the file are shared by all the processes
+// mapping it, and read only when a query reaches them. The primitive id of
+// a triangle is its row in the index array. Queries use double precision
+// arithmetic (unlike the CGAL AABB trees, which use exact predicates).
+// Copies share the same tree.
+class Flat_AABB_tree_3
+{
+#ifndef SWIG
+  struct Node
+  {
+    double min[3], max[3];
+    std::int32_t begin, end;  // range of triangles (in leaf order) covered by the node
+    std::int32_t right;       // -1 for a leaf, the left child follows the node
+    std::int32_t padding;
+  };
+
+  // layout of the beginning of a file; the offsets of the arrays are
+  // multiples of 8 from the beginning of the file
+  struct Header
+  {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t byte_order;
+    std::uint64_t leaf_size;
+    std::uint64_t nb_vertices, nb_faces, nb_nodes;
+    std::uint64_t vertices_offset, faces_offset, ids_offset, nodes_offset;
+  };
+
+  struct Data
+  {
+    // storage of a tree built in memory
+    std::vector<double> vertices;      // 3 values per vertex
+    std::vector<std::int32_t> faces;   // 3 vertex indices per triangle, in leaf order once built
+    std::vector<std::int32_t> ids;     // primitive id of each triangle, in leaf order
+    std::vector<Node> nodes;           // in preorder, nodes[0] is the root
+    // storage of a loaded tree (file or shared memory mapping, or copy of a state)
+    std::shared_ptr<void> storage;
+
+    const double* vertex_data;
+    const std::int32_t* face_data;
+    const std::int32_t* id_data;
+    const Node* node_data;
+    std::size_t nb_vertices, nb_faces, nb_nodes;
+    std::size_t leaf_size;
+
+    void point_to_vectors()
+    {
+      vertex_data = vertices.data();
+      face_data = faces.data();
+      id_data = ids.data();
+      node_data = nodes.data();
+      nb_vertices = vertices.size() / 3;
+      nb_faces = faces.size() / 3;
+      nb_nodes = nodes.size();
+    }
+  };
+#endif
+
+  std::shared_ptr<Data> data_sptr;
+
+#ifndef SWIG
+  static std::uint32_t byte_order() { return 0x01020304; }
+
+  const double* vertex (std::int32_t v) const { return data_sptr->vertex_data + 3 * std::size_t(v); }
+  const std::int32_t* face (std::size_t f) const { return data_sptr->face_data + 3 * f; }
+
+  // number of nodes of a subtree on n triangles
+  std::size_t node_count (std::size_t n, std::map<std::size_t, std::size_t>& memo) const
+  {
+    if (n <= data_sptr->leaf_size)
+      return 1;
+    std::map<std::size_t, std::size_t>::iterator it = memo.find (n);
+    if (it != memo.end())
+      return it->second;
+    std::size_t out = 1 + node_count (n / 2, memo) + node_count (n - n / 2, memo);
+    memo[n] = out;
+    return out;
+  }
+
+  // builds the subtree `node_id` on the range [begin,end) of `order` (see
+  // Index_kd_tree_3::build_node()), splitting at the median of the centroids
+  void build_node (std::int32_t node_id, std::int32_t begin, std::int32_t end,
+                   std::vector<std::int32_t>& order, const std::vector<double>& boxes,
+                   const std::map<std::size_t, std::size_t>& memo, std::size_t parallel_size)
+  {
+    Data& data = *data_sptr;
+    Node node;
+    double cmin[3], cmax[3];
+    for (int d = 0; d < 3; ++ d)
+    {
+      node.min[d] = cmin[d] = std::numeric_limits<double>::max();
+      node.max[d] = cmax[d] = -std::numeric_limits<double>::max();
+    }
+    for (std::int32_t i = begin; i < end; ++ i)
+    {
+      const double* box = boxes.data() + 6 * std::size_t(order[i]);
+      for (int d = 0; d < 3; ++ d)
+      {
+        node.min[d] = (std::min)(node.min[d], box[d]);
+        node.max[d] = (std::max)(node.max[d], box[d + 3]);
+        double c = 0.5 * (box[d] + box[d + 3]);
+        cmin[d] = (std::min)(cmin[d], c);
+        cmax[d] = (std::max)(cmax[d], c);
+      }
+    }
+    node.begin = begin;
+    node.end = end;
+    node.right = -1;
+    node.padding = 0;
+
+    if (std::size_t(end - begin) > data.leaf_size)
+    {
+      int dimension = 0;
+      for (int d = 1; d < 3; ++ d)
+        if (cmax[d] - cmin[d] > cmax[dimension] - cmin[dimension])
+          dimension = d;
+
+      std::int32_t middle = begin + (end - begin) / 2;
+      std::nth_element (order.begin() + begin, order.begin() + middle, order.begin() + end,
+                        [&](std::int32_t a, std::int32_t b)
+                        {
+                          const double* ba = boxes.data() + 6 * std::size_t(a);
+                          const double* bb = boxes.data() + 6 * std::size_t(b);
+                          return ba[dimension] + ba[dimension + 3] < bb[dimension] + bb[dimension + 3];
+                        });
+
+      std::size_t left_size = std::size_t(middle - begin);
+      std::size_t left_count = 1;
+      if (left_size > data.leaf_size)
+        left_count = memo.find (left_size)->second;
+      std::int32_t left = node_id + 1;
+      node.right = node_id + 1 + std::int32_t(left_count);
+
+#ifdef CGAL_LINKED_WITH_TBB
+      if (std::size_t(end - begin) > parallel_size)
+      {
+        tbb::task_group tasks;
+        tasks.run ([&]() { build_node (left, begin, middle, order, boxes, memo, parallel_size); });
+        build_node (node.right, middle, end, order, boxes, memo, parallel_size);
+        tasks.wait();
+      }
+      else
+#endif
+      {
+        build_node (left, begin, middle, order, boxes, memo, parallel_size);
+        build_node (node.right, middle, end, order, boxes, memo, parallel_size);
+      }
+    }
+    data.nodes[std::size_t(node_id)] = node;
+  }
+
+  // parameter of the entry of the ray in the box if it is less than `t_max`, -1 otherwise
+  static double ray_box (const double* o, const double* inv_d, const Node& node, double t_max)
+  {
+    double t0 = 0., t1 = t_max;
+    for (int d = 0; d < 3; ++ d)
+    {
+      double a = (node.min[d] - o[d]) * inv_d[d];
+      double b = (node.max[d] - o[d]) * inv_d[d];
+      if (a > b) std::swap (a, b);
+      // NaN (ray in the plane of a face of the box) keeps the previous bounds
+      if (a > t0) t0 = a;
+      if (b < t1) t1 = b;
+      if (t0 > t1) return -1.;
+    }
+    return t0;
+  }
+
+  // parameter of the intersection of the ray with the triangle (Moller-Trumbore), -1 if none
+  double ray_triangle (const double* o, const double* d, std::size_t f) const
+  {
+    const double* a = vertex (face(f)[0]);
+    const double* b = vertex (face(f)[1]);
+    const double* c = vertex (face(f)[2]);
+    double e1[3] = { b[0] - a[0], b[1] - a[1], b[2] - a[2] };
+    double e2[3] = { c[0] - a[0], c[1] - a[1], c[2] - a[2] };
+    double p[3] = { d[1] * e2[2] - d[2] * e2[1], d[2] * e2[0] - d[0] * e2[2], d[0] * e2[1] - d[1] * e2[0] };
+    double det = e1[0] * p[0] + e1[1] * p[1] + e1[2] * p[2];
+    if (det == 0.)
+      return -1.;
+    double s[3] = { o[0] - a[0], o[1] - a[1], o[2] - a[2] };
+    double u = (s[0] * p[0] + s[1] * p[1] + s[2] * p[2]) / det;
+    if (u < 0. || u > 1.)
+      return -1.;
+    double q[3] = { s[1] * e1[2] - s[2] * e1[1], s[2] * e1[0] - s[0] * e1[2], s[0] * e1[1] - s[1] * e1[0] };
+    double v = (d[0] * q[0] + d[1] * q[1] + d[2] * q[2]) / det;
+    if (v < 0. || u + v > 1.)
+      return -1.;
+    double t = (e2[0] * q[0] + e2[1] * q[1] + e2[2] * q[2]) / det;
+    return t >= 0. ? t : -1.;
+  }
+
+  static double squared_distance_to_box (const double* p, const Node& node)
+  {
+    double out = 0.;
+    for (int d = 0; d < 3; ++ d)
+    {
+      double diff = (std::max)((std::max)(node.min[d] - p[d], 0.), p[d] - node.max[d]);
+      out += diff * diff;
+    }
+    return out;
+  }
+
+  // closest point of the triangle (Ericson, Real-Time Collision Detection, 5.1.5)
+  void closest_point_on_triangle (const double* p, std::size_t f, double* out) const
+  {
+    const double* a = vertex (face(f)[0]);
+    const double* b = vertex (face(f)[1]);
+    const double* c = vertex (face(f)[2]);
+    auto dot = [](const double* x, const double* y) { return x[0] * y[0] + x[1] * y[1] + x[2] * y[2]; };
+    auto set = [&](double wa, double wb, double wc)
+    {
+      for (int i = 0; i < 3; ++ i)
+        out[i] = wa * a[i] + wb * b[i] + wc * c[i];
+    };
+    double ab[3] = { b[0] - a[0], b[1] - a[1], b[2] - a[2] };
+    double ac[3] = { c[0] - a[0], c[1] - a[1], c[2] - a[2] };
+    double ap[3] = { p[0] - a[0], p[1] - a[1], p[2] - a[2] };
+    double d1 = dot (ab, ap), d2 = dot (ac, ap);
+    if (d1 <= 0. && d2 <= 0.) { set (1., 0., 0.); return; }
+    double bp[3] = { p[0] - b[0], p[1] - b[1], p[2] - b[2] };
+    double d3 = dot (ab, bp), d4 = dot (ac, bp);
+    if (d3 >= 0. && d4 <= d3) { set (0., 1., 0.); return; }
+    double vc = d1 * d4 - d3 * d2;
+    if (vc <= 0. && d1 >= 0. && d3 <= 0.)
+    {
+      double v = d1 / (d1 - d3);
+      set (1. - v, v, 0.);
+      return;
+    }
+    double cp[3] = { p[0] - c[0], p[1] - c[1], p[2] - c[2] };
+    double d5 = dot (ab, cp), d6 = dot (ac, cp);
+    if (d6 >= 0. && d5 <= d6) { set (0., 0., 1.); return; }
+    double vb = d5 * d2 - d1 * d6;
+    if (vb <= 0. && d2 >= 0. && d6 <= 0.)
+    {
+      double w = d2 / (d2 - d6);
+      set (1. - w, 0., w);
+      return;
+    }
+    double va = d3 * d6 - d5 * d4;
+    if (va <= 0. && (d4 - d3) >= 0. && (d5 - d6) >= 0.)
+    {
+      double w = (d4 - d3) / ((d4 - d3) + (d5 - d6));
+      set (0., 1. - w, w);
+      return;
+    }
+    double denom = va + vb + vc;
+    if (denom == 0.) // degenerate triangle
+    {
+      set (1., 0., 0.);
+      return;
+    }
+    double v = vb / denom, w = vc / denom;
+    set (1. - v - w, v, w);
+  }
+
+  // first hit of the ray: position of the triangle in leaf order (-1 if none) and parameter
+  std::pair<std::int32_t, double> first_hit (const double* o, const double* d) const
+  {
+    const Data& data = *data_sptr;
+    double inv_d[3] = { 1. / d[0], 1. / d[1], 1. / d[2] };
+    std::pair<std::int32_t, double> best (-1, std::numeric_limits<double>::max());
+    std::vector<std::int32_t> stack (1, 0);
+    while (!stack.empty())
+    {
+      const Node& node = data.node_data[stack.back()];
+      std::int32_t node_id = stack.back();
+      stack.pop_back();
+      if (ray_box (o, inv_d, node, best.second) < 0.)
+        continue;
+      if (node.right == -1)
+      {
+        for (std::int32_t f = node.begin; f < node.end; ++ f)
+        {
+          double t = ray_triangle (o, d, std::size_t(f));
+          if (t >= 0. && t < best.second)
+            best = std::make_pair (f, t);
+        }
+        continue;
+      }
+      // visit first the child whose box is entered first
+      std::int32_t left = node_id + 1;
+      double t_left = ray_box (o, inv_d, data.node_data[left], best.second);
+      double t_right = ray_box (o, inv_d, data.node_data[node.right], best.second);
+      if (t_left >= 0. && t_right >= 0.)
+      {
+        stack.push_back (t_left < t_right ? node.right : left);
+        stack.push_back (t_left < t_right ? left : node.right);
+      }
+      else if (t_left >= 0.)
+        stack.push_back (left);
+      else if (t_right >= 0.)
+        stack.push_back (node.right);
+    }
+    return best;
+  }
+
+  // cast of the virtual scanners, see Virtual_scanner.h
+  struct Scanner_cast
+  {
+    const Flat_AABB_tree_3* tree;
+    bool operator() (const double* o, const double* d, int& id, double& t, double* triangle) const
+    {
+      if (tree->data_sptr->nb_faces == 0) return false;
+      std::pair<std::int32_t, double> hit = tree->first_hit (o, d);
+      if (hit.first == -1) return false;
+      id = tree->data_sptr->id_data[hit.first];
+      t = hit.second;
+      const std::int32_t* f = tree->face (std::size_t(hit.first));
+      for (int j = 0; j < 3; ++ j)
+        std::copy (tree->vertex (f[j]), tree->vertex (f[j]) + 3, triangle + 3 * j);
+      return true;
+    }
+  };
+
+  // closest point: position of the triangle in leaf order, squared distance and point
+  std::int32_t closest (const double* p, double& sq_distance, double* point) const
+  {
+    const Data& data = *data_sptr;
+    std::int32_t best = -1;
+    sq_distance = std::numeric_limits<double>::max();
+    std::vector<std::pair<double, std::int32_t> > stack (1, std::make_pair (0., std::int32_t(0)));
+    while (!stack.empty())
+    {
+      std::pair<double, std::int32_t> top = stack.back();
+      stack.pop_back();
+      if (top.first >= sq_distance)
+        continue;
+      const Node& node = data.node_data[top.second];
+      if (node.right == -1)
+      {
+        for (std::int32_t f = node.begin; f < node.end; ++ f)
+        {
+          double c[3];
+          closest_point_on_triangle (p, std::size_t(f), c);
+          double sd = (c[0] - p[0]) * (c[0] - p[0]) + (c[1] - p[1]) * (c[1] - p[1])
+            + (c[2] - p[2]) * (c[2] - p[2]);
+          if (sd < sq_distance)
+          {
+            sq_distance = sd;
+            best = f;
+            std::copy (c, c + 3, point);
+          }
+        }
+        continue;
+      }
+      std::int32_t left = top.second + 1;
+      double d_left = squared_distance_to_box (p, data.node_data[left]);
+      double d_right = squared_distance_to_box (p, data.node_data[node.right]);
+      // the closest child is visited first
+      if (d_left < d_right)
+      {
+        stack.push_back (std::make_pair (d_right, node.right));
+        stack.push_back (std::make_pair (d_left, left));
+      }
+      else
+      {
+        stack.push_back (std::make_pair (d_left, left));
+        stack.push_back (std::make_pair (d_right, node.right));
+      }
+    }
+    return best;
+  }
+
+  void check_built() const
+  {
+    if (!is_built())
+      throw std::runtime_error("The tree must be built before being queried (call build())");
+  }
+
+  template <typename T>
+  static void write_array (std::ostream& os, const T* values, std::size_t size, std::uint64_t& offset)
+  {
+    static const char zeros[8] = { 0, 0, 0, 0, 0, 0, 0, 0 };
+    std::uint64_t position = std::uint64_t(os.tellp());
+    std::uint64_t padding = (8 - position % 8) % 8;
+    os.write (zeros, std::streamsize(padding));
+    offset = position + padding;
+    os.write (reinterpret_cast<const char*>(values), std::streamsize(size * sizeof(T)));
+  }
+
+  template <typename T>
+  static const T* mapped_array (const char* base, std::size_t size,
+                                std::uint64_t offset, std::uint64_t nb_values,
+                                const std::string& source)
+  {
+    if (offset % 8 != 0 || offset > size
+        || nb_values > (size - offset) / sizeof(T))
+      throw std::runtime_error(source + " is not a valid AABB tree file");
+    return reinterpret_cast<const T*>(base + offset);
+  }
+
+  // the tree of the `size` bytes at `base` (8 bytes aligned), written by
+  // write_state() and kept alive by `storage`
+  static Flat_AABB_tree_3 mapped_tree (const char* base, std::size_t size,
+                                       std::shared_ptr<void> storage, const std::string& source)
+  {
+    Header header;
+    if (size < sizeof(header))
+      throw std::runtime_error(source + " is not an AABB tree file");
+    std::memcpy (&header, base, sizeof(header));
+    if (std::memcmp (header.magic, magic(), 8) != 0)
+      throw std::runtime_error(source + " is not an AABB tree file");
+    if (header.version != version())
+      throw std::runtime_error("Unsupported AABB tree file version");
+    if (header.byte_order != byte_order())
+      throw std::runtime_error(source + " was written with another byte order");
+    if (header.nb_vertices > std::uint64_t(std::numeric_limits<std::int32_t>::max())
+        || header.nb_faces > std::uint64_t(std::numeric_limits<std::int32_t>::max())
+        || (header.nb_faces != 0 && header.nb_nodes == 0))
+      throw std::runtime_error(source + " is not a valid AABB tree file");
+
+    Flat_AABB_tree_3 out;
+    Data& data = *out.data_sptr;
+    data.vertex_data = mapped_array<double> (base, size, header.vertices_offset, 3 * header.nb_vertices, source);
+    data.face_data = mapped_array<std::int32_t> (base, size, header.faces_offset, 3 * header.nb_faces, source);
+    data.id_data = mapped_array<std::int32_t> (base, size, header.ids_offset, header.nb_faces, source);
+    data.node_data = mapped_array<Node> (base, size, header.nodes_offset, header.nb_nodes, source);
+    data.nb_vertices = std::size_t(header.nb_vertices);
+    data.nb_faces = std::size_t(header.nb_faces);
+    data.nb_nodes = std::size_t(header.nb_nodes);
+    data.leaf_size = std::size_t(header.leaf_size);
+    data.storage = storage;
+    return out;
+  }
+#endif
+
+public:
+#ifndef SWIG
+  static const char* magic() { return "CGALAAB3"; }
+  static std::uint32_t version() { return 1; }
+#endif
+
+  Flat_AABB_tree_3() : data_sptr(new Data())
+  {
+    data_sptr->leaf_size = 4;
+    data_sptr->point_to_vectors();
+  }
+
+  Flat_AABB_tree_3 (SWIG_CGAL::Buffer<double> vertices, SWIG_CGAL::Buffer<int> faces)
+    : data_sptr(new Data())
+  {
+    if (vertices.size() % 3 != 0 || faces.size() % 3 != 0)
+      throw std::invalid_argument("Expecting (V,3) vertices and (F,3) vertex indices");
+    const std::int32_t nb_vertices = std::int32_t(vertices.size() / 3);
+    for (std::size_t i = 0; i < faces.size(); ++ i)
+      if (faces[i] < 0 || faces[i] >= nb_vertices)
+        throw std::invalid_argument("Vertex index out of range");
+    Data& data = *data_sptr;
+    data.leaf_size = 4;
+    data.vertices.assign (vertices.data(), vertices.data() + vertices.size());
+    data.faces.assign (faces.data(), faces.data() + faces.size());
+    data.point_to_vectors();
+  }
+
+  int size() const { return int(data_sptr->nb_faces); }
+  int number_of_vertices() const { return int(data_sptr->nb_vertices); }
+  bool is_built() const { return data_sptr->nb_nodes != 0 || data_sptr->nb_faces == 0; }
+  // true for a tree loaded from a file, a binary state or shared memory
+  bool is_mapped() const { return bool(data_sptr->storage); }
+
+  // Builds the tree, with at most `leaf_size` triangles per leaf. If
+  // `parallel` (and TBB is available), the subtrees of more than 100000
+  // triangles are built concurrently. The tree does not depend on `parallel`.
+  void build (int leaf_size = 4, bool parallel = true)
+  {
+    if (leaf_size < 1)
+      throw std::invalid_argument("Leaf size must be positive");
+    if (is_mapped())
+      throw std::runtime_error("A tree loaded from a file is already built");
+    Data& data = *data_sptr;
+    data.leaf_size = std::size_t(leaf_size);
+
+    // the input order is restored first in case of a rebuild
+    const std::size_t nb_faces = data.faces.size() / 3;
+    if (!data.ids.empty())
+    {
+      std::vector<std::int32_t> faces (data.faces.size());
+      for (std::size_t i = 0; i < nb_faces; ++ i)
+        std::copy (data.faces.begin() + 3 * i, data.faces.begin() + 3 * i + 3,
+                   faces.begin() + 3 * std::size_t(data.ids[i]));
+      data.faces.swap (faces);
+    }
+
+    std::vector<double> boxes (6 * nb_faces);
+    std::vector<std::int32_t> order (nb_faces);
+    for (std::size_t i = 0; i < nb_faces; ++ i)
+      order[i] = std::int32_t(i);
+    CGAL::for_each<SWIG_AABB_tree::Concurrency_tag>
+      (SWIG_AABB_tree::query_rows (nb_faces), [&](const std::size_t& f) -> bool
+       {
+         double* box = boxes.data() + 6 * f;
+         for (int d = 0; d < 3; ++ d)
+         {
+           box[d] = std::numeric_limits<double>::max();
+           box[d + 3] = -std::numeric_limits<double>::max();
+         }
+         for (int j = 0; j < 3; ++ j)
+         {
+           const double* v = data.vertices.data() + 3 * std::size_t(data.faces[3 * f + j]);
+           for (int d = 0; d < 3; ++ d)
+           {
+             box[d] = (std::min)(box[d], v[d]);
+             box[d + 3] = (std::max)(box[d + 3], v[d]);
+           }
+         }
+         return true;
+       });
+
+    data.nodes.clear();
+    if (nb_faces != 0)
+    {
+      std::map<std::size_t, std::size_t> memo;
+      data.nodes.assign (node_count (nb_faces, memo), Node());
+      build_node (0, 0, std::int32_t(nb_faces), order, boxes, memo,
+                  parallel ? std::size_t(100000) : (std::numeric_limits<std::size_t>::max)());
+    }
+
+    // triangles are stored in leaf order
+    std::vector<std::int32_t> faces (data.faces.size());
+    for (std::size_t i = 0; i < nb_faces; ++ i)
+      std::copy (data.faces.begin() + 3 * std::size_t(order[i]),
+                 data.faces.begin() + 3 * std::size_t(order[i]) + 3, faces.begin() + 3 * i);
+    data.faces.swap (faces);
+    data.ids.swap (order);
+    data.point_to_vectors();
+  }
+
+  // read-only view on the vertices
+  SWIG_CGAL::Buffer<double> vertex_array() const
+  {
+    return SWIG_CGAL::Buffer<double>(const_cast<double*>(data_sptr->vertex_data),
+                                     data_sptr->nb_vertices, 3, data_sptr, true);
+  }
+
+  // see AABB_tree_wrapper::first_intersection_batch()
+  Ray_hit_batch first_intersection_batch (SWIG_CGAL::Buffer<double> origins, SWIG_CGAL::Buffer<double> directions) const
+  {
+    check_built();
+    std::size_t nb_queries = SWIG_AABB_tree::number_of_points (origins);
+    if (directions.size() != origins.size())
+      throw std::invalid_argument("Expecting as many directions as origins");
+    Ray_hit_batch out (nb_queries);
+    if (data_sptr->nb_faces == 0) return out;
+    int* ids = out.id_data();
+    double* parameters = out.parameter_data();
+    double* points = out.point_data();
+    CGAL::for_each<SWIG_AABB_tree::Concurrency_tag>
+      (SWIG_AABB_tree::query_rows (nb_queries), [&](const std::size_t& row) -> bool
+       {
+         const double* o = origins.data() + 3 * row;
+         const double* d = directions.data() + 3 * row;
+         if (d[0] == 0. && d[1] == 0. && d[2] == 0.) return true;
+         std::pair<std::int32_t, double> hit = first_hit (o, d);
+         if (hit.first == -1) return true;
+         ids[row] = data_sptr->id_data[hit.first];
+         parameters[row] = hit.second;
+         for (int i = 0; i < 3; ++ i)
+           points[3 * row + i] = o[i] + hit.second * d[i];
+         return true;
+       });
+    return out;
+  }
+
+  // see AABB_tree_wrapper::closest_point_batch()
+  Closest_point_batch closest_point_batch (SWIG_CGAL::Buffer<double> points) const
+  {
+    check_built();
+    std::size_t nb_queries = SWIG_AABB_tree::number_of_points (points);
+    Closest_point_batch out (nb_queries);
+    if (nb_queries == 0) return out;
+    if (data_sptr->nb_faces == 0)
+      throw std::runtime_error("Distance queries on an empty tree");
+    int* ids = out.id_data();
+    double* closest_points = out.point_data();
+    CGAL::for_each<SWIG_AABB_tree::Concurrency_tag>
+      (SWIG_AABB_tree::query_rows (nb_queries), [&](const std::size_t& row) -> bool
+       {
+         double sq_distance;
+         std::int32_t f = closest (points.data() + 3 * row, sq_distance, closest_points + 3 * row);
+         ids[row] = data_sptr->id_data[f];
+         return true;
+       });
+    return out;
+  }
+
+  SWIG_CGAL::Buffer<double> squared_distance_batch (SWIG_CGAL::Buffer<double> points) const
+  {
+    check_built();
+    std::size_t nb_queries = SWIG_AABB_tree::number_of_points (points);
+    std::vector<double> out (nb_queries);
+    if (nb_queries != 0 && data_sptr->nb_faces == 0)
+      throw std::runtime_error("Distance queries on an empty tree");
+    CGAL::for_each<SWIG_AABB_tree::Concurrency_tag>
+      (SWIG_AABB_tree::query_rows (nb_queries), [&](const std::size_t& row) -> bool
+       {
+         double point[3];
+         closest (points.data() + 3 * row, out[row], point);
+         return true;
+       });
+    return SWIG_CGAL::Buffer<double>(std::move (out));
+  }
+
+  // see AABB_tree_indexed_Triangle_3_soup::render_depth()
+  Range_image render_depth (SWIG_CGAL::Buffer<double> intrinsics, SWIG_CGAL::Buffer<double> pose, int width, int height) const
+  {
+    check_built();
+    Scanner_cast cast = { this };
+    return SWIG_AABB_tree::render_depth (intrinsics, pose, width, height, cast);
+  }
+
+  Range_image simulate_lidar (SWIG_CGAL::Buffer<double> pose, SWIG_CGAL::Buffer<double> pattern) const
+  {
+    check_built();
+    Scanner_cast cast = { this };
+    return SWIG_AABB_tree::simulate_lidar (pose, pattern, cast);
+  }
+
+  // binary file with the vertices, the triangles and the built hierarchy, in
+  // the native byte order
+  void save (const std::string& filename) const
+  {
+    std::ofstream os (filename.c_str(), std::ios::binary);
+    if (!os)
+      throw std::runtime_error("Cannot open file " + filename);
+    write_state (os);
+    if (!os)
+      throw std::runtime_error("Cannot write file " + filename);
+  }
+
+  // maps a file written by save() in memory (read-only)
+  static Flat_AABB_tree_3 load (const std::string& filename)
+  {
+    boost::interprocess::file_mapping file (filename.c_str(), boost::interprocess::read_only);
+    std::shared_ptr<boost::interprocess::mapped_region> region
+      = std::make_shared<boost::interprocess::mapped_region> (file, boost::interprocess::read_only);
+    return mapped_tree (static_cast<const char*>(region->get_address()), region->get_size(), region, filename);
+  }
+
+//Binary state, in the format of save(). Loaded from shared memory, the
+//tree is used in the pages of the segment; a state given as bytes is copied.
+#ifndef SWIG
+  void write_state (std::ostream& os) const
+  {
+    check_built();
+    const Data& data = *data_sptr;
+    // the offsets are counted from the beginning of the stream
+    Header header;
+    std::memset (&header, 0, sizeof(header));
+    std::memcpy (header.magic, magic(), 8);
+    header.version = version();
+    header.byte_order = byte_order();
+    header.leaf_size = data.leaf_size;
+    header.nb_vertices = data.nb_vertices;
+    header.nb_faces = data.nb_faces;
+    header.nb_nodes = data.nb_nodes;
+    os.write (reinterpret_cast<const char*>(&header), sizeof(header));
+    write_array (os, data.vertex_data, 3 * data.nb_vertices, header.vertices_offset);
+    write_array (os, data.face_data, 3 * data.nb_faces, header.faces_offset);
+    write_array (os, data.id_data, data.nb_faces, header.ids_offset);
+    write_array (os, data.node_data, data.nb_nodes, header.nodes_offset);
+    // offsets are now known
+    const std::streamoff end = os.tellp();
+    os.seekp (0);
+    os.write (reinterpret_cast<const char*>(&header), sizeof(header));
+    os.seekp (end);
+  }
+  void read_state (const char* data, std::size_t size,
+                   const std::shared_ptr<boost::interprocess::mapped_region>& region)
+  {
+    if (region)
+    {
+      *this = mapped_tree (data, size, region, "shared memory segment");
+      return;
+    }
+    // copied to 8 bytes aligned storage
+    std::shared_ptr<std::vector<std::uint64_t> > copy
+      = std::make_shared<std::vector<std::uint64_t> > ((size + 7) / 8);
+    if (size != 0)
+      std::memcpy (copy->data(), data, size);
+    *this = mapped_tree (reinterpret_cast<const char*>(copy->data()), size, copy, "binary state");
+  }
+#endif
+  SWIG_CGAL_BINARY_STATE_FUNCTIONS
+};
+
+#endif //SWIG_CGAL_AABB_TREE_FLAT_AABB_TREE_H
@@ -0,0 +1,63 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+#ifndef SWIG_CGAL_AABB_TREE_INDEXED_TRIANGLE_PRIMITIVE_H
+#define SWIG_CGAL_AABB_TREE_INDEXED_TRIANGLE_PRIMITIVE_H
+
+#include <SWIG_CGAL/Kernel/typedefs.h>
+
+#include <boost/iterator/counting_iterator.hpp>
+
+#include <vector>
+
+namespace SWIG_AABB_tree {
+
+// vertices (3 coordinates each) and triangles (3 vertex indices each)
+struct Indexed_triangle_soup
+{
+  std::vector<double> vertices;
+  std::vector<int> faces;
+
+  EPIC_Kernel::Point_3 vertex(int v) const
+  {
+    const double* c = vertices.data() + 3 * std::size_t(v);
+    return EPIC_Kernel::Point_3(c[0], c[1], c[2]);
+  }
+  EPIC_Kernel::Triangle_3 triangle(int f) const
+  {
+    const int* t = faces.data() + 3 * std::size_t(f);
+    return EPIC_Kernel::Triangle_3(vertex(t[0]), vertex(t[1]), vertex(t[2]));
+  }
+};
+
+// primitive storing only the index of its triangle in the soup shared by the
+// tree (model of AABBPrimitiveWithSharedData)
+class Indexed_triangle_primitive
+{
+  int m_id;
+
+public:
+  typedef int Id;
+  typedef EPIC_Kernel::Point_3 Point;
+  typedef EPIC_Kernel::Triangle_3 Datum;
+  typedef const Indexed_triangle_soup* Shared_data;
+
+  Indexed_triangle_primitive() : m_id(-1) {}
+  Indexed_triangle_primitive(boost::counting_iterator<int> it, const Indexed_triangle_soup*)
+    : m_id(*it) {}
+
+  static Shared_data construct_shared_data(const Indexed_triangle_soup* soup) { return soup; }
+
+  Id id() const { return m_id; }
+  Datum datum(Shared_data soup) const { return soup->triangle(m_id); }
+  Point reference_point(Shared_data soup) const
+  {
+    return soup->vertex(soup->faces[3 * std::size_t(m_id)]);
+  }
+};
+
+} // namespace SWIG_AABB_tree
+
+#endif //SWIG_CGAL_AABB_TREE_INDEXED_TRIANGLE_PRIMITIVE_H
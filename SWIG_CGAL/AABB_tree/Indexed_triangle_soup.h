@@ -0,0 +1,208 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+
+#ifndef SWIG_CGAL_AABB_TREE_INDEXED_TRIANGLE_SOUP_H
+#define SWIG_CGAL_AABB_TREE_INDEXED_TRIANGLE_SOUP_H
+
+#include <SWIG_CGAL/Common/Buffer.h>
+#include <SWIG_CGAL/Common/Freeze_state.h>
+#include <SWIG_CGAL/Common/Macros.h>
+#include <SWIG_CGAL/Common/Shared_memory.h>
+#include <SWIG_CGAL/Common/Optional.h>
+#include <SWIG_CGAL/Kernel/Point_3.h>
+#include <SWIG_CGAL/Kernel/Plane_3.h>
+#include <SWIG_CGAL/Kernel/Ray_3.h>
+#include <SWIG_CGAL/Kernel/Segment_3.h>
+#include <SWIG_CGAL/Kernel/Triangle_3.h>
+#include <SWIG_CGAL/AABB_tree/Query_batch.h>
+#include <SWIG_CGAL/AABB_tree/Virtual_scanner.h>
+
+#include <boost/iterator/counting_iterator.hpp>
+
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+// AABB tree on the triangles of a (F,3) array of vertex indices in a (V,3)
+// array of vertices. Both arrays are copied once, and the primitives only
+// store the index of their triangle, which is the primitive id. Copies share
+// the same tree.
+class AABB_tree_indexed_Triangle_3_soup
+{
+  std::shared_ptr<SWIG_AABB_tree::Indexed_triangle_soup> soup_sptr;
+  std::shared_ptr<CGAL_ITSP_Tree> tree_sptr; //refers to *soup_sptr
+  std::shared_ptr<SWIG_CGAL::Freeze_state> freeze_sptr; //shared with the tree
+
+  #ifndef SWIG
+  // coordinates of the vertices of a triangle, for the virtual scanners
+  struct Triangle_coordinates
+  {
+    const SWIG_AABB_tree::Indexed_triangle_soup* soup;
+    void operator()(int id, double* out) const
+    {
+      for (int j = 0; j < 3; ++j)
+        std::copy(soup->vertices.begin() + 3 * std::size_t(soup->faces[3 * std::size_t(id) + j]),
+                  soup->vertices.begin() + 3 * std::size_t(soup->faces[3 * std::size_t(id) + j]) + 3,
+                  out + 3 * j);
+    }
+  };
+
+  void insert_soup()
+  {
+    int nb_vertices=int(soup_sptr->vertices.size()/3);
+    for (int v : soup_sptr->faces)
+      if (v<0 || v>=nb_vertices)
+        throw std::invalid_argument("Vertex index out of range");
+    tree_sptr->insert(boost::counting_iterator<int>(0),
+                      boost::counting_iterator<int>(int(soup_sptr->faces.size()/3)),
+                      static_cast<const SWIG_AABB_tree::Indexed_triangle_soup*>(soup_sptr.get()));
+  }
+  #endif
+
+public:
+  #ifndef SWIG
+  typedef CGAL_ITSP_Tree cpp_base;
+  const cpp_base& get_data() const {return *tree_sptr;}
+        cpp_base& get_data()       {return *tree_sptr;}
+  #endif
+
+  typedef std::pair<Point_3,int> Point_and_primitive_id;
+  typedef Optional<int> Optional_primitive_id;
+
+//Creation
+  AABB_tree_indexed_Triangle_3_soup()
+    : soup_sptr(new SWIG_AABB_tree::Indexed_triangle_soup()), tree_sptr(new CGAL_ITSP_Tree()),
+      freeze_sptr(new SWIG_CGAL::Freeze_state())
+  {}
+  AABB_tree_indexed_Triangle_3_soup(SWIG_CGAL::Buffer<double> vertices, SWIG_CGAL::Buffer<int> faces)
+    : soup_sptr(new SWIG_AABB_tree::Indexed_triangle_soup()), tree_sptr(new CGAL_ITSP_Tree()),
+      freeze_sptr(new SWIG_CGAL::Freeze_state())
+  {
+    if (vertices.size()%3!=0 || faces.size()%3!=0)
+      throw std::invalid_argument("Expecting (V,3) vertices and (F,3) vertex indices");
+    soup_sptr->vertices.assign(vertices.data(),vertices.data()+vertices.size());
+    soup_sptr->faces.assign(faces.data(),faces.data()+faces.size());
+    insert_soup();
+  }
+  int size() const {return int(tree_sptr->size());}
+  bool empty() const {return tree_sptr->empty();}
+  int number_of_vertices() const {return int(soup_sptr->vertices.size()/3);}
+  Triangle_3 triangle(int id) const {return Triangle_3(soup_sptr->triangle(id));}
+  //read-only views on the copies of the input arrays
+  SWIG_CGAL::Buffer<double> vertex_array() const
+  {
+    return SWIG_CGAL::Buffer<double>(soup_sptr->vertices.data(),soup_sptr->vertices.size()/3,3,
+                                     soup_sptr,true);
+  }
+  SWIG_CGAL::Buffer<int> face_array() const
+  {
+    return SWIG_CGAL::Buffer<int>(soup_sptr->faces.data(),soup_sptr->faces.size()/3,3,
+                                  soup_sptr,true);
+  }
+  void build() {freeze_sptr->check_not_frozen("build"); tree_sptr->build();}
+//Binary state: the vertex and index arrays, the tree being rebuilt on load
+  #ifndef SWIG
+  void write_state(std::ostream& os)
+  {
+    SWIG_CGAL::write_state_magic(os, "CGALITS3");
+    SWIG_CGAL::write_state_array(os, soup_sptr->vertices.data(), soup_sptr->vertices.size());
+    SWIG_CGAL::write_state_array(os, soup_sptr->faces.data(), soup_sptr->faces.size());
+  }
+  void read_state(const char* data, std::size_t size,
+                  const std::shared_ptr<boost::interprocess::mapped_region>&)
+  {
+    freeze_sptr->check_not_frozen("load_state");
+    SWIG_CGAL::Memory_istream is(data, size);
+    SWIG_CGAL::read_state_magic(is, "CGALITS3", "AABB_tree_indexed_Triangle_3_soup");
+    std::shared_ptr<SWIG_AABB_tree::Indexed_triangle_soup> soup(new SWIG_AABB_tree::Indexed_triangle_soup());
+    SWIG_CGAL::read_state_array(is, soup->vertices);
+    SWIG_CGAL::read_state_array(is, soup->faces);
+    if (soup->vertices.size()%3!=0 || soup->faces.size()%3!=0)
+      throw std::runtime_error("Corrupted binary state of an AABB_tree_indexed_Triangle_3_soup");
+    //the copies keep the previous tree
+    soup_sptr=soup;
+    tree_sptr.reset(new CGAL_ITSP_Tree());
+    freeze_sptr.reset(new SWIG_CGAL::Freeze_state());
+    insert_soup();
+  }
+  #endif
+  SWIG_CGAL_BINARY_STATE_FUNCTIONS
+  //see AABB_tree_wrapper::prepare()
+  void prepare() {
+    CGAL_ITSP_Tree& tree=*tree_sptr;
+    freeze_sptr->build_if_not_frozen([&tree](){ SWIG_AABB_tree::prepare(tree); });
+  }
+  //see AABB_tree_wrapper::freeze(), the copies are frozen too
+  void freeze() {
+    CGAL_ITSP_Tree& tree=*tree_sptr;
+    freeze_sptr->freeze([&tree](){ SWIG_AABB_tree::prepare(tree); });
+  }
+  bool is_frozen() const {return freeze_sptr->is_frozen();}
+//Intersection Tests
+  bool do_intersect(const Segment_3 & query) const {return tree_sptr->do_intersect(query.get_data());}
+  bool do_intersect(const Triangle_3& query) const {return tree_sptr->do_intersect(query.get_data());}
+  bool do_intersect(const Plane_3   & query) const {return tree_sptr->do_intersect(query.get_data());}
+  bool do_intersect(const Ray_3     & query) const {return tree_sptr->do_intersect(query.get_data());}
+  int number_of_intersected_primitives(const Segment_3 & query) const {return int(tree_sptr->number_of_intersected_primitives(query.get_data()));}
+  int number_of_intersected_primitives(const Triangle_3& query) const {return int(tree_sptr->number_of_intersected_primitives(query.get_data()));}
+  int number_of_intersected_primitives(const Plane_3   & query) const {return int(tree_sptr->number_of_intersected_primitives(query.get_data()));}
+  int number_of_intersected_primitives(const Ray_3     & query) const {return int(tree_sptr->number_of_intersected_primitives(query.get_data()));}
+  Optional_primitive_id any_intersected_primitive(const Segment_3& query) const {
+    auto res=tree_sptr->any_intersected_primitive(query.get_data());
+    if (res)
+      return Optional_primitive_id(int(*res));
+    return Optional_primitive_id();
+  }
+  Optional_primitive_id any_intersected_primitive(const Ray_3& query) const {
+    auto res=tree_sptr->any_intersected_primitive(query.get_data());
+    if (res)
+      return Optional_primitive_id(int(*res));
+    return Optional_primitive_id();
+  }
+//Distance Queries
+  double squared_distance(const Point_3& query) const {return tree_sptr->squared_distance(query.get_data());}
+  Point_3 closest_point(const Point_3& query) const {return Point_3(tree_sptr->closest_point(query.get_data()));}
+  Point_and_primitive_id closest_point_and_primitive(const Point_3& query) const {
+    auto res=tree_sptr->closest_point_and_primitive(query.get_data());
+    return Point_and_primitive_id(Point_3(res.first),res.second);
+  }
+  bool accelerate_distance_queries() {
+    freeze_sptr->check_not_frozen("accelerate_distance_queries");
+    return tree_sptr->accelerate_distance_queries();
+  }
+  void do_not_accelerate_distance_queries() {
+    freeze_sptr->check_not_frozen("do_not_accelerate_distance_queries");
+    tree_sptr->do_not_accelerate_distance_queries();
+  }
+//Batched Queries, run concurrently on (n,3) arrays
+  Ray_hit_batch first_intersection_batch(SWIG_CGAL::Buffer<double> origins, SWIG_CGAL::Buffer<double> directions) const {
+    return SWIG_AABB_tree::first_intersection_batch(*tree_sptr,origins,directions);
+  }
+  Closest_point_batch closest_point_batch(SWIG_CGAL::Buffer<double> points) {
+    prepare();
+    return SWIG_AABB_tree::closest_point_batch(*tree_sptr,points);
+  }
+  SWIG_CGAL::Buffer<double> squared_distance_batch(SWIG_CGAL::Buffer<double> points) {
+    prepare();
+    return SWIG_AABB_tree::squared_distance_batch(*tree_sptr,points);
+  }
+  Primitive_intersection_batch plane_intersections_batch(SWIG_CGAL::Buffer<double> planes) const {
+    return SWIG_AABB_tree::plane_intersections_batch(*tree_sptr,planes);
+  }
+//Virtual scanners, see Virtual_scanner.h
+  Range_image render_depth(SWIG_CGAL::Buffer<double> intrinsics, SWIG_CGAL::Buffer<double> pose, int width, int height) const {
+    Triangle_coordinates triangle = {soup_sptr.get()};
+    return SWIG_AABB_tree::render_depth(intrinsics,pose,width,height,SWIG_AABB_tree::tree_cast(*tree_sptr,triangle));
+  }
+  Range_image simulate_lidar(SWIG_CGAL::Buffer<double> pose, SWIG_CGAL::Buffer<double> pattern) const {
+    Triangle_coordinates triangle = {soup_sptr.get()};
+    return SWIG_AABB_tree::simulate_lidar(pose,pattern,SWIG_AABB_tree::tree_cast(*tree_sptr,triangle));
+  }
+};
+
+#endif //SWIG_CGAL_AABB_TREE_INDEXED_TRIANGLE_SOUP_H
@@ -0,0 +1,369 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+
+#ifndef SWIG_CGAL_AABB_TREE_QUERY_BATCH_H
+#define SWIG_CGAL_AABB_TREE_QUERY_BATCH_H
+
+#include <SWIG_CGAL/Common/Buffer.h>
+#include <SWIG_CGAL/Kernel/typedefs.h>
+#include <SWIG_CGAL/Common/Intersection_writer.h>
+
+#include <CGAL/for_each.h>
+#include <CGAL/tags.h>
+
+#include <boost/iterator/function_output_iterator.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+// Result of AABB_tree_wrapper::first_intersection_batch(): for each ray
+// origin+t*direction, the id of the first primitive hit, the parameter t of
+// the hit point and the hit point. Rays hitting nothing have id -1, and NaN
+// as parameter and hit point.
+class Ray_hit_batch
+{
+  std::shared_ptr<std::vector<int> >    ids_sptr;
+  std::shared_ptr<std::vector<double> > parameters_sptr;
+  std::shared_ptr<std::vector<double> > points_sptr;
+
+public:
+  Ray_hit_batch()
+    : ids_sptr(new std::vector<int>()), parameters_sptr(new std::vector<double>())
+    , points_sptr(new std::vector<double>()) {}
+  #ifndef SWIG
+  Ray_hit_batch(std::size_t nb_queries)
+    : ids_sptr(new std::vector<int>(nb_queries, -1))
+    , parameters_sptr(new std::vector<double>(nb_queries, std::numeric_limits<double>::quiet_NaN()))
+    , points_sptr(new std::vector<double>(3 * nb_queries, std::numeric_limits<double>::quiet_NaN())) {}
+  int*    id_data()        { return ids_sptr->data(); }
+  double* parameter_data() { return parameters_sptr->data(); }
+  double* point_data()     { return points_sptr->data(); }
+  #endif
+
+  int number_of_queries() const { return int(ids_sptr->size()); }
+  int number_of_hits() const
+  {
+    int n = 0;
+    for (int id : *ids_sptr)
+      if (id != -1) ++n;
+    return n;
+  }
+
+  SWIG_CGAL::Buffer<int> primitive_id_array() const
+  {
+    return SWIG_CGAL::Buffer<int>(ids_sptr->data(), ids_sptr->size(), 1, ids_sptr, true);
+  }
+  SWIG_CGAL::Buffer<double> parameter_array() const
+  {
+    return SWIG_CGAL::Buffer<double>(parameters_sptr->data(), parameters_sptr->size(), 1,
+                                     parameters_sptr, true);
+  }
+  // (number_of_queries(), 3)
+  SWIG_CGAL::Buffer<double> point_array() const
+  {
+    return SWIG_CGAL::Buffer<double>(points_sptr->data(), points_sptr->size() / 3, 3,
+                                     points_sptr, true);
+  }
+};
+
+// Result of AABB_tree_wrapper::closest_point_batch(): for each query point,
+// the closest point on the primitives and the id of its primitive.
+class Closest_point_batch
+{
+  std::shared_ptr<std::vector<int> >    ids_sptr;
+  std::shared_ptr<std::vector<double> > points_sptr;
+
+public:
+  Closest_point_batch()
+    : ids_sptr(new std::vector<int>()), points_sptr(new std::vector<double>()) {}
+  #ifndef SWIG
+  Closest_point_batch(std::size_t nb_queries)
+    : ids_sptr(new std::vector<int>(nb_queries, -1))
+    , points_sptr(new std::vector<double>(3 * nb_queries, 0.)) {}
+  int*    id_data()    { return ids_sptr->data(); }
+  double* point_data() { return points_sptr->data(); }
+  #endif
+
+  int number_of_queries() const { return int(ids_sptr->size()); }
+
+  SWIG_CGAL::Buffer<int> primitive_id_array() const
+  {
+    return SWIG_CGAL::Buffer<int>(ids_sptr->data(), ids_sptr->size(), 1, ids_sptr, true);
+  }
+  // (number_of_queries(), 3)
+  SWIG_CGAL::Buffer<double> point_array() const
+  {
+    return SWIG_CGAL::Buffer<double>(points_sptr->data(), points_sptr->size() / 3, 3,
+                                     points_sptr, true);
+  }
+};
+
+// Result of AABB_tree_wrapper::plane_intersections_batch(): all the
+// intersections of the queries with the primitives, those of the query q
+// being the rows offset_array()[q] to offset_array()[q+1]-1 of the other
+// arrays, in no particular order. For each intersection, the id of the
+// primitive, the type of the intersection (1 for a point, 2 for a segment, 3
+// for a triangle, 4 for another type) and the coordinates of its vertices
+// (3 vertices padded with NaN).
+class Primitive_intersection_batch
+{
+  std::shared_ptr<std::vector<int> >         offsets_sptr;
+  std::shared_ptr<std::vector<int> >         ids_sptr;
+  std::shared_ptr<std::vector<signed char> > types_sptr;
+  std::shared_ptr<std::vector<double> >      points_sptr;
+
+public:
+  Primitive_intersection_batch()
+    : offsets_sptr(new std::vector<int>(1, 0)), ids_sptr(new std::vector<int>())
+    , types_sptr(new std::vector<signed char>()), points_sptr(new std::vector<double>()) {}
+  #ifndef SWIG
+  std::vector<int>&         offsets() { return *offsets_sptr; }
+  std::vector<int>&         ids()     { return *ids_sptr; }
+  std::vector<signed char>& types()   { return *types_sptr; }
+  std::vector<double>&      points()  { return *points_sptr; }
+  #endif
+
+  int number_of_queries() const { return int(offsets_sptr->size()) - 1; }
+  int number_of_intersections() const { return int(ids_sptr->size()); }
+
+  // (number_of_queries()+1)
+  SWIG_CGAL::Buffer<int> offset_array() const
+  {
+    return SWIG_CGAL::Buffer<int>(offsets_sptr->data(), offsets_sptr->size(), 1, offsets_sptr, true);
+  }
+  SWIG_CGAL::Buffer<int> primitive_id_array() const
+  {
+    return SWIG_CGAL::Buffer<int>(ids_sptr->data(), ids_sptr->size(), 1, ids_sptr, true);
+  }
+  SWIG_CGAL::Buffer<signed char> type_array() const
+  {
+    return SWIG_CGAL::Buffer<signed char>(types_sptr->data(), types_sptr->size(), 1, types_sptr, true);
+  }
+  // (number_of_intersections(), 9)
+  SWIG_CGAL::Buffer<double> point_array() const
+  {
+    return SWIG_CGAL::Buffer<double>(points_sptr->data(), points_sptr->size() / 9, 9,
+                                     points_sptr, true);
+  }
+};
+
+#ifndef SWIG
+namespace SWIG_AABB_tree {
+
+#ifdef CGAL_LINKED_WITH_TBB
+typedef CGAL::Parallel_tag Concurrency_tag;
+#else
+typedef CGAL::Sequential_tag Concurrency_tag;
+#endif
+
+inline std::vector<std::size_t> query_rows(std::size_t nb_queries)
+{
+  std::vector<std::size_t> rows(nb_queries);
+  for (std::size_t i = 0; i < nb_queries; ++i)
+    rows[i] = i;
+  return rows;
+}
+
+// number of rows of a (n,3) array
+inline std::size_t number_of_points(const SWIG_CGAL::Buffer<double>& coordinates)
+{
+  if (coordinates.size() % 3 != 0)
+    throw std::invalid_argument("The number of coordinates must be a multiple of 3");
+  return coordinates.size() / 3;
+}
+
+// constructs the hierarchy and, unless disabled, the search tree of the
+// distance queries: a first distance query constructs the search tree the
+// tree is set to use
+template <class Tree>
+void prepare(const Tree& tree)
+{
+  if (tree.empty()) return;
+  CGAL::Bbox_3 bbox = tree.bbox();
+  tree.closest_point(EPIC_Kernel::Point_3(bbox.xmin(), bbox.ymin(), bbox.zmin()));
+}
+
+// the concurrent queries below expect a tree whose lazy structures are
+// constructed (see prepare()) and whose primitive ids are integers
+
+// first primitive hit by the ray o+t*d, d not null: sets its id and the
+// parameter t of the hit point, and returns false if there is none
+template <class Tree>
+bool first_hit(const Tree& tree, const double* o, const double* d, int& id, double& t)
+{
+  EPIC_Kernel::Point_3 source(o[0], o[1], o[2]);
+  EPIC_Kernel::Vector_3 direction(d[0], d[1], d[2]);
+  auto res = tree.first_intersection(EPIC_Kernel::Ray_3(source, direction));
+  if (!res) return false;
+  // the intersection is a point, or a segment for collinear primitives
+  double sq_length = direction.squared_length();
+  if (const EPIC_Kernel::Point_3* p = SWIG_CGAL::get_if<EPIC_Kernel::Point_3>(&res->first))
+    t = ((*p - source) * direction) / sq_length;
+  else if (const EPIC_Kernel::Segment_3* s = SWIG_CGAL::get_if<EPIC_Kernel::Segment_3>(&res->first))
+    t = (std::min)((s->source() - source) * direction, (s->target() - source) * direction) / sq_length;
+  else
+    return false;
+  id = int(res->second);
+  return true;
+}
+
+template <class Tree>
+Ray_hit_batch first_intersection_batch(const Tree& tree,
+                                       const SWIG_CGAL::Buffer<double>& origins,
+                                       const SWIG_CGAL::Buffer<double>& directions)
+{
+  std::size_t nb_queries = number_of_points(origins);
+  if (directions.size() != origins.size())
+    throw std::invalid_argument("Expecting as many directions as origins");
+  Ray_hit_batch out(nb_queries);
+  if (nb_queries == 0 || tree.empty()) return out;
+  tree.bbox(); // constructs the hierarchy
+  int* ids = out.id_data();
+  double* parameters = out.parameter_data();
+  double* points = out.point_data();
+  CGAL::for_each<Concurrency_tag>
+    (query_rows(nb_queries), [&](const std::size_t& row) -> bool
+     {
+       const double* o = origins.data() + 3 * row;
+       const double* d = directions.data() + 3 * row;
+       if (d[0] == 0. && d[1] == 0. && d[2] == 0.) return true;
+       int id;
+       double t;
+       if (!first_hit(tree, o, d, id, t)) return true;
+       ids[row] = id;
+       parameters[row] = t;
+       for (int i = 0; i < 3; ++i)
+         points[3 * row + i] = o[i] + t * d[i];
+       return true;
+     });
+  return out;
+}
+
+template <class Tree>
+Closest_point_batch closest_point_batch(const Tree& tree, const SWIG_CGAL::Buffer<double>& points)
+{
+  std::size_t nb_queries = number_of_points(points);
+  Closest_point_batch out(nb_queries);
+  if (nb_queries == 0) return out;
+  if (tree.empty())
+    throw std::runtime_error("Distance queries on an empty tree");
+  int* ids = out.id_data();
+  double* closest = out.point_data();
+  CGAL::for_each<Concurrency_tag>
+    (query_rows(nb_queries), [&](const std::size_t& row) -> bool
+     {
+       const double* p = points.data() + 3 * row;
+       auto res = tree.closest_point_and_primitive(EPIC_Kernel::Point_3(p[0], p[1], p[2]));
+       ids[row] = int(res.second);
+       closest[3 * row] = res.first.x();
+       closest[3 * row + 1] = res.first.y();
+       closest[3 * row + 2] = res.first.z();
+       return true;
+     });
+  return out;
+}
+
+template <class Tree>
+SWIG_CGAL::Buffer<double> squared_distance_batch(const Tree& tree, const SWIG_CGAL::Buffer<double>& points)
+{
+  std::size_t nb_queries = number_of_points(points);
+  std::vector<double> out(nb_queries);
+  if (nb_queries != 0 && tree.empty())
+    throw std::runtime_error("Distance queries on an empty tree");
+  CGAL::for_each<Concurrency_tag>
+    (query_rows(nb_queries), [&](const std::size_t& row) -> bool
+     {
+       const double* p = points.data() + 3 * row;
+       out[row] = tree.squared_distance(EPIC_Kernel::Point_3(p[0], p[1], p[2]));
+       return true;
+     });
+  return SWIG_CGAL::Buffer<double>(std::move(out));
+}
+
+namespace internal {
+
+// an intersection of Primitive_intersection_batch
+struct Primitive_intersection
+{
+  int id;
+  signed char type;
+  double coordinates[9];
+};
+
+// appends the intersections reported by Tree::all_intersections() to a
+// vector, their variant being written without being converted to an Object
+struct Primitive_intersection_writer
+{
+  std::vector<Primitive_intersection>* out;
+
+  template <class Intersection_and_primitive_id>
+  void operator()(const Intersection_and_primitive_id& res) const
+  {
+    Primitive_intersection intersection;
+    intersection.id = int(res.second);
+    intersection.type = SWIG_CGAL::NO_INTERSECTION;
+    std::fill(intersection.coordinates, intersection.coordinates + 9, std::numeric_limits<double>::quiet_NaN());
+    SWIG_CGAL::visit(SWIG_CGAL::Intersection_writer<3>(&intersection.type, intersection.coordinates), res.first);
+    out->push_back(intersection);
+  }
+};
+
+} // namespace internal
+
+// all the intersections with the planes of a (n,4) array (a, b, c, d of
+// the equation ax+by+cz+d=0), the slices of the primitives
+template <class Tree>
+Primitive_intersection_batch plane_intersections_batch(const Tree& tree, const SWIG_CGAL::Buffer<double>& planes)
+{
+  if (planes.size() % 4 != 0)
+    throw std::invalid_argument("Expecting rows of 4 plane coefficients (a,b,c,d)");
+  const std::size_t nb_queries = planes.size() / 4;
+  for (std::size_t q = 0; q < nb_queries; ++q)
+    if (planes[4 * q] == 0. && planes[4 * q + 1] == 0. && planes[4 * q + 2] == 0.)
+      throw std::invalid_argument("The normals of the planes must not be null");
+  std::vector<std::vector<internal::Primitive_intersection> > intersections(nb_queries);
+  if (!tree.empty())
+  {
+    tree.bbox(); // constructs the hierarchy
+    CGAL::for_each<Concurrency_tag>
+      (query_rows(nb_queries), [&](const std::size_t& q) -> bool
+       {
+         const double* p = planes.data() + 4 * q;
+         internal::Primitive_intersection_writer writer = { &intersections[q] };
+         tree.all_intersections(EPIC_Kernel::Plane_3(p[0], p[1], p[2], p[3]),
+                                boost::make_function_output_iterator(writer));
+         return true;
+       });
+  }
+
+  Primitive_intersection_batch out;
+  std::size_t nb_intersections = 0;
+  for (const auto& query_intersections : intersections)
+    nb_intersections += query_intersections.size();
+  out.offsets().reserve(nb_queries + 1);
+  out.ids().reserve(nb_intersections);
+  out.types().reserve(nb_intersections);
+  out.points().reserve(9 * nb_intersections);
+  for (const auto& query_intersections : intersections)
+  {
+    for (const internal::Primitive_intersection& intersection : query_intersections)
+    {
+      out.ids().push_back(intersection.id);
+      out.types().push_back(intersection.type);
+      out.points().insert(out.points().end(), intersection.coordinates, intersection.coordinates + 9);
+    }
+    out.offsets().push_back(int(out.ids().size()));
+  }
+  return out;
+}
+
+} // namespace SWIG_AABB_tree
+#endif
+
+#endif //SWIG_CGAL_AABB_TREE_QUERY_BATCH_H
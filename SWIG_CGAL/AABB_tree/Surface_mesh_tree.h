@@ -0,0 +1,147 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+
+#ifndef SWIG_CGAL_AABB_TREE_SURFACE_MESH_TREE_H
+#define SWIG_CGAL_AABB_TREE_SURFACE_MESH_TREE_H
+
+#include <SWIG_CGAL/Common/Buffer.h>
+#include <SWIG_CGAL/Common/Freeze_state.h>
+#include <SWIG_CGAL/Common/Optional.h>
+#include <SWIG_CGAL/Kernel/Point_3.h>
+#include <SWIG_CGAL/Kernel/Plane_3.h>
+#include <SWIG_CGAL/Kernel/Ray_3.h>
+#include <SWIG_CGAL/Kernel/Segment_3.h>
+#include <SWIG_CGAL/Kernel/Triangle_3.h>
+#include <SWIG_CGAL/Surface_mesh/Surface_mesh_3.h>
+#include <SWIG_CGAL/AABB_tree/Query_batch.h>
+#include <SWIG_CGAL/AABB_tree/Virtual_scanner.h>
+
+#include <boost/shared_ptr.hpp>
+
+#include <memory>
+#include <utility>
+
+// AABB tree on the faces of a Surface_mesh_3; the primitive id is the face
+// index. The tree shares the mesh, which must not be modified while the tree
+// is in use. Copies share the same tree.
+class AABB_tree_Surface_mesh_3
+{
+  boost::shared_ptr<Surface_mesh_3_> mesh_sptr;
+  std::shared_ptr<CGAL_SMTP_Tree> tree_sptr; //refers to *mesh_sptr
+  std::shared_ptr<SWIG_CGAL::Freeze_state> freeze_sptr; //shared with the tree
+
+  #ifndef SWIG
+  // coordinates of the vertices of a face, for the virtual scanners
+  struct Triangle_coordinates
+  {
+    const Surface_mesh_3_* mesh;
+    void operator()(int id, double* out) const
+    {
+      Surface_mesh_3_::Halfedge_index h = mesh->halfedge(Surface_mesh_3_::Face_index(Surface_mesh_3_::size_type(id)));
+      for (int j = 0; j < 3; ++j, h = mesh->next(h))
+      {
+        const EPIC_Kernel::Point_3& p = mesh->point(mesh->target(h));
+        out[3 * j] = p.x();
+        out[3 * j + 1] = p.y();
+        out[3 * j + 2] = p.z();
+      }
+    }
+  };
+  #endif
+
+public:
+  #ifndef SWIG
+  typedef CGAL_SMTP_Tree cpp_base;
+  const cpp_base& get_data() const {return *tree_sptr;}
+        cpp_base& get_data()       {return *tree_sptr;}
+  #endif
+
+  typedef std::pair<Point_3,int> Point_and_primitive_id;
+  typedef Optional<int> Optional_primitive_id;
+
+//Creation
+  AABB_tree_Surface_mesh_3(Surface_mesh_3& mesh)
+    : mesh_sptr(mesh.shared_ptr())
+    , tree_sptr(new CGAL_SMTP_Tree(faces(*mesh_sptr).first, faces(*mesh_sptr).second, *mesh_sptr))
+    , freeze_sptr(new SWIG_CGAL::Freeze_state())
+  {}
+  int size() const {return int(tree_sptr->size());}
+  bool empty() const {return tree_sptr->empty();}
+  void build() {freeze_sptr->check_not_frozen("build"); tree_sptr->build();}
+  //see AABB_tree_wrapper::prepare()
+  void prepare() {
+    CGAL_SMTP_Tree& tree=*tree_sptr;
+    freeze_sptr->build_if_not_frozen([&tree](){ SWIG_AABB_tree::prepare(tree); });
+  }
+  //see AABB_tree_wrapper::freeze(), the copies are frozen too
+  void freeze() {
+    CGAL_SMTP_Tree& tree=*tree_sptr;
+    freeze_sptr->freeze([&tree](){ SWIG_AABB_tree::prepare(tree); });
+  }
+  bool is_frozen() const {return freeze_sptr->is_frozen();}
+//Intersection Tests
+  bool do_intersect(const Segment_3 & query) const {return tree_sptr->do_intersect(query.get_data());}
+  bool do_intersect(const Triangle_3& query) const {return tree_sptr->do_intersect(query.get_data());}
+  bool do_intersect(const Plane_3   & query) const {return tree_sptr->do_intersect(query.get_data());}
+  bool do_intersect(const Ray_3     & query) const {return tree_sptr->do_intersect(query.get_data());}
+  int number_of_intersected_primitives(const Segment_3 & query) const {return int(tree_sptr->number_of_intersected_primitives(query.get_data()));}
+  int number_of_intersected_primitives(const Triangle_3& query) const {return int(tree_sptr->number_of_intersected_primitives(query.get_data()));}
+  int number_of_intersected_primitives(const Plane_3   & query) const {return int(tree_sptr->number_of_intersected_primitives(query.get_data()));}
+  int number_of_intersected_primitives(const Ray_3     & query) const {return int(tree_sptr->number_of_intersected_primitives(query.get_data()));}
+  Optional_primitive_id any_intersected_primitive(const Segment_3& query) const {
+    auto res=tree_sptr->any_intersected_primitive(query.get_data());
+    if (res)
+      return Optional_primitive_id(int(*res));
+    return Optional_primitive_id();
+  }
+  Optional_primitive_id any_intersected_primitive(const Ray_3& query) const {
+    auto res=tree_sptr->any_intersected_primitive(query.get_data());
+    if (res)
+      return Optional_primitive_id(int(*res));
+    return Optional_primitive_id();
+  }
+//Distance Queries
+  double squared_distance(const Point_3& query) const {return tree_sptr->squared_distance(query.get_data());}
+  Point_3 closest_point(const Point_3& query) const {return Point_3(tree_sptr->closest_point(query.get_data()));}
+  Point_and_primitive_id closest_point_and_primitive(const Point_3& query) const {
+    auto res=tree_sptr->closest_point_and_primitive(query.get_data());
+    return Point_and_primitive_id(Point_3(res.first),int(res.second));
+  }
+  bool accelerate_distance_queries() {
+    freeze_sptr->check_not_frozen("accelerate_distance_queries");
+    return tree_sptr->accelerate_distance_queries();
+  }
+  void do_not_accelerate_distance_queries() {
+    freeze_sptr->check_not_frozen("do_not_accelerate_distance_queries");
+    tree_sptr->do_not_accelerate_distance_queries();
+  }
+//Batched Queries, run concurrently on (n,3) arrays
+  Ray_hit_batch first_intersection_batch(SWIG_CGAL::Buffer<double> origins, SWIG_CGAL::Buffer<double> directions) const {
+    return SWIG_AABB_tree::first_intersection_batch(*tree_sptr,origins,directions);
+  }
+  Closest_point_batch closest_point_batch(SWIG_CGAL::Buffer<double> points) {
+    prepare();
+    return SWIG_AABB_tree::closest_point_batch(*tree_sptr,points);
+  }
+  SWIG_CGAL::Buffer<double> squared_distance_batch(SWIG_CGAL::Buffer<double> points) {
+    prepare();
+    return SWIG_AABB_tree::squared_distance_batch(*tree_sptr,points);
+  }
+  Primitive_intersection_batch plane_intersections_batch(SWIG_CGAL::Buffer<double> planes) const {
+    return SWIG_AABB_tree::plane_intersections_batch(*tree_sptr,planes);
+  }
+//Virtual scanners, see Virtual_scanner.h (the faces must be triangles)
+  Range_image render_depth(SWIG_CGAL::Buffer<double> intrinsics, SWIG_CGAL::Buffer<double> pose, int width, int height) const {
+    Triangle_coordinates triangle = {mesh_sptr.get()};
+    return SWIG_AABB_tree::render_depth(intrinsics,pose,width,height,SWIG_AABB_tree::tree_cast(*tree_sptr,triangle));
+  }
+  Range_image simulate_lidar(SWIG_CGAL::Buffer<double> pose, SWIG_CGAL::Buffer<double> pattern) const {
+    Triangle_coordinates triangle = {mesh_sptr.get()};
+    return SWIG_AABB_tree::simulate_lidar(pose,pattern,SWIG_AABB_tree::tree_cast(*tree_sptr,triangle));
+  }
+};
+
+#endif //SWIG_CGAL_AABB_TREE_SURFACE_MESH_TREE_H
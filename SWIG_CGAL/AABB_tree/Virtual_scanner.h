@@ -0,0 +1,262 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+
+#ifndef SWIG_CGAL_AABB_TREE_VIRTUAL_SCANNER_H
+#define SWIG_CGAL_AABB_TREE_VIRTUAL_SCANNER_H
+
+#include <SWIG_CGAL/Common/Buffer.h>
+
+#ifndef SWIG
+#include <SWIG_CGAL/AABB_tree/Query_batch.h>
+
+#include <CGAL/for_each.h>
+#include <CGAL/tags.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#endif
+
+#include <memory>
+#include <vector>
+
+// Result of the virtual scanners of the triangle trees (render_depth() and
+// simulate_lidar()), for the height x width rays of an image (1 x K for a
+// lidar pattern of K rays), in row-major order: the depth along the optical
+// axis (the range along the ray for a lidar), the id of the primitive hit,
+// the hit point and the unit normal of the triangle hit, oriented towards
+// the sensor. Rays hitting nothing have id -1, and NaN as depth, point and
+// normal.
+class Range_image
+{
+  int m_width, m_height;
+  std::shared_ptr<std::vector<double> > depths_sptr;
+  std::shared_ptr<std::vector<int> >    ids_sptr;
+  std::shared_ptr<std::vector<double> > points_sptr;
+  std::shared_ptr<std::vector<double> > normals_sptr;
+
+public:
+  Range_image()
+    : m_width(0), m_height(0), depths_sptr(new std::vector<double>()), ids_sptr(new std::vector<int>())
+    , points_sptr(new std::vector<double>()), normals_sptr(new std::vector<double>()) {}
+  #ifndef SWIG
+  Range_image(int width, int height)
+    : m_width(width), m_height(height)
+    , depths_sptr(new std::vector<double>(std::size_t(width) * height, std::numeric_limits<double>::quiet_NaN()))
+    , ids_sptr(new std::vector<int>(std::size_t(width) * height, -1))
+    , points_sptr(new std::vector<double>(3 * std::size_t(width) * height, std::numeric_limits<double>::quiet_NaN()))
+    , normals_sptr(new std::vector<double>(3 * std::size_t(width) * height, std::numeric_limits<double>::quiet_NaN())) {}
+  double* depth_data()  { return depths_sptr->data(); }
+  int*    id_data()     { return ids_sptr->data(); }
+  double* point_data()  { return points_sptr->data(); }
+  double* normal_data() { return normals_sptr->data(); }
+  #endif
+
+  int width() const { return m_width; }
+  int height() const { return m_height; }
+  int number_of_hits() const
+  {
+    int n = 0;
+    for (int id : *ids_sptr)
+      if (id != -1) ++n;
+    return n;
+  }
+
+  // (height, width)
+  SWIG_CGAL::Buffer<double> depth_array() const
+  {
+    return SWIG_CGAL::Buffer<double>(depths_sptr->data(), m_height, m_width, depths_sptr, true);
+  }
+  SWIG_CGAL::Buffer<int> primitive_id_array() const
+  {
+    return SWIG_CGAL::Buffer<int>(ids_sptr->data(), m_height, m_width, ids_sptr, true);
+  }
+  // (height*width, 3)
+  SWIG_CGAL::Buffer<double> point_array() const
+  {
+    return SWIG_CGAL::Buffer<double>(points_sptr->data(), points_sptr->size() / 3, 3, points_sptr, true);
+  }
+  SWIG_CGAL::Buffer<double> normal_array() const
+  {
+    return SWIG_CGAL::Buffer<double>(normals_sptr->data(), normals_sptr->size() / 3, 3, normals_sptr, true);
+  }
+};
+
+#ifndef SWIG
+namespace SWIG_AABB_tree {
+
+namespace internal {
+
+// sensor to world transformation given as a 4x4 (or 3x4) row-major matrix:
+// rotation r (3x3) and position o
+struct Sensor_pose
+{
+  double r[9], o[3];
+
+  explicit Sensor_pose(const SWIG_CGAL::Buffer<double>& pose)
+  {
+    if (pose.size() != 16 && pose.size() != 12)
+      throw std::invalid_argument("The pose must be a 4x4 or 3x4 sensor to world matrix");
+    for (int i = 0; i < 3; ++i)
+    {
+      for (int j = 0; j < 3; ++j)
+        r[3 * i + j] = pose[4 * i + j];
+      o[i] = pose[4 * i + 3];
+    }
+  }
+
+  void rotate(const double* v, double* out) const
+  {
+    for (int i = 0; i < 3; ++i)
+      out[i] = r[3 * i] * v[0] + r[3 * i + 1] * v[1] + r[3 * i + 2] * v[2];
+  }
+};
+
+// Casts the ray of pixel k from the origin with direction d, writing the
+// hit in `out` with the parameter t along d as depth. `cast(o, d, id, t,
+// triangle)` is the first hit of the tree, `triangle` receiving the 9
+// coordinates of the triangle hit.
+template <class Cast>
+void scan_ray(const Cast& cast, const double* o, const double* d, std::size_t k, Range_image& out)
+{
+  int id;
+  double t, triangle[9];
+  if (!cast(o, d, id, t, triangle))
+    return;
+  double u[3], v[3], n[3];
+  for (int i = 0; i < 3; ++i)
+  {
+    u[i] = triangle[3 + i] - triangle[i];
+    v[i] = triangle[6 + i] - triangle[i];
+  }
+  n[0] = u[1] * v[2] - u[2] * v[1];
+  n[1] = u[2] * v[0] - u[0] * v[2];
+  n[2] = u[0] * v[1] - u[1] * v[0];
+  double length = std::sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+  if (n[0] * d[0] + n[1] * d[1] + n[2] * d[2] > 0)
+    length = -length;
+  out.depth_data()[k] = t;
+  out.id_data()[k] = id;
+  for (int i = 0; i < 3; ++i)
+  {
+    out.point_data()[3 * k + i] = o[i] + t * d[i];
+    out.normal_data()[3 * k + i] = length != 0 ? n[i] / length : 0;
+  }
+}
+
+} // namespace internal
+
+// Cast of the virtual scanners for a CGAL AABB tree whose primitive ids are
+// integers, `Triangle_coordinates(id, out)` writing the 9 coordinates of
+// the triangle of a primitive
+template <class Tree, class Triangle_coordinates>
+struct Tree_cast
+{
+  const Tree* tree;
+  Triangle_coordinates triangle;
+
+  Tree_cast(const Tree& tree, const Triangle_coordinates& triangle)
+    : tree(&tree), triangle(triangle)
+  {
+    if (!tree.empty())
+      tree.bbox(); // constructs the hierarchy before the concurrent casts
+  }
+
+  bool operator()(const double* o, const double* d, int& id, double& t, double* coordinates) const
+  {
+    if (tree->empty() || !first_hit(*tree, o, d, id, t))
+      return false;
+    triangle(id, coordinates);
+    return true;
+  }
+};
+
+template <class Tree, class Triangle_coordinates>
+Tree_cast<Tree, Triangle_coordinates> tree_cast(const Tree& tree, const Triangle_coordinates& triangle)
+{
+  return Tree_cast<Tree, Triangle_coordinates>(tree, triangle);
+}
+
+// pixels rendered by a task
+const int scanner_tile_size = 16;
+
+// Depth image of a pinhole camera: `intrinsics` are fx, fy, cx, cy (in
+// pixels) and `pose` is the camera to world matrix, the camera looking
+// along its z axis with x to the right and y down (as OpenCV): pixel (u,v)
+// sees the points projected at (fx*x/z+cx, fy*y/z+cy). The image is
+// rendered by square tiles processed concurrently, the rays of a tile
+// being close and thus traversing the same nodes of the tree.
+template <class Cast>
+Range_image render_depth(const SWIG_CGAL::Buffer<double>& intrinsics, const SWIG_CGAL::Buffer<double>& pose,
+                         int width, int height, const Cast& cast)
+{
+  if (intrinsics.size() != 4)
+    throw std::invalid_argument("The intrinsics must be fx, fy, cx, cy");
+  if (width < 0 || height < 0)
+    throw std::invalid_argument("The size of the image must be non-negative");
+  const double fx = intrinsics[0], fy = intrinsics[1], cx = intrinsics[2], cy = intrinsics[3];
+  if (!(fx != 0 && fy != 0))
+    throw std::invalid_argument("The focal lengths must not be zero");
+  const internal::Sensor_pose sensor(pose);
+  Range_image out(width, height);
+
+  const int nb_columns = (width + scanner_tile_size - 1) / scanner_tile_size;
+  const int nb_rows = (height + scanner_tile_size - 1) / scanner_tile_size;
+  CGAL::for_each<Concurrency_tag>(query_rows(std::size_t(nb_rows) * nb_columns), [&](const std::size_t& tile) -> bool
+  {
+    const int x0 = int(tile % nb_columns) * scanner_tile_size, y0 = int(tile / nb_columns) * scanner_tile_size;
+    for (int y = y0; y < (std::min)(y0 + scanner_tile_size, height); ++y)
+      for (int x = x0; x < (std::min)(x0 + scanner_tile_size, width); ++x)
+      {
+        // the z of the direction in the camera frame is 1: t is the depth
+        const double camera[3] = { (x - cx) / fx, (y - cy) / fy, 1. };
+        double d[3];
+        sensor.rotate(camera, d);
+        internal::scan_ray(cast, sensor.o, d, std::size_t(y) * width + x, out);
+      }
+    return true;
+  });
+  return out;
+}
+
+// Ranges of a lidar at `pose` (sensor to world matrix) for a pattern of
+// (K,2) azimuth and elevation angles in radians: the direction of a ray is
+// (cos(e)cos(a), cos(e)sin(a), sin(e)) in the sensor frame (x forward, z
+// up). Consecutive rays of the pattern are cast by the same task.
+template <class Cast>
+Range_image simulate_lidar(const SWIG_CGAL::Buffer<double>& pose, const SWIG_CGAL::Buffer<double>& pattern,
+                           const Cast& cast)
+{
+  if (pattern.size() % 2 != 0)
+    throw std::invalid_argument("The pattern must be (K,2) azimuth and elevation angles");
+  const internal::Sensor_pose sensor(pose);
+  const std::size_t nb_rays = pattern.size() / 2;
+  Range_image out(int(nb_rays), 1);
+
+  const std::size_t block_size = std::size_t(scanner_tile_size) * scanner_tile_size;
+  std::vector<std::size_t> blocks((nb_rays + block_size - 1) / block_size);
+  for (std::size_t b = 0; b < blocks.size(); ++b)
+    blocks[b] = b * block_size;
+  CGAL::for_each<Concurrency_tag>(blocks, [&](const std::size_t& begin) -> bool
+  {
+    for (std::size_t k = begin; k < (std::min)(begin + block_size, nb_rays); ++k)
+    {
+      const double a = pattern[2 * k], e = pattern[2 * k + 1];
+      const double local[3] = { std::cos(e) * std::cos(a), std::cos(e) * std::sin(a), std::sin(e) };
+      double d[3];
+      sensor.rotate(local, d);
+      internal::scan_ray(cast, sensor.o, d, k, out);
+    }
+    return true;
+  });
+  return out;
+}
+
+} // namespace SWIG_AABB_tree
+#endif
+
+#endif //SWIG_CGAL_AABB_TREE_VIRTUAL_SCANNER_H
@@ -8,5 +8,8 @@
 
 #include <SWIG_CGAL/AABB_tree/typedefs.h>
 #include <SWIG_CGAL/AABB_tree/AABB_tree.h>
+#include <SWIG_CGAL/AABB_tree/Indexed_triangle_soup.h>
+#include <SWIG_CGAL/AABB_tree/Flat_AABB_tree.h>
+#include <SWIG_CGAL/AABB_tree/Surface_mesh_tree.h>
 
 #endif //SWIG_CGAL_AABB_TREE_ALL_INCLUDES_H
@@ -20,6 +20,8 @@ using AABB_traits_class = CGAL::AABB_traits<T1,T2>;
 #include <CGAL/AABB_face_graph_triangle_primitive.h>
 #include <CGAL/AABB_halfedge_graph_segment_primitive.h>
 #include <CGAL/AABB_integer_primitive.h>
+#include <SWIG_CGAL/AABB_tree/Indexed_triangle_primitive.h>
+#include <SWIG_CGAL/Surface_mesh/typedefs.h>
 
 template <class Polyhedron_type, class Wrapper_primitive_type>
 struct Primitive_wrapper : public Wrapper_primitive_type
@@ -48,5 +50,13 @@ typedef CGAL::AABB_tree<CGAL_TSP_T>
 typedef CGAL::AABB_integer_primitive<EPIC_Kernel::Segment_3>                    CGAL_SSP;
 typedef AABB_traits_class<EPIC_Kernel, CGAL_SSP>                                CGAL_SSP_T;
 typedef CGAL::AABB_tree<CGAL_SSP_T>                                             CGAL_SSP_Tree;
+// Indexed Triangle Soup Primitive
+typedef SWIG_AABB_tree::Indexed_triangle_primitive                              CGAL_ITSP;
+typedef AABB_traits_class<EPIC_Kernel, CGAL_ITSP>                               CGAL_ITSP_T;
+typedef CGAL::AABB_tree<CGAL_ITSP_T>                                            CGAL_ITSP_Tree;
+// Surface_mesh Triangle Primitive
+typedef CGAL::AABB_face_graph_triangle_primitive<Surface_mesh_3_>               CGAL_SMTP;
+typedef AABB_traits_class<EPIC_Kernel, CGAL_SMTP>                               CGAL_SMTP_T;
+typedef CGAL::AABB_tree<CGAL_SMTP_T>                                            CGAL_SMTP_Tree;
 
 #endif //SWIG_CGAL_AABB_TREE_TYPEDEFS_H
@@ -0,0 +1,60 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+
+#ifndef SWIG_CGAL_ADVANCING_FRONT_SURFACE_RECONSTRUCTION_ADVANCING_FRONT_TRIANGULATION_3_H
+#define SWIG_CGAL_ADVANCING_FRONT_SURFACE_RECONSTRUCTION_ADVANCING_FRONT_TRIANGULATION_3_H
+
+#include <SWIG_CGAL/Common/Buffer.h>
+
+#include <memory>
+
+#ifndef SWIG
+#include <SWIG_CGAL/Advancing_front_surface_reconstruction/impl.h>
+#endif
+
+// Delaunay triangulation of an (N, 3) array of points, built once (with
+// concurrent insertion when linked with TBB) and reused by several
+// reconstructions with different parameters. The reconstructions modify
+// the data of the triangulation: they must not run concurrently on the
+// same object (copies share the triangulation).
+class Advancing_front_triangulation_3
+{
+  std::shared_ptr<AFSR_DT3> dt_sptr;
+
+public:
+  Advancing_front_triangulation_3() : dt_sptr(new AFSR_DT3()) {}
+
+  static Advancing_front_triangulation_3 from_array(SWIG_CGAL::Buffer<double> points)
+  {
+    Advancing_front_triangulation_3 out;
+    afsr_triangulate(*out.dt_sptr, points);
+    return out;
+  }
+
+  int number_of_vertices() const { return static_cast<int>(dt_sptr->number_of_vertices()); }
+
+  // (number of facets, 3), the rows of the points given to from_array() of
+  // the vertices of the facets. Candidate facets with a perimeter larger
+  // than max_perimeter are never selected if max_perimeter is positive.
+  SWIG_CGAL::Buffer<int> reconstruct(double radius_ratio_bound = 5, double beta = 0.52, double max_perimeter = 0)
+  {
+    return SWIG_CGAL::Buffer<int>(afsr_reconstruct(*dt_sptr, radius_ratio_bound, beta, max_perimeter), 3);
+  }
+};
+
+// Reconstruction of the rows (x, y, z) of points, as an (F, 3) array of rows
+// of points; see Advancing_front_triangulation_3 to run several
+// reconstructions on the same points.
+inline SWIG_CGAL::Buffer<int>
+advancing_front_surface_reconstruction_arrays(SWIG_CGAL::Buffer<double> points,
+                                              double radius_ratio_bound = 5,
+                                              double beta = 0.52,
+                                              double max_perimeter = 0)
+{
+  return Advancing_front_triangulation_3::from_array(points).reconstruct(radius_ratio_bound, beta, max_perimeter);
+}
+
+#endif //SWIG_CGAL_ADVANCING_FRONT_SURFACE_RECONSTRUCTION_ADVANCING_FRONT_TRIANGULATION_3_H
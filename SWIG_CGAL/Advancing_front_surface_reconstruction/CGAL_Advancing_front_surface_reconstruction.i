@@ -27,6 +27,7 @@ SWIG_CGAL_add_java_loadLibrary(CGAL_Advancing_front_surface_reconstruction)
   #include <SWIG_CGAL/Point_set_3/all_includes.h>
   #include <SWIG_CGAL/Advancing_front_surface_reconstruction/impl.h>
   #include <SWIG_CGAL/Common/Output_iterator_wrapper.h>
+  #include <SWIG_CGAL/Common/Gil_release.h>
 %}
 
 %types(Point_3*,Point_3);//needed so that the identifier SWIGTYPE_p_Point_3 is generated
@@ -78,10 +79,31 @@ void advancing_front_surface_reconstruction(Point_set_3_wrapper<CGAL_PS3>, Polyh
     double radius_ratio_bound = 5,
     double beta = 0.52)
   {
+    // the output is a wrapped C++ object: reconstruct without the GIL
+    SWIG_CGAL::Gil_release gil_release;
     afsr_reconstruction_poly<EPIC_Kernel>(point_set.get_data().points().begin(),
                                           point_set.get_data().points().end(),
                                           P.get_data(), radius_ratio_bound, beta);
   }
 %}
 
+//reconstructions from arrays, reusing the Delaunay triangulation
+%include "SWIG_CGAL/typemaps.i"
+SWIG_CGAL_buffer_of_double_typemap_in
+SWIG_CGAL_buffer_of_int_typemap_out
+SWIG_CGAL_release_gil(Advancing_front_triangulation_3::from_array)
+SWIG_CGAL_release_gil(Advancing_front_triangulation_3::reconstruct)
+SWIG_CGAL_release_gil(advancing_front_surface_reconstruction_arrays)
+%include "SWIG_CGAL/Advancing_front_surface_reconstruction/Advancing_front_triangulation_3.h"
+%{
+  #include <SWIG_CGAL/Advancing_front_surface_reconstruction/Advancing_front_triangulation_3.h>
+%}
 
+#ifdef SWIGPYTHON
+//asynchronous variants, see CGAL.run_async()
+%pythoncode %{
+import CGAL as _CGAL
+advancing_front_surface_reconstruction_async = _CGAL.async_variant(advancing_front_surface_reconstruction)
+advancing_front_surface_reconstruction_arrays_async = _CGAL.async_variant(advancing_front_surface_reconstruction_arrays)
+%}
+#endif
@@ -6,12 +6,60 @@
 #ifndef SWIG_CGAL_ADVANCING_FRONT_SURFACE_RECONSTRUCTION_IMPL_H
 #define SWIG_CGAL_ADVANCING_FRONT_SURFACE_RECONSTRUCTION_IMPL_H
 
+#include <SWIG_CGAL/Kernel/typedefs.h>
+#include <SWIG_CGAL/Triangulation_3/typedefs.h>
+#include <SWIG_CGAL/Common/Buffer.h>
+#include <SWIG_CGAL/Common/Spatial_insertion.h>
 #include <CGAL/Advancing_front_surface_reconstruction.h>
+#include <CGAL/Advancing_front_surface_reconstruction_vertex_base_3.h>
+#include <CGAL/Advancing_front_surface_reconstruction_cell_base_3.h>
+#include <CGAL/Delaunay_triangulation_3.h>
+#include <CGAL/Triangulation_data_structure_3.h>
+#include <CGAL/Bbox_3.h>
 #include <CGAL/boost/graph/Euler_operations.h>
 #include <boost/iterator/transform_iterator.hpp>
 #include <CGAL/property_map.h>
 
+#include <cmath>
+#include <iterator>
 #include <utility>
+#include <vector>
+
+//Delaunay triangulation for the reconstructions from arrays, whose points are
+//inserted concurrently with the concurrency tag of CGAL_PDT3
+typedef CGAL::Advancing_front_surface_reconstruction_vertex_base_3<EPIC_Kernel>  AFSR_vb;
+typedef CGAL::Advancing_front_surface_reconstruction_cell_base_3<EPIC_Kernel>    AFSR_cb;
+typedef CGAL::Triangulation_data_structure_3<AFSR_vb,AFSR_cb,PDT3_Concurrency_tag> AFSR_Tds;
+typedef CGAL::Delaunay_triangulation_3<EPIC_Kernel,AFSR_Tds>                     AFSR_DT3;
+
+// Default priority of the candidate facets (the radius of their smallest
+// Delaunay sphere), except that facets with a perimeter larger than
+// max_perimeter are never selected if max_perimeter is positive.
+struct Afsr_perimeter_priority
+{
+  double max_perimeter;
+
+  Afsr_perimeter_priority(double max_perimeter = 0) : max_perimeter(max_perimeter) {}
+
+  template <class AdvancingFront, class Cell_handle>
+  double operator()(const AdvancingFront& adv, Cell_handle& c, const int& index) const
+  {
+    if (max_perimeter > 0)
+    {
+      const EPIC_Kernel::Point_3& p = c->vertex((index + 1) & 3)->point();
+      const EPIC_Kernel::Point_3& q = c->vertex((index + 2) & 3)->point();
+      const EPIC_Kernel::Point_3& r = c->vertex((index + 3) & 3)->point();
+      const double perimeter = std::sqrt(CGAL::squared_distance(p, q))
+                             + std::sqrt(CGAL::squared_distance(q, r))
+                             + std::sqrt(CGAL::squared_distance(r, p));
+      if (perimeter > max_perimeter)
+        return adv.infinity();
+    }
+    return adv.smallest_radius_delaunay_sphere(c, index);
+  }
+};
+
+typedef CGAL::Advancing_front_surface_reconstruction<AFSR_DT3,Afsr_perimeter_priority> AFSR_reconstruction;
 
 template <class Kernel>
 struct Auto_count
@@ -188,6 +236,44 @@ void afsr_reconstruction(PointIterator point_begin, PointIterator point_end,
   afsr_write_indices(out, sr);
 }
 
+// Inserts the rows (x, y, z) of coords in dt, the id of a vertex being the
+// row of its point (the first one for duplicated points). The points are
+// inserted concurrently when linked with TBB.
+inline void afsr_triangulate(AFSR_DT3& dt, const SWIG_CGAL::Buffer<double>& coords)
+{
+  const std::size_t n = SWIG_CGAL::number_of_rows(coords, 3);
+  if (n == 0) return;
+  std::vector<std::pair<EPIC_Kernel::Point_3,int> > points;
+  points.reserve(n);
+  for (std::size_t i = 0; i < n; ++ i)
+    points.push_back(std::make_pair(EPIC_Kernel::Point_3(coords[3*i], coords[3*i+1], coords[3*i+2]), int(i)));
+#ifdef CGAL_LINKED_WITH_TBB
+  CGAL::Bbox_3 bbox = points.front().first.bbox();
+  for (const std::pair<EPIC_Kernel::Point_3,int>& p : points)
+    bbox += p.first.bbox();
+  AFSR_DT3::Lock_data_structure lock_ds(bbox, 50);
+  dt.set_lock_data_structure(&lock_ds);
+  dt.insert(points.begin(), points.end());
+  dt.set_lock_data_structure(nullptr);
+#else
+  dt.insert(points.begin(), points.end());
+#endif
+}
+
+// Rows of the ids of the vertices of the facets reconstructed from dt. Each
+// call uses a new reconstruction object, whose constructor initializes the
+// reconstruction data of the vertices and cells of dt, so that several
+// reconstructions can be run (one at a time) on the same triangulation.
+inline std::vector<int> afsr_reconstruct(AFSR_DT3& dt, double radius_ratio_bound, double beta, double max_perimeter)
+{
+  AFSR_reconstruction sr(dt, Afsr_perimeter_priority(max_perimeter));
+  sr.run(radius_ratio_bound, beta);
+  std::vector<int> out;
+  out.reserve(3 * sr.number_of_facets());
+  afsr_write_indices(std::back_inserter(out), sr);
+  return out;
+}
+
 template <class Kernel, class PointIterator, class Polyhedron>
 void afsr_reconstruction_poly(PointIterator point_begin, PointIterator point_end, 
                               Polyhedron& out,
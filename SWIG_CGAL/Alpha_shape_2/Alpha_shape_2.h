@@ -9,6 +9,22 @@
 
 #include <SWIG_CGAL/Triangulation_2/Delaunay_triangulation_2.h>
 #include <SWIG_CGAL/Triangulation_2/Regular_triangulation_2.h>
+#include <SWIG_CGAL/Alpha_shape_2/Alpha_shape_2_arrays.h>
+
+#ifndef SWIG
+#include <CGAL/Handle_hash_function.h>
+#include <CGAL/for_each.h>
+#include <CGAL/tags.h>
+#include <unordered_map>
+
+namespace SWIG_Alpha_shape_2 {
+#ifdef CGAL_LINKED_WITH_TBB
+typedef CGAL::Parallel_tag Concurrency_tag;
+#else
+typedef CGAL::Sequential_tag Concurrency_tag;
+#endif
+} // namespace SWIG_Alpha_shape_2
+#endif
 
 enum Classification_type { EXTERIOR, SINGULAR, REGULAR, INTERIOR};
 enum Mode { GENERAL, REGULARIZED};
@@ -72,6 +88,66 @@ public:
   int make_alpha_shape(Point_range range){
     return this->get_data().make_alpha_shape(SWIG_CGAL::get_begin(range),SWIG_CGAL::get_end(range));
   }  
+//Creation from the rows (x,y), or (x,y,weight) for weighted points, of an array
+  int make_alpha_shape_from_array(SWIG_CGAL::Buffer<double> coords){
+    typedef typename Point::cpp_base Cpp_point;
+    const std::size_t row_size = Weighted_tag::value ? 3 : 2;
+    const std::size_t n = SWIG_CGAL::number_of_rows(coords,row_size);
+    std::vector<Cpp_point> points;
+    points.reserve(n);
+    for (std::size_t i=0; i<n; ++i)
+      points.push_back(SWIG_Triangulation_2::internal::make_point<Cpp_point>(coords.data()+row_size*i,Weighted_tag()));
+    return this->get_data().make_alpha_shape(points.begin(),points.end());
+  }
+  static Self from_array(SWIG_CGAL::Buffer<double> coords,double alpha=0,Mode m=GENERAL){
+    Self out(alpha,m);
+    out.make_alpha_shape_from_array(coords);
+    return out;
+  }
+//Boundary edges (regular, and singular in GENERAL mode) for each alpha value, classified
+//from the alpha intervals of the faces and edges without changing the current alpha;
+//the alpha values are processed concurrently when linked with TBB
+  Alpha_shape_boundaries boundary_edges_for_alphas(SWIG_CGAL::Buffer<double> alphas) const {
+    typedef typename Alpha_shape::Vertex_handle Cpp_vertex_handle;
+    typedef typename Alpha_shape::Edge          Cpp_edge;
+    const Alpha_shape& as = this->get_data();
+    std::unordered_map<Cpp_vertex_handle,int,CGAL::Handle_hash_function> vertex_index;
+    vertex_index.reserve(as.number_of_vertices());
+    int nv = 0;
+    for (typename Alpha_shape::Finite_vertices_iterator v = as.finite_vertices_begin(); v != as.finite_vertices_end(); ++v)
+      vertex_index[v] = nv++;
+    std::vector<Cpp_edge> edges;
+    std::vector<int> ends;
+    for (typename Alpha_shape::Finite_edges_iterator e = as.finite_edges_begin(); e != as.finite_edges_end(); ++e){
+      edges.push_back(*e);
+      ends.push_back(vertex_index[e->first->vertex(Alpha_shape::cw(e->second))]);
+      ends.push_back(vertex_index[e->first->vertex(Alpha_shape::ccw(e->second))]);
+    }
+    const bool with_singular = as.get_mode() == Alpha_shape::GENERAL;
+    std::vector<std::vector<int> > selected(alphas.size());
+    std::vector<std::size_t> ids(alphas.size());
+    for (std::size_t a=0; a<ids.size(); ++a)
+      ids[a] = a;
+    CGAL::for_each<SWIG_Alpha_shape_2::Concurrency_tag>
+      (ids, [&](const std::size_t& a) -> bool
+       {
+         for (std::size_t e=0; e<edges.size(); ++e){
+           const typename Alpha_shape::Classification_type c = as.classify(edges[e], alphas.data()[a]);
+           if (c == Alpha_shape::REGULAR || (with_singular && c == Alpha_shape::SINGULAR))
+             selected[a].push_back(int(e));
+         }
+         return true;
+       });
+    Alpha_shape_boundaries result;
+    for (std::size_t a=0; a<selected.size(); ++a){
+      for (int e : selected[a]){
+        result.edges().push_back(ends[2*e]);
+        result.edges().push_back(ends[2*e+1]);
+      }
+      result.offsets().push_back(int(result.edges().size()/2));
+    }
+    return result;
+  }
 //Traversal of the alpha-Values
   Alpha_iterator  alpha(){return Alpha_iterator(this->get_data().alpha_begin(),this->get_data().alpha_end());}
   Alpha_iterator  alpha_find(double a){return Alpha_iterator(this->get_data().alpha_find(a),this->get_data().alpha_end());}
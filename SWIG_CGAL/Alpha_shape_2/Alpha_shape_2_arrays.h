@@ -0,0 +1,49 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+
+#ifndef SWIG_CGAL_ALPHA_SHAPE_2_ALPHA_SHAPE_2_ARRAYS_H
+#define SWIG_CGAL_ALPHA_SHAPE_2_ALPHA_SHAPE_2_ARRAYS_H
+
+#include <SWIG_CGAL/Common/Buffer.h>
+
+#include <memory>
+#include <vector>
+
+// Result of Alpha_shape_2_wrapper::boundary_edges_for_alphas(): the
+// boundary edges of the alpha shape for the alpha value i are the rows
+// [offsets[i], offsets[i+1]) of edge_array(), each row being the indices
+// of the two vertices of the edge in the order of the finite vertices (the
+// rows of the point_array() of to_arrays()).
+class Alpha_shape_boundaries
+{
+  std::shared_ptr<std::vector<int> > edges_sptr;
+  std::shared_ptr<std::vector<int> > offsets_sptr;
+
+public:
+  Alpha_shape_boundaries()
+    : edges_sptr(new std::vector<int>())
+    , offsets_sptr(new std::vector<int>(1, 0)) {}
+
+  #ifndef SWIG
+  std::vector<int>& edges() { return *edges_sptr; }
+  std::vector<int>& offsets() { return *offsets_sptr; }
+  #endif
+
+  int number_of_alphas() const { return int(offsets_sptr->size()) - 1; }
+
+  // (number of edges, 2)
+  SWIG_CGAL::Buffer<int> edge_array() const
+  {
+    return SWIG_CGAL::Buffer<int>(edges_sptr->data(), edges_sptr->size() / 2, 2, edges_sptr, true);
+  }
+  // (number_of_alphas() + 1, 1)
+  SWIG_CGAL::Buffer<int> offset_array() const
+  {
+    return SWIG_CGAL::Buffer<int>(offsets_sptr->data(), offsets_sptr->size(), 1, offsets_sptr, true);
+  }
+};
+
+#endif //SWIG_CGAL_ALPHA_SHAPE_2_ALPHA_SHAPE_2_ARRAYS_H
@@ -18,6 +18,14 @@ SWIG_CGAL_package_common()
 
 %import  "SWIG_CGAL/Common/Macros.h"
 %import  "SWIG_CGAL/Kernel/CGAL_Kernel.i"
+
+//typemaps for the export to arrays and the creation and classification from arrays
+%include "SWIG_CGAL/typemaps.i"
+SWIG_CGAL_buffer_of_double_typemap_in
+SWIG_CGAL_buffer_of_double_typemap_out
+SWIG_CGAL_buffer_of_int_typemap_out
+SWIG_CGAL_buffer_of_signed_char_typemap_out
+
 %import  "SWIG_CGAL/Triangulation_2/Reference_wrappers.i"
 %include "SWIG_CGAL/Common/Iterator.h"
 
@@ -37,8 +45,15 @@ SWIG_CGAL_package_common()
 #endif
 
 //definitions
+SWIG_CGAL_release_gil(Triangulation_2_wrapper::to_arrays)
+SWIG_CGAL_release_gil(Alpha_shape_2_wrapper::boundary_edges_for_alphas)
+SWIG_CGAL_release_gil(Alpha_shape_2_wrapper::make_alpha_shape_from_array)
+SWIG_CGAL_release_gil(Alpha_shape_2_wrapper::from_array)
+%include "SWIG_CGAL/Triangulation_2/Triangulation_2_arrays.h"
+%include "SWIG_CGAL/Alpha_shape_2/Alpha_shape_2_arrays.h"
 %include "SWIG_CGAL/Alpha_shape_2/Alpha_shape_2.h"
 %include "SWIG_CGAL/Triangulation_2/triangulation_handles.h"
+%import  "SWIG_CGAL/Common/Location_batch.h"
 %import  "SWIG_CGAL/Triangulation_2/Triangulation_2.h"
 %import  "SWIG_CGAL/Triangulation_2/Delaunay_triangulation_2.h"
 %import  "SWIG_CGAL/Triangulation_2/Regular_triangulation_2.h"
@@ -72,6 +87,11 @@ SWIG_CGAL_input_iterator_typemap_in_python_extra_function(Alpha_shape_2_wrapper:
 SWIG_CGAL_declare_alpha_shape_2(Alpha_shape_2,CGAL_AS2)
 SWIG_CGAL_declare_weighted_alpha_shape_2(Weighted_alpha_shape_2,CGAL_WAS2)
 
+//Java alpha shape without info field in faces
+#ifdef ADD_JAVA_DATA_IN_FACE_AS2
+SWIG_CGAL_declare_alpha_shape_2(Alpha_shape_2_without_info,CGAL_AS2_without_info)
+#endif
+
 #ifdef SWIG_CGAL_HAS_Alpha_shape_2_USER_PACKAGE
 %include "SWIG_CGAL/User_packages/Alpha_shape_2/extensions.i"
 #endif
@@ -29,6 +29,13 @@ typedef CGAL::Triangulation_face_base_with_info_2<JavaData,EPIC_Kernel,CGAL_AS_f
 typedef CGAL::Triangulation_data_structure_2<CGAL_AS_vb,CGAL_AS_fb>     CGAL_AS_Tds;
 typedef CGAL::Delaunay_triangulation_2<EPIC_Kernel,CGAL_AS_Tds>         CGAL_DT2;
 typedef CGAL::Alpha_shape_2<CGAL_DT2>                                   CGAL_AS2;
+#ifdef ADD_JAVA_DATA_IN_FACE_AS2
+//Instantiation without the info field in faces, for the users who do not need it
+typedef CGAL::Alpha_shape_face_base_2<EPIC_Kernel,CGAL_AS_fbb>          CGAL_AS_fb_without_info;
+typedef CGAL::Triangulation_data_structure_2<CGAL_AS_vb,CGAL_AS_fb_without_info> CGAL_AS_Tds_without_info;
+typedef CGAL::Delaunay_triangulation_2<EPIC_Kernel,CGAL_AS_Tds_without_info> CGAL_AS_DT2_without_info;
+typedef CGAL::Alpha_shape_2<CGAL_AS_DT2_without_info>                   CGAL_AS2_without_info;
+#endif
 //typedefs for Weighted_alpha_shape_2 
 typedef EPIC_Kernel CGAL_WAS_Gt;
 typedef CGAL::Regular_triangulation_vertex_base_2<CGAL_WAS_Gt>          CGAL_WAS_vbb;
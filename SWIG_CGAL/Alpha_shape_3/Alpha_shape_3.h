@@ -0,0 +1,315 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+
+#ifndef SWIG_CGAL_ALPHA_SHAPE_3_ALPHA_SHAPE_3_H
+#define SWIG_CGAL_ALPHA_SHAPE_3_ALPHA_SHAPE_3_H
+
+#include <SWIG_CGAL/Common/Buffer.h>
+
+#include <memory>
+#include <vector>
+
+#ifndef SWIG
+#include <SWIG_CGAL/Alpha_shape_3/typedefs.h>
+#include <SWIG_CGAL/Common/Spatial_insertion.h>
+#include <CGAL/Bbox_3.h>
+#include <CGAL/Handle_hash_function.h>
+#include <CGAL/enum.h>
+#include <CGAL/for_each.h>
+#include <CGAL/tags.h>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <unordered_map>
+
+namespace SWIG_Alpha_shape_3 {
+
+#ifdef CGAL_LINKED_WITH_TBB
+typedef CGAL::Parallel_tag Concurrency_tag;
+#else
+typedef CGAL::Sequential_tag Concurrency_tag;
+#endif
+
+namespace internal {
+
+typedef EPIC_Kernel::Point_3 Point;
+
+template <class Dt>
+void insert_points (Dt& dt, std::vector<Point>& points, CGAL::Sequential_tag)
+{
+  dt.insert (points.begin(), points.end());
+}
+
+#ifdef CGAL_LINKED_WITH_TBB
+// The threads lock the cells they modify with a grid covering the points.
+// The wrappers release the GIL, so this must not use SWIG_CGAL::Gil_release.
+template <class Dt>
+void insert_points (Dt& dt, std::vector<Point>& points, CGAL::Parallel_tag)
+{
+  CGAL::Bbox_3 bbox = points.front().bbox();
+  for (const Point& p : points)
+    bbox += p.bbox();
+  typename Dt::Lock_data_structure lock_ds (bbox, 50);
+  dt.set_lock_data_structure (&lock_ds);
+  dt.insert (points.begin(), points.end());
+  dt.set_lock_data_structure (nullptr);
+}
+#endif
+
+// Delaunay triangulation of the rows (x, y, z) of coords, computed
+// concurrently when linked with TBB
+template <class Dt>
+void triangulate (Dt& dt, const SWIG_CGAL::Buffer<double>& coords)
+{
+  const std::size_t n = SWIG_CGAL::number_of_rows (coords, 3);
+  std::vector<Point> points;
+  points.reserve (n);
+  for (std::size_t i = 0; i < n; ++ i)
+    points.push_back (Point (coords[3 * i], coords[3 * i + 1], coords[3 * i + 2]));
+  if (!points.empty())
+    insert_points (dt, points, typename Dt::Concurrency_tag());
+  if (dt.dimension() != 3)
+    throw std::invalid_argument ("The alpha shape of coplanar points is not supported");
+}
+
+// Rows (x, y, z) of the finite vertices, in iteration order
+template <class AS>
+std::vector<double> point_rows (const AS& as)
+{
+  std::vector<double> out;
+  out.reserve (3 * as.number_of_vertices());
+  for (typename AS::Finite_vertices_iterator v = as.finite_vertices_begin(); v != as.finite_vertices_end(); ++ v)
+  {
+    out.push_back (v->point().x());
+    out.push_back (v->point().y());
+    out.push_back (v->point().z());
+  }
+  return out;
+}
+
+// Facets of class REGULAR, and SINGULAR if with_singular, given by the
+// cell on their interior side for the regular ones. The facets are
+// classified concurrently when linked with TBB.
+template <class AS>
+std::vector<typename AS::Facet> boundary_facets (const AS& as, bool with_singular)
+{
+  typedef typename AS::Facet Facet;
+  std::vector<Facet> facets (as.finite_facets_begin(), as.finite_facets_end());
+  std::vector<signed char> selected (facets.size(), 0);
+  std::vector<std::size_t> ids (facets.size());
+  for (std::size_t f = 0; f < ids.size(); ++ f)
+    ids[f] = f;
+  CGAL::for_each<Concurrency_tag>
+    (ids, [&](const std::size_t& f) -> bool
+     {
+       const typename AS::Classification_type c = as.classify (facets[f]);
+       if (c == AS::REGULAR)
+       {
+         if (as.classify (facets[f].first) != AS::INTERIOR)
+           facets[f] = as.mirror_facet (facets[f]);
+         selected[f] = 1;
+       }
+       else if (with_singular && c == AS::SINGULAR)
+         selected[f] = 1;
+       return true;
+     });
+  std::size_t nb = 0;
+  for (std::size_t f = 0; f < facets.size(); ++ f)
+    if (selected[f])
+      facets[nb ++] = facets[f];
+  facets.resize (nb);
+  return facets;
+}
+
+// Rows of the indices of the vertices (as in point_rows()) of the boundary
+// facets, counterclockwise seen from outside the alpha shape
+template <class AS>
+std::vector<int> facet_rows (const AS& as, bool with_singular)
+{
+  typedef typename AS::Facet Facet;
+  std::unordered_map<typename AS::Vertex_handle, int, CGAL::Handle_hash_function> vertex_index;
+  vertex_index.reserve (as.number_of_vertices());
+  int nv = 0;
+  for (typename AS::Finite_vertices_iterator v = as.finite_vertices_begin(); v != as.finite_vertices_end(); ++ v)
+    vertex_index[v] = nv ++;
+  const std::vector<Facet> facets = boundary_facets (as, with_singular);
+  std::vector<int> out;
+  out.reserve (3 * facets.size());
+  for (const Facet& f : facets)
+  {
+    // the vertex triple of (c, i) is counterclockwise seen from inside c
+    out.push_back (vertex_index[f.first->vertex (AS::vertex_triple_index (f.second, 0))]);
+    out.push_back (vertex_index[f.first->vertex (AS::vertex_triple_index (f.second, 2))]);
+    out.push_back (vertex_index[f.first->vertex (AS::vertex_triple_index (f.second, 1))]);
+  }
+  return out;
+}
+
+template <class AS>
+double boundary_area (const AS& as, bool with_singular)
+{
+  typedef typename AS::Facet Facet;
+  const std::vector<Facet> facets = boundary_facets (as, with_singular);
+  double area = 0.;
+  for (const Facet& f : facets)
+    area += std::sqrt (as.triangle (f).squared_area());
+  return area;
+}
+
+// Sum of the volumes of the interior cells, computed concurrently when
+// linked with TBB
+template <class AS>
+double interior_volume (const AS& as)
+{
+  std::vector<typename AS::Cell_handle> cells;
+  cells.reserve (as.number_of_finite_cells());
+  for (typename AS::Finite_cells_iterator c = as.finite_cells_begin(); c != as.finite_cells_end(); ++ c)
+    cells.push_back (c);
+  std::vector<double> volumes (cells.size(), 0.);
+  std::vector<std::size_t> ids (cells.size());
+  for (std::size_t c = 0; c < ids.size(); ++ c)
+    ids[c] = c;
+  CGAL::for_each<Concurrency_tag>
+    (ids, [&](const std::size_t& c) -> bool
+     {
+       if (as.classify (cells[c]) == AS::INTERIOR)
+         volumes[c] = as.tetrahedron (cells[c]).volume();
+       return true;
+     });
+  double volume = 0.;
+  for (double v : volumes)
+    volume += v;
+  return volume;
+}
+
+} // namespace internal
+} // namespace SWIG_Alpha_shape_3
+#endif
+
+enum Mode { GENERAL, REGULARIZED};
+
+// Alpha shape of the Delaunay triangulation of an (N, 3) array of points,
+// storing the alpha intervals of all the simplices so that the alpha value
+// can be changed. The vertex indices in the outputs are the rows of
+// point_array(): the finite vertices in iteration order, without the
+// duplicated points of the input.
+class Alpha_shape_3_wrapper
+{
+  std::shared_ptr<CGAL_AS3> data_sptr;
+
+public:
+  Alpha_shape_3_wrapper() : data_sptr(new CGAL_AS3()) {}
+
+  #ifndef SWIG
+  const CGAL_AS3& get_data() const { return *data_sptr; }
+  CGAL_AS3& get_data() { return *data_sptr; }
+  #endif
+
+  // The points are inserted concurrently when linked with TBB.
+  // Throws if the points are coplanar.
+  static Alpha_shape_3_wrapper from_array(SWIG_CGAL::Buffer<double> points, double alpha=0, Mode m=REGULARIZED)
+  {
+    CGAL_AS3_DT3 dt;
+    SWIG_Alpha_shape_3::internal::triangulate(dt, points);
+    Alpha_shape_3_wrapper out;
+    out.data_sptr.reset(new CGAL_AS3(dt, alpha, CGAL::enum_cast<CGAL_AS3::Mode>(m))); // swaps with dt
+    return out;
+  }
+
+  int number_of_vertices() const { return static_cast<int>(data_sptr->number_of_vertices()); }
+  double get_alpha() const { return data_sptr->get_alpha(); }
+  double set_alpha(double alpha) { return data_sptr->set_alpha(alpha); }
+  Mode get_mode() const { return CGAL::enum_cast<Mode>(data_sptr->get_mode()); }
+  Mode set_mode(Mode m) { return CGAL::enum_cast<Mode>(data_sptr->set_mode(CGAL::enum_cast<CGAL_AS3::Mode>(m))); }
+//Alpha spectrum
+  int number_of_alphas() const { return static_cast<int>(data_sptr->number_of_alphas()); }
+  // (number_of_alphas(), 1), the alpha values where the shape changes, increasing
+  SWIG_CGAL::Buffer<double> alpha_values() const
+  {
+    return SWIG_CGAL::Buffer<double>(std::vector<double>(data_sptr->alpha_begin(), data_sptr->alpha_end()));
+  }
+  // smallest alpha of the spectrum for which the shape has at most
+  // nb_components solid components and all the points are on the boundary
+  // or in the interior, infinity if there is none
+  double find_optimal_alpha(int nb_components) const
+  {
+    CGAL_AS3::Alpha_iterator it = data_sptr->find_optimal_alpha(nb_components);
+    return it == data_sptr->alpha_end() ? std::numeric_limits<double>::infinity() : *it;
+  }
+  int number_of_solid_components() const { return static_cast<int>(data_sptr->number_of_solid_components()); }
+  int number_of_solid_components(double alpha) const { return static_cast<int>(data_sptr->number_of_solid_components(alpha)); }
+//Export to arrays and measures for the current alpha, computed in C++
+  // (number_of_vertices(), 3)
+  SWIG_CGAL::Buffer<double> point_array() const
+  {
+    return SWIG_CGAL::Buffer<double>(SWIG_Alpha_shape_3::internal::point_rows(*data_sptr), 3);
+  }
+  // (number of boundary facets, 3), the regular facets, and the singular ones
+  // in GENERAL mode; regular facets are counterclockwise seen from outside
+  SWIG_CGAL::Buffer<int> boundary_facet_array() const
+  {
+    return SWIG_CGAL::Buffer<int>(SWIG_Alpha_shape_3::internal::facet_rows(*data_sptr, data_sptr->get_mode() == CGAL_AS3::GENERAL), 3);
+  }
+  // area of the facets of boundary_facet_array()
+  double area() const
+  {
+    return SWIG_Alpha_shape_3::internal::boundary_area(*data_sptr, data_sptr->get_mode() == CGAL_AS3::GENERAL);
+  }
+  // volume of the interior cells
+  double volume() const { return SWIG_Alpha_shape_3::internal::interior_volume(*data_sptr); }
+};
+
+// Alpha shape for a single alpha value of the Delaunay triangulation of an
+// (N, 3) array of points. Only the classification of the simplices for this
+// alpha is stored, which takes much less memory than Alpha_shape_3.
+// The vertex indices in the outputs are the rows of point_array().
+class Fixed_alpha_shape_3_wrapper
+{
+  std::shared_ptr<CGAL_FAS3> data_sptr;
+
+public:
+  Fixed_alpha_shape_3_wrapper() : data_sptr(new CGAL_FAS3()) {}
+
+  #ifndef SWIG
+  const CGAL_FAS3& get_data() const { return *data_sptr; }
+  CGAL_FAS3& get_data() { return *data_sptr; }
+  #endif
+
+  // The points are inserted concurrently when linked with TBB.
+  // Throws if the points are coplanar.
+  static Fixed_alpha_shape_3_wrapper from_array(SWIG_CGAL::Buffer<double> points, double alpha)
+  {
+    CGAL_FAS3_DT3 dt;
+    SWIG_Alpha_shape_3::internal::triangulate(dt, points);
+    Fixed_alpha_shape_3_wrapper out;
+    out.data_sptr.reset(new CGAL_FAS3(dt, alpha)); // swaps with dt
+    return out;
+  }
+
+  int number_of_vertices() const { return static_cast<int>(data_sptr->number_of_vertices()); }
+  double get_alpha() const { return data_sptr->get_alpha(); }
+//Export to arrays and measures, computed in C++
+  // (number_of_vertices(), 3)
+  SWIG_CGAL::Buffer<double> point_array() const
+  {
+    return SWIG_CGAL::Buffer<double>(SWIG_Alpha_shape_3::internal::point_rows(*data_sptr), 3);
+  }
+  // (number of boundary facets, 3), the regular facets, and the singular ones
+  // if with_singular; regular facets are counterclockwise seen from outside
+  SWIG_CGAL::Buffer<int> boundary_facet_array(bool with_singular=false) const
+  {
+    return SWIG_CGAL::Buffer<int>(SWIG_Alpha_shape_3::internal::facet_rows(*data_sptr, with_singular), 3);
+  }
+  // area of the facets of boundary_facet_array(with_singular)
+  double area(bool with_singular=false) const
+  {
+    return SWIG_Alpha_shape_3::internal::boundary_area(*data_sptr, with_singular);
+  }
+  // volume of the interior cells
+  double volume() const { return SWIG_Alpha_shape_3::internal::interior_volume(*data_sptr); }
+};
+
+#endif //SWIG_CGAL_ALPHA_SHAPE_3_ALPHA_SHAPE_3_H
@@ -0,0 +1,48 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+%define AS3_DOCSTRING
+"SWIG wrapper for the CGAL 3D Alpha Shapes package provided under the GPL-3.0+ license"
+%enddef
+%module (package="CGAL", docstring=AS3_DOCSTRING) CGAL_Alpha_shape_3
+
+%include "SWIG_CGAL/common.i"
+Decl_void_type()
+
+SWIG_CGAL_add_java_loadLibrary(CGAL_Alpha_shape_3)
+SWIG_CGAL_package_common()
+
+%import  "SWIG_CGAL/Common/Macros.h"
+%import  "SWIG_CGAL/Kernel/CGAL_Kernel.i"
+
+//typemaps for the points given as arrays and the boundaries returned as arrays
+%include "SWIG_CGAL/typemaps.i"
+SWIG_CGAL_buffer_of_double_typemap_in
+SWIG_CGAL_buffer_of_double_typemap_out
+SWIG_CGAL_buffer_of_int_typemap_out
+
+//include files
+%{
+  #include <SWIG_CGAL/Alpha_shape_3/all_includes.h>
+%}
+
+//definitions
+%rename(Alpha_shape_3) Alpha_shape_3_wrapper;
+%rename(Fixed_alpha_shape_3) Fixed_alpha_shape_3_wrapper;
+SWIG_CGAL_release_gil(Alpha_shape_3_wrapper::from_array)
+SWIG_CGAL_release_gil(Alpha_shape_3_wrapper::set_alpha)
+SWIG_CGAL_release_gil(Alpha_shape_3_wrapper::find_optimal_alpha)
+SWIG_CGAL_release_gil(Alpha_shape_3_wrapper::boundary_facet_array)
+SWIG_CGAL_release_gil(Alpha_shape_3_wrapper::area)
+SWIG_CGAL_release_gil(Alpha_shape_3_wrapper::volume)
+SWIG_CGAL_release_gil(Fixed_alpha_shape_3_wrapper::from_array)
+SWIG_CGAL_release_gil(Fixed_alpha_shape_3_wrapper::boundary_facet_array)
+SWIG_CGAL_release_gil(Fixed_alpha_shape_3_wrapper::area)
+SWIG_CGAL_release_gil(Fixed_alpha_shape_3_wrapper::volume)
+%include "SWIG_CGAL/Alpha_shape_3/Alpha_shape_3.h"
+
+#ifdef SWIG_CGAL_HAS_Alpha_shape_3_USER_PACKAGE
+%include "SWIG_CGAL/User_packages/Alpha_shape_3/extensions.i"
+#endif
@@ -0,0 +1,12 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+#ifndef SWIG_CGAL_ALPHA_SHAPE_3_ALL_INCLUDES_H
+#define SWIG_CGAL_ALPHA_SHAPE_3_ALL_INCLUDES_H
+
+#include <SWIG_CGAL/Alpha_shape_3/typedefs.h>
+#include <SWIG_CGAL/Alpha_shape_3/Alpha_shape_3.h>
+
+#endif //SWIG_CGAL_ALPHA_SHAPE_3_ALL_INCLUDES_H
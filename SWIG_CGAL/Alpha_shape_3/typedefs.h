@@ -0,0 +1,41 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+#ifndef SWIG_CGAL_ALPHA_SHAPE_3_TYPEDEFS_H
+#define SWIG_CGAL_ALPHA_SHAPE_3_TYPEDEFS_H
+
+#include <SWIG_CGAL/Kernel/typedefs.h>
+#include <SWIG_CGAL/Triangulation_3/typedefs.h>
+
+#include <CGAL/Delaunay_triangulation_3.h>
+#include <CGAL/Triangulation_data_structure_3.h>
+#include <CGAL/Alpha_shape_3.h>
+#include <CGAL/Alpha_shape_vertex_base_3.h>
+#include <CGAL/Alpha_shape_cell_base_3.h>
+#include <CGAL/Fixed_alpha_shape_3.h>
+#include <CGAL/Fixed_alpha_shape_vertex_base_3.h>
+#include <CGAL/Fixed_alpha_shape_cell_base_3.h>
+
+//The data structures use the concurrency tag of the parallel Delaunay
+//triangulation (CGAL_PDT3) so that the points are inserted concurrently.
+
+//typedefs for Alpha_shape_3
+typedef CGAL::Alpha_shape_vertex_base_3<EPIC_Kernel>                    CGAL_AS3_vb;
+typedef CGAL::Alpha_shape_cell_base_3<EPIC_Kernel>                      CGAL_AS3_cb;
+typedef CGAL::Triangulation_data_structure_3<
+  CGAL_AS3_vb, CGAL_AS3_cb, PDT3_Concurrency_tag>                       CGAL_AS3_Tds;
+typedef CGAL::Delaunay_triangulation_3<EPIC_Kernel, CGAL_AS3_Tds>       CGAL_AS3_DT3;
+typedef CGAL::Alpha_shape_3<CGAL_AS3_DT3>                               CGAL_AS3;
+
+//typedefs for Fixed_alpha_shape_3: only the classification for one alpha
+//is stored, instead of the alpha intervals of all the simplices
+typedef CGAL::Fixed_alpha_shape_vertex_base_3<EPIC_Kernel>              CGAL_FAS3_vb;
+typedef CGAL::Fixed_alpha_shape_cell_base_3<EPIC_Kernel>                CGAL_FAS3_cb;
+typedef CGAL::Triangulation_data_structure_3<
+  CGAL_FAS3_vb, CGAL_FAS3_cb, PDT3_Concurrency_tag>                     CGAL_FAS3_Tds;
+typedef CGAL::Delaunay_triangulation_3<EPIC_Kernel, CGAL_FAS3_Tds>      CGAL_FAS3_DT3;
+typedef CGAL::Fixed_alpha_shape_3<CGAL_FAS3_DT3>                        CGAL_FAS3;
+
+#endif //SWIG_CGAL_ALPHA_SHAPE_3_TYPEDEFS_H
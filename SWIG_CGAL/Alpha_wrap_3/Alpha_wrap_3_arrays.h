@@ -0,0 +1,70 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2022 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+#ifndef SWIG_ALPHA_WRAP_3_ALPHA_WRAP_3_ARRAYS_H
+#define SWIG_ALPHA_WRAP_3_ALPHA_WRAP_3_ARRAYS_H
+
+#include <SWIG_CGAL/Common/Buffer.h>
+#include <SWIG_CGAL/Common/Spatial_insertion.h>
+#include <SWIG_CGAL/Kernel/typedefs.h>
+#include <CGAL/alpha_wrap_3.h>
+
+#include <array>
+#include <stdexcept>
+#include <vector>
+
+namespace SWIG_Alpha_wrap_3 {
+namespace internal {
+
+// The points of the rows (x, y, z) of coords
+inline std::vector<EPIC_Kernel::Point_3> read_points(const SWIG_CGAL::Buffer<double>& coords)
+{
+  const std::size_t n = SWIG_CGAL::number_of_rows(coords, 3);
+  std::vector<EPIC_Kernel::Point_3> points;
+  points.reserve(n);
+  for (std::size_t i = 0; i < n; ++i)
+    points.push_back(EPIC_Kernel::Point_3(coords[3*i], coords[3*i+1], coords[3*i+2]));
+  return points;
+}
+
+// The triangles of the rows of 3 indices of points of faces
+inline std::vector<std::array<int, 3> > read_triangles(const SWIG_CGAL::Buffer<int>& faces, std::size_t nb_points)
+{
+  if (faces.size() % 3 != 0)
+    throw std::invalid_argument("The faces must be given as rows of 3 point indices");
+  std::vector<std::array<int, 3> > triangles(faces.size() / 3);
+  for (std::size_t i = 0; i < faces.size(); ++i)
+  {
+    const int v = faces[i];
+    if (v < 0 || std::size_t(v) >= nb_points)
+      throw std::invalid_argument("Invalid point index in the faces");
+    triangles[i / 3][i % 3] = v;
+  }
+  return triangles;
+}
+
+// Wrap of the triangle soup given by the (N, 3) array coords and the (F, 3)
+// array faces of indices of rows of coords
+template <class TriangleMesh>
+void alpha_wrap_3(const SWIG_CGAL::Buffer<double>& coords, const SWIG_CGAL::Buffer<int>& faces,
+                  double alpha, double offset, TriangleMesh& wrap)
+{
+  const std::vector<EPIC_Kernel::Point_3> points = read_points(coords);
+  const std::vector<std::array<int, 3> > triangles = read_triangles(faces, points.size());
+  CGAL::alpha_wrap_3(points, triangles, alpha, offset, wrap);
+}
+
+// Wrap of the points given by the (N, 3) array coords
+template <class TriangleMesh>
+void alpha_wrap_3(const SWIG_CGAL::Buffer<double>& coords, double alpha, double offset, TriangleMesh& wrap)
+{
+  const std::vector<EPIC_Kernel::Point_3> points = read_points(coords);
+  CGAL::alpha_wrap_3(points, alpha, offset, wrap);
+}
+
+} // namespace internal
+} // namespace SWIG_Alpha_wrap_3
+
+#endif //SWIG_ALPHA_WRAP_3_ALPHA_WRAP_3_ARRAYS_H
@@ -0,0 +1,177 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2022 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+#ifndef SWIG_ALPHA_WRAP_3_ALPHA_WRAP_3_ORACLE_H
+#define SWIG_ALPHA_WRAP_3_ALPHA_WRAP_3_ORACLE_H
+
+#include <SWIG_CGAL/Common/Buffer.h>
+#include <SWIG_CGAL/Common/Cancellation_token.h>
+
+#include <memory>
+
+#ifndef SWIG
+#include <SWIG_CGAL/Alpha_wrap_3/Alpha_wrap_3_arrays.h>
+#include <SWIG_CGAL/Polyhedron_3/all_includes.h>
+#include <SWIG_CGAL/Surface_mesh/all_includes.h>
+#include <CGAL/Alpha_wrap_3/internal/Alpha_wrap_3.h>
+#include <CGAL/Alpha_wrap_3/internal/Triangle_soup_oracle.h>
+#include <CGAL/Alpha_wrap_3/internal/Point_set_oracle.h>
+
+#include <algorithm>
+#include <chrono>
+#include <stdexcept>
+
+namespace SWIG_Alpha_wrap_3 {
+namespace internal {
+
+typedef CGAL::Alpha_wraps_3::internal::Triangle_soup_oracle<EPIC_Kernel> Triangle_soup_oracle;
+typedef CGAL::Alpha_wraps_3::internal::Point_set_oracle<EPIC_Kernel>     Point_set_oracle;
+
+// Stops the flood fill once the budget is exhausted or the token is
+// cancelled; the wrap is then extracted from the current triangulation, and
+// is coarser than the complete one but still closed. The progress of the
+// token is the fraction of the budget used (0 for an unlimited budget) until
+// the end of the wrap.
+class Budget_visitor
+  : public CGAL::Alpha_wraps_3::internal::Wrapping_default_visitor
+{
+  typedef std::chrono::steady_clock Clock;
+
+  std::size_t max_steiner_points;
+  double max_seconds;
+  SWIG_CGAL::Cancellation_token token;
+  std::shared_ptr<std::size_t> nb_steiner_points;
+  std::shared_ptr<bool> stopped;
+  Clock::time_point start;
+
+public:
+  Budget_visitor(int max_steiner_points, double max_seconds, SWIG_CGAL::Cancellation_token token)
+    : max_steiner_points(max_steiner_points > 0 ? std::size_t(max_steiner_points) : 0),
+      max_seconds(max_seconds > 0 ? max_seconds : 0),
+      token(token),
+      nb_steiner_points(std::make_shared<std::size_t>(0)),
+      stopped(std::make_shared<bool>(false)),
+      start(Clock::now())
+  { }
+
+  bool is_stopped() const { return *stopped; }
+
+  template <typename AlphaWrapper>
+  bool go_further(const AlphaWrapper&)
+  {
+    double used = 0;
+    if (max_steiner_points != 0)
+      used = double(*nb_steiner_points) / max_steiner_points;
+    if (max_seconds != 0)
+      used = (std::max)(used, std::chrono::duration<double>(Clock::now() - start).count() / max_seconds);
+    if (!token.callback()((std::min)(used, 1.)) || used >= 1.)
+      *stopped = true;
+    return !*stopped;
+  }
+
+  template <typename AlphaWrapper, typename VertexHandle>
+  void after_Steiner_point_insertion(const AlphaWrapper&, VertexHandle)
+  {
+    ++*nb_steiner_points;
+  }
+
+  template <typename AlphaWrapper>
+  void on_alpha_wrapping_end(const AlphaWrapper&)
+  {
+    token.callback()(1.);
+  }
+};
+
+// The oracles share their AABB tree when copied: each wrap copies the
+// oracle and builds its own Delaunay triangulation, so that wraps with
+// the same oracle can run concurrently. Returns false if the wrap was
+// stopped by the budget, and throws if the token is cancelled.
+template <class Oracle, class TriangleMesh>
+bool wrap(const Oracle& oracle, double alpha, double offset, TriangleMesh& out,
+          int max_steiner_points, double max_seconds, SWIG_CGAL::Cancellation_token token)
+{
+  if (!(alpha > 0) || !(offset > 0))
+    throw std::invalid_argument("alpha and offset must be positive");
+  Budget_visitor visitor(max_steiner_points, max_seconds, token);
+  CGAL::Alpha_wraps_3::internal::Alpha_wrap_3<Oracle> aw3(oracle);
+  aw3(alpha, offset, out, CGAL::parameters::visitor(visitor));
+  token.throw_if_cancelled();
+  return !visitor.is_stopped();
+}
+
+} // namespace internal
+} // namespace SWIG_Alpha_wrap_3
+#endif
+
+// Oracle of alpha_wrap_3 (the AABB tree of the input triangle soup or point
+// set) built once and reused by wraps with different alpha and offset, for
+// example to generate levels of detail. wrap() does not modify the oracle
+// and runs without the GIL: several threads can wrap with the same oracle,
+// which is how wraps run in parallel (the refinement of one wrap is a
+// sequential priority queue).
+class Alpha_wrap_3_oracle
+{
+#ifndef SWIG
+  std::shared_ptr<SWIG_Alpha_wrap_3::internal::Triangle_soup_oracle> soup_sptr;
+  std::shared_ptr<SWIG_Alpha_wrap_3::internal::Point_set_oracle> point_set_sptr;
+
+  template <class TriangleMesh>
+  bool wrap_impl(double alpha, double offset, TriangleMesh& out,
+                 int max_steiner_points, double max_seconds, SWIG_CGAL::Cancellation_token token) const
+  {
+    if (soup_sptr)
+      return SWIG_Alpha_wrap_3::internal::wrap(*soup_sptr, alpha, offset, out, max_steiner_points, max_seconds, token);
+    if (point_set_sptr)
+      return SWIG_Alpha_wrap_3::internal::wrap(*point_set_sptr, alpha, offset, out, max_steiner_points, max_seconds, token);
+    throw std::invalid_argument("The oracle is empty");
+  }
+#endif
+
+public:
+  // triangle soup of the (N, 3) array points and the (F, 3) array faces of
+  // rows of points
+  static Alpha_wrap_3_oracle from_triangle_soup(SWIG_CGAL::Buffer<double> points, SWIG_CGAL::Buffer<int> faces)
+  {
+    const std::vector<EPIC_Kernel::Point_3> cgal_points = SWIG_Alpha_wrap_3::internal::read_points(points);
+    const std::vector<std::array<int, 3> > triangles =
+      SWIG_Alpha_wrap_3::internal::read_triangles(faces, cgal_points.size());
+    Alpha_wrap_3_oracle out;
+    out.soup_sptr.reset(new SWIG_Alpha_wrap_3::internal::Triangle_soup_oracle());
+    out.soup_sptr->add_triangle_soup(cgal_points, triangles);
+    return out;
+  }
+
+  // point set of the (N, 3) array points
+  static Alpha_wrap_3_oracle from_points(SWIG_CGAL::Buffer<double> points)
+  {
+    const std::vector<EPIC_Kernel::Point_3> cgal_points = SWIG_Alpha_wrap_3::internal::read_points(points);
+    Alpha_wrap_3_oracle out;
+    out.point_set_sptr.reset(new SWIG_Alpha_wrap_3::internal::Point_set_oracle());
+    out.point_set_sptr->add_point_set(cgal_points);
+    return out;
+  }
+
+  bool empty() const { return !soup_sptr && !point_set_sptr; }
+
+  // The insertion of Steiner points stops after max_steiner_points of them
+  // or max_seconds seconds when positive: the wrap is then coarser but
+  // still closed, and false is returned. The progress of token is the
+  // fraction of the budget used; cancelling it stops the wrap and throws.
+  bool wrap(double alpha, double offset, Polyhedron_3_SWIG_wrapper& alpha_wrap,
+            int max_steiner_points = 0, double max_seconds = 0,
+            SWIG_CGAL::Cancellation_token token = SWIG_CGAL::Cancellation_token()) const
+  {
+    return wrap_impl(alpha, offset, alpha_wrap.get_data(), max_steiner_points, max_seconds, token);
+  }
+
+  bool wrap(double alpha, double offset, Surface_mesh_3& alpha_wrap,
+            int max_steiner_points = 0, double max_seconds = 0,
+            SWIG_CGAL::Cancellation_token token = SWIG_CGAL::Cancellation_token()) const
+  {
+    return wrap_impl(alpha, offset, alpha_wrap.get_data(), max_steiner_points, max_seconds, token);
+  }
+};
+
+#endif //SWIG_ALPHA_WRAP_3_ALPHA_WRAP_3_ORACLE_H
@@ -23,7 +23,9 @@ SWIG_CGAL_package_common()
 %{
   #include <SWIG_CGAL/Common/Iterator.h>
   #include <SWIG_CGAL/Polyhedron_3/all_includes.h>
+  #include <SWIG_CGAL/Surface_mesh/all_includes.h>
   #include <SWIG_CGAL/Alpha_wrap_3/all_includes.h>
+  #include <SWIG_CGAL/Kernel/Coordinate_array.h>
 %}
 
 %pragma(java) jniclassimports=
@@ -31,14 +33,20 @@ SWIG_CGAL_package_common()
 import java.util.Iterator;
 import java.util.Collection;
 import CGAL.Polyhedron_3.Polyhedron_3;
+import CGAL.Surface_mesh.Surface_mesh_3;
 import CGAL.Kernel.Point_3;
+import CGAL.Kernel.Point_3_array;
+import CGAL.Kernel.Cancellation_token;
 %}
 
 %pragma(java) moduleimports=%{
 import java.util.Iterator;
 import java.util.Collection;
 import CGAL.Polyhedron_3.Polyhedron_3;
+import CGAL.Surface_mesh.Surface_mesh_3;
 import CGAL.Kernel.Point_3;
+import CGAL.Kernel.Point_3_array;
+import CGAL.Kernel.Cancellation_token;
 %};
 
 //import definitions of Polyhedron objects
@@ -47,6 +55,9 @@ import CGAL.Kernel.Point_3;
 //import Polyhedron_3 wrapper types
 SWIG_CGAL_import_Polyhedron_3_SWIG_wrapper
 
+//import definitions of Surface_mesh objects
+%import "SWIG_CGAL/Surface_mesh/CGAL_Surface_mesh.i"
+
 %include "std_vector.i"
 %typemap(javaimports) std::vector<Point_3>
 %{ import CGAL.Kernel.Point_3; %}
@@ -59,9 +70,8 @@ SWIG_CGAL_import_Polyhedron_3_SWIG_wrapper
 // %types(Point_3*,Point_3);//needed so that the identifier SWIGTYPE_p_Point_3 is generated
 // typemaps for input iterators
 SWIG_CGAL_set_wrapper_iterator_helper_input(Point_3)
-#ifdef SWIGPYTHON
-SWIG_CGAL_input_iterator_typemap_in_python_extra_function(alpha_wrap_3)
-#endif
+//the inputs are converted to vectors before the call: wrap without the GIL
+SWIG_CGAL_release_gil(alpha_wrap_3)
 
 %include "SWIG_CGAL/typemaps.i"
 SWIG_CGAL_vector_of_int_to_array_of_int_typemap_out
@@ -104,4 +114,118 @@ SWIG_CGAL_python_vector_of_int_typecheck
       cgal_points.push_back( pt.get_data() );
     CGAL::alpha_wrap_3(cgal_points, alpha, offset, alpha_wrap.get_data());
   }
+
+//Surface_mesh_3 variants
+  void alpha_wrap_3(const std::vector<Point_3>& points,
+                    const std::vector< std::vector<int> >& faces,
+                    double alpha,
+                    double offset,
+                    Surface_mesh_3& alpha_wrap)
+  {
+    std::vector< Point_3::cpp_base > cgal_points;
+    cgal_points.reserve(points.size());
+    BOOST_FOREACH(const Point_3& pt, points)
+      cgal_points.push_back( pt.get_data() );
+    CGAL::alpha_wrap_3(cgal_points, faces, alpha, offset, alpha_wrap.get_data());
+  }
+
+  void alpha_wrap_3(const Surface_mesh_3& tmesh,
+                    double alpha,
+                    double offset,
+                    Surface_mesh_3& alpha_wrap)
+  {
+    CGAL::alpha_wrap_3(tmesh.get_data(), alpha, offset, alpha_wrap.get_data());
+  }
+
+  void alpha_wrap_3(const std::vector<Point_3>& points,
+                    double alpha,
+                    double offset,
+                    Surface_mesh_3& alpha_wrap)
+  {
+    std::vector< Point_3::cpp_base > cgal_points;
+    cgal_points.reserve(points.size());
+    BOOST_FOREACH(const Point_3& pt, points)
+      cgal_points.push_back( pt.get_data() );
+    CGAL::alpha_wrap_3(cgal_points, alpha, offset, alpha_wrap.get_data());
+  }
 %}
+
+//array variants: (N, 3) coordinates and (F, 3) point indices, converted
+//once to CGAL points and triangles without Point_3 wrapper objects
+SWIG_CGAL_buffer_of_double_typemap_in
+SWIG_CGAL_buffer_of_int_typemap_in
+%{
+  #include <SWIG_CGAL/Alpha_wrap_3/Alpha_wrap_3_arrays.h>
+%}
+
+%inline %{
+  void alpha_wrap_3(SWIG_CGAL::Buffer<double> points,
+                    SWIG_CGAL::Buffer<int> faces,
+                    double alpha,
+                    double offset,
+                    Polyhedron_3_SWIG_wrapper& alpha_wrap)
+  {
+    SWIG_Alpha_wrap_3::internal::alpha_wrap_3(points, faces, alpha, offset, alpha_wrap.get_data());
+  }
+
+  void alpha_wrap_3(SWIG_CGAL::Buffer<double> points,
+                    double alpha,
+                    double offset,
+                    Polyhedron_3_SWIG_wrapper& alpha_wrap)
+  {
+    SWIG_Alpha_wrap_3::internal::alpha_wrap_3(points, alpha, offset, alpha_wrap.get_data());
+  }
+
+  void alpha_wrap_3(SWIG_CGAL::Buffer<double> points,
+                    SWIG_CGAL::Buffer<int> faces,
+                    double alpha,
+                    double offset,
+                    Surface_mesh_3& alpha_wrap)
+  {
+    SWIG_Alpha_wrap_3::internal::alpha_wrap_3(points, faces, alpha, offset, alpha_wrap.get_data());
+  }
+
+  void alpha_wrap_3(SWIG_CGAL::Buffer<double> points,
+                    double alpha,
+                    double offset,
+                    Surface_mesh_3& alpha_wrap)
+  {
+    SWIG_Alpha_wrap_3::internal::alpha_wrap_3(points, alpha, offset, alpha_wrap.get_data());
+  }
+%}
+
+//Point_3_array variants: the points are used in place
+%inline %{
+  void alpha_wrap_3(const Coordinate_array<Point_3,3>& points,
+                    double alpha,
+                    double offset,
+                    Polyhedron_3_SWIG_wrapper& alpha_wrap)
+  {
+    CGAL::alpha_wrap_3(points.get_data(), alpha, offset, alpha_wrap.get_data());
+  }
+
+  void alpha_wrap_3(const Coordinate_array<Point_3,3>& points,
+                    double alpha,
+                    double offset,
+                    Surface_mesh_3& alpha_wrap)
+  {
+    CGAL::alpha_wrap_3(points.get_data(), alpha, offset, alpha_wrap.get_data());
+  }
+%}
+
+//oracle reused by several wraps
+SWIG_CGAL_release_gil(Alpha_wrap_3_oracle::from_triangle_soup)
+SWIG_CGAL_release_gil(Alpha_wrap_3_oracle::from_points)
+SWIG_CGAL_release_gil(Alpha_wrap_3_oracle::wrap)
+%include "SWIG_CGAL/Alpha_wrap_3/Alpha_wrap_3_oracle.h"
+%{
+  #include <SWIG_CGAL/Alpha_wrap_3/Alpha_wrap_3_oracle.h>
+%}
+
+#ifdef SWIGPYTHON
+//asynchronous variants, see CGAL.run_async()
+%pythoncode %{
+import CGAL as _CGAL
+alpha_wrap_3_async = _CGAL.async_variant(alpha_wrap_3)
+%}
+#endif
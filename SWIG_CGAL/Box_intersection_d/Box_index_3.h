@@ -0,0 +1,452 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+
+#ifndef SWIG_CGAL_BOX_INTERSECTION_D_BOX_INDEX_3_H
+#define SWIG_CGAL_BOX_INTERSECTION_D_BOX_INDEX_3_H
+
+#include <SWIG_CGAL/Common/Buffer.h>
+#include <SWIG_CGAL/Box_intersection_d/Box_with_id.h>
+#include <SWIG_CGAL/Box_intersection_d/Box_intersection_d_arrays.h>
+#include <SWIG_CGAL/Box_intersection_d/enum.h>
+
+#ifndef SWIG
+#include <CGAL/for_each.h>
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+#endif
+
+// Persistent index of 3D boxes with int ids (non-negative, preferably
+// dense as they index an array), for repeated broad-phase queries on boxes
+// that move a little at a time. The boxes are kept in a dynamic bounding
+// box hierarchy: update() only reinserts the boxes given, and
+// query_changed() only reports the pairs involving the boxes inserted or
+// moved since the previous call, so that the work of a step depends on the
+// size of the change rather than on the number of boxes.
+class Box_index_3
+{
+#ifndef SWIG
+  struct Node
+  {
+    double lo[3], hi[3];
+    int parent, child1, child2;
+    int id; // of the box, for the leaves
+    bool is_leaf() const { return child1 < 0; }
+  };
+
+  std::vector<Node> nodes;
+  std::vector<int> free_nodes;
+  int root;
+  std::vector<int> leaf_of_id; // -1 if the id has no box
+  std::vector<char> is_changed;
+  std::vector<int> changed;
+  std::size_t nb_boxes;
+
+  static double area (const double* lo, const double* hi)
+  {
+    const double dx = hi[0] - lo[0], dy = hi[1] - lo[1], dz = hi[2] - lo[2];
+    return dx * dy + dy * dz + dz * dx;
+  }
+
+  static double union_area (const Node& a, const Node& b)
+  {
+    double lo[3], hi[3];
+    for (int k = 0; k < 3; ++ k)
+    {
+      lo[k] = (std::min) (a.lo[k], b.lo[k]);
+      hi[k] = (std::max) (a.hi[k], b.hi[k]);
+    }
+    return area (lo, hi);
+  }
+
+  static bool overlap (const double* alo, const double* ahi,
+                       const double* blo, const double* bhi, bool closed)
+  {
+    for (int k = 0; k < 3; ++ k)
+      if (closed ? (ahi[k] < blo[k] || bhi[k] < alo[k])
+                 : (ahi[k] <= blo[k] || bhi[k] <= alo[k]))
+        return false;
+    return true;
+  }
+
+  int new_node()
+  {
+    if (!free_nodes.empty())
+    {
+      int n = free_nodes.back();
+      free_nodes.pop_back();
+      return n;
+    }
+    nodes.push_back (Node());
+    return int(nodes.size()) - 1;
+  }
+
+  void refit (int n)
+  {
+    Node& node = nodes[n];
+    const Node& c1 = nodes[node.child1];
+    const Node& c2 = nodes[node.child2];
+    for (int k = 0; k < 3; ++ k)
+    {
+      node.lo[k] = (std::min) (c1.lo[k], c2.lo[k]);
+      node.hi[k] = (std::max) (c1.hi[k], c2.hi[k]);
+    }
+  }
+
+  void refit_ancestors (int n)
+  {
+    for (; n >= 0; n = nodes[n].parent)
+      refit (n);
+  }
+
+  // descends to the sibling minimizing the increase of the areas of the
+  // boxes of the hierarchy (surface area heuristic)
+  void insert_leaf (int leaf)
+  {
+    if (root < 0)
+    {
+      root = leaf;
+      nodes[leaf].parent = -1;
+      return;
+    }
+    int index = root;
+    while (!nodes[index].is_leaf())
+    {
+      const Node& node = nodes[index];
+      const double a = area (node.lo, node.hi);
+      const double combined = union_area (node, nodes[leaf]);
+      const double cost = 2 * combined;
+      const double inheritance = 2 * (combined - a);
+      double child_cost[2];
+      const int children[2] = { node.child1, node.child2 };
+      for (int c = 0; c < 2; ++ c)
+      {
+        const Node& child = nodes[children[c]];
+        child_cost[c] = union_area (child, nodes[leaf]) + inheritance;
+        if (!child.is_leaf())
+          child_cost[c] -= area (child.lo, child.hi);
+      }
+      if (cost < child_cost[0] && cost < child_cost[1])
+        break;
+      index = child_cost[0] < child_cost[1] ? children[0] : children[1];
+    }
+
+    const int sibling = index;
+    const int old_parent = nodes[sibling].parent;
+    const int parent = new_node();
+    nodes[parent].parent = old_parent;
+    nodes[parent].child1 = sibling;
+    nodes[parent].child2 = leaf;
+    nodes[parent].id = -1;
+    nodes[sibling].parent = parent;
+    nodes[leaf].parent = parent;
+    if (old_parent < 0)
+      root = parent;
+    else if (nodes[old_parent].child1 == sibling)
+      nodes[old_parent].child1 = parent;
+    else
+      nodes[old_parent].child2 = parent;
+    refit_ancestors (parent);
+  }
+
+  void remove_leaf (int leaf)
+  {
+    if (leaf == root)
+    {
+      root = -1;
+      return;
+    }
+    const int parent = nodes[leaf].parent;
+    const int grand_parent = nodes[parent].parent;
+    const int sibling = nodes[parent].child1 == leaf ? nodes[parent].child2 : nodes[parent].child1;
+    nodes[sibling].parent = grand_parent;
+    if (grand_parent < 0)
+      root = sibling;
+    else
+    {
+      if (nodes[grand_parent].child1 == parent)
+        nodes[grand_parent].child1 = sibling;
+      else
+        nodes[grand_parent].child2 = sibling;
+      refit_ancestors (grand_parent);
+    }
+    free_nodes.push_back (parent);
+  }
+
+  // top-down construction splitting the leaves at the median of the
+  // longest axis of their centers
+  int build (std::vector<int>::iterator begin, std::vector<int>::iterator end, int parent)
+  {
+    if (end - begin == 1)
+    {
+      nodes[*begin].parent = parent;
+      return *begin;
+    }
+    double lo[3], hi[3];
+    for (int k = 0; k < 3; ++ k)
+    {
+      lo[k] = std::numeric_limits<double>::infinity();
+      hi[k] = -std::numeric_limits<double>::infinity();
+    }
+    for (std::vector<int>::iterator it = begin; it != end; ++ it)
+      for (int k = 0; k < 3; ++ k)
+      {
+        const double c = nodes[*it].lo[k] + nodes[*it].hi[k];
+        lo[k] = (std::min) (lo[k], c);
+        hi[k] = (std::max) (hi[k], c);
+      }
+    int axis = 0;
+    for (int k = 1; k < 3; ++ k)
+      if (hi[k] - lo[k] > hi[axis] - lo[axis])
+        axis = k;
+    std::vector<int>::iterator middle = begin + (end - begin) / 2;
+    std::nth_element (begin, middle, end, [&](int a, int b)
+                      {
+                        return nodes[a].lo[axis] + nodes[a].hi[axis]
+                          < nodes[b].lo[axis] + nodes[b].hi[axis];
+                      });
+    const int n = new_node();
+    nodes[n].parent = parent;
+    nodes[n].id = -1;
+    const int child1 = build (begin, middle, n);
+    const int child2 = build (middle, end, n);
+    nodes[n].child1 = child1;
+    nodes[n].child2 = child2;
+    refit (n);
+    return n;
+  }
+
+  void set_box (int id, const double* lo, const double* hi)
+  {
+    if (id < 0)
+      throw std::invalid_argument ("The ids of the boxes must be non-negative");
+    if (std::size_t(id) >= leaf_of_id.size())
+    {
+      leaf_of_id.resize (std::size_t(id) + 1, -1);
+      is_changed.resize (std::size_t(id) + 1, 0);
+    }
+    int leaf = leaf_of_id[id];
+    if (leaf < 0)
+    {
+      leaf = new_node();
+      nodes[leaf].child1 = nodes[leaf].child2 = -1;
+      nodes[leaf].id = id;
+      leaf_of_id[id] = leaf;
+      ++ nb_boxes;
+    }
+    else
+    {
+      if (std::equal (lo, lo + 3, nodes[leaf].lo) && std::equal (hi, hi + 3, nodes[leaf].hi))
+        return;
+      remove_leaf (leaf);
+    }
+    std::copy (lo, lo + 3, nodes[leaf].lo);
+    std::copy (hi, hi + 3, nodes[leaf].hi);
+    insert_leaf (leaf);
+    if (!is_changed[id])
+    {
+      is_changed[id] = 1;
+      changed.push_back (id);
+    }
+  }
+
+  // calls report(id) for the boxes overlapping box
+  template <typename Report>
+  void overlapping_leaves (const Node& box, bool closed, Report report) const
+  {
+    if (root < 0)
+      return;
+    std::vector<int> stack (1, root);
+    while (!stack.empty())
+    {
+      const Node& node = nodes[stack.back()];
+      stack.pop_back();
+      if (node.is_leaf())
+      {
+        if (overlap (node.lo, node.hi, box.lo, box.hi, closed))
+          report (node.id);
+      }
+      else if (overlap (node.lo, node.hi, box.lo, box.hi, true))
+      {
+        stack.push_back (node.child1);
+        stack.push_back (node.child2);
+      }
+    }
+  }
+
+  // pairs of the boxes of ids with all the boxes, a pair of two boxes of ids
+  // being reported once (the lowest id first) if only_once(id) holds for both
+  template <typename Only_once>
+  SWIG_CGAL::Buffer<int> query (const std::vector<int>& ids, bool closed, const Only_once& only_once) const
+  {
+    SWIG_Box_intersection_d::Pair_collector pairs ((std::numeric_limits<std::size_t>::max)(),
+                                                   nullptr, nullptr);
+    CGAL::for_each<SWIG_Box_intersection_d::Concurrency_tag>
+      (ids, [&](const int& id) -> bool
+       {
+         const int leaf = leaf_of_id[id];
+         if (leaf < 0)
+           return true;
+         overlapping_leaves (nodes[leaf], closed, [&](int other)
+                             {
+                               if (other != id && (!only_once (other) || id < other))
+                                 pairs.add (std::size_t(id), std::size_t(other));
+                             });
+         return true;
+       });
+    return pairs.pairs();
+  }
+
+  void clear_changed()
+  {
+    for (int id : changed)
+      if (std::size_t(id) < is_changed.size())
+        is_changed[id] = 0;
+    changed.clear();
+  }
+#endif
+
+public:
+
+  Box_index_3() : root (-1), nb_boxes (0) { }
+
+  // Sets the boxes of ids to the rows (xmin, ymin, zmin, xmax, ymax, zmax)
+  // of boxes, inserting the ids that have no box. The boxes that do change
+  // are reported by the next query_changed(). When the index is empty, the
+  // hierarchy is built at once from the boxes.
+  void update (SWIG_CGAL::Buffer<int> ids, SWIG_CGAL::Buffer<double> boxes)
+  {
+    if (boxes.size() != 6 * ids.size() || (boxes.cols() != 1 && boxes.cols() != 6))
+      throw std::invalid_argument ("There must be one row of 6 coordinates per id");
+    const double* b = boxes.data();
+    if (root >= 0)
+    {
+      for (std::size_t i = 0; i < ids.size(); ++ i)
+        set_box (ids.data()[i], b + 6 * i, b + 6 * i + 3);
+      return;
+    }
+
+    std::vector<int> leaves;
+    leaves.reserve (ids.size());
+    for (std::size_t i = 0; i < ids.size(); ++ i)
+    {
+      const int id = ids.data()[i];
+      if (id < 0)
+        throw std::invalid_argument ("The ids of the boxes must be non-negative");
+      if (std::size_t(id) >= leaf_of_id.size())
+      {
+        leaf_of_id.resize (std::size_t(id) + 1, -1);
+        is_changed.resize (std::size_t(id) + 1, 0);
+      }
+      int leaf = leaf_of_id[id];
+      if (leaf < 0)
+      {
+        leaf = new_node();
+        leaf_of_id[id] = leaf;
+        leaves.push_back (leaf);
+        ++ nb_boxes;
+      }
+      Node& node = nodes[leaf];
+      node.child1 = node.child2 = -1;
+      node.id = id;
+      std::copy (b + 6 * i, b + 6 * i + 3, node.lo);
+      std::copy (b + 6 * i + 3, b + 6 * i + 6, node.hi);
+      if (!is_changed[id])
+      {
+        is_changed[id] = 1;
+        changed.push_back (id);
+      }
+    }
+    if (!leaves.empty())
+      root = build (leaves.begin(), leaves.end(), -1);
+  }
+
+  // Same as above for one box, its id being the one of box
+  void update (const Box_with_id_3& box)
+  {
+    double lo[3], hi[3];
+    for (int k = 0; k < 3; ++ k)
+    {
+      lo[k] = box.get_data().min_coord(k);
+      hi[k] = box.get_data().max_coord(k);
+    }
+    set_box (box.get_data().id(), lo, hi);
+  }
+
+  // removes the boxes of ids (the ids without a box are ignored)
+  void remove (SWIG_CGAL::Buffer<int> ids)
+  {
+    for (std::size_t i = 0; i < ids.size(); ++ i)
+    {
+      const int id = ids.data()[i];
+      if (id < 0 || std::size_t(id) >= leaf_of_id.size() || leaf_of_id[id] < 0)
+        continue;
+      remove_leaf (leaf_of_id[id]);
+      free_nodes.push_back (leaf_of_id[id]);
+      leaf_of_id[id] = -1;
+      -- nb_boxes;
+    }
+  }
+
+  // (M, 2) array of the pairs of ids of intersecting boxes, at least one of
+  // them being inserted or moved since the previous call (this one first,
+  // or the lowest id first if both are), in no particular order. The queries
+  // run in parallel when linked with TBB.
+  SWIG_CGAL::Buffer<int> query_changed (Topology topology = CLOSED)
+  {
+    SWIG_CGAL::Buffer<int> result
+      = query (changed, topology == CLOSED, [&](int id) { return is_changed[id] != 0; });
+    clear_changed();
+    return result;
+  }
+
+  // (M, 2) array of all the pairs of ids of intersecting boxes (the lowest
+  // id first); the boxes are no longer considered as changed
+  SWIG_CGAL::Buffer<int> query_all (Topology topology = CLOSED)
+  {
+    std::vector<int> ids;
+    ids.reserve (nb_boxes);
+    for (std::size_t id = 0; id < leaf_of_id.size(); ++ id)
+      if (leaf_of_id[id] >= 0)
+        ids.push_back (int(id));
+    SWIG_CGAL::Buffer<int> result = query (ids, topology == CLOSED, [](int) { return true; });
+    clear_changed();
+    return result;
+  }
+
+  // rebuilds the hierarchy from scratch, which can make the queries faster
+  // after many updates
+  void rebuild()
+  {
+    std::vector<int> leaves;
+    leaves.reserve (nb_boxes);
+    for (int leaf : leaf_of_id)
+      if (leaf >= 0)
+        leaves.push_back (leaf);
+    std::vector<Node> kept_leaves (leaves.size());
+    for (std::size_t i = 0; i < leaves.size(); ++ i)
+      kept_leaves[i] = nodes[leaves[i]];
+    nodes.swap (kept_leaves);
+    free_nodes.clear();
+    for (std::size_t i = 0; i < leaves.size(); ++ i)
+      leaf_of_id[nodes[i].id] = int(i);
+    std::vector<int> indices (leaves.size());
+    for (std::size_t i = 0; i < indices.size(); ++ i)
+      indices[i] = int(i);
+    root = indices.empty() ? -1 : build (indices.begin(), indices.end(), -1);
+  }
+
+  bool has_box (int id) const
+  {
+    return id >= 0 && std::size_t(id) < leaf_of_id.size() && leaf_of_id[id] >= 0;
+  }
+
+  int number_of_boxes() const { return int(nb_boxes); }
+  int number_of_changed_boxes() const { return int(changed.size()); }
+};
+
+#endif //SWIG_CGAL_BOX_INTERSECTION_D_BOX_INDEX_3_H
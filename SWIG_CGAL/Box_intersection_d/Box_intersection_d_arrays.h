@@ -0,0 +1,484 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+
+#ifndef SWIG_CGAL_BOX_INTERSECTION_D_BOX_INTERSECTION_D_ARRAYS_H
+#define SWIG_CGAL_BOX_INTERSECTION_D_BOX_INTERSECTION_D_ARRAYS_H
+
+#include <SWIG_CGAL/Common/Buffer.h>
+#include <SWIG_CGAL/Box_intersection_d/enum.h>
+
+#ifndef SWIG
+#include <SWIG_CGAL/Box_intersection_d/Box_with_id.h>
+#include <SWIG_CGAL/Kernel/typedefs.h>
+#include <CGAL/box_intersection_d.h>
+#include <CGAL/intersections.h>
+#include <CGAL/enum.h>
+#include <CGAL/tags.h>
+#include <CGAL/version.h>
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/enumerable_thread_specific.h>
+#endif
+
+namespace SWIG_Box_intersection_d {
+
+#ifdef CGAL_LINKED_WITH_TBB
+typedef CGAL::Parallel_tag Concurrency_tag;
+#else
+typedef CGAL::Sequential_tag Concurrency_tag;
+#endif
+
+// Collects the ids of the pairs of intersecting boxes. The parallel sweep
+// calls the callback concurrently (on copies of it), so each thread has its
+// own vector. The id of a box is the index of its row, boxes1 first, and
+// is replaced by the user id of the row if any.
+class Pair_collector
+{
+#ifdef CGAL_LINKED_WITH_TBB
+  typedef tbb::enumerable_thread_specific<std::vector<int> > Storage;
+#else
+  struct Storage
+  {
+    std::vector<int> pairs;
+    std::vector<int>& local() { return pairs; }
+    std::vector<int>* begin() { return &pairs; }
+    std::vector<int>* end() { return &pairs + 1; }
+  };
+#endif
+
+  std::shared_ptr<Storage> storage;
+  std::size_t n1;
+  const int* ids1;
+  const int* ids2;
+
+  int user_id (std::size_t id) const
+  {
+    if (id < n1)
+      return ids1 != nullptr ? ids1[id] : int(id);
+    return ids2 != nullptr ? ids2[id - n1] : int(id);
+  }
+
+public:
+
+  Pair_collector (std::size_t n1, const int* ids1, const int* ids2)
+    : storage (new Storage()), n1 (n1), ids1 (ids1), ids2 (ids2) { }
+
+  void add (std::size_t id1, std::size_t id2)
+  {
+    std::vector<int>& pairs = storage->local();
+    pairs.push_back (user_id (id1));
+    pairs.push_back (user_id (id2));
+  }
+
+  template <class Box>
+  void operator() (const Box& b1, const Box& b2)
+  {
+    add (std::size_t(b1.id()), std::size_t(b2.id()));
+  }
+
+  // (M, 2), in no particular order
+  SWIG_CGAL::Buffer<int> pairs() const
+  {
+    std::size_t size = 0;
+    for (const std::vector<int>& p : *storage)
+      size += p.size();
+    std::vector<int> out;
+    out.reserve (size);
+    for (const std::vector<int>& p : *storage)
+      out.insert (out.end(), p.begin(), p.end());
+    return SWIG_CGAL::Buffer<int> (std::move(out), 2);
+  }
+};
+
+// boxes is made of rows (min_0, ..., min_{d-1}, max_0, ..., max_{d-1})
+template <int DIM>
+void read_boxes (const SWIG_CGAL::Buffer<double>& boxes, const SWIG_CGAL::Buffer<int>* ids,
+                 int first_id, std::vector< Box_with_id<DIM> >& out)
+{
+  if (boxes.size() % (2 * DIM) != 0 || (boxes.cols() != 1 && boxes.cols() != 2 * DIM))
+    throw std::invalid_argument ("The boxes must be given as rows of 2 * dimension coordinates");
+  const std::size_t n = boxes.size() / (2 * DIM);
+  if (ids != nullptr && ids->size() != n)
+    throw std::invalid_argument ("There must be one id per box");
+  out.reserve (n);
+  for (std::size_t i = 0; i < n; ++ i)
+  {
+    double lo[DIM], hi[DIM];
+    for (int k = 0; k < DIM; ++ k)
+    {
+      lo[k] = boxes.data()[2 * DIM * i + k];
+      hi[k] = boxes.data()[2 * DIM * i + DIM + k];
+    }
+    out.push_back (Box_with_id<DIM> (lo, hi, first_id + int(i)));
+  }
+}
+
+template <int DIM>
+SWIG_CGAL::Buffer<int> box_intersection_arrays (const SWIG_CGAL::Buffer<double>& boxes1,
+                                                const SWIG_CGAL::Buffer<int>* ids1,
+                                                const SWIG_CGAL::Buffer<double>& boxes2,
+                                                const SWIG_CGAL::Buffer<int>* ids2,
+                                                int cutoff, Topology topology, Setting setting)
+{
+  std::vector< Box_with_id<DIM> > range1, range2;
+  read_boxes<DIM> (boxes1, ids1, 0, range1);
+  read_boxes<DIM> (boxes2, ids2, int(range1.size()), range2);
+  Pair_collector callback (range1.size(),
+                           ids1 != nullptr ? ids1->data() : nullptr,
+                           ids2 != nullptr ? ids2->data() : nullptr);
+#if CGAL_VERSION_NR >= 1050500000
+  CGAL::box_intersection_d<Concurrency_tag>
+#else
+  CGAL::box_intersection_d
+#endif
+    (range1.begin(), range1.end(), range2.begin(), range2.end(),
+     callback, (std::ptrdiff_t) cutoff,
+     CGAL::enum_cast< CGAL::Box_intersection_d::Topology >(topology),
+     CGAL::enum_cast< CGAL::Box_intersection_d::Setting >(setting));
+  return callback.pairs();
+}
+
+template <int DIM>
+SWIG_CGAL::Buffer<int> box_self_intersection_arrays (const SWIG_CGAL::Buffer<double>& boxes,
+                                                     const SWIG_CGAL::Buffer<int>* ids,
+                                                     int cutoff, Topology topology)
+{
+  std::vector< Box_with_id<DIM> > range;
+  read_boxes<DIM> (boxes, ids, 0, range);
+  Pair_collector callback (range.size(), ids != nullptr ? ids->data() : nullptr, nullptr);
+#if CGAL_VERSION_NR >= 1050500000
+  CGAL::box_self_intersection_d<Concurrency_tag>
+#else
+  CGAL::box_self_intersection_d
+#endif
+    (range.begin(), range.end(), callback, (std::ptrdiff_t) cutoff,
+     CGAL::enum_cast< CGAL::Box_intersection_d::Topology >(topology));
+  return callback.pairs();
+}
+
+// Primitives of one or two ranges given as rows of vertices, found by the
+// id of their box (see read_primitive_boxes())
+class Primitive_rows
+{
+  const double* coords1;
+  const double* coords2;
+  std::size_t n1, stride1, stride2;
+
+public:
+
+  Primitive_rows (const double* coords1, std::size_t n1, std::size_t stride1,
+                  const double* coords2, std::size_t stride2)
+    : coords1 (coords1), coords2 (coords2), n1 (n1), stride1 (stride1), stride2 (stride2) { }
+
+  const double* operator() (std::size_t id) const
+  {
+    return id < n1 ? coords1 + stride1 * id : coords2 + stride2 * (id - n1);
+  }
+};
+
+// boxes of nb_vertices points of DIM coordinates per row of primitives
+template <int DIM>
+void read_primitive_boxes (const SWIG_CGAL::Buffer<double>& primitives, int nb_vertices,
+                           int first_id, std::vector< Box_with_id<DIM> >& out)
+{
+  const std::size_t stride = std::size_t(DIM * nb_vertices);
+  if (primitives.size() % stride != 0 || (primitives.cols() != 1 && primitives.cols() != stride))
+    throw std::invalid_argument ("The primitives must be given as rows of vertex coordinates");
+  const std::size_t n = primitives.size() / stride;
+  out.reserve (n);
+  for (std::size_t i = 0; i < n; ++ i)
+  {
+    const double* p = primitives.data() + stride * i;
+    double lo[DIM], hi[DIM];
+    for (int k = 0; k < DIM; ++ k)
+    {
+      lo[k] = hi[k] = p[k];
+      for (int v = 1; v < nb_vertices; ++ v)
+      {
+        lo[k] = (std::min) (lo[k], p[DIM * v + k]);
+        hi[k] = (std::max) (hi[k], p[DIM * v + k]);
+      }
+    }
+    out.push_back (Box_with_id<DIM> (lo, hi, first_id + int(i)));
+  }
+}
+
+inline EPIC_Kernel::Point_2 point_2 (const double* p) { return EPIC_Kernel::Point_2 (p[0], p[1]); }
+inline EPIC_Kernel::Point_3 point_3 (const double* p) { return EPIC_Kernel::Point_3 (p[0], p[1], p[2]); }
+
+inline EPIC_Kernel::Segment_2 segment_2 (const double* p)
+{
+  return EPIC_Kernel::Segment_2 (point_2 (p), point_2 (p + 2));
+}
+inline EPIC_Kernel::Segment_3 segment_3 (const double* p)
+{
+  return EPIC_Kernel::Segment_3 (point_3 (p), point_3 (p + 3));
+}
+inline EPIC_Kernel::Triangle_3 triangle_3 (const double* p)
+{
+  return EPIC_Kernel::Triangle_3 (point_3 (p), point_3 (p + 3), point_3 (p + 6));
+}
+
+// Exact tests (the predicates of EPIC_Kernel are exact). The degenerate
+// primitives intersect nothing.
+struct Segment_2_segment_2_test
+{
+  static constexpr int dimension = 2, nb_vertices1 = 2, nb_vertices2 = 2;
+  bool operator() (const double* a, const double* b) const
+  {
+    const EPIC_Kernel::Segment_2 s1 = segment_2 (a), s2 = segment_2 (b);
+    return !s1.is_degenerate() && !s2.is_degenerate() && CGAL::do_intersect (s1, s2);
+  }
+};
+
+struct Segment_3_segment_3_test
+{
+  static constexpr int dimension = 3, nb_vertices1 = 2, nb_vertices2 = 2;
+  bool operator() (const double* a, const double* b) const
+  {
+    const EPIC_Kernel::Segment_3 s1 = segment_3 (a), s2 = segment_3 (b);
+    return !s1.is_degenerate() && !s2.is_degenerate() && CGAL::do_intersect (s1, s2);
+  }
+};
+
+struct Segment_3_triangle_3_test
+{
+  static constexpr int dimension = 3, nb_vertices1 = 2, nb_vertices2 = 3;
+  bool operator() (const double* a, const double* b) const
+  {
+    const EPIC_Kernel::Segment_3 s = segment_3 (a);
+    const EPIC_Kernel::Triangle_3 t = triangle_3 (b);
+    return !s.is_degenerate() && !t.is_degenerate() && CGAL::do_intersect (s, t);
+  }
+};
+
+struct Triangle_3_triangle_3_test
+{
+  static constexpr int dimension = 3, nb_vertices1 = 3, nb_vertices2 = 3;
+  bool operator() (const double* a, const double* b) const
+  {
+    const EPIC_Kernel::Triangle_3 t1 = triangle_3 (a), t2 = triangle_3 (b);
+    return !t1.is_degenerate() && !t2.is_degenerate() && CGAL::do_intersect (t1, t2);
+  }
+};
+
+// Runs Test on the pairs of boxes reported by the sweep, in the sweep, and
+// collects only the pairs of intersecting primitives. The boxes of the first
+// range may be reported second in the COMPLETE setting.
+template <class Test>
+class Tested_pair_collector
+{
+  Pair_collector pairs;
+  Primitive_rows primitives;
+  std::size_t n1;
+  Test test;
+
+public:
+
+  Tested_pair_collector (const Primitive_rows& primitives, std::size_t n1)
+    : pairs (n1, nullptr, nullptr), primitives (primitives), n1 (n1) { }
+
+  template <class Box>
+  void operator() (const Box& b1, const Box& b2)
+  {
+    std::size_t id1 = std::size_t(b1.id()), id2 = std::size_t(b2.id());
+    if (Test::nb_vertices1 != Test::nb_vertices2 && id1 >= n1)
+      std::swap (id1, id2);
+    if (test (primitives (id1), primitives (id2)))
+      pairs.add (id1, id2);
+  }
+
+  SWIG_CGAL::Buffer<int> result() const { return pairs.pairs(); }
+};
+
+template <class Test>
+SWIG_CGAL::Buffer<int> intersecting_pairs_arrays (const SWIG_CGAL::Buffer<double>& primitives1,
+                                                  const SWIG_CGAL::Buffer<double>& primitives2,
+                                                  int cutoff, Topology topology, Setting setting)
+{
+  const int DIM = Test::dimension;
+  std::vector< Box_with_id<DIM> > range1, range2;
+  read_primitive_boxes<DIM> (primitives1, Test::nb_vertices1, 0, range1);
+  read_primitive_boxes<DIM> (primitives2, Test::nb_vertices2, int(range1.size()), range2);
+  Tested_pair_collector<Test> callback
+    (Primitive_rows (primitives1.data(), range1.size(), std::size_t(DIM * Test::nb_vertices1),
+                     primitives2.data(), std::size_t(DIM * Test::nb_vertices2)),
+     range1.size());
+#if CGAL_VERSION_NR >= 1050500000
+  CGAL::box_intersection_d<Concurrency_tag>
+#else
+  CGAL::box_intersection_d
+#endif
+    (range1.begin(), range1.end(), range2.begin(), range2.end(),
+     callback, (std::ptrdiff_t) cutoff,
+     CGAL::enum_cast< CGAL::Box_intersection_d::Topology >(topology),
+     CGAL::enum_cast< CGAL::Box_intersection_d::Setting >(setting));
+  return callback.result();
+}
+
+template <class Test>
+SWIG_CGAL::Buffer<int> self_intersecting_pairs_arrays (const SWIG_CGAL::Buffer<double>& primitives,
+                                                       int cutoff, Topology topology)
+{
+  const int DIM = Test::dimension;
+  std::vector< Box_with_id<DIM> > range;
+  read_primitive_boxes<DIM> (primitives, Test::nb_vertices1, 0, range);
+  const std::size_t stride = std::size_t(DIM * Test::nb_vertices1);
+  Tested_pair_collector<Test> callback
+    (Primitive_rows (primitives.data(), range.size(), stride, nullptr, stride), range.size());
+#if CGAL_VERSION_NR >= 1050500000
+  CGAL::box_self_intersection_d<Concurrency_tag>
+#else
+  CGAL::box_self_intersection_d
+#endif
+    (range.begin(), range.end(), callback, (std::ptrdiff_t) cutoff,
+     CGAL::enum_cast< CGAL::Box_intersection_d::Topology >(topology));
+  return callback.result();
+}
+
+inline void check_dimension (int dimension)
+{
+  if (dimension != 2 && dimension != 3)
+    throw std::invalid_argument ("The dimension must be 2 or 3");
+}
+
+} // namespace SWIG_Box_intersection_d
+#endif
+
+// Same as box_intersection_d(), the boxes of dimension 2 or 3 being the
+// rows (min_0, ..., min_{d-1}, max_0, ..., max_{d-1}) of boxes1 and boxes2
+// (in the order of Bbox_2 and Bbox_3). Returns the (M, 2) array of the ids
+// of the pairs of intersecting boxes, in no particular order. The id of a
+// box is its row in boxes1, or the number of rows of boxes1 plus its row in
+// boxes2. The sweep runs in parallel when linked with TBB (CGAL 5.5 or later).
+inline SWIG_CGAL::Buffer<int>
+box_intersection_d_arrays (SWIG_CGAL::Buffer<double> boxes1,
+                           SWIG_CGAL::Buffer<double> boxes2,
+                           int dimension,
+                           int cutoff = 10,
+                           Topology topology = CLOSED,
+                           Setting setting = BIPARTITE)
+{
+  SWIG_Box_intersection_d::check_dimension (dimension);
+  return dimension == 2
+    ? SWIG_Box_intersection_d::box_intersection_arrays<2> (boxes1, nullptr, boxes2, nullptr, cutoff, topology, setting)
+    : SWIG_Box_intersection_d::box_intersection_arrays<3> (boxes1, nullptr, boxes2, nullptr, cutoff, topology, setting);
+}
+
+// Same as above, the ids of the boxes being given by ids1 and ids2 (they
+// need not be unique)
+inline SWIG_CGAL::Buffer<int>
+box_intersection_d_arrays (SWIG_CGAL::Buffer<double> boxes1,
+                           SWIG_CGAL::Buffer<int> ids1,
+                           SWIG_CGAL::Buffer<double> boxes2,
+                           SWIG_CGAL::Buffer<int> ids2,
+                           int dimension,
+                           int cutoff = 10,
+                           Topology topology = CLOSED,
+                           Setting setting = BIPARTITE)
+{
+  SWIG_Box_intersection_d::check_dimension (dimension);
+  return dimension == 2
+    ? SWIG_Box_intersection_d::box_intersection_arrays<2> (boxes1, &ids1, boxes2, &ids2, cutoff, topology, setting)
+    : SWIG_Box_intersection_d::box_intersection_arrays<3> (boxes1, &ids1, boxes2, &ids2, cutoff, topology, setting);
+}
+
+// Same as box_self_intersection_d() with the boxes given as rows of boxes
+// (see box_intersection_d_arrays()), the id of a box being its row
+inline SWIG_CGAL::Buffer<int>
+box_self_intersection_d_arrays (SWIG_CGAL::Buffer<double> boxes,
+                                int dimension,
+                                int cutoff = 10,
+                                Topology topology = CLOSED)
+{
+  SWIG_Box_intersection_d::check_dimension (dimension);
+  return dimension == 2
+    ? SWIG_Box_intersection_d::box_self_intersection_arrays<2> (boxes, nullptr, cutoff, topology)
+    : SWIG_Box_intersection_d::box_self_intersection_arrays<3> (boxes, nullptr, cutoff, topology);
+}
+
+// Same as above, the ids of the boxes being given by ids
+inline SWIG_CGAL::Buffer<int>
+box_self_intersection_d_arrays (SWIG_CGAL::Buffer<double> boxes,
+                                SWIG_CGAL::Buffer<int> ids,
+                                int dimension,
+                                int cutoff = 10,
+                                Topology topology = CLOSED)
+{
+  SWIG_Box_intersection_d::check_dimension (dimension);
+  return dimension == 2
+    ? SWIG_Box_intersection_d::box_self_intersection_arrays<2> (boxes, &ids, cutoff, topology)
+    : SWIG_Box_intersection_d::box_self_intersection_arrays<3> (boxes, &ids, cutoff, topology);
+}
+
+// Same as box_intersection_d_arrays(), the boxes being the bounding boxes
+// of the primitives of primitives1 and primitives2, given as rows of vertex
+// coordinates: (x0, y0, x1, y1) for SEGMENT_2, (x0, y0, z0, x1, y1, z1) for
+// SEGMENT_3 and the 9 coordinates of the 3 vertices for TRIANGLE_3. Only
+// the pairs of primitives that intersect (exact test run in the sweep) are
+// returned. primitives1 holds the first primitive type of test and
+// primitives2 the second one; the first column of the result always refers
+// to primitives1 for SEGMENT_3_TRIANGLE_3. The degenerate primitives
+// intersect nothing.
+inline SWIG_CGAL::Buffer<int>
+box_intersecting_pairs_arrays (SWIG_CGAL::Buffer<double> primitives1,
+                               SWIG_CGAL::Buffer<double> primitives2,
+                               Intersection_test test,
+                               int cutoff = 10,
+                               Topology topology = CLOSED,
+                               Setting setting = BIPARTITE)
+{
+  switch (test)
+  {
+  case SEGMENT_2_SEGMENT_2:
+    return SWIG_Box_intersection_d::intersecting_pairs_arrays<SWIG_Box_intersection_d::Segment_2_segment_2_test>
+      (primitives1, primitives2, cutoff, topology, setting);
+  case SEGMENT_3_SEGMENT_3:
+    return SWIG_Box_intersection_d::intersecting_pairs_arrays<SWIG_Box_intersection_d::Segment_3_segment_3_test>
+      (primitives1, primitives2, cutoff, topology, setting);
+  case SEGMENT_3_TRIANGLE_3:
+    if (setting != BIPARTITE)
+      throw std::invalid_argument ("SEGMENT_3_TRIANGLE_3 requires the BIPARTITE setting");
+    return SWIG_Box_intersection_d::intersecting_pairs_arrays<SWIG_Box_intersection_d::Segment_3_triangle_3_test>
+      (primitives1, primitives2, cutoff, topology, setting);
+  case TRIANGLE_3_TRIANGLE_3:
+    return SWIG_Box_intersection_d::intersecting_pairs_arrays<SWIG_Box_intersection_d::Triangle_3_triangle_3_test>
+      (primitives1, primitives2, cutoff, topology, setting);
+  }
+  throw std::invalid_argument ("Unknown intersection test");
+}
+
+// Same as box_self_intersection_d_arrays() for the primitives of one type
+// (see box_intersecting_pairs_arrays()). The primitives sharing a vertex or
+// an edge intersect.
+inline SWIG_CGAL::Buffer<int>
+box_self_intersecting_pairs_arrays (SWIG_CGAL::Buffer<double> primitives,
+                                    Intersection_test test,
+                                    int cutoff = 10,
+                                    Topology topology = CLOSED)
+{
+  switch (test)
+  {
+  case SEGMENT_2_SEGMENT_2:
+    return SWIG_Box_intersection_d::self_intersecting_pairs_arrays<SWIG_Box_intersection_d::Segment_2_segment_2_test>
+      (primitives, cutoff, topology);
+  case SEGMENT_3_SEGMENT_3:
+    return SWIG_Box_intersection_d::self_intersecting_pairs_arrays<SWIG_Box_intersection_d::Segment_3_segment_3_test>
+      (primitives, cutoff, topology);
+  case TRIANGLE_3_TRIANGLE_3:
+    return SWIG_Box_intersection_d::self_intersecting_pairs_arrays<SWIG_Box_intersection_d::Triangle_3_triangle_3_test>
+      (primitives, cutoff, topology);
+  case SEGMENT_3_TRIANGLE_3:
+    break;
+  }
+  throw std::invalid_argument ("The self intersection requires primitives of one type");
+}
+
+#endif //SWIG_CGAL_BOX_INTERSECTION_D_BOX_INTERSECTION_D_ARRAYS_H
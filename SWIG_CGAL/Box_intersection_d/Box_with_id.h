@@ -23,6 +23,7 @@ struct Box_with_id :
   Box_with_id(): id_(-1) {}
   template <class BBox>
   Box_with_id(const BBox& bbox, int i) : base(bbox), id_(i) {}
+  Box_with_id(double lo[DIM], double hi[DIM], int i) : base(lo, hi), id_(i) {}
   int id() const {return id_;}
 };
 
@@ -49,6 +49,7 @@ SWIG_CGAL_declare_identifier_of_template_class(Ids_iterator,SWIG_CGAL_Iterator<s
 %typemap(javaimports) Collect_ids_callback %{import java.util.Iterator;%}
 %typemap(javaimports) Box_with_id_2 %{import CGAL.Kernel.Bbox_2;%}
 %typemap(javaimports) Box_with_id_3 %{import CGAL.Kernel.Bbox_3;%}
+%typemap(javaimports) Box_index_3 %{import java.nio.IntBuffer; import java.nio.DoubleBuffer;%}
 
 %typemap(javaimports) Collect_polyline_intersection_points %{import java.util.Iterator;%}
 %typemap(javaimports) Box_for_segment_polyline_2 %{import CGAL.Kernel.Segment_2;%}
@@ -58,6 +59,12 @@ SWIG_CGAL_declare_identifier_of_template_class(Ids_iterator,SWIG_CGAL_Iterator<s
 SWIG_CGAL_array_of_int_to_vector_of_pair_of_int_typemap_in
 #endif
 
+//typemaps for the boxes given as arrays and the pairs of ids returned as arrays
+%include "SWIG_CGAL/typemaps.i"
+SWIG_CGAL_buffer_of_double_typemap_in
+SWIG_CGAL_buffer_of_int_typemap_in
+SWIG_CGAL_buffer_of_int_typemap_out
+
 %include "SWIG_CGAL/Box_intersection_d/Box_with_id.h"
 %include "SWIG_CGAL/Box_intersection_d/Callbacks.h"
 %include "SWIG_CGAL/Box_intersection_d/enum.h"
@@ -88,6 +95,24 @@ SWIG_CGAL_declare_identifier_of_template_class(Collect_ids_callback_3,Collect_id
 declare_box_intersection_d_box_functions(Box_with_id_2,Collect_ids_callback<2>)
 declare_box_intersection_d_box_functions(Box_with_id_3,Collect_ids_callback<3>)
 
+SWIG_CGAL_release_gil(box_intersection_d_arrays)
+SWIG_CGAL_release_gil(box_self_intersection_d_arrays)
+SWIG_CGAL_release_gil(box_intersecting_pairs_arrays)
+SWIG_CGAL_release_gil(box_self_intersecting_pairs_arrays)
+%include "SWIG_CGAL/Box_intersection_d/Box_intersection_d_arrays.h"
+%{
+  #include <SWIG_CGAL/Box_intersection_d/Box_intersection_d_arrays.h>
+%}
+
+SWIG_CGAL_release_gil(Box_index_3::update)
+SWIG_CGAL_release_gil(Box_index_3::query_changed)
+SWIG_CGAL_release_gil(Box_index_3::query_all)
+SWIG_CGAL_release_gil(Box_index_3::rebuild)
+%include "SWIG_CGAL/Box_intersection_d/Box_index_3.h"
+%{
+  #include <SWIG_CGAL/Box_intersection_d/Box_index_3.h>
+%}
+
 #ifdef SWIG_CGAL_HAS_Box_intersection_d_USER_PACKAGE
 %include "SWIG_CGAL/User_packages/Box_intersection_d/extensions.i"
 #endif
@@ -10,4 +10,8 @@
 enum Setting  { COMPLETE, BIPARTITE };
 enum Topology { HALF_OPEN, CLOSED };
 
+// narrow-phase tests of the *_intersecting_pairs_arrays() functions, named
+// after the primitives of the first and of the second range
+enum Intersection_test { SEGMENT_2_SEGMENT_2, SEGMENT_3_SEGMENT_3, SEGMENT_3_TRIANGLE_3, TRIANGLE_3_TRIANGLE_3 };
+
 #endif //SWIG_CGAL_BOX_INTERSECTION_D_ENUM_H
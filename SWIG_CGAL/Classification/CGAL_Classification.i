@@ -43,6 +43,15 @@ import java.util.Collection;
 %types(Point_3*,Point_3);//needed so that the identifier SWIGTYPE_p_Point_3 is generated
 %types(Vector_3*,Vector_3);//needed so that the identifier SWIGTYPE_p_Vector_3 is generated
 
+//typemaps for the selection of the scales of the feature generator, the
+//feature matrices and the evaluation of label arrays
+%include "SWIG_CGAL/typemaps.i"
+SWIG_CGAL_buffer_of_int_typemap_in
+SWIG_CGAL_buffer_of_float_typemap_in
+SWIG_CGAL_buffer_of_float_typemap_out
+SWIG_CGAL_buffer_of_int_typemap_out
+SWIG_CGAL_buffer_of_long_long_typemap_out
+
 
 %{ 
 #include <SWIG_CGAL/Classification/all_includes.h> 
@@ -53,26 +62,61 @@ import java.util.Collection;
 SWIG_CGAL_declare_identifier_of_template_class(Label,Label_wrapper< CGAL_Label >)
 SWIG_CGAL_declare_identifier_of_template_class(Label_set,Label_set_wrapper< CGAL_Label_set, Label_wrapper< CGAL_Label > >)
 
+SWIG_CGAL_release_gil(Feature_set_wrapper::to_matrix)
 %include "SWIG_CGAL/Classification/Feature_set.h"
 SWIG_CGAL_declare_identifier_of_template_class(Feature,Feature_wrapper< CGAL_Feature >)
+%typemap(javaimports) Feature_set_wrapper< CGAL_Feature_set, Feature_wrapper< CGAL_Feature > > %{ import CGAL.Kernel.Memory_usage; %}
 SWIG_CGAL_declare_identifier_of_template_class(Feature_set,Feature_set_wrapper< CGAL_Feature_set, Feature_wrapper< CGAL_Feature > >)
 
+//the scales and the features are computed without the GIL
+SWIG_CGAL_release_gil(Point_set_feature_generator_wrapper::Point_set_feature_generator_wrapper)
+SWIG_CGAL_release_gil(Point_set_feature_generator_wrapper::generate_features)
+SWIG_CGAL_release_gil(Point_set_feature_generator_wrapper::generate_point_based_features)
+SWIG_CGAL_release_gil(Point_set_feature_generator_wrapper::generate_normal_based_features)
+SWIG_CGAL_release_gil(Point_set_feature_generator_wrapper::generate_color_based_features)
+SWIG_CGAL_release_gil(Point_set_feature_generator_wrapper::generate_echo_based_features)
 %include "SWIG_CGAL/Classification/Point_set_feature_generator.h"
 SWIG_CGAL_declare_identifier_of_template_class(Point_set_neighbor_query, Point_set_neighbor_query_wrapper< CGAL_Point_set_neighborhood >)
 SWIG_CGAL_declare_identifier_of_template_class(Point_set_neighborhood, Point_set_neighborhood_wrapper< CGAL_Point_set_neighborhood >) %typemap(javaimports) Point_set_feature_generator_wrapper< CGAL_Point_set_feature_generator, Feature_set_wrapper< CGAL_Feature_set, Feature_wrapper< CGAL_Feature > >, Point_set_neighborhood_wrapper< CGAL_Point_set_neighborhood> > %{ import CGAL.Point_set_3.Point_set_3; import CGAL.Point_set_3.Point_set_3_Vector_map; import CGAL.Point_set_3.Point_set_3_Int_map; %}
 SWIG_CGAL_declare_identifier_of_template_class(Point_set_feature_generator, Point_set_feature_generator_wrapper< CGAL_Point_set_feature_generator, Feature_set_wrapper< CGAL_Feature_set, Feature_wrapper< CGAL_Feature > >, Point_set_neighborhood_wrapper< CGAL_Point_set_neighborhood> >)
 
+//training and parsing the forests run without the GIL
+SWIG_CGAL_release_gil(ETHZ_Random_forest_classifier_wrapper::train)
+SWIG_CGAL_release_gil(ETHZ_Random_forest_classifier_wrapper::train_from_array)
+SWIG_CGAL_release_gil(ETHZ_Random_forest_classifier_wrapper::load_configuration)
+SWIG_CGAL_release_gil(ETHZ_Random_forest_classifier_wrapper::load_cached_configuration)
 %include "SWIG_CGAL/Classification/ETHZ_Random_forest_classifier.h"
 %typemap(javaimports) ETHZ_Random_forest_classifier_wrapper< CGAL_ETHZ_Random_forest, Label_set_wrapper< CGAL_Label_set, Label_wrapper< CGAL_Label > >, Feature_set_wrapper< CGAL_Feature_set, Feature_wrapper< CGAL_Feature > > > %{ import CGAL.Point_set_3.Point_set_3_Int_iterator; %}
 SWIG_CGAL_declare_identifier_of_template_class(ETHZ_Random_forest_classifier, ETHZ_Random_forest_classifier_wrapper< CGAL_ETHZ_Random_forest, Label_set_wrapper< CGAL_Label_set, Label_wrapper< CGAL_Label > >, Feature_set_wrapper< CGAL_Feature_set, Feature_wrapper< CGAL_Feature > > >)
 
 %include "SWIG_CGAL/Classification/Evaluation.h"
-%typemap(javaimports) Evaluation_wrapper< CGAL_Evaluation, Label_set_wrapper< CGAL_Label_set, Label_wrapper< CGAL_Label > > > %{ import CGAL.Point_set_3.Point_set_3_Int_iterator; %}
-SWIG_CGAL_declare_identifier_of_template_class(Evaluation, Evaluation_wrapper< CGAL_Evaluation, Label_set_wrapper< CGAL_Label_set, Label_wrapper< CGAL_Label > > >)
-
+%typemap(javaimports) Evaluation_wrapper< SWIG_Classification::Evaluation_counts, Label_set_wrapper< CGAL_Label_set, Label_wrapper< CGAL_Label > > > %{ import CGAL.Point_set_3.Point_set_3_Int_iterator; %}
+SWIG_CGAL_declare_identifier_of_template_class(Evaluation, Evaluation_wrapper< SWIG_Classification::Evaluation_counts, Label_set_wrapper< CGAL_Label_set, Label_wrapper< CGAL_Label > > >)
+
+//all the inputs are wrapped C++ objects: classification runs without the GIL
+SWIG_CGAL_release_gil(classify)
+SWIG_CGAL_release_gil(classify_with_local_smoothing)
+SWIG_CGAL_release_gil(classify_with_graphcut)
+SWIG_CGAL_release_gil(classify_with_graphcut_subdivided)
+SWIG_CGAL_release_gil(classify_tiled)
 %include "SWIG_CGAL/Classification/classify.h"
 
-
-
-
-
+//classification of clusters of points
+SWIG_CGAL_release_gil(Cluster_set_wrapper::Cluster_set_wrapper)
+SWIG_CGAL_release_gil(Cluster_set_wrapper::generate_features)
+SWIG_CGAL_release_gil(Cluster_set_wrapper::cluster_ground_truth)
+SWIG_CGAL_release_gil(Cluster_set_wrapper::classify_clusters)
+SWIG_CGAL_release_gil(Cluster_set_wrapper::broadcast_labels)
+SWIG_CGAL_release_gil(Cluster_set_wrapper::classify)
+%include "SWIG_CGAL/Classification/Cluster_set.h"
+%typemap(javaimports) Cluster_set_wrapper< CGAL::Classification::Cluster<CGAL_PS3, CGAL_PS3::Point_map>, Label_set_wrapper< CGAL_Label_set, Label_wrapper< CGAL_Label > >, Feature_set_wrapper< CGAL_Feature_set, Feature_wrapper< CGAL_Feature > >, ETHZ_Random_forest_classifier_wrapper< CGAL_ETHZ_Random_forest, Label_set_wrapper< CGAL_Label_set, Label_wrapper< CGAL_Label > >, Feature_set_wrapper< CGAL_Feature_set, Feature_wrapper< CGAL_Feature > > > > %{ import CGAL.Point_set_3.Point_set_3; import CGAL.Point_set_3.Point_set_3_Int_map; %}
+SWIG_CGAL_declare_identifier_of_template_class(Cluster_set, Cluster_set_wrapper< CGAL::Classification::Cluster<CGAL_PS3, CGAL_PS3::Point_map>, Label_set_wrapper< CGAL_Label_set, Label_wrapper< CGAL_Label > >, Feature_set_wrapper< CGAL_Feature_set, Feature_wrapper< CGAL_Feature > >, ETHZ_Random_forest_classifier_wrapper< CGAL_ETHZ_Random_forest, Label_set_wrapper< CGAL_Label_set, Label_wrapper< CGAL_Label > >, Feature_set_wrapper< CGAL_Feature_set, Feature_wrapper< CGAL_Feature > > > >)
+
+#ifdef SWIGPYTHON
+//asynchronous variants, see CGAL.run_async()
+%pythoncode %{
+import CGAL as _CGAL
+classify_with_graphcut_async = _CGAL.async_variant(classify_with_graphcut)
+classify_with_graphcut_subdivided_async = _CGAL.async_variant(classify_with_graphcut_subdivided)
+%}
+#endif
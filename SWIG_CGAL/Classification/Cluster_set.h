@@ -0,0 +1,208 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+#ifndef SWIG_CGAL_CLASSIFICATION_CLUSTER_SET_H
+#define SWIG_CGAL_CLASSIFICATION_CLUSTER_SET_H
+
+#include <SWIG_CGAL/Common/Buffer.h>
+#include <SWIG_CGAL/Point_set_3/Point_set_3.h>
+#include <SWIG_CGAL/Classification/typedefs.h>
+
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#ifndef SWIG
+#include <CGAL/Classification/Cluster.h>
+#include <CGAL/Classification/Feature/Cluster_mean_of_feature.h>
+#include <CGAL/Classification/Feature/Cluster_variance_of_feature.h>
+#include <CGAL/Classification/Feature/Cluster_size.h>
+#include <CGAL/Classification/Feature/Cluster_vertical_extent.h>
+#include <CGAL/for_each.h>
+#include <algorithm>
+#include <map>
+#endif
+
+// Clusters of the points of a point set, classified as a whole instead of
+// point by point: cluster_of_point[i] is the cluster of the point i (-1 if
+// none), for example the region_id_array() of a region growing, the
+// clusters being numbered from 0 without gaps. The cluster features
+// (generate_features()) are computed from point features, a classifier
+// trained on them (with cluster_ground_truth()) then classifies the
+// clusters and the labels are broadcast to their points. The copies share
+// the clusters.
+template <typename Cluster_base, typename Label_set, typename Feature_set, typename Classifier>
+class Cluster_set_wrapper
+{
+  typedef Point_set_3_wrapper<CGAL_PS3> Point_set;
+  typedef typename Point_set::Int_map   Int_map;
+
+  std::shared_ptr<std::vector<Cluster_base> > data_sptr;
+  std::shared_ptr<std::vector<int> > cluster_of_point_sptr;
+  // kept alive as the clusters refer to its points
+  Point_set point_set;
+
+#ifndef SWIG
+  // runs f(i) on the points, by blocks processed in parallel
+  template <typename Function>
+  void for_each_point (const Function& f) const
+  {
+    const std::size_t n = cluster_of_point_sptr->size();
+    const std::size_t block_size = 4096;
+    std::vector<std::size_t> blocks;
+    for (std::size_t b = 0; b * block_size < n; ++ b)
+      blocks.push_back (b);
+    CGAL::for_each<SWIG_Point_set_3::Concurrency_tag>
+      (blocks, [&](const std::size_t& b) -> bool
+       {
+         for (std::size_t i = b * block_size; i < (std::min)(n, (b + 1) * block_size); ++ i)
+           f (i);
+         return true;
+       });
+  }
+
+  const std::vector<int>& cluster_of_point() const { return *cluster_of_point_sptr; }
+#endif
+
+public:
+#ifndef SWIG
+  typedef std::vector<Cluster_base> cpp_base;
+  const cpp_base& get_data() const { return *data_sptr; }
+        cpp_base& get_data()       { return *data_sptr; }
+#endif
+
+  Cluster_set_wrapper (Point_set point_set, SWIG_CGAL::Buffer<int> cluster_of_point)
+    : data_sptr (new std::vector<Cluster_base>())
+    , cluster_of_point_sptr (new std::vector<int>(cluster_of_point.data(), cluster_of_point.data() + cluster_of_point.size()))
+    , point_set (point_set)
+  {
+    const CGAL_PS3& points = point_set.get_data();
+    if (cluster_of_point.size() != points.size())
+      throw std::invalid_argument ("Expecting one cluster index per point");
+    int nb_clusters = 0;
+    for (int c : *cluster_of_point_sptr)
+    {
+      if (c < -1)
+        throw std::invalid_argument ("Invalid cluster index " + std::to_string(c));
+      nb_clusters = (std::max)(nb_clusters, c + 1);
+    }
+    data_sptr->reserve (std::size_t(nb_clusters));
+    for (int c = 0; c < nb_clusters; ++ c)
+      data_sptr->push_back (Cluster_base (points, points.point_map()));
+    for (std::size_t i = 0; i < cluster_of_point_sptr->size(); ++ i)
+      if ((*cluster_of_point_sptr)[i] != -1)
+        (*data_sptr)[std::size_t((*cluster_of_point_sptr)[i])].insert (i);
+    for (const Cluster_base& cluster : *data_sptr)
+      if (cluster.size() == 0)
+        throw std::invalid_argument ("The clusters must be numbered without gaps");
+  }
+
+  int size() const { return int(data_sptr->size()); }
+  int number_of_points (int cluster) const
+  {
+    if (cluster < 0 || cluster >= size())
+      throw std::out_of_range ("Invalid cluster index");
+    return int((*data_sptr)[std::size_t(cluster)].size());
+  }
+  // the cluster of each point
+  SWIG_CGAL::Buffer<int> cluster_of_point_array() const
+  {
+    return SWIG_CGAL::Buffer<int> (cluster_of_point_sptr->data(), cluster_of_point_sptr->size(), 1,
+                                   cluster_of_point_sptr, true);
+  }
+
+  // Adds to cluster_features the mean and the variance over each cluster of
+  // each feature of point_features, then the number of points and the
+  // vertical extent of the clusters, all computed in parallel.
+  void generate_features (Feature_set cluster_features, Feature_set point_features) const
+  {
+    typedef CGAL::Classification::Feature::Cluster_mean_of_feature     Mean;
+    typedef CGAL::Classification::Feature::Cluster_variance_of_feature Variance;
+    typedef CGAL::Classification::Feature::Cluster_size                Size;
+    typedef CGAL::Classification::Feature::Cluster_vertical_extent     Vertical_extent;
+
+    CGAL_Feature_set& out = cluster_features.get_data();
+    const CGAL_Feature_set& in = point_features.get_data();
+    std::vector<CGAL_Feature> means;
+    // the variances use the values of the means: they are added once the
+    // means are computed
+    cluster_features.begin_parallel_additions();
+    for (std::size_t j = 0; j < in.size(); ++ j)
+      means.push_back (out.template add<Mean> (*data_sptr, in[j]));
+    out.template add<Size> (*data_sptr);
+    out.template add<Vertical_extent> (*data_sptr);
+    cluster_features.end_parallel_additions();
+
+    cluster_features.begin_parallel_additions();
+    for (std::size_t j = 0; j < in.size(); ++ j)
+      out.template add<Variance> (*data_sptr, in[j], means[j]);
+    cluster_features.end_parallel_additions();
+  }
+
+  // Label of each cluster, to train a classifier on the cluster features:
+  // the most frequent label of the labeled points (point_labels[i] >= 0) of
+  // the cluster, the smallest label winning ties, -1 without labeled points.
+  SWIG_CGAL::Buffer<int> cluster_ground_truth (SWIG_CGAL::Buffer<int> point_labels) const
+  {
+    if (point_labels.size() != cluster_of_point().size())
+      throw std::invalid_argument ("Expecting one label per point");
+    std::vector<int> out (data_sptr->size(), -1);
+    std::vector<std::size_t> clusters (data_sptr->size());
+    for (std::size_t c = 0; c < clusters.size(); ++ c)
+      clusters[c] = c;
+    CGAL::for_each<SWIG_Point_set_3::Concurrency_tag>
+      (clusters, [&](const std::size_t& c) -> bool
+       {
+         const Cluster_base& cluster = (*data_sptr)[c];
+         std::map<int, std::size_t> votes;
+         for (std::size_t k = 0; k < cluster.size(); ++ k)
+         {
+           const int label = point_labels[cluster.index (k)];
+           if (label >= 0) ++ votes[label];
+         }
+         std::size_t best = 0;
+         for (const auto& vote : votes)
+           if (vote.second > best)
+           {
+             best = vote.second;
+             out[c] = vote.first;
+           }
+         return true;
+       });
+    return SWIG_CGAL::Buffer<int> (std::move(out));
+  }
+
+  // Label of each cluster by a classifier of cluster features (generated by
+  // generate_features()), the clusters being classified in parallel.
+  SWIG_CGAL::Buffer<int> classify_clusters (Label_set labels, Classifier classifier) const
+  {
+    std::vector<int> out (data_sptr->size(), -1);
+    CGAL::Classification::classify<SWIG_Point_set_3::Concurrency_tag>
+      (*data_sptr, labels.get_data(), classifier.get_data(), out);
+    return SWIG_CGAL::Buffer<int> (std::move(out));
+  }
+
+  // output[i] = cluster_labels[c] for the points i of each cluster c, and -1
+  // for those in no cluster, written in parallel
+  void broadcast_labels (SWIG_CGAL::Buffer<int> cluster_labels, Int_map output) const
+  {
+    if (cluster_labels.size() != data_sptr->size())
+      throw std::invalid_argument ("Expecting one label per cluster");
+    const CGAL_PS3& points = point_set.get_data();
+    const std::vector<int>& clusters = cluster_of_point();
+    for_each_point ([&](std::size_t i)
+    {
+      output.get_data()[*(points.begin() + i)] = clusters[i] == -1 ? -1 : cluster_labels[std::size_t(clusters[i])];
+    });
+  }
+
+  // classify_clusters() followed by broadcast_labels()
+  void classify (Label_set labels, Classifier classifier, Int_map output) const
+  {
+    broadcast_labels (classify_clusters (labels, classifier), output);
+  }
+};
+
+#endif // SWIG_CGAL_CLASSIFICATION_CLUSTER_SET_H
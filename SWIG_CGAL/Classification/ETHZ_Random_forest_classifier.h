@@ -8,25 +8,224 @@
 
 #include <SWIG_CGAL/Common/Reference_wrapper.h>
 #include <SWIG_CGAL/Common/Macros.h>
+#include <SWIG_CGAL/Common/Buffer.h>
+#include <SWIG_CGAL/Kernel/Thread_pool.h>
 #include <SWIG_CGAL/Point_set_3/Point_set_3.h>
+#include <SWIG_CGAL/Classification/typedefs.h>
+
+#include <memory>
+#include <string>
+
+#ifndef SWIG
+#include <sys/stat.h>
+#include <algorithm>
+#include <ctime>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <random>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace SWIG_Classification {
+namespace internal {
+
+typedef CGAL::internal::liblearning::RandomForest::RandomForest
+<CGAL::internal::liblearning::RandomForest::NodeGini
+ <CGAL::internal::liblearning::RandomForest::AxisAlignedSplitter> > ETHZ_forest;
+
+// CGAL keeps the trained forest of a classifier private, and copying a
+// classifier saves and parses the whole forest. The explicit instantiation
+// below (where access checking does not apply) gives access to the
+// shared_ptr holding it, so that classifiers can share one forest. A shared
+// forest is never modified: the classifiers are given a forest of their own
+// before being trained or loaded.
+struct Forest_member
+{
+  typedef std::shared_ptr<ETHZ_forest> CGAL_ETHZ_Random_forest::* type;
+  friend type member_pointer (Forest_member);
+};
+
+template <typename Tag, typename Tag::type Member>
+struct Private_member
+{
+  friend typename Tag::type member_pointer (Tag) { return Member; }
+};
+
+template struct Private_member<Forest_member, &CGAL_ETHZ_Random_forest::m_rfc>;
+
+inline std::shared_ptr<ETHZ_forest>& forest (CGAL_ETHZ_Random_forest& classifier)
+{
+  return classifier.*member_pointer (Forest_member());
+}
+
+// Forests loaded from files, shared by all the classifiers of the process
+// that load the same file. An entry is valid as long as the file has the
+// same size and modification time.
+class Forest_cache
+{
+  struct Entry
+  {
+    long long size;
+    std::time_t mtime;
+    std::shared_ptr<ETHZ_forest> forest;
+  };
+
+  std::map<std::string, Entry> entries;
+  std::mutex mutex;
+
+  static bool file_signature (const std::string& filename, long long& size, std::time_t& mtime)
+  {
+    struct stat s;
+    if (stat (filename.c_str(), &s) != 0)
+      return false;
+    size = (long long)(s.st_size);
+    mtime = s.st_mtime;
+    return true;
+  }
+
+public:
+
+  static Forest_cache& instance()
+  {
+    static Forest_cache cache;
+    return cache;
+  }
+
+  // the forest of filename, loaded with load() if it is not cached or if
+  // the file changed since it was loaded
+  template <typename Loader>
+  std::shared_ptr<ETHZ_forest> get (const std::string& filename, const Loader& load)
+  {
+    Entry e;
+    if (!file_signature (filename, e.size, e.mtime))
+      throw std::runtime_error ("Cannot read file " + filename);
+    std::lock_guard<std::mutex> lock (mutex);
+    std::map<std::string, Entry>::iterator it = entries.find (filename);
+    if (it != entries.end() && it->second.size == e.size && it->second.mtime == e.mtime)
+      return it->second.forest;
+    e.forest = load();
+    entries[filename] = e;
+    return e.forest;
+  }
+
+  void clear()
+  {
+    std::lock_guard<std::mutex> lock (mutex);
+    entries.clear();
+  }
+};
+
+} //namespace internal
+} //namespace SWIG_Classification
+#endif
 
 template <typename Classifier_base, typename Label_set, typename Feature_set>
 class ETHZ_Random_forest_classifier_wrapper
 {
   SWIG_CGAL_INIT_WRAPPER_CLASS (Classifier_base, data_sptr);
 
+  // kept alive as the CGAL classifier refers to them
+  Label_set labels;
+  Feature_set features;
+
+#ifndef SWIG
+  // gives the classifier a forest of its own if it shares it, before the
+  // forest is modified
+  void detach (bool keep_trees)
+  {
+    if (SWIG_Classification::internal::forest (*data_sptr).use_count() <= 1)
+      return;
+    if (keep_trees)
+      data_sptr = std::make_shared<Classifier_base> (*data_sptr, features.get_data());
+    else
+      data_sptr = std::make_shared<Classifier_base> (labels.get_data(), features.get_data());
+  }
+#endif
+
 public:
 
   ETHZ_Random_forest_classifier_wrapper (Label_set labels,
                                          Feature_set features)
     : data_sptr (new Classifier_base (labels.get_data(), features.get_data()))
+    , labels (labels), features (features)
   { }
 
+  // Classifier of features sharing the trained forest of other, without
+  // copying it. features must be made of the same features as the ones of
+  // other, in the same order.
+  ETHZ_Random_forest_classifier_wrapper (Label_set labels,
+                                         Feature_set features,
+                                         const ETHZ_Random_forest_classifier_wrapper& other)
+    : data_sptr (new Classifier_base (labels.get_data(), features.get_data()))
+    , labels (labels), features (features)
+  {
+    SWIG_Classification::internal::forest (*data_sptr)
+      = SWIG_Classification::internal::forest (const_cast<Classifier_base&>(other.get_data()));
+  }
+
   void train (typename Point_set_3_wrapper<CGAL_PS3>::Int_iterator ground_truth,
               bool reset_trees = true, int num_trees = 25, int max_depth = 20)
   {
-    data_sptr->train (CGAL::make_range(ground_truth.get_cur(), ground_truth.get_end()),
-                      reset_trees, num_trees, max_depth);
+    detach (!reset_trees);
+    data_sptr->template train<SWIG_Point_set_3::Concurrency_tag>
+      (CGAL::make_range(ground_truth.get_cur(), ground_truth.get_end()),
+       reset_trees, num_trees, max_depth);
+  }
+
+  // Same as train(), ground_truth[i] being the label of the item i (-1 if
+  // unknown). The trees are trained in parallel when linked with TBB. If
+  // max_samples_per_label is positive, the trees are trained by groups (as
+  // many trees as hardware threads), each group on a new random subsample
+  // of at most max_samples_per_label items of each label.
+  void train_from_array (SWIG_CGAL::Buffer<int> ground_truth,
+                         bool reset_trees = true, int num_trees = 25, int max_depth = 20,
+                         int max_samples_per_label = 0, int seed = 0)
+  {
+    if (num_trees <= 0 || max_depth <= 0)
+      throw std::invalid_argument ("The number of trees and the depth must be positive");
+    detach (!reset_trees);
+    const int* gt = ground_truth.data();
+    const std::size_t n = ground_truth.size();
+    if (max_samples_per_label <= 0)
+    {
+      data_sptr->template train<SWIG_Point_set_3::Concurrency_tag>
+        (CGAL::make_range(gt, gt + n), reset_trees, num_trees, max_depth);
+      return;
+    }
+
+    std::vector<std::vector<std::size_t> > items_of_label;
+    for (std::size_t i = 0; i < n; ++ i)
+      if (gt[i] >= 0)
+      {
+        if (std::size_t(gt[i]) >= items_of_label.size())
+          items_of_label.resize (std::size_t(gt[i]) + 1);
+        items_of_label[std::size_t(gt[i])].push_back (i);
+      }
+
+    const std::size_t cap = std::size_t(max_samples_per_label);
+    const std::size_t group = std::size_t (SWIG_CGAL::current_concurrency());
+    std::mt19937 rng (seed);
+    std::vector<int> subsample (n);
+    for (std::size_t done = 0; done < std::size_t(num_trees); done += group)
+    {
+      std::fill (subsample.begin(), subsample.end(), -1);
+      for (std::size_t l = 0; l < items_of_label.size(); ++ l)
+      {
+        std::vector<std::size_t>& items = items_of_label[l];
+        const std::size_t k = (std::min) (cap, items.size());
+        for (std::size_t j = 0; j < k; ++ j) // partial Fisher-Yates shuffle
+        {
+          std::uniform_int_distribution<std::size_t> pick (j, items.size() - 1);
+          std::swap (items[j], items[pick (rng)]);
+          subsample[items[j]] = int(l);
+        }
+      }
+      data_sptr->template train<SWIG_Point_set_3::Concurrency_tag>
+        (subsample, done == 0 && reset_trees,
+         (std::min) (group, std::size_t(num_trees) - done), std::size_t(max_depth));
+    }
   }
 
   void save_configuration (const std::string& filename) const
@@ -46,6 +245,7 @@ public:
   {
 #if defined(CGAL_LINKED_WITH_BOOST_IOSTREAMS) && \
   defined(CGAL_LINKED_WITH_BOOST_SERIALIZATION)
+    detach (false);
     std::ifstream ifile (filename);
     data_sptr->load_configuration (ifile);
 #else
@@ -53,6 +253,37 @@ public:
     std::cerr<<"ERROR: You need boost::iostreams and boost::serialization to use this function. "<<std::endl;
 #endif
   }
+
+  // Same as load_configuration(), the forest being parsed only the first
+  // time the file is loaded in the process: the classifiers loading it
+  // afterwards share this forest (until the file is modified).
+  void load_cached_configuration (const std::string& filename)
+  {
+#if defined(CGAL_LINKED_WITH_BOOST_IOSTREAMS) && \
+  defined(CGAL_LINKED_WITH_BOOST_SERIALIZATION)
+    std::shared_ptr<SWIG_Classification::internal::ETHZ_forest> forest
+      = SWIG_Classification::internal::Forest_cache::instance().get
+      (filename, [&]()
+       {
+         Classifier_base loaded (labels.get_data(), features.get_data());
+         std::ifstream ifile (filename);
+         loaded.load_configuration (ifile);
+         return SWIG_Classification::internal::forest (loaded);
+       });
+    data_sptr = std::make_shared<Classifier_base> (labels.get_data(), features.get_data());
+    SWIG_Classification::internal::forest (*data_sptr) = forest;
+#else
+    CGAL_USE(filename);
+    std::cerr<<"ERROR: You need boost::iostreams and boost::serialization to use this function. "<<std::endl;
+#endif
+  }
+
+  // forgets the forests of load_cached_configuration() (the classifiers
+  // keep theirs)
+  static void clear_configuration_cache()
+  {
+    SWIG_Classification::internal::Forest_cache::instance().clear();
+  }
 };
 
 #endif // SWIG_CGAL_CLASSIFICATION_ETHZ_RANDOM_FOREST_CLASSIFIER_H
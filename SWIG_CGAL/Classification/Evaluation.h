@@ -9,45 +9,224 @@
 #include <CGAL/version.h>
 #include <SWIG_CGAL/Common/Reference_wrapper.h>
 #include <SWIG_CGAL/Common/Macros.h>
+#include <SWIG_CGAL/Common/Buffer.h>
 
 #include <SWIG_CGAL/Point_set_3/Point_set_3.h>
 
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <vector>
 
+#ifndef SWIG
+namespace SWIG_Classification {
+
+// Confusion matrix of a classification, accumulated over any number of
+// ranges of labels: entry (g, r) counts the items of ground truth g
+// classified as r. The items whose ground truth or result is -1 are
+// ignored.
+class Evaluation_counts
+{
+  std::size_t m_nb_labels;
+  std::vector<long long> m_confusion;
+
+public:
+  explicit Evaluation_counts (std::size_t nb_labels)
+    : m_nb_labels (nb_labels), m_confusion (nb_labels * nb_labels, 0) { }
+
+  std::size_t number_of_labels() const { return m_nb_labels; }
+  const std::vector<long long>& confusion() const { return m_confusion; }
+  long long confusion (std::size_t ground_truth, std::size_t result) const
+  {
+    return m_confusion[ground_truth * m_nb_labels + result];
+  }
+
+  template <typename GT_iterator, typename Result_iterator>
+  void append (GT_iterator gt, GT_iterator gt_end, Result_iterator r, Result_iterator r_end)
+  {
+    for (; gt != gt_end && r != r_end; ++ gt, ++ r)
+    {
+      const int g = int(*gt), c = int(*r);
+      if (g == -1 || c == -1)
+        continue;
+      if (g < 0 || c < 0 || std::size_t(g) >= m_nb_labels || std::size_t(c) >= m_nb_labels)
+        throw std::out_of_range ("Invalid label index");
+      ++ m_confusion[std::size_t(g) * m_nb_labels + std::size_t(c)];
+    }
+    if (gt != gt_end || r != r_end)
+      throw std::invalid_argument ("The ground truth and the result must have the same size");
+  }
+
+  void append (const Evaluation_counts& other)
+  {
+    if (other.m_nb_labels != m_nb_labels)
+      throw std::invalid_argument ("The evaluations must have the same number of labels");
+    for (std::size_t i = 0; i < m_confusion.size(); ++ i)
+      m_confusion[i] += other.m_confusion[i];
+  }
+
+  long long number_of_items() const
+  {
+    long long n = 0;
+    for (long long c : m_confusion)
+      n += c;
+    return n;
+  }
+
+  long long true_positives (std::size_t l) const { return confusion (l, l); }
+  long long ground_truth_items (std::size_t l) const
+  {
+    long long n = 0;
+    for (std::size_t r = 0; r < m_nb_labels; ++ r)
+      n += confusion (l, r);
+    return n;
+  }
+  long long result_items (std::size_t l) const
+  {
+    long long n = 0;
+    for (std::size_t g = 0; g < m_nb_labels; ++ g)
+      n += confusion (g, l);
+    return n;
+  }
+
+  // NaN when not defined (no item of the label)
+  static double ratio (long long a, long long b)
+  {
+    return b == 0 ? std::numeric_limits<double>::quiet_NaN() : double(a) / double(b);
+  }
+
+  double precision (std::size_t l) const { return ratio (true_positives(l), result_items(l)); }
+  double recall (std::size_t l) const { return ratio (true_positives(l), ground_truth_items(l)); }
+  double f1_score (std::size_t l) const
+  {
+    return ratio (2 * true_positives(l), result_items(l) + ground_truth_items(l));
+  }
+  double intersection_over_union (std::size_t l) const
+  {
+    return ratio (true_positives(l), result_items(l) + ground_truth_items(l) - true_positives(l));
+  }
+
+  double accuracy() const
+  {
+    long long tp = 0;
+    for (std::size_t l = 0; l < m_nb_labels; ++ l)
+      tp += true_positives(l);
+    return ratio (tp, number_of_items());
+  }
+
+  // means over the labels of the ground truth
+  double mean_f1_score() const { return mean (&Evaluation_counts::f1_score); }
+  double mean_intersection_over_union() const { return mean (&Evaluation_counts::intersection_over_union); }
+
+private:
+  double mean (double (Evaluation_counts::*metric)(std::size_t) const) const
+  {
+    double sum = 0;
+    std::size_t nb = 0;
+    for (std::size_t l = 0; l < m_nb_labels; ++ l)
+      if (ground_truth_items(l) != 0)
+      {
+        sum += (this->*metric)(l);
+        ++ nb;
+      }
+    return nb == 0 ? std::numeric_limits<double>::quiet_NaN() : sum / double(nb);
+  }
+};
+
+} //namespace SWIG_Classification
+#endif
+
+// The metrics come from a confusion matrix computed in one pass over the
+// labels, that can be accumulated over several ranges of labels (tiles...)
+// with append() without keeping them.
 template <typename Evaluation_base, typename Label_set>
 class Evaluation_wrapper
 {
   SWIG_CGAL_INIT_WRAPPER_CLASS (Evaluation_base, data_sptr);
 
+  Label_set labels;
+
+#ifndef SWIG
+  std::size_t index (typename Label_set::Label label) const
+  {
+    for (std::size_t i = 0; i < labels.get_data().size(); ++ i)
+      if (labels.get_data()[i] == label.get_data())
+        return i;
+    throw std::invalid_argument ("The label is not in the label set");
+  }
+#endif
+
 public:
 
   Evaluation_wrapper (Label_set labels,
                       typename Point_set_3_wrapper<CGAL_PS3>::Int_iterator ground_truth,
                       typename Point_set_3_wrapper<CGAL_PS3>::Int_iterator result)
-    : data_sptr (new Evaluation_base (labels.get_data(),
-                                      CGAL::make_range(ground_truth.get_cur(), ground_truth.get_end()),
-                                      CGAL::make_range(result.get_cur(), result.get_end())))
+    : data_sptr (new Evaluation_base (labels.get_data().size())), labels (labels)
+  {
+    append (ground_truth, result);
+  }
+
+  // empty evaluation, filled with append()
+  Evaluation_wrapper (Label_set labels)
+    : data_sptr (new Evaluation_base (labels.get_data().size())), labels (labels)
+  { }
+
+  // ground_truth[i] and result[i] are the label indices of the item i
+  Evaluation_wrapper (Label_set labels,
+                      SWIG_CGAL::Buffer<int> ground_truth,
+                      SWIG_CGAL::Buffer<int> result)
+    : data_sptr (new Evaluation_base (labels.get_data().size())), labels (labels)
+  {
+    append (ground_truth, result);
+  }
+
+  void append (typename Point_set_3_wrapper<CGAL_PS3>::Int_iterator ground_truth,
+               typename Point_set_3_wrapper<CGAL_PS3>::Int_iterator result)
   {
+    data_sptr->append (ground_truth.get_cur(), ground_truth.get_end(),
+                       result.get_cur(), result.get_end());
+  }
 
+  void append (SWIG_CGAL::Buffer<int> ground_truth, SWIG_CGAL::Buffer<int> result)
+  {
+    data_sptr->append (ground_truth.data(), ground_truth.data() + ground_truth.size(),
+                       result.data(), result.data() + result.size());
   }
 
+  // adds the items of another evaluation with the same labels
+  void append (const Evaluation_wrapper& other)
+  {
+    data_sptr->append (other.get_data());
+  }
+
+  // (L, L), entry (g, r) being the number of items of ground truth g
+  // classified as r, in the order of the label set
+  SWIG_CGAL::Buffer<long long> confusion_matrix() const
+  {
+    return SWIG_CGAL::Buffer<long long> (std::vector<long long> (data_sptr->confusion()),
+                                         (std::max) (data_sptr->number_of_labels(), std::size_t(1)));
+  }
+
+  long long number_of_items() const { return data_sptr->number_of_items(); }
+
   double precision (typename Label_set::Label label)
   {
-    return data_sptr->precision (label.get_data());
+    return data_sptr->precision (index (label));
   }
 
   double recall (typename Label_set::Label label)
   {
-    return data_sptr->recall (label.get_data());
+    return data_sptr->recall (index (label));
   }
 
   double f1_score (typename Label_set::Label label)
   {
-    return data_sptr->f1_score (label.get_data());
+    return data_sptr->f1_score (index (label));
   }
 
   double intersection_over_union (typename Label_set::Label label)
   {
-    return data_sptr->intersection_over_union (label.get_data());
+    return data_sptr->intersection_over_union (index (label));
   }
 
   SWIG_CGAL_FORWARD_CALL_0 (double, accuracy)
@@ -8,6 +8,46 @@
 
 #include <SWIG_CGAL/Common/Reference_wrapper.h>
 #include <SWIG_CGAL/Common/Macros.h>
+#include <SWIG_CGAL/Common/Buffer.h>
+#include <SWIG_CGAL/Common/Memory_usage.h>
+
+#include <SWIG_CGAL/Classification/typedefs.h>
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#ifndef SWIG
+#include <CGAL/for_each.h>
+#include <algorithm>
+#include <set>
+#include <utility>
+
+namespace SWIG_Classification {
+
+// Feature whose values are the column `column` of a row-major matrix of
+// `stride` columns, shared by the features made from the same matrix.
+class Array_feature : public CGAL::Classification::Feature_base
+{
+  std::shared_ptr<const std::vector<float> > values;
+  std::size_t stride, column;
+
+public:
+  Array_feature (const std::string& name, std::shared_ptr<const std::vector<float> > values,
+                 std::size_t stride, std::size_t column)
+    : values (values), stride (stride), column (column)
+  {
+    this->set_name (name);
+  }
+
+  float value (std::size_t pt_index) { return (*values)[pt_index * stride + column]; }
+
+  const std::vector<float>& matrix() const { return *values; }
+};
+
+} //namespace SWIG_Classification
+#endif
 
 template <typename Feature_base>
 class Feature_wrapper
@@ -55,6 +95,80 @@ public:
 
   Feature get (int index) { return Feature((*data_sptr)[index]); }
 
+  // Row i is the value of all the features (in the order of the set) for
+  // the item of index i, for i in [0, number_of_items). Filled in parallel.
+  SWIG_CGAL::Buffer<float> to_matrix (int number_of_items) const
+  {
+    if (number_of_items < 0)
+      throw std::invalid_argument ("The number of items must be non-negative");
+    const std::size_t nf = data_sptr->size();
+    const std::size_t n = std::size_t(number_of_items);
+    std::vector<float> values (n * nf);
+    const std::size_t block_size = 4096;
+    std::vector<std::size_t> blocks;
+    for (std::size_t b = 0; b * block_size < n; ++ b)
+      blocks.push_back (b);
+    const Set_base& set = *data_sptr;
+    CGAL::for_each<SWIG_Point_set_3::Concurrency_tag>
+      (blocks, [&](const std::size_t& b) -> bool
+       {
+         const std::size_t end = (std::min)(n, (b + 1) * block_size);
+         for (std::size_t j = 0; j < nf; ++ j)
+         {
+           CGAL::Classification::Feature_base& feature = *(set[j]);
+           for (std::size_t i = b * block_size; i < end; ++ i)
+             values[i * nf + j] = feature.value (i);
+         }
+         return true;
+       });
+    return SWIG_CGAL::Buffer<float> (std::move(values), (std::max)(nf, std::size_t(1)));
+  }
+
+  // Adds a feature whose value for the item i is values[i], copied.
+  Feature add_feature (const std::string& name, SWIG_CGAL::Buffer<float> values)
+  {
+    return Feature (data_sptr->template add<SWIG_Classification::Array_feature>
+                    (name, std::make_shared<const std::vector<float> >(values.data(), values.data() + values.size()),
+                     std::size_t(1), std::size_t(0)));
+  }
+
+  // Adds one feature per column of a row-major matrix (one row per item),
+  // named prefix + "_" + column index. The matrix is copied once and
+  // shared by these features.
+  void add_features (SWIG_CGAL::Buffer<float> matrix, int number_of_columns, const std::string& prefix)
+  {
+    if (number_of_columns <= 0 || matrix.size() % std::size_t(number_of_columns) != 0)
+      throw std::invalid_argument ("The size of the matrix must be a multiple of the number of columns");
+    const std::size_t nc = std::size_t(number_of_columns);
+    std::shared_ptr<const std::vector<float> > values
+      = std::make_shared<const std::vector<float> >(matrix.data(), matrix.data() + matrix.size());
+    for (std::size_t j = 0; j < nc; ++ j)
+      data_sptr->template add<SWIG_Classification::Array_feature> (prefix + "_" + std::to_string(j), values, nc, j);
+  }
+
+  // The values of the features for `number_of_items` items, as properties:
+  // the matrices of the features added from arrays, counted once per
+  // matrix, and one float per item for each feature computed by CGAL (the
+  // structures they share, such as the eigen analysis of the generator, are
+  // not counted).
+  SWIG_CGAL::Memory_usage memory_usage (int number_of_items) const
+  {
+    if (number_of_items < 0)
+      throw std::invalid_argument ("The number of items must be non-negative");
+    std::set<const std::vector<float>*> matrices;
+    std::size_t bytes = 0;
+    for (std::size_t j = 0; j < data_sptr->size(); ++ j)
+    {
+      const SWIG_Classification::Array_feature* feature
+        = dynamic_cast<const SWIG_Classification::Array_feature*> (&*((*data_sptr)[j]));
+      if (feature == nullptr)
+        bytes += std::size_t(number_of_items) * sizeof(float);
+      else if (matrices.insert (&feature->matrix()).second)
+        bytes += SWIG_CGAL::internal::vector_bytes (feature->matrix());
+    }
+    return SWIG_CGAL::Memory_usage (0, bytes);
+  }
+
   bool remove (Feature feature)
   {
     return data_sptr->remove (feature.get_data());
@@ -8,9 +8,21 @@
 
 #include <SWIG_CGAL/Common/Reference_wrapper.h>
 #include <SWIG_CGAL/Common/Macros.h>
+#include <SWIG_CGAL/Common/Buffer.h>
 
 #include <SWIG_CGAL/Point_set_3/Point_set_3.h>
 
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+// Families of features of Point_set_feature_generator::generate_features(),
+// to be combined with |
+enum Feature_family { POINT_BASED_FEATURES = 1, NORMAL_BASED_FEATURES = 2,
+                      COLOR_BASED_FEATURES = 4, ECHO_BASED_FEATURES = 8,
+                      ALL_FEATURE_FAMILIES = 15 };
+
 template <typename Neighborhood_base>
 class Point_set_neighbor_query_wrapper
 {
@@ -23,6 +35,7 @@ protected:
   std::shared_ptr<K_neighbor_query> k_base;
   std::shared_ptr<Sphere_neighbor_query> sphere_base;
   bool use_sphere_;
+  std::shared_ptr<const void> owner_sptr; // keeps the neighborhood alive
 
 public:
 
@@ -33,10 +46,12 @@ public:
         Sphere_neighbor_query& sphere_neighbor_query()       { return *sphere_base; }
   bool use_sphere() const { return use_sphere_; }
 
-  Point_set_neighbor_query_wrapper (const K_neighbor_query& query)
-    : k_base (new K_neighbor_query (query)), use_sphere_ (false) { }
-  Point_set_neighbor_query_wrapper (const Sphere_neighbor_query& query)
-    : sphere_base (new Sphere_neighbor_query (query)), use_sphere_ (true) { }
+  Point_set_neighbor_query_wrapper (const K_neighbor_query& query,
+                                    std::shared_ptr<const void> owner = std::shared_ptr<const void>())
+    : k_base (new K_neighbor_query (query)), use_sphere_ (false), owner_sptr (owner) { }
+  Point_set_neighbor_query_wrapper (const Sphere_neighbor_query& query,
+                                    std::shared_ptr<const void> owner = std::shared_ptr<const void>())
+    : sphere_base (new Sphere_neighbor_query (query)), use_sphere_ (true), owner_sptr (owner) { }
 #endif
 
   Point_set_neighbor_query_wrapper() { }
@@ -47,6 +62,7 @@ class Point_set_neighborhood_wrapper
 {
 protected:
   const Neighborhood_base* data_ptr;
+  std::shared_ptr<const void> owner_sptr; // keeps *data_ptr alive
 
 public:
 
@@ -55,6 +71,9 @@ public:
   const cpp_base& get_data() const { return *data_ptr; }
         cpp_base& get_data()       { return *data_ptr; }
   const cpp_base* ptr() { return data_ptr; }
+
+  Point_set_neighborhood_wrapper (const Neighborhood_base& base, std::shared_ptr<const void> owner)
+    : data_ptr (&base), owner_sptr (owner) { }
 #endif
 
   Point_set_neighborhood_wrapper (const Neighborhood_base& base)
@@ -63,12 +82,12 @@ public:
 
   Point_set_neighbor_query_wrapper<Neighborhood_base> k_neighbor_query (int k)
   {
-    return Point_set_neighbor_query_wrapper<Neighborhood_base> (data_ptr->k_neighbor_query(k));
+    return Point_set_neighbor_query_wrapper<Neighborhood_base> (data_ptr->k_neighbor_query(k), owner_sptr);
   }
 
   Point_set_neighbor_query_wrapper<Neighborhood_base> sphere_neighbor_query (double radius)
   {
-    return Point_set_neighbor_query_wrapper<Neighborhood_base> (data_ptr->sphere_neighbor_query(radius));
+    return Point_set_neighbor_query_wrapper<Neighborhood_base> (data_ptr->sphere_neighbor_query(radius), owner_sptr);
   }
 };
 
@@ -78,34 +97,64 @@ class Point_set_feature_generator_wrapper
   SWIG_CGAL_INIT_WRAPPER_CLASS (Generator_base, data_sptr);
 
 #ifndef SWIG
+  typedef typename Point_set_3_wrapper<CGAL_PS3>::Int_map Int_map;
+  typedef typename Point_set_3_wrapper<CGAL_PS3>::Vector_map Vector_map;
+  typedef typename CGAL_PS3::Point_map Point_map;
+
+  // Colors read once from the three int maps, so that the features do not
+  // go through three property maps for each access.
   class Color_map
   {
-    typename Point_set_3_wrapper<CGAL_PS3>::Int_map r, g, b;
+    std::shared_ptr<const std::vector<CGAL::Color> > colors;
 
   public:
 
     typedef typename CGAL_PS3::Index key_type;
     typedef CGAL::Color value_type;
-    typedef CGAL::Color reference;
+    typedef const CGAL::Color& reference;
     typedef boost::readable_property_map_tag category;
 
     Color_map() { }
-    
-    Color_map (typename Point_set_3_wrapper<CGAL_PS3>::Int_map r,
-               typename Point_set_3_wrapper<CGAL_PS3>::Int_map g,
-               typename Point_set_3_wrapper<CGAL_PS3>::Int_map b)
-      : r(r), g(g), b(b) { }
+
+    Color_map (const CGAL_PS3& points, Int_map r, Int_map g, Int_map b)
+    {
+      std::shared_ptr<std::vector<CGAL::Color> > c = std::make_shared<std::vector<CGAL::Color> >
+        (points.size() + points.number_of_removed_points());
+      for (typename CGAL_PS3::const_iterator it = points.begin(); it != points.end(); ++ it)
+        (*c)[std::size_t(*it)] = CGAL::Color ((unsigned char)(get(r.get_data(), *it)),
+                                              (unsigned char)(get(g.get_data(), *it)),
+                                              (unsigned char)(get(b.get_data(), *it)));
+      colors = c;
+    }
 
     friend reference get (const Color_map& map, const key_type& idx)
     {
-      return CGAL::Color ((unsigned char)(get(map.r.get_data(), idx)),
-                          (unsigned char)(get(map.g.get_data(), idx)),
-                          (unsigned char)(get(map.b.get_data(), idx)));
+      return (*map.colors)[std::size_t(idx)];
     }
   };
+
+  typedef CGAL::Classification::Feature::Eigenvalue Eigenvalue;
+  typedef CGAL::Classification::Feature::Distance_to_plane<CGAL_PS3, Point_map> Distance_to_plane;
+  typedef CGAL::Classification::Feature::Vertical_dispersion<EPIC_Kernel, CGAL_PS3, Point_map> Vertical_dispersion;
+  typedef CGAL::Classification::Feature::Elevation<EPIC_Kernel, CGAL_PS3, Point_map> Elevation;
+  typedef CGAL::Classification::Feature::Height_below<EPIC_Kernel, CGAL_PS3, Point_map> Height_below;
+  typedef CGAL::Classification::Feature::Height_above<EPIC_Kernel, CGAL_PS3, Point_map> Height_above;
+  typedef CGAL::Classification::Feature::Vertical_range<EPIC_Kernel, CGAL_PS3, Point_map> Vertical_range;
+  typedef CGAL::Classification::Feature::Verticality<EPIC_Kernel> Verticality;
+  typedef CGAL::Classification::Feature::Color_channel<EPIC_Kernel, CGAL_PS3, Color_map> Color_channel;
+  typedef CGAL::Classification::Feature::Echo_scatter
+  <EPIC_Kernel, CGAL_PS3, Point_map, typename Int_map::cpp_base> Echo_scatter;
+
+  void check_scale (int scale) const
+  {
+    if (scale < 0 || scale >= int(data_sptr->number_of_scales()))
+      throw std::out_of_range ("Invalid scale");
+  }
 #endif
 
-  Color_map color_map;
+  Point_set_3_wrapper<CGAL_PS3> point_set;
+  std::vector<std::size_t> scales; // selected scales
+  std::shared_ptr<const void> owner_sptr; // keeps the generator and the point set alive
 
 public:
 
@@ -114,18 +163,77 @@ public:
     : data_sptr (new Generator_base (point_set.get_data(),
                                      point_set.get_data().point_map(),
                                      nb_scales, voxel_size))
-  { }
+    , point_set (point_set)
+  {
+    for (std::size_t i = 0; i < data_sptr->number_of_scales(); ++ i)
+      scales.push_back (i);
+    owner_sptr = std::make_shared<std::pair<std::shared_ptr<Generator_base>, std::shared_ptr<CGAL_PS3> > >
+      (data_sptr, this->point_set.shared_ptr());
+  }
 
+  // Restricts the multi-scale features generated afterwards to the given
+  // scales (in [0, number_of_scales())); all the scales if empty.
+  void select_scales (SWIG_CGAL::Buffer<int> selected)
+  {
+    std::vector<std::size_t> s;
+    for (std::size_t i = 0; i < selected.size(); ++ i)
+    {
+      check_scale (selected.data()[i]);
+      s.push_back (std::size_t(selected.data()[i]));
+    }
+    if (s.empty())
+      for (std::size_t i = 0; i < data_sptr->number_of_scales(); ++ i)
+        s.push_back (i);
+    scales.swap (s);
+  }
+
+  int number_of_selected_scales() const { return int(scales.size()); }
+
+  // Generates the families of features (a combination of Feature_family)
+  // whose properties exist in the point set: its normal map, its int maps
+  // "red", "green" and "blue", and its int map "echo". All the features are
+  // computed in parallel (when linked with TBB), so this must not be called
+  // between features.begin_parallel_additions() and end_parallel_additions().
+  void generate_features (Feature_set features, int families = ALL_FEATURE_FAMILIES)
+  {
+    features.begin_parallel_additions();
+    if (families & POINT_BASED_FEATURES)
+      generate_point_based_features (features);
+    if ((families & NORMAL_BASED_FEATURES) && point_set.has_normal_map())
+      generate_normal_based_features (features, point_set.normal_map());
+    if ((families & COLOR_BASED_FEATURES) && point_set.has_int_map ("red")
+        && point_set.has_int_map ("green") && point_set.has_int_map ("blue"))
+      generate_color_based_features (features, point_set.int_map ("red"),
+                                     point_set.int_map ("green"), point_set.int_map ("blue"));
+    if ((families & ECHO_BASED_FEATURES) && point_set.has_int_map ("echo"))
+      generate_echo_based_features (features, point_set.int_map ("echo"));
+    features.end_parallel_additions();
+  }
 
   void generate_point_based_features (Feature_set features)
   {
-    data_sptr->generate_point_based_features (features.get_data());
+    const CGAL_PS3& points = point_set.get_data();
+    const Point_map point_map = points.point_map();
+    for (unsigned int j = 0; j < 3; ++ j)
+      for (std::size_t i : scales)
+        features.get_data().template add_with_scale_id<Eigenvalue> (i, points, data_sptr->eigen(i), j);
+    for (std::size_t i : scales)
+    {
+      features.get_data().template add_with_scale_id<Distance_to_plane> (i, points, point_map, data_sptr->eigen(i));
+      features.get_data().template add_with_scale_id<Vertical_dispersion> (i, points, point_map, data_sptr->grid(i),
+                                                                           data_sptr->radius_neighbors(i));
+      features.get_data().template add_with_scale_id<Elevation> (i, points, point_map, data_sptr->grid(i),
+                                                                 data_sptr->radius_dtm(i));
+      features.get_data().template add_with_scale_id<Height_below> (i, points, point_map, data_sptr->grid(i));
+      features.get_data().template add_with_scale_id<Height_above> (i, points, point_map, data_sptr->grid(i));
+      features.get_data().template add_with_scale_id<Vertical_range> (i, points, point_map, data_sptr->grid(i));
+    }
   }
 
   void generate_normal_based_features (Feature_set features,
                                        typename Point_set_3_wrapper<CGAL_PS3>::Vector_map normal_map)
   {
-    data_sptr->generate_normal_based_features (features.get_data(), normal_map.get_data());
+    features.get_data().template add<Verticality> (point_set.get_data(), normal_map.get_data());
   }
 
   void generate_color_based_features (Feature_set features,
@@ -133,21 +241,36 @@ public:
                                       typename Point_set_3_wrapper<CGAL_PS3>::Int_map green_map,
                                       typename Point_set_3_wrapper<CGAL_PS3>::Int_map blue_map)
   {
-    color_map = Color_map (red_map, green_map, blue_map);
-    data_sptr->generate_color_based_features (features.get_data(), color_map);
+    const Color_map color_map (point_set.get_data(), red_map, green_map, blue_map);
+    for (int i = 0; i < 3; ++ i)
+      features.get_data().template add<Color_channel> (point_set.get_data(), color_map,
+                                                       typename Color_channel::Channel(i));
   }
 
   void generate_echo_based_features (Feature_set features,
                                      typename Point_set_3_wrapper<CGAL_PS3>::Int_map echo_map)
   {
-    data_sptr->generate_echo_based_features (features.get_data(), echo_map.get_data());
+    for (std::size_t i : scales)
+      features.get_data().template add_with_scale_id<Echo_scatter> (i, point_set.get_data(), echo_map.get_data(),
+                                                                    data_sptr->grid(i),
+                                                                    data_sptr->radius_neighbors(i));
   }
 
+  // The neighborhoods computed for the scales stay valid as long as the
+  // queries made from them, even after the generator is destroyed.
   Neighborhood neighborhood (int scale = 0)
   {
-    return Neighborhood (data_sptr->neighborhood(scale));
+    check_scale (scale);
+    return Neighborhood (data_sptr->neighborhood(scale), owner_sptr);
   }
-  
+
+  // the query of the neighbors used by the features at this scale, to be
+  // reused by classify_with_local_smoothing() and classify_with_graphcut()
+  Point_set_neighbor_query_wrapper<CGAL_Point_set_neighborhood> neighbor_query (int scale = 0)
+  {
+    return neighborhood(scale).sphere_neighbor_query (data_sptr->radius_neighbors(scale));
+  }
+
   SWIG_CGAL_FORWARD_CALL_0(int, number_of_scales)
 
   SWIG_CGAL_FORWARD_CALL_1(double, grid_resolution, int)
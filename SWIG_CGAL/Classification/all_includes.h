@@ -14,6 +14,7 @@
 #include <SWIG_CGAL/Classification/ETHZ_Random_forest_classifier.h>
 #include <SWIG_CGAL/Classification/Evaluation.h>
 #include <SWIG_CGAL/Classification/classify.h>
+#include <SWIG_CGAL/Classification/Cluster_set.h>
 
 
 #endif //SWIG_CGAL_CLASSIFICATION_ALL_INCLUDES_H
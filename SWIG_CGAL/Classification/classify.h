@@ -17,6 +17,51 @@
 #include <SWIG_CGAL/Classification/Label_set.h>
 #include <SWIG_CGAL/Classification/Feature_set.h>
 #include <SWIG_CGAL/Classification/ETHZ_Random_forest_classifier.h>
+#include <SWIG_CGAL/Classification/Point_set_feature_generator.h>
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#ifndef SWIG
+#include <CGAL/boost/graph/alpha_expansion_graphcut.h>
+#include <CGAL/for_each.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <utility>
+#endif
+
+enum Alpha_expansion_implementation { ALPHA_EXPANSION_BOOST_ADJACENCY_LIST = 0,
+                                      ALPHA_EXPANSION_BOOST_COMPRESSED_SPARSE_ROW };
+
+// Statistics of classify_with_graphcut_subdivided(). The times of the
+// phases (in seconds) are summed over the subdivisions, which are processed
+// in parallel, total_time() being the elapsed time.
+class Graphcut_statistics
+{
+  int m_number_of_subdivisions;
+  double m_neighborhood_time, m_energy_time, m_graphcut_time, m_total_time;
+
+public:
+  #ifndef SWIG
+  Graphcut_statistics(int number_of_subdivisions, double neighborhood_time, double energy_time,
+                      double graphcut_time, double total_time)
+    : m_number_of_subdivisions(number_of_subdivisions), m_neighborhood_time(neighborhood_time)
+    , m_energy_time(energy_time), m_graphcut_time(graphcut_time), m_total_time(total_time) {}
+  #endif
+
+  //non-empty subdivisions
+  int number_of_subdivisions() const { return m_number_of_subdivisions; }
+  //neighbor queries and edges of the graphs
+  double neighborhood_time() const { return m_neighborhood_time; }
+  //evaluation of the classifier (costs of the labels)
+  double energy_time() const { return m_energy_time; }
+  //alpha expansions
+  double graphcut_time() const { return m_graphcut_time; }
+  double total_time() const { return m_total_time; }
+};
 
 #ifdef CGAL_LINKED_WITH_TBB
 typedef CGAL::Parallel_tag Concurrency_tag;
@@ -88,6 +133,287 @@ void classify_with_graphcut (Point_set_3_wrapper<CGAL_PS3> point_set,
 
 }
 
+// Same as classify_with_graphcut(), the bounding box of the points being
+// divided into squares of subdivision_size x subdivision_size in the xy
+// plane (one subdivision if not positive) instead of being derived from a
+// minimum number of subdivisions. The graph cut of each subdivision is
+// solved with the given Alpha_expansion_implementation, the subdivisions
+// being processed in parallel when linked with TBB.
+Graphcut_statistics
+classify_with_graphcut_subdivided (Point_set_3_wrapper<CGAL_PS3> point_set,
+                                   Label_set_wrapper<CGAL_Label_set, Label_wrapper<CGAL_Label> > labels,
+                                   ETHZ_Random_forest_classifier_wrapper
+                                   <CGAL_ETHZ_Random_forest,
+                                   Label_set_wrapper<CGAL_Label_set, Label_wrapper<CGAL_Label> >,
+                                   Feature_set_wrapper<CGAL_Feature_set, Feature_wrapper<CGAL_Feature> > > classifier,
+                                   Point_set_neighbor_query_wrapper<CGAL_Point_set_neighborhood> neighbor_query,
+                                   double strength,
+                                   double subdivision_size,
+                                   typename Point_set_3_wrapper<CGAL_PS3>::Int_map output,
+                                   int alpha_expansion = ALPHA_EXPANSION_BOOST_ADJACENCY_LIST)
+{
+  typedef std::chrono::steady_clock Clock;
+  typedef typename CGAL_PS3::Index Index;
+  const Clock::time_point start = Clock::now();
+
+  if (alpha_expansion != ALPHA_EXPANSION_BOOST_ADJACENCY_LIST
+      && alpha_expansion != ALPHA_EXPANSION_BOOST_COMPRESSED_SPARSE_ROW)
+    throw std::invalid_argument ("Unknown alpha expansion implementation");
+  const CGAL_PS3& points = point_set.get_data();
+  const std::size_t n = points.size();
+  if (n == 0)
+    return Graphcut_statistics (0, 0, 0, 0, 0);
+
+  double xmin = (std::numeric_limits<double>::max)(), ymin = xmin;
+  double xmax = -xmin, ymax = -xmin;
+  for (const Index& idx : points)
+  {
+    const EPIC_Kernel::Point_3& p = points.point(idx);
+    xmin = (std::min)(xmin, p.x()); xmax = (std::max)(xmax, p.x());
+    ymin = (std::min)(ymin, p.y()); ymax = (std::max)(ymax, p.y());
+  }
+  const std::size_t nx = subdivision_size > 0 ? std::size_t((xmax - xmin) / subdivision_size) + 1 : 1;
+  const std::size_t ny = subdivision_size > 0 ? std::size_t((ymax - ymin) / subdivision_size) + 1 : 1;
+
+  // items of each subdivision, and subdivision and rank in it of each item
+  std::vector<std::vector<std::size_t> > items (nx * ny);
+  std::vector<std::pair<std::size_t, std::size_t> > item_to_subdivision (n);
+  for (std::size_t i = 0; i < n; ++ i)
+  {
+    const EPIC_Kernel::Point_3& p = points.point(*(points.begin() + i));
+    const std::size_t sx = subdivision_size > 0 ? (std::min)(nx - 1, std::size_t((p.x() - xmin) / subdivision_size)) : 0;
+    const std::size_t sy = subdivision_size > 0 ? (std::min)(ny - 1, std::size_t((p.y() - ymin) / subdivision_size)) : 0;
+    const std::size_t sub = sx + nx * sy;
+    item_to_subdivision[i] = std::make_pair (sub, items[sub].size());
+    items[sub].push_back (i);
+  }
+  std::vector<std::size_t> subdivisions;
+  for (std::size_t sub = 0; sub < items.size(); ++ sub)
+    if (!items[sub].empty())
+      subdivisions.push_back (sub);
+
+  std::vector<double> neighborhood_times (items.size(), 0), energy_times (items.size(), 0),
+    graphcut_times (items.size(), 0);
+  const std::size_t nb_labels = labels.get_data().size();
+  const CGAL_ETHZ_Random_forest& forest = classifier.get_data();
+  CGAL::for_each<SWIG_Point_set_3::Concurrency_tag>
+    (subdivisions, [&](const std::size_t& sub) -> bool
+     {
+       const std::vector<std::size_t>& sub_items = items[sub];
+       Clock::time_point t0 = Clock::now();
+
+       std::vector<std::pair<std::size_t, std::size_t> > edges;
+       std::vector<double> edge_weights;
+       std::vector<std::size_t> neighbors;
+       for (std::size_t j = 0; j < sub_items.size(); ++ j)
+       {
+         neighbors.clear();
+         const EPIC_Kernel::Point_3& p = points.point(*(points.begin() + sub_items[j]));
+         if (neighbor_query.use_sphere())
+           neighbor_query.sphere_neighbor_query() (p, std::back_inserter (neighbors));
+         else
+           neighbor_query.k_neighbor_query() (p, std::back_inserter (neighbors));
+         for (std::size_t k : neighbors)
+           if (item_to_subdivision[k].first == sub && item_to_subdivision[k].second != j)
+           {
+             edges.push_back (std::make_pair (j, item_to_subdivision[k].second));
+             edge_weights.push_back (strength);
+           }
+       }
+       Clock::time_point t1 = Clock::now();
+       neighborhood_times[sub] = std::chrono::duration<double>(t1 - t0).count();
+
+       std::vector<std::vector<double> > costs (nb_labels, std::vector<double> (sub_items.size(), 0.));
+       std::vector<std::size_t> assigned_label (sub_items.size(), 0);
+       std::vector<float> values;
+       for (std::size_t j = 0; j < sub_items.size(); ++ j)
+       {
+         forest (sub_items[j], values);
+         float best = 0.f;
+         for (std::size_t l = 0; l < nb_labels; ++ l)
+         {
+           costs[l][j] = -std::log ((std::max) (double(values[l]), 1e-10));
+           if (best < values[l])
+           {
+             best = values[l];
+             assigned_label[j] = l;
+           }
+         }
+       }
+       t0 = Clock::now();
+       energy_times[sub] = std::chrono::duration<double>(t0 - t1).count();
+
+       if (alpha_expansion == ALPHA_EXPANSION_BOOST_COMPRESSED_SPARSE_ROW)
+         CGAL::alpha_expansion_graphcut (edges, edge_weights, costs, assigned_label,
+                                         CGAL::Alpha_expansion_boost_compressed_sparse_row_tag());
+       else
+         CGAL::alpha_expansion_graphcut (edges, edge_weights, costs, assigned_label,
+                                         CGAL::Alpha_expansion_boost_adjacency_list_tag());
+       graphcut_times[sub] = std::chrono::duration<double>(Clock::now() - t0).count();
+
+       for (std::size_t j = 0; j < sub_items.size(); ++ j)
+         output.get_data()[*(points.begin() + sub_items[j])] = int(assigned_label[j]);
+       return true;
+     });
+
+  double neighborhood_time = 0, energy_time = 0, graphcut_time = 0;
+  for (std::size_t sub : subdivisions)
+  {
+    neighborhood_time += neighborhood_times[sub];
+    energy_time += energy_times[sub];
+    graphcut_time += graphcut_times[sub];
+  }
+  return Graphcut_statistics (int(subdivisions.size()), neighborhood_time, energy_time, graphcut_time,
+                              std::chrono::duration<double>(Clock::now() - start).count());
+}
+
+// Classifies a point cloud by tiles of tile_size x tile_size in the xy
+// plane, so that only the features of the tiles being processed are in
+// memory. Each tile is classified with the points within halo of it, and
+// only the labels of its own points are kept. The features of each tile are
+// generated as by Point_set_feature_generator (nb_scales, voxel_size)
+// followed by generate_features(families), which must be how the features
+// used to train the classifier were generated; a positive voxel_size makes
+// the scales the same in all the tiles. With local_smoothing, the
+// classification is smoothed over the neighbors of the first scale. The
+// tiles are processed in parallel when linked with TBB.
+void classify_tiled (Point_set_3_wrapper<CGAL_PS3> point_set,
+                     Label_set_wrapper<CGAL_Label_set, Label_wrapper<CGAL_Label> > labels,
+                     ETHZ_Random_forest_classifier_wrapper
+                     <CGAL_ETHZ_Random_forest,
+                     Label_set_wrapper<CGAL_Label_set, Label_wrapper<CGAL_Label> >,
+                     Feature_set_wrapper<CGAL_Feature_set, Feature_wrapper<CGAL_Feature> > > classifier,
+                     int nb_scales, double voxel_size,
+                     double tile_size, double halo,
+                     typename Point_set_3_wrapper<CGAL_PS3>::Int_map output,
+                     int families = ALL_FEATURE_FAMILIES,
+                     bool local_smoothing = false)
+{
+  typedef Feature_set_wrapper<CGAL_Feature_set, Feature_wrapper<CGAL_Feature> > Feature_set;
+  typedef Point_set_feature_generator_wrapper
+    <CGAL_Point_set_feature_generator, Feature_set,
+     Point_set_neighborhood_wrapper<CGAL_Point_set_neighborhood> > Generator;
+  typedef typename Point_set_3_wrapper<CGAL_PS3>::Int_map Int_map;
+  typedef typename CGAL_PS3::Index Index;
+
+  if (!(tile_size > 0))
+    throw std::invalid_argument ("The size of the tiles must be positive");
+  if (!(halo >= 0))
+    throw std::invalid_argument ("The halo must be non-negative");
+
+  const CGAL_PS3& points = point_set.get_data();
+  if (points.empty())
+    return;
+
+  double xmin = (std::numeric_limits<double>::max)(), ymin = xmin;
+  double xmax = -xmin, ymax = -xmin;
+  for (const Index& idx : points)
+  {
+    const EPIC_Kernel::Point_3& p = points.point(idx);
+    xmin = (std::min)(xmin, p.x()); xmax = (std::max)(xmax, p.x());
+    ymin = (std::min)(ymin, p.y()); ymax = (std::max)(ymax, p.y());
+  }
+  const std::size_t nx = std::size_t((xmax - xmin) / tile_size) + 1;
+  const std::size_t ny = std::size_t((ymax - ymin) / tile_size) + 1;
+  const auto tile_of = [&](const EPIC_Kernel::Point_3& p) -> std::size_t
+  {
+    const std::size_t i = (std::min)(nx - 1, std::size_t((p.x() - xmin) / tile_size));
+    const std::size_t j = (std::min)(ny - 1, std::size_t((p.y() - ymin) / tile_size));
+    return i + nx * j;
+  };
+
+  // indices of the points sorted by tile, those of tile t in [offsets[t], offsets[t+1])
+  std::vector<std::size_t> offsets (nx * ny + 1, 0);
+  for (const Index& idx : points)
+    ++ offsets[tile_of (points.point(idx)) + 1];
+  for (std::size_t t = 0; t < nx * ny; ++ t)
+    offsets[t + 1] += offsets[t];
+  std::vector<Index> sorted (points.size());
+  {
+    std::vector<std::size_t> next (offsets.begin(), offsets.end() - 1);
+    for (const Index& idx : points)
+      sorted[next[tile_of (points.point(idx))] ++] = idx;
+  }
+  std::vector<std::size_t> tiles;
+  for (std::size_t t = 0; t < nx * ny; ++ t)
+    if (offsets[t + 1] > offsets[t])
+      tiles.push_back (t);
+
+  // the properties used by generate_features()
+  const bool with_normals = points.has_normal_map();
+  std::vector<std::string> names;
+  std::vector<Int_map> maps;
+  for (const char* name : { "red", "green", "blue", "echo" })
+    if (point_set.has_int_map (name))
+    {
+      names.push_back (name);
+      maps.push_back (point_set.int_map (name));
+    }
+
+  const std::size_t reach = std::size_t (std::ceil (halo / tile_size));
+  CGAL::for_each<SWIG_Point_set_3::Concurrency_tag>
+    (tiles, [&](const std::size_t& t) -> bool
+     {
+       const std::size_t ti = t % nx, tj = t / nx;
+       const double x0 = xmin + ti * tile_size - halo, x1 = xmin + (ti + 1) * tile_size + halo;
+       const double y0 = ymin + tj * tile_size - halo, y1 = ymin + (tj + 1) * tile_size + halo;
+
+       // the points of the tile, then those of its halo
+       std::vector<Index> items (sorted.begin() + offsets[t], sorted.begin() + offsets[t + 1]);
+       const std::size_t nb_own = items.size();
+       for (std::size_t j = tj - (std::min)(tj, reach); j <= (std::min)(ny - 1, tj + reach); ++ j)
+         for (std::size_t i = ti - (std::min)(ti, reach); i <= (std::min)(nx - 1, ti + reach); ++ i)
+         {
+           const std::size_t other = i + nx * j;
+           if (other == t) continue;
+           for (std::size_t k = offsets[other]; k < offsets[other + 1]; ++ k)
+           {
+             const EPIC_Kernel::Point_3& p = points.point(sorted[k]);
+             if (x0 <= p.x() && p.x() <= x1 && y0 <= p.y() && p.y() <= y1)
+               items.push_back (sorted[k]);
+           }
+         }
+
+       Point_set_3_wrapper<CGAL_PS3> tile (with_normals);
+       CGAL_PS3& tile_points = tile.get_data();
+       tile_points.reserve (items.size());
+       for (const Index& idx : items)
+         if (with_normals)
+           tile_points.insert (points.point(idx), points.normal(idx));
+         else
+           tile_points.insert (points.point(idx));
+       for (std::size_t m = 0; m < names.size(); ++ m)
+       {
+         Int_map map = tile.add_int_map (names[m]);
+         std::size_t k = 0;
+         for (const Index& idx : tile_points)
+           map.get_data()[idx] = maps[m].get_data()[items[k ++]];
+       }
+
+       Feature_set features;
+       Generator generator (tile, nb_scales, voxel_size);
+       generator.generate_features (features, families);
+       // shares the trained forest instead of copying it
+       CGAL_ETHZ_Random_forest tile_classifier (labels.get_data(), features.get_data());
+       SWIG_Classification::internal::forest (tile_classifier)
+         = SWIG_Classification::internal::forest (classifier.get_data());
+
+       std::vector<int> tile_labels (items.size(), -1);
+       if (local_smoothing)
+         CGAL::Classification::classify_with_local_smoothing<CGAL::Sequential_tag>
+           (tile_points, tile_points.point_map(), labels.get_data(), tile_classifier,
+            generator.get_data().neighborhood(0).sphere_neighbor_query (generator.get_data().radius_neighbors(0)),
+            tile_labels);
+       else
+         CGAL::Classification::classify<CGAL::Sequential_tag>
+           (tile_points, labels.get_data(), tile_classifier, tile_labels);
+
+       for (std::size_t k = 0; k < nb_own; ++ k)
+         output.get_data()[items[k]] = tile_labels[k];
+       return true;
+     });
+}
+
 
 #endif // SWIG_CGAL_CLASSIFICATION_H
 
@@ -19,6 +19,5 @@ typedef CGAL::Classification::Point_set_neighborhood
 typedef CGAL::Classification::Point_set_feature_generator
 <EPIC_Kernel, CGAL_PS3, typename CGAL_PS3::Point_map> CGAL_Point_set_feature_generator;
 typedef CGAL::Classification::ETHZ::Random_forest_classifier CGAL_ETHZ_Random_forest;
-typedef CGAL::Classification::Evaluation CGAL_Evaluation;
 
 #endif //SWIG_CGAL_CLASSIFICATION_TYPEDEFS_H
@@ -0,0 +1,107 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+
+#ifndef SWIG_CGAL_COMMON_BUFFER_H
+#define SWIG_CGAL_COMMON_BUFFER_H
+
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace SWIG_CGAL {
+
+// Contiguous row-major block of `rows x cols` values of type T.
+// A view refers to the storage of a wrapped container (no copy is done)
+// and is kept valid by holding a reference on the container. Otherwise the
+// buffer owns its values (result of a computation). Buffers are converted
+// to objects implementing the Python buffer protocol and to java.nio
+// buffers by the typemaps SWIG_CGAL_buffer_of_*_typemap_out.
+template <typename T>
+class Buffer
+{
+  T* m_data;
+  std::size_t m_rows;
+  std::size_t m_cols;
+  bool m_view;
+  bool m_readonly;
+  std::shared_ptr<void> m_owner;
+
+public:
+  typedef T value_type;
+
+  Buffer()
+    : m_data(nullptr), m_rows(0), m_cols(1), m_view(false), m_readonly(false) { }
+
+  // view on external storage, kept alive by `owner`
+  Buffer (T* data, std::size_t rows, std::size_t cols,
+          std::shared_ptr<void> owner, bool readonly = false)
+    : m_data(data), m_rows(rows), m_cols(cols), m_view(true)
+    , m_readonly(readonly), m_owner(owner) { }
+
+  // takes ownership of `values`
+  Buffer (std::vector<T>&& values, std::size_t cols = 1)
+    : m_cols(cols), m_view(false), m_readonly(false)
+  {
+    std::shared_ptr<std::vector<T> > storage
+      = std::make_shared<std::vector<T> >(std::move(values));
+    m_data = storage->empty() ? nullptr : storage->data();
+    m_rows = storage->size() / cols;
+    m_owner = storage;
+  }
+
+  T* data() const { return m_data; }
+  std::size_t rows() const { return m_rows; }
+  std::size_t cols() const { return m_cols; }
+  std::size_t size() const { return m_rows * m_cols; }
+  bool empty() const { return size() == 0; }
+  bool is_view() const { return m_view; }
+  bool is_readonly() const { return m_readonly; }
+  const std::shared_ptr<void>& owner() const { return m_owner; }
+
+  T& operator[] (std::size_t i) const { return m_data[i]; }
+};
+
+// Checks that `out`, given to a function writing its result in place, is
+// writable and holds at least `size` values (it may be larger)
+template <typename T>
+void check_output_buffer (const Buffer<T>& out, std::size_t size, const char* what)
+{
+  if (out.is_readonly())
+    throw std::invalid_argument(std::string("The output buffer of the ") + what + " is read-only");
+  if (out.size() < size)
+    throw std::invalid_argument(std::string("The output buffer of the ") + what + " holds "
+                                + std::to_string(out.size()) + " values, "
+                                + std::to_string(size) + " are needed");
+}
+
+// Description of T used to export a Buffer<T> to the target language.
+// `kind` is 'i' for signed integers, 'u' for unsigned integers and 'f'
+// for floating point values; `format` is the struct module format code.
+template <typename T> struct Buffer_format;
+
+#define SWIG_CGAL_DECLARE_BUFFER_FORMAT(T, KIND, FORMAT)  \
+template <> struct Buffer_format<T> {                     \
+  static char kind() { return KIND; }                     \
+  static const char* format() { return FORMAT; }          \
+};
+
+SWIG_CGAL_DECLARE_BUFFER_FORMAT(double,         'f', "d")
+SWIG_CGAL_DECLARE_BUFFER_FORMAT(float,          'f', "f")
+SWIG_CGAL_DECLARE_BUFFER_FORMAT(int,            'i', "i")
+SWIG_CGAL_DECLARE_BUFFER_FORMAT(long long,      'i', "q")
+SWIG_CGAL_DECLARE_BUFFER_FORMAT(signed char,    'i', "b")
+SWIG_CGAL_DECLARE_BUFFER_FORMAT(unsigned char,  'u', "B")
+SWIG_CGAL_DECLARE_BUFFER_FORMAT(unsigned short, 'u', "H")
+SWIG_CGAL_DECLARE_BUFFER_FORMAT(unsigned int,   'u', "I")
+
+#undef SWIG_CGAL_DECLARE_BUFFER_FORMAT
+
+} // namespace SWIG_CGAL
+
+#endif //SWIG_CGAL_COMMON_BUFFER_H
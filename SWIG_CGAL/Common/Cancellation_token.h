@@ -0,0 +1,71 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+
+#ifndef SWIG_CGAL_COMMON_CANCELLATION_TOKEN_H
+#define SWIG_CGAL_COMMON_CANCELLATION_TOKEN_H
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+
+namespace SWIG_CGAL {
+
+// Flag shared by all the copies of a token, set by cancel() from any thread
+// and polled by the long running functions taking a token. These functions
+// stop as soon as possible and throw, leaving their output partially
+// processed. The progress reported by the last function run with the token
+// is available through progress().
+class Cancellation_token
+{
+#ifndef SWIG
+  struct State
+  {
+    std::atomic<bool> cancelled;
+    std::atomic<double> progress;
+    State() : cancelled(false), progress(0.) { }
+  };
+#endif
+
+  std::shared_ptr<State> m_state;
+
+public:
+
+  Cancellation_token() : m_state(std::make_shared<State>()) { }
+
+  void cancel() { m_state->cancelled = true; }
+  void reset()
+  {
+    m_state->cancelled = false;
+    m_state->progress = 0.;
+  }
+  bool is_cancelled() const { return m_state->cancelled; }
+  // in [0,1]
+  double progress() const { return m_state->progress; }
+
+#ifndef SWIG
+  // functor for the `callback` named parameter of CGAL functions
+  std::function<bool(double)> callback() const
+  {
+    std::shared_ptr<State> state = m_state;
+    return [state](double progress) -> bool
+    {
+      state->progress = progress;
+      return !state->cancelled;
+    };
+  }
+
+  void throw_if_cancelled() const
+  {
+    if (is_cancelled())
+      throw std::runtime_error("Operation cancelled");
+  }
+#endif
+};
+
+} // namespace SWIG_CGAL
+
+#endif //SWIG_CGAL_COMMON_CANCELLATION_TOKEN_H
@@ -0,0 +1,73 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+
+#ifndef SWIG_CGAL_COMMON_FREEZE_STATE_H
+#define SWIG_CGAL_COMMON_FREEZE_STATE_H
+
+#include <atomic>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+
+namespace SWIG_CGAL {
+
+// State of a wrapped search structure (AABB_tree, Kd_tree, triangulations)
+// that can be frozen: freeze() constructs what the queries would otherwise
+// construct lazily, and the member functions modifying the structure throw
+// afterwards, so that it can be queried concurrently from several threads
+// (e.g. from a Java thread pool, or Python threads with the GIL released).
+// The mutex serializes the lazy constructions of a structure not frozen,
+// and the queries that are not thread-safe in CGAL.
+// A copy of a wrapper gets the frozen flag of the original, not its mutex.
+class Freeze_state
+{
+  std::atomic<bool> m_frozen;
+  mutable std::mutex m_mutex;
+
+public:
+  Freeze_state() : m_frozen(false) {}
+  Freeze_state(const Freeze_state& other) : m_frozen(other.is_frozen()) {}
+  Freeze_state& operator=(const Freeze_state& other)
+  {
+    m_frozen.store(other.is_frozen(), std::memory_order_release);
+    return *this;
+  }
+
+  bool is_frozen() const { return m_frozen.load(std::memory_order_acquire); }
+  void set_frozen() { m_frozen.store(true, std::memory_order_release); }
+  std::mutex& mutex() const { return m_mutex; }
+
+  void check_not_frozen(const char* function) const
+  {
+    if (is_frozen())
+      throw std::logic_error(std::string(function) + "() cannot modify a frozen structure");
+  }
+
+  // calls build() under the lock and freezes the structure, unless it is
+  // already frozen
+  template <class F>
+  void freeze(F build)
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (is_frozen()) return;
+    build();
+    set_frozen();
+  }
+
+  // calls build() under the lock unless the structure is frozen, in which
+  // case everything build() constructs is already constructed
+  template <class F>
+  void build_if_not_frozen(F build) const
+  {
+    if (is_frozen()) return;
+    std::lock_guard<std::mutex> lock(m_mutex);
+    build();
+  }
+};
+
+} // namespace SWIG_CGAL
+
+#endif //SWIG_CGAL_COMMON_FREEZE_STATE_H
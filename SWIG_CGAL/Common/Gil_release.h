@@ -0,0 +1,35 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+
+#ifndef SWIG_CGAL_COMMON_GIL_RELEASE_H
+#define SWIG_CGAL_COMMON_GIL_RELEASE_H
+
+namespace SWIG_CGAL {
+
+// Releases the Python GIL during its lifetime, for functions that must read
+// Python inputs (lazy input iterators...) before running, and thus cannot use
+// SWIG_CGAL_release_gil(). The Python API must not be used in its scope.
+// Does nothing for other target languages.
+class Gil_release
+{
+#ifdef SWIGPYTHON
+  PyThreadState* m_state;
+public:
+  Gil_release() : m_state(PyEval_SaveThread()) { }
+  ~Gil_release() { PyEval_RestoreThread(m_state); }
+#else
+public:
+  Gil_release() { }
+#endif
+
+private:
+  Gil_release(const Gil_release&);
+  Gil_release& operator=(const Gil_release&);
+};
+
+} // namespace SWIG_CGAL
+
+#endif //SWIG_CGAL_COMMON_GIL_RELEASE_H
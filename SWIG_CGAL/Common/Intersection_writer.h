@@ -0,0 +1,88 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+
+#ifndef SWIG_CGAL_COMMON_INTERSECTION_WRITER_H
+#define SWIG_CGAL_COMMON_INTERSECTION_WRITER_H
+
+#include <SWIG_CGAL/Common/Variant.h>
+#include <SWIG_CGAL/Kernel/typedefs.h>
+
+namespace SWIG_CGAL {
+
+// Type tags of the intersections reported in arrays by the batched
+// intersection functions: the coordinates of the vertices are given for
+// points, segments and triangles, not for the other types (polygons,
+// lines...)
+enum Intersection_type_tag
+{
+  NO_INTERSECTION = 0,
+  POINT_INTERSECTION = 1,
+  SEGMENT_INTERSECTION = 2,
+  TRIANGLE_INTERSECTION = 3,
+  OTHER_INTERSECTION = 4
+};
+
+// Visitor of the variant of the result of CGAL::intersection() on Epick
+// objects of the given dimension: writes the type tag of the alternative
+// and the coordinates of its vertices (3*dimension values, the values after
+// the last vertex being left unchanged), without any allocation
+template <int dimension>
+struct Intersection_writer
+{
+  typedef void result_type;
+
+  signed char* type;
+  double* coordinates;
+
+  Intersection_writer(signed char* type, double* coordinates)
+    : type(type), coordinates(coordinates) {}
+
+  template <class Point>
+  void write(int k, const Point& p) const
+  {
+    for (int i = 0; i < dimension; ++i)
+      coordinates[dimension * k + i] = p.cartesian(i);
+  }
+
+  void operator()(const EPIC_Kernel::Point_2& p) const { *type = POINT_INTERSECTION; write(0, p); }
+  void operator()(const EPIC_Kernel::Point_3& p) const { *type = POINT_INTERSECTION; write(0, p); }
+
+  template <class Segment>
+  void write_segment(const Segment& s) const
+  {
+    *type = SEGMENT_INTERSECTION;
+    write(0, s.source());
+    write(1, s.target());
+  }
+  void operator()(const EPIC_Kernel::Segment_2& s) const { write_segment(s); }
+  void operator()(const EPIC_Kernel::Segment_3& s) const { write_segment(s); }
+
+  template <class Triangle>
+  void write_triangle(const Triangle& t) const
+  {
+    *type = TRIANGLE_INTERSECTION;
+    for (int k = 0; k < 3; ++k)
+      write(k, t.vertex(k));
+  }
+  void operator()(const EPIC_Kernel::Triangle_2& t) const { write_triangle(t); }
+  void operator()(const EPIC_Kernel::Triangle_3& t) const { write_triangle(t); }
+
+  template <class T>
+  void operator()(const T&) const { *type = OTHER_INTERSECTION; }
+};
+
+// Writes the result of CGAL::intersection() (an optional variant), leaving
+// the type and coordinates unchanged if the objects do not intersect
+template <int dimension, class Result>
+void write_intersection(const Result& result, signed char* type, double* coordinates)
+{
+  if (result)
+    visit(Intersection_writer<dimension>(type, coordinates), *result);
+}
+
+} // namespace SWIG_CGAL
+
+#endif //SWIG_CGAL_COMMON_INTERSECTION_WRITER_H
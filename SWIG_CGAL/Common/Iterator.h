@@ -9,7 +9,10 @@
 
 #include <SWIG_CGAL/Common/Macros.h>
 #include <SWIG_CGAL/Common/triple.h>
+#include <algorithm>
+#include <iterator>
 #include <type_traits>
+#include <utility>
 
 #ifndef SWIG
 template <class T>
@@ -89,17 +92,102 @@ struct Iterator_helper<int>{
   static int default_value(){return -1;}
 };
 
+namespace internal{
+
+template <class T>
+struct Always_void{ typedef void type; };
+
+//Writes the values of an iterator as the rows of an array: row_size
+//scalars per value, row_size being 0 for values that cannot be exported
+template <class T, class Enable = void>
+struct Iterator_array_helper{
+  typedef double Scalar;
+  static const int row_size = 0;
+  static void write(const T&, Scalar*){}
+};
+
+template <>
+struct Iterator_array_helper<double>{
+  typedef double Scalar;
+  static const int row_size = 1;
+  static void write(double t, Scalar* out){ out[0] = t; }
+};
+
+template <>
+struct Iterator_array_helper<int>{
+  typedef int Scalar;
+  static const int row_size = 1;
+  static void write(int t, Scalar* out){ out[0] = t; }
+};
+
+template <>
+struct Iterator_array_helper< SWIG_CGAL::Triple<int,int,int> >{
+  typedef int Scalar;
+  static const int row_size = 3;
+  static void write(const SWIG_CGAL::Triple<int,int,int>& t, Scalar* out)
+  {
+    out[0] = t.first; out[1] = t.second; out[2] = t.third;
+  }
+};
+
+//wrappers of kernel objects given by their Cartesian coordinates
+//(Point_2, Point_3, Vector_2, Vector_3)
+template <class T>
+struct Iterator_array_helper<T, typename Always_void<typename T::cpp_base::Cartesian_const_iterator>::type>{
+  typedef double Scalar;
+  static const int row_size = T::cpp_base::Ambient_dimension::value;
+  static void write(const T& t, Scalar* out)
+  {
+    std::copy(t.get_data().cartesian_begin(), t.get_data().cartesian_end(), out);
+  }
+};
+
+//handles giving the id of their item (the handles of Polyhedron_3), so that
+//iterators over handles are exported as the indices of their items
+template <class T>
+struct Iterator_array_helper<T, typename Always_void<decltype(std::declval<T&>().id())>::type>{
+  typedef int Scalar;
+  static const int row_size = 1;
+  static void write(const T& t, Scalar* out){ out[0] = const_cast<T&>(t).id(); }
+};
+
+} //namespace internal
+
 #endif
 
 
 #ifdef SWIGPYTHON
 #include <SWIG_CGAL/Python/exceptions.h>
+#include <SWIG_CGAL/Python/Buffer.h>
+#include <vector>
 #endif
 
 template<class Cpp_iterator,class Value_type>
 class SWIG_CGAL_Iterator{
   Cpp_iterator cur;
   Cpp_iterator end;
+
+  #if defined(SWIGPYTHON) && !defined(SWIG)
+  PyObject* to_python_array(std::size_t n)
+  {
+    typedef internal::Iterator_array_helper<Value_type> Helper;
+    typedef typename Helper::Scalar Scalar;
+    if (Helper::row_size == 0)
+    {
+      PyErr_SetString(PyExc_TypeError, "The values of this iterator cannot be exported to an array");
+      return nullptr;
+    }
+    std::vector<Scalar> values;
+    values.reserve(n * Helper::row_size);
+    for (std::size_t i = 0; i < n && cur != end; ++i)
+    {
+      values.resize(values.size() + Helper::row_size);
+      Helper::write(Iterator_helper<Value_type>::convert(cur++), &values[values.size() - Helper::row_size]);
+    }
+    return SWIG_CGAL::buffer_to_python(SWIG_CGAL::Buffer<Scalar>(std::move(values), Helper::row_size));
+  }
+  #endif
+
 public:
   typedef SWIG_CGAL_Iterator<Cpp_iterator, Value_type> Self;
 
@@ -131,6 +219,21 @@ public:
     return next();
   }
 
+  //The next n values (fewer if the end is reached before) as the rows of
+  //an array, without creating the Python objects of the values. Only for
+  //iterators over points, vectors, int, double, triples of int, and handles
+  //with an id (exported as their ids).
+  PyObject* next_batch(int n)
+  {
+    return to_python_array(std::size_t(n > 0 ? n : 0));
+  }
+
+  //All the remaining values as the rows of an array (see next_batch())
+  PyObject* to_array()
+  {
+    return to_python_array(std::size_t(std::distance(cur, end)));
+  }
+
   #else
 
   #ifdef SWIGJAVA
@@ -0,0 +1,121 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+
+#ifndef SWIG_CGAL_COMMON_LOCATION_BATCH_H
+#define SWIG_CGAL_COMMON_LOCATION_BATCH_H
+
+#include <SWIG_CGAL/Common/Buffer.h>
+#ifndef SWIG
+#include <SWIG_CGAL/Common/Gil_release.h>
+
+#include <CGAL/for_each.h>
+#include <CGAL/spatial_sort.h>
+#endif
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+// Result of the locate_with_type() functions of the triangulations, returned
+// by value rather than through Reference_wrapper arguments: the cell (or
+// face) containing the query, its Locate_type and the indices li and lj
+// set by the locate() function of CGAL (lj is -1 in 2D).
+template <class Handle, class Locate_type>
+class Location
+{
+  Handle m_handle;
+  Locate_type m_locate_type;
+  int m_li, m_lj;
+
+public:
+  Location() : m_handle(), m_locate_type(Locate_type()), m_li(-1), m_lj(-1) {}
+  Location(const Handle& handle, Locate_type locate_type, int li, int lj = -1)
+    : m_handle(handle), m_locate_type(locate_type), m_li(li), m_lj(lj) {}
+
+  Handle handle() const { return m_handle; }
+  Locate_type locate_type() const { return m_locate_type; }
+  int li() const { return m_li; }
+  int lj() const { return m_lj; }
+};
+
+// Result of the locate_batch() functions of the triangulations: for query i,
+// index_array()[i] is the index of the finite cell (or face) containing it, in
+// the order of the finite cells (or faces) iteration, -1 if it is outside the
+// convex hull; locate_type_array()[i] is its Locate_type.
+class Location_batch
+{
+  std::shared_ptr<std::vector<int> >         indices_sptr;
+  std::shared_ptr<std::vector<signed char> > locate_types_sptr;
+
+public:
+  Location_batch()
+    : indices_sptr(new std::vector<int>())
+    , locate_types_sptr(new std::vector<signed char>()) {}
+  #ifndef SWIG
+  explicit Location_batch(std::size_t n)
+    : indices_sptr(new std::vector<int>(n, -1))
+    , locate_types_sptr(new std::vector<signed char>(n, 0)) {}
+  std::vector<int>&         indices()      { return *indices_sptr; }
+  std::vector<signed char>& locate_types() { return *locate_types_sptr; }
+  #endif
+
+  int size() const { return int(indices_sptr->size()); }
+
+  SWIG_CGAL::Buffer<int> index_array() const
+  {
+    return SWIG_CGAL::Buffer<int>(indices_sptr->data(), indices_sptr->size(), 1,
+                                  indices_sptr, true);
+  }
+  SWIG_CGAL::Buffer<signed char> locate_type_array() const
+  {
+    return SWIG_CGAL::Buffer<signed char>(locate_types_sptr->data(), locate_types_sptr->size(), 1,
+                                          locate_types_sptr, true);
+  }
+};
+
+#ifndef SWIG
+namespace SWIG_CGAL {
+
+// Locates n queries in the order of a Hilbert sort of their points (given by
+// `sort_traits`), each walk starting from the result of the previous query.
+// The sorted queries are processed by chunks, concurrently with
+// CGAL::Parallel_tag. `locate(i, hint, index, type)` locates query i from
+// `hint` (a default constructed handle for the first query of a chunk), writes
+// its index and locate type, and returns the hint of the next query.
+template <class Concurrency_tag, class Hint, class Sort_traits, class Locate>
+Location_batch locate_in_spatial_order(std::size_t n, const Sort_traits& sort_traits,
+                                       const Locate& locate)
+{
+  const std::size_t chunk_size = 1024;
+  Location_batch batch(n);
+  Gil_release gil;
+  std::vector<std::size_t> order(n);
+  for (std::size_t i = 0; i < n; ++i)
+    order[i] = i;
+  CGAL::spatial_sort(order.begin(), order.end(), sort_traits);
+
+  std::vector<std::size_t> chunks;
+  for (std::size_t begin = 0; begin < n; begin += chunk_size)
+    chunks.push_back(begin);
+  std::vector<int>& indices = batch.indices();
+  std::vector<signed char>& types = batch.locate_types();
+  CGAL::for_each<Concurrency_tag>
+    (chunks, [&](std::size_t begin) -> bool
+     {
+       Hint hint = Hint();
+       const std::size_t end = (std::min)(begin + chunk_size, n);
+       for (std::size_t i = begin; i < end; ++i)
+         hint = locate(order[i], hint, indices[order[i]], types[order[i]]);
+       return true;
+     });
+  return batch;
+}
+
+} // namespace SWIG_CGAL
+#endif
+
+#endif //SWIG_CGAL_COMMON_LOCATION_BATCH_H
@@ -268,6 +268,99 @@ SWIG_CGAL_extract_data(T& t)
                                internal::Converter<IN_TYPE_6>::convert(c6)));\
   }
 
+//Same as SWIG_CGAL_FORWARD_CALL_N and SWIG_CGAL_FORWARD_CALL_AND_REF_N, for the
+//member functions modifying a structure that may be frozen (see
+//SWIG_CGAL/Common/Freeze_state.h): this->check_not_frozen(NAME) is called first
+#define SWIG_CGAL_FORWARD_MODIFYING_CALL_0(RET,NAME) \
+  RET NAME(){\
+    this->check_not_frozen(#NAME);\
+    return RET(SWIG_CGAL_extract_data(this->get_data()).NAME());\
+  }
+
+#define SWIG_CGAL_FORWARD_MODIFYING_CALL_1(RET,NAME,IN_TYPE_1) \
+  RET NAME(const IN_TYPE_1& c1){\
+    this->check_not_frozen(#NAME);\
+    return RET(SWIG_CGAL_extract_data(this->get_data()).NAME(internal::Converter<IN_TYPE_1>::convert(c1)));\
+  }
+
+#define SWIG_CGAL_FORWARD_MODIFYING_CALL_AND_REF_1(RET,NAME,IN_TYPE_1) \
+  RET NAME(const IN_TYPE_1& c1){\
+    this->check_not_frozen(#NAME);\
+    return RET(SWIG_CGAL_extract_data(this->get_data()).NAME(internal::Converter<IN_TYPE_1>::convert(c1)));\
+  }\
+  void NAME(const IN_TYPE_1& c1,RET& ret){\
+    this->check_not_frozen(#NAME);\
+    ret = RET(SWIG_CGAL_extract_data(this->get_data()).NAME(internal::Converter<IN_TYPE_1>::convert(c1)));\
+  }
+
+#define SWIG_CGAL_FORWARD_MODIFYING_CALL_2(RET,NAME,IN_TYPE_1,IN_TYPE_2) \
+  RET NAME(const IN_TYPE_1& c1,const IN_TYPE_2& c2){\
+    this->check_not_frozen(#NAME);\
+    return RET(SWIG_CGAL_extract_data(this->get_data()).NAME(internal::Converter<IN_TYPE_1>::convert(c1),internal::Converter<IN_TYPE_2>::convert(c2)));\
+  }
+
+#define SWIG_CGAL_FORWARD_MODIFYING_CALL_AND_REF_2(RET,NAME,IN_TYPE_1,IN_TYPE_2) \
+  RET NAME(const IN_TYPE_1& c1,const IN_TYPE_2& c2){\
+    this->check_not_frozen(#NAME);\
+    return RET(SWIG_CGAL_extract_data(this->get_data()).NAME(internal::Converter<IN_TYPE_1>::convert(c1),internal::Converter<IN_TYPE_2>::convert(c2)));\
+  }\
+  void NAME(const IN_TYPE_1& c1,const IN_TYPE_2& c2,RET& ret){\
+    this->check_not_frozen(#NAME);\
+    ret = RET(SWIG_CGAL_extract_data(this->get_data()).NAME(internal::Converter<IN_TYPE_1>::convert(c1),internal::Converter<IN_TYPE_2>::convert(c2)));\
+  }
+
+#define SWIG_CGAL_FORWARD_MODIFYING_CALL_3(RET,NAME,IN_TYPE_1,IN_TYPE_2,IN_TYPE_3) \
+  RET NAME(const IN_TYPE_1& c1,const IN_TYPE_2& c2,const IN_TYPE_3& c3){\
+    this->check_not_frozen(#NAME);\
+    return RET(SWIG_CGAL_extract_data(this->get_data()).NAME(internal::Converter<IN_TYPE_1>::convert(c1),internal::Converter<IN_TYPE_2>::convert(c2),internal::Converter<IN_TYPE_3>::convert(c3)));\
+  }
+
+#define SWIG_CGAL_FORWARD_MODIFYING_CALL_AND_REF_3(RET,NAME,IN_TYPE_1,IN_TYPE_2,IN_TYPE_3) \
+  RET NAME(const IN_TYPE_1& c1,const IN_TYPE_2& c2,const IN_TYPE_3& c3){\
+    this->check_not_frozen(#NAME);\
+    return RET(SWIG_CGAL_extract_data(this->get_data()).NAME(internal::Converter<IN_TYPE_1>::convert(c1),internal::Converter<IN_TYPE_2>::convert(c2),internal::Converter<IN_TYPE_3>::convert(c3)));\
+  }\
+  void NAME(const IN_TYPE_1& c1,const IN_TYPE_2& c2,const IN_TYPE_3& c3,RET& ret){\
+    this->check_not_frozen(#NAME);\
+    ret = RET(SWIG_CGAL_extract_data(this->get_data()).NAME(internal::Converter<IN_TYPE_1>::convert(c1),internal::Converter<IN_TYPE_2>::convert(c2),internal::Converter<IN_TYPE_3>::convert(c3)));\
+  }
+
+#define SWIG_CGAL_FORWARD_MODIFYING_CALL_AND_REF_4(RET,NAME,IN_TYPE_1,IN_TYPE_2,IN_TYPE_3,IN_TYPE_4) \
+  RET NAME(const IN_TYPE_1& c1,const IN_TYPE_2& c2,const IN_TYPE_3& c3,const IN_TYPE_4& c4){\
+    this->check_not_frozen(#NAME);\
+    return RET(SWIG_CGAL_extract_data(this->get_data()).NAME(internal::Converter<IN_TYPE_1>::convert(c1),internal::Converter<IN_TYPE_2>::convert(c2),internal::Converter<IN_TYPE_3>::convert(c3),internal::Converter<IN_TYPE_4>::convert(c4)));\
+  }\
+  void NAME(const IN_TYPE_1& c1,const IN_TYPE_2& c2,const IN_TYPE_3& c3,const IN_TYPE_4& c4,RET& ret){\
+    this->check_not_frozen(#NAME);\
+    ret = RET(SWIG_CGAL_extract_data(this->get_data()).NAME(internal::Converter<IN_TYPE_1>::convert(c1),internal::Converter<IN_TYPE_2>::convert(c2),internal::Converter<IN_TYPE_3>::convert(c3),internal::Converter<IN_TYPE_4>::convert(c4)));\
+  }
+//---------------------------------------------------------------------------
+
+//Binary state of a class (see SWIG_CGAL/Common/Shared_memory.h) defining
+//  void write_state(std::ostream&);
+//  void read_state(const char* data, std::size_t size,
+//                  const std::shared_ptr<boost::interprocess::mapped_region>& region);
+//where `region` is the mapping of the shared memory segment holding the
+//bytes, null otherwise (the bytes are then valid during the call only)
+#define SWIG_CGAL_BINARY_STATE_FUNCTIONS \
+  SWIG_CGAL::Buffer<unsigned char> save_state(){\
+    std::ostringstream os(std::ios::binary);\
+    write_state(os);\
+    return SWIG_CGAL::state_buffer(os.str());\
+  }\
+  void load_state(SWIG_CGAL::Buffer<unsigned char> state){\
+    read_state(reinterpret_cast<const char*>(state.data()), state.size(), nullptr);\
+  }\
+  std::string to_shared_memory(){\
+    std::ostringstream os(std::ios::binary);\
+    write_state(os);\
+    return SWIG_CGAL::write_shared_memory(os.str());\
+  }\
+  void load_shared_memory(const std::string& name){\
+    std::shared_ptr<boost::interprocess::mapped_region> region = SWIG_CGAL::map_shared_memory(name);\
+    read_state(static_cast<const char*>(region->get_address()), region->get_size(), region);\
+  }
+
 // Macro to ease the initialization of wrapper classes
 #ifdef SWIG
 
@@ -0,0 +1,124 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+
+#ifndef SWIG_CGAL_COMMON_MEMORY_USAGE_H
+#define SWIG_CGAL_COMMON_MEMORY_USAGE_H
+
+#include <cstddef>
+#include <vector>
+
+#ifndef SWIG
+#include <CGAL/Bbox_3.h>
+
+namespace CGAL {
+template <typename AABBTraits> class AABB_tree;
+}
+#endif
+
+namespace SWIG_CGAL {
+
+// Bytes held by a wrapped container, returned by its memory_usage():
+//   structure():    the items and their points (vertices, faces, cells,
+//                   primitives...), with the capacity not used yet
+//   properties():   the values attached to the items (property columns,
+//                   features, curves and corners of a complex...)
+//   search_index(): the search structures owned by the container (the
+//                   hierarchy of an AABB tree, the nodes of a kd-tree...)
+//   caches():       the structures built on demand and kept for the next
+//                   calls (see Polyhedron_3.clear_cache()), released
+//                   without losing data
+// The figures are computed from the sizes and capacities of the arrays and
+// the sizes of their items, without the overhead of the allocator. Those
+// of the structures of CGAL whose arrays are not accessible (kd-trees, AABB
+// trees) are estimates of their size once built.
+class Memory_usage
+{
+  std::size_t m_structure, m_properties, m_search_index, m_caches;
+
+public:
+  Memory_usage(std::size_t structure = 0, std::size_t properties = 0,
+               std::size_t search_index = 0, std::size_t caches = 0)
+    : m_structure(structure), m_properties(properties)
+    , m_search_index(search_index), m_caches(caches) {}
+
+  std::size_t structure() const { return m_structure; }
+  std::size_t properties() const { return m_properties; }
+  std::size_t search_index() const { return m_search_index; }
+  std::size_t caches() const { return m_caches; }
+  std::size_t total() const { return m_structure + m_properties + m_search_index + m_caches; }
+
+#ifndef SWIG
+  Memory_usage& operator+=(const Memory_usage& other)
+  {
+    m_structure += other.m_structure;
+    m_properties += other.m_properties;
+    m_search_index += other.m_search_index;
+    m_caches += other.m_caches;
+    return *this;
+  }
+#endif
+};
+
+#ifndef SWIG
+namespace internal {
+
+template <class T, class Allocator>
+std::size_t vector_bytes(const std::vector<T, Allocator>& v)
+{
+  return v.capacity() * sizeof(T);
+}
+
+// the items of a CGAL::Compact_container (vertices and cells of the
+// triangulations), free slots included
+template <class Container>
+std::size_t compact_container_bytes(const Container& c)
+{
+  return std::size_t(c.capacity()) * sizeof(typename Container::value_type);
+}
+
+// a CGAL::Kd_tree: the points as structure, the array of pointers to the
+// points and the nodes as search index once the tree is built, with leaves
+// half full on average
+template <class Tree>
+Memory_usage kd_tree_memory_usage(const Tree& tree)
+{
+  const std::size_t n = std::size_t(tree.size());
+  Memory_usage usage(n * sizeof(typename Tree::Point_d));
+  if (n == 0 || !tree.is_built())
+    return usage;
+  const std::size_t bucket_size = (std::size_t(typename Tree::Splitter().bucket_size()) + 1) / 2;
+  const std::size_t leaves = (n + bucket_size - 1) / bucket_size;
+  return Memory_usage(usage.structure(), 0,
+                      n * sizeof(const void*) + leaves * sizeof(typename Tree::Leaf_node)
+                        + (leaves - 1) * sizeof(typename Tree::Internal_node));
+}
+
+// a CGAL::AABB_tree: the primitives as structure, the nodes of the hierarchy
+// and the points of the search tree of the distance queries as search index,
+// both being counted as built
+template <class Traits>
+Memory_usage memory_usage_of(const CGAL::AABB_tree<Traits>& tree)
+{
+  typedef CGAL::AABB_tree<Traits> Tree;
+  const std::size_t n = tree.size();
+  const std::size_t nodes = n > 1 ? (n - 1) * (sizeof(CGAL::Bbox_3) + 2 * sizeof(void*)) : 0;
+  const std::size_t search_tree = n * (sizeof(typename Tree::Point_and_primitive_id) + sizeof(void*));
+  return Memory_usage(sizeof(Tree) + n * sizeof(typename Tree::Primitive), 0, nodes + search_tree);
+}
+
+// the objects without a more precise count
+template <class T>
+Memory_usage memory_usage_of(const T&)
+{
+  return Memory_usage(sizeof(T));
+}
+
+} // namespace internal
+#endif
+
+} // namespace SWIG_CGAL
+
+#endif //SWIG_CGAL_COMMON_MEMORY_USAGE_H
@@ -0,0 +1,870 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+
+#ifndef SWIG_CGAL_COMMON_MESH_FILE_H
+#define SWIG_CGAL_COMMON_MESH_FILE_H
+
+#include <CGAL/for_each.h>
+#include <CGAL/tags.h>
+
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+#if __cplusplus >= 201703L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L)
+#include <charconv>
+#endif
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/parallel_sort.h>
+#endif
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <locale>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace SWIG_CGAL {
+
+// Vertices and facets of a polygon mesh read from or written to a file:
+// (V,3) coordinates and facets in compressed sparse rows, facet f having the
+// vertices indices[offsets[f]] to indices[offsets[f+1]-1].
+struct Mesh_arrays
+{
+  std::vector<double> vertices;
+  std::vector<int> offsets;
+  std::vector<int> indices;
+
+  std::size_t number_of_vertices() const {return vertices.size()/3;}
+  std::size_t number_of_faces() const {return offsets.empty() ? 0 : offsets.size()-1;}
+};
+
+namespace mesh_file {
+
+#ifdef CGAL_LINKED_WITH_TBB
+typedef CGAL::Parallel_tag Concurrency_tag;
+#else
+typedef CGAL::Sequential_tag Concurrency_tag;
+#endif
+
+// bytes of text parsed by a task, cut at the next end of line
+const std::size_t chunk_size = std::size_t(1) << 22;
+
+inline std::string extension(const std::string& filename)
+{
+  std::string::size_type dot = filename.find_last_of('.');
+  std::string out = dot==std::string::npos ? std::string() : filename.substr(dot+1);
+  std::transform(out.begin(), out.end(), out.begin(), [](unsigned char c){ return char(std::tolower(c)); });
+  return out;
+}
+
+inline bool is_blank(char c)
+{
+  return c==' ' || c=='\t' || c=='\r' || c=='\v' || c=='\f';
+}
+
+inline const char* skip_blanks(const char* p, const char* end)
+{
+  while (p!=end && is_blank(*p)) ++p;
+  return p;
+}
+
+// skips the spaces and the ends of line
+inline const char* skip_spaces(const char* p, const char* end)
+{
+  while (p!=end && (is_blank(*p) || *p=='\n')) ++p;
+  return p;
+}
+
+inline const char* skip_token(const char* p, const char* end)
+{
+  while (p!=end && !is_blank(*p) && *p!='\n') ++p;
+  return p;
+}
+
+inline const char* end_of_line(const char* p, const char* end)
+{
+  const char* eol = static_cast<const char*>(std::memchr(p, '\n', std::size_t(end-p)));
+  return eol==nullptr ? end : eol;
+}
+
+// the number at p, nullptr if there is none. Doubles are parsed with
+// std::from_chars when the standard library has it, with a stream in the
+// classic locale otherwise: both ignore the LC_NUMERIC of the process.
+inline const char* parse_double(const char* p, const char* end, double& out)
+{
+  if (p!=end && *p=='+') ++p;
+#if defined(__cpp_lib_to_chars)
+  std::from_chars_result r = std::from_chars(p, end, out);
+  return r.ec==std::errc() ? r.ptr : nullptr;
+#else
+  std::size_t n=0;
+  while (p+n!=end && n<63 && !is_blank(p[n]) && p[n]!='\n')
+    ++n;
+  // one stream per thread, the chunks being parsed in parallel
+  static thread_local std::istringstream in = []() {
+    std::istringstream stream;
+    stream.imbue(std::locale::classic());
+    return stream;
+  }();
+  in.clear();
+  in.str(std::string(p, n));
+  if (!(in >> out)) return nullptr;
+  const std::streamoff used = in.eof() ? std::streamoff(n) : std::streamoff(in.tellg());
+  return p+used;
+#endif
+}
+
+inline const char* parse_int(const char* p, const char* end, long long& out)
+{
+  bool negative=false;
+  if (p!=end && (*p=='-' || *p=='+'))
+  {
+    negative = *p=='-';
+    ++p;
+  }
+  if (p==end || *p<'0' || *p>'9') return nullptr;
+  long long v=0;
+  for (; p!=end && *p>='0' && *p<='9'; ++p)
+  {
+    v=10*v+(*p-'0');
+    if (v>(long long)(1)<<40)
+      return nullptr;
+  }
+  out = negative ? -v : v;
+  return p;
+}
+
+inline std::runtime_error parse_error(const std::string& what, const char* base, const char* p)
+{
+  return std::runtime_error(what + " at byte " + std::to_string(p-base));
+}
+
+// splits [begin, end) into pieces of about chunk_size bytes starting at
+// the beginning of a line
+inline std::vector<const char*> line_chunks(const char* begin, const char* end)
+{
+  std::vector<const char*> bounds(1, begin);
+  while (end-bounds.back()>std::ptrdiff_t(chunk_size))
+  {
+    const char* eol = end_of_line(bounds.back()+chunk_size, end);
+    if (eol==end) break;
+    bounds.push_back(eol+1);
+  }
+  bounds.push_back(end);
+  return bounds;
+}
+
+// facets parsed by a task, with the vertices of OBJ files
+struct Chunk
+{
+  std::vector<double> vertices;
+  std::vector<int> degrees;
+  std::vector<int> indices;
+  // positions in indices of the OBJ relative indices, to be shifted by the
+  // number of vertices of the previous chunks
+  std::vector<std::size_t> relative;
+  std::size_t nb_lines;
+  Chunk() : nb_lines(0) {}
+};
+
+// calls f(i) for i in [0, n), concurrently if linked with TBB
+template <class F>
+void for_each_index(std::size_t n, const F& f)
+{
+  std::vector<std::size_t> ids(n);
+  for (std::size_t i=0; i<n; ++i) ids[i]=i;
+  CGAL::for_each<Concurrency_tag>(ids, [&](const std::size_t& i) -> bool
+  {
+    f(i);
+    return true;
+  });
+}
+
+// concatenates the vertices (if with_vertices) and the facets of the chunks
+inline void gather(std::vector<Chunk>& chunks, Mesh_arrays& mesh, bool with_vertices)
+{
+  std::vector<std::size_t> vertex_start(chunks.size()+1, 0), face_start(chunks.size()+1, 0),
+                           index_start(chunks.size()+1, 0);
+  for (std::size_t i=0; i<chunks.size(); ++i)
+  {
+    vertex_start[i+1]=vertex_start[i]+chunks[i].vertices.size();
+    face_start[i+1]=face_start[i]+chunks[i].degrees.size();
+    index_start[i+1]=index_start[i]+chunks[i].indices.size();
+  }
+  const std::size_t max_int = std::size_t(std::numeric_limits<int>::max());
+  if (index_start.back()>max_int || vertex_start.back()/3>max_int)
+    throw std::runtime_error("The mesh is too large");
+  if (with_vertices)
+    mesh.vertices.resize(vertex_start.back());
+  mesh.offsets.resize(face_start.back()+1);
+  mesh.indices.resize(index_start.back());
+  mesh.offsets[0]=0;
+  for_each_index(chunks.size(), [&](std::size_t i)
+  {
+    Chunk& chunk = chunks[i];
+    if (with_vertices)
+      std::copy(chunk.vertices.begin(), chunk.vertices.end(), mesh.vertices.begin()+vertex_start[i]);
+    for (std::size_t r : chunk.relative)
+      chunk.indices[r]+=int(vertex_start[i]/3);
+    std::copy(chunk.indices.begin(), chunk.indices.end(), mesh.indices.begin()+index_start[i]);
+    int offset=int(index_start[i]);
+    for (std::size_t f=0; f<chunk.degrees.size(); ++f)
+    {
+      offset+=chunk.degrees[f];
+      mesh.offsets[face_start[i]+f+1]=offset;
+    }
+    std::vector<double>().swap(chunk.vertices);
+    std::vector<int>().swap(chunk.indices);
+  });
+}
+
+// Wavefront OBJ: the vertices ("v x y z") and the vertex indices of the
+// facets ("f i j/vt/vn k..."), 1-based or negative (relative), the other
+// lines being ignored.
+inline void read_obj(const char* base, std::size_t size, Mesh_arrays& mesh)
+{
+  const std::vector<const char*> bounds = line_chunks(base, base+size);
+  std::vector<Chunk> chunks(bounds.size()-1);
+  for_each_index(chunks.size(), [&](std::size_t i)
+  {
+    Chunk& chunk = chunks[i];
+    const char* end = bounds[i+1];
+    for (const char* p=bounds[i]; p<end; )
+    {
+      const char* eol = end_of_line(p, end);
+      p = skip_blanks(p, eol);
+      if (eol-p>1 && p[0]=='v' && is_blank(p[1]))
+      {
+        p+=2;
+        for (int c=0; c<3; ++c)
+        {
+          double x;
+          p = parse_double(skip_blanks(p, eol), eol, x);
+          if (p==nullptr)
+            throw parse_error("Invalid OBJ vertex", base, eol);
+          chunk.vertices.push_back(x);
+        }
+      }
+      else if (eol-p>1 && p[0]=='f' && is_blank(p[1]))
+      {
+        int degree=0;
+        for (p=skip_blanks(p+2, eol); p!=eol; p=skip_blanks(skip_token(p, eol), eol))
+        {
+          long long id;
+          if (parse_int(p, eol, id)==nullptr || id==0)
+            throw parse_error("Invalid OBJ facet", base, p);
+          if (id<0)
+          {
+            chunk.relative.push_back(chunk.indices.size());
+            chunk.indices.push_back(int(chunk.vertices.size()/3+id));
+          }
+          else
+            chunk.indices.push_back(int(id-1));
+          ++degree;
+        }
+        chunk.degrees.push_back(degree);
+      }
+      if (eol==end) break;
+      p=eol+1;
+    }
+  });
+  gather(chunks, mesh, true);
+}
+
+inline bool is_data_line(const char* p, const char* eol)
+{
+  p=skip_blanks(p, eol);
+  return p!=eol && *p!='#';
+}
+
+// Text OFF with one vertex or facet per line: the counts are read first,
+// then the lines are counted and parsed by chunks.
+inline void read_off(const char* base, std::size_t size, Mesh_arrays& mesh)
+{
+  const char* end = base+size;
+  const char* p = base;
+  const char* eol = end_of_line(p, end);
+  while (eol!=end && !is_data_line(p, eol))
+  {
+    p=eol+1;
+    eol=end_of_line(p, end);
+  }
+  p=skip_blanks(p, eol);
+  const char* keyword_end = skip_token(p, eol);
+  if (keyword_end-p<3 || std::strncmp(keyword_end-3, "OFF", 3)!=0)
+    throw std::runtime_error("Not an OFF file");
+  if (keyword_end-p>3 && (keyword_end[-4]=='4' || (keyword_end-p>4 && keyword_end[-4]=='n')))
+    throw std::runtime_error("Only OFF files of 3D points are supported");
+  p=skip_blanks(keyword_end, eol);
+  if (p!=eol && *p=='B')
+    throw std::runtime_error("Binary OFF files are not supported");
+  long long counts[2];
+  for (int c=0; c<2; ++c)
+  {
+    p=skip_spaces(p, end);
+    while (p!=end && *p=='#')
+      p=skip_spaces(end_of_line(p, end), end);
+    if ((p=parse_int(p, end, counts[c]))==nullptr || counts[c]<0)
+      throw std::runtime_error("Invalid OFF header");
+  }
+  p=end_of_line(p, end);
+  p+=(p!=end);
+  const std::size_t nb_vertices=std::size_t(counts[0]), nb_faces=std::size_t(counts[1]);
+
+  const std::vector<const char*> bounds = line_chunks(p, end);
+  std::vector<Chunk> chunks(bounds.size()-1);
+  for_each_index(chunks.size(), [&](std::size_t i)
+  {
+    Chunk& chunk = chunks[i];
+    for (const char* q=bounds[i]; q<bounds[i+1]; )
+    {
+      const char* eol = end_of_line(q, bounds[i+1]);
+      chunk.nb_lines+=is_data_line(q, eol);
+      if (eol==bounds[i+1]) break;
+      q=eol+1;
+    }
+  });
+  std::size_t first_line=0;
+  std::vector<std::size_t> first_lines(chunks.size());
+  for (std::size_t i=0; i<chunks.size(); ++i)
+  {
+    first_lines[i]=first_line;
+    first_line+=chunks[i].nb_lines;
+  }
+  if (first_line<nb_vertices+nb_faces)
+    throw std::runtime_error("Truncated OFF file");
+
+  mesh.vertices.resize(3*nb_vertices);
+  for_each_index(chunks.size(), [&](std::size_t i)
+  {
+    Chunk& chunk = chunks[i];
+    std::size_t line=first_lines[i];
+    for (const char* q=bounds[i]; q<bounds[i+1] && line<nb_vertices+nb_faces; )
+    {
+      const char* eol = end_of_line(q, bounds[i+1]);
+      if (is_data_line(q, eol))
+      {
+        q=skip_blanks(q, eol);
+        if (line<nb_vertices)
+        {
+          for (int c=0; c<3; ++c)
+          {
+            q=parse_double(skip_blanks(q, eol), eol, mesh.vertices[3*line+c]);
+            if (q==nullptr)
+              throw parse_error("Invalid OFF vertex", base, eol);
+          }
+        }
+        else
+        {
+          long long degree;
+          if ((q=parse_int(q, eol, degree))==nullptr || degree<0)
+            throw parse_error("Invalid OFF facet", base, eol);
+          for (long long v=0; v<degree; ++v)
+          {
+            long long id;
+            if ((q=parse_int(skip_blanks(q, eol), eol, id))==nullptr)
+              throw parse_error("Invalid OFF facet", base, eol);
+            chunk.indices.push_back(int(id));
+          }
+          chunk.degrees.push_back(int(degree));
+        }
+        ++line;
+      }
+      if (eol==bounds[i+1]) break;
+      q=eol+1;
+    }
+  });
+  gather(chunks, mesh, false);
+}
+
+inline bool little_endian_host()
+{
+  const std::uint16_t one=1;
+  unsigned char first;
+  std::memcpy(&first, &one, 1);
+  return first==1;
+}
+
+// the value of type T at p, whose bytes are in reverse order if swap
+template <class T>
+T load(const char* p, bool swap)
+{
+  char bytes[sizeof(T)];
+  std::memcpy(bytes, p, sizeof(T));
+  if (swap) std::reverse(bytes, bytes+sizeof(T));
+  T t;
+  std::memcpy(&t, bytes, sizeof(T));
+  return t;
+}
+
+template <class T>
+void store(char*& p, T t, bool swap)
+{
+  std::memcpy(p, &t, sizeof(T));
+  if (swap) std::reverse(p, p+sizeof(T));
+  p+=sizeof(T);
+}
+
+// Binary STL: the triangles are read in parallel and the vertices with
+// the same coordinates merged. ASCII STL files are read line by line.
+inline void merge_corners(std::vector<float>& corners, Mesh_arrays& mesh)
+{
+  const std::size_t nb_corners = corners.size()/3;
+  if (nb_corners>std::size_t(std::numeric_limits<int>::max()))
+    throw std::runtime_error("The mesh is too large");
+  std::vector<int> order(nb_corners);
+  for (std::size_t i=0; i<nb_corners; ++i) order[i]=int(i);
+  auto less = [&](int a, int b)
+  {
+    return std::lexicographical_compare(&corners[3*a], &corners[3*a]+3, &corners[3*b], &corners[3*b]+3);
+  };
+#ifdef CGAL_LINKED_WITH_TBB
+  tbb::parallel_sort(order.begin(), order.end(), less);
+#else
+  std::sort(order.begin(), order.end(), less);
+#endif
+  mesh.indices.resize(nb_corners);
+  mesh.vertices.clear();
+  for (std::size_t i=0; i<nb_corners; ++i)
+  {
+    if (i==0 || less(order[i-1], order[i]))
+      mesh.vertices.insert(mesh.vertices.end(), &corners[3*order[i]], &corners[3*order[i]]+3);
+    mesh.indices[order[i]]=int(mesh.vertices.size()/3-1);
+  }
+  mesh.offsets.resize(nb_corners/3+1);
+  for (std::size_t f=0; f<mesh.offsets.size(); ++f)
+    mesh.offsets[f]=int(3*f);
+}
+
+inline void read_stl(const char* base, std::size_t size, Mesh_arrays& mesh)
+{
+  std::vector<float> corners;
+  const std::size_t nb_triangles = size>=84 ? load<std::uint32_t>(base+80, !little_endian_host()) : 0;
+  if (size>=84 && size==84+50*nb_triangles)
+  {
+    corners.resize(9*nb_triangles);
+    for_each_index((nb_triangles+65535)/65536, [&](std::size_t i)
+    {
+      const bool swap = !little_endian_host();
+      for (std::size_t t=65536*i; t<(std::min)(nb_triangles, 65536*(i+1)); ++t)
+        for (int c=0; c<9; ++c)
+          corners[9*t+c]=load<float>(base+84+50*t+12+4*c, swap);
+    });
+  }
+  else
+  {
+    const char* end = base+size;
+    for (const char* p=base; p<end; )
+    {
+      const char* eol = end_of_line(p, end);
+      p=skip_blanks(p, eol);
+      if (eol-p>6 && std::strncmp(p, "vertex", 6)==0 && is_blank(p[6]))
+      {
+        p+=6;
+        for (int c=0; c<3; ++c)
+        {
+          double x;
+          if ((p=parse_double(skip_blanks(p, eol), eol, x))==nullptr)
+            throw parse_error("Invalid STL vertex", base, eol);
+          corners.push_back(float(x));
+        }
+      }
+      if (eol==end) break;
+      p=eol+1;
+    }
+    if (corners.size()%9!=0)
+      throw std::runtime_error("Invalid STL file");
+  }
+  merge_corners(corners, mesh);
+}
+
+// PLY (ASCII or binary): the x, y, z properties of the "vertex" element and
+// the "vertex_indices" (or "vertex_index") list of the "face" element, the
+// other properties and elements being skipped.
+struct Ply_property
+{
+  std::string name;
+  char type;       // type of the value, or of the items of a list
+  char count_type; // 0 if not a list
+};
+
+struct Ply_element
+{
+  std::string name;
+  std::size_t count;
+  std::vector<Ply_property> properties;
+};
+
+inline char ply_type(const std::string& t)
+{
+  if (t=="char" || t=="int8") return 'c';
+  if (t=="uchar" || t=="uint8") return 'C';
+  if (t=="short" || t=="int16") return 's';
+  if (t=="ushort" || t=="uint16") return 'S';
+  if (t=="int" || t=="int32") return 'i';
+  if (t=="uint" || t=="uint32") return 'I';
+  if (t=="float" || t=="float32") return 'f';
+  if (t=="double" || t=="float64") return 'd';
+  throw std::runtime_error("Unknown PLY type " + t);
+}
+
+inline std::size_t ply_size(char type)
+{
+  switch (type)
+  {
+    case 'c': case 'C': return 1;
+    case 's': case 'S': return 2;
+    case 'd': return 8;
+    default: return 4;
+  }
+}
+
+inline double ply_value(const char* p, char type, bool swap)
+{
+  switch (type)
+  {
+    case 'c': return double(load<std::int8_t>(p, swap));
+    case 'C': return double(load<std::uint8_t>(p, swap));
+    case 's': return double(load<std::int16_t>(p, swap));
+    case 'S': return double(load<std::uint16_t>(p, swap));
+    case 'i': return double(load<std::int32_t>(p, swap));
+    case 'I': return double(load<std::uint32_t>(p, swap));
+    case 'f': return double(load<float>(p, swap));
+    default: return load<double>(p, swap);
+  }
+}
+
+inline void read_ply(const char* base, std::size_t size, Mesh_arrays& mesh)
+{
+  const char* end = base+size;
+  const char* p = base;
+  std::string format;
+  std::vector<Ply_element> elements;
+  bool header_end=false;
+  for (bool first=true; p<end && !header_end; first=false)
+  {
+    const char* eol = end_of_line(p, end);
+    std::string line(p, eol);
+    if (!line.empty() && line.back()=='\r') line.pop_back();
+    p=eol+1;
+    std::vector<std::string> words;
+    for (const char* w=skip_blanks(line.data(), line.data()+line.size()); w!=line.data()+line.size(); )
+    {
+      const char* e = skip_token(w, line.data()+line.size());
+      words.push_back(std::string(w, e));
+      w=skip_blanks(e, line.data()+line.size());
+    }
+    if (first && (words.size()!=1 || words[0]!="ply"))
+      throw std::runtime_error("Not a PLY file");
+    if (words.empty() || first) continue;
+    if (words[0]=="format" && words.size()>1)
+      format=words[1];
+    else if (words[0]=="element" && words.size()==3)
+    {
+      Ply_element element;
+      element.name=words[1];
+      element.count=std::strtoull(words[2].c_str(), nullptr, 10);
+      elements.push_back(element);
+    }
+    else if (words[0]=="property" && !elements.empty())
+    {
+      Ply_property property;
+      if (words.size()==5 && words[1]=="list")
+      {
+        property.count_type=ply_type(words[2]);
+        property.type=ply_type(words[3]);
+        property.name=words[4];
+      }
+      else if (words.size()==3)
+      {
+        property.count_type=0;
+        property.type=ply_type(words[1]);
+        property.name=words[2];
+      }
+      else
+        throw std::runtime_error("Invalid PLY property: " + line);
+      elements.back().properties.push_back(property);
+    }
+    else if (words[0]=="end_header")
+      header_end=true;
+  }
+  if (!header_end)
+    throw std::runtime_error("Invalid PLY header");
+  const bool ascii = format=="ascii";
+  if (!ascii && format!="binary_little_endian" && format!="binary_big_endian")
+    throw std::runtime_error("Unknown PLY format " + format);
+  const bool swap = !ascii && ((format=="binary_little_endian")!=little_endian_host());
+
+  // reads the next value, text or binary
+  auto next = [&](char type) -> double
+  {
+    double v;
+    if (ascii)
+    {
+      p=skip_spaces(p, end);
+      if ((p=parse_double(p, end, v))==nullptr)
+        throw parse_error("Invalid PLY value", base, end);
+      return v;
+    }
+    if (std::size_t(end-p)<ply_size(type))
+      throw std::runtime_error("Truncated PLY file");
+    v=ply_value(p, type, swap);
+    p+=ply_size(type);
+    return v;
+  };
+
+  mesh.offsets.assign(1, 0);
+  for (const Ply_element& element : elements)
+  {
+    const bool is_vertex = element.name=="vertex", is_face = element.name=="face";
+    int xyz[3] = {-1, -1, -1};
+    int face_indices = -1;
+    bool fixed_size=true;
+    std::size_t stride=0;
+    std::vector<std::size_t> offset_of(element.properties.size());
+    for (std::size_t k=0; k<element.properties.size(); ++k)
+    {
+      const Ply_property& property = element.properties[k];
+      offset_of[k]=stride;
+      stride+=ply_size(property.type);
+      fixed_size = fixed_size && property.count_type==0;
+      for (int c=0; c<3; ++c)
+        if (property.name==std::string(1, char('x'+c)) && property.count_type==0) xyz[c]=int(k);
+      if ((property.name=="vertex_indices" || property.name=="vertex_index") && property.count_type!=0)
+        face_indices=int(k);
+    }
+    if (is_vertex && (xyz[0]<0 || xyz[1]<0 || xyz[2]<0))
+      throw std::runtime_error("The PLY vertices have no x, y, z properties");
+    if (is_vertex)
+      mesh.vertices.resize(3*element.count);
+
+    if (!ascii && fixed_size)
+    {
+      // fixed size records: the vertices are read in parallel
+      if (std::size_t(end-p)/(stride==0 ? 1 : stride)<element.count)
+        throw std::runtime_error("Truncated PLY file");
+      if (is_vertex)
+      {
+        for_each_index((element.count+65535)/65536, [&](std::size_t i)
+        {
+          for (std::size_t v=65536*i; v<(std::min)(element.count, 65536*(i+1)); ++v)
+            for (int c=0; c<3; ++c)
+              mesh.vertices[3*v+c]=ply_value(p+v*stride+offset_of[xyz[c]],
+                                             element.properties[xyz[c]].type, swap);
+        });
+      }
+      p+=element.count*stride;
+      continue;
+    }
+    for (std::size_t r=0; r<element.count; ++r)
+    {
+      for (std::size_t k=0; k<element.properties.size(); ++k)
+      {
+        const Ply_property& property = element.properties[k];
+        if (property.count_type==0)
+        {
+          double v=next(property.type);
+          if (is_vertex)
+            for (int c=0; c<3; ++c)
+              if (int(k)==xyz[c]) mesh.vertices[3*r+c]=v;
+          continue;
+        }
+        const double count=next(property.count_type);
+        if (count<0)
+          throw std::runtime_error("Invalid PLY list");
+        const bool indices = is_face && int(k)==face_indices;
+        for (std::size_t j=0; j<std::size_t(count); ++j)
+        {
+          double v=next(property.type);
+          if (indices) mesh.indices.push_back(int(v));
+        }
+        if (indices)
+        {
+          if (mesh.indices.size()>std::size_t(std::numeric_limits<int>::max()))
+            throw std::runtime_error("The mesh is too large");
+          mesh.offsets.push_back(int(mesh.indices.size()));
+        }
+      }
+    }
+  }
+}
+
+inline void read_mesh_file(const std::string& filename, Mesh_arrays& mesh)
+{
+  const std::string format = extension(filename);
+  if (format!="off" && format!="obj" && format!="ply" && format!="stl")
+    throw std::invalid_argument("Unknown mesh file extension " + format
+                                + ", possible values are off, obj, ply or stl");
+  mesh = Mesh_arrays();
+  std::ifstream test(filename.c_str());
+  if (!test)
+    throw std::runtime_error("Cannot open " + filename);
+  test.seekg(0, std::ios::end);
+  if (test.tellg()==std::streampos(0))
+    throw std::runtime_error("Empty file " + filename);
+  test.close();
+  boost::interprocess::file_mapping file(filename.c_str(), boost::interprocess::read_only);
+  boost::interprocess::mapped_region region(file, boost::interprocess::read_only);
+  const char* base = static_cast<const char*>(region.get_address());
+  const std::size_t size = region.get_size();
+  if (format=="off") read_off(base, size, mesh);
+  else if (format=="obj") read_obj(base, size, mesh);
+  else if (format=="ply") read_ply(base, size, mesh);
+  else read_stl(base, size, mesh);
+  if (mesh.offsets.empty())
+    mesh.offsets.push_back(0);
+}
+
+// Text of the items [0, n) formatted by write(i, out) by blocks in
+// parallel, then written in order.
+template <class F>
+void write_text(std::ostream& os, std::size_t n, const F& write)
+{
+  const std::size_t block=65536;
+  const std::size_t nb_blocks=(n+block-1)/block;
+  for (std::size_t first=0; first<nb_blocks; first+=64)
+  {
+    // a few blocks at a time, to bound the memory used
+    std::vector<std::string> texts((std::min)(nb_blocks-first, std::size_t(64)));
+    for_each_index(texts.size(), [&](std::size_t i)
+    {
+      std::string& text = texts[i];
+      for (std::size_t item=(first+i)*block; item<(std::min)(n, (first+i+1)*block); ++item)
+        write(item, text);
+    });
+    for (const std::string& text : texts)
+      os.write(text.data(), std::streamsize(text.size()));
+  }
+}
+
+inline void append_double(std::string& text, double x, int precision)
+{
+  char buffer[32];
+  int n=std::snprintf(buffer, sizeof(buffer), "%.*g", precision, x);
+  text.append(buffer, std::size_t(n));
+}
+
+inline void append_int(std::string& text, long long i)
+{
+  char buffer[24];
+  int n=std::snprintf(buffer, sizeof(buffer), "%lld", i);
+  text.append(buffer, std::size_t(n));
+}
+
+// Writes `mesh` as text OFF or OBJ (the coordinates with `precision`
+// significant digits, 17 for a lossless round trip), binary PLY (native
+// byte order, double coordinates) or binary STL (triangles only). Returns
+// false if the file cannot be written.
+inline bool write_mesh_file(const std::string& filename, const Mesh_arrays& mesh, int precision=17)
+{
+  const std::string format = extension(filename);
+  if (format!="off" && format!="obj" && format!="ply" && format!="stl")
+    throw std::invalid_argument("Unknown mesh file extension " + format
+                                + ", possible values are off, obj, ply or stl");
+  const std::size_t nv=mesh.number_of_vertices(), nf=mesh.number_of_faces();
+  if (format=="stl")
+    for (std::size_t f=0; f<nf; ++f)
+      if (mesh.offsets[f+1]-mesh.offsets[f]!=3)
+        throw std::invalid_argument("STL files only hold triangles");
+  std::ofstream os(filename.c_str(), std::ios_base::binary);
+  if (!os) return false;
+
+  if (format=="off" || format=="obj")
+  {
+    const bool obj = format=="obj";
+    if (!obj)
+      os << "OFF\n" << nv << ' ' << nf << " 0\n";
+    write_text(os, nv, [&](std::size_t v, std::string& text)
+    {
+      text += obj ? "v " : "";
+      for (int c=0; c<3; ++c)
+      {
+        if (c>0) text+=' ';
+        append_double(text, mesh.vertices[3*v+c], precision);
+      }
+      text+='\n';
+    });
+    write_text(os, nf, [&](std::size_t f, std::string& text)
+    {
+      if (obj)
+        text+='f';
+      else
+        append_int(text, mesh.offsets[f+1]-mesh.offsets[f]);
+      for (int i=mesh.offsets[f]; i<mesh.offsets[f+1]; ++i)
+      {
+        text+=' ';
+        append_int(text, mesh.indices[i]+(obj ? 1 : 0));
+      }
+      text+='\n';
+    });
+    return bool(os);
+  }
+
+  if (format=="ply")
+  {
+    os << "ply\nformat " << (little_endian_host() ? "binary_little_endian" : "binary_big_endian")
+       << " 1.0\ncomment written by the CGAL bindings\nelement vertex " << nv
+       << "\nproperty double x\nproperty double y\nproperty double z\nelement face " << nf
+       << "\nproperty list uchar int vertex_indices\nend_header\n";
+    os.write(reinterpret_cast<const char*>(mesh.vertices.data()), std::streamsize(8*mesh.vertices.size()));
+    std::vector<char> faces(nf+4*mesh.indices.size());
+    char* out=faces.data();
+    for (std::size_t f=0; f<nf; ++f)
+    {
+      const int degree = mesh.offsets[f+1]-mesh.offsets[f];
+      if (degree>255)
+        throw std::invalid_argument("PLY facets have at most 255 vertices");
+      store(out, std::uint8_t(degree), false);
+      for (int i=mesh.offsets[f]; i<mesh.offsets[f+1]; ++i)
+        store(out, std::int32_t(mesh.indices[i]), false);
+    }
+    os.write(faces.data(), std::streamsize(faces.size()));
+    return bool(os);
+  }
+
+  const bool swap = !little_endian_host();
+  std::vector<char> bytes(84+50*nf, 0);
+  std::strncpy(bytes.data(), "binary STL written by the CGAL bindings", 80);
+  char* out=bytes.data()+80;
+  store(out, std::uint32_t(nf), swap);
+  for (std::size_t f=0; f<nf; ++f)
+  {
+    const double* a=&mesh.vertices[3*mesh.indices[3*f]];
+    const double* b=&mesh.vertices[3*mesh.indices[3*f+1]];
+    const double* c=&mesh.vertices[3*mesh.indices[3*f+2]];
+    double n[3] = {(b[1]-a[1])*(c[2]-a[2])-(b[2]-a[2])*(c[1]-a[1]),
+                   (b[2]-a[2])*(c[0]-a[0])-(b[0]-a[0])*(c[2]-a[2]),
+                   (b[0]-a[0])*(c[1]-a[1])-(b[1]-a[1])*(c[0]-a[0])};
+    const double length=std::sqrt(n[0]*n[0]+n[1]*n[1]+n[2]*n[2]);
+    for (int k=0; k<3; ++k)
+      store(out, float(length>0 ? n[k]/length : 0.), swap);
+    for (const double* v : {a, b, c})
+      for (int k=0; k<3; ++k)
+        store(out, float(v[k]), swap);
+    store(out, std::uint16_t(0), swap);
+  }
+  os.write(bytes.data(), std::streamsize(bytes.size()));
+  return bool(os);
+}
+
+} // namespace mesh_file
+
+using mesh_file::read_mesh_file;
+using mesh_file::write_mesh_file;
+
+} // namespace SWIG_CGAL
+
+#endif //SWIG_CGAL_COMMON_MESH_FILE_H
@@ -0,0 +1,128 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+
+#ifndef SWIG_CGAL_COMMON_SAMPLED_GRID_H
+#define SWIG_CGAL_COMMON_SAMPLED_GRID_H
+
+#include <SWIG_CGAL/Common/Buffer.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+namespace SWIG_CGAL {
+
+// Values sampled on a regular grid of dimension D: the sample of grid
+// coordinates (i_0,...,i_{D-1}) is at origin + (i_0*spacing[0], ...) and is
+// the value of index i_0 + dims[0]*(i_1 + dims[1]*(...)) (the first axis
+// varying fastest). The values are copied.
+template <int D>
+class Sampled_grid
+{
+  std::vector<double> m_values;
+  int m_dims[D];
+  double m_origin[D];
+  double m_spacing[D];
+
+  std::size_t stride(int d) const
+  {
+    std::size_t s = 1;
+    for (int e = 0; e < d; ++e)
+      s *= std::size_t(m_dims[e]);
+    return s;
+  }
+
+public:
+  Sampled_grid(const Buffer<double>& values, const int dims[D],
+               const double origin[D], const double spacing[D])
+  {
+    std::size_t n = 1;
+    for (int d = 0; d < D; ++d)
+    {
+      if (dims[d] < 1)
+        throw std::invalid_argument("The grid dimensions must be positive");
+      if (!(spacing[d] > 0))
+        throw std::invalid_argument("The grid spacings must be positive");
+      n *= std::size_t(dims[d]);
+      m_dims[d] = dims[d];
+      m_origin[d] = origin[d];
+      m_spacing[d] = spacing[d];
+    }
+    if (values.size() != n)
+      throw std::invalid_argument("The number of values must be the number of grid samples");
+    m_values.assign(values.data(), values.data() + n);
+  }
+
+  // multilinear interpolation of the samples at c, the points out of the grid
+  // taking the value of the nearest point of the grid
+  double value(const double c[D]) const
+  {
+    std::size_t base = 0;
+    std::size_t offsets[D];
+    double t[D];
+    for (int d = 0; d < D; ++d)
+    {
+      const double g = (std::min)((std::max)((c[d] - m_origin[d]) / m_spacing[d], 0.),
+                                  double(m_dims[d] - 1));
+      int n = int(std::floor(g));
+      if (n > m_dims[d] - 2) n = (std::max)(m_dims[d] - 2, 0);
+      t[d] = g - n;
+      base += std::size_t(n) * stride(d);
+      offsets[d] = (n + 1 < m_dims[d]) ? stride(d) : 0;
+    }
+    double result = 0;
+    for (int corner = 0; corner < (1 << D); ++corner)
+    {
+      std::size_t index = base;
+      double weight = 1;
+      for (int d = 0; d < D; ++d)
+        if (corner & (1 << d))
+        {
+          index += offsets[d];
+          weight *= t[d];
+        }
+        else
+          weight *= 1 - t[d];
+      if (weight != 0)
+        result += weight * m_values[index];
+    }
+    return result;
+  }
+
+  // Lowers the samples so that two neighboring samples along an axis differ
+  // by at most k times their distance: each sample becomes the minimum over
+  // the samples s of value(s) + k * (distance from s along the grid axes).
+  // As the L1 distance is separable, this is done exactly with a forward and
+  // a backward pass along each axis.
+  void make_lipschitz(double k)
+  {
+    if (!(k > 0))
+      throw std::invalid_argument("The Lipschitz constant must be positive");
+    const std::size_t n = m_values.size();
+    for (int d = 0; d < D; ++d)
+    {
+      const std::size_t s = stride(d);
+      const std::size_t line = s * std::size_t(m_dims[d]);
+      const double step = k * m_spacing[d];
+      for (std::size_t i = 0; i < n; ++i)
+      {
+        if ((i % line) < s) continue; // first sample of its line along d
+        m_values[i] = (std::min)(m_values[i], m_values[i - s] + step);
+      }
+      for (std::size_t i = n; i-- > 0;)
+      {
+        if ((i % line) + s >= line) continue; // last sample of its line along d
+        m_values[i] = (std::min)(m_values[i], m_values[i + s] + step);
+      }
+    }
+  }
+};
+
+} //namespace SWIG_CGAL
+
+#endif //SWIG_CGAL_COMMON_SAMPLED_GRID_H
@@ -0,0 +1,154 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+
+#ifndef SWIG_CGAL_COMMON_SHARED_MEMORY_H
+#define SWIG_CGAL_COMMON_SHARED_MEMORY_H
+
+#include <string>
+
+#ifndef SWIG
+#include <SWIG_CGAL/Common/Buffer.h>
+
+#include <boost/interprocess/mapped_region.hpp>
+#include <boost/interprocess/shared_memory_object.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <limits>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <streambuf>
+#include <vector>
+#endif
+
+namespace SWIG_CGAL {
+
+// Binary states of the wrapped objects, used to pickle them and to pass them
+// to other processes through named shared memory segments:
+//   save_state()              the state as an array of bytes
+//   load_state(state)         replaces the object by the one of `state`
+//   to_shared_memory()        writes the state in a new segment, returns its name
+//   load_shared_memory(name)  load_state() reading the segment in place
+// The structures made of flat arrays (Flat_AABB_tree_3, Mapped_point_set_3)
+// are used directly in the pages of the segment, read-only, by all the
+// processes attached to it. A segment lives until remove_shared_memory() is
+// called, even after the process that created it has exited.
+inline bool remove_shared_memory (const std::string& name)
+{
+  return boost::interprocess::shared_memory_object::remove (name.c_str());
+}
+
+#ifndef SWIG
+namespace internal {
+
+// short enough for the 31 characters limit of macOS
+inline std::string new_shared_memory_name()
+{
+  static std::atomic<unsigned> counter (0);
+  std::random_device random;
+  std::ostringstream name;
+  name << "CGAL_" << std::hex << random() << '_' << counter++;
+  return name.str();
+}
+
+} // namespace internal
+
+// copies `size` bytes in a new segment and returns its name
+inline std::string write_shared_memory (const char* data, std::size_t size)
+{
+  using namespace boost::interprocess;
+  const std::string name = internal::new_shared_memory_name();
+  shared_memory_object segment (create_only, name.c_str(), read_write);
+  try
+  {
+    segment.truncate (offset_t(size));
+    mapped_region region (segment, read_write);
+    std::memcpy (region.get_address(), data, size);
+  }
+  catch (...)
+  {
+    shared_memory_object::remove (name.c_str());
+    throw;
+  }
+  return name;
+}
+
+inline std::string write_shared_memory (const std::string& bytes)
+{
+  return write_shared_memory (bytes.data(), bytes.size());
+}
+
+// read-only mapping of the segment `name`, kept alive by the result
+inline std::shared_ptr<boost::interprocess::mapped_region>
+map_shared_memory (const std::string& name)
+{
+  using namespace boost::interprocess;
+  shared_memory_object segment (open_only, name.c_str(), read_only);
+  return std::make_shared<mapped_region> (segment, read_only);
+}
+
+// the bytes written in a std::ostringstream, as returned by save_state()
+inline Buffer<unsigned char> state_buffer (const std::string& bytes)
+{
+  return Buffer<unsigned char> (std::vector<unsigned char> (bytes.begin(), bytes.end()));
+}
+
+// std::istream reading `size` bytes at `data` in place
+class Memory_istream : private std::streambuf, public std::istream
+{
+public:
+  Memory_istream (const void* data, std::size_t size)
+    : std::istream (static_cast<std::streambuf*>(this))
+  {
+    char* begin = const_cast<char*> (static_cast<const char*>(data));
+    setg (begin, begin, begin + size);
+  }
+};
+
+// Arrays of a binary state: an uint64 size followed by the raw values
+template <typename T>
+void write_state_array (std::ostream& os, const T* values, std::size_t size)
+{
+  std::uint64_t n = size;
+  os.write (reinterpret_cast<const char*>(&n), sizeof(n));
+  os.write (reinterpret_cast<const char*>(values), std::streamsize(size * sizeof(T)));
+}
+
+template <typename T>
+void read_state_array (std::istream& is, std::vector<T>& values)
+{
+  std::uint64_t n = 0;
+  is.read (reinterpret_cast<char*>(&n), sizeof(n));
+  if (!is || n > std::uint64_t(std::numeric_limits<std::streamsize>::max()) / sizeof(T))
+    throw std::runtime_error("Truncated binary state");
+  values.resize (std::size_t(n));
+  is.read (reinterpret_cast<char*>(values.data()), std::streamsize(n * sizeof(T)));
+  if (!is)
+    throw std::runtime_error("Truncated binary state");
+}
+
+// magic number of 8 characters at the beginning of a binary state
+inline void write_state_magic (std::ostream& os, const char* magic)
+{
+  os.write (magic, 8);
+}
+
+inline void read_state_magic (std::istream& is, const char* magic, const char* what)
+{
+  char header[8];
+  is.read (header, 8);
+  if (!is || std::memcmp (header, magic, 8) != 0)
+    throw std::runtime_error(std::string("Not the binary state of a ") + what);
+}
+#endif
+
+} // namespace SWIG_CGAL
+
+#endif //SWIG_CGAL_COMMON_SHARED_MEMORY_H
@@ -0,0 +1,168 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+
+#ifndef SWIG_CGAL_COMMON_SPACE_FILLING_CURVE_H
+#define SWIG_CGAL_COMMON_SPACE_FILLING_CURVE_H
+
+#include <CGAL/for_each.h>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/parallel_sort.h>
+#endif
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace SWIG_CGAL {
+
+// bits per coordinate of the keys of 3D cells
+const int curve_bits = 21;
+
+// Position of the cell (x,y,z), coordinates of curve_bits bits, along the
+// Morton (Z-order) curve: the bits of the coordinates interleaved
+inline std::uint64_t morton_key(std::uint32_t x, std::uint32_t y, std::uint32_t z)
+{
+  std::uint64_t key = 0;
+  for (int b = curve_bits - 1; b >= 0; --b)
+    key = (key << 3) | (((x >> b) & 1u) << 2) | (((y >> b) & 1u) << 1) | ((z >> b) & 1u);
+  return key;
+}
+
+// Position of the cell (x,y,z) along the Hilbert curve, from the transposed
+// form of its index of J. Skilling, "Programming the Hilbert curve" (2004)
+inline std::uint64_t hilbert_key(std::uint32_t x, std::uint32_t y, std::uint32_t z)
+{
+  std::uint32_t c[3] = {x, y, z};
+  const std::uint32_t top = 1u << (curve_bits - 1);
+  for (std::uint32_t q = top; q > 1; q >>= 1)
+  {
+    const std::uint32_t p = q - 1;
+    for (int i = 0; i < 3; ++i)
+    {
+      if (c[i] & q)
+        c[0] ^= p;
+      else
+      {
+        const std::uint32_t t = (c[0] ^ c[i]) & p;
+        c[0] ^= t;
+        c[i] ^= t;
+      }
+    }
+  }
+  c[1] ^= c[0];
+  c[2] ^= c[1];
+  std::uint32_t t = 0;
+  for (std::uint32_t q = top; q > 1; q >>= 1)
+    if (c[2] & q)
+      t ^= q - 1;
+  for (int i = 0; i < 3; ++i)
+    c[i] ^= t;
+  return morton_key(c[0], c[1], c[2]);
+}
+
+// Cube of side `extent` at `min` containing points, split in cells of
+// curve_bits bits per coordinate
+struct Curve_cube
+{
+  double min[3];
+  double extent;
+
+  // integer coordinates of the cell of p, clamped to the cube
+  void cell(const double* p, std::uint32_t* c) const
+  {
+    const double largest = double((1u << curve_bits) - 1);
+    const double scale = extent > 0 ? largest / extent : 0;
+    for (int i = 0; i < 3; ++i)
+      c[i] = std::uint32_t((std::max)((std::min)((p[i] - min[i]) * scale, largest), 0.));
+  }
+};
+
+// smallest cube with the corner of the bounding box of the `n` points,
+// `point(i)` giving the coordinates (double[3]) of point i
+template <class Point_coordinates>
+Curve_cube bounding_cube(std::size_t n, const Point_coordinates& point)
+{
+  double min[3], max[3];
+  for (int i = 0; i < 3; ++i)
+  {
+    min[i] = (std::numeric_limits<double>::max)();
+    max[i] = -(std::numeric_limits<double>::max)();
+  }
+  for (std::size_t k = 0; k < n; ++k)
+  {
+    const double* p = point(k);
+    for (int i = 0; i < 3; ++i)
+    {
+      min[i] = (std::min)(min[i], p[i]);
+      max[i] = (std::max)(max[i], p[i]);
+    }
+  }
+  Curve_cube cube;
+  cube.extent = 0;
+  for (int i = 0; i < 3; ++i)
+  {
+    cube.min[i] = n == 0 ? 0 : min[i];
+    cube.extent = (std::max)(cube.extent, max[i] - min[i]);
+  }
+  return cube;
+}
+
+// (key, i) for the `n` points along the Hilbert (or Morton) curve through
+// `cube`, sorted by key, the points with the same cell keeping their order.
+// The keys are computed and sorted concurrently with Parallel_tag.
+template <class Concurrency_tag, class Point_coordinates>
+std::vector<std::pair<std::uint64_t, std::size_t> >
+sorted_curve_keys(std::size_t n, const Point_coordinates& point, const Curve_cube& cube, bool hilbert)
+{
+  const std::size_t block_size = 4096;
+  std::vector<std::size_t> blocks((n + block_size - 1) / block_size);
+  for (std::size_t b = 0; b < blocks.size(); ++b)
+    blocks[b] = b * block_size;
+  std::vector<std::pair<std::uint64_t, std::size_t> > keys(n);
+  CGAL::for_each<Concurrency_tag>(blocks, [&](const std::size_t& begin) -> bool
+  {
+    const std::size_t end = (std::min)(begin + block_size, n);
+    for (std::size_t k = begin; k < end; ++k)
+    {
+      std::uint32_t c[3];
+      cube.cell(point(k), c);
+      keys[k] = std::make_pair(hilbert ? hilbert_key(c[0], c[1], c[2]) : morton_key(c[0], c[1], c[2]), k);
+    }
+    return true;
+  });
+
+#ifdef CGAL_LINKED_WITH_TBB
+  tbb::parallel_sort(keys.begin(), keys.end());
+#else
+  std::sort(keys.begin(), keys.end());
+#endif
+  return keys;
+}
+
+// Order of `n` points along the curve `mode` ("hilbert" or "morton") through
+// their bounding cube: the k-th point along the curve is point order[k]
+template <class Concurrency_tag, class Point_coordinates>
+std::vector<std::size_t> curve_order(std::size_t n, const Point_coordinates& point, const std::string& mode)
+{
+  if (mode != "hilbert" && mode != "morton")
+    throw std::invalid_argument("Unknown curve '" + mode + "', use 'hilbert' or 'morton'");
+  const std::vector<std::pair<std::uint64_t, std::size_t> > keys
+    = sorted_curve_keys<Concurrency_tag>(n, point, bounding_cube(n, point), mode == "hilbert");
+  std::vector<std::size_t> order(n);
+  for (std::size_t k = 0; k < n; ++k)
+    order[k] = keys[k].second;
+  return order;
+}
+
+} // namespace SWIG_CGAL
+
+#endif //SWIG_CGAL_COMMON_SPACE_FILLING_CURVE_H
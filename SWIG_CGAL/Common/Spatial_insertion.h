@@ -0,0 +1,102 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+
+#ifndef SWIG_CGAL_COMMON_SPATIAL_INSERTION_H
+#define SWIG_CGAL_COMMON_SPATIAL_INSERTION_H
+
+#include <SWIG_CGAL/Common/Buffer.h>
+#include <SWIG_CGAL/Common/Gil_release.h>
+
+#include <CGAL/spatial_sort.h>
+#include <boost/property_map/property_map.hpp>
+
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace SWIG_CGAL {
+
+namespace internal {
+template <class Bare_point>
+Bare_point make_bare_point(const double* row, std::integral_constant<int, 2>)
+{ return Bare_point(row[0], row[1]); }
+template <class Bare_point>
+Bare_point make_bare_point(const double* row, std::integral_constant<int, 3>)
+{ return Bare_point(row[0], row[1], row[2]); }
+} // namespace internal
+
+// Property map giving the bare point of the i-th row of an array of
+// coordinates, read from the first coordinates of the row
+template <class Bare_point, int dimension>
+struct Array_point_map
+{
+  typedef std::size_t key_type;
+  typedef Bare_point value_type;
+  typedef Bare_point reference;
+  typedef boost::readable_property_map_tag category;
+
+  const double* coords;
+  std::size_t row_size;
+
+  Array_point_map(const double* coords, std::size_t row_size)
+    : coords(coords), row_size(row_size) { }
+
+  friend Bare_point get(const Array_point_map& map, std::size_t i)
+  {
+    return internal::make_bare_point<Bare_point>(map.coords + map.row_size * i,
+                                                 std::integral_constant<int, dimension>());
+  }
+};
+
+// Number of rows of `coords`, whose rows have `row_size` coordinates
+inline std::size_t number_of_rows(const Buffer<double>& coords, std::size_t row_size)
+{
+  if (coords.size() % row_size != 0)
+    throw std::invalid_argument("The number of coordinates must be a multiple of " + std::to_string(row_size));
+  return coords.size() / row_size;
+}
+
+// Inserts the points made from the n rows of an array in the order of a
+// Hilbert sort of their bare points (given by `sort_traits`), each point
+// being located from the vertex of the previous one.
+// `insert(p, previous)` inserts p with hint the vertex `previous` and
+// returns its vertex. If `vertices` is not null, it receives the vertex of
+// each row, in the order of the rows. Returns the number of new vertices.
+template <class Triangulation, class Sort_traits, class Make_point, class Insert>
+std::size_t insert_in_spatial_order(Triangulation& t, std::size_t n,
+                                    const Sort_traits& sort_traits,
+                                    const Make_point& make_point,
+                                    const Insert& insert,
+                                    std::vector<typename Triangulation::Vertex_handle>* vertices = nullptr)
+{
+  typedef typename Triangulation::Vertex_handle Vertex_handle;
+  Gil_release gil;
+  std::vector<std::size_t> order(n);
+  for (std::size_t i = 0; i < n; ++i)
+    order[i] = i;
+  CGAL::spatial_sort(order.begin(), order.end(), sort_traits);
+
+  if (vertices != nullptr)
+    vertices->assign(n, Vertex_handle());
+  std::size_t size_before = t.number_of_vertices();
+  Vertex_handle previous;
+  for (std::size_t i : order)
+  {
+    Vertex_handle v = insert(make_point(i), previous);
+    // hidden weighted points have no vertex
+    if (v != Vertex_handle())
+      previous = v;
+    if (vertices != nullptr)
+      (*vertices)[i] = v;
+  }
+  return t.number_of_vertices() - size_before;
+}
+
+} // namespace SWIG_CGAL
+
+#endif //SWIG_CGAL_COMMON_SPATIAL_INSERTION_H
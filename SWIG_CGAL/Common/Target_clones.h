@@ -0,0 +1,28 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+
+#ifndef SWIG_CGAL_COMMON_TARGET_CLONES_H
+#define SWIG_CGAL_COMMON_TARGET_CLONES_H
+
+#include <cstddef>
+
+// Function compiled for several instruction sets, the version run being
+// chosen for the CPU when the module is loaded (function multi-versioning of
+// GCC, resolved by an ifunc of the dynamic loader), so that the generic
+// binaries of the wheels run AVX2 and AVX-512 code on the processors which
+// have them. Used on the loops over the rows of arrays without calls out.
+// The targets do not enable FMA: the results are the same on all the CPUs
+// (the error bounds of the filters assume uncontracted operations).
+// Disabled by SWIG_CGAL_NO_TARGET_CLONES, defined when the modules are built
+// for a given CPU (CMake option SWIG_CGAL_MARCH) or without SWIG_CGAL_MULTI_ISA.
+#if !defined(SWIG_CGAL_NO_TARGET_CLONES) && defined(__GNUC__) && !defined(__clang__) \
+    && __GNUC__ >= 8 && defined(__x86_64__) && defined(__ELF__) && defined(__GLIBC__)
+#define SWIG_CGAL_TARGET_CLONES __attribute__((target_clones("default", "avx2", "avx512f")))
+#else
+#define SWIG_CGAL_TARGET_CLONES
+#endif
+
+#endif //SWIG_CGAL_COMMON_TARGET_CLONES_H
@@ -13,6 +13,30 @@
 #include <boost/variant.hpp>
 #endif
 
+#ifndef SWIG
+namespace SWIG_CGAL {
+
+// Access to the variants returned by CGAL, std::variant since CGAL 6.0 and
+// boost::variant before: the alternative T of `v` or null, and the call of
+// `visitor` on the alternative held (the visitor declares a result_type
+// for boost)
+#if CGAL_VERSION_NR >= 1060000000
+template <class T, class... Args>
+const T* get_if(const std::variant<Args...>* v) { return std::get_if<T>(v); }
+
+template <class Visitor, class... Args>
+void visit(const Visitor& visitor, const std::variant<Args...>& v) { std::visit(visitor, v); }
+#else
+template <class T, class... Args>
+const T* get_if(const boost::variant<Args...>* v) { return boost::get<T>(v); }
+
+template <class Visitor, class... Args>
+void visit(const Visitor& visitor, const boost::variant<Args...>& v) { boost::apply_visitor(visitor, v); }
+#endif
+
+} // namespace SWIG_CGAL
+#endif // not SWIG
+
 template <class T1,class T2>
 class Variant
 {
@@ -0,0 +1,47 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+%define CT3_DOCSTRING
+"SWIG wrapper for the CGAL 3D Constrained Triangulations package provided under the GPL-3.0+ license"
+%enddef
+%module (package="CGAL", docstring=CT3_DOCSTRING) CGAL_Constrained_triangulation_3
+
+%include "SWIG_CGAL/common.i"
+Decl_void_type()
+
+SWIG_CGAL_add_java_loadLibrary(CGAL_Constrained_triangulation_3)
+SWIG_CGAL_package_common()
+
+%import  "SWIG_CGAL/Common/Macros.h"
+%import  "SWIG_CGAL/Kernel/CGAL_Kernel.i"
+
+//typemaps for the polygon soups given as arrays and the export to arrays
+%include "SWIG_CGAL/typemaps.i"
+SWIG_CGAL_buffer_of_double_typemap_in
+SWIG_CGAL_buffer_of_int_typemap_in
+SWIG_CGAL_buffer_of_double_typemap_out
+SWIG_CGAL_buffer_of_int_typemap_out
+
+//include files
+%{
+  #include <SWIG_CGAL/Constrained_triangulation_3/Conforming_constrained_Delaunay_triangulation_3.h>
+%}
+
+//definitions
+//the arrays are converted to CGAL points and polygons before the call: triangulate without the GIL
+SWIG_CGAL_release_gil(make_conforming_constrained_Delaunay_triangulation_3)
+%include "SWIG_CGAL/Constrained_triangulation_3/Conforming_constrained_Delaunay_triangulation_3.h"
+
+#ifdef SWIGPYTHON
+//asynchronous variant, see CGAL.run_async()
+%pythoncode %{
+import CGAL as _CGAL
+make_conforming_constrained_Delaunay_triangulation_3_async = _CGAL.async_variant(make_conforming_constrained_Delaunay_triangulation_3)
+%}
+#endif
+
+#ifdef SWIG_CGAL_HAS_Constrained_triangulation_3_USER_PACKAGE
+%include "SWIG_CGAL/User_packages/Constrained_triangulation_3/extensions.i"
+#endif
@@ -0,0 +1,268 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+
+#ifndef SWIG_CGAL_CONSTRAINED_TRIANGULATION_3_CONFORMING_CONSTRAINED_DELAUNAY_TRIANGULATION_3_H
+#define SWIG_CGAL_CONSTRAINED_TRIANGULATION_3_CONFORMING_CONSTRAINED_DELAUNAY_TRIANGULATION_3_H
+
+#include <SWIG_CGAL/Common/Buffer.h>
+
+#ifndef SWIG
+#include <SWIG_CGAL/Constrained_triangulation_3/typedefs.h>
+
+#include <CGAL/Unique_hash_map.h>
+
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+#endif
+
+#include <memory>
+#include <vector>
+
+// Result of make_conforming_constrained_Delaunay_triangulation_3(): row i of
+// point_array() is the point of the i-th vertex, the input points and the
+// Steiner points added to recover the constraints, and row j of cell_array()
+// the indices of the vertices of the j-th finite cell. Row k of
+// constrained_facet_array() is a facet of the triangulation lying on the
+// input polygon facet_polygon_array()[k]: these facets cover the polygons.
+// cell_component_array()[j] labels the j-th cell by the component of the
+// cells connected by facets which are not constrained, 0 being the one of
+// the unbounded region: the cells inside a closed surface have a label > 0.
+class Conforming_constrained_Delaunay_triangulation_3_arrays
+{
+  std::shared_ptr<std::vector<double> > points_sptr;
+  std::shared_ptr<std::vector<int> >    cells_sptr;
+  std::shared_ptr<std::vector<int> >    facets_sptr;
+  std::shared_ptr<std::vector<int> >    facet_polygons_sptr;
+  std::shared_ptr<std::vector<int> >    components_sptr;
+  int m_number_of_components;
+
+public:
+  Conforming_constrained_Delaunay_triangulation_3_arrays()
+    : points_sptr(new std::vector<double>())
+    , cells_sptr(new std::vector<int>())
+    , facets_sptr(new std::vector<int>())
+    , facet_polygons_sptr(new std::vector<int>())
+    , components_sptr(new std::vector<int>())
+    , m_number_of_components(0) {}
+
+  #ifndef SWIG
+  template <class Triangulation>
+  explicit Conforming_constrained_Delaunay_triangulation_3_arrays(const Triangulation& t)
+    : Conforming_constrained_Delaunay_triangulation_3_arrays()
+  {
+    typedef typename Triangulation::Vertex_handle Vertex_handle;
+    typedef typename Triangulation::Cell_handle Cell_handle;
+
+    CGAL::Unique_hash_map<Vertex_handle, int> vertex_index(-1, t.number_of_vertices());
+    points_sptr->reserve(3 * t.number_of_vertices());
+    int nv = 0;
+    for (typename Triangulation::Finite_vertices_iterator v = t.finite_vertices_begin();
+         v != t.finite_vertices_end(); ++v)
+    {
+      vertex_index[v] = nv++;
+      points_sptr->push_back(CGAL::to_double(v->point().x()));
+      points_sptr->push_back(CGAL::to_double(v->point().y()));
+      points_sptr->push_back(CGAL::to_double(v->point().z()));
+    }
+
+    CGAL::Unique_hash_map<Cell_handle, int> cell_index(-1, t.number_of_finite_cells());
+    std::vector<Cell_handle> cells;
+    cells.reserve(t.number_of_finite_cells());
+    cells_sptr->reserve(4 * t.number_of_finite_cells());
+    for (typename Triangulation::Finite_cells_iterator c = t.finite_cells_begin(); c != t.finite_cells_end(); ++c)
+    {
+      cell_index[c] = int(cells.size());
+      cells.push_back(c);
+      for (int i = 0; i < 4; ++i)
+        cells_sptr->push_back(vertex_index[c->vertex(i)]);
+    }
+
+    for (typename Triangulation::Finite_facets_iterator f = t.finite_facets_begin(); f != t.finite_facets_end(); ++f)
+    {
+      const Cell_handle c = f->first;
+      const int i = f->second;
+      if (!c->ccdt_3_data().is_facet_constrained(i))
+        continue;
+      for (int k = 1; k < 4; ++k)
+        facets_sptr->push_back(vertex_index[c->vertex((i + k) & 3)]);
+      facet_polygons_sptr->push_back(int(c->ccdt_3_data().face_constraint_index(i)));
+    }
+
+    // components of the cells through the facets not constrained, the ones
+    // reached from the infinite cells first
+    components_sptr->assign(cells.size(), -1);
+    std::vector<int> stack;
+    for (typename Triangulation::All_cells_iterator c = t.all_cells_begin(); c != t.all_cells_end(); ++c)
+    {
+      if (!t.is_infinite(c))
+        continue;
+      const int i = c->index(t.infinite_vertex());
+      const int j = cell_index[c->neighbor(i)];
+      if (j >= 0 && (*components_sptr)[j] < 0 && !c->ccdt_3_data().is_facet_constrained(i))
+      {
+        (*components_sptr)[j] = 0;
+        stack.push_back(j);
+      }
+    }
+    std::size_t component = 0;
+    for (std::size_t seed = 0; ; )
+    {
+      while (!stack.empty())
+      {
+        const Cell_handle c = cells[std::size_t(stack.back())];
+        stack.pop_back();
+        for (int i = 0; i < 4; ++i)
+        {
+          if (c->ccdt_3_data().is_facet_constrained(i))
+            continue;
+          const int j = cell_index[c->neighbor(i)];
+          if (j >= 0 && (*components_sptr)[j] < 0)
+          {
+            (*components_sptr)[j] = int(component);
+            stack.push_back(j);
+          }
+        }
+      }
+      while (seed < cells.size() && (*components_sptr)[seed] >= 0)
+        ++seed;
+      if (seed == cells.size())
+        break;
+      (*components_sptr)[seed] = int(++component);
+      stack.push_back(int(seed));
+    }
+    m_number_of_components = cells.empty() ? 0 : int(component) + 1;
+  }
+  #endif
+
+  int number_of_vertices() const { return int(points_sptr->size() / 3); }
+  int number_of_cells() const { return int(cells_sptr->size() / 4); }
+  int number_of_constrained_facets() const { return int(facets_sptr->size() / 3); }
+  // the labels of cell_component_array() are in [0, number_of_components())
+  int number_of_components() const { return m_number_of_components; }
+
+  // (number_of_vertices(), 3)
+  SWIG_CGAL::Buffer<double> point_array() const
+  {
+    return SWIG_CGAL::Buffer<double>(points_sptr->data(), points_sptr->size() / 3, 3, points_sptr, true);
+  }
+  // (number_of_cells(), 4)
+  SWIG_CGAL::Buffer<int> cell_array() const
+  {
+    return SWIG_CGAL::Buffer<int>(cells_sptr->data(), cells_sptr->size() / 4, 4, cells_sptr, true);
+  }
+  // (number_of_constrained_facets(), 3)
+  SWIG_CGAL::Buffer<int> constrained_facet_array() const
+  {
+    return SWIG_CGAL::Buffer<int>(facets_sptr->data(), facets_sptr->size() / 3, 3, facets_sptr, true);
+  }
+  // (number_of_constrained_facets(),)
+  SWIG_CGAL::Buffer<int> facet_polygon_array() const
+  {
+    return SWIG_CGAL::Buffer<int>(facet_polygons_sptr->data(), facet_polygons_sptr->size(), 1,
+                                  facet_polygons_sptr, true);
+  }
+  // (number_of_cells(),)
+  SWIG_CGAL::Buffer<int> cell_component_array() const
+  {
+    return SWIG_CGAL::Buffer<int>(components_sptr->data(), components_sptr->size(), 1, components_sptr, true);
+  }
+};
+
+#ifndef SWIG
+namespace SWIG_Constrained_triangulation_3 {
+namespace internal {
+
+inline std::vector<EPIC_Kernel::Point_3> read_points(const SWIG_CGAL::Buffer<double>& coords)
+{
+  if (coords.size() % 3 != 0)
+    throw std::invalid_argument("Expecting rows of 3 coordinates");
+  std::vector<EPIC_Kernel::Point_3> points;
+  points.reserve(coords.size() / 3);
+  for (std::size_t i = 0; i < coords.size(); i += 3)
+    points.push_back(EPIC_Kernel::Point_3(coords[i], coords[i + 1], coords[i + 2]));
+  return points;
+}
+
+// the polygon of the indices [begin, end) of points
+inline std::vector<std::size_t> read_polygon(const int* begin, const int* end, std::size_t nb_points)
+{
+  if (end - begin < 3)
+    throw std::invalid_argument("The polygons must have at least 3 vertices");
+  std::vector<std::size_t> polygon;
+  polygon.reserve(std::size_t(end - begin));
+  for (const int* v = begin; v != end; ++v)
+  {
+    if (*v < 0 || std::size_t(*v) >= nb_points)
+      throw std::out_of_range("Invalid point index in the polygons");
+    polygon.push_back(std::size_t(*v));
+  }
+  return polygon;
+}
+
+inline Conforming_constrained_Delaunay_triangulation_3_arrays
+triangulate(const std::vector<EPIC_Kernel::Point_3>& points, const std::vector<std::vector<std::size_t> >& polygons)
+{
+#if CGAL_VERSION_NR >= 1060100000
+  if (polygons.empty())
+    throw std::invalid_argument("Expecting at least one polygon");
+  const CGAL_CCDT3 ccdt = CGAL::make_conforming_constrained_Delaunay_triangulation_3<CGAL_CCDT3>(points, polygons);
+  return Conforming_constrained_Delaunay_triangulation_3_arrays(ccdt.triangulation());
+#else
+  (void)points; (void)polygons;
+  throw std::runtime_error("make_conforming_constrained_Delaunay_triangulation_3() needs CGAL 6.1 or later");
+#endif
+}
+
+} // namespace internal
+} // namespace SWIG_Constrained_triangulation_3
+#endif
+
+// CGAL::make_conforming_constrained_Delaunay_triangulation_3() of the polygon
+// soup of the (V,3) array `points` and the (F,k) array `faces` of indices of
+// points (k>=3, triangles for a flat array): the Delaunay tetrahedralization
+// of the points, with Steiner points inserted until each polygon is a union
+// of facets. The polygons must not intersect except along shared edges and
+// vertices. No point is added to improve the shape of the cells: it is the
+// minimal tetrahedralization of the input, far smaller than a Mesh_3 mesh.
+inline Conforming_constrained_Delaunay_triangulation_3_arrays
+make_conforming_constrained_Delaunay_triangulation_3(SWIG_CGAL::Buffer<double> points, SWIG_CGAL::Buffer<int> faces)
+{
+  using namespace SWIG_Constrained_triangulation_3::internal;
+  const std::vector<EPIC_Kernel::Point_3> cpp_points = read_points(points);
+  const std::size_t k = faces.cols() == 1 ? 3 : faces.cols();
+  if (faces.size() % k != 0)
+    throw std::invalid_argument("Expecting (F,k) point indices with k>=3");
+  std::vector<std::vector<std::size_t> > polygons;
+  polygons.reserve(faces.size() / k);
+  for (std::size_t f = 0; f < faces.size(); f += k)
+    polygons.push_back(read_polygon(faces.data() + f, faces.data() + f + k, cpp_points.size()));
+  return triangulate(cpp_points, polygons);
+}
+
+// Same with polygons of any degree in compressed sparse rows: polygon f has
+// the points indices[offsets[f]] to indices[offsets[f+1]-1], offsets having
+// F+1 values (see Polyhedron_3.from_csr_arrays()).
+inline Conforming_constrained_Delaunay_triangulation_3_arrays
+make_conforming_constrained_Delaunay_triangulation_3(SWIG_CGAL::Buffer<double> points, SWIG_CGAL::Buffer<int> offsets,
+                                                     SWIG_CGAL::Buffer<int> indices)
+{
+  using namespace SWIG_Constrained_triangulation_3::internal;
+  const std::vector<EPIC_Kernel::Point_3> cpp_points = read_points(points);
+  if (offsets.size() == 0)
+    throw std::invalid_argument("Expecting F+1 offsets");
+  std::vector<std::vector<std::size_t> > polygons;
+  polygons.reserve(offsets.size() - 1);
+  for (std::size_t f = 0; f + 1 < offsets.size(); ++f)
+  {
+    if (offsets[f] < 0 || offsets[f + 1] < offsets[f] || std::size_t(offsets[f + 1]) > indices.size())
+      throw std::invalid_argument("The offsets must be increasing and at most the number of indices");
+    polygons.push_back(read_polygon(indices.data() + offsets[f], indices.data() + offsets[f + 1], cpp_points.size()));
+  }
+  return triangulate(cpp_points, polygons);
+}
+
+#endif //SWIG_CGAL_CONSTRAINED_TRIANGULATION_3_CONFORMING_CONSTRAINED_DELAUNAY_TRIANGULATION_3_H
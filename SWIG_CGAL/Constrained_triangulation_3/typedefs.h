@@ -0,0 +1,21 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+#ifndef SWIG_CGAL_CONSTRAINED_TRIANGULATION_3_TYPEDEFS_H
+#define SWIG_CGAL_CONSTRAINED_TRIANGULATION_3_TYPEDEFS_H
+
+#include <SWIG_CGAL/Kernel/typedefs.h>
+
+#include <CGAL/version.h>
+
+// the package Constrained_triangulation_3 was introduced in CGAL 6.1
+#if CGAL_VERSION_NR >= 1060100000
+#include <CGAL/Conforming_constrained_Delaunay_triangulation_3.h>
+#include <CGAL/make_conforming_constrained_Delaunay_triangulation_3.h>
+
+typedef CGAL::Conforming_constrained_Delaunay_triangulation_3<EPIC_Kernel> CGAL_CCDT3;
+#endif
+
+#endif //SWIG_CGAL_CONSTRAINED_TRIANGULATION_3_TYPEDEFS_H
@@ -28,10 +28,20 @@ SWIG_CGAL_set_wrapper_iterator_helper_output(Point_2)
 
 %include "SWIG_CGAL/Convex_hull_2/convex_hull_2.h"
 
+//typemaps for the points given as arrays and the hulls returned as arrays
+%include "SWIG_CGAL/typemaps.i"
+SWIG_CGAL_buffer_of_double_typemap_in
+SWIG_CGAL_buffer_of_int_typemap_in
+SWIG_CGAL_buffer_of_int_typemap_out
+SWIG_CGAL_buffer_of_double_typemap_out
+SWIG_CGAL_release_gil(convex_hulls_2_by_label)
+%include "SWIG_CGAL/Convex_hull_2/convex_hull_2_arrays.h"
+
 //include files
 %{
   #include <SWIG_CGAL/Convex_hull_2/typedefs.h>
   #include <SWIG_CGAL/Convex_hull_2/all_includes.h>
+  #include <SWIG_CGAL/Convex_hull_2/convex_hull_2_arrays.h>
 %}
 
 #ifdef SWIG_CGAL_HAS_Convex_hull_2_USER_PACKAGE
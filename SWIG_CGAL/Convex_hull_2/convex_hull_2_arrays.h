@@ -0,0 +1,206 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+
+#ifndef SWIG_CGAL_CONVEX_HULL_2_ARRAYS_H
+#define SWIG_CGAL_CONVEX_HULL_2_ARRAYS_H
+
+#include <SWIG_CGAL/Common/Buffer.h>
+
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#ifndef SWIG
+#include <SWIG_CGAL/Convex_hull_2/typedefs.h>
+#include <CGAL/Convex_hull_traits_adapter_2.h>
+#include <CGAL/property_map.h>
+#include <CGAL/for_each.h>
+#include <CGAL/tags.h>
+#include <iterator>
+
+namespace SWIG_Convex_hull_2 {
+
+#ifdef CGAL_LINKED_WITH_TBB
+typedef CGAL::Parallel_tag Concurrency_tag;
+#else
+typedef CGAL::Sequential_tag Concurrency_tag;
+#endif
+
+typedef EPIC_Kernel::Point_2 Point;
+typedef CGAL::Pointer_property_map<Point>::const_type Point_map;
+// computes the hulls on the indices of the points
+typedef CGAL::Convex_hull_traits_adapter_2<EPIC_Kernel, Point_map> Index_traits;
+
+inline std::vector<Point> read_points (const SWIG_CGAL::Buffer<double>& points)
+{
+  if (points.size() % 2 != 0 || (points.cols() != 1 && points.cols() != 2))
+    throw std::invalid_argument ("The points must be given as rows of 2 coordinates");
+  std::vector<Point> out;
+  out.reserve (points.size() / 2);
+  for (std::size_t i = 0; i < points.size(); i += 2)
+    out.push_back (Point (points.data()[i], points.data()[i + 1]));
+  return out;
+}
+
+// calls algorithm(begin, end, out, traits) on the indices of the points
+template <typename Algorithm>
+SWIG_CGAL::Buffer<int> hull_indices (const SWIG_CGAL::Buffer<double>& points, const Algorithm& algorithm)
+{
+  const std::vector<Point> pts = read_points (points);
+  std::vector<std::size_t> indices (pts.size());
+  for (std::size_t i = 0; i < indices.size(); ++ i)
+    indices[i] = i;
+  std::vector<std::size_t> hull;
+  algorithm (indices.begin(), indices.end(), std::back_inserter (hull),
+             Index_traits (Point_map (pts.data())));
+  return SWIG_CGAL::Buffer<int> (std::vector<int> (hull.begin(), hull.end()));
+}
+
+} // namespace SWIG_Convex_hull_2
+
+// Overload of FUNCTION taking the points as rows (x, y) of a buffer and
+// returning the indices of the rows of the points of the hull
+#define SWIG_CGAL_CONVEX_HULL_2_ARRAY_OVERLOAD(FUNCTION)                            \
+inline SWIG_CGAL::Buffer<int> FUNCTION (SWIG_CGAL::Buffer<double> points)           \
+{                                                                                   \
+  return SWIG_Convex_hull_2::hull_indices                                           \
+    (points, [](std::vector<std::size_t>::iterator b, std::vector<std::size_t>::iterator e, \
+                std::back_insert_iterator<std::vector<std::size_t> > out,               \
+                const SWIG_Convex_hull_2::Index_traits& traits)                         \
+     { CGAL::FUNCTION (b, e, out, traits); });                                      \
+}
+#endif
+
+// The following overloads take the points as an (N, 2) buffer and return
+// the indices of the rows of the points of the hull (counterclockwise for
+// the complete hulls), without creating a Point_2 per point.
+#ifndef SWIG
+SWIG_CGAL_CONVEX_HULL_2_ARRAY_OVERLOAD(convex_hull_2)
+SWIG_CGAL_CONVEX_HULL_2_ARRAY_OVERLOAD(ch_akl_toussaint)
+SWIG_CGAL_CONVEX_HULL_2_ARRAY_OVERLOAD(ch_bykat)
+SWIG_CGAL_CONVEX_HULL_2_ARRAY_OVERLOAD(ch_eddy)
+SWIG_CGAL_CONVEX_HULL_2_ARRAY_OVERLOAD(ch_graham_andrew)
+SWIG_CGAL_CONVEX_HULL_2_ARRAY_OVERLOAD(ch_jarvis)
+SWIG_CGAL_CONVEX_HULL_2_ARRAY_OVERLOAD(ch_melkman)
+SWIG_CGAL_CONVEX_HULL_2_ARRAY_OVERLOAD(lower_hull_points_2)
+SWIG_CGAL_CONVEX_HULL_2_ARRAY_OVERLOAD(upper_hull_points_2)
+#else
+SWIG_CGAL::Buffer<int> convex_hull_2 (SWIG_CGAL::Buffer<double> points);
+SWIG_CGAL::Buffer<int> ch_akl_toussaint (SWIG_CGAL::Buffer<double> points);
+SWIG_CGAL::Buffer<int> ch_bykat (SWIG_CGAL::Buffer<double> points);
+SWIG_CGAL::Buffer<int> ch_eddy (SWIG_CGAL::Buffer<double> points);
+SWIG_CGAL::Buffer<int> ch_graham_andrew (SWIG_CGAL::Buffer<double> points);
+SWIG_CGAL::Buffer<int> ch_jarvis (SWIG_CGAL::Buffer<double> points);
+SWIG_CGAL::Buffer<int> ch_melkman (SWIG_CGAL::Buffer<double> points);
+SWIG_CGAL::Buffer<int> lower_hull_points_2 (SWIG_CGAL::Buffer<double> points);
+SWIG_CGAL::Buffer<int> upper_hull_points_2 (SWIG_CGAL::Buffer<double> points);
+#endif
+
+// Result of convex_hulls_2_by_label(): the vertices of hull l are the rows
+// [offsets[l], offsets[l+1]) of vertex_array(), indices of rows of the
+// input points in counterclockwise order.
+class Convex_hulls_2
+{
+  std::shared_ptr<std::vector<int> > vertices_sptr;
+  std::shared_ptr<std::vector<int> > offsets_sptr;
+  std::shared_ptr<std::vector<double> > areas_sptr;
+
+public:
+  Convex_hulls_2()
+    : vertices_sptr(new std::vector<int>())
+    , offsets_sptr(new std::vector<int>(1, 0))
+    , areas_sptr(new std::vector<double>()) {}
+
+  #ifndef SWIG
+  std::vector<int>& vertices() { return *vertices_sptr; }
+  std::vector<int>& offsets() { return *offsets_sptr; }
+  std::vector<double>& areas() { return *areas_sptr; }
+  #endif
+
+  int number_of_hulls() const { return int(offsets_sptr->size()) - 1; }
+
+  // (number of vertices, 1)
+  SWIG_CGAL::Buffer<int> vertex_array() const
+  {
+    return SWIG_CGAL::Buffer<int>(vertices_sptr->data(), vertices_sptr->size(), 1, vertices_sptr, true);
+  }
+  // (number_of_hulls() + 1, 1)
+  SWIG_CGAL::Buffer<int> offset_array() const
+  {
+    return SWIG_CGAL::Buffer<int>(offsets_sptr->data(), offsets_sptr->size(), 1, offsets_sptr, true);
+  }
+  // (number_of_hulls(), 1)
+  SWIG_CGAL::Buffer<double> area_array() const
+  {
+    return SWIG_CGAL::Buffer<double>(areas_sptr->data(), areas_sptr->size(), 1, areas_sptr, true);
+  }
+};
+
+// Convex hulls of the points of each label, the label of the row i of the
+// (N, 2) array points being labels[i] (-1 for none). Hull l is the one of
+// label l, for l in [0, max label], empty if the label has no points. The
+// hulls and their areas are computed in parallel when linked with TBB.
+inline Convex_hulls_2 convex_hulls_2_by_label (SWIG_CGAL::Buffer<double> points,
+                                               SWIG_CGAL::Buffer<int> labels)
+{
+  using namespace SWIG_Convex_hull_2;
+  const std::vector<Point> pts = read_points (points);
+  if (labels.size() != pts.size())
+    throw std::invalid_argument ("There must be one label per point");
+
+  // rows of the points sorted by label
+  std::vector<std::size_t> first (1, 0);
+  for (std::size_t i = 0; i < labels.size(); ++ i)
+  {
+    const int l = labels.data()[i];
+    if (l < -1)
+      throw std::invalid_argument ("Invalid label");
+    if (l >= 0 && std::size_t(l) + 2 > first.size())
+      first.resize (std::size_t(l) + 2, 0);
+    if (l >= 0)
+      ++ first[std::size_t(l) + 1];
+  }
+  for (std::size_t l = 1; l < first.size(); ++ l)
+    first[l] += first[l - 1];
+  std::vector<std::size_t> rows (first.back());
+  std::vector<std::size_t> next (first.begin(), first.end() - 1);
+  for (std::size_t i = 0; i < labels.size(); ++ i)
+    if (labels.data()[i] >= 0)
+      rows[next[std::size_t(labels.data()[i])] ++] = i;
+
+  const std::size_t nb_labels = first.size() - 1;
+  std::vector<std::vector<std::size_t> > hulls (nb_labels);
+  std::vector<double> areas (nb_labels, 0.);
+  std::vector<std::size_t> label_ids (nb_labels);
+  for (std::size_t l = 0; l < nb_labels; ++ l)
+    label_ids[l] = l;
+  const Index_traits traits (Point_map (pts.data()));
+  CGAL::for_each<Concurrency_tag>
+    (label_ids, [&](const std::size_t& l) -> bool
+     {
+       CGAL::convex_hull_2 (rows.begin() + first[l], rows.begin() + first[l + 1],
+                            std::back_inserter (hulls[l]), traits);
+       const std::vector<std::size_t>& h = hulls[l];
+       for (std::size_t k = 0; k < h.size(); ++ k) // shoelace formula
+       {
+         const Point& p = pts[h[k]];
+         const Point& q = pts[h[(k + 1) % h.size()]];
+         areas[l] += (p.x() * q.y() - q.x() * p.y()) / 2;
+       }
+       return true;
+     });
+
+  Convex_hulls_2 result;
+  for (std::size_t l = 0; l < nb_labels; ++ l)
+  {
+    result.vertices().insert (result.vertices().end(), hulls[l].begin(), hulls[l].end());
+    result.offsets().push_back (int(result.vertices().size()));
+  }
+  result.areas().swap (areas);
+  return result;
+}
+
+#endif //SWIG_CGAL_CONVEX_HULL_2_ARRAYS_H
@@ -19,6 +19,13 @@ SWIG_CGAL_package_common()
 %include "SWIG_CGAL/Common/Iterator.h"
 %include "SWIG_CGAL/Common/Wrapper_iterator_helper.h"
 
+//typemaps for the points given as arrays and the hulls returned as arrays
+%include "SWIG_CGAL/typemaps.i"
+SWIG_CGAL_buffer_of_double_typemap_in
+SWIG_CGAL_buffer_of_int_typemap_in
+SWIG_CGAL_buffer_of_int_typemap_out
+SWIG_CGAL_buffer_of_double_typemap_out
+
 %pragma(java) jniclassimports=%{
 import CGAL.Kernel.Point_3;
 import CGAL.Kernel.Plane_3;
@@ -82,6 +89,19 @@ bool is_strongly_convex_3(Polyhedron_3_SWIG_wrapper& P)
 
 %}
 
+SWIG_CGAL_release_gil(convex_hull_3_arrays)
+SWIG_CGAL_release_gil(convex_hulls_3_arrays)
+SWIG_CGAL_release_gil(convex_hulls_by_label)
+SWIG_CGAL_release_gil(halfspace_intersections_3_arrays)
+SWIG_CGAL_release_gil(do_intersect_polytopes_3)
+SWIG_CGAL_release_gil(do_intersect_polytopes_3_arrays)
+%include "SWIG_CGAL/Convex_hull_3/Convex_hull_3_arrays.h"
+%include "SWIG_CGAL/Convex_hull_3/Halfspace_intersection_3_arrays.h"
+%{
+#include <SWIG_CGAL/Convex_hull_3/Convex_hull_3_arrays.h>
+#include <SWIG_CGAL/Convex_hull_3/Halfspace_intersection_3_arrays.h>
+%}
+
 #ifdef SWIG_CGAL_HAS_Convex_hull_3_USER_PACKAGE
 %include "SWIG_CGAL/User_packages/Convex_hull_3/extensions.i"
 #endif
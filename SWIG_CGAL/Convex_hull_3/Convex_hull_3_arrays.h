@@ -0,0 +1,384 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+
+#ifndef SWIG_CGAL_CONVEX_HULL_3_CONVEX_HULL_3_ARRAYS_H
+#define SWIG_CGAL_CONVEX_HULL_3_CONVEX_HULL_3_ARRAYS_H
+
+#include <SWIG_CGAL/Common/Buffer.h>
+
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#ifndef SWIG
+#include <SWIG_CGAL/Kernel/typedefs.h>
+#include <CGAL/convex_hull_3.h>
+#include <CGAL/Extreme_points_traits_adapter_3.h>
+#include <CGAL/property_map.h>
+#include <CGAL/for_each.h>
+#include <CGAL/tags.h>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <iterator>
+#endif
+
+// Result of convex_hull_3_arrays(), convex_hulls_3_arrays() and
+// convex_hulls_by_label(). The vertices and triangles of hull c are the
+// rows [vertex_offsets[c], vertex_offsets[c+1]) of vertex_array() and
+// [triangle_offsets[c], triangle_offsets[c+1]) of triangle_array().
+// Vertices and triangle corners are indices of rows of the input points.
+// The triangles are oriented outward; there are none if only the extreme
+// points are computed (the areas and volumes are then 0).
+class Convex_hulls_3
+{
+  std::shared_ptr<std::vector<int> > vertices_sptr;
+  std::shared_ptr<std::vector<int> > triangles_sptr;
+  std::shared_ptr<std::vector<int> > vertex_offsets_sptr;
+  std::shared_ptr<std::vector<int> > triangle_offsets_sptr;
+  std::shared_ptr<std::vector<double> > areas_sptr;
+  std::shared_ptr<std::vector<double> > volumes_sptr;
+
+  static SWIG_CGAL::Buffer<int> view (const std::shared_ptr<std::vector<int> >& v, std::size_t cols)
+  {
+    return SWIG_CGAL::Buffer<int>(v->data(), v->size() / cols, cols, v, true);
+  }
+
+public:
+  Convex_hulls_3()
+    : vertices_sptr(new std::vector<int>())
+    , triangles_sptr(new std::vector<int>())
+    , vertex_offsets_sptr(new std::vector<int>(1, 0))
+    , triangle_offsets_sptr(new std::vector<int>(1, 0))
+    , areas_sptr(new std::vector<double>())
+    , volumes_sptr(new std::vector<double>()) {}
+
+  #ifndef SWIG
+  std::vector<int>& vertices() { return *vertices_sptr; }
+  std::vector<int>& triangles() { return *triangles_sptr; }
+  std::vector<int>& vertex_offsets() { return *vertex_offsets_sptr; }
+  std::vector<int>& triangle_offsets() { return *triangle_offsets_sptr; }
+  std::vector<double>& areas() { return *areas_sptr; }
+  std::vector<double>& volumes() { return *volumes_sptr; }
+  #endif
+
+  int number_of_hulls() const { return int(vertex_offsets_sptr->size()) - 1; }
+
+  // (number of vertices, 1)
+  SWIG_CGAL::Buffer<int> vertex_array() const { return view (vertices_sptr, 1); }
+  // (number of triangles, 3)
+  SWIG_CGAL::Buffer<int> triangle_array() const { return view (triangles_sptr, 3); }
+  // (number_of_hulls() + 1, 1)
+  SWIG_CGAL::Buffer<int> vertex_offset_array() const { return view (vertex_offsets_sptr, 1); }
+  // (number_of_hulls() + 1, 1)
+  SWIG_CGAL::Buffer<int> triangle_offset_array() const { return view (triangle_offsets_sptr, 1); }
+  // (number_of_hulls(), 1), area of the boundary of each hull (counting
+  // both sides of a flat hull)
+  SWIG_CGAL::Buffer<double> area_array() const
+  {
+    return SWIG_CGAL::Buffer<double>(areas_sptr->data(), areas_sptr->size(), 1, areas_sptr, true);
+  }
+  // (number_of_hulls(), 1)
+  SWIG_CGAL::Buffer<double> volume_array() const
+  {
+    return SWIG_CGAL::Buffer<double>(volumes_sptr->data(), volumes_sptr->size(), 1, volumes_sptr, true);
+  }
+};
+
+#ifndef SWIG
+namespace SWIG_Convex_hull_3 {
+
+#ifdef CGAL_LINKED_WITH_TBB
+typedef CGAL::Parallel_tag Concurrency_tag;
+#else
+typedef CGAL::Sequential_tag Concurrency_tag;
+#endif
+
+typedef EPIC_Kernel::Point_3 Point;
+typedef CGAL::Pointer_property_map<Point>::const_type Point_map;
+
+// the points below this number are not prefiltered
+static const std::size_t prefilter_threshold = 4096;
+static const std::size_t prefilter_block_size = 65536;
+
+// Akl-Toussaint heuristic: removes from indices the points strictly inside
+// the hull of the extreme points of the input in 13 directions. The
+// extremes are computed in parallel per block, and so is the culling. The
+// tests are exact, so that no vertex of the hull is removed.
+inline void cull_interior_points (const std::vector<Point>& points, std::vector<std::size_t>& indices)
+{
+  static const double directions[13][3] = {
+    {1,0,0}, {0,1,0}, {0,0,1}, {1,1,0}, {1,-1,0}, {1,0,1}, {1,0,-1}, {0,1,1}, {0,1,-1},
+    {1,1,1}, {1,1,-1}, {1,-1,1}, {-1,1,1} };
+  const std::size_t n = indices.size();
+  const std::size_t nb_blocks = (n + prefilter_block_size - 1) / prefilter_block_size;
+  std::vector<std::size_t> blocks (nb_blocks);
+  for (std::size_t b = 0; b < nb_blocks; ++ b)
+    blocks[b] = b;
+
+  // lowest and highest point of each direction, per block
+  std::vector<std::array<std::size_t, 26> > block_extremes (nb_blocks);
+  const auto dot = [&](std::size_t i, int d) -> double
+  {
+    return points[i].x() * directions[d][0] + points[i].y() * directions[d][1] + points[i].z() * directions[d][2];
+  };
+  CGAL::for_each<Concurrency_tag>
+    (blocks, [&](const std::size_t& b) -> bool
+     {
+       std::array<std::size_t, 26>& e = block_extremes[b];
+       const std::size_t first = b * prefilter_block_size;
+       const std::size_t last = (std::min) (n, first + prefilter_block_size);
+       e.fill (indices[first]);
+       for (std::size_t k = first + 1; k < last; ++ k)
+         for (int d = 0; d < 13; ++ d)
+         {
+           const double v = dot (indices[k], d);
+           if (v < dot (e[2 * d], d)) e[2 * d] = indices[k];
+           if (v > dot (e[2 * d + 1], d)) e[2 * d + 1] = indices[k];
+         }
+       return true;
+     });
+  std::vector<std::size_t> extremes;
+  for (int j = 0; j < 26; ++ j)
+  {
+    std::size_t best = block_extremes[0][j];
+    for (std::size_t b = 1; b < nb_blocks; ++ b)
+    {
+      const std::size_t i = block_extremes[b][j];
+      if ((j % 2 == 0) ? dot (i, j / 2) < dot (best, j / 2) : dot (i, j / 2) > dot (best, j / 2))
+        best = i;
+    }
+    extremes.push_back (best);
+  }
+  std::sort (extremes.begin(), extremes.end());
+  extremes.erase (std::unique (extremes.begin(), extremes.end()), extremes.end());
+  if (extremes.size() < 4)
+    return;
+
+  std::vector<Point> inner_points;
+  for (std::size_t i : extremes)
+    inner_points.push_back (points[i]);
+  std::vector<Point> inner_vertices;
+  std::vector<std::array<std::size_t, 3> > inner_faces;
+  CGAL::convex_hull_3 (inner_points.begin(), inner_points.end(), inner_vertices, inner_faces);
+
+  // orientation of the interior for each face, none if the inner hull is flat
+  double c[3] = {0, 0, 0};
+  for (const Point& p : inner_vertices)
+  {
+    c[0] += p.x() / inner_vertices.size();
+    c[1] += p.y() / inner_vertices.size();
+    c[2] += p.z() / inner_vertices.size();
+  }
+  const Point center (c[0], c[1], c[2]);
+  std::vector<CGAL::Orientation> inside (inner_faces.size());
+  for (std::size_t f = 0; f < inner_faces.size(); ++ f)
+  {
+    inside[f] = CGAL::orientation (inner_vertices[inner_faces[f][0]], inner_vertices[inner_faces[f][1]],
+                                   inner_vertices[inner_faces[f][2]], center);
+    if (inside[f] == CGAL::COPLANAR)
+      return;
+  }
+
+  std::vector<char> keep (n);
+  CGAL::for_each<Concurrency_tag>
+    (blocks, [&](const std::size_t& b) -> bool
+     {
+       const std::size_t first = b * prefilter_block_size;
+       const std::size_t last = (std::min) (n, first + prefilter_block_size);
+       for (std::size_t k = first; k < last; ++ k)
+       {
+         const Point& p = points[indices[k]];
+         keep[k] = 0;
+         for (std::size_t f = 0; f < inner_faces.size() && !keep[k]; ++ f)
+           if (CGAL::orientation (inner_vertices[inner_faces[f][0]], inner_vertices[inner_faces[f][1]],
+                                  inner_vertices[inner_faces[f][2]], p) != inside[f])
+             keep[k] = 1;
+       }
+       return true;
+     });
+  std::size_t kept = 0;
+  for (std::size_t k = 0; k < n; ++ k)
+    if (keep[k])
+      indices[kept ++] = indices[k];
+  indices.resize (kept);
+}
+
+// hull of the points of indices, appended to vertices and triangles as
+// indices of points
+inline void convex_hull_of_indices (const std::vector<Point>& points, std::vector<std::size_t>& indices,
+                                    bool extreme_points_only,
+                                    std::vector<int>& vertices, std::vector<int>& triangles)
+{
+  if (indices.empty())
+    return;
+  if (indices.size() >= prefilter_threshold)
+    cull_interior_points (points, indices);
+  // the hull is computed on the indices of the points
+  const auto traits = CGAL::make_extreme_points_traits_adapter (Point_map (points.data()));
+  if (extreme_points_only)
+  {
+    std::vector<std::size_t> extremes;
+    CGAL::extreme_points_3 (indices, std::back_inserter (extremes), traits);
+    for (std::size_t i : extremes)
+      vertices.push_back (int(i));
+    return;
+  }
+  std::vector<std::size_t> hull_vertices;
+  std::vector<std::array<std::size_t, 3> > hull_faces;
+  CGAL::convex_hull_3 (indices.begin(), indices.end(), hull_vertices, hull_faces, traits);
+  for (std::size_t i : hull_vertices)
+    vertices.push_back (int(i));
+  for (const std::array<std::size_t, 3>& f : hull_faces)
+    for (std::size_t v : f)
+      triangles.push_back (int(hull_vertices[v]));
+}
+
+// area and volume enclosed by outward triangles given as indices of points
+inline void measure (const std::vector<Point>& points, const std::vector<int>& triangles,
+                     double& area, double& volume)
+{
+  area = volume = 0;
+  if (triangles.empty())
+    return;
+  const Point& r = points[triangles[0]];
+  for (std::size_t t = 0; t < triangles.size(); t += 3)
+  {
+    const EPIC_Kernel::Vector_3 a = points[triangles[t]] - r;
+    const EPIC_Kernel::Vector_3 b = points[triangles[t + 1]] - r;
+    const EPIC_Kernel::Vector_3 c = points[triangles[t + 2]] - r;
+    const EPIC_Kernel::Vector_3 n = CGAL::cross_product (b - a, c - a);
+    area += std::sqrt (n.squared_length()) / 2;
+    volume += a * CGAL::cross_product (b, c) / 6;
+  }
+}
+
+// hulls of nb_clusters clusters, cluster_indices(c, indices) filling
+// indices with the rows of the points of cluster c
+template <typename Cluster_indices>
+Convex_hulls_3 convex_hulls (const std::vector<Point>& points, std::size_t nb_clusters,
+                             const Cluster_indices& cluster_indices, bool extreme_points_only)
+{
+  std::vector<std::vector<int> > vertices (nb_clusters), triangles (nb_clusters);
+  std::vector<double> areas (nb_clusters), volumes (nb_clusters);
+  std::vector<std::size_t> clusters (nb_clusters);
+  for (std::size_t c = 0; c < nb_clusters; ++ c)
+    clusters[c] = c;
+  CGAL::for_each<Concurrency_tag>
+    (clusters, [&](const std::size_t& c) -> bool
+     {
+       std::vector<std::size_t> indices;
+       cluster_indices (c, indices);
+       convex_hull_of_indices (points, indices, extreme_points_only, vertices[c], triangles[c]);
+       measure (points, triangles[c], areas[c], volumes[c]);
+       return true;
+     });
+
+  Convex_hulls_3 result;
+  for (std::size_t c = 0; c < nb_clusters; ++ c)
+  {
+    result.vertices().insert (result.vertices().end(), vertices[c].begin(), vertices[c].end());
+    result.triangles().insert (result.triangles().end(), triangles[c].begin(), triangles[c].end());
+    result.vertex_offsets().push_back (int(result.vertices().size()));
+    result.triangle_offsets().push_back (int(result.triangles().size() / 3));
+  }
+  result.areas().swap (areas);
+  result.volumes().swap (volumes);
+  return result;
+}
+
+inline std::vector<Point> read_points (const SWIG_CGAL::Buffer<double>& points)
+{
+  if (points.size() % 3 != 0 || (points.cols() != 1 && points.cols() != 3))
+    throw std::invalid_argument ("The points must be given as rows of 3 coordinates");
+  std::vector<Point> out;
+  out.reserve (points.size() / 3);
+  for (std::size_t i = 0; i < points.size(); i += 3)
+    out.push_back (Point (points.data()[i], points.data()[i + 1], points.data()[i + 2]));
+  return out;
+}
+
+} // namespace SWIG_Convex_hull_3
+#endif
+
+// Convex hull of the rows (x, y, z) of points, returned as one hull of
+// Convex_hulls_3 without building a polyhedron. If extreme_points_only is
+// true, only the vertices of the hull are computed. Large inputs are first
+// reduced by culling in parallel the points lying strictly inside the hull
+// of a few extreme points.
+inline Convex_hulls_3 convex_hull_3_arrays (SWIG_CGAL::Buffer<double> points,
+                                            bool extreme_points_only = false)
+{
+  const std::vector<SWIG_Convex_hull_3::Point> pts = SWIG_Convex_hull_3::read_points (points);
+  return SWIG_Convex_hull_3::convex_hulls
+    (pts, 1, [&](std::size_t, std::vector<std::size_t>& indices)
+     {
+       indices.resize (pts.size());
+       for (std::size_t i = 0; i < indices.size(); ++ i)
+         indices[i] = i;
+     }, extreme_points_only);
+}
+
+// Convex hulls of clusters of points, cluster c being made of the rows
+// [offsets[c], offsets[c+1]) of points. The hulls are computed in parallel
+// when linked with TBB.
+inline Convex_hulls_3 convex_hulls_3_arrays (SWIG_CGAL::Buffer<double> points,
+                                             SWIG_CGAL::Buffer<int> offsets,
+                                             bool extreme_points_only = false)
+{
+  const std::vector<SWIG_Convex_hull_3::Point> pts = SWIG_Convex_hull_3::read_points (points);
+  const std::size_t nb_clusters = offsets.size() == 0 ? 0 : offsets.size() - 1;
+  for (std::size_t c = 0; c < nb_clusters; ++ c)
+    if (offsets.data()[c] < 0 || offsets.data()[c] > offsets.data()[c + 1]
+        || std::size_t(offsets.data()[c + 1]) > pts.size())
+      throw std::invalid_argument ("The offsets must be increasing rows of the points");
+  return SWIG_Convex_hull_3::convex_hulls
+    (pts, nb_clusters, [&](std::size_t c, std::vector<std::size_t>& indices)
+     {
+       for (int i = offsets.data()[c]; i < offsets.data()[c + 1]; ++ i)
+         indices.push_back (std::size_t(i));
+     }, extreme_points_only);
+}
+
+// Same as convex_hulls_3_arrays(), the cluster of the row i of points being
+// labels[i] (-1 for none). Hull l is the one of label l, for l in [0, max
+// label], empty if the label has no points. The hull volumes and areas are
+// in volume_array() and area_array().
+inline Convex_hulls_3 convex_hulls_by_label (SWIG_CGAL::Buffer<double> points,
+                                             SWIG_CGAL::Buffer<int> labels)
+{
+  const std::vector<SWIG_Convex_hull_3::Point> pts = SWIG_Convex_hull_3::read_points (points);
+  if (labels.size() != pts.size())
+    throw std::invalid_argument ("There must be one label per point");
+
+  // rows of the points sorted by label
+  std::vector<std::size_t> offsets (1, 0);
+  for (std::size_t i = 0; i < labels.size(); ++ i)
+  {
+    const int l = labels.data()[i];
+    if (l < -1)
+      throw std::invalid_argument ("Invalid label");
+    if (l >= 0 && std::size_t(l) + 2 > offsets.size())
+      offsets.resize (std::size_t(l) + 2, 0);
+    if (l >= 0)
+      ++ offsets[std::size_t(l) + 1];
+  }
+  for (std::size_t l = 1; l < offsets.size(); ++ l)
+    offsets[l] += offsets[l - 1];
+  std::vector<std::size_t> rows (offsets.back());
+  std::vector<std::size_t> next (offsets.begin(), offsets.end() - 1);
+  for (std::size_t i = 0; i < labels.size(); ++ i)
+    if (labels.data()[i] >= 0)
+      rows[next[std::size_t(labels.data()[i])] ++] = i;
+
+  return SWIG_Convex_hull_3::convex_hulls
+    (pts, offsets.size() - 1, [&](std::size_t l, std::vector<std::size_t>& indices)
+     {
+       indices.assign (rows.begin() + offsets[l], rows.begin() + offsets[l + 1]);
+     }, false);
+}
+
+#endif // SWIG_CGAL_CONVEX_HULL_3_CONVEX_HULL_3_ARRAYS_H
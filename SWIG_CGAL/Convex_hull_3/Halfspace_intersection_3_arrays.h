@@ -0,0 +1,261 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+
+#ifndef SWIG_CGAL_CONVEX_HULL_3_HALFSPACE_INTERSECTION_3_ARRAYS_H
+#define SWIG_CGAL_CONVEX_HULL_3_HALFSPACE_INTERSECTION_3_ARRAYS_H
+
+#include <SWIG_CGAL/Common/Buffer.h>
+
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#ifndef SWIG
+#include <SWIG_CGAL/Kernel/typedefs.h>
+#include <SWIG_CGAL/Convex_hull_3/Convex_hull_3_arrays.h>
+#include <CGAL/Convex_hull_3/dual/halfspace_intersection_3.h>
+#include <CGAL/Convex_hull_3/dual/halfspace_intersection_interior_point_3.h>
+#include <CGAL/Surface_mesh.h>
+#include <CGAL/QP_models.h>
+#include <CGAL/QP_functions.h>
+#include <CGAL/for_each.h>
+#ifdef CGAL_USE_GMP
+#include <CGAL/Gmpzf.h>
+#else
+#include <CGAL/MP_Float.h>
+#endif
+#endif
+
+// Result of halfspace_intersections_3_arrays(). The vertices and the
+// triangles of polytope p are the rows [vertex_offsets[p],
+// vertex_offsets[p+1]) of vertex_array() and [triangle_offsets[p],
+// triangle_offsets[p+1]) of triangle_array(), the triangles being the
+// faces of the polytope triangulated as fans, oriented outward, and given
+// as rows of vertex_array(). A polytope with an empty interior has no
+// vertices.
+class Polytopes_3
+{
+  std::shared_ptr<std::vector<double> > points_sptr;
+  std::shared_ptr<std::vector<int> > triangles_sptr;
+  std::shared_ptr<std::vector<int> > vertex_offsets_sptr;
+  std::shared_ptr<std::vector<int> > triangle_offsets_sptr;
+
+  static SWIG_CGAL::Buffer<int> view (const std::shared_ptr<std::vector<int> >& v, std::size_t cols)
+  {
+    return SWIG_CGAL::Buffer<int>(v->data(), v->size() / cols, cols, v, true);
+  }
+
+public:
+  Polytopes_3()
+    : points_sptr(new std::vector<double>())
+    , triangles_sptr(new std::vector<int>())
+    , vertex_offsets_sptr(new std::vector<int>(1, 0))
+    , triangle_offsets_sptr(new std::vector<int>(1, 0)) {}
+
+  #ifndef SWIG
+  std::vector<double>& points() { return *points_sptr; }
+  std::vector<int>& triangles() { return *triangles_sptr; }
+  std::vector<int>& vertex_offsets() { return *vertex_offsets_sptr; }
+  std::vector<int>& triangle_offsets() { return *triangle_offsets_sptr; }
+  #endif
+
+  int number_of_polytopes() const { return int(vertex_offsets_sptr->size()) - 1; }
+
+  // (number of vertices, 3)
+  SWIG_CGAL::Buffer<double> vertex_array() const
+  {
+    return SWIG_CGAL::Buffer<double>(points_sptr->data(), points_sptr->size() / 3, 3, points_sptr, true);
+  }
+  // (number of triangles, 3)
+  SWIG_CGAL::Buffer<int> triangle_array() const { return view (triangles_sptr, 3); }
+  // (number_of_polytopes() + 1, 1)
+  SWIG_CGAL::Buffer<int> vertex_offset_array() const { return view (vertex_offsets_sptr, 1); }
+  // (number_of_polytopes() + 1, 1)
+  SWIG_CGAL::Buffer<int> triangle_offset_array() const { return view (triangle_offsets_sptr, 1); }
+};
+
+#ifndef SWIG
+namespace SWIG_Convex_hull_3 {
+
+#ifdef CGAL_USE_GMP
+typedef CGAL::Gmpzf LP_exact_type;
+#else
+typedef CGAL::MP_Float LP_exact_type;
+#endif
+
+typedef EPIC_Kernel::Plane_3 Plane;
+
+// the rows (a, b, c, d) of planes, each one being the halfspace
+// a*x + b*y + c*z + d <= 0
+inline std::vector<Plane> read_planes (const SWIG_CGAL::Buffer<double>& planes)
+{
+  if (planes.size() % 4 != 0 || (planes.cols() != 1 && planes.cols() != 4))
+    throw std::invalid_argument ("The planes must be given as rows of 4 coefficients");
+  std::vector<Plane> out;
+  out.reserve (planes.size() / 4);
+  for (std::size_t i = 0; i < planes.size(); i += 4)
+    out.push_back (Plane (planes.data()[i], planes.data()[i + 1], planes.data()[i + 2], planes.data()[i + 3]));
+  return out;
+}
+
+// the sets [offsets[s], offsets[s+1]) of the planes
+inline std::size_t number_of_sets (const SWIG_CGAL::Buffer<int>& offsets, std::size_t nb_planes)
+{
+  const std::size_t nb_sets = offsets.size() == 0 ? 0 : offsets.size() - 1;
+  for (std::size_t s = 0; s < nb_sets; ++ s)
+    if (offsets.data()[s] < 0 || offsets.data()[s] > offsets.data()[s + 1]
+        || std::size_t(offsets.data()[s + 1]) > nb_planes)
+      throw std::invalid_argument ("The offsets must be increasing rows of the planes");
+  return nb_sets;
+}
+
+// Whether the intersection of the closed halfspaces of the planes of both
+// ranges is not empty: feasibility of a linear program solved exactly,
+// without building the polytopes.
+inline bool halfspaces_intersect (const Plane* first1, const Plane* last1,
+                                  const Plane* first2, const Plane* last2)
+{
+  CGAL::Quadratic_program<double> lp (CGAL::SMALLER, false, 0, false, 0);
+  int row = 0;
+  const auto add_rows = [&](const Plane* first, const Plane* last)
+  {
+    for (const Plane* p = first; p != last; ++ p, ++ row)
+    {
+      lp.set_a (0, row, p->a());
+      lp.set_a (1, row, p->b());
+      lp.set_a (2, row, p->c());
+      lp.set_b (row, -p->d());
+    }
+  };
+  add_rows (first1, last1);
+  add_rows (first2, last2);
+  if (row == 0)
+    return true;
+  const CGAL::Quadratic_program_solution<LP_exact_type> solution
+    = CGAL::solve_linear_program (lp, LP_exact_type());
+  return !solution.is_infeasible();
+}
+
+// polytope of the planes, appended to points and triangles (the indices of
+// the triangles starting at 0), nothing if its interior is empty
+inline void halfspace_intersection (const Plane* first, const Plane* last,
+                                    std::vector<double>& points, std::vector<int>& triangles)
+{
+  typedef CGAL::Surface_mesh<EPIC_Kernel::Point_3> Mesh;
+  if (first == last)
+    return;
+  const auto origin = CGAL::halfspace_intersection_interior_point_3 (first, last);
+  if (!origin)
+    return;
+  Mesh mesh;
+  CGAL::halfspace_intersection_3 (first, last, mesh, origin);
+  for (Mesh::Vertex_index v : mesh.vertices())
+  {
+    points.push_back (mesh.point(v).x());
+    points.push_back (mesh.point(v).y());
+    points.push_back (mesh.point(v).z());
+  }
+  // the indices of the vertices are contiguous as none was removed
+  for (Mesh::Face_index f : mesh.faces())
+  {
+    const Mesh::Halfedge_index h0 = mesh.halfedge(f);
+    Mesh::Halfedge_index h = mesh.next(h0);
+    for (; mesh.next(h) != h0; h = mesh.next(h))
+    {
+      triangles.push_back (int(mesh.target(h0)));
+      triangles.push_back (int(mesh.target(h)));
+      triangles.push_back (int(mesh.target(mesh.next(h))));
+    }
+  }
+}
+
+} // namespace SWIG_Convex_hull_3
+#endif
+
+// Same as halfspace_intersection_3() for each set of planes, set s being
+// the rows [offsets[s], offsets[s+1]) of the (N, 4) array of the
+// coefficients (a, b, c, d) of the halfspaces a*x + b*y + c*z + d <= 0. A
+// point of the interior of each polytope is computed by a linear program,
+// and the polytopes are computed in parallel when linked with TBB. As for
+// halfspace_intersection_3(), the polytopes must be bounded.
+inline Polytopes_3 halfspace_intersections_3_arrays (SWIG_CGAL::Buffer<double> planes,
+                                                     SWIG_CGAL::Buffer<int> offsets)
+{
+  const std::vector<SWIG_Convex_hull_3::Plane> pl = SWIG_Convex_hull_3::read_planes (planes);
+  const std::size_t nb_sets = SWIG_Convex_hull_3::number_of_sets (offsets, pl.size());
+
+  std::vector<std::vector<double> > points (nb_sets);
+  std::vector<std::vector<int> > triangles (nb_sets);
+  std::vector<std::size_t> sets (nb_sets);
+  for (std::size_t s = 0; s < nb_sets; ++ s)
+    sets[s] = s;
+  CGAL::for_each<SWIG_Convex_hull_3::Concurrency_tag>
+    (sets, [&](const std::size_t& s) -> bool
+     {
+       SWIG_Convex_hull_3::halfspace_intersection (pl.data() + offsets.data()[s], pl.data() + offsets.data()[s + 1],
+                                                   points[s], triangles[s]);
+       return true;
+     });
+
+  Polytopes_3 result;
+  for (std::size_t s = 0; s < nb_sets; ++ s)
+  {
+    const int first_vertex = result.vertex_offsets().back();
+    result.points().insert (result.points().end(), points[s].begin(), points[s].end());
+    for (int v : triangles[s])
+      result.triangles().push_back (first_vertex + v);
+    result.vertex_offsets().push_back (int(result.points().size() / 3));
+    result.triangle_offsets().push_back (int(result.triangles().size() / 3));
+  }
+  return result;
+}
+
+// Whether the convex polytopes of the halfspaces of planes1 and of planes2
+// (rows (a, b, c, d), see halfspace_intersections_3_arrays()) intersect,
+// their boundaries included. No polytope is constructed.
+inline bool do_intersect_polytopes_3 (SWIG_CGAL::Buffer<double> planes1,
+                                      SWIG_CGAL::Buffer<double> planes2)
+{
+  const std::vector<SWIG_Convex_hull_3::Plane> p1 = SWIG_Convex_hull_3::read_planes (planes1);
+  const std::vector<SWIG_Convex_hull_3::Plane> p2 = SWIG_Convex_hull_3::read_planes (planes2);
+  return SWIG_Convex_hull_3::halfspaces_intersect (p1.data(), p1.data() + p1.size(),
+                                                   p2.data(), p2.data() + p2.size());
+}
+
+// Same as do_intersect_polytopes_3() for each row (s, t) of pairs, s and t
+// being sets of planes (see halfspace_intersections_3_arrays()). Returns 1
+// for the pairs of polytopes that intersect, 0 for the others. The pairs
+// are tested in parallel when linked with TBB.
+inline SWIG_CGAL::Buffer<int> do_intersect_polytopes_3_arrays (SWIG_CGAL::Buffer<double> planes,
+                                                               SWIG_CGAL::Buffer<int> offsets,
+                                                               SWIG_CGAL::Buffer<int> pairs)
+{
+  const std::vector<SWIG_Convex_hull_3::Plane> pl = SWIG_Convex_hull_3::read_planes (planes);
+  const std::size_t nb_sets = SWIG_Convex_hull_3::number_of_sets (offsets, pl.size());
+  if (pairs.size() % 2 != 0)
+    throw std::invalid_argument ("The pairs must be given as rows of 2 sets");
+  for (std::size_t i = 0; i < pairs.size(); ++ i)
+    if (pairs.data()[i] < 0 || std::size_t(pairs.data()[i]) >= nb_sets)
+      throw std::out_of_range ("Invalid set of planes");
+
+  const std::size_t nb_pairs = pairs.size() / 2;
+  std::vector<int> result (nb_pairs);
+  std::vector<std::size_t> indices (nb_pairs);
+  for (std::size_t i = 0; i < nb_pairs; ++ i)
+    indices[i] = i;
+  const SWIG_Convex_hull_3::Plane* p = pl.data();
+  const int* o = offsets.data();
+  CGAL::for_each<SWIG_Convex_hull_3::Concurrency_tag>
+    (indices, [&](const std::size_t& i) -> bool
+     {
+       const int s = pairs.data()[2 * i], t = pairs.data()[2 * i + 1];
+       result[i] = SWIG_Convex_hull_3::halfspaces_intersect (p + o[s], p + o[s + 1], p + o[t], p + o[t + 1]) ? 1 : 0;
+       return true;
+     });
+  return SWIG_CGAL::Buffer<int> (std::move (result));
+}
+
+#endif // SWIG_CGAL_CONVEX_HULL_3_HALFSPACE_INTERSECTION_3_ARRAYS_H
@@ -33,6 +33,7 @@ SWIG_CGAL_package_common()
 %}
 
 //definitions
+%include "SWIG_CGAL/HalfedgeDS/HalfedgeDS_arrays.h"
 %include "SWIG_CGAL/HalfedgeDS/HalfedgeDS.h"
 %include "SWIG_CGAL/HalfedgeDS/HalfedgeDS_handles.h"
 %include "SWIG_CGAL/HalfedgeDS/HalfedgeDS_decorator.h"
@@ -11,6 +11,7 @@
 #include <SWIG_CGAL/HalfedgeDS/HalfedgeDS_handles.h>
 #include <SWIG_CGAL/Kernel/Point_2.h>
 #include <SWIG_CGAL/HalfedgeDS/General_modifier.h>
+#include <SWIG_CGAL/HalfedgeDS/HalfedgeDS_arrays.h>
 #include <boost/shared_ptr.hpp>
 
 template < class HDS_cpp >
@@ -108,6 +109,39 @@ public:
   void deepcopy(const Self& other){get_data()=other.get_data();}
 //For convenience add the modifier mechanism
   void delegate(General_modifier<HDS_cpp> modifier){modifier(get_data());}
+//Arrays
+  // from a (V,2) array of vertices and a (F,k) array of vertex indices of
+  // polygons with k vertices (a one-dimensional array holds triangles)
+  static Self from_arrays(SWIG_CGAL::Buffer<double> vertices, SWIG_CGAL::Buffer<int> faces)
+  {
+    const std::size_t k = faces.cols()==1 ? 3 : faces.cols();
+    if (vertices.size()%2!=0 || k<3 || faces.size()%k!=0)
+      throw std::invalid_argument("Expecting (V,2) vertices and (F,k) vertex indices with k>=3");
+    Self hds;
+    SWIG_HalfedgeDS::Build_from_arrays<HDS_cpp>
+      builder(vertices.data(), vertices.size()/2, faces.data(), faces.size()/k, k);
+    builder(hds.get_data());
+    return hds;
+  }
+  // (size_of_vertices(), 2), in the order of vertices()
+  SWIG_CGAL::Buffer<double> vertex_array()
+  {
+    return SWIG_CGAL::Buffer<double>(SWIG_HalfedgeDS::vertex_coordinates(get_data()), 2);
+  }
+  // (size_of_faces(), k), in the order of faces(), the faces having k vertices
+  SWIG_CGAL::Buffer<int> face_array()
+  {
+    std::size_t k;
+    std::vector<int> faces = SWIG_HalfedgeDS::face_vertices(get_data(), k);
+    return SWIG_CGAL::Buffer<int>(std::move(faces), k==0 ? 3 : k);
+  }
+  // the incidences of all the elements as index arrays
+  HalfedgeDS_topology topology()
+  {
+    HalfedgeDS_topology out;
+    SWIG_HalfedgeDS::export_topology(get_data(), out);
+    return out;
+  }
 
   #ifndef SWIG
   Self& operator=(const Self& other)
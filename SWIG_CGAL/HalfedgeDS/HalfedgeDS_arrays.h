@@ -0,0 +1,214 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+
+#ifndef SWIG_CGAL_HALFEDGEDS_HALFEDGEDS_ARRAYS_H
+#define SWIG_CGAL_HALFEDGEDS_HALFEDGEDS_ARRAYS_H
+
+#include <SWIG_CGAL/Common/Buffer.h>
+
+#ifndef SWIG
+#include <CGAL/Modifier_base.h>
+#include <CGAL/Polyhedron_incremental_builder_3.h>
+
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#endif
+
+#include <memory>
+#include <vector>
+
+// Topology of a halfedge data structure as index arrays: the vertices, the
+// halfedges and the faces are numbered in the order of vertices(),
+// halfedges() and faces(), -1 standing for no element (the face of a border
+// halfedge, the halfedge of an isolated vertex).
+class HalfedgeDS_topology
+{
+  std::shared_ptr<std::vector<int> > next_sptr;
+  std::shared_ptr<std::vector<int> > prev_sptr;
+  std::shared_ptr<std::vector<int> > opposite_sptr;
+  std::shared_ptr<std::vector<int> > vertex_sptr;
+  std::shared_ptr<std::vector<int> > face_sptr;
+  std::shared_ptr<std::vector<int> > vertex_halfedge_sptr;
+  std::shared_ptr<std::vector<int> > face_halfedge_sptr;
+
+  static SWIG_CGAL::Buffer<int> view(const std::shared_ptr<std::vector<int> >& v)
+  {
+    return SWIG_CGAL::Buffer<int>(v->data(), v->size(), 1, v, true);
+  }
+
+public:
+  HalfedgeDS_topology()
+    : next_sptr(new std::vector<int>())
+    , prev_sptr(new std::vector<int>())
+    , opposite_sptr(new std::vector<int>())
+    , vertex_sptr(new std::vector<int>())
+    , face_sptr(new std::vector<int>())
+    , vertex_halfedge_sptr(new std::vector<int>())
+    , face_halfedge_sptr(new std::vector<int>()) {}
+  #ifndef SWIG
+  std::vector<int>& next() const { return *next_sptr; }
+  std::vector<int>& prev() const { return *prev_sptr; }
+  std::vector<int>& opposite() const { return *opposite_sptr; }
+  std::vector<int>& vertex() const { return *vertex_sptr; }
+  std::vector<int>& face() const { return *face_sptr; }
+  std::vector<int>& vertex_halfedge() const { return *vertex_halfedge_sptr; }
+  std::vector<int>& face_halfedge() const { return *face_halfedge_sptr; }
+  #endif
+
+  // (H,) for each halfedge: the next and previous halfedges around its
+  // face, its opposite, its target vertex and its face
+  SWIG_CGAL::Buffer<int> next_array() const { return view(next_sptr); }
+  SWIG_CGAL::Buffer<int> prev_array() const { return view(prev_sptr); }
+  SWIG_CGAL::Buffer<int> opposite_array() const { return view(opposite_sptr); }
+  SWIG_CGAL::Buffer<int> vertex_array() const { return view(vertex_sptr); }
+  SWIG_CGAL::Buffer<int> face_array() const { return view(face_sptr); }
+  // (V,) a halfedge targeting each vertex, (F,) a halfedge of each face
+  SWIG_CGAL::Buffer<int> vertex_halfedge_array() const { return view(vertex_halfedge_sptr); }
+  SWIG_CGAL::Buffer<int> face_halfedge_array() const { return view(face_halfedge_sptr); }
+};
+
+#ifndef SWIG
+namespace SWIG_HalfedgeDS {
+
+// Builds a halfedge data structure from nb_vertices coordinate pairs and
+// nb_faces polygons of k vertex indices, stored contiguously. The arrays
+// must outlive the call.
+template <class HDS>
+class Build_from_arrays : public CGAL::Modifier_base<HDS>
+{
+  const double* vertices;
+  std::size_t nb_vertices;
+  const int* faces;
+  std::size_t nb_faces;
+  std::size_t k;
+public:
+  Build_from_arrays(const double* vertices, std::size_t nb_vertices,
+                    const int* faces, std::size_t nb_faces, std::size_t k)
+    : vertices(vertices), nb_vertices(nb_vertices), faces(faces), nb_faces(nb_faces), k(k)
+  {}
+
+  void operator()(HDS& hds)
+  {
+    typedef typename HDS::Vertex::Point Point;
+    for (std::size_t i = 0; i < nb_faces * k; ++i)
+      if (faces[i] < 0 || std::size_t(faces[i]) >= nb_vertices)
+        throw std::invalid_argument("Vertex index out of range");
+    CGAL::Polyhedron_incremental_builder_3<HDS> B(hds, false);
+    B.begin_surface(nb_vertices, nb_faces, 2 * nb_faces * k);
+    for (std::size_t i = 0; i < nb_vertices; ++i)
+      B.add_vertex(Point(vertices[2 * i], vertices[2 * i + 1]));
+    for (std::size_t f = 0; f < nb_faces; ++f)
+    {
+      if (!B.test_facet(faces + k * f, faces + k * (f + 1)))
+      {
+        B.rollback();
+        throw std::invalid_argument("The faces do not form an oriented 2-manifold (face "
+                                    + std::to_string(f) + ")");
+      }
+      B.add_facet(faces + k * f, faces + k * (f + 1));
+    }
+    B.end_surface();
+    if (B.error())
+    {
+      B.rollback();
+      throw std::invalid_argument("The faces do not form a valid surface");
+    }
+  }
+};
+
+// index of each element of [begin, end), in this order
+template <class Iterator>
+std::unordered_map<const void*, int> indices(Iterator begin, Iterator end)
+{
+  std::unordered_map<const void*, int> out;
+  int i = 0;
+  for (; begin != end; ++begin)
+    out.emplace(&*begin, i++);
+  return out;
+}
+
+template <class Handle>
+int index_of(const std::unordered_map<const void*, int>& indices, Handle h)
+{
+  if (h == Handle()) return -1;
+  return indices.find(&*h)->second;
+}
+
+template <class HDS>
+void export_topology(HDS& hds, HalfedgeDS_topology& out)
+{
+  const std::unordered_map<const void*, int> vertex_ids = indices(hds.vertices_begin(), hds.vertices_end());
+  const std::unordered_map<const void*, int> halfedge_ids = indices(hds.halfedges_begin(), hds.halfedges_end());
+  const std::unordered_map<const void*, int> face_ids = indices(hds.faces_begin(), hds.faces_end());
+  const std::size_t nb_halfedges = halfedge_ids.size();
+  out.next().resize(nb_halfedges);
+  out.prev().resize(nb_halfedges);
+  out.opposite().resize(nb_halfedges);
+  out.vertex().resize(nb_halfedges);
+  out.face().resize(nb_halfedges);
+  std::size_t i = 0;
+  for (typename HDS::Halfedge_iterator h = hds.halfedges_begin(); h != hds.halfedges_end(); ++h, ++i)
+  {
+    out.next()[i] = index_of(halfedge_ids, h->next());
+    out.prev()[i] = index_of(halfedge_ids, h->prev());
+    out.opposite()[i] = index_of(halfedge_ids, h->opposite());
+    out.vertex()[i] = index_of(vertex_ids, h->vertex());
+    out.face()[i] = h->is_border() ? -1 : index_of(face_ids, h->face());
+  }
+  out.vertex_halfedge().clear();
+  out.vertex_halfedge().reserve(vertex_ids.size());
+  for (typename HDS::Vertex_iterator v = hds.vertices_begin(); v != hds.vertices_end(); ++v)
+    out.vertex_halfedge().push_back(index_of(halfedge_ids, v->halfedge()));
+  out.face_halfedge().clear();
+  out.face_halfedge().reserve(face_ids.size());
+  for (typename HDS::Face_iterator f = hds.faces_begin(); f != hds.faces_end(); ++f)
+    out.face_halfedge().push_back(index_of(halfedge_ids, f->halfedge()));
+}
+
+// (V,2) coordinates of the vertices, in the order of vertices()
+template <class HDS>
+std::vector<double> vertex_coordinates(HDS& hds)
+{
+  std::vector<double> out;
+  out.reserve(2 * hds.size_of_vertices());
+  for (typename HDS::Vertex_iterator v = hds.vertices_begin(); v != hds.vertices_end(); ++v)
+  {
+    out.push_back(v->point().x());
+    out.push_back(v->point().y());
+  }
+  return out;
+}
+
+// (F,k) vertex indices of the faces, in the order of faces(), which must
+// all have k vertices (k being set from the first face)
+template <class HDS>
+std::vector<int> face_vertices(HDS& hds, std::size_t& k)
+{
+  const std::unordered_map<const void*, int> vertex_ids = indices(hds.vertices_begin(), hds.vertices_end());
+  std::vector<int> out;
+  k = 0;
+  for (typename HDS::Face_iterator f = hds.faces_begin(); f != hds.faces_end(); ++f)
+  {
+    std::size_t degree = 0;
+    typename HDS::Halfedge_handle h = f->halfedge();
+    do {
+      out.push_back(index_of(vertex_ids, h->vertex()));
+      ++degree;
+      h = h->next();
+    } while (h != f->halfedge());
+    if (k == 0) k = degree;
+    else if (degree != k)
+      throw std::invalid_argument("The faces do not all have the same number of vertices");
+  }
+  return out;
+}
+
+} // namespace SWIG_HalfedgeDS
+#endif
+
+#endif //SWIG_CGAL_HALFEDGEDS_HALFEDGEDS_ARRAYS_H
@@ -9,6 +9,7 @@
 
 #include <SWIG_CGAL/HalfedgeDS/typedefs.h>
 #include <SWIG_CGAL/HalfedgeDS/HalfedgeDS.h>
+#include <SWIG_CGAL/HalfedgeDS/HalfedgeDS_arrays.h>
 #include <SWIG_CGAL/HalfedgeDS/HalfedgeDS_handles.h>
 #include <SWIG_CGAL/HalfedgeDS/HalfedgeDS_decorator.h>
 
@@ -34,6 +34,14 @@ SWIG_CGAL_package_common()
 
 
 %include "SWIG_CGAL/Common/Input_iterator_wrapper.h"
+
+//typemaps for the interpolation of arrays of values at arrays of query points
+//and for the surface neighbor coordinates of arrays of query points
+%include "SWIG_CGAL/typemaps.i"
+SWIG_CGAL_buffer_of_double_typemap_in
+SWIG_CGAL_buffer_of_double_typemap_out
+SWIG_CGAL_buffer_of_int_typemap_out
+SWIG_CGAL_buffer_of_signed_char_typemap_out
 %import  "SWIG_CGAL/Triangulation_2/CGAL_Triangulation_2.i"
 %import  "SWIG_CGAL/Triangulation_3/CGAL_Triangulation_3.i"
 %import  "SWIG_CGAL/Kernel/CGAL_Kernel.i"
@@ -63,6 +71,26 @@ SWIG_CGAL_declare_identifier_of_template_class(Data_access_vector_2,Data_access_
 %include "SWIG_CGAL/Interpolation/declare_surface_neighbor_coordinates_3.i"
 %include "SWIG_CGAL/Interpolation/declare_interpolation_functions.i"
 
+//interpolation of the values at the vertices, given in the order of the finite vertices, at arrays of points,
+//and surface neighbor coordinates of arrays of points
+SWIG_CGAL_release_gil(surface_neighbor_coordinates_3_arrays)
+%include "SWIG_CGAL/Interpolation/Interpolation_arrays.h"
+%{
+  #include <SWIG_CGAL/Interpolation/Interpolation_arrays.h>
+%}
+SWIG_CGAL_release_gil(natural_neighbor_interpolate_grid)
+SWIG_CGAL_release_gil(sibson_gradient_fitting_nn_2_arrays)
+%inline %{
+  SWIG_CGAL::Buffer<double> natural_neighbor_interpolate_grid(const Delaunay_triangulation_2_SWIG_wrapper& dt, SWIG_CGAL::Buffer<double> values, SWIG_CGAL::Buffer<double> query_points, Interpolation_method method=LINEAR_INTERPOLATION, double default_value=std::numeric_limits<double>::quiet_NaN(), SWIG_CGAL::Buffer<double> gradients=SWIG_CGAL::Buffer<double>()){
+    return SWIG_Interpolation::natural_neighbor_interpolate_grid(dt.get_data(),values,query_points,method,default_value,gradients);
+  }
+
+  //(V,2) gradients at the finite vertices, NaN on the convex hull
+  SWIG_CGAL::Buffer<double> sibson_gradient_fitting_nn_2_arrays(const Delaunay_triangulation_2_SWIG_wrapper& dt, SWIG_CGAL::Buffer<double> values){
+    return SWIG_Interpolation::sibson_gradient_fitting_nn_2(dt.get_data(),values);
+  }
+%}
+
 
 #ifdef SWIG_CGAL_HAS_Interpolation_USER_PACKAGE
 %include "SWIG_CGAL/User_packages/Interpolation/extensions.i"
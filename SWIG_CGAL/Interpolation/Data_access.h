@@ -8,8 +8,11 @@
 #define SWIG_CGAL_INTERPOLATION_DATA_ACCESS_H
 
 #include <SWIG_CGAL/Common/Macros.h>
+#include <SWIG_CGAL/Common/Buffer.h>
 #include <CGAL/interpolation_functions.h>
 
+#include <stdexcept>
+
 namespace internal
 {
   template <class T>
@@ -20,6 +23,16 @@ namespace internal
   {
     typedef T map_type;
   };
+
+  #ifndef SWIG
+  //value of a row of an array of values
+  inline void read_value(const double* row, double& value){ value=row[0]; }
+  template <class Vector_2>
+  void read_value(const double* row, Vector_2& value){ value=Vector_2(row[0],row[1]); }
+  inline std::size_t value_size(double){ return 1; }
+  template <class Vector_2>
+  std::size_t value_size(const Vector_2&){ return 2; }
+  #endif
 }
 
 template <class Cpp_base,class Point,class Value_type>
@@ -48,6 +61,24 @@ public:
     m_map.insert(std::make_pair(p.get_data(),internal::make_conversion(value)));
   }
   
+  //sets the values of the points given as rows (x,y) from the rows of values,
+  //one coordinate for double values and two for vectors
+  void set_from_arrays(SWIG_CGAL::Buffer<double> points, SWIG_CGAL::Buffer<double> values)
+  {
+    typedef typename Map::key_type Cpp_point;
+    typedef typename Map::mapped_type Cpp_value;
+    const std::size_t d=internal::value_size(Cpp_value());
+    if (points.size()%2!=0 || values.size()!=d*(points.size()/2))
+      throw std::invalid_argument("There must be one value per point");
+    const std::size_t n=points.size()/2;
+    m_map.reserve(m_map.size()+n);
+    for (std::size_t i=0;i<n;++i){
+      Cpp_value value;
+      internal::read_value(values.data()+d*i,value);
+      m_map.insert(std::make_pair(Cpp_point(points.data()[2*i],points.data()[2*i+1]),value));
+    }
+  }
+
   Value_type get(const Point& p) const
   {
     return Value_type( m_map.find(p.get_data())->second );
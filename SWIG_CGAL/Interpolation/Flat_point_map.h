@@ -0,0 +1,116 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+
+#ifndef SWIG_CGAL_INTERPOLATION_FLAT_POINT_MAP_H
+#define SWIG_CGAL_INTERPOLATION_FLAT_POINT_MAP_H
+
+#include <cstddef>
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace SWIG_Interpolation {
+
+// Map from points to values for CGAL::Data_access, storing its entries
+// contiguously in insertion order and finding them with an open addressing
+// hash table of their indices (linear probing on the hash of the
+// coordinates). As with std::map, inserting a point already in the map
+// leaves its value unchanged. Iterators are invalidated by insertions.
+template <class Point, class T>
+class Flat_point_map
+{
+public:
+  typedef Point key_type;
+  typedef T mapped_type;
+  typedef std::pair<Point, T> value_type;
+  typedef typename std::vector<value_type>::iterator iterator;
+  typedef typename std::vector<value_type>::const_iterator const_iterator;
+
+private:
+  std::vector<value_type> m_entries;
+  std::vector<int> m_slots; // index of an entry, -1 if empty
+
+  static std::size_t hash (const Point& p)
+  {
+    std::size_t h = std::hash<double>() (p.x());
+    return h ^ (std::hash<double>() (p.y()) + 0x9e3779b9 + (h << 6) + (h >> 2));
+  }
+
+  // slot of p, or the empty slot where it would be inserted
+  std::size_t slot (const Point& p) const
+  {
+    const std::size_t mask = m_slots.size() - 1;
+    std::size_t s = hash (p) & mask;
+    while (m_slots[s] != -1 && !(m_entries[m_slots[s]].first == p))
+      s = (s + 1) & mask;
+    return s;
+  }
+
+  void rehash (std::size_t nb_slots)
+  {
+    m_slots.assign (nb_slots, -1);
+    for (std::size_t i = 0; i < m_entries.size(); ++ i)
+      m_slots[slot (m_entries[i].first)] = int(i);
+  }
+
+public:
+  Flat_point_map() : m_slots (16, -1) {}
+
+  std::size_t size() const { return m_entries.size(); }
+  bool empty() const { return m_entries.empty(); }
+  iterator begin() { return m_entries.begin(); }
+  iterator end() { return m_entries.end(); }
+  const_iterator begin() const { return m_entries.begin(); }
+  const_iterator end() const { return m_entries.end(); }
+
+  void clear()
+  {
+    m_entries.clear();
+    m_slots.assign (16, -1);
+  }
+
+  void reserve (std::size_t n)
+  {
+    m_entries.reserve (n);
+    std::size_t nb_slots = m_slots.size();
+    while (nb_slots < 2 * n)
+      nb_slots *= 2;
+    if (nb_slots != m_slots.size())
+      rehash (nb_slots);
+  }
+
+  const_iterator find (const Point& p) const
+  {
+    const int i = m_slots[slot (p)];
+    return i == -1 ? end() : begin() + i;
+  }
+  iterator find (const Point& p)
+  {
+    const int i = m_slots[slot (p)];
+    return i == -1 ? end() : begin() + i;
+  }
+
+  std::pair<iterator, bool> insert (const value_type& v)
+  {
+    std::size_t s = slot (v.first);
+    if (m_slots[s] != -1)
+      return std::make_pair (begin() + m_slots[s], false);
+    if (2 * (m_entries.size() + 1) > m_slots.size()) // load factor at most 1/2
+    {
+      rehash (2 * m_slots.size());
+      s = slot (v.first);
+    }
+    m_slots[s] = int(m_entries.size());
+    m_entries.push_back (v);
+    return std::make_pair (end() - 1, true);
+  }
+  // for std::inserter, the hint is ignored
+  iterator insert (const_iterator, const value_type& v) { return insert (v).first; }
+};
+
+} // namespace SWIG_Interpolation
+
+#endif //SWIG_CGAL_INTERPOLATION_FLAT_POINT_MAP_H
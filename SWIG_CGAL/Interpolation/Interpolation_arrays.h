@@ -0,0 +1,447 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+
+#ifndef SWIG_CGAL_INTERPOLATION_INTERPOLATION_ARRAYS_H
+#define SWIG_CGAL_INTERPOLATION_INTERPOLATION_ARRAYS_H
+
+#include <SWIG_CGAL/Common/Buffer.h>
+
+#include <memory>
+#include <vector>
+
+// interpolants of natural_neighbor_interpolate_grid()
+enum Interpolation_method { LINEAR_INTERPOLATION, SIBSON_C1_INTERPOLATION,
+                            SIBSON_C1_SQUARE_INTERPOLATION, QUADRATIC_INTERPOLATION };
+
+#ifndef SWIG
+#include <SWIG_CGAL/Common/Spatial_insertion.h>
+#include <SWIG_CGAL/Interpolation/typedefs.h>
+#include <CGAL/Handle_hash_function.h>
+#include <CGAL/Orthogonal_k_neighbor_search.h>
+#include <CGAL/Search_traits_3.h>
+#include <CGAL/Search_traits_adapter.h>
+#include <CGAL/Spatial_sort_traits_adapter_2.h>
+#include <CGAL/property_map.h>
+#include <CGAL/function_objects.h>
+#include <CGAL/for_each.h>
+#include <CGAL/tags.h>
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+
+namespace SWIG_Interpolation {
+
+#ifdef CGAL_LINKED_WITH_TBB
+typedef CGAL::Parallel_tag Concurrency_tag;
+#else
+typedef CGAL::Sequential_tag Concurrency_tag;
+#endif
+
+// Function giving the data of a vertex from its id, the data of the vertex
+// of id i being data[i] (undefined if defined is not null and defined[i]
+// is 0)
+template <class Vertex_handle, class T>
+struct Vertex_data
+{
+  typedef Vertex_handle argument_type;
+  typedef std::pair<T, bool> result_type;
+  typedef std::unordered_map<Vertex_handle, int, CGAL::Handle_hash_function> Vertex_ids;
+
+  const Vertex_ids& ids;
+  const std::vector<T>& data;
+  const std::vector<char>* defined;
+
+  Vertex_data (const Vertex_ids& ids, const std::vector<T>& data, const std::vector<char>* defined = nullptr)
+    : ids(ids), data(data), defined(defined) {}
+
+  result_type operator() (const Vertex_handle& v) const
+  {
+    typename Vertex_ids::const_iterator it = ids.find (v);
+    if (it == ids.end() || (defined != nullptr && !(*defined)[it->second]))
+      return result_type (T(), false);
+    return result_type (data[it->second], true);
+  }
+};
+
+// first indices of the chunks of chunk_size of n elements
+inline std::vector<std::size_t> chunk_begins (std::size_t n, std::size_t chunk_size)
+{
+  std::vector<std::size_t> chunks;
+  for (std::size_t begin = 0; begin < n; begin += chunk_size)
+    chunks.push_back (begin);
+  return chunks;
+}
+
+// the finite vertices of dt, and their ids in this order
+template <class Dt>
+void number_finite_vertices (const Dt& dt, std::vector<typename Dt::Vertex_handle>& vertices,
+                             typename Vertex_data<typename Dt::Vertex_handle, double>::Vertex_ids& ids)
+{
+  vertices.reserve (dt.number_of_vertices());
+  ids.reserve (dt.number_of_vertices());
+  for (typename Dt::Finite_vertices_iterator v = dt.finite_vertices_begin(); v != dt.finite_vertices_end(); ++ v)
+  {
+    ids[v] = int(vertices.size());
+    vertices.push_back (v);
+  }
+}
+
+// Sibson's gradients of the function at the vertices (given by their ids),
+// undefined on the convex hull, as CGAL::sibson_gradient_fitting_nn_2().
+// The natural neighbor coordinates of the vertices only read dt, and the
+// gradients are fitted by chunks, concurrently with CGAL::Parallel_tag.
+template <class Dt, class Values>
+void fit_sibson_gradients (const Dt& dt, const std::vector<typename Dt::Vertex_handle>& vertices,
+                           const Values& value_function,
+                           std::vector<EPIC_Kernel::Vector_2>& gradients, std::vector<char>& has_gradient)
+{
+  typedef typename Dt::Vertex_handle Vertex_handle;
+  const std::size_t nv = vertices.size();
+  gradients.assign (nv, CGAL::NULL_VECTOR);
+  has_gradient.assign (nv, 0);
+  if (dt.dimension() < 2)
+    return;
+  const std::size_t chunk_size = 256;
+  CGAL::for_each<Concurrency_tag>
+    (chunk_begins (nv, chunk_size), [&](const std::size_t& begin) -> bool
+     {
+       std::vector<std::pair<Vertex_handle, double> > coordinates;
+       const std::size_t end = (std::min) (begin + chunk_size, nv);
+       for (std::size_t i = begin; i < end; ++ i)
+       {
+         const Vertex_handle v = vertices[i];
+         if (dt.is_edge (v, dt.infinite_vertex()))
+           continue;
+         coordinates.clear();
+         const CGAL::Triple<std::back_insert_iterator<std::vector<std::pair<Vertex_handle, double> > >, double, bool> res
+           = CGAL::natural_neighbor_coordinates_2 (dt, v, std::back_inserter (coordinates),
+                                                   CGAL::Identity<std::pair<Vertex_handle, double> >());
+         if (!res.third)
+           continue;
+         gradients[i] = CGAL::sibson_gradient_fitting (coordinates.begin(), coordinates.end(), res.second, v->point(),
+                                                       value_function,
+                                                       CGAL::Interpolation_gradient_fitting_traits_2<EPIC_Kernel>());
+         has_gradient[i] = 1;
+       }
+       return true;
+     });
+}
+
+// (V,2) Sibson's gradients at the finite vertices of dt, in their order, of
+// the function of values given in the same order. The rows of the vertices
+// on the convex hull are NaN.
+template <class Dt>
+SWIG_CGAL::Buffer<double> sibson_gradient_fitting_nn_2 (const Dt& dt, const SWIG_CGAL::Buffer<double>& values)
+{
+  typedef typename Dt::Vertex_handle Vertex_handle;
+  typedef Vertex_data<Vertex_handle, double> Values;
+
+  if (values.size() != dt.number_of_vertices())
+    throw std::invalid_argument ("There must be one value per vertex of the triangulation");
+  std::vector<Vertex_handle> vertices;
+  typename Values::Vertex_ids ids;
+  number_finite_vertices (dt, vertices, ids);
+  const std::vector<double> vertex_values (values.data(), values.data() + values.size());
+  std::vector<EPIC_Kernel::Vector_2> gradients;
+  std::vector<char> has_gradient;
+  fit_sibson_gradients (dt, vertices, Values (ids, vertex_values), gradients, has_gradient);
+
+  std::vector<double> result (2 * vertices.size(), std::numeric_limits<double>::quiet_NaN());
+  for (std::size_t i = 0; i < vertices.size(); ++ i)
+    if (has_gradient[i])
+    {
+      result[2 * i] = gradients[i].x();
+      result[2 * i + 1] = gradients[i].y();
+    }
+  return SWIG_CGAL::Buffer<double> (std::move (result), 2);
+}
+
+// Values at the queries (rows of 2 coordinates) of the function given by
+// its values at the vertices of dt, in the order of the finite vertices.
+// The C1 interpolants use the (V,2) gradients given in the same order (a
+// row with a NaN for a vertex without gradient), or Sibson's gradients (see
+// sibson_gradient_fitting_nn_2()) if gradients is empty.
+// The queries are located sequentially, in the order of a Hilbert sort and
+// each from the face of the previous one, as the walks of Triangulation_2
+// use its random generator. The coordinates and the interpolants are then
+// computed by chunks, concurrently with CGAL::Parallel_tag, from the
+// boundary of the conflict zone of the query, not relocated.
+template <class Dt>
+SWIG_CGAL::Buffer<double> natural_neighbor_interpolate_grid (const Dt& dt,
+                                                             const SWIG_CGAL::Buffer<double>& values,
+                                                             const SWIG_CGAL::Buffer<double>& queries,
+                                                             Interpolation_method method,
+                                                             double default_value,
+                                                             const SWIG_CGAL::Buffer<double>& gradients)
+{
+  typedef typename Dt::Vertex_handle Vertex_handle;
+  typedef typename Dt::Face_handle Face_handle;
+  typedef typename Dt::Edge Edge;
+  typedef EPIC_Kernel::Point_2 Point;
+  typedef EPIC_Kernel::Vector_2 Vector;
+  typedef SWIG_CGAL::Array_point_map<Point, 2> Point_map;
+  typedef Vertex_data<Vertex_handle, double> Values;
+  typedef Vertex_data<Vertex_handle, Vector> Gradients;
+
+  if (values.size() != dt.number_of_vertices())
+    throw std::invalid_argument ("There must be one value per vertex of the triangulation");
+  if (gradients.size() != 0 && SWIG_CGAL::number_of_rows (gradients, 2) != dt.number_of_vertices())
+    throw std::invalid_argument ("There must be one gradient per vertex of the triangulation");
+  const std::size_t n = SWIG_CGAL::number_of_rows (queries, 2);
+  const double* coords = queries.data();
+  std::vector<double> result (n, default_value);
+
+  std::vector<Vertex_handle> vertices;
+  typename Values::Vertex_ids ids;
+  number_finite_vertices (dt, vertices, ids);
+  const std::vector<double> vertex_values (values.data(), values.data() + values.size());
+  const Values value_function (ids, vertex_values);
+  if (dt.dimension() < 2)
+    return SWIG_CGAL::Buffer<double> (std::move (result));
+
+  std::vector<Vector> vertex_gradients;
+  std::vector<char> has_gradient;
+  if (method != LINEAR_INTERPOLATION)
+  {
+    if (gradients.size() == 0)
+      fit_sibson_gradients (dt, vertices, value_function, vertex_gradients, has_gradient);
+    else
+    {
+      vertex_gradients.resize (vertices.size(), CGAL::NULL_VECTOR);
+      has_gradient.resize (vertices.size(), 0);
+      for (std::size_t i = 0; i < vertices.size(); ++ i)
+      {
+        const double gx = gradients.data()[2 * i], gy = gradients.data()[2 * i + 1];
+        if (std::isnan (gx) || std::isnan (gy))
+          continue;
+        vertex_gradients[i] = Vector (gx, gy);
+        has_gradient[i] = 1;
+      }
+    }
+  }
+  const Gradients gradient_function (ids, vertex_gradients, &has_gradient);
+
+  std::vector<std::size_t> order (n);
+  for (std::size_t i = 0; i < n; ++ i)
+    order[i] = i;
+  CGAL::spatial_sort (order.begin(), order.end(),
+                      CGAL::Spatial_sort_traits_adapter_2<EPIC_Kernel, Point_map> (Point_map (coords, 2)));
+  std::vector<Face_handle> faces (n);
+  std::vector<typename Dt::Locate_type> types (n);
+  Face_handle hint;
+  for (std::size_t k = 0; k < n; ++ k)
+  {
+    const std::size_t i = order[k];
+    int li;
+    faces[i] = dt.locate (Point (coords[2 * i], coords[2 * i + 1]), types[i], li, hint);
+    if (types[i] == Dt::VERTEX)
+      result[i] = vertex_values[ids[faces[i]->vertex (li)]];
+    if (types[i] == Dt::EDGE || types[i] == Dt::FACE)
+      hint = faces[i];
+  }
+
+  const std::size_t chunk_size = 1024;
+  CGAL::for_each<Concurrency_tag>
+    (chunk_begins (n, chunk_size), [&](const std::size_t& begin) -> bool
+     {
+       std::vector<Edge> hole;
+       std::vector<std::pair<Vertex_handle, double> > coordinates;
+       const std::size_t end = (std::min) (begin + chunk_size, n);
+       for (std::size_t k = begin; k < end; ++ k)
+       {
+         const std::size_t i = order[k];
+         if (types[i] != Dt::EDGE && types[i] != Dt::FACE)
+           continue;
+         const Point p (coords[2 * i], coords[2 * i + 1]);
+         hole.clear();
+         coordinates.clear();
+         dt.get_boundary_of_conflicts (p, std::back_inserter (hole), faces[i]);
+         const double norm = CGAL::natural_neighbor_coordinates_2
+           (dt, p, std::back_inserter (coordinates),
+            CGAL::Identity<std::pair<Vertex_handle, double> >(), hole.begin(), hole.end()).second;
+         if (method != LINEAR_INTERPOLATION)
+         {
+           const CGAL::Interpolation_traits_2<EPIC_Kernel> traits;
+           std::pair<double, bool> res;
+           if (method == SIBSON_C1_INTERPOLATION)
+             res = CGAL::sibson_c1_interpolation (coordinates.begin(), coordinates.end(), norm, p,
+                                                  value_function, gradient_function, traits);
+           else if (method == SIBSON_C1_SQUARE_INTERPOLATION)
+             res = CGAL::sibson_c1_interpolation_square (coordinates.begin(), coordinates.end(), norm, p,
+                                                         value_function, gradient_function, traits);
+           else
+             res = CGAL::quadratic_interpolation (coordinates.begin(), coordinates.end(), norm, p,
+                                                  value_function, gradient_function, traits);
+           if (res.second)
+           {
+             result[i] = res.first;
+             continue;
+           }
+         }
+         // linear interpolation, also used where some gradients are missing
+         double value = 0;
+         for (std::size_t j = 0; j < coordinates.size(); ++ j)
+           value += coordinates[j].second * value_function (coordinates[j].first).first;
+         result[i] = value / norm;
+       }
+       return true;
+     });
+  return SWIG_CGAL::Buffer<double> (std::move (result));
+}
+
+} // namespace SWIG_Interpolation
+#endif
+
+// Result of surface_neighbor_coordinates_3_arrays(): the surface neighbors
+// of query q are the rows [offsets[q], offsets[q+1]) of index_array(),
+// indices of rows of the input points, and weight_array() holds their
+// coordinates divided by their sum. status_array()[q] is 0 if the
+// coordinates could not be computed (no neighbors then), 1 if they were and
+// 2 if they are moreover certified, that is if the k nearest points were
+// enough to find all the surface neighbors among the input points.
+class Neighbor_coordinates_3
+{
+  std::shared_ptr<std::vector<int> > offsets_sptr;
+  std::shared_ptr<std::vector<int> > indices_sptr;
+  std::shared_ptr<std::vector<double> > weights_sptr;
+  std::shared_ptr<std::vector<signed char> > status_sptr;
+
+public:
+  Neighbor_coordinates_3()
+    : offsets_sptr(new std::vector<int>(1, 0))
+    , indices_sptr(new std::vector<int>())
+    , weights_sptr(new std::vector<double>())
+    , status_sptr(new std::vector<signed char>()) {}
+
+  #ifndef SWIG
+  std::vector<int>& offsets() { return *offsets_sptr; }
+  std::vector<int>& indices() { return *indices_sptr; }
+  std::vector<double>& weights() { return *weights_sptr; }
+  std::vector<signed char>& status() { return *status_sptr; }
+  #endif
+
+  int number_of_queries() const { return int(offsets_sptr->size()) - 1; }
+
+  // (number_of_queries() + 1, 1)
+  SWIG_CGAL::Buffer<int> offset_array() const
+  {
+    return SWIG_CGAL::Buffer<int>(offsets_sptr->data(), offsets_sptr->size(), 1, offsets_sptr, true);
+  }
+  // (number of neighbors, 1)
+  SWIG_CGAL::Buffer<int> index_array() const
+  {
+    return SWIG_CGAL::Buffer<int>(indices_sptr->data(), indices_sptr->size(), 1, indices_sptr, true);
+  }
+  // (number of neighbors, 1)
+  SWIG_CGAL::Buffer<double> weight_array() const
+  {
+    return SWIG_CGAL::Buffer<double>(weights_sptr->data(), weights_sptr->size(), 1, weights_sptr, true);
+  }
+  // (number_of_queries(), 1)
+  SWIG_CGAL::Buffer<signed char> status_array() const
+  {
+    return SWIG_CGAL::Buffer<signed char>(status_sptr->data(), status_sptr->size(), 1, status_sptr, true);
+  }
+};
+
+// Surface neighbor coordinates of each query point (row of queries) with
+// the normal of the same row of normals, among the rows of points. A single
+// kd-tree of the points is built and the coordinates of a query are
+// computed from its k nearest points only, concurrently when linked with
+// TBB.
+inline Neighbor_coordinates_3 surface_neighbor_coordinates_3_arrays (SWIG_CGAL::Buffer<double> points,
+                                                                     SWIG_CGAL::Buffer<double> queries,
+                                                                     SWIG_CGAL::Buffer<double> normals,
+                                                                     int k = 32)
+{
+  typedef EPIC_Kernel::Point_3 Point;
+  typedef EPIC_Kernel::Vector_3 Vector;
+  typedef CGAL::Pointer_property_map<Point>::const_type Point_map;
+  typedef CGAL::Search_traits_adapter<std::size_t, Point_map, CGAL::Search_traits_3<EPIC_Kernel> > Traits;
+  typedef CGAL::Orthogonal_k_neighbor_search<Traits> Neighbor_search;
+  typedef Neighbor_search::Tree Tree;
+  typedef Neighbor_search::Distance Distance;
+
+  if (k < 1)
+    throw std::invalid_argument ("Number of neighbors must be positive");
+  const std::size_t n = SWIG_CGAL::number_of_rows (points, 3);
+  const std::size_t m = SWIG_CGAL::number_of_rows (queries, 3);
+  if (SWIG_CGAL::number_of_rows (normals, 3) != m)
+    throw std::invalid_argument ("There must be one normal per query point");
+  std::vector<Point> pts;
+  pts.reserve (n);
+  for (std::size_t i = 0; i < n; ++ i)
+    pts.push_back (Point (points.data()[3 * i], points.data()[3 * i + 1], points.data()[3 * i + 2]));
+
+  Neighbor_coordinates_3 result;
+  result.status().assign (m, 0);
+  std::vector<std::vector<std::pair<int, double> > > coordinates (m);
+  if (n != 0)
+  {
+    std::vector<std::size_t> rows (n);
+    for (std::size_t i = 0; i < n; ++ i)
+      rows[i] = i;
+    const Point_map point_map (pts.data());
+    Tree tree (rows.begin(), rows.end(), Tree::Splitter(), Traits (point_map));
+    tree.build();  // the tree must be built before concurrent queries
+    const Distance distance (point_map);
+
+    std::vector<std::size_t> query_ids (m);
+    for (std::size_t q = 0; q < m; ++ q)
+      query_ids[q] = q;
+    CGAL::for_each<SWIG_Interpolation::Concurrency_tag>
+      (query_ids, [&](const std::size_t& q) -> bool
+       {
+         const double* c = queries.data() + 3 * q;
+         const double* v = normals.data() + 3 * q;
+         const Point p (c[0], c[1], c[2]);
+         std::vector<std::size_t> candidates;
+         std::vector<Point> neighborhood;
+         double squared_radius = 0;
+         Neighbor_search search (tree, p, unsigned(k), 0, true, distance);
+         for (Neighbor_search::iterator it = search.begin(); it != search.end(); ++ it)
+         {
+           candidates.push_back (it->first);
+           neighborhood.push_back (pts[it->first]);
+           squared_radius = (std::max) (squared_radius, it->second);
+         }
+         std::vector<std::pair<Point, double> > coords;
+         const CGAL::Quadruple<std::back_insert_iterator<std::vector<std::pair<Point, double> > >, double, bool, bool> res
+           = CGAL::surface_neighbor_coordinates_certified_3
+               (neighborhood.begin(), neighborhood.end(), p, Vector (v[0], v[1], v[2]),
+                std::sqrt (squared_radius), std::back_inserter (coords), EPIC_Kernel());
+         if (!res.third || coords.empty())
+           return true;
+         for (std::size_t j = 0; j < coords.size(); ++ j)
+         {
+           // the neighbors are among the k candidates, found back from their point
+           const std::size_t c = std::size_t (std::find (neighborhood.begin(), neighborhood.end(), coords[j].first)
+                                              - neighborhood.begin());
+           coordinates[q].push_back (std::make_pair (int(candidates[c]), coords[j].second / res.second));
+         }
+         result.status()[q] = res.fourth ? 2 : 1;
+         return true;
+       });
+  }
+
+  for (std::size_t q = 0; q < m; ++ q)
+  {
+    for (std::size_t j = 0; j < coordinates[q].size(); ++ j)
+    {
+      result.indices().push_back (coordinates[q][j].first);
+      result.weights().push_back (coordinates[q][j].second);
+    }
+    result.offsets().push_back (int(result.indices().size()));
+  }
+  return result;
+}
+
+#endif //SWIG_CGAL_INTERPOLATION_INTERPOLATION_ARRAYS_H
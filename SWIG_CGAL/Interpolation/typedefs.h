@@ -14,11 +14,11 @@
 #include <CGAL/Interpolation_traits_2.h>
 #include <CGAL/sibson_gradient_fitting.h>
 #include <CGAL/Interpolation_gradient_fitting_traits_2.h>
+#include <SWIG_CGAL/Interpolation/Flat_point_map.h>
 //typedefs for the package
-#include <map>
-typedef std::map<EPIC_Kernel::Point_2,double,EPIC_Kernel::Less_xy_2> I_MPD;
+typedef SWIG_Interpolation::Flat_point_map<EPIC_Kernel::Point_2,double> I_MPD;
 typedef CGAL::Data_access<I_MPD> I_DA_PD;
-typedef std::map<EPIC_Kernel::Point_2,EPIC_Kernel::Vector_2,EPIC_Kernel::Less_xy_2> I_MPV2;
+typedef SWIG_Interpolation::Flat_point_map<EPIC_Kernel::Point_2,EPIC_Kernel::Vector_2> I_MPV2;
 typedef CGAL::Data_access<I_MPV2> I_DA_PV2;
 
 #ifndef SWIG
@@ -0,0 +1,64 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+package CGAL.Java;
+
+import java.util.concurrent.CompletableFuture;
+import java.util.concurrent.ExecutorService;
+import java.util.concurrent.Executors;
+import java.util.concurrent.ThreadFactory;
+import java.util.concurrent.atomic.AtomicInteger;
+import java.util.function.Supplier;
+
+// Asynchronous calls of the long running functions of the bindings
+// (make_mesh_3, isotropic_remeshing, alpha_wrap_3, registration...):
+//   CompletableFuture<Mesh_3_Complex_3_in_triangulation_3> c3t3 =
+//     Async.supply(() -> CGAL_Mesh_3.make_mesh_3(domain, criteria));
+// The calls are run by worker threads shared by all the modules, 1 by
+// default (each call then uses the threads of CGAL_Kernel.get_num_threads()),
+// or the value of the environment variable CGAL_SWIG_ASYNC_WORKERS. The
+// arguments of a call must not be used before its future is completed.
+public class Async {
+  private static ExecutorService executor = null;
+  private static int workers = 0;
+
+  private static synchronized ExecutorService executor() {
+    if (executor == null) {
+      int n = workers;
+      if (n <= 0) {
+        try {
+          n = Integer.parseInt(System.getenv("CGAL_SWIG_ASYNC_WORKERS"));
+        } catch (NumberFormatException e) {
+          n = 1;
+        }
+      }
+      final AtomicInteger count = new AtomicInteger();
+      // daemon threads: pending calls do not keep the JVM alive
+      executor = Executors.newFixedThreadPool(Math.max(1, n), new ThreadFactory() {
+        public Thread newThread(Runnable r) {
+          Thread t = new Thread(r, "CGAL_async-" + count.incrementAndGet());
+          t.setDaemon(true);
+          return t;
+        }
+      });
+    }
+    return executor;
+  }
+
+  // the calls already submitted are run by the previous workers
+  public static synchronized void set_workers(int n) {
+    if (executor != null) executor.shutdown();
+    executor = null;
+    workers = Math.max(0, n);
+  }
+
+  public static <T> CompletableFuture<T> supply(Supplier<T> call) {
+    return CompletableFuture.supplyAsync(call, executor());
+  }
+
+  public static CompletableFuture<Void> run(Runnable call) {
+    return CompletableFuture.runAsync(call, executor());
+  }
+}
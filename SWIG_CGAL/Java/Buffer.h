@@ -0,0 +1,164 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+
+#ifndef SWIG_CGAL_JAVA_BUFFER_H
+#define SWIG_CGAL_JAVA_BUFFER_H
+
+#include <jni.h>
+#include <climits>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+
+#include <SWIG_CGAL/Common/Buffer.h>
+
+namespace SWIG_CGAL {
+
+// name and signature of the method of java.nio.ByteBuffer returning
+// the typed view of the bytes
+template <typename T> struct Java_buffer_traits;
+
+#define SWIG_CGAL_DECLARE_JAVA_BUFFER_TRAITS(T, METHOD, JCLASS)                       \
+template <> struct Java_buffer_traits<T> {                                            \
+  static const char* method() { return METHOD; }                                      \
+  static const char* signature() { return "()Ljava/nio/" JCLASS ";"; }                \
+};
+
+SWIG_CGAL_DECLARE_JAVA_BUFFER_TRAITS(double,         "asDoubleBuffer", "DoubleBuffer")
+SWIG_CGAL_DECLARE_JAVA_BUFFER_TRAITS(float,          "asFloatBuffer",  "FloatBuffer")
+SWIG_CGAL_DECLARE_JAVA_BUFFER_TRAITS(int,            "asIntBuffer",    "IntBuffer")
+SWIG_CGAL_DECLARE_JAVA_BUFFER_TRAITS(unsigned int,   "asIntBuffer",    "IntBuffer")
+SWIG_CGAL_DECLARE_JAVA_BUFFER_TRAITS(long long,      "asLongBuffer",   "LongBuffer")
+SWIG_CGAL_DECLARE_JAVA_BUFFER_TRAITS(unsigned short, "asShortBuffer",  "ShortBuffer")
+SWIG_CGAL_DECLARE_JAVA_BUFFER_TRAITS(signed char,    "slice",          "ByteBuffer")
+SWIG_CGAL_DECLARE_JAVA_BUFFER_TRAITS(unsigned char,  "slice",          "ByteBuffer")
+
+#undef SWIG_CGAL_DECLARE_JAVA_BUFFER_TRAITS
+
+// Makes the owner of the storage of a view live as long as the direct
+// ByteBuffer mapped on it, the buffers derived from it referencing it (see
+// CGAL.Java.Buffer_owners). Returns false with a pending Java exception on
+// failure.
+inline bool keep_owner_alive(JNIEnv* jenv, jobject bytes_buffer, const std::shared_ptr<void>& owner)
+{
+  if (!owner)
+    return true;
+  jclass owners_class = jenv->FindClass("CGAL/Java/Buffer_owners");
+  if (owners_class == nullptr)
+    return false;
+  jmethodID keep_alive_id = jenv->GetStaticMethodID(owners_class, "keep_alive", "(Ljava/lang/Object;J)V");
+  if (keep_alive_id == nullptr)
+    return false;
+  std::shared_ptr<void>* handle = new std::shared_ptr<void>(owner);
+  jenv->CallStaticVoidMethod(owners_class, keep_alive_id, bytes_buffer,
+                             static_cast<jlong>(reinterpret_cast<std::intptr_t>(handle)));
+  if (jenv->ExceptionCheck())
+  {
+    delete handle;
+    return false;
+  }
+  return true;
+}
+
+// Returns a java.nio buffer in native byte order on the values of `buffer`.
+// A view is directly mapped on the C++ storage, which the Java buffer keeps
+// alive with the owner of the view. Owned values are copied into a buffer
+// allocated and managed by the JVM. The capacity of a java.nio buffer being
+// an int, buffers of more than INT_MAX bytes throw an
+// IllegalArgumentException (returning nullptr) instead of being truncated.
+template <typename T>
+jobject buffer_to_java(JNIEnv* jenv, const Buffer<T>& buffer)
+{
+  if (buffer.size() > std::size_t(INT_MAX) / sizeof(T))
+  {
+    jclass exception_class = jenv->FindClass("java/lang/IllegalArgumentException");
+    if (exception_class != nullptr)
+      jenv->ThrowNew(exception_class, "The array exceeds the 2 GiB capacity of a java.nio buffer");
+    return nullptr;
+  }
+  const jlong bytes = jlong(buffer.size() * sizeof(T));
+
+  jclass byte_buffer_class = jenv->FindClass("java/nio/ByteBuffer");
+  if (byte_buffer_class == nullptr)
+    return nullptr;
+
+  jobject bytes_buffer = nullptr;
+  if (buffer.is_view() && !buffer.empty())
+  {
+    bytes_buffer = jenv->NewDirectByteBuffer(buffer.data(), bytes);
+    if (bytes_buffer != nullptr && !keep_owner_alive(jenv, bytes_buffer, buffer.owner()))
+      return nullptr;
+  }
+  else
+  {
+    jmethodID allocate_id = jenv->GetStaticMethodID(byte_buffer_class, "allocateDirect",
+                                                    "(I)Ljava/nio/ByteBuffer;");
+    if (allocate_id == nullptr)
+      return nullptr;
+    bytes_buffer = jenv->CallStaticObjectMethod(byte_buffer_class, allocate_id, jint(bytes));
+    if (bytes_buffer != nullptr && bytes != 0)
+      std::memcpy(jenv->GetDirectBufferAddress(bytes_buffer), buffer.data(), std::size_t(bytes));
+  }
+  if (bytes_buffer == nullptr)
+    return nullptr;
+
+  jclass order_class = jenv->FindClass("java/nio/ByteOrder");
+  jmethodID native_order_id = jenv->GetStaticMethodID(order_class, "nativeOrder",
+                                                      "()Ljava/nio/ByteOrder;");
+  jobject native_order = jenv->CallStaticObjectMethod(order_class, native_order_id);
+  jmethodID order_id = jenv->GetMethodID(byte_buffer_class, "order",
+                                         "(Ljava/nio/ByteOrder;)Ljava/nio/ByteBuffer;");
+  bytes_buffer = jenv->CallObjectMethod(bytes_buffer, order_id, native_order);
+
+  if (buffer.is_readonly())
+  {
+    jmethodID readonly_id = jenv->GetMethodID(byte_buffer_class, "asReadOnlyBuffer",
+                                              "()Ljava/nio/ByteBuffer;");
+    bytes_buffer = jenv->CallObjectMethod(bytes_buffer, readonly_id);
+    // the typed view of a read-only ByteBuffer is read-only as well
+  }
+
+  jmethodID as_id = jenv->GetMethodID(byte_buffer_class, Java_buffer_traits<T>::method(),
+                                      Java_buffer_traits<T>::signature());
+  return jenv->CallObjectMethod(bytes_buffer, as_id);
+}
+
+// Builds a Buffer that borrows the memory of a direct java.nio buffer, on
+// the values between its position and its limit (as a slice of it would,
+// e.g. the nioBuffer() of a Netty ByteBuf viewed as a DoubleBuffer). The
+// Buffer is read-only if the java buffer is. Returns false if `jbuffer` is
+// not a direct buffer.
+template <typename T>
+bool java_to_buffer(JNIEnv* jenv, jobject jbuffer, Buffer<T>& buffer, std::size_t cols = 1)
+{
+  char* address = static_cast<char*>(jenv->GetDirectBufferAddress(jbuffer));
+  const jlong capacity = jenv->GetDirectBufferCapacity(jbuffer);
+  if (address == nullptr || capacity < 0)
+    return false;
+
+  jclass buffer_class = jenv->FindClass("java/nio/Buffer");
+  if (buffer_class == nullptr)
+    return false;
+  jmethodID position_id = jenv->GetMethodID(buffer_class, "position", "()I");
+  jmethodID limit_id = jenv->GetMethodID(buffer_class, "limit", "()I");
+  jmethodID readonly_id = jenv->GetMethodID(buffer_class, "isReadOnly", "()Z");
+  if (position_id == nullptr || limit_id == nullptr || readonly_id == nullptr)
+    return false;
+  const jint position = jenv->CallIntMethod(jbuffer, position_id);
+  const jint limit = jenv->CallIntMethod(jbuffer, limit_id);
+  const bool readonly = jenv->CallBooleanMethod(jbuffer, readonly_id) == JNI_TRUE;
+  if (jenv->ExceptionCheck() || position < 0 || limit < position || jlong(limit) > capacity)
+    return false;
+
+  buffer = Buffer<T>(reinterpret_cast<T*>(address + std::size_t(position) * sizeof(T)),
+                     std::size_t(limit - position) / cols, cols,
+                     std::shared_ptr<void>(), readonly);
+  return true;
+}
+
+} // namespace SWIG_CGAL
+
+#endif //SWIG_CGAL_JAVA_BUFFER_H
@@ -0,0 +1,56 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+package CGAL.Java;
+
+import java.lang.ref.PhantomReference;
+import java.lang.ref.ReferenceQueue;
+import java.util.Collections;
+import java.util.Set;
+import java.util.concurrent.ConcurrentHashMap;
+
+// Keeps alive the C++ storage the java.nio views returned by the bindings are
+// mapped on (see SWIG_CGAL/Java/Buffer.h): the owner of the storage, held in
+// C++ by a handle, is released once the buffer and all the buffers derived
+// from it (typed views, slices, duplicates) are unreachable.
+public final class Buffer_owners {
+  private static final class Owner_reference extends PhantomReference<Object> {
+    final long handle;
+
+    Owner_reference(Object buffer, long handle) {
+      super(buffer, queue);
+      this.handle = handle;
+    }
+  }
+
+  private static final ReferenceQueue<Object> queue = new ReferenceQueue<Object>();
+  // the references must stay reachable until they are enqueued
+  private static final Set<Owner_reference> references =
+    Collections.newSetFromMap(new ConcurrentHashMap<Owner_reference, Boolean>());
+
+  static {
+    Thread releaser = new Thread(() -> {
+      while (true) {
+        try {
+          Owner_reference reference = (Owner_reference) queue.remove();
+          references.remove(reference);
+          release(reference.handle);
+        } catch (InterruptedException e) {
+        }
+      }
+    }, "CGAL buffer owners");
+    releaser.setDaemon(true);
+    releaser.start();
+  }
+
+  private Buffer_owners() {}
+
+  // called by the bindings: `handle` is released when `buffer` is collected
+  public static void keep_alive(Object buffer, long handle) {
+    references.add(new Owner_reference(buffer, handle));
+  }
+
+  private static native void release(long handle);
+}
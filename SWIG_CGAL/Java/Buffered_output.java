@@ -0,0 +1,50 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2011 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------ 
+
+package CGAL.Java;
+
+import java.lang.reflect.Constructor;
+import java.util.AbstractList;
+import java.util.Collection;
+
+// Called from the output iterators of the bindings (Container_writer) with
+// a block of results, so that a function filling a collection makes one
+// JNI call per block instead of one per result.
+public class Buffered_output {
+  // The objects are made from the pointers to C++ objects, which they own,
+  // with the (long cPtr, boolean cMemoryOwn) constructor of the proxy class.
+  public static <T> void add_objects(Collection<T> container, final Class<T> type, final long[] pointers)
+    throws ReflectiveOperationException
+  {
+    final Constructor<T> constructor = type.getDeclaredConstructor(long.class, boolean.class);
+    constructor.setAccessible(true);
+    container.addAll(new AbstractList<T>() {
+      public T get(int i) {
+        try {
+          return constructor.newInstance(pointers[i], true);
+        } catch (ReflectiveOperationException e) {
+          throw new SWIGCGALException(e.toString());
+        }
+      }
+      public int size() { return pointers.length; }
+    });
+  }
+
+  public static void add_values(Collection<Integer> container, final int[] values)
+  {
+    container.addAll(new AbstractList<Integer>() {
+      public Integer get(int i) { return values[i]; }
+      public int size() { return values.length; }
+    });
+  }
+
+  public static void add_values(Collection<Double> container, final double[] values)
+  {
+    container.addAll(new AbstractList<Double>() {
+      public Double get(int i) { return values[i]; }
+      public int size() { return values.length; }
+    });
+  }
+}
@@ -24,6 +24,7 @@ SWIG_CGAL_package_common()
   //function called when library is loaded in Java
   JNIEXPORT jint JNICALL JNI_OnLoad(JavaVM *jvm, void *) {
     get_cached_jvm() = jvm;
+    attach_tbb_worker_threads();
     return JNI_VERSION_1_2;
   }
 %}
@@ -0,0 +1,49 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+package CGAL.Java;
+
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.DoubleBuffer;
+import java.nio.IntBuffer;
+
+// Arrays of a mesh, a point set or a triangulation in direct java.nio buffers,
+// as returned by the toDirectBuffers() methods:
+//   Polyhedron_3           vertices (V,3) and faces (F,3)
+//   Point_set_3            vertices (N,3) and normals (N,3), null without normals
+//   Triangulation_3 & co   vertices (V,3) and faces the cells (C,4)
+// The buffers get the arrays in one copy and can be handed to native code or
+// to networking libraries (e.g. Unpooled.wrappedBuffer() of Netty) without
+// copying them again. The buffers given to the fromDirectBuffers() and
+// toDirectBuffers(...) methods are used in place, between their position and
+// their limit, for instance slices of a larger direct buffer.
+public class Direct_buffers {
+  public final DoubleBuffer vertices;
+  public final IntBuffer faces;
+  public final DoubleBuffer normals;
+  // keeps alive the C++ storage the buffers are mapped on, if any
+  private final Object owner;
+
+  public Direct_buffers(DoubleBuffer vertices, IntBuffer faces, DoubleBuffer normals, Object owner) {
+    this.vertices = vertices;
+    this.faces = faces;
+    this.normals = normals;
+    this.owner = owner;
+  }
+
+  public Direct_buffers(DoubleBuffer vertices, IntBuffer faces, DoubleBuffer normals) {
+    this(vertices, faces, normals, null);
+  }
+
+  // direct buffers in native byte order, as expected by the bindings
+  public static DoubleBuffer allocate_doubles(long size) {
+    return ByteBuffer.allocateDirect(Math.toIntExact(size * 8)).order(ByteOrder.nativeOrder()).asDoubleBuffer();
+  }
+
+  public static IntBuffer allocate_ints(long size) {
+    return ByteBuffer.allocateDirect(Math.toIntExact(size * 4)).order(ByteOrder.nativeOrder()).asIntBuffer();
+  }
+}
@@ -10,8 +10,114 @@
 #include <boost/iterator/iterator_facade.hpp>
 #include <SWIG_CGAL/Java/global_functions.h>
 #include <SWIG_CGAL/Java/exception.h>
+#include <SWIG_CGAL/Java/Buffer.h>
+#include <SWIG_CGAL/Kernel/Profiling.h>
+#include <SWIG_CGAL/Kernel/typedefs.h>
+
+#include <memory>
+#include <stdexcept>
+#include <vector>
 
 #ifndef SWIG
+// Number of coordinates of a row of a CGAL.Java.Packed_iterator and
+// construction of the object of a row: only the points of the kernel are
+// constructed from coordinates (0 for the other types).
+template <class Cpp_base>
+struct Packed_row{
+  static const int size=0;
+  static Cpp_base make(const double*) { throw std::invalid_argument("Cannot be constructed from coordinates"); }
+};
+template <>
+struct Packed_row<EPIC_Kernel::Point_2>{
+  static const int size=2;
+  static EPIC_Kernel::Point_2 make(const double* r) { return EPIC_Kernel::Point_2(r[0],r[1]); }
+};
+template <>
+struct Packed_row<EPIC_Kernel::Point_3>{
+  static const int size=3;
+  static EPIC_Kernel::Point_3 make(const double* r) { return EPIC_Kernel::Point_3(r[0],r[1],r[2]); }
+};
+template <>
+struct Packed_row<EPIC_Kernel::Weighted_point_2>{
+  static const int size=3;
+  static EPIC_Kernel::Weighted_point_2 make(const double* r) { return EPIC_Kernel::Weighted_point_2(EPIC_Kernel::Point_2(r[0],r[1]),r[2]); }
+};
+template <>
+struct Packed_row<EPIC_Kernel::Weighted_point_3>{
+  static const int size=4;
+  static EPIC_Kernel::Weighted_point_3 make(const double* r) { return EPIC_Kernel::Weighted_point_3(EPIC_Kernel::Point_3(r[0],r[1],r[2]),r[3]); }
+};
+
+// The range of a CGAL.Java.Packed_iterator, read in one crossing of JNI:
+// either the objects constructed from rows of coordinates (a double[],
+// read in a critical region, or a direct DoubleBuffer), or the native
+// pointers of wrapped objects (a long[]). Returns false if `jiterator` is
+// a plain java.util.Iterator.
+template <class Cpp_base>
+bool read_packed_iterator(jobject jiterator,
+                          std::shared_ptr<std::vector<Cpp_base> >& values,
+                          std::shared_ptr<std::vector<jlong> >& pointers)
+{
+  JNIEnv* jenv=JNU_GetEnv();
+  jclass packed_class=jenv->FindClass("CGAL/Java/Packed_iterator");
+  if (packed_class==nullptr){
+    jenv->ExceptionClear(); //CGAL.Java not in the class path: only plain iterators
+    return false;
+  }
+  if (!jenv->IsInstanceOf(jiterator,packed_class)) return false;
+
+  jfieldID coordinates_id=jenv->GetFieldID(packed_class,"coordinates","[D");
+  jfieldID buffer_id=jenv->GetFieldID(packed_class,"buffer","Ljava/nio/DoubleBuffer;");
+  jfieldID pointers_id=jenv->GetFieldID(packed_class,"pointers","[J");
+  jfieldID dimension_id=jenv->GetFieldID(packed_class,"dimension","I");
+  JNI_THROW_ON_ERROR(coordinates_id,GetFieldID,"coordinates [D")
+  JNI_THROW_ON_ERROR(buffer_id,GetFieldID,"buffer Ljava/nio/DoubleBuffer;")
+  JNI_THROW_ON_ERROR(pointers_id,GetFieldID,"pointers [J")
+  JNI_THROW_ON_ERROR(dimension_id,GetFieldID,"dimension I")
+
+  jlongArray jpointers=(jlongArray) jenv->GetObjectField(jiterator,pointers_id);
+  if (jpointers!=nullptr){
+    pointers.reset(new std::vector<jlong>(std::size_t(jenv->GetArrayLength(jpointers))));
+    if (!pointers->empty())
+      jenv->GetLongArrayRegion(jpointers,0,jsize(pointers->size()),pointers->data());
+    for (jlong p : *pointers)
+      if (p==0) throw std::invalid_argument("Null object in a Packed_iterator");
+    return true;
+  }
+
+  const int dimension=jenv->GetIntField(jiterator,dimension_id);
+  if (Packed_row<Cpp_base>::size==0)
+    throw std::invalid_argument("A Packed_iterator of coordinates is only accepted for points");
+  if (dimension!=Packed_row<Cpp_base>::size)
+    throw std::invalid_argument("The rows of the Packed_iterator must have "+std::to_string(Packed_row<Cpp_base>::size)+" coordinates");
+  values.reset(new std::vector<Cpp_base>());
+
+  jdoubleArray jcoordinates=(jdoubleArray) jenv->GetObjectField(jiterator,coordinates_id);
+  if (jcoordinates!=nullptr){
+    const std::size_t size=std::size_t(jenv->GetArrayLength(jcoordinates));
+    if (size % dimension!=0)
+      throw std::invalid_argument("The number of coordinates is not a multiple of the dimension");
+    values->reserve(size/dimension);
+    const double* coordinates=static_cast<const double*>(jenv->GetPrimitiveArrayCritical(jcoordinates,nullptr));
+    JNI_THROW_ON_ERROR(coordinates,GetPrimitiveArrayCritical," ")
+    //no JNI call until released
+    for (std::size_t k=0; k<size; k+=dimension)
+      values->push_back(Packed_row<Cpp_base>::make(coordinates+k));
+    jenv->ReleasePrimitiveArrayCritical(jcoordinates,const_cast<double*>(coordinates),JNI_ABORT);
+    return true;
+  }
+
+  SWIG_CGAL::Buffer<double> buffer;
+  if (!SWIG_CGAL::java_to_buffer<double>(jenv,jenv->GetObjectField(jiterator,buffer_id),buffer))
+    throw std::invalid_argument("The buffer of a Packed_iterator must be a direct java.nio buffer");
+  if (buffer.size() % dimension!=0)
+    throw std::invalid_argument("The number of coordinates is not a multiple of the dimension");
+  values->reserve(buffer.size()/dimension);
+  for (std::size_t k=0; k<buffer.size(); k+=dimension)
+    values->push_back(Packed_row<Cpp_base>::make(buffer.data()+k));
+  return true;
+}
+
 struct Ref_counted_jdata{
   jobject jiterator; 
   jclass it_class,pt_class;
@@ -105,8 +211,24 @@ public boost::iterator_facade<
   Cpp_wrapper* current_ptr;
   jmethodID getCPtr_id, next_id, hasnext_id;
   Ref_counted_jdata rc;
-  
+  //range of a CGAL.Java.Packed_iterator (see read_packed_iterator())
+  std::shared_ptr<std::vector<Cpp_base> > packed_values;
+  std::shared_ptr<std::vector<jlong> > packed_pointers;
+  std::size_t packed_index;
+
+  bool is_end() const {
+    if (packed_values) return packed_index==packed_values->size();
+    return current_ptr==nullptr;
+  }
+
+  void update_with_next_packed(){
+    if (packed_pointers)
+      current_ptr = packed_index<packed_pointers->size() ? (Cpp_wrapper*) (*packed_pointers)[packed_index] : nullptr;
+  }
+
   void update_with_next_point(bool first=false){
+    //the first point is read in the typemap, before the call
+    SWIG_CGAL::Conversion_timer timer(first);
     if (static_cast<bool> (JNU_GetEnv()->CallBooleanMethod(rc.jiterator,hasnext_id)) )
     {
       jobject jpoint=JNU_GetEnv()->CallObjectMethod(rc.jiterator,next_id);
@@ -131,9 +253,17 @@ public boost::iterator_facade<
 public:
   
 
-  Input_iterator_wrapper():current_ptr(nullptr){}
-  Input_iterator_wrapper(const jobject& jiterator_,const char* sign):signature(sign),rc(jiterator_)
+  Input_iterator_wrapper():current_ptr(nullptr),packed_index(0){}
+  Input_iterator_wrapper(const jobject& jiterator_,const char* sign):signature(sign),current_ptr(nullptr),packed_index(0)
   {
+    {
+      SWIG_CGAL::Conversion_timer timer(true);
+      if (read_packed_iterator<Cpp_base>(jiterator_,packed_values,packed_pointers)){
+        update_with_next_packed();
+        return;
+      }
+    }
+    rc=Ref_counted_jdata(jiterator_);
     assert(rc.it_class!=nullptr);
     hasnext_id=JNU_GetEnv()->GetMethodID(rc.it_class, "hasNext", "()Z");
     JNI_THROW_ON_ERROR(hasnext_id,GetMethodID,"hasNext ()Z");
@@ -145,10 +275,25 @@ public:
   }
 
   
-  void increment(){assert(current_ptr!=nullptr); update_with_next_point();}
-  bool equal(const Input_iterator_wrapper & other) const{ return current_ptr==other.current_ptr; }
+  void increment(){
+    assert(!is_end());
+    if (packed_values || packed_pointers){
+      ++packed_index;
+      update_with_next_packed();
+    }
+    else
+      update_with_next_point();
+  }
+  //an end iterator is the default constructed one
+  bool equal(const Input_iterator_wrapper & other) const{
+    if (is_end() || other.is_end()) return is_end()==other.is_end();
+    return current_ptr==other.current_ptr && packed_index==other.packed_index;
+  }
   
-  typename Deref::result_type dereference() const { return Deref::dereference(current_ptr); }
+  typename Deref::result_type dereference() const {
+    if (packed_values) return (*packed_values)[packed_index];
+    return Deref::dereference(current_ptr);
+  }
 };
 
 
@@ -11,29 +11,30 @@
 
 void JavaData::init(jobject obj){
   if (obj!=nullptr){
-    cnt=new int(1);
+    cnt=new std::atomic<int>(1);
     data = JNU_GetEnv()->NewGlobalRef(obj);
   }
-  else
+  else{
+    cnt = nullptr;
     data = nullptr;
+  }
 }
 
 void JavaData::copy(const JavaData& d){
   cnt = d.cnt;
   data = d.data;
   if (d.data!=nullptr)
-    ++(*cnt);    
+    ++(*cnt);
 }
 
 void JavaData::clean(){
   if (data != nullptr){
-    --(*cnt);
-    if ((*cnt) == 0) {
+    if (--(*cnt) == 0) {
       JNU_GetEnv()->DeleteGlobalRef(data);
       delete cnt;
-      cnt=nullptr;
     }
   }
+  cnt=nullptr;
   data=nullptr;
 }
 
@@ -9,11 +9,15 @@
 
 #include <jni.h>
 #include <cassert>
+#include <atomic>
 #include <SWIG_CGAL/Java/global_functions.h>
 #include <SWIG_CGAL/Java/decl.h>
 
+// Shared global reference to a Java object. Copies only update an atomic
+// counter (no JNI call): they are thread safe, and a null JavaData (the
+// value of info fields that are never set) costs nothing to copy.
 class SWIG_CGAL_JAVA_DECL JavaData {
-  int* cnt;
+  std::atomic<int>* cnt;
   jobject data;
  
   void copy(const JavaData&);
@@ -1,166 +1,128 @@
 // ------------------------------------------------------------------------------
 // Copyright (c) 2011 GeometryFactory (FRANCE)
 // SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
-// ------------------------------------------------------------------------------ 
+// ------------------------------------------------------------------------------
 
 
 #ifndef SWIG_CGAL_JAVA_OUTPUT_ITERATOR_WRAPPER_H
 #define SWIG_CGAL_JAVA_OUTPUT_ITERATOR_WRAPPER_H
 
 #include <boost/iterator/function_output_iterator.hpp>
+#include <boost/shared_ptr.hpp>
 #include <SWIG_CGAL/Java/global_functions.h>
 #include <SWIG_CGAL/Java/exception.h>
+#include <SWIG_CGAL/Kernel/Profiling.h>
+
+#include <vector>
+
+namespace SWIG_CGAL {
+namespace internal {
+
+// Hands a block of output values to the Java collection in one call of a
+// static method of CGAL.Java.Buffered_output
+template <class Cpp_wrapper,class Cpp_base>
+struct Java_output{
+  // the wrappers are created in C++ and their pointers are given to Java as
+  // a long[], from which the Java objects (owning the wrappers) are made
+  static void flush(JNIEnv* env, jobject container, jclass obj_class, const std::vector<Cpp_base>& values)
+  {
+    const jsize n = jsize(values.size());
+    jlongArray pointers = env->NewLongArray(n);
+    JNI_THROW_ON_ERROR(pointers,NewLongArray," ")
+    std::vector<jlong> ptrs(values.size());
+    for (std::size_t i=0; i<values.size(); ++i)
+      ptrs[i] = (jlong) new Cpp_wrapper(values[i]);
+    env->SetLongArrayRegion(pointers, 0, n, ptrs.data());
+    jclass helper = env->FindClass("CGAL/Java/Buffered_output");
+    JNI_THROW_ON_ERROR(helper,FindClass,"CGAL/Java/Buffered_output")
+    jmethodID add_id = env->GetStaticMethodID(helper, "add_objects", "(Ljava/util/Collection;Ljava/lang/Class;[J)V");
+    JNI_THROW_ON_ERROR(add_id,GetStaticMethodID,"add_objects")
+    env->CallStaticVoidMethod(helper, add_id, container, obj_class, pointers);
+    env->DeleteLocalRef(pointers);
+    env->DeleteLocalRef(helper);
+  }
+};
 
+#define SWIG_CGAL_SPECIALIZE_JAVA_OUTPUT(T,JTYPE,ARRAY,NAME,SIG)                          \
+template <>                                                                               \
+struct Java_output<T,T>{                                                                  \
+  static void flush(JNIEnv* env, jobject container, jclass, const std::vector<T>& values) \
+  {                                                                                       \
+    const jsize n = jsize(values.size());                                                 \
+    ARRAY array = env->New##NAME##Array(n);                                               \
+    JNI_THROW_ON_ERROR(array,New##NAME##Array," ")                                        \
+    std::vector<JTYPE> copy(values.begin(), values.end());                                \
+    env->Set##NAME##ArrayRegion(array, 0, n, copy.data());                                \
+    jclass helper = env->FindClass("CGAL/Java/Buffered_output");                          \
+    JNI_THROW_ON_ERROR(helper,FindClass,"CGAL/Java/Buffered_output")                      \
+    jmethodID add_id = env->GetStaticMethodID(helper, "add_values",                       \
+                                              "(Ljava/util/Collection;[" #SIG ")V");      \
+    JNI_THROW_ON_ERROR(add_id,GetStaticMethodID,"add_values")                             \
+    env->CallStaticVoidMethod(helper, add_id, container, array);                          \
+    env->DeleteLocalRef(array);                                                           \
+    env->DeleteLocalRef(helper);                                                          \
+  }                                                                                       \
+};
+
+SWIG_CGAL_SPECIALIZE_JAVA_OUTPUT(int,    jint,    jintArray,    Int,    I)
+SWIG_CGAL_SPECIALIZE_JAVA_OUTPUT(double, jdouble, jdoubleArray, Double, D)
+
+#undef SWIG_CGAL_SPECIALIZE_JAVA_OUTPUT
+
+} } // namespace SWIG_CGAL::internal
+
+// Output iterator functor filling a Java collection. The values are
+// buffered in C++ and added to the collection by blocks of buffer_size,
+// the last block being added when the last copy of the writer is destroyed
+// (at the end of the call of the wrapped function).
 template<class Cpp_wrapper,class Cpp_base>
 class Container_writer{
-  jobject container;
-  jmethodID init_id, add_id;
-  jclass cont_class,obj_class;
-  int* ref_counter;
-  
-  void cleanup(){
-    if (--(*ref_counter) == 0)
-    {
-      delete ref_counter;
-      if (container!=nullptr ){
-        JNU_GetEnv()->DeleteGlobalRef(container);
-        JNU_GetEnv()->DeleteGlobalRef(cont_class);
-        JNU_GetEnv()->DeleteGlobalRef(obj_class);
-      }
+  struct State{
+    jobject container;
+    jclass obj_class;
+    std::vector<Cpp_base> values;
+
+    State():container(nullptr),obj_class(nullptr){}
+    void flush(){
+      JNIEnv* env = JNU_GetEnv();
+      // no JNI call is allowed with a pending exception
+      if (values.empty() || env->ExceptionCheck()) return;
+      SWIG_CGAL::Conversion_timer timer;
+      SWIG_CGAL::internal::Java_output<Cpp_wrapper,Cpp_base>::flush(env, container, obj_class, values);
+      values.clear();
     }
-  }
-  
-  void copy(const Container_writer& source){
-    container=source.container;
-    init_id=source.init_id;
-    add_id=source.add_id;
-    cont_class=source.cont_class;
-    obj_class=source.obj_class;
-    ref_counter=source.ref_counter;
-    ++(*ref_counter);    
-  }
+    ~State(){
+      if (container==nullptr) return;
+      try{ flush(); } catch(...){}
+      JNIEnv* env = JNU_GetEnv();
+      env->DeleteGlobalRef(container);
+      env->DeleteGlobalRef(obj_class);
+    }
+  };
+
+  static const std::size_t buffer_size = 1 << 16;
+  boost::shared_ptr<State> m_state;
+
 public:
 
-  Container_writer():container(nullptr),cont_class(nullptr),obj_class(nullptr),ref_counter(new int(1)){}
-  Container_writer(jobject container_,const char* name):ref_counter(new int(1))
+  Container_writer():m_state(new State()){}
+  Container_writer(jobject container_,const char* name):m_state(new State())
   {
-    container = JNU_GetEnv()->NewGlobalRef( container_ );
-    JNI_THROW_ON_ERROR(container,NewGlobalRef," ")
-    jclass tmp_class=JNU_GetEnv()->FindClass(name);
+    JNIEnv* env = JNU_GetEnv();
+    jclass tmp_class=env->FindClass(name);
     JNI_THROW_ON_ERROR(tmp_class,FindClass,name)
-    obj_class =(jclass) JNU_GetEnv()->NewGlobalRef( tmp_class );
-    JNI_THROW_ON_ERROR(obj_class,NewGlobalRef," ")
-    init_id = JNU_GetEnv()->GetMethodID(obj_class,"<init>", "(JZ)V");
-    JNI_THROW_ON_ERROR(init_id,GetMethodID,"<init> (JZ)V");
-    cont_class=(jclass) JNU_GetEnv()->NewGlobalRef( JNU_GetEnv()->GetObjectClass(container) );
-    JNI_THROW_ON_ERROR(cont_class,NewGlobalRef," ")
-    add_id=JNU_GetEnv()->GetMethodID(cont_class, "add", "(Ljava/lang/Object;)Z");
-    JNI_THROW_ON_ERROR(add_id,GetMethodID,"add (Ljava/lang/Object;)Z")
-  }
-  
-  ~Container_writer(){
-    cleanup();
-  }
-  
-  Container_writer(const Container_writer& source)
-  {
-    copy(source);
+    m_state->obj_class =(jclass) env->NewGlobalRef( tmp_class );
+    JNI_THROW_ON_ERROR(m_state->obj_class,NewGlobalRef," ")
+    m_state->container = env->NewGlobalRef( container_ );
+    JNI_THROW_ON_ERROR(m_state->container,NewGlobalRef," ")
   }
-  
-  Container_writer& operator=(const Container_writer& source)
-  {
-    if (this!=&source){
-      cleanup();
-      copy(source);
-    }
-    return *this;
-  }
-  
+
   void operator()(const Cpp_base& new_base) {
-    Cpp_wrapper*  object=new Cpp_wrapper(new_base);
-    jlong hptr = (jlong) object;
-    jobject ho = JNU_GetEnv()->NewObject(obj_class, init_id, hptr,true);
-    JNI_THROW_ON_ERROR(ho,NewObject," ")
-    JNU_GetEnv()->CallBooleanMethod(container, add_id, ho);
+    m_state->values.push_back(new_base);
+    if (m_state->values.size() == buffer_size)
+      m_state->flush();
   }
 };
 
-#define SPECIALIZE_CONTAINER_WRITER(T,STR) \
-template<>\
-class Container_writer<T,T>{\
-  jobject container;\
-  jmethodID init_id, add_id;\
-  jclass cont_class,obj_class;\
-  int* ref_counter;\
-\
-  void cleanup(){\
-    if (--(*ref_counter) == 0)\
-    {\
-      delete ref_counter;\
-      if (container!=nullptr ){\
-        JNU_GetEnv()->DeleteGlobalRef(container);\
-        JNU_GetEnv()->DeleteGlobalRef(cont_class);\
-        JNU_GetEnv()->DeleteGlobalRef(obj_class);\
-      }\
-    }\
-  }\
-\
-  void copy(const Container_writer& source){\
-    container=source.container;\
-    init_id=source.init_id;\
-    add_id=source.add_id;\
-    cont_class=source.cont_class;\
-    obj_class=source.obj_class;\
-    ref_counter=source.ref_counter;\
-    ++(*ref_counter);\
-  }\
-public:\
-\
-  Container_writer():container(nullptr),cont_class(nullptr),obj_class(nullptr),ref_counter(new int(1)){}\
-  Container_writer(jobject container_,const char* name):ref_counter(new int(1))\
-  {\
-    container = JNU_GetEnv()->NewGlobalRef( container_ );\
-    JNI_THROW_ON_ERROR(container,NewGlobalRef," ")\
-    jclass tmp_class=JNU_GetEnv()->FindClass(name);\
-    JNI_THROW_ON_ERROR(tmp_class,FindClass,name);\
-    obj_class =(jclass) JNU_GetEnv()->NewGlobalRef( tmp_class );\
-    JNI_THROW_ON_ERROR(obj_class,NewGlobalRef," ")\
-    init_id = JNU_GetEnv()->GetMethodID(obj_class,"<init>", "(" #STR")V");\
-    JNI_THROW_ON_ERROR(init_id,GetMethodID,"<init> (" #STR ")V")\
-    cont_class=(jclass) JNU_GetEnv()->NewGlobalRef( JNU_GetEnv()->GetObjectClass(container) );\
-    JNI_THROW_ON_ERROR(cont_class,NewGlobalRef," ")\
-    add_id=JNU_GetEnv()->GetMethodID(cont_class, "add", "(Ljava/lang/Object;)Z");\
-    JNI_THROW_ON_ERROR(add_id,GetMethodID,"add (Ljava/lang/Object;)Z")\
-  }\
-\
-  ~Container_writer(){\
-    cleanup();\
-  }\
-\
-  Container_writer(const Container_writer& source)\
-  {\
-    copy(source);\
-  }\
-\
-  Container_writer& operator=(const Container_writer& source)\
-  {\
-    if (this!=&source){\
-      cleanup();\
-      copy(source);\
-    }\
-    return *this;\
-  }\
-\
-  void operator()(T new_base) {\
-    jobject ho = JNU_GetEnv()->NewObject(obj_class, init_id,new_base,true);\
-    JNI_THROW_ON_ERROR(ho,NewObject," ")\
-    JNU_GetEnv()->CallBooleanMethod(container, add_id, ho);\
-  }\
-};\
-
-SPECIALIZE_CONTAINER_WRITER(int, I)
-SPECIALIZE_CONTAINER_WRITER(double, D)
-
 
 #endif// SWIG_CGAL_JAVA_OUTPUT_ITERATOR_WRAPPER_H
-
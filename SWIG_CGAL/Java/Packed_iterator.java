@@ -0,0 +1,68 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+package CGAL.Java;
+
+import java.nio.DoubleBuffer;
+import java.util.Iterator;
+
+// Range given where the bindings expect an Iterator over wrapped objects
+// (insert(), the constructors from ranges...), read by the native code in
+// one call instead of calling hasNext(), next() and getCPtr() for each
+// element:
+//   of_coordinates()  points from rows of coordinates, 2 for Point_2, 3 for
+//                     Point_3 and Weighted_point_2 (x,y,w), 4 for
+//                     Weighted_point_3 (x,y,z,w), from a double[] or a direct
+//                     DoubleBuffer (between its position and its limit)
+//   of_pointers()     wrapped objects from their native pointers, as
+//                     returned by their getCPtr()
+// These ranges are only read by the bindings: they cannot be iterated from
+// Java.
+public class Packed_iterator<T> implements Iterator<T> {
+  // read by SWIG_CGAL/Java/Input_iterator_wrapper.h
+  private final double[] coordinates;
+  private final DoubleBuffer buffer;
+  private final long[] pointers;
+  private final int dimension;
+  // keeps alive the objects of the pointers
+  private final Object owner;
+
+  private Packed_iterator(double[] coordinates, DoubleBuffer buffer, long[] pointers, int dimension, Object owner) {
+    this.coordinates = coordinates;
+    this.buffer = buffer;
+    this.pointers = pointers;
+    this.dimension = dimension;
+    this.owner = owner;
+  }
+
+  public static <T> Packed_iterator<T> of_coordinates(double[] coordinates, int dimension) {
+    if (coordinates == null) throw new NullPointerException();
+    return new Packed_iterator<T>(coordinates, null, null, dimension, null);
+  }
+
+  public static <T> Packed_iterator<T> of_coordinates(DoubleBuffer coordinates, int dimension) {
+    if (coordinates == null) throw new NullPointerException();
+    return new Packed_iterator<T>(null, coordinates, null, dimension, null);
+  }
+
+  // `owner` (for instance the collection of the objects) must keep the
+  // objects alive until the call returns
+  public static <T> Packed_iterator<T> of_pointers(long[] pointers, Object owner) {
+    if (pointers == null) throw new NullPointerException();
+    return new Packed_iterator<T>(null, null, pointers, 0, owner);
+  }
+
+  public boolean hasNext() {
+    throw new UnsupportedOperationException("A Packed_iterator is only read by the CGAL bindings");
+  }
+
+  public T next() {
+    throw new UnsupportedOperationException("A Packed_iterator is only read by the CGAL bindings");
+  }
+
+  public void remove() {
+    throw new UnsupportedOperationException();
+  }
+}
@@ -8,13 +8,23 @@
 #include <cassert>
 #include <SWIG_CGAL/Java/global_functions.h>
 #include <iostream>
+#include <cstdint>
+#include <memory>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/task_scheduler_observer.h>
+#endif
 
 JavaVM* & get_cached_jvm(){
   static JavaVM* cached_jvm = nullptr;
   return cached_jvm;
 }
 
+// the environment is cached per thread: it is valid for the lifetime of the
+// attachment of the thread, and the threads attached here are never detached
 JNIEnv * JNU_GetEnv() {
+  static thread_local JNIEnv* cached_env = nullptr;
+  if (cached_env != nullptr) return cached_env;
   JNIEnv *env;
   assert(get_cached_jvm()!=nullptr);
   jint rc = get_cached_jvm()->GetEnv((void **)&env, JNI_VERSION_1_2);
@@ -22,6 +32,35 @@ JNIEnv * JNU_GetEnv() {
     rc = get_cached_jvm()->AttachCurrentThreadAsDaemon((void**)&env, nullptr);
   if (rc == JNI_EVERSION)
     throw std::runtime_error("jni version not supported");
+  cached_env = env;
   return env;
 }
 
+
+#ifdef CGAL_LINKED_WITH_TBB
+namespace {
+// attaches the TBB worker threads to the JVM when they enter the scheduler,
+// once per thread, rather than in the middle of a parallel algorithm
+class Jvm_attaching_observer : public tbb::task_scheduler_observer {
+public:
+  void on_scheduler_entry(bool is_worker) override {
+    if (is_worker && get_cached_jvm()!=nullptr)
+      JNU_GetEnv();
+  }
+};
+}
+#endif
+
+void attach_tbb_worker_threads() {
+#ifdef CGAL_LINKED_WITH_TBB
+  static Jvm_attaching_observer observer;
+  observer.observe(true);
+#endif
+}
+
+// native method of CGAL.Java.Buffer_owners: releases the owner of the storage
+// of a collected java.nio view (see SWIG_CGAL/Java/Buffer.h)
+extern "C" JNIEXPORT void JNICALL Java_CGAL_Java_Buffer_1owners_release(JNIEnv*, jclass, jlong handle)
+{
+  delete reinterpret_cast<std::shared_ptr<void>*>(static_cast<std::intptr_t>(handle));
+}
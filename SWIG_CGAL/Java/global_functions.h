@@ -11,6 +11,8 @@
 
 JNIEXPORT JavaVM* & get_cached_jvm();
 JNIEXPORT JNIEnv * JNU_GetEnv();
+// makes the TBB worker threads attach themselves to the JVM (no-op without TBB)
+JNIEXPORT void attach_tbb_worker_threads();
 
 
 #endif //SWIG_CGAL_JAVA_GLOBAL_FUNCTIONS_H
@@ -4,6 +4,12 @@
 // ------------------------------------------------------------------------------
 
 
+// outside of the guard: the file may have been processed by an %import
+// (which ignores the code blocks) before being included
+%{
+#include <SWIG_CGAL/Java/Buffer.h>
+%}
+
 #ifndef SWIG_CGAL_JAVA_TYPEMAPS_I
 #define SWIG_CGAL_JAVA_TYPEMAPS_I
 
@@ -397,6 +403,28 @@ SWIG_CGAL_array_of_array_of_double_to_vector_of_vector_of_point_2_typemap_in_adv
 }
 %enddef
 
+//IN typemap for vector of string from a java array
+%define SWIG_CGAL_array_of_string_to_vector_of_string_typemap_in
+%typemap(jni) boost::shared_ptr<std::vector<std::string> > "jobjectArray"  //replace in jni class
+%typemap(jtype) boost::shared_ptr<std::vector<std::string> > "String[]"   //replace in java wrapping class
+%typemap(jstype) boost::shared_ptr<std::vector<std::string> > "String[]"  //replace in java function args
+%typemap(javain) boost::shared_ptr<std::vector<std::string> > "$javainput" //replace in java function call to wrapped function
+
+%typemap(in) boost::shared_ptr<std::vector<std::string> > {
+  boost::shared_ptr<std::vector<std::string> > res(new std::vector<std::string>());
+  const jsize size = jenv->GetArrayLength($input);
+  res->reserve((std::size_t) size);
+  for (jsize i = 0 ; i < size ; i++){
+    jstring str = (jstring) jenv->GetObjectArrayElement($input, i);
+    const char* chars = jenv->GetStringUTFChars(str, nullptr);
+    res->push_back(chars);
+    jenv->ReleaseStringUTFChars(str, chars);
+    jenv->DeleteLocalRef(str);
+  }
+  $1=res;
+}
+%enddef
+
 //OUT typemap for std::pair<double, double> to double[]
 %define SWIG_CGAL_double_pair_to_array_of_double_typemap_out
 %typemap(jni) std::pair<double, double> "jdoubleArray"  //replace in jni class
@@ -471,4 +499,70 @@ SWIG_CGAL_vector_of_points_3_to_array_of_double_typemap_out_advanced(EPIC_Kernel
 %enddef
 
 
+//OUT typemap for a SWIG_CGAL::Buffer to a java.nio buffer in native byte order
+//(views on C++ storage are not copied, see SWIG_CGAL/Java/Buffer.h)
+%define SWIG_CGAL_buffer_typemap_out_advanced(TYPE,JAVA_BUFFER)
+%typemap(jni) SWIG_CGAL::Buffer< TYPE > "jobject"  //replace in jni class
+%typemap(jtype) SWIG_CGAL::Buffer< TYPE > "java.nio.JAVA_BUFFER"   //replace in java wrapping class
+%typemap(jstype) SWIG_CGAL::Buffer< TYPE > "java.nio.JAVA_BUFFER"  //replace in java function args
+%typemap(javaout) SWIG_CGAL::Buffer< TYPE > "{return $jnicall;}" //replace in java function call to wrapped function
+
+%typemap(out) SWIG_CGAL::Buffer< TYPE > {
+  $result = SWIG_CGAL::buffer_to_java(jenv, static_cast<const SWIG_CGAL::Buffer< TYPE >&>($1));
+}
+%enddef
+%define SWIG_CGAL_buffer_of_double_typemap_out
+SWIG_CGAL_buffer_typemap_out_advanced(double,DoubleBuffer)
+%enddef
+%define SWIG_CGAL_buffer_of_float_typemap_out
+SWIG_CGAL_buffer_typemap_out_advanced(float,FloatBuffer)
+%enddef
+%define SWIG_CGAL_buffer_of_int_typemap_out
+SWIG_CGAL_buffer_typemap_out_advanced(int,IntBuffer)
+%enddef
+%define SWIG_CGAL_buffer_of_long_long_typemap_out
+SWIG_CGAL_buffer_typemap_out_advanced(long long,LongBuffer)
+%enddef
+%define SWIG_CGAL_buffer_of_signed_char_typemap_out
+SWIG_CGAL_buffer_typemap_out_advanced(signed char,ByteBuffer)
+%enddef
+%define SWIG_CGAL_buffer_of_unsigned_char_typemap_out
+SWIG_CGAL_buffer_typemap_out_advanced(unsigned char,ByteBuffer)
+%enddef
+%define SWIG_CGAL_buffer_of_unsigned_short_typemap_out
+SWIG_CGAL_buffer_typemap_out_advanced(unsigned short,ShortBuffer)
+%enddef
+
+//IN typemap for a SWIG_CGAL::Buffer from a direct java.nio buffer, no copy
+%define SWIG_CGAL_buffer_typemap_in_advanced(TYPE,JAVA_BUFFER)
+%typemap(jni) SWIG_CGAL::Buffer< TYPE > "jobject"  //replace in jni class
+%typemap(jtype) SWIG_CGAL::Buffer< TYPE > "java.nio.JAVA_BUFFER"   //replace in java wrapping class
+%typemap(jstype) SWIG_CGAL::Buffer< TYPE > "java.nio.JAVA_BUFFER"  //replace in java function args
+%typemap(javain) SWIG_CGAL::Buffer< TYPE > "$javainput" //replace in java function call to wrapped function
+
+%typemap(in) SWIG_CGAL::Buffer< TYPE > {
+  SWIG_CGAL::Buffer< TYPE > buffer;
+  if (!SWIG_CGAL::java_to_buffer< TYPE >(jenv, $input, buffer)) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaIllegalArgumentException, "Expecting a direct java.nio buffer");
+    return $null;
+  }
+  $1 = buffer;
+}
+%enddef
+%define SWIG_CGAL_buffer_of_double_typemap_in
+SWIG_CGAL_buffer_typemap_in_advanced(double,DoubleBuffer)
+%enddef
+%define SWIG_CGAL_buffer_of_float_typemap_in
+SWIG_CGAL_buffer_typemap_in_advanced(float,FloatBuffer)
+%enddef
+%define SWIG_CGAL_buffer_of_int_typemap_in
+SWIG_CGAL_buffer_typemap_in_advanced(int,IntBuffer)
+%enddef
+%define SWIG_CGAL_buffer_of_unsigned_char_typemap_in
+SWIG_CGAL_buffer_typemap_in_advanced(unsigned char,ByteBuffer)
+%enddef
+%define SWIG_CGAL_buffer_of_unsigned_short_typemap_in
+SWIG_CGAL_buffer_typemap_in_advanced(unsigned short,ShortBuffer)
+%enddef
+
 #endif //SWIG_CGAL_JAVA_TYPEMAPS_I
@@ -63,6 +63,12 @@ SWIG_CGAL_package_common()
   #include <SWIG_CGAL/Kernel/Bbox_2.h>
   #include <SWIG_CGAL/Kernel/Bbox_3.h>
   #include <SWIG_CGAL/Common/Iterator.h>
+  #include <SWIG_CGAL/Common/Cancellation_token.h>
+  #include <SWIG_CGAL/Common/Memory_usage.h>
+  #include <SWIG_CGAL/Kernel/Profiling.h>
+  #include <SWIG_CGAL/Kernel/Thread_pool.h>
+  #include <SWIG_CGAL/Common/Shared_memory.h>
+  #include <SWIG_CGAL/Kernel/Coordinate_array.h>
 %}
 
 //typemaps for Polygon_2
@@ -114,6 +120,18 @@ SWIG_CGAL_input_iterator_typemap_in_python_extra_function(Polygon_2::Polygon_2)
 %include "SWIG_CGAL/Kernel/Origin.h"
 %include "SWIG_CGAL/Kernel/Iso_rectangle_2.h"
 %include "SWIG_CGAL/Kernel/Iso_cuboid_3.h"
+%include "SWIG_CGAL/Common/Cancellation_token.h"
+%include "SWIG_CGAL/Common/Memory_usage.h"
+%include "SWIG_CGAL/Kernel/Profiling.h"
+#ifdef SWIGJAVA
+//try (Thread_arena arena = new Thread_arena(4)) { arena.enter(); ... }
+%typemap(javainterfaces) SWIG_CGAL::Thread_arena "AutoCloseable"
+%extend SWIG_CGAL::Thread_arena {
+  void close() { if ($self->is_entered()) $self->exit(); }
+}
+#endif
+%include "SWIG_CGAL/Kernel/Thread_pool.h"
+%include "SWIG_CGAL/Common/Shared_memory.h"
 
 const Origin      ORIGIN;
 const Null_vector NULL_VECTOR;
@@ -173,6 +191,32 @@ Bounded_side bounded_side_2(Point_range_2 range,const Point_2& p);
   }
 %}
 
+//contiguous arrays of kernel objects
+%include "SWIG_CGAL/typemaps.i"
+SWIG_CGAL_buffer_of_double_typemap_in
+SWIG_CGAL_buffer_of_double_typemap_out
+%include "SWIG_CGAL/Kernel/Coordinate_array.h"
+SWIG_CGAL_declare_identifier_of_template_class(Point_2_array,Coordinate_array<Point_2,2>)
+SWIG_CGAL_declare_identifier_of_template_class(Point_3_array,Coordinate_array<Point_3,3>)
+SWIG_CGAL_declare_identifier_of_template_class(Vector_2_array,Coordinate_array<Vector_2,2>)
+SWIG_CGAL_declare_identifier_of_template_class(Vector_3_array,Coordinate_array<Vector_3,3>)
+
+#ifdef SWIGPYTHON
+%pythoncode %{
+def _coordinate_array_getitem(self, i):
+    if isinstance(i, slice):
+        start, stop, step = i.indices(self.size())
+        return self.slice(start, stop, step)
+    return self.get(i)
+
+for _array in (Point_2_array, Point_3_array, Vector_2_array, Vector_3_array):
+    _array.__len__ = _array.size
+    _array.__getitem__ = _coordinate_array_getitem
+    _array.__setitem__ = _array.set
+del _array
+%}
+#endif
+
 #ifdef SWIG_CGAL_HAS_Kernel_USER_PACKAGE
 %include "SWIG_CGAL/User_packages/Kernel/extensions.i"
 #endif
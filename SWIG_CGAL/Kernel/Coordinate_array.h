@@ -0,0 +1,128 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+
+#ifndef SWIG_CGAL_KERNEL_COORDINATE_ARRAY_H
+#define SWIG_CGAL_KERNEL_COORDINATE_ARRAY_H
+
+#include <SWIG_CGAL/Common/Buffer.h>
+
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+// Contiguous array of kernel objects given by `dimension` coordinates
+// (Point_3_array, Point_2_array, Vector_3_array...), stored as the CGAL
+// objects themselves and not as wrappers. The functions of the bindings
+// taking such an array use its storage directly. array() is a writable
+// (size(), dimension) view on the coordinates, which is invalidated by the
+// functions changing the size of the array.
+template <class Wrapper, int dimension>
+class Coordinate_array
+{
+#ifndef SWIG
+public:
+  typedef typename Wrapper::cpp_base cpp_base;
+  typedef std::vector<cpp_base> Container;
+  static_assert(sizeof(cpp_base) == dimension * sizeof(double),
+                "The coordinates of the objects must be contiguous");
+private:
+#endif
+  std::shared_ptr<Container> data_sptr;
+
+#ifndef SWIG
+  std::size_t index(int i) const
+  {
+    if (i < 0) i += size();
+    if (i < 0 || i >= size())
+      throw std::out_of_range("Index out of range");
+    return std::size_t(i);
+  }
+  static cpp_base make(const double* c) { return make(c, std::integral_constant<int, dimension>()); }
+  static cpp_base make(const double* c, std::integral_constant<int, 2>) { return cpp_base(c[0], c[1]); }
+  static cpp_base make(const double* c, std::integral_constant<int, 3>) { return cpp_base(c[0], c[1], c[2]); }
+  double* coordinates() const { return reinterpret_cast<double*>(data_sptr->data()); }
+#endif
+
+public:
+  Coordinate_array() : data_sptr(new Container()) {}
+  // copy of the rows of an (N, dimension) array
+  explicit Coordinate_array(SWIG_CGAL::Buffer<double> coords) : data_sptr(new Container())
+  {
+    extend(coords);
+  }
+
+#ifndef SWIG
+  Container& get_data() { return *data_sptr; }
+  const Container& get_data() const { return *data_sptr; }
+#endif
+
+  int size() const { return int(data_sptr->size()); }
+  bool empty() const { return data_sptr->empty(); }
+  void reserve(int n) { data_sptr->reserve(std::size_t(n)); }
+  void clear() { data_sptr->clear(); }
+
+  // negative indices count from the end
+  Wrapper get(int i) const { return Wrapper((*data_sptr)[index(i)]); }
+  void set(int i, const Wrapper& o) { (*data_sptr)[index(i)] = o.get_data(); }
+  void append(const Wrapper& o) { data_sptr->push_back(o.get_data()); }
+  // appends the rows of an (N, dimension) array
+  void extend(SWIG_CGAL::Buffer<double> coords)
+  {
+    if (coords.size() % dimension != 0)
+      throw std::invalid_argument("The number of coordinates must be a multiple of the dimension");
+    data_sptr->reserve(data_sptr->size() + coords.size() / dimension);
+    for (std::size_t i = 0; i < coords.size(); i += dimension)
+      data_sptr->push_back(make(coords.data() + i));
+  }
+
+  SWIG_CGAL::Buffer<double> array()
+  {
+    return SWIG_CGAL::Buffer<double>(coordinates(), data_sptr->size(), dimension, data_sptr);
+  }
+
+  // copy of the elements begin, begin + step... before end (begin <= end and step > 0)
+  Coordinate_array slice(int begin, int end, int step = 1) const
+  {
+    if (step <= 0)
+      throw std::invalid_argument("The step must be positive");
+    const int n = size();
+    begin = std::max(0, begin < 0 ? begin + n : begin);
+    end = std::min(n, end < 0 ? end + n : end);
+    Coordinate_array out;
+    for (int i = begin; i < end; i += step)
+      out.data_sptr->push_back((*data_sptr)[std::size_t(i)]);
+    return out;
+  }
+
+  // adds the `dimension` values of `v` to the coordinates of each element
+  void translate(SWIG_CGAL::Buffer<double> v)
+  {
+    if (v.size() != std::size_t(dimension))
+      throw std::invalid_argument("Expecting one value per coordinate");
+    double* c = coordinates();
+    const std::size_t n = data_sptr->size() * dimension;
+    for (std::size_t i = 0; i < n; ++i)
+      c[i] += v[i % dimension];
+  }
+  void scale(double factor)
+  {
+    double* c = coordinates();
+    const std::size_t n = data_sptr->size() * dimension;
+    for (std::size_t i = 0; i < n; ++i)
+      c[i] *= factor;
+  }
+
+  Coordinate_array deepcopy() const
+  {
+    Coordinate_array out;
+    *out.data_sptr = *data_sptr;
+    return out;
+  }
+};
+
+#endif //SWIG_CGAL_KERNEL_COORDINATE_ARRAY_H
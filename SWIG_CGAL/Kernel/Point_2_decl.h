@@ -11,6 +11,7 @@
 #include <SWIG_CGAL/Kernel/include_conflicts_2.h>
 #include <SWIG_CGAL/Kernel/Bbox_2.h>
 #include <SWIG_CGAL/Common/Macros.h>
+#include <SWIG_CGAL/Kernel/Pooled_allocation.h>
 #include <SWIG_CGAL/Kernel/typedefs.h>
 
 class SWIG_CGAL_KERNEL_DECL Point_2{
@@ -20,6 +21,7 @@ public:
   typedef EPIC_Kernel::Point_2 cpp_base;
   const cpp_base& get_data() const {return data;}
         cpp_base& get_data()       {return data;}
+  SWIG_CGAL_POOLED_ALLOCATION
   Point_2(const cpp_base& base):data(base){}
   #endif
 
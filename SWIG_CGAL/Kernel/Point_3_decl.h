@@ -11,6 +11,7 @@
 #include <SWIG_CGAL/Kernel/include_conflicts_3.h>
 #include <SWIG_CGAL/Kernel/Bbox_3.h>
 #include <SWIG_CGAL/Common/Macros.h>
+#include <SWIG_CGAL/Kernel/Pooled_allocation.h>
 #include <SWIG_CGAL/Kernel/typedefs.h>
 
 class SWIG_CGAL_KERNEL_DECL Point_3{
@@ -20,6 +21,7 @@ public:
   typedef EPIC_Kernel::Point_3 cpp_base;
   const cpp_base& get_data() const {return data;}
         cpp_base& get_data()       {return data;}
+  SWIG_CGAL_POOLED_ALLOCATION
   Point_3(const cpp_base& base):data(base){}
   #endif
 
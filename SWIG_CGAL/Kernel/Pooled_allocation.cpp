@@ -0,0 +1,146 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+
+#define SWIG_CGAL_KERNEL_EXPORT
+
+#include <SWIG_CGAL/Kernel/Pooled_allocation.h>
+#include <SWIG_CGAL/Kernel/Profiling.h>
+
+#include <algorithm>
+#include <new>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/scalable_allocator.h>
+#else
+#include <mutex>
+#include <vector>
+#endif
+
+namespace SWIG_CGAL {
+
+#ifdef CGAL_LINKED_WITH_TBB
+
+void* pooled_allocate(std::size_t size)
+{
+  if (internal::profiling_enabled()) internal::record_wrapper_objects(1);
+  void* p = scalable_malloc(size);
+  if (p == nullptr) throw std::bad_alloc();
+  return p;
+}
+
+void pooled_deallocate(void* p, std::size_t)
+{
+  scalable_free(p);
+}
+
+#else
+
+namespace {
+
+const std::size_t granularity = sizeof(void*);
+const std::size_t nb_size_classes = max_pooled_size / granularity;
+const std::size_t blocks_per_slab = 512;
+const std::size_t batch_size = 256;   // blocks moved between a thread and the pool
+const std::size_t max_cached = 1024;  // blocks kept by a thread
+
+// blocks shared by all the threads, one list per size class
+class Shared_pool
+{
+  std::mutex mutex;
+  std::vector<void*> free_blocks[nb_size_classes];
+
+public:
+  // Moves a batch of free blocks of class c to `out`, from a new slab if needed
+  void take(std::size_t c, std::vector<void*>& out)
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    std::vector<void*>& blocks = free_blocks[c];
+    if (blocks.empty())
+    {
+      const std::size_t block_size = (c + 1) * granularity;
+      char* slab = static_cast<char*>(::operator new(block_size * blocks_per_slab));
+      for (std::size_t i = 0; i < blocks_per_slab; ++i)
+        blocks.push_back(slab + i * block_size);
+    }
+    const std::size_t n = (std::min)(batch_size, blocks.size());
+    out.insert(out.end(), blocks.end() - n, blocks.end());
+    blocks.resize(blocks.size() - n);
+  }
+
+  // Moves the last n blocks of `in` to the pool
+  void give(std::size_t c, std::vector<void*>& in, std::size_t n)
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    free_blocks[c].insert(free_blocks[c].end(), in.end() - n, in.end());
+    in.resize(in.size() - n);
+  }
+};
+
+// never destroyed: blocks may be freed during the destruction of static
+// objects or by threads ending after it
+Shared_pool& shared_pool()
+{
+  static Shared_pool* pool = new Shared_pool();
+  return *pool;
+}
+
+struct Thread_cache
+{
+  std::vector<void*> free_blocks[nb_size_classes];
+
+  ~Thread_cache()
+  {
+    for (std::size_t c = 0; c < nb_size_classes; ++c)
+      if (!free_blocks[c].empty())
+        shared_pool().give(c, free_blocks[c], free_blocks[c].size());
+  }
+};
+
+Thread_cache& thread_cache()
+{
+  static thread_local Thread_cache cache;
+  return cache;
+}
+
+std::size_t size_class(std::size_t size)
+{
+  return size == 0 ? 0 : (size - 1) / granularity;
+}
+
+} // anonymous namespace
+
+void* pooled_allocate(std::size_t size)
+{
+  if (internal::profiling_enabled()) internal::record_wrapper_objects(1);
+  if (size > max_pooled_size)
+    return ::operator new(size);
+  const std::size_t c = size_class(size);
+  std::vector<void*>& blocks = thread_cache().free_blocks[c];
+  if (blocks.empty())
+    shared_pool().take(c, blocks);
+  void* p = blocks.back();
+  blocks.pop_back();
+  return p;
+}
+
+void pooled_deallocate(void* p, std::size_t size)
+{
+  if (p == nullptr) return;
+  if (size > max_pooled_size)
+  {
+    ::operator delete(p);
+    return;
+  }
+  const std::size_t c = size_class(size);
+  std::vector<void*>& blocks = thread_cache().free_blocks[c];
+  blocks.push_back(p);
+  if (blocks.size() > max_cached)
+    shared_pool().give(c, blocks, batch_size);
+}
+
+#endif
+
+} // namespace SWIG_CGAL
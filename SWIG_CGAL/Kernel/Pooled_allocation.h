@@ -0,0 +1,37 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+
+#ifndef SWIG_CGAL_KERNEL_POOLED_ALLOCATION_H
+#define SWIG_CGAL_KERNEL_POOLED_ALLOCATION_H
+
+#include <SWIG_CGAL/Kernel/decl.h>
+
+#include <cstddef>
+
+namespace SWIG_CGAL {
+
+// Allocation of the small wrapper objects returned to the target language
+// (kernel objects and handles), which are created and destroyed by the
+// million by the iterators and output iterators. Blocks up to
+// max_pooled_size bytes come from per-thread free lists refilled from slabs
+// that are never released; the blocks freed by a thread (a finalizer thread
+// for example) are given back to the other threads by batches. With TBB, the
+// scalable allocator of tbbmalloc, which works the same way, is used.
+// The pool is in CGAL_Kernel_cpp, so that an object allocated by a module
+// can be freed by another one.
+const std::size_t max_pooled_size = 64;
+
+SWIG_CGAL_KERNEL_DECL void* pooled_allocate(std::size_t size);
+SWIG_CGAL_KERNEL_DECL void pooled_deallocate(void* p, std::size_t size);
+
+} // namespace SWIG_CGAL
+
+// class-specific allocation functions of a wrapper class
+#define SWIG_CGAL_POOLED_ALLOCATION                                                        \
+  static void* operator new(std::size_t size){ return SWIG_CGAL::pooled_allocate(size); } \
+  static void operator delete(void* p, std::size_t size){ SWIG_CGAL::pooled_deallocate(p, size); }
+
+#endif //SWIG_CGAL_KERNEL_POOLED_ALLOCATION_H
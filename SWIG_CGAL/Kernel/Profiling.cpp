@@ -0,0 +1,381 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+
+#define SWIG_CGAL_KERNEL_EXPORT
+
+#include <SWIG_CGAL/Kernel/Profiling.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+#ifdef _WIN32
+#define PSAPI_VERSION 2
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#include <unistd.h>
+#endif
+
+namespace SWIG_CGAL {
+
+namespace {
+
+// events kept for the chrome report, the next ones are only counted
+const std::size_t max_events = 1 << 20;
+
+struct Entry_point_stats
+{
+  std::size_t calls = 0;
+  double total_time = 0.;
+  double min_time = (std::numeric_limits<double>::max)();
+  double max_time = 0.;
+  double conversion_time = 0.;
+  std::size_t wrapper_objects = 0;
+  std::size_t peak_memory_increase = 0;
+};
+
+struct Event
+{
+  const std::string* name; // key of the entry point in Profile::entry_points
+  unsigned thread;
+  double start;
+  double duration;
+  double conversion_time;
+  std::size_t wrapper_objects;
+};
+
+struct Profile
+{
+  std::mutex mutex;
+  std::map<std::string, Entry_point_stats> entry_points;
+  std::vector<Event> events;
+  std::size_t dropped_events = 0;
+};
+
+// never destroyed: the report may be written during the destruction of
+// static objects
+Profile& profile()
+{
+  static Profile* p = new Profile();
+  return *p;
+}
+
+std::atomic<bool> enabled(false);
+std::atomic<unsigned> next_thread_id(0);
+
+const std::chrono::steady_clock::time_point origin = std::chrono::steady_clock::now();
+
+// peak resident memory of the process, in bytes
+std::size_t peak_memory()
+{
+#ifdef _WIN32
+  PROCESS_MEMORY_COUNTERS counters;
+  if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+    return std::size_t(counters.PeakWorkingSetSize);
+  return 0;
+#else
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) != 0)
+    return 0;
+#ifdef __APPLE__
+  return std::size_t(usage.ru_maxrss);
+#else
+  return std::size_t(usage.ru_maxrss) * 1024;
+#endif
+#endif
+}
+
+struct Open_call
+{
+  const char* name;
+  double start;
+  double conversion_time;
+  std::size_t wrapper_objects;
+  std::size_t peak_memory;
+};
+
+// calls in progress in a thread, and what is recorded out of them: the
+// conversions of the arguments done before a call are added to it, the
+// conversions of the results and the objects created after a call (by the
+// out typemaps or the last flush of an output iterator) to the previous one
+struct Thread_state
+{
+  unsigned id;
+  std::vector<Open_call> calls;
+  double pending_conversion_time = 0.;
+  std::string last_call;
+  double last_call_conversion_time = 0.;
+  std::size_t last_call_wrapper_objects = 0;
+
+  Thread_state() : id(next_thread_id++) { }
+
+  void flush_last_call()
+  {
+    if (last_call.empty() ||
+        (last_call_conversion_time == 0. && last_call_wrapper_objects == 0))
+      return;
+    Profile& p = profile();
+    std::lock_guard<std::mutex> lock(p.mutex);
+    auto it = p.entry_points.find(last_call);
+    if (it != p.entry_points.end())
+    {
+      it->second.conversion_time += last_call_conversion_time;
+      it->second.wrapper_objects += last_call_wrapper_objects;
+    }
+    last_call_conversion_time = 0.;
+    last_call_wrapper_objects = 0;
+  }
+};
+
+Thread_state& thread_state()
+{
+  static thread_local Thread_state state;
+  return state;
+}
+
+void write_json_string(std::ostream& out, const std::string& s)
+{
+  out << '"';
+  for (char c : s)
+  {
+    if (c == '"' || c == '\\')
+      out << '\\' << c;
+    else if (static_cast<unsigned char>(c) < 0x20)
+    {
+      char buffer[8];
+      std::snprintf(buffer, sizeof(buffer), "\\u%04x", unsigned(static_cast<unsigned char>(c)));
+      out << buffer;
+    }
+    else
+      out << c;
+  }
+  out << '"';
+}
+
+void write_json_report(std::ostream& out, const Profile& p)
+{
+  std::vector<std::pair<const std::string*, const Entry_point_stats*> > entries;
+  for (const auto& entry : p.entry_points)
+    entries.emplace_back(&entry.first, &entry.second);
+  // the most expensive entry points first
+  std::stable_sort(entries.begin(), entries.end(),
+                   [](const auto& a, const auto& b) { return a.second->total_time > b.second->total_time; });
+
+  out << "{\"entry_points\":[";
+  for (std::size_t i = 0; i < entries.size(); ++i)
+  {
+    const Entry_point_stats& s = *entries[i].second;
+    out << (i == 0 ? "\n" : ",\n") << "{\"name\":";
+    write_json_string(out, *entries[i].first);
+    out << ",\"calls\":" << s.calls
+        << ",\"total_time\":" << s.total_time
+        << ",\"min_time\":" << (s.calls == 0 ? 0. : s.min_time)
+        << ",\"max_time\":" << s.max_time
+        << ",\"conversion_time\":" << s.conversion_time
+        << ",\"wrapper_objects\":" << s.wrapper_objects
+        << ",\"peak_memory_increase\":" << s.peak_memory_increase << "}";
+  }
+  out << "],\n\"peak_memory\":" << peak_memory()
+      << ",\n\"dropped_events\":" << p.dropped_events << "}\n";
+}
+
+void write_chrome_report(std::ostream& out, const Profile& p)
+{
+#ifdef _WIN32
+  const unsigned long pid = GetCurrentProcessId();
+#else
+  const unsigned long pid = static_cast<unsigned long>(getpid());
+#endif
+  out << "{\"traceEvents\":[";
+  for (std::size_t i = 0; i < p.events.size(); ++i)
+  {
+    const Event& e = p.events[i];
+    out << (i == 0 ? "\n" : ",\n") << "{\"name\":";
+    write_json_string(out, *e.name);
+    out << ",\"cat\":\"SWIG_CGAL\",\"ph\":\"X\""
+        << ",\"ts\":" << e.start * 1e6
+        << ",\"dur\":" << e.duration * 1e6
+        << ",\"pid\":" << pid
+        << ",\"tid\":" << e.thread
+        << ",\"args\":{\"conversion_us\":" << e.conversion_time * 1e6
+        << ",\"wrapper_objects\":" << e.wrapper_objects << "}}";
+  }
+  out << "],\n\"displayTimeUnit\":\"ms\",\n\"otherData\":{\"peak_memory\":" << peak_memory()
+      << ",\"dropped_events\":" << p.dropped_events << "}}\n";
+}
+
+// settings read from the environment when the library is loaded
+struct Environment_settings
+{
+  std::string output;
+  std::string format;
+
+  Environment_settings()
+  {
+    const char* profile_var = std::getenv("CGAL_SWIG_PROFILE");
+    if (profile_var != nullptr && *profile_var != '\0' && std::string(profile_var) != "0")
+      enabled = true;
+    const char* output_var = std::getenv("CGAL_SWIG_PROFILE_OUTPUT");
+    if (output_var != nullptr) output = output_var;
+    const char* format_var = std::getenv("CGAL_SWIG_PROFILE_FORMAT");
+    format = format_var != nullptr ? format_var : "json";
+  }
+
+  ~Environment_settings()
+  {
+    if (output.empty()) return;
+    try { write_profiling_report(output, format); } catch(...) { }
+  }
+};
+
+Environment_settings environment_settings;
+
+} // anonymous namespace
+
+void set_profiling(bool b)
+{
+  enabled = b;
+}
+
+bool is_profiling()
+{
+  return enabled;
+}
+
+void reset_profiling()
+{
+  Profile& p = profile();
+  std::lock_guard<std::mutex> lock(p.mutex);
+  p.entry_points.clear();
+  p.events.clear();
+  p.dropped_events = 0;
+}
+
+std::string profiling_report(const std::string& format)
+{
+  if (format != "json" && format != "chrome")
+    throw std::invalid_argument("Unknown profiling report format '" + format + "' (expected 'json' or 'chrome')");
+  std::ostringstream out;
+  out.precision(9);
+  Profile& p = profile();
+  std::lock_guard<std::mutex> lock(p.mutex);
+  if (format == "json")
+    write_json_report(out, p);
+  else
+    write_chrome_report(out, p);
+  return out.str();
+}
+
+bool write_profiling_report(const std::string& filename, const std::string& format)
+{
+  const std::string report = profiling_report(format);
+  std::ofstream out(filename.c_str());
+  if (!out) return false;
+  out << report;
+  return bool(out);
+}
+
+namespace internal {
+
+bool profiling_enabled()
+{
+  return enabled.load(std::memory_order_relaxed);
+}
+
+double profiling_clock()
+{
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - origin).count();
+}
+
+void begin_profiled_call(const char* name)
+{
+  Thread_state& state = thread_state();
+  if (state.calls.empty())
+    state.flush_last_call();
+  Open_call call;
+  call.name = name;
+  call.conversion_time = state.pending_conversion_time;
+  call.start = profiling_clock() - state.pending_conversion_time;
+  call.wrapper_objects = 0;
+  call.peak_memory = peak_memory();
+  state.pending_conversion_time = 0.;
+  state.calls.push_back(call);
+}
+
+void end_profiled_call()
+{
+  Thread_state& state = thread_state();
+  if (state.calls.empty()) return;
+  const Open_call call = state.calls.back();
+  state.calls.pop_back();
+  const double duration = profiling_clock() - call.start;
+  const std::size_t peak = peak_memory();
+  const std::size_t peak_increase = peak > call.peak_memory ? peak - call.peak_memory : 0;
+
+  // the nested calls are included in the calls they are made from
+  if (!state.calls.empty())
+  {
+    state.calls.back().conversion_time += call.conversion_time;
+    state.calls.back().wrapper_objects += call.wrapper_objects;
+  }
+  else
+    state.last_call = call.name;
+
+  Profile& p = profile();
+  std::lock_guard<std::mutex> lock(p.mutex);
+  auto it = p.entry_points.emplace(call.name, Entry_point_stats()).first;
+  Entry_point_stats& s = it->second;
+  ++s.calls;
+  s.total_time += duration;
+  s.min_time = (std::min)(s.min_time, duration);
+  s.max_time = (std::max)(s.max_time, duration);
+  s.conversion_time += call.conversion_time;
+  s.wrapper_objects += call.wrapper_objects;
+  s.peak_memory_increase = (std::max)(s.peak_memory_increase, peak_increase);
+  if (p.events.size() < max_events)
+    p.events.push_back(Event{&it->first, state.id, call.start, duration,
+                             call.conversion_time, call.wrapper_objects});
+  else
+    ++p.dropped_events;
+}
+
+void record_conversion(double seconds, bool before_call)
+{
+  Thread_state& state = thread_state();
+  if (!state.calls.empty())
+    state.calls.back().conversion_time += seconds;
+  else if (before_call)
+    state.pending_conversion_time += seconds;
+  else
+  {
+    state.last_call_conversion_time += seconds;
+    state.flush_last_call();
+  }
+}
+
+void record_wrapper_objects(std::size_t n)
+{
+  Thread_state& state = thread_state();
+  if (!state.calls.empty())
+    state.calls.back().wrapper_objects += n;
+  else
+    state.last_call_wrapper_objects += n;
+}
+
+} // namespace internal
+
+} // namespace SWIG_CGAL
@@ -0,0 +1,98 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+
+#ifndef SWIG_CGAL_KERNEL_PROFILING_H
+#define SWIG_CGAL_KERNEL_PROFILING_H
+
+#include <SWIG_CGAL/Kernel/decl.h>
+
+#include <cstddef>
+#include <exception>
+#include <string>
+
+namespace SWIG_CGAL {
+
+// Opt-in instrumentation of the calls of the wrapped functions. When it is
+// on, each call of an entry point of a module records its wall time, the
+// part of it spent converting the arguments and results between the target
+// language and C++ (Input_iterator_wrapper, Container_writer), the number of
+// wrapper objects created (kernel objects and handles) and the increase of
+// the peak memory of the process. Profiling is turned on with
+// set_profiling(true) or by setting the environment variable
+// CGAL_SWIG_PROFILE=1; with CGAL_SWIG_PROFILE_OUTPUT=<file> the report is
+// also written to that file at exit, in the format given by
+// CGAL_SWIG_PROFILE_FORMAT ("json" by default).
+// The report is either "json", with per entry point statistics, or
+// "chrome", the Chrome trace event format with one event per call, to be
+// opened in chrome://tracing or Perfetto.
+// The recorded data is in CGAL_Kernel_cpp, and shared by all the modules.
+SWIG_CGAL_KERNEL_DECL void set_profiling(bool enabled);
+SWIG_CGAL_KERNEL_DECL bool is_profiling();
+SWIG_CGAL_KERNEL_DECL void reset_profiling();
+SWIG_CGAL_KERNEL_DECL std::string profiling_report(const std::string& format = "json");
+// returns false if the file cannot be written
+SWIG_CGAL_KERNEL_DECL bool write_profiling_report(const std::string& filename,
+                                                  const std::string& format = "json");
+
+#ifndef SWIG
+namespace internal {
+
+SWIG_CGAL_KERNEL_DECL bool profiling_enabled();
+SWIG_CGAL_KERNEL_DECL double profiling_clock();
+SWIG_CGAL_KERNEL_DECL void begin_profiled_call(const char* name);
+SWIG_CGAL_KERNEL_DECL void end_profiled_call();
+// before_call is true for the conversions done by the typemaps before the
+// call (they are then counted in the call).
+SWIG_CGAL_KERNEL_DECL void record_conversion(double seconds, bool before_call);
+SWIG_CGAL_KERNEL_DECL void record_wrapper_objects(std::size_t n);
+
+} // namespace internal
+
+// Records the call of the entry point `name` during its lifetime,
+// used by the %exception code of common.i
+class Profiled_call
+{
+  bool m_active;
+
+public:
+  explicit Profiled_call(const char* name)
+    : m_active(internal::profiling_enabled())
+  {
+    if (m_active) internal::begin_profiled_call(name);
+  }
+  ~Profiled_call()
+  {
+    if (m_active) internal::end_profiled_call();
+  }
+  Profiled_call(const Profiled_call&) = delete;
+  Profiled_call& operator=(const Profiled_call&) = delete;
+};
+
+// Records the time spent in a conversion during its lifetime
+class Conversion_timer
+{
+  double m_start;
+  bool m_before_call;
+
+public:
+  explicit Conversion_timer(bool before_call = false)
+    : m_start(internal::profiling_enabled() ? internal::profiling_clock() : -1.)
+    , m_before_call(before_call)
+  { }
+  ~Conversion_timer()
+  {
+    // nothing is recorded for a failed conversion
+    if (m_start >= 0. && std::uncaught_exceptions() == 0)
+      internal::record_conversion(internal::profiling_clock() - m_start, m_before_call);
+  }
+  Conversion_timer(const Conversion_timer&) = delete;
+  Conversion_timer& operator=(const Conversion_timer&) = delete;
+};
+#endif
+
+} // namespace SWIG_CGAL
+
+#endif //SWIG_CGAL_KERNEL_PROFILING_H
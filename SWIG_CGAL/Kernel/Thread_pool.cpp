@@ -0,0 +1,328 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+
+#define SWIG_CGAL_KERNEL_EXPORT
+
+#include <SWIG_CGAL/Kernel/Thread_pool.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/global_control.h>
+#include <tbb/task_arena.h>
+#include <tbb/task_scheduler_observer.h>
+#include <tbb/version.h>
+#if TBB_INTERFACE_VERSION >= 12000
+#include <tbb/info.h>
+#define SWIG_CGAL_HAS_ARENA_CONSTRAINTS 1
+#endif
+#endif
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace SWIG_CGAL {
+
+namespace {
+
+// number of threads allowed by a CFS quota (cgroup v2 cpu.max or cgroup v1
+// cpu.cfs_quota_us and cpu.cfs_period_us), 0 if there is no quota
+int cgroup_cpu_limit()
+{
+#ifdef __linux__
+  long long quota = -1, period = 0;
+  std::ifstream v2("/sys/fs/cgroup/cpu.max");
+  std::string max;
+  if (v2 >> max >> period)
+  {
+    if (max == "max") return 0;
+    quota = std::atoll(max.c_str());
+  }
+  else
+  {
+    for (const char* dir : {"/sys/fs/cgroup/cpu", "/sys/fs/cgroup/cpu,cpuacct"})
+    {
+      std::ifstream q(std::string(dir) + "/cpu.cfs_quota_us");
+      std::ifstream p(std::string(dir) + "/cpu.cfs_period_us");
+      if (q >> quota && p >> period) break;
+      quota = -1;
+    }
+  }
+  if (quota <= 0 || period <= 0) return 0;
+  return int((std::max)(1LL, (quota + period - 1) / period));
+#else
+  return 0;
+#endif
+}
+
+// number of hardware threads the process may run on
+int available_hardware_threads()
+{
+#ifdef __linux__
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  if (sched_getaffinity(0, sizeof(set), &set) == 0)
+    return (std::max)(1, CPU_COUNT(&set));
+#endif
+  return (std::max)(1u, std::thread::hardware_concurrency());
+}
+
+std::mutex& settings_mutex()
+{
+  static std::mutex* m = new std::mutex();
+  return *m;
+}
+
+int requested_num_threads = 0; // 0 for the default
+
+#ifdef CGAL_LINKED_WITH_TBB
+// never destroyed: destroying a global_control after the TBB library is
+// unloaded crashes
+std::unique_ptr<tbb::global_control>& global_control()
+{
+  static std::unique_ptr<tbb::global_control>* control = new std::unique_ptr<tbb::global_control>();
+  return *control;
+}
+#endif
+
+void apply_num_threads(int n)
+{
+#ifdef CGAL_LINKED_WITH_TBB
+  global_control().reset();
+  global_control().reset(new tbb::global_control(tbb::global_control::max_allowed_parallelism,
+                                                 std::size_t(n)));
+#else
+  (void)n;
+#endif
+}
+
+// applies the default (quota or environment) when the library is loaded
+struct Default_num_threads
+{
+  Default_num_threads()
+  {
+    const char* env = std::getenv("CGAL_SWIG_NUM_THREADS");
+    const int n = env != nullptr ? std::atoi(env) : 0;
+    if (n > 0)
+      set_num_threads(n);
+    else if (default_num_threads() < int((std::max)(1u, std::thread::hardware_concurrency())))
+      set_num_threads(0);
+  }
+};
+
+Default_num_threads default_setting;
+
+#ifdef __linux__
+// cores listed as "0-3,8,10"
+cpu_set_t parse_cores(const std::string& cores)
+{
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  std::istringstream in(cores);
+  std::string range;
+  while (std::getline(in, range, ','))
+  {
+    int first = 0, last = 0;
+    char dash = 0;
+    std::istringstream r(range);
+    if (!(r >> first)) throw std::invalid_argument("Invalid list of cores '" + cores + "'");
+    last = first;
+    if (r >> dash && (dash != '-' || !(r >> last)))
+      throw std::invalid_argument("Invalid list of cores '" + cores + "'");
+    if (first < 0 || last < first || last >= CPU_SETSIZE)
+      throw std::invalid_argument("Invalid range of cores '" + range + "'");
+    for (int c = first; c <= last; ++c)
+      CPU_SET(c, &set);
+  }
+  if (CPU_COUNT(&set) == 0)
+    throw std::invalid_argument("Empty list of cores");
+  return set;
+}
+#endif
+
+#if defined(SWIG_CGAL_HAS_ARENA_CONSTRAINTS) && defined(__linux__)
+// pins the threads to a set of cores while they work in an arena
+class Pinning_observer : public tbb::task_scheduler_observer
+{
+  cpu_set_t m_cores;
+
+  static cpu_set_t& saved_mask()
+  {
+    static thread_local cpu_set_t mask;
+    return mask;
+  }
+
+public:
+  Pinning_observer(tbb::task_arena& arena, const cpu_set_t& cores)
+    : tbb::task_scheduler_observer(arena), m_cores(cores)
+  {
+    observe(true);
+  }
+  ~Pinning_observer() { observe(false); }
+
+  void on_scheduler_entry(bool) override
+  {
+    pthread_getaffinity_np(pthread_self(), sizeof(cpu_set_t), &saved_mask());
+    pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &m_cores);
+  }
+  void on_scheduler_exit(bool) override
+  {
+    pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &saved_mask());
+  }
+};
+#endif
+
+std::vector<Thread_arena>& entered_arenas()
+{
+  static thread_local std::vector<Thread_arena> arenas;
+  return arenas;
+}
+
+} // anonymous namespace
+
+void set_num_threads(int n)
+{
+  std::lock_guard<std::mutex> lock(settings_mutex());
+  requested_num_threads = (std::max)(0, n);
+  apply_num_threads(n > 0 ? n : default_num_threads());
+}
+
+int get_num_threads()
+{
+#ifdef CGAL_LINKED_WITH_TBB
+  return int(tbb::global_control::active_value(tbb::global_control::max_allowed_parallelism));
+#else
+  std::lock_guard<std::mutex> lock(settings_mutex());
+  return requested_num_threads > 0 ? requested_num_threads : default_num_threads();
+#endif
+}
+
+int default_num_threads()
+{
+  int n = available_hardware_threads();
+  const int quota = cgroup_cpu_limit();
+  if (quota > 0) n = (std::min)(n, quota);
+  return n;
+}
+
+int number_of_numa_nodes()
+{
+#ifdef SWIG_CGAL_HAS_ARENA_CONSTRAINTS
+  return int((std::max)(std::size_t(1), tbb::info::numa_nodes().size()));
+#else
+  return 1;
+#endif
+}
+
+struct Thread_arena::Impl
+{
+  int concurrency;
+#ifdef CGAL_LINKED_WITH_TBB
+  tbb::task_arena arena;
+#if defined(SWIG_CGAL_HAS_ARENA_CONSTRAINTS) && defined(__linux__)
+  std::unique_ptr<Pinning_observer> pinning;
+#endif
+#endif
+};
+
+Thread_arena::Thread_arena(int max_concurrency, int numa_node, const std::string& cores)
+  : m_impl(std::make_shared<Impl>())
+{
+  m_impl->concurrency = max_concurrency > 0 ? max_concurrency : get_num_threads();
+#ifdef CGAL_LINKED_WITH_TBB
+#ifdef SWIG_CGAL_HAS_ARENA_CONSTRAINTS
+  tbb::task_arena::constraints constraints;
+  constraints.max_concurrency = m_impl->concurrency;
+  if (numa_node >= 0)
+  {
+    const std::vector<tbb::numa_node_id> nodes = tbb::info::numa_nodes();
+    if (std::find(nodes.begin(), nodes.end(), tbb::numa_node_id(numa_node)) == nodes.end())
+      throw std::invalid_argument("Unknown NUMA node " + std::to_string(numa_node));
+    constraints.numa_id = numa_node;
+  }
+  m_impl->arena.initialize(constraints);
+#ifdef __linux__
+  if (!cores.empty())
+    m_impl->pinning.reset(new Pinning_observer(m_impl->arena, parse_cores(cores)));
+#else
+  if (!cores.empty())
+    throw std::invalid_argument("Pinning threads to cores is only supported on Linux");
+#endif
+#else
+  if (numa_node >= 0 || !cores.empty())
+    throw std::invalid_argument("NUMA nodes and cores require oneTBB");
+  m_impl->arena.initialize(m_impl->concurrency);
+#endif
+#else
+  if (numa_node >= 0 || !cores.empty())
+    throw std::invalid_argument("NUMA nodes and cores require TBB");
+#endif
+}
+
+int Thread_arena::max_concurrency() const
+{
+  return m_impl->concurrency;
+}
+
+void Thread_arena::enter()
+{
+  entered_arenas().push_back(*this);
+}
+
+void Thread_arena::exit()
+{
+  std::vector<Thread_arena>& arenas = entered_arenas();
+  if (arenas.empty() || arenas.back().m_impl != m_impl)
+    throw std::logic_error("Thread_arena::exit() does not match the last enter() of the thread");
+  arenas.pop_back();
+}
+
+bool Thread_arena::is_entered() const
+{
+  const std::vector<Thread_arena>& arenas = entered_arenas();
+  return !arenas.empty() && arenas.back().m_impl == m_impl;
+}
+
+void Thread_arena::execute(void (*f)(void*), void* data)
+{
+#ifdef CGAL_LINKED_WITH_TBB
+  m_impl->arena.execute([&]() { f(data); });
+#else
+  f(data);
+#endif
+}
+
+namespace internal {
+
+Thread_arena* current_thread_arena()
+{
+  std::vector<Thread_arena>& arenas = entered_arenas();
+  return arenas.empty() ? nullptr : &arenas.back();
+}
+
+} // namespace internal
+
+int current_concurrency()
+{
+  if (Thread_arena* arena = internal::current_thread_arena())
+    return arena->max_concurrency();
+#ifdef CGAL_LINKED_WITH_TBB
+  return (std::max)(1, (std::min)(tbb::this_task_arena::max_concurrency(), get_num_threads()));
+#else
+  return get_num_threads();
+#endif
+}
+
+} // namespace SWIG_CGAL
@@ -0,0 +1,87 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+
+#ifndef SWIG_CGAL_KERNEL_THREAD_POOL_H
+#define SWIG_CGAL_KERNEL_THREAD_POOL_H
+
+#include <SWIG_CGAL/Kernel/decl.h>
+
+#include <memory>
+#include <string>
+
+namespace SWIG_CGAL {
+
+// Number of threads used by the parallel functions of all the modules
+// (Parallel_tag algorithms, parallel Mesh_3...). By default, it is the
+// number of hardware threads the process may run on (its CPU affinity),
+// limited by the CPU quota of its cgroup (containers), or the value of the
+// environment variable CGAL_SWIG_NUM_THREADS if set.
+// set_num_threads(n) with n <= 0 restores the default.
+SWIG_CGAL_KERNEL_DECL void set_num_threads(int n);
+SWIG_CGAL_KERNEL_DECL int get_num_threads();
+SWIG_CGAL_KERNEL_DECL int default_num_threads();
+SWIG_CGAL_KERNEL_DECL int number_of_numa_nodes();
+
+// Task arena in which the heavy wrapped functions (those declared with
+// SWIG_CGAL_release_gil in common.i) called by the thread between enter()
+// and exit() run, with at most max_concurrency threads (0 for
+// get_num_threads()), on the NUMA node numa_node (-1 for any) and, if cores
+// is not empty, with the threads pinned to the cores listed, as in
+// "0-3,8,10" (Linux only). The arenas of a thread are nested.
+class SWIG_CGAL_KERNEL_DECL Thread_arena
+{
+#ifndef SWIG
+  struct Impl;
+  std::shared_ptr<Impl> m_impl;
+#endif
+
+public:
+  Thread_arena(int max_concurrency = 0, int numa_node = -1, const std::string& cores = "");
+
+  int max_concurrency() const;
+  void enter();
+  // throws if this arena is not the last one entered by the thread
+  void exit();
+  // true if this arena is the last one entered by the thread
+  bool is_entered() const;
+#ifndef SWIG
+  // calls f() in the arena
+  void execute(void (*f)(void*), void* data);
+#endif
+};
+
+#ifndef SWIG
+namespace internal {
+
+// the arena last entered by the thread, nullptr if none
+SWIG_CGAL_KERNEL_DECL Thread_arena* current_thread_arena();
+
+template <class F>
+void execute_in_thread_arena(Thread_arena* arena, F& f)
+{
+  arena->execute([](void* data) { (*static_cast<F*>(data))(); }, &f);
+}
+
+} // namespace internal
+
+// Calls f() in the arena entered by the thread, if any, used by the
+// %exception code of SWIG_CGAL_release_gil in common.i
+template <class F>
+void run_in_thread_arena(F f)
+{
+  if (Thread_arena* arena = internal::current_thread_arena())
+    internal::execute_in_thread_arena(arena, f);
+  else
+    f();
+}
+
+// number of threads the parallel function called from here may use
+SWIG_CGAL_KERNEL_DECL int current_concurrency();
+#endif
+
+} // namespace SWIG_CGAL
+
+#endif //SWIG_CGAL_KERNEL_THREAD_POOL_H
@@ -11,6 +11,7 @@
 #include <SWIG_CGAL/Kernel/include_conflicts_2.h>
 #include <SWIG_CGAL/Kernel/enum.h>
 #include <SWIG_CGAL/Kernel/typedefs.h>
+#include <SWIG_CGAL/Kernel/Pooled_allocation.h>
 
 class SWIG_CGAL_KERNEL_DECL Vector_2{
   EPIC_Kernel::Vector_2 data;
@@ -19,6 +20,7 @@ public:
   typedef EPIC_Kernel::Vector_2 cpp_base;
   const cpp_base& get_data() const {return data;}
         cpp_base& get_data()       {return data;}
+  SWIG_CGAL_POOLED_ALLOCATION
   Vector_2(const cpp_base& base):data(base){}
   #endif
 
@@ -11,6 +11,7 @@
 
 #include <SWIG_CGAL/Kernel/include_conflicts_3.h>
 #include <SWIG_CGAL/Kernel/typedefs.h>
+#include <SWIG_CGAL/Kernel/Pooled_allocation.h>
 #include <SWIG_CGAL/Kernel/enum.h>
 
 class SWIG_CGAL_KERNEL_DECL Vector_3{
@@ -20,6 +21,7 @@ public:
   typedef EPIC_Kernel::Vector_3 cpp_base;
   const cpp_base& get_data() const {return data;}
         cpp_base& get_data()       {return data;}
+  SWIG_CGAL_POOLED_ALLOCATION
   Vector_3(const cpp_base& base):data(base){}
   #endif
 
@@ -9,6 +9,7 @@
 
 #include <sstream>
 #include <SWIG_CGAL/Kernel/typedefs.h>
+#include <SWIG_CGAL/Kernel/Pooled_allocation.h>
 #include <SWIG_CGAL/Kernel/Point_2.h>
 
 #include <CGAL/Weighted_point_2.h>
@@ -22,6 +23,7 @@ public:
   #ifndef SWIG
   const cpp_base& get_data() const {return data;}
         cpp_base& get_data()       {return data;}
+  SWIG_CGAL_POOLED_ALLOCATION
   Weighted_point_2(const cpp_base& base):data(base){}
   #endif
 
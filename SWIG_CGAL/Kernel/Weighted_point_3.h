@@ -9,6 +9,7 @@
 
 #include <sstream>
 #include <SWIG_CGAL/Kernel/typedefs.h>
+#include <SWIG_CGAL/Kernel/Pooled_allocation.h>
 #include <SWIG_CGAL/Kernel/Point_3.h>
 #include <CGAL/Weighted_point_3.h>
 
@@ -21,6 +22,7 @@ public:
   #ifndef SWIG
   const cpp_base& get_data() const {return data;}
         cpp_base& get_data()       {return data;}
+  SWIG_CGAL_POOLED_ALLOCATION
   Weighted_point_3(const cpp_base& base):data(base){}
   #endif
 
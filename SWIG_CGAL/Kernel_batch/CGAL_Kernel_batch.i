@@ -0,0 +1,49 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+%define KERNEL_BATCH_DOCSTRING
+"SWIG wrapper for the CGAL Kernel predicates on arrays of coordinates provided under the GPL-3.0+ license"
+%enddef
+%module (package="CGAL", docstring=KERNEL_BATCH_DOCSTRING) CGAL_Kernel_batch
+
+%include "SWIG_CGAL/common.i"
+Decl_void_type()
+
+SWIG_CGAL_add_java_loadLibrary(CGAL_Kernel_batch)
+SWIG_CGAL_package_common()
+
+%import  "SWIG_CGAL/Common/Macros.h"
+%import  "SWIG_CGAL/Kernel/CGAL_Kernel.i"
+
+//typemaps for the coordinates given as arrays and the results returned as arrays
+%include "SWIG_CGAL/typemaps.i"
+SWIG_CGAL_buffer_of_double_typemap_in
+SWIG_CGAL_buffer_of_double_typemap_out
+SWIG_CGAL_buffer_of_signed_char_typemap_out
+
+//include files
+%{
+  #include <SWIG_CGAL/Kernel_batch/batch_functions.h>
+%}
+
+//definitions
+SWIG_CGAL_release_gil(orientation_2_batch)
+SWIG_CGAL_release_gil(orientation_3_batch)
+SWIG_CGAL_release_gil(side_of_oriented_circle_batch)
+SWIG_CGAL_release_gil(side_of_oriented_sphere_batch)
+SWIG_CGAL_release_gil(squared_distance_2_batch)
+SWIG_CGAL_release_gil(squared_distance_3_batch)
+SWIG_CGAL_release_gil(do_intersect_segment_2_batch)
+SWIG_CGAL_release_gil(do_intersect_triangle_3_segment_3_batch)
+SWIG_CGAL_release_gil(do_intersect_triangle_3_batch)
+SWIG_CGAL_release_gil(intersection_segment_2_batch)
+SWIG_CGAL_release_gil(intersection_triangle_3_segment_3_batch)
+SWIG_CGAL_release_gil(intersection_triangle_3_ray_3_batch)
+SWIG_CGAL_release_gil(intersection_triangle_3_plane_3_batch)
+%include "SWIG_CGAL/Kernel_batch/batch_functions.h"
+
+#ifdef SWIG_CGAL_HAS_Kernel_batch_USER_PACKAGE
+%include "SWIG_CGAL/User_packages/Kernel_batch/extensions.i"
+#endif
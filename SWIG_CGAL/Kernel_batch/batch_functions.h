@@ -0,0 +1,453 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+
+#ifndef SWIG_CGAL_KERNEL_BATCH_BATCH_FUNCTIONS_H
+#define SWIG_CGAL_KERNEL_BATCH_BATCH_FUNCTIONS_H
+
+#include <SWIG_CGAL/Common/Buffer.h>
+
+#ifndef SWIG
+#include <SWIG_CGAL/Kernel/typedefs.h>
+#include <SWIG_CGAL/Common/Intersection_writer.h>
+#include <SWIG_CGAL/Common/Spatial_insertion.h>
+#include <SWIG_CGAL/Common/Target_clones.h>
+#include <CGAL/for_each.h>
+#include <CGAL/tags.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#endif
+
+#include <memory>
+#include <vector>
+
+// Result of the batched intersection functions, for the i-th rows of the
+// arguments: the type of the intersection in type_array() (0 for none, 1 for
+// a point, 2 for a segment, 3 for a triangle, 4 for another type) and the
+// coordinates of its vertices in the row i of point_array(), 3 vertices of
+// dimension() coordinates padded with NaN (all NaN for the types 0 and 4).
+// The intersections are written from the variants returned by CGAL, without
+// building an Object for each of them.
+class Intersection_batch
+{
+  int m_dimension;
+  std::shared_ptr<std::vector<signed char> > types_sptr;
+  std::shared_ptr<std::vector<double> >      points_sptr;
+
+public:
+  Intersection_batch()
+    : m_dimension(3), types_sptr(new std::vector<signed char>()), points_sptr(new std::vector<double>()) {}
+  #ifndef SWIG
+  Intersection_batch(std::size_t nb_queries, int dimension)
+    : m_dimension(dimension)
+    , types_sptr(new std::vector<signed char>(nb_queries, 0))
+    , points_sptr(new std::vector<double>(3 * std::size_t(dimension) * nb_queries,
+                                          std::numeric_limits<double>::quiet_NaN())) {}
+  signed char* type_data()  { return types_sptr->data(); }
+  double*      point_data() { return points_sptr->data(); }
+  #endif
+
+  int dimension() const { return m_dimension; }
+  int number_of_queries() const { return int(types_sptr->size()); }
+  int number_of_intersections() const
+  {
+    int n = 0;
+    for (signed char type : *types_sptr)
+      if (type != 0) ++n;
+    return n;
+  }
+
+  SWIG_CGAL::Buffer<signed char> type_array() const
+  {
+    return SWIG_CGAL::Buffer<signed char>(types_sptr->data(), types_sptr->size(), 1, types_sptr, true);
+  }
+  // (number_of_queries(), 3*dimension())
+  SWIG_CGAL::Buffer<double> point_array() const
+  {
+    return SWIG_CGAL::Buffer<double>(points_sptr->data(), types_sptr->size(), 3 * std::size_t(m_dimension),
+                                     points_sptr, true);
+  }
+};
+
+#ifndef SWIG
+namespace SWIG_Kernel {
+namespace internal {
+
+#ifdef CGAL_LINKED_WITH_TBB
+typedef CGAL::Parallel_tag Concurrency_tag;
+#else
+typedef CGAL::Sequential_tag Concurrency_tag;
+#endif
+
+// rows processed by a task of for_each_block
+const std::size_t block_size = 4096;
+
+// value of the filtered predicates when the sign is not certain
+const signed char uncertain = 2;
+
+// Number of rows of the (N, row_size) buffer coords, which must be n if
+// n is not std::size_t(-1)
+inline std::size_t checked_rows(const SWIG_CGAL::Buffer<double>& coords, std::size_t row_size,
+                                std::size_t n = std::size_t(-1))
+{
+  const std::size_t rows = SWIG_CGAL::number_of_rows(coords, row_size);
+  if (n != std::size_t(-1) && rows != n)
+    throw std::invalid_argument("The arrays must have the same number of rows");
+  return rows;
+}
+
+// calls f(begin, end) on blocks of block_size of the rows [0, n),
+// concurrently if linked with TBB
+template <class F>
+void for_each_block(std::size_t n, const F& f)
+{
+  std::vector<std::size_t> blocks((n + block_size - 1) / block_size);
+  for (std::size_t b = 0; b < blocks.size(); ++b)
+    blocks[b] = b * block_size;
+  CGAL::for_each<Concurrency_tag>(blocks, [&](const std::size_t& begin) -> bool
+  {
+    f(begin, (std::min)(begin + block_size, n));
+    return true;
+  });
+}
+
+// The filters are the semi-static filters of CGAL::Epick: the determinant
+// is evaluated in double, and the sign is certain if the determinant
+// exceeds an error bound computed from the largest coordinate differences
+// (the bound is not valid if they underflow or overflow). The loops over a
+// block have no calls or branches out, and the exact predicate of the
+// kernel is only called on the rows of uncertain sign.
+inline signed char filtered_orientation_2(const double* p, const double* q, const double* r)
+{
+  const double pqx = q[0] - p[0], pqy = q[1] - p[1];
+  const double prx = r[0] - p[0], pry = r[1] - p[1];
+  const double det = pqx * pry - pqy * prx;
+  const double maxx = (std::max)(std::fabs(pqx), std::fabs(prx));
+  const double maxy = (std::max)(std::fabs(pqy), std::fabs(pry));
+  const double lo = (std::min)(maxx, maxy), hi = (std::max)(maxx, maxy);
+  const double eps = 8.8872057372592798e-16 * lo * hi;
+  const signed char sign = det > eps ? 1 : (det < -eps ? -1 : uncertain);
+  return lo == 0 ? 0 : ((lo >= 1e-146 && hi < 1e153) ? sign : uncertain);
+}
+
+inline signed char filtered_orientation_3(const double* p, const double* q, const double* r, const double* s)
+{
+  const double pqx = q[0] - p[0], pqy = q[1] - p[1], pqz = q[2] - p[2];
+  const double prx = r[0] - p[0], pry = r[1] - p[1], prz = r[2] - p[2];
+  const double psx = s[0] - p[0], psy = s[1] - p[1], psz = s[2] - p[2];
+  const double det = pqx * (pry * psz - prz * psy)
+                   - prx * (pqy * psz - pqz * psy)
+                   + psx * (pqy * prz - pqz * pry);
+  const double maxx = (std::max)(std::fabs(pqx), (std::max)(std::fabs(prx), std::fabs(psx)));
+  const double maxy = (std::max)(std::fabs(pqy), (std::max)(std::fabs(pry), std::fabs(psy)));
+  const double maxz = (std::max)(std::fabs(pqz), (std::max)(std::fabs(prz), std::fabs(psz)));
+  const double lo = (std::min)(maxx, (std::min)(maxy, maxz));
+  const double hi = (std::max)(maxx, (std::max)(maxy, maxz));
+  const double eps = 5.1107127829973299e-15 * maxx * maxy * maxz;
+  const signed char sign = det > eps ? 1 : (det < -eps ? -1 : uncertain);
+  return lo == 0 ? 0 : ((lo >= 1e-97 && hi < 1e102) ? sign : uncertain);
+}
+
+inline EPIC_Kernel::Point_2 point_2(const double* c) { return EPIC_Kernel::Point_2(c[0], c[1]); }
+inline EPIC_Kernel::Point_3 point_3(const double* c) { return EPIC_Kernel::Point_3(c[0], c[1], c[2]); }
+
+// Loops over a block of rows, compiled for each instruction set of
+// SWIG_CGAL_TARGET_CLONES (the predicates and filters are inlined in them)
+template <class Predicate>
+SWIG_CGAL_TARGET_CLONES
+void evaluate_block(std::size_t begin, std::size_t end, const Predicate& predicate, signed char* o)
+{
+  for (std::size_t i = begin; i < end; ++i)
+    o[i] = static_cast<signed char>(predicate(i));
+}
+
+template <class Filter, class Predicate>
+SWIG_CGAL_TARGET_CLONES
+void evaluate_filtered_block(std::size_t begin, std::size_t end, const Filter& filter,
+                             const Predicate& predicate, signed char* o)
+{
+  for (std::size_t i = begin; i < end; ++i)
+    o[i] = filter(i);
+  for (std::size_t i = begin; i < end; ++i)
+    if (o[i] == uncertain)
+      o[i] = static_cast<signed char>(predicate(i));
+}
+
+template <int dimension>
+SWIG_CGAL_TARGET_CLONES
+void squared_distances_block(std::size_t begin, std::size_t end, const double* a, const double* b, double* o)
+{
+  for (std::size_t i = begin; i < end; ++i)
+  {
+    double d = 0;
+    for (int k = 0; k < dimension; ++k)
+      d += (b[dimension*i+k] - a[dimension*i+k]) * (b[dimension*i+k] - a[dimension*i+k]);
+    o[i] = d;
+  }
+}
+
+// Result of predicate(i) for the rows i of the arrays, as signed chars
+template <class Predicate>
+SWIG_CGAL::Buffer<signed char> evaluate(std::size_t n, const Predicate& predicate)
+{
+  std::vector<signed char> out(n);
+  for_each_block(n, [&](std::size_t begin, std::size_t end)
+  {
+    evaluate_block(begin, end, predicate, out.data());
+  });
+  return SWIG_CGAL::Buffer<signed char>(std::move(out));
+}
+
+// Same as evaluate(), filter(i) giving the result or uncertain
+template <class Filter, class Predicate>
+SWIG_CGAL::Buffer<signed char> evaluate_filtered(std::size_t n, const Filter& filter, const Predicate& predicate)
+{
+  std::vector<signed char> out(n);
+  for_each_block(n, [&](std::size_t begin, std::size_t end)
+  {
+    evaluate_filtered_block(begin, end, filter, predicate, out.data());
+  });
+  return SWIG_CGAL::Buffer<signed char>(std::move(out));
+}
+
+// Intersection of the objects of the rows i of the arrays, intersection(i)
+// being the result of CGAL::intersection() on them
+template <int dimension, class Intersection>
+Intersection_batch intersections(std::size_t n, const Intersection& intersection)
+{
+  Intersection_batch out(n, dimension);
+  signed char* types = out.type_data();
+  double* points = out.point_data();
+  for_each_block(n, [&](std::size_t begin, std::size_t end)
+  {
+    for (std::size_t i = begin; i < end; ++i)
+      SWIG_CGAL::write_intersection<dimension>(intersection(i), types + i, points + 3 * dimension * i);
+  });
+  return out;
+}
+
+template <int dimension>
+SWIG_CGAL::Buffer<double> squared_distances(const SWIG_CGAL::Buffer<double>& p, const SWIG_CGAL::Buffer<double>& q)
+{
+  const std::size_t n = checked_rows(p, dimension);
+  checked_rows(q, dimension, n);
+  std::vector<double> out(n);
+  for_each_block(n, [&](std::size_t begin, std::size_t end)
+  {
+    squared_distances_block<dimension>(begin, end, p.data(), q.data(), out.data());
+  });
+  return SWIG_CGAL::Buffer<double>(std::move(out));
+}
+
+} // namespace internal
+} // namespace SWIG_Kernel
+#endif
+
+// Kernel predicates on the rows of arrays of coordinates: the i-th value of
+// the result is the predicate on the i-th rows of the arguments, which must
+// have the same number of rows. The signs are returned as -1, 0 and 1
+// (NEGATIVE, ZERO and POSITIVE...), the tests as 0 and 1. The functions run
+// without the GIL, on blocks of rows in parallel when linked with TBB.
+
+// (N, 2) arrays of points
+inline SWIG_CGAL::Buffer<signed char>
+orientation_2_batch(SWIG_CGAL::Buffer<double> p, SWIG_CGAL::Buffer<double> q, SWIG_CGAL::Buffer<double> r)
+{
+  using namespace SWIG_Kernel::internal;
+  const std::size_t n = checked_rows(p, 2);
+  checked_rows(q, 2, n);
+  checked_rows(r, 2, n);
+  const double *a = p.data(), *b = q.data(), *c = r.data();
+  return evaluate_filtered(n,
+    [=](std::size_t i) { return filtered_orientation_2(a+2*i, b+2*i, c+2*i); },
+    [=](std::size_t i) { return CGAL::orientation(point_2(a+2*i), point_2(b+2*i), point_2(c+2*i)); });
+}
+
+// (N, 3) arrays of points
+inline SWIG_CGAL::Buffer<signed char>
+orientation_3_batch(SWIG_CGAL::Buffer<double> p, SWIG_CGAL::Buffer<double> q,
+                    SWIG_CGAL::Buffer<double> r, SWIG_CGAL::Buffer<double> s)
+{
+  using namespace SWIG_Kernel::internal;
+  const std::size_t n = checked_rows(p, 3);
+  checked_rows(q, 3, n);
+  checked_rows(r, 3, n);
+  checked_rows(s, 3, n);
+  const double *a = p.data(), *b = q.data(), *c = r.data(), *d = s.data();
+  return evaluate_filtered(n,
+    [=](std::size_t i) { return filtered_orientation_3(a+3*i, b+3*i, c+3*i, d+3*i); },
+    [=](std::size_t i) { return CGAL::orientation(point_3(a+3*i), point_3(b+3*i), point_3(c+3*i), point_3(d+3*i)); });
+}
+
+// (N, 2) arrays of points: side of t with respect to the circle through p, q, r
+inline SWIG_CGAL::Buffer<signed char>
+side_of_oriented_circle_batch(SWIG_CGAL::Buffer<double> p, SWIG_CGAL::Buffer<double> q,
+                              SWIG_CGAL::Buffer<double> r, SWIG_CGAL::Buffer<double> t)
+{
+  using namespace SWIG_Kernel::internal;
+  const std::size_t n = checked_rows(p, 2);
+  checked_rows(q, 2, n);
+  checked_rows(r, 2, n);
+  checked_rows(t, 2, n);
+  const double *a = p.data(), *b = q.data(), *c = r.data(), *d = t.data();
+  return evaluate(n, [=](std::size_t i)
+  { return CGAL::side_of_oriented_circle(point_2(a+2*i), point_2(b+2*i), point_2(c+2*i), point_2(d+2*i)); });
+}
+
+// (N, 3) arrays of points: side of t with respect to the sphere through p, q, r, s
+inline SWIG_CGAL::Buffer<signed char>
+side_of_oriented_sphere_batch(SWIG_CGAL::Buffer<double> p, SWIG_CGAL::Buffer<double> q,
+                              SWIG_CGAL::Buffer<double> r, SWIG_CGAL::Buffer<double> s,
+                              SWIG_CGAL::Buffer<double> t)
+{
+  using namespace SWIG_Kernel::internal;
+  const std::size_t n = checked_rows(p, 3);
+  checked_rows(q, 3, n);
+  checked_rows(r, 3, n);
+  checked_rows(s, 3, n);
+  checked_rows(t, 3, n);
+  const double *a = p.data(), *b = q.data(), *c = r.data(), *d = s.data(), *e = t.data();
+  return evaluate(n, [=](std::size_t i)
+  {
+    return CGAL::side_of_oriented_sphere(point_3(a+3*i), point_3(b+3*i), point_3(c+3*i),
+                                         point_3(d+3*i), point_3(e+3*i));
+  });
+}
+
+// (N, 2) and (N, 3) arrays of points
+inline SWIG_CGAL::Buffer<double>
+squared_distance_2_batch(SWIG_CGAL::Buffer<double> p, SWIG_CGAL::Buffer<double> q)
+{
+  return SWIG_Kernel::internal::squared_distances<2>(p, q);
+}
+
+inline SWIG_CGAL::Buffer<double>
+squared_distance_3_batch(SWIG_CGAL::Buffer<double> p, SWIG_CGAL::Buffer<double> q)
+{
+  return SWIG_Kernel::internal::squared_distances<3>(p, q);
+}
+
+// (N, 4) arrays of segments (x0, y0, x1, y1)
+inline SWIG_CGAL::Buffer<signed char>
+do_intersect_segment_2_batch(SWIG_CGAL::Buffer<double> s1, SWIG_CGAL::Buffer<double> s2)
+{
+  using namespace SWIG_Kernel::internal;
+  const std::size_t n = checked_rows(s1, 4);
+  checked_rows(s2, 4, n);
+  const double *a = s1.data(), *b = s2.data();
+  return evaluate(n, [=](std::size_t i)
+  {
+    return CGAL::do_intersect(EPIC_Kernel::Segment_2(point_2(a+4*i), point_2(a+4*i+2)),
+                              EPIC_Kernel::Segment_2(point_2(b+4*i), point_2(b+4*i+2)));
+  });
+}
+
+// (N, 9) array of triangles (x0, y0, z0, ..., z2) and (N, 6) array of
+// segments (x0, y0, z0, x1, y1, z1)
+inline SWIG_CGAL::Buffer<signed char>
+do_intersect_triangle_3_segment_3_batch(SWIG_CGAL::Buffer<double> triangles, SWIG_CGAL::Buffer<double> segments)
+{
+  using namespace SWIG_Kernel::internal;
+  const std::size_t n = checked_rows(triangles, 9);
+  checked_rows(segments, 6, n);
+  const double *t = triangles.data(), *s = segments.data();
+  return evaluate(n, [=](std::size_t i)
+  {
+    return CGAL::do_intersect(EPIC_Kernel::Triangle_3(point_3(t+9*i), point_3(t+9*i+3), point_3(t+9*i+6)),
+                              EPIC_Kernel::Segment_3(point_3(s+6*i), point_3(s+6*i+3)));
+  });
+}
+
+// (N, 9) arrays of triangles
+inline SWIG_CGAL::Buffer<signed char>
+do_intersect_triangle_3_batch(SWIG_CGAL::Buffer<double> t1, SWIG_CGAL::Buffer<double> t2)
+{
+  using namespace SWIG_Kernel::internal;
+  const std::size_t n = checked_rows(t1, 9);
+  checked_rows(t2, 9, n);
+  const double *a = t1.data(), *b = t2.data();
+  return evaluate(n, [=](std::size_t i)
+  {
+    return CGAL::do_intersect(EPIC_Kernel::Triangle_3(point_3(a+9*i), point_3(a+9*i+3), point_3(a+9*i+6)),
+                              EPIC_Kernel::Triangle_3(point_3(b+9*i), point_3(b+9*i+3), point_3(b+9*i+6)));
+  });
+}
+
+// Intersections on the rows of arrays, see Intersection_batch. They are
+// computed as the predicates above.
+
+// (N, 4) arrays of segments
+inline Intersection_batch
+intersection_segment_2_batch(SWIG_CGAL::Buffer<double> s1, SWIG_CGAL::Buffer<double> s2)
+{
+  using namespace SWIG_Kernel::internal;
+  const std::size_t n = checked_rows(s1, 4);
+  checked_rows(s2, 4, n);
+  const double *a = s1.data(), *b = s2.data();
+  return intersections<2>(n, [=](std::size_t i)
+  {
+    return CGAL::intersection(EPIC_Kernel::Segment_2(point_2(a+4*i), point_2(a+4*i+2)),
+                              EPIC_Kernel::Segment_2(point_2(b+4*i), point_2(b+4*i+2)));
+  });
+}
+
+// (N, 9) array of triangles and (N, 6) array of segments
+inline Intersection_batch
+intersection_triangle_3_segment_3_batch(SWIG_CGAL::Buffer<double> triangles, SWIG_CGAL::Buffer<double> segments)
+{
+  using namespace SWIG_Kernel::internal;
+  const std::size_t n = checked_rows(triangles, 9);
+  checked_rows(segments, 6, n);
+  const double *t = triangles.data(), *s = segments.data();
+  return intersections<3>(n, [=](std::size_t i)
+  {
+    return CGAL::intersection(EPIC_Kernel::Triangle_3(point_3(t+9*i), point_3(t+9*i+3), point_3(t+9*i+6)),
+                              EPIC_Kernel::Segment_3(point_3(s+6*i), point_3(s+6*i+3)));
+  });
+}
+
+// (N, 9) array of triangles and (N, 6) array of rays (x, y, z of the source
+// and of the direction, which must not be null)
+inline Intersection_batch
+intersection_triangle_3_ray_3_batch(SWIG_CGAL::Buffer<double> triangles, SWIG_CGAL::Buffer<double> rays)
+{
+  using namespace SWIG_Kernel::internal;
+  const std::size_t n = checked_rows(triangles, 9);
+  checked_rows(rays, 6, n);
+  const double *t = triangles.data(), *r = rays.data();
+  for (std::size_t i = 0; i < n; ++i)
+    if (r[6*i+3] == 0. && r[6*i+4] == 0. && r[6*i+5] == 0.)
+      throw std::invalid_argument("The directions of the rays must not be null");
+  return intersections<3>(n, [=](std::size_t i)
+  {
+    return CGAL::intersection(EPIC_Kernel::Triangle_3(point_3(t+9*i), point_3(t+9*i+3), point_3(t+9*i+6)),
+                              EPIC_Kernel::Ray_3(point_3(r+6*i),
+                                                 EPIC_Kernel::Vector_3(r[6*i+3], r[6*i+4], r[6*i+5])));
+  });
+}
+
+// (N, 9) array of triangles and (N, 4) array of planes (a, b, c, d of the
+// equation ax+by+cz+d=0, (a, b, c) not null): the slices of the triangles
+inline Intersection_batch
+intersection_triangle_3_plane_3_batch(SWIG_CGAL::Buffer<double> triangles, SWIG_CGAL::Buffer<double> planes)
+{
+  using namespace SWIG_Kernel::internal;
+  const std::size_t n = checked_rows(triangles, 9);
+  checked_rows(planes, 4, n);
+  const double *t = triangles.data(), *p = planes.data();
+  for (std::size_t i = 0; i < n; ++i)
+    if (p[4*i] == 0. && p[4*i+1] == 0. && p[4*i+2] == 0.)
+      throw std::invalid_argument("The normals of the planes must not be null");
+  return intersections<3>(n, [=](std::size_t i)
+  {
+    return CGAL::intersection(EPIC_Kernel::Triangle_3(point_3(t+9*i), point_3(t+9*i+3), point_3(t+9*i+6)),
+                              EPIC_Kernel::Plane_3(p[4*i], p[4*i+1], p[4*i+2], p[4*i+3]));
+  });
+}
+
+#endif //SWIG_CGAL_KERNEL_BATCH_BATCH_FUNCTIONS_H
@@ -0,0 +1,188 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+
+#ifndef SWIG_CGAL_MESH_2_BATCH_MESHER_2_H
+#define SWIG_CGAL_MESH_2_BATCH_MESHER_2_H
+
+#include <SWIG_CGAL/Common/Buffer.h>
+#include <SWIG_CGAL/Common/Gil_release.h>
+#include <SWIG_CGAL/Common/Spatial_insertion.h>
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#ifndef SWIG
+#include <CGAL/Delaunay_mesher_2.h>
+#include <CGAL/Unique_hash_map.h>
+#include <CGAL/for_each.h>
+#include <CGAL/tags.h>
+#endif
+
+// Result of mesh_polygons_batch(): the meshes of the polygons concatenated.
+// The vertices (resp. triangles) of the mesh of polygon p are the rows
+// vertex_offsets()[p] to vertex_offsets()[p+1]-1 of point_array() (resp.
+// triangle_array()). The triangles refer to the rows of point_array().
+class Mesh_2_batch_result
+{
+  std::shared_ptr<std::vector<double> > points_sptr;
+  std::shared_ptr<std::vector<int> >    triangles_sptr;
+  std::shared_ptr<std::vector<int> >    vertex_offsets_sptr;
+  std::shared_ptr<std::vector<int> >    triangle_offsets_sptr;
+
+public:
+  Mesh_2_batch_result()
+    : points_sptr(new std::vector<double>())
+    , triangles_sptr(new std::vector<int>())
+    , vertex_offsets_sptr(new std::vector<int>(1, 0))
+    , triangle_offsets_sptr(new std::vector<int>(1, 0)) {}
+
+  #ifndef SWIG
+  Mesh_2_batch_result(std::vector<double>&& points, std::vector<int>&& triangles,
+                      std::vector<int>&& vertex_offsets, std::vector<int>&& triangle_offsets)
+    : points_sptr(new std::vector<double>(std::move(points)))
+    , triangles_sptr(new std::vector<int>(std::move(triangles)))
+    , vertex_offsets_sptr(new std::vector<int>(std::move(vertex_offsets)))
+    , triangle_offsets_sptr(new std::vector<int>(std::move(triangle_offsets))) {}
+  #endif
+
+  int number_of_polygons() const { return int(vertex_offsets_sptr->size()) - 1; }
+  int number_of_points() const { return int(points_sptr->size() / 2); }
+  int number_of_triangles() const { return int(triangles_sptr->size() / 3); }
+
+  // (number_of_points(), 2)
+  SWIG_CGAL::Buffer<double> point_array() const
+  {
+    return SWIG_CGAL::Buffer<double>(points_sptr->data(), points_sptr->size() / 2, 2,
+                                     points_sptr, true);
+  }
+  // (number_of_triangles(), 3)
+  SWIG_CGAL::Buffer<int> triangle_array() const
+  {
+    return SWIG_CGAL::Buffer<int>(triangles_sptr->data(), triangles_sptr->size() / 3, 3,
+                                  triangles_sptr, true);
+  }
+  // (number_of_polygons()+1, 1)
+  SWIG_CGAL::Buffer<int> vertex_offsets() const
+  {
+    return SWIG_CGAL::Buffer<int>(vertex_offsets_sptr->data(), vertex_offsets_sptr->size(), 1,
+                                  vertex_offsets_sptr, true);
+  }
+  // (number_of_polygons()+1, 1)
+  SWIG_CGAL::Buffer<int> triangle_offsets() const
+  {
+    return SWIG_CGAL::Buffer<int>(triangle_offsets_sptr->data(), triangle_offsets_sptr->size(), 1,
+                                  triangle_offsets_sptr, true);
+  }
+};
+
+#ifndef SWIG
+namespace SWIG_Mesh_2 {
+
+// Meshes independently each polygon p, whose boundary is made of the rows
+// polygon_offsets[p] to polygon_offsets[p+1]-1 of points (a closed ring, the
+// last row being linked to the first one), with the same criteria. The
+// polygons are meshed in parallel if CGAL is linked with TBB.
+template <class CDT, class Criteria>
+Mesh_2_batch_result mesh_polygons(const SWIG_CGAL::Buffer<double>& points,
+                                  const SWIG_CGAL::Buffer<int>& polygon_offsets,
+                                  const Criteria& criteria)
+{
+#ifdef CGAL_LINKED_WITH_TBB
+  typedef CGAL::Parallel_tag Concurrency_tag;
+#else
+  typedef CGAL::Sequential_tag Concurrency_tag;
+#endif
+  typedef typename CDT::Point         Point;
+  typedef typename CDT::Vertex_handle Vertex_handle;
+
+  const std::size_t n = SWIG_CGAL::number_of_rows(points, 2);
+  if (polygon_offsets.size() == 0)
+    throw std::invalid_argument("The polygon offsets must start with 0");
+  const std::size_t np = polygon_offsets.size() - 1;
+  const int* offsets = polygon_offsets.data();
+  if (offsets[0] != 0 || std::size_t(offsets[np]) != n)
+    throw std::invalid_argument("The polygon offsets must go from 0 to the number of points");
+  for (std::size_t p = 0; p < np; ++p)
+    if (offsets[p + 1] - offsets[p] < 3)
+      throw std::invalid_argument("Polygon " + std::to_string(p) + " has less than 3 points");
+  const double* coords = points.data();
+
+  struct Local_mesh
+  {
+    std::vector<double> points;
+    std::vector<int> triangles;
+  };
+  std::vector<Local_mesh> meshes(np);
+  std::vector<std::size_t> polygon_ids(np);
+  for (std::size_t p = 0; p < np; ++p)
+    polygon_ids[p] = p;
+
+  SWIG_CGAL::Gil_release gil;
+  CGAL::for_each<Concurrency_tag>
+    (polygon_ids, [&](const std::size_t& p) -> bool
+     {
+       CDT cdt;
+       std::vector<Vertex_handle> boundary;
+       for (int i = offsets[p]; i < offsets[p + 1]; ++i)
+         boundary.push_back(cdt.insert(Point(coords[2 * i], coords[2 * i + 1])));
+       for (std::size_t i = 0; i < boundary.size(); ++i)
+         if (boundary[i] != boundary[(i + 1) % boundary.size()])
+           cdt.insert_constraint(boundary[i], boundary[(i + 1) % boundary.size()]);
+       CGAL::refine_Delaunay_mesh_2(cdt, criteria);
+
+       Local_mesh& mesh = meshes[p];
+       CGAL::Unique_hash_map<Vertex_handle, int> vertex_index(-1, cdt.number_of_vertices());
+       for (typename CDT::Finite_faces_iterator f = cdt.finite_faces_begin();
+            f != cdt.finite_faces_end(); ++f)
+       {
+         if (!f->is_in_domain()) continue;
+         for (int i = 0; i < 3; ++i)
+         {
+           int& index = vertex_index[f->vertex(i)];
+           if (index == -1)
+           {
+             index = int(mesh.points.size() / 2);
+             mesh.points.push_back(f->vertex(i)->point().x());
+             mesh.points.push_back(f->vertex(i)->point().y());
+           }
+           mesh.triangles.push_back(index);
+         }
+       }
+       return true;
+     });
+
+  std::size_t total_points = 0, total_triangles = 0;
+  for (const Local_mesh& mesh : meshes)
+  {
+    total_points += mesh.points.size();
+    total_triangles += mesh.triangles.size();
+  }
+  std::vector<double> all_points;
+  std::vector<int> all_triangles, vertex_offsets(1, 0), triangle_offsets(1, 0);
+  all_points.reserve(total_points);
+  all_triangles.reserve(total_triangles);
+  vertex_offsets.reserve(np + 1);
+  triangle_offsets.reserve(np + 1);
+  for (const Local_mesh& mesh : meshes)
+  {
+    const int first = int(all_points.size() / 2);
+    all_points.insert(all_points.end(), mesh.points.begin(), mesh.points.end());
+    for (int v : mesh.triangles)
+      all_triangles.push_back(first + v);
+    vertex_offsets.push_back(int(all_points.size() / 2));
+    triangle_offsets.push_back(int(all_triangles.size() / 3));
+  }
+  return Mesh_2_batch_result(std::move(all_points), std::move(all_triangles),
+                             std::move(vertex_offsets), std::move(triangle_offsets));
+}
+
+} //namespace SWIG_Mesh_2
+#endif
+
+#endif //SWIG_CGAL_MESH_2_BATCH_MESHER_2_H
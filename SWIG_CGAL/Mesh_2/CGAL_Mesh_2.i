@@ -17,6 +17,13 @@ SWIG_CGAL_package_common()
 %import  "SWIG_CGAL/Common/Macros.h"
 %import  "SWIG_CGAL/Kernel/CGAL_Kernel.i"
 
+//typemaps for the insertion and location of points and the insertion of constraints from arrays
+%include "SWIG_CGAL/typemaps.i"
+SWIG_CGAL_buffer_of_double_typemap_in
+SWIG_CGAL_buffer_of_int_typemap_in
+SWIG_CGAL_buffer_of_double_typemap_out
+SWIG_CGAL_buffer_of_int_typemap_out
+
 //include files
 %{
   #include  <SWIG_CGAL/Kernel/typedefs.h>
@@ -30,10 +37,14 @@ SWIG_CGAL_package_common()
 %include "SWIG_CGAL/Mesh_2/Delaunay_mesher_2.h"
 %include "SWIG_CGAL/Mesh_2/Criteria.h"
 %include "SWIG_CGAL/Mesh_2/Triangulation_conformer_2.h"
+%include "SWIG_CGAL/Mesh_2/Batch_mesher_2.h"
+%include "SWIG_CGAL/Mesh_2/Quality_histogram.h"
+%typemap(javaimports)  Mesh_2_sizing_field %{import CGAL.Kernel.Point_2;%}
+%include "SWIG_CGAL/Mesh_2/Sizing_field_2.h"
 %import  "SWIG_CGAL/Triangulation_2/CGAL_Triangulation_2.i"
 
 %pragma(java) jniclassimports=%{import CGAL.Kernel.Ref_int; import CGAL.Triangulation_2.Ref_Locate_type_2; import CGAL.Triangulation_2.Constrained_Delaunay_triangulation_2; import CGAL.Triangulation_2.Constrained_Delaunay_triangulation_plus_2; import CGAL.Kernel.Point_2; import CGAL.Kernel.Polygon_2; import CGAL.Kernel.Segment_2;  import CGAL.Kernel.Triangle_2; import java.util.Iterator; import CGAL.Triangulation_2.Constraint; import java.util.Collection;%}
-%pragma(java) moduleimports  =%{import CGAL.Triangulation_2.Constrained_Delaunay_triangulation_2; import CGAL.Triangulation_2.Constrained_Delaunay_triangulation_plus_2; import java.util.Iterator;import CGAL.Kernel.Point_2;%}
+%pragma(java) moduleimports  =%{import CGAL.Triangulation_2.Constrained_Delaunay_triangulation_2; import CGAL.Triangulation_2.Constrained_Delaunay_triangulation_plus_2; import java.util.Iterator;import CGAL.Kernel.Point_2; import CGAL.Triangulation_2.Triangulation_2_arrays;%}
 
 
 //Extending the face type
@@ -91,6 +102,7 @@ SWIG_CGAL_set_as_java_iterator(SWIG_CGAL_Iterator,Point_2,import CGAL.Kernel.Poi
 SWIG_CGAL_declare_identifier_of_template_class(Delaunay_mesher_2_Seeds_const_iterator,SWIG_CGAL_Iterator<DM2_M::Seeds_const_iterator,Point_2>)
 
 SWIG_CGAL_declare_identifier_of_template_class(Delaunay_mesh_size_criteria_2,Criteria_wrapper<DM2_C>)
+SWIG_CGAL_declare_identifier_of_template_class(Delaunay_mesh_sizing_field_criteria_2,Sizing_field_criteria_wrapper<DM2_SFC>)
 %typemap(javaimports)  Delaunay_mesher_2_wrapper %{import CGAL.Kernel.Point_2; import java.util.Iterator; import CGAL.Triangulation_2.Constraint;%}
 SWIG_CGAL_declare_identifier_of_template_class(Default_Delaunay_mesher_2,Delaunay_mesher_2_wrapper<DM2_M,Mesh_2_Constrained_Delaunay_triangulation_2_SWIG_wrapper,Criteria_wrapper<DM2_C> >)
 
@@ -102,6 +114,7 @@ SWIG_CGAL_set_as_java_iterator(SWIG_CGAL_Iterator,Point_2,import CGAL.Kernel.Poi
 SWIG_CGAL_declare_identifier_of_template_class(Delaunay_mesher_plus_2_Seeds_const_iterator,SWIG_CGAL_Iterator<DM2_M_plus::Seeds_const_iterator,Point_2>)
 
 SWIG_CGAL_declare_identifier_of_template_class(Delaunay_mesh_plus_size_criteria_2,Criteria_wrapper<DM2_C_plus>)
+SWIG_CGAL_declare_identifier_of_template_class(Delaunay_mesh_plus_sizing_field_criteria_2,Sizing_field_criteria_wrapper<DM2_SFC_plus>)
 %typemap(javaimports)  Delaunay_mesher_2_wrapper %{import CGAL.Kernel.Point_2; import java.util.Iterator; import CGAL.Triangulation_2.Constraint;%}
 SWIG_CGAL_declare_identifier_of_template_class(Default_Delaunay_mesher_plus_2,Delaunay_mesher_2_wrapper<DM2_M_plus,Mesh_2_Constrained_Delaunay_triangulation_plus_2_SWIG_wrapper,Criteria_wrapper<DM2_C_plus> >)
 
@@ -116,6 +129,40 @@ declare_conforming_global_functions(Mesh_2_Constrained_Delaunay_triangulation_2_
 declare_conforming_global_functions(Mesh_2_Constrained_Delaunay_triangulation_plus_2_SWIG_wrapper)
 declare_refine_global_functions(Mesh_2_Constrained_Delaunay_triangulation_2_SWIG_wrapper, Criteria_wrapper<DM2_C>)
 declare_refine_global_functions(Mesh_2_Constrained_Delaunay_triangulation_plus_2_SWIG_wrapper, Criteria_wrapper<DM2_C_plus>)
+declare_refine_global_functions(Mesh_2_Constrained_Delaunay_triangulation_2_SWIG_wrapper, Sizing_field_criteria_wrapper<DM2_SFC>)
+declare_refine_global_functions(Mesh_2_Constrained_Delaunay_triangulation_plus_2_SWIG_wrapper, Sizing_field_criteria_wrapper<DM2_SFC_plus>)
+
+//meshes independently the polygons given as closed rings of rows of points,
+//polygon p being made of the rows polygon_offsets[p] to polygon_offsets[p+1]-1
+%inline %{
+  Mesh_2_batch_result mesh_polygons_batch(SWIG_CGAL::Buffer<double> points,
+                                          SWIG_CGAL::Buffer<int> polygon_offsets,
+                                          const Criteria_wrapper<DM2_C>& criteria)
+  {
+    return SWIG_Mesh_2::mesh_polygons<M2_CDT>(points, polygon_offsets, criteria.get_data());
+  }
+  Mesh_2_batch_result mesh_polygons_batch(SWIG_CGAL::Buffer<double> points,
+                                          SWIG_CGAL::Buffer<int> polygon_offsets,
+                                          const Sizing_field_criteria_wrapper<DM2_SFC>& criteria)
+  {
+    return SWIG_Mesh_2::mesh_polygons<M2_CDT>(points, polygon_offsets, criteria.get_data());
+  }
+%}
+
+//conforming triangulation of the constraints between the rows (x,y) of `points`
+//given by the rows (i,j) of `segments`
+%inline %{
+  Triangulation_2_arrays make_conforming_Delaunay_2(SWIG_CGAL::Buffer<double> points,
+                                                    SWIG_CGAL::Buffer<int> segments)
+  {
+    return SWIG_Mesh_2::make_conforming_2<CGAL_CDT2>(points, segments, false);
+  }
+  Triangulation_2_arrays make_conforming_Gabriel_2(SWIG_CGAL::Buffer<double> points,
+                                                   SWIG_CGAL::Buffer<int> segments)
+  {
+    return SWIG_Mesh_2::make_conforming_2<CGAL_CDT2>(points, segments, true);
+  }
+%}
 
 
 %include "CGAL/version.h"
@@ -124,6 +171,22 @@ declare_refine_global_functions(Mesh_2_Constrained_Delaunay_triangulation_plus_2
 declare_lloyd_2_global_functions(Mesh_2_Constrained_Delaunay_triangulation_2_SWIG_wrapper)
 declare_lloyd_2_global_functions(Mesh_2_Constrained_Delaunay_triangulation_plus_2_SWIG_wrapper)
 
+//minimum angles and aspect ratios of the faces in the domain, with nb_bins bins
+%inline %{
+  Mesh_2_quality_histogram quality_histogram(const Mesh_2_Constrained_Delaunay_triangulation_2_SWIG_wrapper& t, int nb_bins = 10)
+  {
+    Mesh_2_quality_histogram out;
+    SWIG_Mesh_2::quality_histogram(t.get_data(), nb_bins, out);
+    return out;
+  }
+  Mesh_2_quality_histogram quality_histogram(const Mesh_2_Constrained_Delaunay_triangulation_plus_2_SWIG_wrapper& t, int nb_bins = 10)
+  {
+    Mesh_2_quality_histogram out;
+    SWIG_Mesh_2::quality_histogram(t.get_data(), nb_bins, out);
+    return out;
+  }
+%}
+
 #ifdef SWIGJAVA
 %include "SWIG_CGAL/Mesh_2/java_extensions.i"
 #endif
@@ -0,0 +1,283 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+
+#ifndef SWIG_CGAL_MESH_2_INCREMENTAL_CONFORMER_2_H
+#define SWIG_CGAL_MESH_2_INCREMENTAL_CONFORMER_2_H
+
+#include <SWIG_CGAL/Common/Buffer.h>
+#include <SWIG_CGAL/Common/Gil_release.h>
+#include <SWIG_CGAL/Common/Spatial_insertion.h>
+#include <SWIG_CGAL/Triangulation_2/Triangulation_2_arrays.h>
+
+#include <CGAL/Spatial_sort_traits_adapter_2.h>
+#include <CGAL/Triangulation_conformer_2.h>
+
+#include <algorithm>
+#include <cmath>
+#include <deque>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace SWIG_Mesh_2 {
+
+namespace internal {
+
+// pairs of rows of `points` given by the rows (i,j) of `segments`
+inline std::vector<std::pair<std::size_t, std::size_t> >
+segment_indices(const SWIG_CGAL::Buffer<int>& segments, std::size_t nb_points)
+{
+  const std::size_t m = SWIG_CGAL::number_of_rows(segments, 2);
+  const int* ids = segments.data();
+  std::vector<std::pair<std::size_t, std::size_t> > out;
+  out.reserve(m);
+  for (std::size_t k = 0; k < m; ++k)
+  {
+    if (ids[2 * k] < 0 || std::size_t(ids[2 * k]) >= nb_points ||
+        ids[2 * k + 1] < 0 || std::size_t(ids[2 * k + 1]) >= nb_points)
+      throw std::out_of_range("Invalid point index in segment " + std::to_string(k));
+    out.push_back(std::make_pair(std::size_t(ids[2 * k]), std::size_t(ids[2 * k + 1])));
+  }
+  return out;
+}
+
+// the criteria of CGAL::Triangulation_conformer_2 for the constrained edge
+// (f,i): no vertex of its incident faces in its diametral circle (Gabriel),
+// or its incident faces Delaunay
+template <class CDT>
+bool is_locally_conforming(const CDT& cdt, typename CDT::Face_handle f, int i, bool gabriel)
+{
+  typedef typename CDT::Face_handle Face_handle;
+  const Face_handle g = f->neighbor(i);
+  if (!gabriel)
+    return cdt.is_infinite(f) || cdt.is_infinite(g) ||
+           cdt.side_of_oriented_circle(f, cdt.mirror_vertex(f, i)->point()) != CGAL::ON_POSITIVE_SIDE;
+  const typename CDT::Point& a = f->vertex(cdt.cw(i))->point();
+  const typename CDT::Point& b = f->vertex(cdt.ccw(i))->point();
+  if (!cdt.is_infinite(f) && CGAL::angle(a, f->vertex(i)->point(), b) == CGAL::OBTUSE)
+    return false;
+  return cdt.is_infinite(g) || CGAL::angle(a, cdt.mirror_vertex(f, i)->point(), b) != CGAL::OBTUSE;
+}
+
+// true if v is not inside a straight chain of constrained edges
+template <class CDT>
+bool is_corner(const CDT& cdt, typename CDT::Vertex_handle v)
+{
+  std::vector<typename CDT::Vertex_handle> ends;
+  typename CDT::Edge_circulator e = cdt.incident_edges(v), done = e;
+  if (e != 0)
+    do {
+      if (!cdt.is_infinite(e) && cdt.is_constrained(*e))
+      {
+        const typename CDT::Vertex_handle a = e->first->vertex(cdt.cw(e->second));
+        ends.push_back(a == v ? e->first->vertex(cdt.ccw(e->second)) : a);
+      }
+    } while (++e != done);
+  return ends.size() != 2 ||
+         CGAL::orientation(ends[0]->point(), v->point(), ends[1]->point()) != CGAL::COLLINEAR;
+}
+
+// Splitting point of the constrained edge (a,b): at a power of two distance
+// from its endpoint if only one is a corner (the concentric shells that keep
+// subsegments at a small angle from splitting each other forever), its
+// midpoint otherwise
+template <class CDT>
+typename CDT::Point split_point(const CDT& cdt, typename CDT::Vertex_handle a, typename CDT::Vertex_handle b)
+{
+  const bool a_corner = is_corner(cdt, a), b_corner = is_corner(cdt, b);
+  if (b_corner && !a_corner) std::swap(a, b);
+  const double ax = a->point().x(), ay = a->point().y();
+  const double dx = b->point().x() - ax, dy = b->point().y() - ay;
+  double t = 0.5;
+  if (a_corner != b_corner)
+  {
+    const double length = std::sqrt(dx * dx + dy * dy);
+    t = std::exp2(std::round(std::log2(length / 2))) / length;
+  }
+  return typename CDT::Point(ax + t * dx, ay + t * dy);
+}
+
+// Vertices of the faces of a 2D triangulation crossed by the segment from
+// va to vb, passing through the vertices on it
+template <class CDT>
+void crossed_vertices(const CDT& cdt, typename CDT::Vertex_handle va, typename CDT::Vertex_handle vb,
+                      std::vector<typename CDT::Vertex_handle>& out)
+{
+  typedef typename CDT::Vertex_handle Vertex_handle;
+  typedef typename CDT::Face_handle   Face_handle;
+  const typename CDT::Point& q = vb->point();
+  Vertex_handle c = va;
+  while (c != vb)
+  {
+    out.push_back(c);
+    const typename CDT::Point& p = c->point();
+    // the face of c whose opposite edge (right, left) the segment crosses,
+    // or the next vertex on the segment
+    Face_handle f;
+    Vertex_handle right, left, next;
+    typename CDT::Face_circulator fc = cdt.incident_faces(c), done = fc;
+    do {
+      if (cdt.is_infinite(fc)) continue;
+      const int i = fc->index(c);
+      const Vertex_handle s = fc->vertex(cdt.ccw(i)), t = fc->vertex(cdt.cw(i));
+      const CGAL::Orientation os = cdt.orientation(p, s->point(), q), ot = cdt.orientation(p, t->point(), q);
+      if (os == CGAL::COLLINEAR && CGAL::angle(s->point(), p, q) == CGAL::ACUTE) next = s;
+      else if (ot == CGAL::COLLINEAR && CGAL::angle(t->point(), p, q) == CGAL::ACUTE) next = t;
+      else if (os == CGAL::LEFT_TURN && ot == CGAL::RIGHT_TURN) { f = fc; right = s; left = t; }
+    } while (next == Vertex_handle() && f == Face_handle() && ++fc != done);
+    if (next != Vertex_handle()) { c = next; continue; }
+    if (f == Face_handle())
+      throw std::runtime_error("Cannot walk along a constraint");
+
+    out.push_back(right);
+    out.push_back(left);
+    for (;;)
+    {
+      const Face_handle g = f->neighbor(3 - f->index(right) - f->index(left));
+      const Vertex_handle w = g->vertex(3 - g->index(right) - g->index(left));
+      out.push_back(w);
+      const CGAL::Orientation o = cdt.orientation(p, q, w->point());
+      if (w == vb || o == CGAL::COLLINEAR) { c = w; break; }
+      if (o == CGAL::RIGHT_TURN) right = w; else left = w;
+      f = g;
+    }
+  }
+  out.push_back(vb);
+}
+
+// Splits the constrained edges (a,b) of `queue` until they are all locally
+// conforming, adding to the queue the constrained edges around each new
+// vertex. Returns the number of new vertices.
+template <class CDT>
+int conform_edges(CDT& cdt,
+                  std::deque<std::pair<typename CDT::Vertex_handle, typename CDT::Vertex_handle> >& queue,
+                  bool gabriel)
+{
+  typedef typename CDT::Vertex_handle Vertex_handle;
+  typedef typename CDT::Face_handle   Face_handle;
+  int nb_new_vertices = 0;
+  while (!queue.empty())
+  {
+    const Vertex_handle a = queue.front().first, b = queue.front().second;
+    queue.pop_front();
+    Face_handle f;
+    int i;
+    if (!cdt.is_edge(a, b, f, i) || !f->is_constrained(i) || is_locally_conforming(cdt, f, i, gabriel))
+      continue;
+    const typename CDT::Point p = split_point(cdt, a, b);
+    if (p == a->point() || p == b->point())
+      throw std::runtime_error("A constrained edge is too small to be split");
+    const Vertex_handle v = cdt.insert(p, CDT::EDGE, f, i);
+    ++nb_new_vertices;
+    typename CDT::Face_circulator fc = cdt.incident_faces(v), done = fc;
+    do {
+      for (int k = 0; k < 3; ++k)
+        if (fc->is_constrained(k))
+          queue.push_back(std::make_pair(fc->vertex(cdt.cw(k)), fc->vertex(cdt.ccw(k))));
+    } while (++fc != done);
+  }
+  return nb_new_vertices;
+}
+
+} // namespace internal
+
+// Triangulation conforming the constraints between the rows (x,y) of
+// `points` given by the rows (i,j) of `segments`, Gabriel or Delaunay
+template <class CDT>
+Triangulation_2_arrays make_conforming_2(const SWIG_CGAL::Buffer<double>& points,
+                                         const SWIG_CGAL::Buffer<int>& segments,
+                                         bool gabriel)
+{
+  const std::size_t n = SWIG_CGAL::number_of_rows(points, 2);
+  const std::vector<std::pair<std::size_t, std::size_t> > indices = internal::segment_indices(segments, n);
+  const double* coords = points.data();
+  std::vector<typename CDT::Point> cpp_points;
+  cpp_points.reserve(n);
+  for (std::size_t i = 0; i < n; ++i)
+    cpp_points.push_back(typename CDT::Point(coords[2 * i], coords[2 * i + 1]));
+
+  SWIG_CGAL::Gil_release gil;
+  CDT cdt;
+  cdt.insert_constraints(cpp_points.begin(), cpp_points.end(), indices.begin(), indices.end());
+  if (gabriel)
+    CGAL::make_conforming_Gabriel_2(cdt);
+  else
+    CGAL::make_conforming_Delaunay_2(cdt);
+  return Triangulation_2_arrays(cdt);
+}
+
+// Inserts in `cdt` the rows (x,y) of `points` and the constraints given by
+// the rows (i,j) of `segments`, then makes `cdt` conforming again, Gabriel or
+// Delaunay, checking and splitting only the constrained edges around the new
+// points and the faces crossed by the new constraints, and around the points
+// this adds. `cdt` must be conforming before the call for the result to be
+// conforming everywhere. Returns the number of new vertices.
+template <class CDT>
+int insert_and_conform_2(CDT& cdt,
+                         const SWIG_CGAL::Buffer<double>& points,
+                         const SWIG_CGAL::Buffer<int>& segments,
+                         bool gabriel)
+{
+  typedef typename CDT::Vertex_handle Vertex_handle;
+  typedef SWIG_CGAL::Array_point_map<typename CDT::Point, 2> Point_map;
+  const std::size_t n = SWIG_CGAL::number_of_rows(points, 2);
+  const std::vector<std::pair<std::size_t, std::size_t> > indices = internal::segment_indices(segments, n);
+  const double* coords = points.data();
+  const std::size_t size_before = cdt.number_of_vertices();
+
+  std::vector<Vertex_handle> vertices;
+  SWIG_CGAL::insert_in_spatial_order(cdt, n,
+    CGAL::Spatial_sort_traits_adapter_2<typename CDT::Geom_traits, Point_map>(Point_map(coords, 2)),
+    [coords](std::size_t i){ return typename CDT::Point(coords[2 * i], coords[2 * i + 1]); },
+    [&cdt](const typename CDT::Point& p, Vertex_handle previous){
+      return cdt.insert(p, previous == Vertex_handle() ? typename CDT::Face_handle() : previous->face());
+    },
+    &vertices);
+
+  SWIG_CGAL::Gil_release gil;
+  if (cdt.dimension() < 2)
+  {
+    for (const std::pair<std::size_t, std::size_t>& s : indices)
+      if (vertices[s.first] != vertices[s.second])
+        cdt.insert_constraint(vertices[s.first], vertices[s.second]);
+    if (gabriel)
+      CGAL::make_conforming_Gabriel_2(cdt);
+    else
+      CGAL::make_conforming_Delaunay_2(cdt);
+    return int(cdt.number_of_vertices() - size_before);
+  }
+
+  // the faces changed by the insertions are incident to these vertices
+  std::vector<Vertex_handle> region(vertices);
+  for (const std::pair<std::size_t, std::size_t>& s : indices)
+  {
+    const Vertex_handle va = vertices[s.first], vb = vertices[s.second];
+    if (va == vb) continue;
+    internal::crossed_vertices(cdt, va, vb, region);
+    cdt.insert_constraint(va, vb);
+  }
+  std::sort(region.begin(), region.end());
+  region.erase(std::unique(region.begin(), region.end()), region.end());
+
+  std::deque<std::pair<Vertex_handle, Vertex_handle> > queue;
+  for (Vertex_handle v : region)
+  {
+    if (cdt.is_infinite(v)) continue;
+    typename CDT::Face_circulator fc = cdt.incident_faces(v), done = fc;
+    do {
+      for (int k = 0; k < 3; ++k)
+        if (fc->is_constrained(k))
+          queue.push_back(std::make_pair(fc->vertex(cdt.cw(k)), fc->vertex(cdt.ccw(k))));
+    } while (++fc != done);
+  }
+  internal::conform_edges(cdt, queue, gabriel);
+  return int(cdt.number_of_vertices() - size_before);
+}
+
+} // namespace SWIG_Mesh_2
+
+#endif //SWIG_CGAL_MESH_2_INCREMENTAL_CONFORMER_2_H
@@ -0,0 +1,185 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+
+#ifndef SWIG_CGAL_MESH_2_QUALITY_HISTOGRAM_H
+#define SWIG_CGAL_MESH_2_QUALITY_HISTOGRAM_H
+
+#include <SWIG_CGAL/Common/Buffer.h>
+
+#ifndef SWIG
+#include <SWIG_CGAL/Common/Gil_release.h>
+
+#include <CGAL/for_each.h>
+#include <CGAL/tags.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#endif
+
+#include <memory>
+#include <vector>
+
+// Result of quality_histogram(): the minimum angle (in degrees) and the
+// aspect ratio of each face in the domain, in the order of finite_faces(),
+// and their distributions. The aspect ratio is the longest edge divided by
+// 2*sqrt(3) times the inradius: 1 for an equilateral triangle, infinite for
+// a degenerate one. The bins of the minimum angles split [0,60] evenly, the
+// ones of the aspect ratios [1, largest finite aspect ratio], the last bin
+// also counting the infinite ratios.
+class Mesh_2_quality_histogram
+{
+  std::shared_ptr<std::vector<double> > min_angles_sptr;
+  std::shared_ptr<std::vector<double> > aspect_ratios_sptr;
+  std::shared_ptr<std::vector<int> >    min_angle_counts_sptr;
+  std::shared_ptr<std::vector<double> > min_angle_bins_sptr;
+  std::shared_ptr<std::vector<int> >    aspect_ratio_counts_sptr;
+  std::shared_ptr<std::vector<double> > aspect_ratio_bins_sptr;
+
+  template <class T>
+  static SWIG_CGAL::Buffer<T> view(const std::shared_ptr<std::vector<T> >& v)
+  {
+    return SWIG_CGAL::Buffer<T>(v->data(), v->size(), 1, v, true);
+  }
+
+public:
+  Mesh_2_quality_histogram()
+    : min_angles_sptr(new std::vector<double>())
+    , aspect_ratios_sptr(new std::vector<double>())
+    , min_angle_counts_sptr(new std::vector<int>())
+    , min_angle_bins_sptr(new std::vector<double>())
+    , aspect_ratio_counts_sptr(new std::vector<int>())
+    , aspect_ratio_bins_sptr(new std::vector<double>()) {}
+  #ifndef SWIG
+  std::vector<double>& min_angles() const { return *min_angles_sptr; }
+  std::vector<double>& aspect_ratios() const { return *aspect_ratios_sptr; }
+  std::vector<int>& min_angle_counts() const { return *min_angle_counts_sptr; }
+  std::vector<double>& min_angle_bins() const { return *min_angle_bins_sptr; }
+  std::vector<int>& aspect_ratio_counts() const { return *aspect_ratio_counts_sptr; }
+  std::vector<double>& aspect_ratio_bins() const { return *aspect_ratio_bins_sptr; }
+  #endif
+
+  int number_of_faces() const { return int(min_angles_sptr->size()); }
+  // smallest angle of the faces, 60 without faces
+  double min_angle() const
+  {
+    return min_angles_sptr->empty() ? 60 : *std::min_element(min_angles_sptr->begin(), min_angles_sptr->end());
+  }
+  // largest aspect ratio of the faces, 1 without faces
+  double max_aspect_ratio() const
+  {
+    return aspect_ratios_sptr->empty() ? 1 : *std::max_element(aspect_ratios_sptr->begin(), aspect_ratios_sptr->end());
+  }
+
+  // (F,) for each face
+  SWIG_CGAL::Buffer<double> min_angle_array() const { return view(min_angles_sptr); }
+  SWIG_CGAL::Buffer<double> aspect_ratio_array() const { return view(aspect_ratios_sptr); }
+  // (B,) number of faces in each bin, (B+1,) bounds of the bins
+  SWIG_CGAL::Buffer<int> min_angle_count_array() const { return view(min_angle_counts_sptr); }
+  SWIG_CGAL::Buffer<double> min_angle_bin_array() const { return view(min_angle_bins_sptr); }
+  SWIG_CGAL::Buffer<int> aspect_ratio_count_array() const { return view(aspect_ratio_counts_sptr); }
+  SWIG_CGAL::Buffer<double> aspect_ratio_bin_array() const { return view(aspect_ratio_bins_sptr); }
+};
+
+#ifndef SWIG
+namespace SWIG_Mesh_2 {
+
+namespace internal {
+
+// counts of `values` in the nb_bins bins splitting [bins[0], bins[nb_bins]],
+// the values out of range going to the first or last bin
+inline void fill_histogram(const std::vector<double>& values, std::size_t nb_bins,
+                           double min, double max,
+                           std::vector<int>& counts, std::vector<double>& bins)
+{
+  bins.resize(nb_bins + 1);
+  for (std::size_t b = 0; b <= nb_bins; ++b)
+    bins[b] = min + (max - min) * double(b) / double(nb_bins);
+  counts.assign(nb_bins, 0);
+  for (double v : values)
+  {
+    const double x = max > min ? (v - min) / (max - min) * double(nb_bins) : 0;
+    const std::size_t b = !(x > 0) ? 0 : x >= double(nb_bins) ? nb_bins - 1 : std::size_t(x);
+    ++counts[b];
+  }
+}
+
+} // namespace internal
+
+// Quality of the faces in the domain of the Mesh_2 triangulation `cdt`,
+// computed concurrently by blocks of faces if CGAL is linked with TBB
+template <class CDT>
+void quality_histogram(const CDT& cdt, int nb_bins, Mesh_2_quality_histogram& out)
+{
+#ifdef CGAL_LINKED_WITH_TBB
+  typedef CGAL::Parallel_tag Concurrency_tag;
+#else
+  typedef CGAL::Sequential_tag Concurrency_tag;
+#endif
+  typedef typename CDT::Face_handle Face_handle;
+  if (nb_bins < 1)
+    throw std::invalid_argument("The number of bins must be positive");
+
+  SWIG_CGAL::Gil_release gil;
+  std::vector<Face_handle> faces;
+  for (typename CDT::Finite_faces_iterator f = cdt.finite_faces_begin(); f != cdt.finite_faces_end(); ++f)
+    if (f->is_in_domain())
+      faces.push_back(f);
+
+  std::vector<double>& min_angles = out.min_angles();
+  std::vector<double>& aspect_ratios = out.aspect_ratios();
+  min_angles.resize(faces.size());
+  aspect_ratios.resize(faces.size());
+  const std::size_t block_size = 4096;
+  std::vector<std::size_t> blocks((faces.size() + block_size - 1) / block_size);
+  for (std::size_t b = 0; b < blocks.size(); ++b)
+    blocks[b] = b * block_size;
+  CGAL::for_each<Concurrency_tag>(blocks, [&](const std::size_t& begin) -> bool
+  {
+    const std::size_t end = (std::min)(begin + block_size, faces.size());
+    for (std::size_t f = begin; f < end; ++f)
+    {
+      double x[3], y[3], lengths[3];
+      for (int i = 0; i < 3; ++i)
+      {
+        x[i] = faces[f]->vertex(i)->point().x();
+        y[i] = faces[f]->vertex(i)->point().y();
+      }
+      double min_angle = 180;
+      for (int i = 0; i < 3; ++i)
+      {
+        const int j = (i + 1) % 3, k = (i + 2) % 3;
+        const double ux = x[j] - x[i], uy = y[j] - y[i], vx = x[k] - x[i], vy = y[k] - y[i];
+        lengths[k] = std::sqrt(ux * ux + uy * uy);
+        min_angle = (std::min)(min_angle, std::atan2(std::abs(ux * vy - uy * vx), ux * vx + uy * vy));
+      }
+      min_angles[f] = min_angle * 180 / 3.14159265358979323846;
+      const double twice_area = std::abs((x[1] - x[0]) * (y[2] - y[0]) - (y[1] - y[0]) * (x[2] - x[0]));
+      const double perimeter = lengths[0] + lengths[1] + lengths[2];
+      const double longest = (std::max)(lengths[0], (std::max)(lengths[1], lengths[2]));
+      // the inradius is twice the area divided by the perimeter
+      aspect_ratios[f] = twice_area > 0 ? longest * perimeter / (2 * std::sqrt(3.) * twice_area)
+                                        : std::numeric_limits<double>::infinity();
+    }
+    return true;
+  });
+
+  double max_ratio = 1;
+  for (double r : aspect_ratios)
+    if (r != std::numeric_limits<double>::infinity())
+      max_ratio = (std::max)(max_ratio, r);
+  internal::fill_histogram(min_angles, std::size_t(nb_bins), 0, 60,
+                           out.min_angle_counts(), out.min_angle_bins());
+  internal::fill_histogram(aspect_ratios, std::size_t(nb_bins), 1, max_ratio,
+                           out.aspect_ratio_counts(), out.aspect_ratio_bins());
+}
+
+} // namespace SWIG_Mesh_2
+#endif
+
+#endif //SWIG_CGAL_MESH_2_QUALITY_HISTOGRAM_H
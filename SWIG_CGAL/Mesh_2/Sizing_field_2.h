@@ -0,0 +1,300 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+
+#ifndef SWIG_CGAL_MESH_2_SIZING_FIELD_2_H
+#define SWIG_CGAL_MESH_2_SIZING_FIELD_2_H
+
+#include <SWIG_CGAL/Common/Buffer.h>
+#include <SWIG_CGAL/Kernel/Point_2.h>
+
+#include <limits>
+#include <memory>
+
+#ifndef SWIG
+#include <SWIG_CGAL/Common/Sampled_grid.h>
+#include <SWIG_CGAL/Common/Spatial_insertion.h>
+#include <CGAL/Delaunay_mesh_size_criteria_2.h>
+#include <CGAL/Delaunay_triangulation_2.h>
+#include <CGAL/interpolation_functions.h>
+#include <CGAL/natural_neighbor_coordinates_2.h>
+#include <CGAL/number_utils.h>
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <iterator>
+#include <map>
+#include <queue>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace SWIG_Mesh_2 {
+namespace internal {
+
+// Sizes given at scattered points, interpolated with the natural neighbor
+// coordinates of the Interpolation package. The points out of the convex
+// hull take the size of their nearest sample.
+class Scattered_sizes_2
+{
+  typedef CGAL::Delaunay_triangulation_2<EPIC_Kernel>                       Dt;
+  typedef Dt::Point                                                         Point;
+  typedef std::map<Point, double, EPIC_Kernel::Less_xy_2>                   Size_map;
+
+  Dt dt;
+  Size_map sizes;
+
+public:
+  Scattered_sizes_2(const SWIG_CGAL::Buffer<double>& points, const SWIG_CGAL::Buffer<double>& values)
+  {
+    const std::size_t n = SWIG_CGAL::number_of_rows(points, 2);
+    if (values.size() != n)
+      throw std::invalid_argument("The number of sizes must be the number of points");
+    if (n == 0)
+      throw std::invalid_argument("At least one sample is needed");
+    const double* c = points.data();
+    std::vector<Point> samples;
+    samples.reserve(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+      samples.push_back(Point(c[2 * i], c[2 * i + 1]));
+      // duplicated points keep the smallest size
+      std::pair<Size_map::iterator, bool> res = sizes.insert(std::make_pair(samples.back(), values.data()[i]));
+      if (!res.second)
+        res.first->second = (std::min)(res.first->second, values.data()[i]);
+    }
+    dt.insert(samples.begin(), samples.end());
+  }
+
+  double value(double x, double y) const
+  {
+    const Point p(x, y);
+    if (dt.dimension() == 2)
+    {
+      std::vector<std::pair<Point, double> > coords;
+      const auto res = CGAL::natural_neighbor_coordinates_2(dt, p, std::back_inserter(coords));
+      if (res.third)
+        return CGAL::linear_interpolation(coords.begin(), coords.end(), res.second,
+                                          CGAL::Data_access<Size_map>(sizes));
+    }
+    return sizes.find(dt.nearest_vertex(p)->point())->second;
+  }
+
+  // Each size becomes the minimum over the samples s of size(s) + k * (length
+  // of the shortest path from s along the Delaunay edges) (Dijkstra).
+  void make_lipschitz(double k)
+  {
+    typedef std::pair<double, Point> Entry;
+    if (!(k > 0))
+      throw std::invalid_argument("The Lipschitz constant must be positive");
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry> > queue;
+    for (const Size_map::value_type& s : sizes)
+      queue.push(Entry(s.second, s.first));
+    while (!queue.empty())
+    {
+      const Entry e = queue.top();
+      queue.pop();
+      if (e.first > sizes[e.second]) continue; // outdated entry
+      Dt::Vertex_handle v = dt.nearest_vertex(e.second);
+      Dt::Vertex_circulator w = dt.incident_vertices(v), done(w);
+      if (w == nullptr) continue;
+      do
+      {
+        if (dt.is_infinite(w)) continue;
+        const double size = e.first + k * std::sqrt(CGAL::squared_distance(e.second, w->point()));
+        double& current = sizes[w->point()];
+        if (size < current)
+        {
+          current = size;
+          queue.push(Entry(size, w->point()));
+        }
+      } while (++w != done);
+    }
+  }
+};
+
+} //namespace internal
+} //namespace SWIG_Mesh_2
+#endif
+
+// Sizing field of the Mesh_2 criteria Delaunay_mesh_sizing_field_criteria_2,
+// defined by sizes sampled on a regular grid or at scattered points. The
+// samples are copied, so that meshing never calls back into the target
+// language. A default constructed field does not bound the size.
+class Mesh_2_sizing_field
+{
+  std::shared_ptr<const SWIG_CGAL::Sampled_grid<2> >                grid_sptr;
+  std::shared_ptr<const SWIG_Mesh_2::internal::Scattered_sizes_2>  samples_sptr;
+
+public:
+  #ifndef SWIG
+  double value(double x, double y) const
+  {
+    if (grid_sptr)
+    {
+      const double c[2] = { x, y };
+      return grid_sptr->value(c);
+    }
+    if (samples_sptr)
+      return samples_sptr->value(x, y);
+    return (std::numeric_limits<double>::max)();
+  }
+  #endif
+
+  Mesh_2_sizing_field() {}
+
+  // the sample (i,j) of values is at origin + (i*vx, j*vy) and is of index
+  // i + xdim*j; bilinear interpolation, the points out of the grid taking the
+  // size of the nearest point of the grid.
+  static Mesh_2_sizing_field create_from_grid(SWIG_CGAL::Buffer<double> values, int xdim, int ydim,
+                                              const Point_2& origin, double vx, double vy)
+  {
+    const int dims[2] = { xdim, ydim };
+    const double o[2] = { origin.x(), origin.y() };
+    const double spacing[2] = { vx, vy };
+    Mesh_2_sizing_field field;
+    field.grid_sptr = std::make_shared<const SWIG_CGAL::Sampled_grid<2> >(values, dims, o, spacing);
+    return field;
+  }
+
+  // sizes[i] is the size at the point of the row i (x,y) of points
+  static Mesh_2_sizing_field create_from_samples(SWIG_CGAL::Buffer<double> points, SWIG_CGAL::Buffer<double> sizes)
+  {
+    Mesh_2_sizing_field field;
+    field.samples_sptr = std::make_shared<const SWIG_Mesh_2::internal::Scattered_sizes_2>(points, sizes);
+    return field;
+  }
+
+  // Lowers the samples so that the sizes grow by at most k per unit of
+  // length between neighboring samples (along the grid axes or the edges of
+  // the Delaunay triangulation of the points). The copies of the field are
+  // not modified.
+  void make_lipschitz(double k)
+  {
+    if (grid_sptr)
+    {
+      std::shared_ptr<SWIG_CGAL::Sampled_grid<2> > grid = std::make_shared<SWIG_CGAL::Sampled_grid<2> >(*grid_sptr);
+      grid->make_lipschitz(k);
+      grid_sptr = grid;
+    }
+    else if (samples_sptr)
+    {
+      std::shared_ptr<SWIG_Mesh_2::internal::Scattered_sizes_2> samples =
+        std::make_shared<SWIG_Mesh_2::internal::Scattered_sizes_2>(*samples_sptr);
+      samples->make_lipschitz(k);
+      samples_sptr = samples;
+    }
+  }
+
+  double value(const Point_2& p) const { return value(p.x(), p.y()); }
+
+  //deep copy (the samples are never modified in place)
+  typedef Mesh_2_sizing_field Self;
+  Self deepcopy() const { return *this; }
+  void deepcopy(const Self& other) { *this = other; }
+};
+
+#ifndef SWIG
+namespace SWIG_Mesh_2 {
+
+// Same as CGAL::Delaunay_mesh_size_criteria_2, the bound on the length of
+// the edges of a face being the size of the field at its centroid.
+template <class CDT>
+class Delaunay_mesh_sizing_field_criteria_2
+{
+  typedef typename CDT::Point Point;
+
+  double m_aspect_bound;
+  Mesh_2_sizing_field m_field;
+
+public:
+  typedef typename CDT::Face_handle                                         Face_handle;
+  typedef typename CGAL::Delaunay_mesh_size_criteria_2<CDT>::Quality        Quality;
+
+  Delaunay_mesh_sizing_field_criteria_2(double aspect_bound = 0.125,
+                                        const Mesh_2_sizing_field& field = Mesh_2_sizing_field())
+    : m_aspect_bound(aspect_bound), m_field(field) {}
+
+  double bound() const { return m_aspect_bound; }
+  void set_bound(double b) { m_aspect_bound = b; }
+  const Mesh_2_sizing_field& sizing_field() const { return m_field; }
+  void set_sizing_field(const Mesh_2_sizing_field& field) { m_field = field; }
+
+  class Is_bad
+  {
+    double B;
+    Mesh_2_sizing_field field;
+
+  public:
+    Is_bad(double aspect_bound, const Mesh_2_sizing_field& field)
+      : B(aspect_bound), field(field) {}
+
+    CGAL::Mesh_2::Face_badness operator()(const Quality& q) const
+    {
+      if (q.size() > 1) return CGAL::Mesh_2::IMPERATIVELY_BAD;
+      if (q.sine() < B) return CGAL::Mesh_2::BAD;
+      return CGAL::Mesh_2::NOT_BAD;
+    }
+
+    CGAL::Mesh_2::Face_badness operator()(const Face_handle& fh, Quality& q) const
+    {
+      const Point& pa = fh->vertex(0)->point();
+      const Point& pb = fh->vertex(1)->point();
+      const Point& pc = fh->vertex(2)->point();
+      const double a = CGAL::to_double(CGAL::squared_distance(pb, pc));
+      const double b = CGAL::to_double(CGAL::squared_distance(pc, pa));
+      const double c = CGAL::to_double(CGAL::squared_distance(pa, pb));
+      double max_sq_length = a, second_max_sq_length = b;
+      if (max_sq_length < second_max_sq_length) std::swap(max_sq_length, second_max_sq_length);
+      if (c > max_sq_length) { second_max_sq_length = max_sq_length; max_sq_length = c; }
+      else if (c > second_max_sq_length) second_max_sq_length = c;
+
+      const double size = field.value(
+        (CGAL::to_double(pa.x()) + CGAL::to_double(pb.x()) + CGAL::to_double(pc.x())) / 3,
+        (CGAL::to_double(pa.y()) + CGAL::to_double(pb.y()) + CGAL::to_double(pc.y())) / 3);
+      q.second = (size < (std::numeric_limits<double>::max)()) ? max_sq_length / (size * size) : 0;
+      if (q.size() > 1)
+      {
+        q.first = 1; // the sine does not matter
+        return CGAL::Mesh_2::IMPERATIVELY_BAD;
+      }
+
+      const double area = 2 * CGAL::to_double(CGAL::area(pa, pb, pc));
+      q.first = (area * area) / (max_sq_length * second_max_sq_length); // (sine)^2 of the smallest angle
+      if (q.sine() < B) return CGAL::Mesh_2::BAD;
+      return CGAL::Mesh_2::NOT_BAD;
+    }
+  };
+
+  Is_bad is_bad_object() const { return Is_bad(m_aspect_bound, m_field); }
+};
+
+} //namespace SWIG_Mesh_2
+#endif
+
+template <class Cpp>
+class Sizing_field_criteria_wrapper{
+  Cpp data;
+public:
+  #ifndef SWIG
+  typedef Cpp cpp_base;
+  const cpp_base& get_data() const {return data;}
+        cpp_base& get_data()       {return data;}
+  Sizing_field_criteria_wrapper(const cpp_base& base):data(base){}
+  #endif
+  Sizing_field_criteria_wrapper( double b , const Mesh_2_sizing_field& field ):data(b,field){}
+  Sizing_field_criteria_wrapper( double b ):data(b){}
+  Sizing_field_criteria_wrapper(){}
+  double bound() const {return data.bound();}
+  void set_bound(double b) {data.set_bound(b);}
+  Mesh_2_sizing_field sizing_field() const {return data.sizing_field();}
+  void set_sizing_field(const Mesh_2_sizing_field& field) {data.set_sizing_field(field);}
+//Deep copy
+  typedef Sizing_field_criteria_wrapper<Cpp> Self;
+  Self deepcopy() const {return Self(data);}
+  void deepcopy(const Self& other){data=other.get_data();}
+};
+
+#endif //SWIG_CGAL_MESH_2_SIZING_FIELD_2_H
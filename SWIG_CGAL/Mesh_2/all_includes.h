@@ -10,6 +10,10 @@
 #include <SWIG_CGAL/Mesh_2/Delaunay_mesher_2.h>
 #include <SWIG_CGAL/Mesh_2/Criteria.h>
 #include <SWIG_CGAL/Mesh_2/Triangulation_conformer_2.h>
+#include <SWIG_CGAL/Mesh_2/Incremental_conformer_2.h>
 #include <SWIG_CGAL/Mesh_2/parameters.h>
+#include <SWIG_CGAL/Mesh_2/Batch_mesher_2.h>
+#include <SWIG_CGAL/Mesh_2/Quality_histogram.h>
+#include <SWIG_CGAL/Mesh_2/Sizing_field_2.h>
 
 #endif //SWIG_CGAL_MESH_2_ALL_INCLUDES_H
@@ -17,6 +17,17 @@
     void make_conforming_Gabriel_2(CDTWRAPPER& cdt){
       CGAL::make_conforming_Gabriel_2(cdt.get_data());
     }
+    //inserts the rows (x,y) of `points` and a constraint for each row (i,j) of `segments`,
+    //then conforms again only the region they change. `cdt` must be conforming before the call.
+    //Returns the number of new vertices
+    int make_conforming_Delaunay_2(CDTWRAPPER& cdt, SWIG_CGAL::Buffer<double> points, SWIG_CGAL::Buffer<int> segments)
+    {
+      return SWIG_Mesh_2::insert_and_conform_2(cdt.get_data(), points, segments, false);
+    }
+    int make_conforming_Gabriel_2(CDTWRAPPER& cdt, SWIG_CGAL::Buffer<double> points, SWIG_CGAL::Buffer<int> segments)
+    {
+      return SWIG_Mesh_2::insert_and_conform_2(cdt.get_data(), points, segments, true);
+    }
   %}
 %enddef
 
@@ -15,6 +15,7 @@
 #include <CGAL/Delaunay_mesh_size_criteria_2.h>
 #include <CGAL/Triangulation_conformer_2.h>
 #include <CGAL/lloyd_optimize_mesh_2.h>
+#include <SWIG_CGAL/Mesh_2/Sizing_field_2.h>
 
 typedef CGAL::Delaunay_mesh_vertex_base_2<EPIC_Kernel>                          M2_Vb;
 typedef CGAL::Delaunay_mesh_face_base_2<EPIC_Kernel>                            M2_Fb;
@@ -28,6 +29,8 @@ typedef CGAL::Delaunay_mesh_size_criteria_2<M2_CDT>
 typedef CGAL::Delaunay_mesher_2<M2_CDT,DM2_C>                                   DM2_M;
 typedef CGAL::Delaunay_mesh_size_criteria_2<M2_CDT_plus>                        DM2_C_plus;
 typedef CGAL::Delaunay_mesher_2<M2_CDT_plus,DM2_C_plus>                         DM2_M_plus;
+typedef SWIG_Mesh_2::Delaunay_mesh_sizing_field_criteria_2<M2_CDT>              DM2_SFC;
+typedef SWIG_Mesh_2::Delaunay_mesh_sizing_field_criteria_2<M2_CDT_plus>         DM2_SFC_plus;
 
 
 #endif //SWIG_CGAL_MESH_2_TYPEDEFS_H
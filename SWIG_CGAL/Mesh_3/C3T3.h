@@ -9,8 +9,13 @@
 
 #include <fstream>
 #include <iostream>
+#include <stdexcept>
+#include <string>
 #include <SWIG_CGAL/Common/Iterator.h>
+#include <SWIG_CGAL/Common/Memory_usage.h>
 #include <SWIG_CGAL/Kernel/Point_3.h>
+#include <SWIG_CGAL/Mesh_3/C3T3_arrays.h>
+#include <SWIG_CGAL/Mesh_3/C3T3_binary_io.h>
 #include <boost/shared_ptr.hpp>
 
 template <class C3T3,class Triangulation,class Index,class Surface_index,class Subdomain_index>
@@ -75,12 +80,50 @@ public:
 //Traversal of the complex
   Cell_iterator  cells() {return Cell_iterator(get_data().cells_begin(),get_data().cells_end());}
   Facet_iterator facets(){return Facet_iterator(get_data().facets_begin(),get_data().facets_end());}
+//Export of the cells and facets of the complex as arrays of points and of indices
+  C3T3_arrays to_arrays() const {return C3T3_arrays(get_data());}
 //Operations
   void output_to_medit (const char* filename){
     std::ofstream outfile(filename);
     if (!outfile) std::cerr << "Error cannot create file: " << filename << std::endl;
     else  get_data().output_to_medit(outfile);
   }
+  //binary MEDIT and VTU files of the cells and facets of the complex, see C3T3_writers.h
+  void write_meshb(const char* filename) const {C3T3_arrays(get_data()).write_meshb(filename);}
+  void write_vtu(const char* filename) const {C3T3_arrays(get_data()).write_vtu(filename);}
+  //the triangulation and the indices of the complex, see C3T3_binary_io.h
+  void write_binary(const char* filename) const {
+    std::ofstream out(filename, std::ios::binary);
+    if (!out) throw std::runtime_error(std::string("Cannot create file ") + filename);
+    SWIG_Mesh_3::write_binary(out,get_data());
+  }
+  void read_binary(const char* filename){
+    std::ifstream in(filename, std::ios::binary);
+    if (!in) throw std::runtime_error(std::string("Cannot open file ") + filename);
+    boost::shared_ptr<cpp_base> c3t3(new cpp_base());
+    SWIG_Mesh_3::read_binary(in,*c3t3);
+    data_sptr=c3t3;
+  }
+//Memory
+  //the items of the triangulation as structure, the edges and corners of
+  //the 1D features (nodes of maps of CGAL) as properties
+  SWIG_CGAL::Memory_usage memory_usage() const
+  {
+    const cpp_base& c3t3=get_data();
+    const std::size_t node=4*sizeof(void*);
+    return SWIG_CGAL::Memory_usage(
+      SWIG_CGAL::internal::compact_container_bytes(c3t3.triangulation().tds().vertices())
+        + SWIG_CGAL::internal::compact_container_bytes(c3t3.triangulation().tds().cells()),
+      std::size_t(c3t3.number_of_edges_in_complex())*(node+2*sizeof(Vertex_handle)+sizeof(typename C3T3::Curve_index))
+        + std::size_t(c3t3.number_of_vertices_in_complex())*(node+sizeof(Vertex_handle)+sizeof(typename C3T3::Corner_index)));
+  }
+  //replaces the complex by a copy, whose triangulation has no free slots:
+  //the handles to its vertices and cells become invalid, the triangulations
+  //returned by triangulation() remain valid
+  void shrink_to_fit(){
+    cpp_base copy(get_data());
+    get_data().swap(copy);
+  }
 //Deep copy
   Self deepcopy() const {return Self(get_data());}
   void deepcopy(const Self& other){data_sptr=boost::shared_ptr<cpp_base>( new cpp_base(other.get_data()) );}
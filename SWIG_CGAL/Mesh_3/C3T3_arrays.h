@@ -0,0 +1,148 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+
+#ifndef SWIG_CGAL_MESH_3_C3T3_ARRAYS_H
+#define SWIG_CGAL_MESH_3_C3T3_ARRAYS_H
+
+#include <SWIG_CGAL/Common/Buffer.h>
+#include <SWIG_CGAL/Mesh_3/C3T3_writers.h>
+
+#include <CGAL/Unique_hash_map.h>
+
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// Result of C3T3_wrapper::to_arrays(): the vertices of the cells and facets
+// of the complex are numbered in the order they are met, row i of point_array()
+// being the point of vertex i. Row j of cell_array() (resp. facet_array()) gives
+// the vertices of the j-th cell (resp. facet) of the complex, and row j of
+// subdomain_index_array() (resp. surface_patch_index_array()) its index.
+// Facets are oriented outward from the cell used to store them in the complex.
+// write_meshb() and write_vtu() write these arrays, see C3T3_writers.h.
+class C3T3_arrays
+{
+  std::shared_ptr<std::vector<double> > points_sptr;
+  std::shared_ptr<std::vector<int> >    cells_sptr;
+  std::shared_ptr<std::vector<int> >    subdomain_indices_sptr;
+  std::shared_ptr<std::vector<int> >    facets_sptr;
+  std::shared_ptr<std::vector<int> >    surface_patch_indices_sptr;
+
+  #ifndef SWIG
+  template <class Vertex_handle>
+  int index(Vertex_handle v, CGAL::Unique_hash_map<Vertex_handle, int>& vertex_index)
+  {
+    int& i = vertex_index[v];
+    if (i == -1)
+    {
+      i = int(points_sptr->size() / 3);
+      points_sptr->push_back(v->point().x());
+      points_sptr->push_back(v->point().y());
+      points_sptr->push_back(v->point().z());
+    }
+    return i;
+  }
+  #endif
+
+public:
+  C3T3_arrays()
+    : points_sptr(new std::vector<double>())
+    , cells_sptr(new std::vector<int>())
+    , subdomain_indices_sptr(new std::vector<int>())
+    , facets_sptr(new std::vector<int>())
+    , surface_patch_indices_sptr(new std::vector<int>()) {}
+
+  #ifndef SWIG
+  template <class C3T3>
+  C3T3_arrays(const C3T3& c3t3)
+    : C3T3_arrays()
+  {
+    typedef typename C3T3::Triangulation                 Triangulation;
+    typedef typename Triangulation::Vertex_handle        Vertex_handle;
+
+    const Triangulation& t = c3t3.triangulation();
+    CGAL::Unique_hash_map<Vertex_handle, int> vertex_index(-1, t.number_of_vertices());
+
+    cells_sptr->reserve(4 * c3t3.number_of_cells_in_complex());
+    subdomain_indices_sptr->reserve(c3t3.number_of_cells_in_complex());
+    for (typename C3T3::Cells_in_complex_iterator c = c3t3.cells_in_complex_begin();
+         c != c3t3.cells_in_complex_end(); ++c)
+    {
+      for (int i = 0; i < 4; ++i)
+        cells_sptr->push_back(index(c->vertex(i), vertex_index));
+      subdomain_indices_sptr->push_back(int(c3t3.subdomain_index(c)));
+    }
+
+    facets_sptr->reserve(3 * c3t3.number_of_facets_in_complex());
+    surface_patch_indices_sptr->reserve(2 * c3t3.number_of_facets_in_complex());
+    for (typename C3T3::Facets_in_complex_iterator f = c3t3.facets_in_complex_begin();
+         f != c3t3.facets_in_complex_end(); ++f)
+    {
+      for (int j = 0; j < 3; ++j)
+        facets_sptr->push_back(index(f->first->vertex(Triangulation::vertex_triple_index(f->second, j)),
+                                     vertex_index));
+      const typename C3T3::Surface_patch_index patch = c3t3.surface_patch_index(*f);
+      surface_patch_indices_sptr->push_back(int(patch.first));
+      surface_patch_indices_sptr->push_back(int(patch.second));
+    }
+  }
+  #endif
+
+  int number_of_points() const { return int(points_sptr->size() / 3); }
+  int number_of_cells() const { return int(cells_sptr->size() / 4); }
+  int number_of_facets() const { return int(facets_sptr->size() / 3); }
+
+  // (number_of_points(), 3)
+  SWIG_CGAL::Buffer<double> point_array() const
+  {
+    return SWIG_CGAL::Buffer<double>(points_sptr->data(), points_sptr->size() / 3, 3,
+                                     points_sptr, true);
+  }
+  // (number_of_cells(), 4)
+  SWIG_CGAL::Buffer<int> cell_array() const
+  {
+    return SWIG_CGAL::Buffer<int>(cells_sptr->data(), cells_sptr->size() / 4, 4,
+                                  cells_sptr, true);
+  }
+  // (number_of_cells(), 1)
+  SWIG_CGAL::Buffer<int> subdomain_index_array() const
+  {
+    return SWIG_CGAL::Buffer<int>(subdomain_indices_sptr->data(), subdomain_indices_sptr->size(), 1,
+                                  subdomain_indices_sptr, true);
+  }
+  // (number_of_facets(), 3)
+  SWIG_CGAL::Buffer<int> facet_array() const
+  {
+    return SWIG_CGAL::Buffer<int>(facets_sptr->data(), facets_sptr->size() / 3, 3,
+                                  facets_sptr, true);
+  }
+  // (number_of_facets(), 2): the indices of the subdomains on both sides
+  SWIG_CGAL::Buffer<int> surface_patch_index_array() const
+  {
+    return SWIG_CGAL::Buffer<int>(surface_patch_indices_sptr->data(), surface_patch_indices_sptr->size() / 2, 2,
+                                  surface_patch_indices_sptr, true);
+  }
+
+  // binary MEDIT file of the cells and facets
+  void write_meshb(const char* filename) const
+  {
+    std::ofstream out(filename, std::ios::binary);
+    if (!out) throw std::runtime_error(std::string("Cannot create file ") + filename);
+    SWIG_Mesh_3::write_meshb(out, *points_sptr, *cells_sptr, *subdomain_indices_sptr,
+                             *facets_sptr, *surface_patch_indices_sptr);
+  }
+  // VTK unstructured grid of the cells
+  void write_vtu(const char* filename) const
+  {
+    std::ofstream out(filename, std::ios::binary);
+    if (!out) throw std::runtime_error(std::string("Cannot create file ") + filename);
+    SWIG_Mesh_3::write_vtu(out, *points_sptr, *cells_sptr, *subdomain_indices_sptr);
+  }
+};
+
+#endif //SWIG_CGAL_MESH_3_C3T3_ARRAYS_H
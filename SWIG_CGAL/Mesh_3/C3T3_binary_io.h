@@ -0,0 +1,173 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+
+#ifndef SWIG_CGAL_MESH_3_C3T3_BINARY_IO_H
+#define SWIG_CGAL_MESH_3_C3T3_BINARY_IO_H
+
+#include <SWIG_CGAL/Triangulation_3/Binary_io.h>
+
+#include <CGAL/Unique_hash_map.h>
+#include <boost/variant.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+// Binary format of a complex:
+//   char[8]  magic "CGALC3T3"
+//   uint32   version
+//   the triangulation, in the format of SWIG_Triangulation_3::write_binary()
+//   then vectors of int32, each stored as an uint64 size followed by its values:
+//   (cell, subdomain index) of each cell of the complex
+//   (cell, i, surface patch index pair) of each facet of the complex
+//   (dimension, 0, subdomain index, 0) or (dimension, 1, surface patch index pair)
+//     for the index of each finite vertex
+// Cells and vertices are numbered as in the triangulation. The features
+// (edges and corners) of the complex are not stored.
+namespace SWIG_Mesh_3 {
+
+namespace internal{
+
+struct Append_index : public boost::static_visitor<void>
+{
+  std::vector<std::int32_t>& row;
+  Append_index(std::vector<std::int32_t>& row) : row(row) {}
+  void operator()(int i) const
+  {
+    row.push_back(0);
+    row.push_back(i);
+    row.push_back(0);
+  }
+  void operator()(const std::pair<int,int>& p) const
+  {
+    row.push_back(1);
+    row.push_back(p.first);
+    row.push_back(p.second);
+  }
+};
+
+} //namespace internal
+
+inline const char* c3t3_binary_magic() { return "CGALC3T3"; }
+inline std::uint32_t c3t3_binary_version() { return 1; }
+
+template <class C3T3>
+void write_binary(std::ostream& os, const C3T3& c3t3)
+{
+  typedef typename C3T3::Triangulation          Triangulation;
+  typedef typename Triangulation::Vertex_handle Vertex_handle;
+  typedef typename Triangulation::Cell_handle   Cell_handle;
+
+  std::uint32_t version = c3t3_binary_version();
+  os.write (c3t3_binary_magic(), 8);
+  os.write (reinterpret_cast<const char*>(&version), sizeof(version));
+
+  std::vector<Cell_handle> cells;
+  std::vector<Vertex_handle> vertices;
+  SWIG_Triangulation_3::write_binary(os, c3t3.triangulation(), &cells, &vertices);
+  if (cells.size() > std::size_t((std::numeric_limits<std::int32_t>::max)()))
+    throw std::runtime_error("The complex is too large for the binary format");
+
+  CGAL::Unique_hash_map<Cell_handle, std::int32_t> cell_index(-1, cells.size());
+  for (std::size_t j = 0; j < cells.size(); ++j)
+    cell_index[cells[j]] = std::int32_t(j);
+
+  std::vector<std::int32_t> complex_cells, complex_facets, vertex_indices;
+  complex_cells.reserve(2 * c3t3.number_of_cells_in_complex());
+  for (typename C3T3::Cells_in_complex_iterator c = c3t3.cells_in_complex_begin();
+       c != c3t3.cells_in_complex_end(); ++c)
+  {
+    complex_cells.push_back(cell_index[c]);
+    complex_cells.push_back(std::int32_t(c3t3.subdomain_index(c)));
+  }
+  complex_facets.reserve(4 * c3t3.number_of_facets_in_complex());
+  for (typename C3T3::Facets_in_complex_iterator f = c3t3.facets_in_complex_begin();
+       f != c3t3.facets_in_complex_end(); ++f)
+  {
+    const typename C3T3::Surface_patch_index patch = c3t3.surface_patch_index(*f);
+    complex_facets.push_back(cell_index[f->first]);
+    complex_facets.push_back(f->second);
+    complex_facets.push_back(std::int32_t(patch.first));
+    complex_facets.push_back(std::int32_t(patch.second));
+  }
+  vertex_indices.reserve(4 * vertices.size());
+  for (Vertex_handle v : vertices)
+  {
+    vertex_indices.push_back(c3t3.in_dimension(v));
+    boost::apply_visitor(internal::Append_index(vertex_indices), c3t3.index(v));
+  }
+
+  SWIG_Triangulation_3::internal::write_vector (os, complex_cells);
+  SWIG_Triangulation_3::internal::write_vector (os, complex_facets);
+  SWIG_Triangulation_3::internal::write_vector (os, vertex_indices);
+  if (!os)
+    throw std::runtime_error("Cannot write the complex");
+}
+
+// c3t3 must be empty
+template <class C3T3>
+void read_binary(std::istream& is, C3T3& c3t3)
+{
+  typedef typename C3T3::Triangulation          Triangulation;
+  typedef typename Triangulation::Vertex_handle Vertex_handle;
+  typedef typename Triangulation::Cell_handle   Cell_handle;
+  typedef typename C3T3::Index                  Index;
+  typedef typename C3T3::Subdomain_index        Subdomain_index;
+  typedef typename C3T3::Surface_patch_index    Surface_patch_index;
+
+  char header[8];
+  std::uint32_t version = 0;
+  is.read (header, 8);
+  is.read (reinterpret_cast<char*>(&version), sizeof(version));
+  if (!is || std::memcmp (header, c3t3_binary_magic(), 8) != 0)
+    throw std::runtime_error("Not a complex file");
+  if (version != c3t3_binary_version())
+    throw std::runtime_error("Unsupported complex file version");
+
+  std::vector<Cell_handle> cells;
+  std::vector<Vertex_handle> vertices;
+  SWIG_Triangulation_3::read_binary(is, c3t3.triangulation(), &cells, &vertices);
+
+  std::vector<std::int32_t> complex_cells, complex_facets, vertex_indices;
+  SWIG_Triangulation_3::internal::read_vector (is, complex_cells);
+  SWIG_Triangulation_3::internal::read_vector (is, complex_facets);
+  SWIG_Triangulation_3::internal::read_vector (is, vertex_indices);
+  if (complex_cells.size() % 2 != 0 || complex_facets.size() % 4 != 0
+      || vertex_indices.size() != 4 * vertices.size())
+    throw std::runtime_error("Invalid complex file");
+
+  for (std::size_t k = 0; k < complex_cells.size(); k += 2)
+  {
+    if (complex_cells[k] < 0 || std::size_t(complex_cells[k]) >= cells.size())
+      throw std::runtime_error("Invalid complex file");
+    c3t3.add_to_complex(cells[complex_cells[k]], Subdomain_index(complex_cells[k+1]));
+  }
+  for (std::size_t k = 0; k < complex_facets.size(); k += 4)
+  {
+    if (complex_facets[k] < 0 || std::size_t(complex_facets[k]) >= cells.size()
+        || complex_facets[k+1] < 0 || complex_facets[k+1] > 3)
+      throw std::runtime_error("Invalid complex file");
+    c3t3.add_to_complex(cells[complex_facets[k]], complex_facets[k+1],
+                        Surface_patch_index(complex_facets[k+2], complex_facets[k+3]));
+  }
+  for (std::size_t i = 0; i < vertices.size(); ++i)
+  {
+    const std::int32_t* row = vertex_indices.data() + 4 * i;
+    c3t3.set_dimension(vertices[i], row[0]);
+    if (row[1] == 0)
+      c3t3.set_index(vertices[i], Index(int(row[2])));
+    else
+      c3t3.set_index(vertices[i], Index(std::make_pair(int(row[2]), int(row[3]))));
+  }
+}
+
+} //namespace SWIG_Mesh_3
+
+#endif //SWIG_CGAL_MESH_3_C3T3_BINARY_IO_H
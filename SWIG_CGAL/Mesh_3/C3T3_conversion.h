@@ -0,0 +1,114 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+
+#ifndef SWIG_CGAL_MESH_3_C3T3_CONVERSION_H
+#define SWIG_CGAL_MESH_3_C3T3_CONVERSION_H
+
+#include <SWIG_CGAL/Triangulation_3/Binary_io.h>
+
+#include <CGAL/Unique_hash_map.h>
+
+#include <algorithm>
+#include <sstream>
+#include <utility>
+#include <vector>
+
+namespace SWIG_Mesh_3 {
+
+// Copies the complex `source`, generated for `domain`, into the empty complex
+// `target` whose surface patch index is a pair of subdomain indices. The
+// triangulation is copied through its binary format, so that both
+// triangulations have their cells and vertices in the same order.
+// The surface patch index of a facet becomes the ordered pair of the subdomain
+// indices of its two cells (0 outside of the complex), and a vertex on a
+// surface gets the surface patch index of one of its facets in the complex.
+template <class Source, class Domain, class Target>
+void copy_to_subdomain_pair_complex(const Source& source, const Domain& domain, Target& target)
+{
+  typedef typename Source::Triangulation::Vertex_handle Source_vertex_handle;
+  typedef typename Source::Triangulation::Cell_handle   Source_cell_handle;
+  typedef typename Target::Triangulation::Vertex_handle Vertex_handle;
+  typedef typename Target::Triangulation::Cell_handle   Cell_handle;
+  typedef typename Target::Index                        Index;
+  typedef typename Target::Subdomain_index              Subdomain_index;
+  typedef typename Target::Surface_patch_index          Surface_patch_index;
+
+  std::vector<Source_cell_handle> source_cells;
+  std::vector<Source_vertex_handle> source_vertices;
+  std::vector<Cell_handle> cells;
+  std::vector<Vertex_handle> vertices;
+  {
+    std::stringstream buffer(std::ios::in | std::ios::out | std::ios::binary);
+    SWIG_Triangulation_3::write_binary(buffer, source.triangulation(), &source_cells, &source_vertices);
+    SWIG_Triangulation_3::read_binary(buffer, target.triangulation(), &cells, &vertices);
+  }
+
+  CGAL::Unique_hash_map<Source_cell_handle, std::size_t> cell_index(0, source_cells.size());
+  for (std::size_t j = 0; j < source_cells.size(); ++j)
+    cell_index[source_cells[j]] = j;
+  CGAL::Unique_hash_map<Source_vertex_handle, std::size_t> vertex_index(0, source_vertices.size());
+  for (std::size_t i = 0; i < source_vertices.size(); ++i)
+    vertex_index[source_vertices[i]] = i;
+
+  for (typename Source::Cells_in_complex_iterator c = source.cells_in_complex_begin();
+       c != source.cells_in_complex_end(); ++c)
+    target.add_to_complex(cells[cell_index[c]], Subdomain_index(source.subdomain_index(c)));
+
+  std::vector<bool> index_set(vertices.size(), false);
+  for (typename Source::Facets_in_complex_iterator f = source.facets_in_complex_begin();
+       f != source.facets_in_complex_end(); ++f)
+  {
+    const Source_cell_handle c = f->first, n = c->neighbor(f->second);
+    int a = source.is_in_complex(c) ? int(source.subdomain_index(c)) : 0;
+    int b = source.is_in_complex(n) ? int(source.subdomain_index(n)) : 0;
+    if (b < a) std::swap(a, b);
+    const Surface_patch_index patch(a, b);
+    target.add_to_complex(cells[cell_index[c]], f->second, patch);
+    for (int k = 1; k < 4; ++k)
+    {
+      const Source_vertex_handle v = c->vertex((f->second + k) % 4);
+      if (source.triangulation().is_infinite(v)) continue;
+      const std::size_t i = vertex_index[v];
+      if (!index_set[i] && source.in_dimension(v) == 2)
+      {
+        target.set_dimension(vertices[i], 2);
+        target.set_index(vertices[i], Index(patch));
+        index_set[i] = true;
+      }
+    }
+  }
+
+  for (typename Source::Edges_in_complex_iterator e = source.edges_in_complex_begin();
+       e != source.edges_in_complex_end(); ++e)
+  {
+    const Source_vertex_handle v1 = e->first->vertex(e->second);
+    const Source_vertex_handle v2 = e->first->vertex(e->third);
+    target.add_to_complex(vertices[vertex_index[v1]], vertices[vertex_index[v2]],
+                          source.curve_index(*e));
+  }
+  for (typename Source::Vertices_in_complex_iterator v = source.vertices_in_complex_begin();
+       v != source.vertices_in_complex_end(); ++v)
+    target.add_to_complex(vertices[vertex_index[v]], source.corner_index(v));
+
+  for (std::size_t i = 0; i < source_vertices.size(); ++i)
+  {
+    if (index_set[i]) continue;
+    const Source_vertex_handle v = source_vertices[i];
+    const int dimension = source.in_dimension(v);
+    target.set_dimension(vertices[i], dimension);
+    switch (dimension)
+    {
+      case 3: target.set_index(vertices[i], Index(int(domain.subdomain_index(source.index(v))))); break;
+      case 1: target.set_index(vertices[i], Index(int(domain.curve_index(source.index(v))))); break;
+      case 0: target.set_index(vertices[i], Index(int(domain.corner_index(source.index(v))))); break;
+      default: break;
+    }
+  }
+}
+
+} //namespace SWIG_Mesh_3
+
+#endif //SWIG_CGAL_MESH_3_C3T3_CONVERSION_H
@@ -0,0 +1,157 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+
+#ifndef SWIG_CGAL_MESH_3_C3T3_WRITERS_H
+#define SWIG_CGAL_MESH_3_C3T3_WRITERS_H
+
+#include <cstdint>
+#include <iostream>
+#include <map>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+// Binary writers of the arrays of C3T3_arrays:
+// - write_meshb() writes the binary MEDIT format (.meshb, GMF version 3) with
+//   the vertices, the triangles (facets) and the tetrahedra (cells), 1-based.
+//   The reference of a tetrahedron is its subdomain index, the reference of a
+//   triangle the rank (from 1) of its pair of subdomain indices in the order
+//   of first appearance, and vertices have the reference 0.
+// - write_vtu() writes the cells as a VTK unstructured grid with raw appended
+//   data, and the subdomain index as the cell data "subdomain_index".
+namespace SWIG_Mesh_3 {
+
+namespace internal{
+
+template <typename T>
+void write_raw (std::ostream& os, const T& t)
+{
+  os.write (reinterpret_cast<const char*>(&t), sizeof(T));
+}
+
+inline bool is_little_endian()
+{
+  const std::uint16_t one = 1;
+  return *reinterpret_cast<const unsigned char*>(&one) == 1;
+}
+
+// Writes the GMF keyword header: keyword, position of the next keyword and,
+// for keywords with data, the number of lines
+inline void write_gmf_keyword (std::ostream& os, std::int32_t keyword, std::int64_t line_size, std::int32_t number_of_lines)
+{
+  const std::int64_t begin = std::int64_t(os.tellp());
+  const std::int64_t next = begin + 4 + 8 + 4 + line_size * number_of_lines;
+  write_raw (os, keyword);
+  write_raw (os, next);
+  write_raw (os, number_of_lines);
+}
+
+} //namespace internal
+
+inline void write_meshb(std::ostream& os,
+                        const std::vector<double>& points,
+                        const std::vector<int>& cells, const std::vector<int>& subdomain_indices,
+                        const std::vector<int>& facets, const std::vector<int>& surface_patch_indices)
+{
+  const std::int32_t code = 1, version = 3, dimension = 3;
+  const std::int32_t gmf_dimension = 3, gmf_vertices = 4, gmf_triangles = 6, gmf_tetrahedra = 8, gmf_end = 54;
+
+  internal::write_raw (os, code);
+  internal::write_raw (os, version);
+  internal::write_raw (os, gmf_dimension);
+  internal::write_raw (os, std::int64_t(os.tellp()) + 8 + 4);
+  internal::write_raw (os, dimension);
+
+  const std::int32_t nv = std::int32_t(points.size() / 3);
+  internal::write_gmf_keyword (os, gmf_vertices, 3 * 8 + 4, nv);
+  for (std::int32_t i = 0; i < nv; ++i)
+  {
+    os.write (reinterpret_cast<const char*>(points.data() + 3 * i), 3 * sizeof(double));
+    internal::write_raw (os, std::int32_t(0));
+  }
+
+  std::map<std::pair<int,int>, std::int32_t> patch_ranks;
+  const std::int32_t nf = std::int32_t(facets.size() / 3);
+  internal::write_gmf_keyword (os, gmf_triangles, 4 * 4, nf);
+  for (std::int32_t j = 0; j < nf; ++j)
+  {
+    for (int k = 0; k < 3; ++k)
+      internal::write_raw (os, std::int32_t(facets[3 * j + k] + 1));
+    const std::pair<int,int> patch(surface_patch_indices[2 * j], surface_patch_indices[2 * j + 1]);
+    std::int32_t& rank = patch_ranks[patch];
+    if (rank == 0) rank = std::int32_t(patch_ranks.size());
+    internal::write_raw (os, rank);
+  }
+
+  const std::int32_t nc = std::int32_t(cells.size() / 4);
+  internal::write_gmf_keyword (os, gmf_tetrahedra, 5 * 4, nc);
+  for (std::int32_t j = 0; j < nc; ++j)
+  {
+    for (int k = 0; k < 4; ++k)
+      internal::write_raw (os, std::int32_t(cells[4 * j + k] + 1));
+    internal::write_raw (os, std::int32_t(subdomain_indices[j]));
+  }
+
+  internal::write_raw (os, gmf_end);
+  internal::write_raw (os, std::int64_t(0));
+  if (!os)
+    throw std::runtime_error("Cannot write the mesh");
+}
+
+inline void write_vtu(std::ostream& os,
+                      const std::vector<double>& points,
+                      const std::vector<int>& cells, const std::vector<int>& subdomain_indices)
+{
+  static_assert(sizeof(int) == 4, "The cells are written as Int32");
+  const std::uint64_t nv = points.size() / 3, nc = cells.size() / 4;
+  const std::uint64_t points_size = 8 * 3 * nv, connectivity_size = 4 * 4 * nc,
+                      offsets_size = 4 * nc, types_size = nc, subdomains_size = 4 * nc;
+  std::uint64_t offset = 0;
+
+  os << "<?xml version=\"1.0\"?>\n"
+     << "<VTKFile type=\"UnstructuredGrid\" version=\"1.0\" byte_order=\""
+     << (internal::is_little_endian() ? "LittleEndian" : "BigEndian") << "\" header_type=\"UInt64\">\n"
+     << "  <UnstructuredGrid>\n"
+     << "    <Piece NumberOfPoints=\"" << nv << "\" NumberOfCells=\"" << nc << "\">\n"
+     << "      <Points>\n"
+     << "        <DataArray type=\"Float64\" NumberOfComponents=\"3\" format=\"appended\" offset=\"" << offset << "\"/>\n"
+     << "      </Points>\n";
+  offset += 8 + points_size;
+  os << "      <Cells>\n"
+     << "        <DataArray type=\"Int32\" Name=\"connectivity\" format=\"appended\" offset=\"" << offset << "\"/>\n";
+  offset += 8 + connectivity_size;
+  os << "        <DataArray type=\"Int32\" Name=\"offsets\" format=\"appended\" offset=\"" << offset << "\"/>\n";
+  offset += 8 + offsets_size;
+  os << "        <DataArray type=\"UInt8\" Name=\"types\" format=\"appended\" offset=\"" << offset << "\"/>\n"
+     << "      </Cells>\n";
+  offset += 8 + types_size;
+  os << "      <CellData Scalars=\"subdomain_index\">\n"
+     << "        <DataArray type=\"Int32\" Name=\"subdomain_index\" format=\"appended\" offset=\"" << offset << "\"/>\n"
+     << "      </CellData>\n"
+     << "    </Piece>\n"
+     << "  </UnstructuredGrid>\n"
+     << "  <AppendedData encoding=\"raw\">\n_";
+
+  internal::write_raw (os, points_size);
+  os.write (reinterpret_cast<const char*>(points.data()), std::streamsize(points_size));
+  internal::write_raw (os, connectivity_size);
+  os.write (reinterpret_cast<const char*>(cells.data()), std::streamsize(connectivity_size));
+  internal::write_raw (os, offsets_size);
+  for (std::uint64_t j = 1; j <= nc; ++j)
+    internal::write_raw (os, std::int32_t(4 * j));
+  internal::write_raw (os, types_size);
+  const std::vector<std::uint8_t> types(nc, 10); // VTK_TETRA
+  os.write (reinterpret_cast<const char*>(types.data()), std::streamsize(types_size));
+  internal::write_raw (os, subdomains_size);
+  os.write (reinterpret_cast<const char*>(subdomain_indices.data()), std::streamsize(subdomains_size));
+  os << "\n  </AppendedData>\n</VTKFile>\n";
+  if (!os)
+    throw std::runtime_error("Cannot write the mesh");
+}
+
+} //namespace SWIG_Mesh_3
+
+#endif //SWIG_CGAL_MESH_3_C3T3_WRITERS_H
@@ -17,6 +17,14 @@ SWIG_CGAL_package_common()
 %import  "SWIG_CGAL/Common/Macros.h"
 %import  "SWIG_CGAL/Kernel/CGAL_Kernel.i"
 
+//typemaps for the insertion of points from arrays and the export to arrays
+%include "SWIG_CGAL/typemaps.i"
+SWIG_CGAL_buffer_of_double_typemap_in
+SWIG_CGAL_buffer_of_int_typemap_in
+SWIG_CGAL_buffer_of_double_typemap_out
+SWIG_CGAL_buffer_of_int_typemap_out
+SWIG_CGAL_buffer_of_signed_char_typemap_out
+
 %include "CGAL/version.h"
 
 //include files
@@ -41,11 +49,28 @@ SWIG_CGAL_package_common()
 %include "SWIG_CGAL/Common/triple.h"
 %include "SWIG_CGAL/Common/Variant.h"
 %include "SWIG_CGAL/Triangulation_3/triangulation_handles.h"
+SWIG_CGAL_release_gil(Triangulation_3_wrapper::to_arrays)
+SWIG_CGAL_release_gil(Triangulation_3_wrapper::write_binary)
+SWIG_CGAL_release_gil(Triangulation_3_wrapper::read_binary)
+%include "SWIG_CGAL/Triangulation_3/Triangulation_3_arrays.h"
+%include "SWIG_CGAL/Common/Location_batch.h"
+SWIG_CGAL_release_gil(C3T3_wrapper::to_arrays)
+SWIG_CGAL_release_gil(C3T3_wrapper::write_binary)
+SWIG_CGAL_release_gil(C3T3_wrapper::read_binary)
+SWIG_CGAL_release_gil(C3T3_wrapper::write_meshb)
+SWIG_CGAL_release_gil(C3T3_wrapper::write_vtu)
+SWIG_CGAL_release_gil(C3T3_arrays::write_meshb)
+SWIG_CGAL_release_gil(C3T3_arrays::write_vtu)
+%include "SWIG_CGAL/Mesh_3/C3T3_arrays.h"
 %include "SWIG_CGAL/Triangulation_3/Triangulation_3.h"
 %include "SWIG_CGAL/Triangulation_3/Regular_triangulation_3.h"
 %include "SWIG_CGAL/Mesh_3/C3T3.h"
 %include "SWIG_CGAL/Mesh_3/Mesh_domains.h"
 %include "SWIG_CGAL/Mesh_3/Mesh_criteria.h"
+%typemap(javaimports)      Mesh_3_sizing_field%{import CGAL.Kernel.Point_3;%}
+%include "SWIG_CGAL/Mesh_3/Sizing_field_3.h"
+%include "SWIG_CGAL/Mesh_3/Refinement_monitor.h"
+%include "SWIG_CGAL/Mesh_3/Optimization_statistics.h"
 %include "SWIG_CGAL/Mesh_3/parameters.h"
 
 %import "SWIG_CGAL/Triangulation_3/declare_regular_triangulation_3.i"
@@ -123,6 +148,7 @@ SWIG_CGAL_declare_identifier_of_template_class(Mesh_3_Surface_index,std::pair<in
 SWIG_CGAL_declare_identifier_of_template_class(Mesh_3_Index,Variant<int,std::pair<int,int> >)
 
 
+%typemap(javaimports)      C3T3_wrapper%{import CGAL.Kernel.Memory_usage;%}
 SWIG_CGAL_declare_identifier_of_template_class(Mesh_3_Complex_3_in_triangulation_3,C3T3_wrapper<  C3T3_PMD,
                                                                                                   Regular_triangulation_3_wrapper<MT_PMD,SWIG_Triangulation_3::CGAL_Vertex_handle<MT_PMD,Weighted_point_3>,SWIG_Triangulation_3::CGAL_Cell_handle<MT_PMD,Weighted_point_3>,boost::shared_ptr<C3T3_PMD> >,
                                                                                                   Variant< int, std::pair<int,int> >,
@@ -135,16 +161,67 @@ SWIG_CGAL_import_Polyhedron_3_SWIG_wrapper
 SWIG_CGAL_declare_identifier_of_template_class(Polyhedral_mesh_domain_3,Polyhedral_mesh_domain_3_wrapper<PMD,Polyhedron_3_SWIG_wrapper,Variant< int, std::pair<int,int> >,std::pair<int,int>,int >)
 
 
+//Labeled mesh domain (from a labeled image or a sampled implicit function)
+%typemap(javaimports)      Labeled_mesh_domain_3_wrapper%{import CGAL.Kernel.Point_3;%}
+SWIG_CGAL_declare_identifier_of_template_class(Labeled_mesh_domain_3,Labeled_mesh_domain_3_wrapper<LMD,Variant< int, std::pair<int,int> >,std::pair<int,int>,int >)
+
+//Multi-material polyhedral domain with features
+%typemap(javaimports)      Polyhedral_complex_mesh_domain_3_wrapper%{import CGAL.Polyhedron_3.Polyhedron_3;%}
+SWIG_CGAL_declare_identifier_of_template_class(Polyhedral_complex_mesh_domain_3,Polyhedral_complex_mesh_domain_3_wrapper<PCMD,Mesh_polyhedron_3_,Polyhedron_3_SWIG_wrapper>)
+
 //Default criteria
 SWIG_CGAL_declare_identifier_of_template_class(Default_mesh_criteria,Mesh_criteria_with_fields_wrapper<DMC,double,double,double,double>)
+//Criteria with facet and cell sizes given by sampled sizing fields
+SWIG_CGAL_declare_identifier_of_template_class(Sizing_field_mesh_criteria,Mesh_criteria_with_fields_wrapper<DMC,double,Mesh_3_sizing_field,double,Mesh_3_sizing_field>)
 
 
 %import "SWIG_CGAL/Mesh_3/declare_global_functions.i"
 
+//the polyhedral, labeled and complex domains and default criteria do not call back into the target
+//language: meshing and optimization run without the GIL
+SWIG_CGAL_release_gil(exude_mesh_3)
+SWIG_CGAL_release_gil(perturb_mesh_3)
+SWIG_CGAL_release_gil(lloyd_optimize_mesh_3)
+SWIG_CGAL_release_gil(odt_optimize_mesh_3)
+SWIG_CGAL_release_gil(make_mesh_3)
+SWIG_CGAL_release_gil(refine_mesh_3)
+SWIG_CGAL_release_gil(optimize_mesh_3)
+SWIG_CGAL_release_gil(tetrahedral_isotropic_remeshing)
+
 declare_global_functions(Mesh_3_Complex_3_in_triangulation_3_SWIG_wrapper)
+declare_global_functions_remeshing(Mesh_3_Complex_3_in_triangulation_3_SWIG_wrapper,Mesh_3_parameters)
 //Functions polyhedral mesh domain
 declare_global_functions_domain(Mesh_3_Complex_3_in_triangulation_3_SWIG_wrapper,Polyhedral_mesh_domain_3_SWIG_wrapper)
+declare_global_functions_domain_parameters(Mesh_3_Complex_3_in_triangulation_3_SWIG_wrapper,Polyhedral_mesh_domain_3_SWIG_wrapper,Mesh_3_parameters)
 declare_global_functions_domain_criteria(Mesh_3_Complex_3_in_triangulation_3_SWIG_wrapper,Polyhedral_mesh_domain_3_SWIG_wrapper,Default_mesh_criteria_SWIG_wrapper,Mesh_3_parameters)
+declare_global_functions_domain_criteria(Mesh_3_Complex_3_in_triangulation_3_SWIG_wrapper,Polyhedral_mesh_domain_3_SWIG_wrapper,Sizing_field_mesh_criteria_SWIG_wrapper,Mesh_3_parameters)
+//Functions labeled mesh domain
+declare_global_functions_domain(Mesh_3_Complex_3_in_triangulation_3_SWIG_wrapper,Labeled_mesh_domain_3_SWIG_wrapper)
+declare_global_functions_domain_parameters(Mesh_3_Complex_3_in_triangulation_3_SWIG_wrapper,Labeled_mesh_domain_3_SWIG_wrapper,Mesh_3_parameters)
+declare_global_functions_domain_criteria(Mesh_3_Complex_3_in_triangulation_3_SWIG_wrapper,Labeled_mesh_domain_3_SWIG_wrapper,Default_mesh_criteria_SWIG_wrapper,Mesh_3_parameters)
+declare_global_functions_domain_criteria(Mesh_3_Complex_3_in_triangulation_3_SWIG_wrapper,Labeled_mesh_domain_3_SWIG_wrapper,Sizing_field_mesh_criteria_SWIG_wrapper,Mesh_3_parameters)
+//Functions polyhedral complex mesh domain
+declare_global_functions_native_complex_domain_criteria(Mesh_3_Complex_3_in_triangulation_3_SWIG_wrapper,Polyhedral_complex_mesh_domain_3_SWIG_wrapper,C3T3_PCMD,Default_mesh_criteria_SWIG_wrapper,Mesh_3_parameters)
+declare_global_functions_native_complex_domain_criteria(Mesh_3_Complex_3_in_triangulation_3_SWIG_wrapper,Polyhedral_complex_mesh_domain_3_SWIG_wrapper,C3T3_PCMD,Sizing_field_mesh_criteria_SWIG_wrapper,Mesh_3_parameters)
+
+//back to the default handler for the overloads declared by extensions,
+//whose domains or criteria may be implemented in the target language
+%feature("except","") exude_mesh_3;
+%feature("except","") perturb_mesh_3;
+%feature("except","") lloyd_optimize_mesh_3;
+%feature("except","") odt_optimize_mesh_3;
+%feature("except","") make_mesh_3;
+%feature("except","") refine_mesh_3;
+%feature("except","") optimize_mesh_3;
+
+#ifdef SWIGPYTHON
+//asynchronous variants, see CGAL.run_async()
+%pythoncode %{
+import CGAL as _CGAL
+make_mesh_3_async = _CGAL.async_variant(make_mesh_3)
+refine_mesh_3_async = _CGAL.async_variant(refine_mesh_3)
+%}
+#endif
 
 #ifdef SWIGJAVA
 %include "SWIG_CGAL/Mesh_3/java_extensions.i"
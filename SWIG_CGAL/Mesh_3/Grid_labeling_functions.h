@@ -0,0 +1,153 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+
+#ifndef SWIG_CGAL_MESH_3_GRID_LABELING_FUNCTIONS_H
+#define SWIG_CGAL_MESH_3_GRID_LABELING_FUNCTIONS_H
+
+#include <SWIG_CGAL/Common/Buffer.h>
+
+#include <CGAL/Bbox_3.h>
+#include <CGAL/number_utils.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+// Labeling functions of Labeled_mesh_domain_3 defined by values sampled on a
+// regular grid: the sample (i,j,k) is at origin + (i*vx, j*vy, k*vz) and is
+// the value of index i + xdim*(j + ydim*k) (x varying fastest, as in
+// CGAL::Image_3). The values are copied and shared between the copies of the
+// functions made by the domain, so that meshing never calls back into the
+// target language.
+namespace SWIG_Mesh_3 {
+
+template <class T>
+class Regular_grid
+{
+  std::shared_ptr<const std::vector<T> > values_sptr;
+  int dims[3];
+  double origin[3];
+  double spacing[3];
+
+public:
+  Regular_grid(const SWIG_CGAL::Buffer<T>& values, int xdim, int ydim, int zdim,
+               double ox, double oy, double oz, double vx, double vy, double vz)
+  {
+    if (xdim < 1 || ydim < 1 || zdim < 1)
+      throw std::invalid_argument("The grid dimensions must be positive");
+    if (!(vx > 0 && vy > 0 && vz > 0))
+      throw std::invalid_argument("The voxel sizes must be positive");
+    if (values.size() != std::size_t(xdim) * std::size_t(ydim) * std::size_t(zdim))
+      throw std::invalid_argument("The number of values must be xdim*ydim*zdim");
+    values_sptr = std::make_shared<const std::vector<T> >(values.data(), values.data() + values.size());
+    dims[0] = xdim;  dims[1] = ydim;  dims[2] = zdim;
+    origin[0] = ox;  origin[1] = oy;  origin[2] = oz;
+    spacing[0] = vx; spacing[1] = vy; spacing[2] = vz;
+  }
+
+  CGAL::Bbox_3 bbox() const
+  {
+    return CGAL::Bbox_3(origin[0], origin[1], origin[2],
+                        origin[0] + (dims[0] - 1) * spacing[0],
+                        origin[1] + (dims[1] - 1) * spacing[1],
+                        origin[2] + (dims[2] - 1) * spacing[2]);
+  }
+
+  const T& value(int i, int j, int k) const
+  {
+    return (*values_sptr)[std::size_t(i) + std::size_t(dims[0]) * (std::size_t(j) + std::size_t(dims[1]) * std::size_t(k))];
+  }
+
+  // grid coordinates of p, false if p is outside of the grid
+  template <class Point>
+  bool grid_coordinates(const Point& p, double g[3]) const
+  {
+    const double c[3] = { CGAL::to_double(p.x()), CGAL::to_double(p.y()), CGAL::to_double(p.z()) };
+    for (int d = 0; d < 3; ++d)
+    {
+      g[d] = (c[d] - origin[d]) / spacing[d];
+      if (!(g[d] >= 0 && g[d] <= dims[d] - 1))
+        return false;
+    }
+    return true;
+  }
+
+  int dimension(int d) const { return dims[d]; }
+};
+
+// Label of the nearest sample, 0 (outside of the domain) out of the grid.
+class Labeled_image_function
+{
+  Regular_grid<int> grid;
+
+public:
+  Labeled_image_function(const Regular_grid<int>& grid) : grid(grid) {}
+
+  template <class Point>
+  int operator()(const Point& p) const
+  {
+    double g[3];
+    if (!grid.grid_coordinates(p, g))
+      return 0;
+    int n[3];
+    for (int d = 0; d < 3; ++d)
+    {
+      n[d] = int(std::floor(g[d] + 0.5));
+      if (n[d] > grid.dimension(d) - 1) n[d] = grid.dimension(d) - 1;
+    }
+    return grid.value(n[0], n[1], n[2]);
+  }
+};
+
+// 1 where the trilinear interpolation of the samples is negative, 0 elsewhere
+// and out of the grid.
+class Implicit_grid_function
+{
+  Regular_grid<double> grid;
+
+public:
+  Implicit_grid_function(const Regular_grid<double>& grid) : grid(grid) {}
+
+  template <class Point>
+  double value(const Point& p, bool& in_grid) const
+  {
+    double g[3];
+    in_grid = grid.grid_coordinates(p, g);
+    if (!in_grid)
+      return 0;
+    int n[3], m[3];
+    double t[3];
+    for (int d = 0; d < 3; ++d)
+    {
+      n[d] = int(std::floor(g[d]));
+      if (n[d] > grid.dimension(d) - 2) n[d] = (std::max)(grid.dimension(d) - 2, 0);
+      m[d] = (std::min)(n[d] + 1, grid.dimension(d) - 1);
+      t[d] = g[d] - n[d];
+    }
+    const double c00 = (1 - t[0]) * grid.value(n[0], n[1], n[2]) + t[0] * grid.value(m[0], n[1], n[2]);
+    const double c10 = (1 - t[0]) * grid.value(n[0], m[1], n[2]) + t[0] * grid.value(m[0], m[1], n[2]);
+    const double c01 = (1 - t[0]) * grid.value(n[0], n[1], m[2]) + t[0] * grid.value(m[0], n[1], m[2]);
+    const double c11 = (1 - t[0]) * grid.value(n[0], m[1], m[2]) + t[0] * grid.value(m[0], m[1], m[2]);
+    const double c0 = (1 - t[1]) * c00 + t[1] * c10;
+    const double c1 = (1 - t[1]) * c01 + t[1] * c11;
+    return (1 - t[2]) * c0 + t[2] * c1;
+  }
+
+  template <class Point>
+  int operator()(const Point& p) const
+  {
+    bool in_grid;
+    const double v = value(p, in_grid);
+    return (in_grid && v < 0) ? 1 : 0;
+  }
+};
+
+} //namespace SWIG_Mesh_3
+
+#endif //SWIG_CGAL_MESH_3_GRID_LABELING_FUNCTIONS_H
@@ -39,8 +39,11 @@ class Mesh_criteria_with_fields_wrapper
 public:
 #ifndef SWIG
   typedef Base cpp_base;
-  cpp_base get_data() const {
-    return cpp_base(
+  cpp_base get_data() const { return get_data_for<cpp_base>(); }
+  //the same criteria for another triangulation
+  template <class Criteria>
+  Criteria get_data_for() const {
+    return Criteria(
       CGAL::parameters::edge_size=internal::make_conversion(m_edge_size),
       CGAL::parameters::facet_angle=m_facet_angle,
       CGAL::parameters::facet_size=internal::make_conversion(m_facet_size),
@@ -7,8 +7,21 @@
 #ifndef SWIG_CGAL_MESH_3_MESH_DOMAINS_H
 #define SWIG_CGAL_MESH_3_MESH_DOMAINS_H
 
+#include <SWIG_CGAL/Common/Buffer.h>
+#include <SWIG_CGAL/Kernel/Point_3.h>
 #include <boost/shared_ptr.hpp>
 
+#ifndef SWIG
+#include <SWIG_CGAL/Mesh_3/Grid_labeling_functions.h>
+#include <SWIG_CGAL/Mesh_3/C3T3_conversion.h>
+#include <CGAL/version.h>
+#include <CGAL/boost/graph/graph_traits_Polyhedron_3.h>
+#include <CGAL/boost/graph/copy_face_graph.h>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#endif
+
 template <class Base,class Polyhedron_wrapper,class Index,class Surface_index,class Subdomain_index>
 class Polyhedral_mesh_domain_3_wrapper
 {
@@ -34,6 +47,129 @@ public:
   SWIG_CGAL_FORWARD_CALL_1(Subdomain_index,subdomain_index,Index)
 };
 
+//Labeled domain of labels or implicit function values given on a regular grid.
+//The sample (i,j,k) is at origin+(i*vx,j*vy,k*vz) and is the value of index
+//i+xdim*(j+ydim*k). The values are copied, and the domain oracle is evaluated
+//in C++ only.
+template <class Base,class Index,class Surface_index,class Subdomain_index>
+class Labeled_mesh_domain_3_wrapper
+{
+  Base data;
+  typedef Labeled_mesh_domain_3_wrapper<Base,Index,Surface_index,Subdomain_index> Self;
+  //disable deep copy
+  Self deepcopy();
+  void deepcopy(const Self&);
+
+  #ifndef SWIG
+  template <class Function>
+  static Base make_domain(const Function& f,const CGAL::Bbox_3& bbox,double relative_error_bound)
+  {
+  #if CGAL_VERSION_NR >= 1050600000
+    return Base(f,bbox,CGAL::parameters::relative_error_bound(relative_error_bound));
+  #else
+    return Base(f,bbox,relative_error_bound);
+  #endif
+  }
+  #endif
+public:
+  #ifndef SWIG
+  typedef Base cpp_base;
+  const cpp_base& get_data() const {return data;}
+        cpp_base& get_data()       {return data;}
+  Labeled_mesh_domain_3_wrapper(const cpp_base& base):data(base){}
+  #endif
+
+  //the subdomain of label l is made of the points whose nearest sample has label l,
+  //0 being the outside
+  static Self create_labeled_image_domain(SWIG_CGAL::Buffer<int> labels,int xdim,int ydim,int zdim,
+                                          const Point_3& origin,double vx,double vy,double vz,
+                                          double relative_error_bound=1e-3)
+  {
+    SWIG_Mesh_3::Regular_grid<int> grid(labels,xdim,ydim,zdim,origin.x(),origin.y(),origin.z(),vx,vy,vz);
+    return Self(make_domain(SWIG_Mesh_3::Labeled_image_function(grid),grid.bbox(),relative_error_bound));
+  }
+
+  //the domain (of subdomain index 1) is made of the points where the trilinear
+  //interpolation of the values is negative
+  static Self create_implicit_grid_domain(SWIG_CGAL::Buffer<double> values,int xdim,int ydim,int zdim,
+                                          const Point_3& origin,double vx,double vy,double vz,
+                                          double relative_error_bound=1e-3)
+  {
+    SWIG_Mesh_3::Regular_grid<double> grid(values,xdim,ydim,zdim,origin.x(),origin.y(),origin.z(),vx,vy,vz);
+    return Self(make_domain(SWIG_Mesh_3::Implicit_grid_function(grid),grid.bbox(),relative_error_bound));
+  }
+
+  Index index_from_surface_index(const Surface_index& i) const {return data.index_from_surface_patch_index(i);}
+  SWIG_CGAL_FORWARD_CALL_1(Index,index_from_subdomain_index,Subdomain_index)
+  Surface_index surface_index(const Index& i) const {return data.surface_patch_index(i);}
+  SWIG_CGAL_FORWARD_CALL_1(Subdomain_index,subdomain_index,Index)
+};
+
+//Multi-material domain bounded by several surfaces, each separating two
+//subdomains. It is built from copies of the polyhedra when first used for
+//meshing, with the sharp features detected if requested.
+template <class Base,class Mesh_polyhedron,class Polyhedron_wrapper>
+class Polyhedral_complex_mesh_domain_3_wrapper
+{
+  std::vector<Mesh_polyhedron> polyhedra;
+  std::vector<std::pair<int,int> > incident_subdomains;
+  bool features_set;
+  double feature_angle;
+  bool borders_set;
+  //the domain refers to its polyhedra: it is not copyable and is built once
+  mutable boost::shared_ptr<Base> data_sptr;
+  typedef Polyhedral_complex_mesh_domain_3_wrapper<Base,Mesh_polyhedron,Polyhedron_wrapper> Self;
+  //disable deep copy
+  Self deepcopy();
+  void deepcopy(const Self&);
+
+  void check_not_built() const
+  {
+    if (data_sptr)
+      throw std::runtime_error("The domain was already used for meshing and cannot be modified");
+  }
+public:
+  #ifndef SWIG
+  typedef Base cpp_base;
+  const cpp_base& get_data() const
+  {
+    if (!data_sptr)
+    {
+      if (polyhedra.empty())
+        throw std::runtime_error("The domain has no polyhedron");
+      data_sptr.reset(new Base(polyhedra.begin(),polyhedra.end(),incident_subdomains.begin(),incident_subdomains.end()));
+      if (features_set) data_sptr->detect_features(feature_angle);
+      if (borders_set) data_sptr->detect_borders();
+    }
+    return *data_sptr;
+  }
+  #endif
+
+  Polyhedral_complex_mesh_domain_3_wrapper():features_set(false),feature_angle(60),borders_set(false){}
+
+  //the surface poly separates the subdomains inside_index and outside_index, 0 being the outside
+  void add_polyhedron(Polyhedron_wrapper& poly,int inside_index,int outside_index)
+  {
+    check_not_built();
+    polyhedra.push_back(Mesh_polyhedron());
+    CGAL::copy_face_graph(poly.get_data(),polyhedra.back());
+    incident_subdomains.push_back(std::make_pair(inside_index,outside_index));
+  }
+  int number_of_polyhedra() const {return int(polyhedra.size());}
+  //edges with a dihedral angle smaller than angle_in_degree are protected as features
+  void detect_features(double angle_in_degree=60)
+  {
+    check_not_built();
+    features_set=true;
+    feature_angle=angle_in_degree;
+  }
+  void detect_borders()
+  {
+    check_not_built();
+    borders_set=true;
+  }
+};
+
 #endif // SWIG_CGAL_MESH_3_MESH_DOMAINS_H
 
 
@@ -0,0 +1,172 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+
+#ifndef SWIG_CGAL_MESH_3_OPTIMIZATION_STATISTICS_H
+#define SWIG_CGAL_MESH_3_OPTIMIZATION_STATISTICS_H
+
+#include <CGAL/Kernel/global_functions.h>
+#include <CGAL/enum.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+enum Mesh_optimization_return_code { BOUND_REACHED = 0,TIME_LIMIT_REACHED,CANT_IMPROVE_ANYMORE,CONVERGENCE_REACHED,MAX_ITERATION_NUMBER_REACHED};
+
+// Statistics of one optimizer run by optimize_mesh_3(): the dihedral angles
+// (in degrees) are measured over the cells of the complex before and after
+// the optimizer, and a vertex is moved if its point is not a point of the
+// triangulation before the optimizer (the exuder changes weights only).
+class Mesh_optimization_phase
+{
+  const char* m_name;
+  Mesh_optimization_return_code m_return_code;
+  double m_time;
+  int m_moved_vertices;
+  double m_min_dihedral_angle_before, m_average_dihedral_angle_before;
+  double m_min_dihedral_angle_after,  m_average_dihedral_angle_after;
+
+public:
+  #ifndef SWIG
+  Mesh_optimization_phase(const char* name, Mesh_optimization_return_code return_code, double time, int moved_vertices,
+                          double min_before, double average_before, double min_after, double average_after)
+    : m_name(name), m_return_code(return_code), m_time(time), m_moved_vertices(moved_vertices)
+    , m_min_dihedral_angle_before(min_before), m_average_dihedral_angle_before(average_before)
+    , m_min_dihedral_angle_after(min_after), m_average_dihedral_angle_after(average_after) {}
+  #endif
+
+  //"lloyd", "odt", "perturb" or "exude"
+  const char* name() const { return m_name; }
+  Mesh_optimization_return_code return_code() const { return m_return_code; }
+  //wall time of the optimizer, in seconds
+  double time() const { return m_time; }
+  int moved_vertices() const { return m_moved_vertices; }
+  double min_dihedral_angle_before() const { return m_min_dihedral_angle_before; }
+  double average_dihedral_angle_before() const { return m_average_dihedral_angle_before; }
+  double min_dihedral_angle_after() const { return m_min_dihedral_angle_after; }
+  double average_dihedral_angle_after() const { return m_average_dihedral_angle_after; }
+};
+
+#ifndef SWIG
+namespace SWIG_Mesh_3 {
+
+// min and average of the 6 dihedral angles of the cells of the complex
+template <class C3T3>
+void dihedral_angle_statistics(const C3T3& c3t3, double& min_angle, double& average_angle)
+{
+  static const int edges[6][4] = { {0,1,2,3}, {0,2,1,3}, {0,3,1,2}, {1,2,0,3}, {1,3,0,2}, {2,3,0,1} };
+  min_angle = 180;
+  double sum = 0;
+  std::size_t n = 0;
+  for (typename C3T3::Cells_in_complex_iterator c = c3t3.cells_in_complex_begin();
+       c != c3t3.cells_in_complex_end(); ++c)
+  {
+    for (int e = 0; e < 6; ++e)
+    {
+      const double angle = std::abs(CGAL::to_double(CGAL::approximate_dihedral_angle(
+        c->vertex(edges[e][0])->point().point(), c->vertex(edges[e][1])->point().point(),
+        c->vertex(edges[e][2])->point().point(), c->vertex(edges[e][3])->point().point())));
+      min_angle = (std::min)(min_angle, angle);
+      sum += angle;
+      ++n;
+    }
+  }
+  average_angle = n == 0 ? 0 : sum / double(n);
+  if (n == 0) min_angle = 0;
+}
+
+template <class Triangulation>
+std::vector<std::array<double,3> > sorted_points(const Triangulation& t)
+{
+  std::vector<std::array<double,3> > points;
+  points.reserve(t.number_of_vertices());
+  for (typename Triangulation::Finite_vertices_iterator v = t.finite_vertices_begin();
+       v != t.finite_vertices_end(); ++v)
+  {
+    const typename Triangulation::Bare_point& p = v->point().point();
+    points.push_back(std::array<double,3>{{CGAL::to_double(p.x()), CGAL::to_double(p.y()), CGAL::to_double(p.z())}});
+  }
+  std::sort(points.begin(), points.end());
+  return points;
+}
+
+template <class Triangulation>
+int number_of_moved_vertices(const Triangulation& t, const std::vector<std::array<double,3> >& points_before)
+{
+  int moved = 0;
+  for (typename Triangulation::Finite_vertices_iterator v = t.finite_vertices_begin();
+       v != t.finite_vertices_end(); ++v)
+  {
+    const typename Triangulation::Bare_point& p = v->point().point();
+    const std::array<double,3> a{{CGAL::to_double(p.x()), CGAL::to_double(p.y()), CGAL::to_double(p.z())}};
+    if (!std::binary_search(points_before.begin(), points_before.end(), a))
+      ++moved;
+  }
+  return moved;
+}
+
+} //namespace SWIG_Mesh_3
+#endif
+
+// Result of optimize_mesh_3(): one phase per optimizer run, in order.
+class Mesh_optimization_statistics
+{
+  std::vector<Mesh_optimization_phase> m_phases;
+  int m_number_of_threads;
+
+public:
+  Mesh_optimization_statistics() : m_number_of_threads(1) {}
+
+  int number_of_phases() const { return int(m_phases.size()); }
+  Mesh_optimization_phase phase(int i) const
+  {
+    if (i < 0 || i >= number_of_phases())
+      throw std::out_of_range("Invalid phase index");
+    return m_phases[i];
+  }
+  //number of threads available to the optimizers
+  int number_of_threads() const { return m_number_of_threads; }
+  double total_time() const
+  {
+    double t = 0;
+    for (const Mesh_optimization_phase& p : m_phases) t += p.time();
+    return t;
+  }
+
+  #ifndef SWIG
+  void set_number_of_threads(int n) { m_number_of_threads = n; }
+
+  //runs the optimizer f on c3t3 and records its statistics
+  template <class C3T3, class Optimizer>
+  void add_phase(const char* name, const C3T3& c3t3, const Optimizer& f)
+  {
+    typedef std::chrono::steady_clock Clock;
+    double min_before, average_before, min_after, average_after;
+    if (m_phases.empty())
+      SWIG_Mesh_3::dihedral_angle_statistics(c3t3, min_before, average_before);
+    else
+    {
+      min_before = m_phases.back().min_dihedral_angle_after();
+      average_before = m_phases.back().average_dihedral_angle_after();
+    }
+    const std::vector<std::array<double,3> > points_before = SWIG_Mesh_3::sorted_points(c3t3.triangulation());
+
+    const Clock::time_point start = Clock::now();
+    const Mesh_optimization_return_code code = CGAL::enum_cast<Mesh_optimization_return_code>(f());
+    const double time = std::chrono::duration<double>(Clock::now() - start).count();
+
+    const int moved = SWIG_Mesh_3::number_of_moved_vertices(c3t3.triangulation(), points_before);
+    SWIG_Mesh_3::dihedral_angle_statistics(c3t3, min_after, average_after);
+    m_phases.push_back(Mesh_optimization_phase(name, code, time, moved,
+                                               min_before, average_before, min_after, average_after));
+  }
+  #endif
+};
+
+#endif //SWIG_CGAL_MESH_3_OPTIMIZATION_STATISTICS_H
@@ -0,0 +1,187 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+
+#ifndef SWIG_CGAL_MESH_3_REFINEMENT_MONITOR_H
+#define SWIG_CGAL_MESH_3_REFINEMENT_MONITOR_H
+
+#include <atomic>
+#include <chrono>
+#include <limits>
+#include <memory>
+#include <utility>
+
+// State of the refinement run by make_mesh_3() or refine_mesh_3(), shared by
+// all the copies of a monitor. It is updated by the mesh criteria while the
+// refinement runs (without the GIL), so that another thread can poll the
+// progress and call stop(). The refinement then stops as soon as possible,
+// leaving a valid complex.
+class Mesh_3_refinement_monitor
+{
+#ifndef SWIG
+  typedef std::chrono::steady_clock Clock;
+  struct State
+  {
+    std::atomic<bool>     stop_requested;
+    std::atomic<bool>     stopped;
+    std::atomic<int>      vertices;
+    std::atomic<unsigned> evaluations;
+    std::atomic<double>   worst_quality;
+    std::atomic<double>   interval_worst_quality;
+    std::atomic<double>   last_publication;
+    Clock::time_point     start;
+    double                max_time;
+    int                   max_vertices;
+    State() : stop_requested(false), stopped(false), vertices(0), evaluations(0),
+              worst_quality(infinity()), interval_worst_quality(infinity()),
+              last_publication(0), start(Clock::now()), max_time(0), max_vertices(0) { }
+  };
+
+  static double infinity() { return std::numeric_limits<double>::infinity(); }
+  // period of the update of worst_quality(), in seconds
+  static double publication_period() { return 0.1; }
+#endif
+
+  std::shared_ptr<State> m_state;
+
+public:
+  Mesh_3_refinement_monitor() : m_state(std::make_shared<State>()) { }
+
+  //requests the refinement to stop, from any thread
+  void stop() { m_state->stop_requested = true; }
+  //number of vertices of the triangulation being refined
+  int number_of_vertices() const { return m_state->vertices; }
+  //smallest quality of the elements found bad in the last tenth of second
+  //(the smaller the worse), infinity if none
+  double worst_quality() const { return m_state->worst_quality; }
+  //true if the last refinement was stopped by stop() or by the budget
+  bool stopped_early() const { return m_state->stopped; }
+  double elapsed_time() const
+  {
+    return std::chrono::duration<double>(Clock::now() - m_state->start).count();
+  }
+
+#ifndef SWIG
+  //called before a refinement with its budget (0 for no limit)
+  void start(double max_time, int max_vertices)
+  {
+    State& s = *m_state;
+    s.stop_requested = false;
+    s.stopped = false;
+    s.vertices = 0;
+    s.evaluations = 0;
+    s.worst_quality = infinity();
+    s.interval_worst_quality = infinity();
+    s.last_publication = 0;
+    s.max_time = max_time;
+    s.max_vertices = max_vertices;
+    s.start = Clock::now();
+  }
+
+  //called after the refinement
+  void finish()
+  {
+    State& s = *m_state;
+    const int vertices = s.vertices;
+    s.worst_quality = s.interval_worst_quality.exchange(infinity());
+    s.stopped = s.stop_requested.load() || (s.max_vertices > 0 && vertices >= s.max_vertices);
+  }
+
+  //flag polled by CGAL to stop the refinement
+  std::atomic<bool>* stop_flag() const { return &m_state->stop_requested; }
+
+  //called by the criteria before each evaluation, with the number of vertices
+  //if known (-1 otherwise). Returns true if the refinement must stop.
+  bool check(int vertices) const
+  {
+    State& s = *m_state;
+    if (vertices >= 0)
+    {
+      s.vertices.store(vertices, std::memory_order_relaxed);
+      if (s.max_vertices > 0 && vertices >= s.max_vertices)
+        s.stop_requested = true;
+    }
+    if ((s.evaluations.fetch_add(1, std::memory_order_relaxed) & 255) == 0)
+    {
+      const double t = elapsed_time();
+      if (s.max_time > 0 && t >= s.max_time)
+        s.stop_requested = true;
+      double last = s.last_publication.load();
+      if (t - last >= publication_period() && s.last_publication.compare_exchange_strong(last, t))
+        s.worst_quality = s.interval_worst_quality.exchange(infinity());
+    }
+    return s.stop_requested.load(std::memory_order_relaxed);
+  }
+
+  //called by the criteria for each element found bad
+  void record(double quality) const
+  {
+    std::atomic<double>& worst = m_state->interval_worst_quality;
+    double current = worst.load(std::memory_order_relaxed);
+    while (quality < current && !worst.compare_exchange_weak(current, quality, std::memory_order_relaxed)) { }
+  }
+#endif
+};
+
+#ifndef SWIG
+namespace SWIG_Mesh_3 {
+
+// Criterion calling the monitor before each evaluation: once the refinement
+// must stop, every element is considered good.
+template <class Criterion>
+class Monitored_criterion : public Criterion
+{
+  Mesh_3_refinement_monitor monitor;
+public:
+  Monitored_criterion(const Criterion& criterion, const Mesh_3_refinement_monitor& monitor)
+    : Criterion(criterion), monitor(monitor) {}
+
+  template <class Tr, class Handle>
+  auto operator()(const Tr& tr, const Handle& h) const -> decltype(std::declval<const Criterion&>()(tr, h))
+  {
+    typedef decltype(std::declval<const Criterion&>()(tr, h)) Is_bad;
+    if (monitor.check(int(tr.number_of_vertices())))
+      return Is_bad();
+    Is_bad is_bad = Criterion::operator()(tr, h);
+    if (is_bad) monitor.record(double(is_bad->second));
+    return is_bad;
+  }
+
+  template <class Handle>
+  auto operator()(const Handle& h) const -> decltype(std::declval<const Criterion&>()(h))
+  {
+    typedef decltype(std::declval<const Criterion&>()(h)) Is_bad;
+    if (monitor.check(-1))
+      return Is_bad();
+    Is_bad is_bad = Criterion::operator()(h);
+    if (is_bad) monitor.record(double(is_bad->second));
+    return is_bad;
+  }
+};
+
+// Mesh criteria whose facet and cell criteria are monitored
+template <class Criteria>
+class Monitored_mesh_criteria : public Criteria
+{
+public:
+  typedef Monitored_criterion<typename Criteria::Facet_criteria> Facet_criteria;
+  typedef Monitored_criterion<typename Criteria::Cell_criteria>  Cell_criteria;
+private:
+  Facet_criteria facet_criteria;
+  Cell_criteria  cell_criteria;
+public:
+  Monitored_mesh_criteria(const Criteria& criteria, const Mesh_3_refinement_monitor& monitor)
+    : Criteria(criteria)
+    , facet_criteria(criteria.facet_criteria_object(), monitor)
+    , cell_criteria(criteria.cell_criteria_object(), monitor) {}
+
+  const Facet_criteria& facet_criteria_object() const { return facet_criteria; }
+  const Cell_criteria&  cell_criteria_object() const { return cell_criteria; }
+};
+
+} //namespace SWIG_Mesh_3
+#endif
+
+#endif //SWIG_CGAL_MESH_3_REFINEMENT_MONITOR_H
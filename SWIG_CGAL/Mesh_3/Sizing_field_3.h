@@ -0,0 +1,216 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+
+#ifndef SWIG_CGAL_MESH_3_SIZING_FIELD_3_H
+#define SWIG_CGAL_MESH_3_SIZING_FIELD_3_H
+
+#include <SWIG_CGAL/Common/Buffer.h>
+#include <SWIG_CGAL/Kernel/Point_3.h>
+
+#include <limits>
+#include <memory>
+
+#ifndef SWIG
+#include <SWIG_CGAL/Common/Sampled_grid.h>
+#include <SWIG_CGAL/Common/Spatial_insertion.h>
+#include <CGAL/Delaunay_triangulation_3.h>
+#include <CGAL/Triangulation_vertex_base_with_info_3.h>
+#include <CGAL/number_utils.h>
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <iterator>
+#include <queue>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace SWIG_Mesh_3 {
+namespace internal {
+
+// Sizes given at scattered points, linearly interpolated in the cells of
+// their Delaunay triangulation. The points out of the convex hull take the
+// size of their nearest sample.
+class Scattered_sizes_3
+{
+  typedef CGAL::Triangulation_vertex_base_with_info_3<double, EPIC_Kernel> Vb;
+  typedef CGAL::Triangulation_data_structure_3<Vb>                         Tds;
+  typedef CGAL::Delaunay_triangulation_3<EPIC_Kernel, Tds>                 Dt;
+  typedef Dt::Point                                                        Point;
+
+  Dt dt;
+
+public:
+  Scattered_sizes_3(const SWIG_CGAL::Buffer<double>& points, const SWIG_CGAL::Buffer<double>& sizes)
+  {
+    const std::size_t n = SWIG_CGAL::number_of_rows(points, 3);
+    if (sizes.size() != n)
+      throw std::invalid_argument("The number of sizes must be the number of points");
+    if (n == 0)
+      throw std::invalid_argument("At least one sample is needed");
+    const double* c = points.data();
+    std::vector<std::pair<Point, double> > samples;
+    samples.reserve(n);
+    for (std::size_t i = 0; i < n; ++i)
+      samples.push_back(std::make_pair(Point(c[3 * i], c[3 * i + 1], c[3 * i + 2]), sizes.data()[i]));
+    dt.insert(samples.begin(), samples.end());
+    // duplicated points keep the smallest size
+    for (const std::pair<Point, double>& s : samples)
+    {
+      Dt::Vertex_handle v = dt.nearest_vertex(s.first);
+      v->info() = (std::min)(v->info(), s.second);
+    }
+  }
+
+  double value(double x, double y, double z) const
+  {
+    const Point p(x, y, z);
+    Dt::Locate_type lt;
+    int li, lj;
+    Dt::Cell_handle c = dt.locate(p, lt, li, lj);
+    if (dt.dimension() < 3 || dt.is_infinite(c))
+      return dt.nearest_vertex(p, c)->info();
+    const Point& p0 = c->vertex(0)->point();
+    const Point& p1 = c->vertex(1)->point();
+    const Point& p2 = c->vertex(2)->point();
+    const Point& p3 = c->vertex(3)->point();
+    const double volume = CGAL::volume(p0, p1, p2, p3);
+    const double w0 = CGAL::volume(p, p1, p2, p3) / volume;
+    const double w1 = CGAL::volume(p0, p, p2, p3) / volume;
+    const double w2 = CGAL::volume(p0, p1, p, p3) / volume;
+    const double w3 = 1 - w0 - w1 - w2;
+    return w0 * c->vertex(0)->info() + w1 * c->vertex(1)->info()
+         + w2 * c->vertex(2)->info() + w3 * c->vertex(3)->info();
+  }
+
+  // Each size becomes the minimum over the samples s of size(s) + k * (length
+  // of the shortest path from s along the Delaunay edges) (Dijkstra).
+  void make_lipschitz(double k)
+  {
+    typedef std::pair<double, Dt::Vertex_handle> Entry;
+    if (!(k > 0))
+      throw std::invalid_argument("The Lipschitz constant must be positive");
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry> > queue;
+    for (Dt::Finite_vertices_iterator v = dt.finite_vertices_begin(); v != dt.finite_vertices_end(); ++v)
+      queue.push(Entry(v->info(), v));
+    std::vector<Dt::Vertex_handle> neighbors;
+    while (!queue.empty())
+    {
+      const Entry e = queue.top();
+      queue.pop();
+      if (e.first > e.second->info()) continue; // outdated entry
+      neighbors.clear();
+      dt.finite_adjacent_vertices(e.second, std::back_inserter(neighbors));
+      for (Dt::Vertex_handle w : neighbors)
+      {
+        const double size = e.first + k * std::sqrt(CGAL::squared_distance(e.second->point(), w->point()));
+        if (size < w->info())
+        {
+          w->info() = size;
+          queue.push(Entry(size, w));
+        }
+      }
+    }
+  }
+};
+
+} //namespace internal
+} //namespace SWIG_Mesh_3
+#endif
+
+// Sizing field of Mesh_3 criteria (facet_size and cell_size of
+// Sizing_field_mesh_criteria), defined by sizes sampled on a regular grid or
+// at scattered points. The samples are copied, so that meshing never calls
+// back into the target language. A default constructed field does not bound
+// the size.
+class Mesh_3_sizing_field
+{
+  std::shared_ptr<const SWIG_CGAL::Sampled_grid<3> >                grid_sptr;
+  std::shared_ptr<const SWIG_Mesh_3::internal::Scattered_sizes_3>  samples_sptr;
+
+public:
+  #ifndef SWIG
+  typedef Mesh_3_sizing_field cpp_base;
+  typedef double              FT;
+  const cpp_base& get_data() const { return *this; }
+
+  double value(double x, double y, double z) const
+  {
+    if (grid_sptr)
+    {
+      const double c[3] = { x, y, z };
+      return grid_sptr->value(c);
+    }
+    if (samples_sptr)
+      return samples_sptr->value(x, y, z);
+    return (std::numeric_limits<double>::max)();
+  }
+
+  //as a field of Mesh_criteria_3
+  template <class Point, class Index>
+  double operator()(const Point& p, const int, const Index&) const
+  {
+    return value(CGAL::to_double(p.x()), CGAL::to_double(p.y()), CGAL::to_double(p.z()));
+  }
+  #endif
+
+  Mesh_3_sizing_field() {}
+
+  // the sample (i,j,k) of values is at origin + (i*vx, j*vy, k*vz) and is of
+  // index i + xdim*(j + ydim*k); trilinear interpolation, the points out of
+  // the grid taking the size of the nearest point of the grid.
+  static Mesh_3_sizing_field create_from_grid(SWIG_CGAL::Buffer<double> values, int xdim, int ydim, int zdim,
+                                              const Point_3& origin, double vx, double vy, double vz)
+  {
+    const int dims[3] = { xdim, ydim, zdim };
+    const double o[3] = { origin.x(), origin.y(), origin.z() };
+    const double spacing[3] = { vx, vy, vz };
+    Mesh_3_sizing_field field;
+    field.grid_sptr = std::make_shared<const SWIG_CGAL::Sampled_grid<3> >(values, dims, o, spacing);
+    return field;
+  }
+
+  // sizes[i] is the size at the point of the row i (x,y,z) of points
+  static Mesh_3_sizing_field create_from_samples(SWIG_CGAL::Buffer<double> points, SWIG_CGAL::Buffer<double> sizes)
+  {
+    Mesh_3_sizing_field field;
+    field.samples_sptr = std::make_shared<const SWIG_Mesh_3::internal::Scattered_sizes_3>(points, sizes);
+    return field;
+  }
+
+  // Lowers the samples so that the sizes grow by at most k per unit of
+  // length between neighboring samples (along the grid axes or the edges of
+  // the Delaunay triangulation of the points). The copies of the field are
+  // not modified.
+  void make_lipschitz(double k)
+  {
+    if (grid_sptr)
+    {
+      std::shared_ptr<SWIG_CGAL::Sampled_grid<3> > grid = std::make_shared<SWIG_CGAL::Sampled_grid<3> >(*grid_sptr);
+      grid->make_lipschitz(k);
+      grid_sptr = grid;
+    }
+    else if (samples_sptr)
+    {
+      std::shared_ptr<SWIG_Mesh_3::internal::Scattered_sizes_3> samples =
+        std::make_shared<SWIG_Mesh_3::internal::Scattered_sizes_3>(*samples_sptr);
+      samples->make_lipschitz(k);
+      samples_sptr = samples;
+    }
+  }
+
+  double value(const Point_3& p) const { return value(p.x(), p.y(), p.z()); }
+
+  // false for a default constructed field
+  bool is_bounded() const { return grid_sptr || samples_sptr; }
+
+  //deep copy (the samples are never modified in place)
+  typedef Mesh_3_sizing_field Self;
+  Self deepcopy() const { return *this; }
+  void deepcopy(const Self& other) { *this = other; }
+};
+
+#endif //SWIG_CGAL_MESH_3_SIZING_FIELD_3_H
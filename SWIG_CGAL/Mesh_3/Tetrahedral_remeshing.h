@@ -0,0 +1,95 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+
+#ifndef SWIG_CGAL_MESH_3_TETRAHEDRAL_REMESHING_H
+#define SWIG_CGAL_MESH_3_TETRAHEDRAL_REMESHING_H
+
+#include <SWIG_CGAL/Common/Buffer.h>
+#include <SWIG_CGAL/Mesh_3/Sizing_field_3.h>
+
+#include <CGAL/version.h>
+#if CGAL_VERSION_NR >= 1050100000
+#include <CGAL/tetrahedral_remeshing.h>
+#endif
+
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace SWIG_Mesh_3 {
+
+// CGAL::tetrahedral_isotropic_remeshing() of the complex in place, with the
+// edge length `sizing` (a double, or a Mesh_3_sizing_field with CGAL 6.0 or
+// later). The cells keep their subdomain index and the surfaces between
+// subdomains are kept, moved only if remesh_boundaries. It runs with the
+// threads of `parameters` (see Mesh_3_parameters::set_parallel()), the
+// triangulation of the complex being the parallel one when CGAL is linked
+// with TBB.
+template <class C3T3, class Sizing, class Parameters>
+void tetrahedral_isotropic_remeshing(C3T3& c3t3, const Sizing& sizing, int number_of_iterations,
+                                     bool remesh_boundaries, const Parameters& parameters)
+{
+#if CGAL_VERSION_NR >= 1050100000
+  if (number_of_iterations < 0)
+    throw std::invalid_argument("The number of iterations must be non-negative");
+  if (c3t3.number_of_cells_in_complex() == 0)
+    throw std::invalid_argument("The complex has no cells");
+  parameters.run_concurrently([&](){
+    CGAL::tetrahedral_isotropic_remeshing(c3t3, sizing,
+      CGAL::parameters::number_of_iterations(number_of_iterations)
+                       .remesh_boundaries(remesh_boundaries));
+  });
+#else
+  (void)c3t3; (void)sizing; (void)number_of_iterations; (void)remesh_boundaries; (void)parameters;
+  throw std::runtime_error("tetrahedral_isotropic_remeshing() needs CGAL 5.1 or later");
+#endif
+}
+
+template <class C3T3, class Parameters>
+void tetrahedral_isotropic_remeshing(C3T3& c3t3, const Mesh_3_sizing_field& sizing, int number_of_iterations,
+                                     bool remesh_boundaries, const Parameters& parameters)
+{
+#if CGAL_VERSION_NR >= 1060000000
+  if (!sizing.is_bounded())
+    throw std::invalid_argument("The sizing field has no samples");
+  tetrahedral_isotropic_remeshing<C3T3, Mesh_3_sizing_field, Parameters>(
+    c3t3, sizing, number_of_iterations, remesh_boundaries, parameters);
+#else
+  (void)c3t3; (void)sizing; (void)number_of_iterations; (void)remesh_boundaries; (void)parameters;
+  throw std::runtime_error("tetrahedral_isotropic_remeshing() with a sizing field needs CGAL 6.0 or later");
+#endif
+}
+
+// The sizing field of the sizes of the cells of the complex, sizes[j] being
+// the target edge length of the j-th cell of the complex (in the order of
+// C3T3_wrapper::to_arrays()), sampled at its centroid.
+template <class C3T3>
+Mesh_3_sizing_field cell_sizing_field(const C3T3& c3t3, const SWIG_CGAL::Buffer<double>& sizes)
+{
+  if (sizes.size() != c3t3.number_of_cells_in_complex())
+    throw std::invalid_argument("Expecting one size per cell of the complex");
+  std::vector<double> centroids;
+  centroids.reserve(3 * sizes.size());
+  for (typename C3T3::Cells_in_complex_iterator c = c3t3.cells_in_complex_begin();
+       c != c3t3.cells_in_complex_end(); ++c)
+  {
+    double x = 0, y = 0, z = 0;
+    for (int i = 0; i < 4; ++i)
+    {
+      x += CGAL::to_double(c->vertex(i)->point().x());
+      y += CGAL::to_double(c->vertex(i)->point().y());
+      z += CGAL::to_double(c->vertex(i)->point().z());
+    }
+    centroids.push_back(x / 4);
+    centroids.push_back(y / 4);
+    centroids.push_back(z / 4);
+  }
+  return Mesh_3_sizing_field::create_from_samples(SWIG_CGAL::Buffer<double>(std::move(centroids), 3), sizes);
+}
+
+} //namespace SWIG_Mesh_3
+
+#endif //SWIG_CGAL_MESH_3_TETRAHEDRAL_REMESHING_H
@@ -10,6 +10,8 @@
 #include  <SWIG_CGAL/Mesh_3/C3T3.h>
 #include  <SWIG_CGAL/Mesh_3/Mesh_domains.h>
 #include  <SWIG_CGAL/Mesh_3/Mesh_criteria.h>
+#include  <SWIG_CGAL/Mesh_3/Sizing_field_3.h>
 #include  <SWIG_CGAL/Mesh_3/parameters.h>
+#include  <SWIG_CGAL/Mesh_3/Tetrahedral_remeshing.h>
 
 #endif //SWIG_CGAL_MESH_3_ALL_INCLUDES_H
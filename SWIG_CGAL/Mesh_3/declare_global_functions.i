@@ -51,28 +51,92 @@
 %}
 %enddef //end declare_global_functions_domain
 
+//C3T3-domain-parameters dependant
+%define declare_global_functions_domain_parameters(C3T3,DOMAIN,PARAMETERS)
+%inline  %{
+  //runs the optimizers set in parameters with its number of threads
+  Mesh_optimization_statistics optimize_mesh_3 ( C3T3& c3t3,const DOMAIN& domain,const PARAMETERS& parameters)
+  {
+    return parameters.optimize(c3t3.get_data(),domain.get_data());
+  }
+%}
+%enddef //end declare_global_functions_domain_parameters
+
+//C3T3-parameters dependant
+%define declare_global_functions_remeshing(C3T3,PARAMETERS)
+%inline  %{
+  //remeshes the complex in place, with the threads of parameters (see SWIG_Mesh_3::tetrahedral_isotropic_remeshing)
+  void tetrahedral_isotropic_remeshing(C3T3& c3t3,double target_edge_length,int number_of_iterations=1,bool remesh_boundaries=true,const PARAMETERS& parameters=PARAMETERS())
+  {
+    SWIG_Mesh_3::tetrahedral_isotropic_remeshing(c3t3.get_data(),target_edge_length,number_of_iterations,remesh_boundaries,parameters);
+  }
+
+  //the target edge lengths given by a sizing field (CGAL 6.0 or later)
+  void tetrahedral_isotropic_remeshing(C3T3& c3t3,const Mesh_3_sizing_field& sizing,int number_of_iterations=1,bool remesh_boundaries=true,const PARAMETERS& parameters=PARAMETERS())
+  {
+    SWIG_Mesh_3::tetrahedral_isotropic_remeshing(c3t3.get_data(),sizing,number_of_iterations,remesh_boundaries,parameters);
+  }
+
+  //the target edge length of the j-th cell of the complex (see C3T3.to_arrays()) is cell_sizes[j],
+  //interpolated between the centroids of the cells (CGAL 6.0 or later)
+  void tetrahedral_isotropic_remeshing(C3T3& c3t3,SWIG_CGAL::Buffer<double> cell_sizes,int number_of_iterations=1,bool remesh_boundaries=true,const PARAMETERS& parameters=PARAMETERS())
+  {
+    const Mesh_3_sizing_field sizing=SWIG_Mesh_3::cell_sizing_field(c3t3.get_data(),cell_sizes);
+    SWIG_Mesh_3::tetrahedral_isotropic_remeshing(c3t3.get_data(),sizing,number_of_iterations,remesh_boundaries,parameters);
+  }
+%}
+%enddef //end declare_global_functions_remeshing
+
 //C3T3-domain-criteria dependant
 %define declare_global_functions_domain_criteria(C3T3,DOMAIN,CRITERIA,PARAMETERS)
 %inline %{
   C3T3 make_mesh_3(const DOMAIN& domain, const CRITERIA& criteria,const PARAMETERS& parameters)
   {
-    return C3T3( CGAL::make_mesh_3<C3T3::cpp_base>( domain.get_data(),criteria.get_data(),
-                                                                        parameters.get_lloyd_parameters(),
-                                                                        parameters.get_odt_parameters(),
-                                                                        parameters.get_perturb_parameters(),
-                                                                        parameters.get_exude_parameters()
-    ));
+    return C3T3( parameters.run([&](){
+      return CGAL::make_mesh_3<C3T3::cpp_base>( domain.get_data(),parameters.get_monitored_criteria(criteria.get_data()),
+                                                parameters.get_lloyd_parameters(),
+                                                parameters.get_odt_parameters(),
+                                                parameters.get_perturb_parameters(),
+                                                parameters.get_exude_parameters(),
+                                                parameters.get_mesh_3_options());
+    }));
   }
 
   void  refine_mesh_3 ( C3T3& c3t3, const DOMAIN& domain,const CRITERIA& criteria,const PARAMETERS& parameters)
   {
-    CGAL::refine_mesh_3(c3t3.get_data(),domain.get_data(),criteria.get_data(),
-                        parameters.get_lloyd_parameters(),
-                        parameters.get_odt_parameters(),
-                        parameters.get_perturb_parameters(),
-                        parameters.get_exude_parameters());
+    parameters.run([&](){
+      CGAL::refine_mesh_3(c3t3.get_data(),domain.get_data(),
+                          parameters.get_monitored_criteria(criteria.get_data()),
+                          parameters.get_lloyd_parameters(),
+                          parameters.get_odt_parameters(),
+                          parameters.get_perturb_parameters(),
+                          parameters.get_exude_parameters(),
+                          parameters.get_mesh_3_options());
+    });
   }
 %}
 %enddef //end declare_global_functions_domain_criteria
 
+//C3T3-domain-criteria dependant, for a domain meshed in its own complex of type
+//NATIVE_C3T3, that is then copied into C3T3 (see copy_to_subdomain_pair_complex)
+%define declare_global_functions_native_complex_domain_criteria(C3T3,DOMAIN,NATIVE_C3T3,CRITERIA,PARAMETERS)
+%inline %{
+  C3T3 make_mesh_3(const DOMAIN& domain, const CRITERIA& criteria,const PARAMETERS& parameters)
+  {
+    C3T3 res;
+    parameters.run([&](){
+      NATIVE_C3T3 c3t3=CGAL::make_mesh_3<NATIVE_C3T3>( domain.get_data(),
+                                                       parameters.get_monitored_criteria(criteria.get_data_for< CGAL::Mesh_criteria_3<NATIVE_C3T3::Triangulation> >()),
+                                                       parameters.get_lloyd_parameters(),
+                                                       parameters.get_odt_parameters(),
+                                                       parameters.get_perturb_parameters(),
+                                                       parameters.get_exude_parameters(),
+                                                       parameters.get_mesh_3_options());
+      SWIG_Mesh_3::copy_to_subdomain_pair_complex(c3t3,domain.get_data(),res.get_data());
+    });
+    return res;
+  }
+%}
+%enddef //end declare_global_functions_native_complex_domain_criteria
+
 #endif // SWIG_CGAL_MESH_3_DECLARE_GLOBAL_FUNCTIONS_I
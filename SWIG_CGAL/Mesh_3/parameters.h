@@ -15,7 +15,15 @@
 #include <CGAL/odt_optimize_mesh_3.h>
 #include <CGAL/refine_mesh_3.h>
 
-enum Mesh_optimization_return_code { BOUND_REACHED = 0,TIME_LIMIT_REACHED,CANT_IMPROVE_ANYMORE,CONVERGENCE_REACHED,MAX_ITERATION_NUMBER_REACHED};
+#include <CGAL/version.h>
+#include <SWIG_CGAL/Mesh_3/Refinement_monitor.h>
+#include <SWIG_CGAL/Mesh_3/Optimization_statistics.h>
+#include <SWIG_CGAL/Kernel/Thread_pool.h>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <CGAL/Mesh_3/Concurrent_mesher_config.h>
+#include <tbb/task_arena.h>
+#endif
 
 class Mesh_3_parameters
 {
@@ -36,8 +44,18 @@ class Mesh_3_parameters
   //exude parameters
   double exude_time_limit;
   double exude_sliver_bound;
+  //concurrency parameters (used only if the mesh triangulation has CGAL::Parallel_tag)
+  bool parallel_set;
+  int num_threads;
+  int lock_grid_resolution;
+  //refinement budget (0 for no limit)
+  double refinement_time_limit;
+  int refinement_max_vertices;
+  Mesh_3_refinement_monitor monitor;
 public:
-  Mesh_3_parameters():lloyd_set(false),odt_set(false),perturb_set(true),exude_set(true),perturb_time_limit(0),perturb_sliver_bound(0),exude_time_limit(0),exude_sliver_bound(0){}
+  Mesh_3_parameters():lloyd_set(false),odt_set(false),perturb_set(true),exude_set(true),perturb_time_limit(0),perturb_sliver_bound(0),exude_time_limit(0),exude_sliver_bound(0),
+                      parallel_set(true),num_threads(0),lock_grid_resolution(0),
+                      refinement_time_limit(0),refinement_max_vertices(0){}
 
   void set_lloyd(double time_limit,int max_iteration_number,double convergence,double freeze_bound)
   {
@@ -80,6 +98,49 @@ public:
   {
     perturb_set=false;
   }
+
+  //meshing with num_threads threads (0 for all the cores) and a lock grid with
+  //lock_grid_resolution cells per axis (0 for the CGAL default). This is the default.
+  void set_parallel(int num_threads=0,int lock_grid_resolution=0)
+  {
+    parallel_set=true;
+    this->num_threads=num_threads;
+    this->lock_grid_resolution=lock_grid_resolution;
+  }
+
+  void set_sequential()
+  {
+    parallel_set=false;
+  }
+
+  //the refinement of make_mesh_3 and refine_mesh_3 stops after time_limit seconds
+  //or once the triangulation has max_vertices vertices (0 for no limit), leaving
+  //a valid complex
+  void set_refinement_budget(double time_limit,int max_vertices)
+  {
+    refinement_time_limit=time_limit;
+    refinement_max_vertices=max_vertices;
+  }
+
+  //progress of the refinement run with these parameters (shared by their copies),
+  //that can be polled and stopped from another thread while it runs
+  Mesh_3_refinement_monitor refinement_monitor() const {return monitor;}
+
+  //true if the module was built with the concurrent mesher (CGAL linked with TBB)
+  static bool concurrency_available()
+  {
+  #ifdef CGAL_LINKED_WITH_TBB
+    return true;
+  #else
+    return false;
+  #endif
+  }
+
+  //true if the meshing functions called with these parameters run concurrently
+  bool is_parallel() const
+  {
+    return concurrency_available() && parallel_set && num_threads!=1;
+  }
 //Deep copy
   typedef Mesh_3_parameters Self;
   Self deepcopy() const {return Self(*this);}
@@ -113,6 +174,95 @@ public:
       CGAL::parameters::exude(exude_time_limit,exude_sliver_bound):
       CGAL::parameters::no_exude();
   }
+
+  //criteria reporting to the refinement monitor
+  template <class Criteria>
+  SWIG_Mesh_3::Monitored_mesh_criteria<Criteria> get_monitored_criteria(const Criteria& criteria) const
+  {
+    return SWIG_Mesh_3::Monitored_mesh_criteria<Criteria>(criteria,monitor);
+  }
+
+  //the vertex budget and the stop flag of the monitor
+  #if CGAL_VERSION_NR >= 1050600000
+  auto get_mesh_3_options() const
+    -> decltype(CGAL::parameters::mesh_3_options(CGAL::parameters::maximal_number_of_vertices(0)))
+  {
+    return CGAL::parameters::mesh_3_options(
+      CGAL::parameters::maximal_number_of_vertices(std::size_t(refinement_max_vertices)).
+                        pointer_to_stop_atomic_boolean(monitor.stop_flag()));
+  }
+  #else
+  CGAL::parameters::internal::Mesh_3_options get_mesh_3_options() const
+  {
+    return CGAL::parameters::mesh_3_options(
+      CGAL::parameters::maximal_number_of_vertices=std::size_t(refinement_max_vertices),
+      CGAL::parameters::pointer_to_stop_atomic_boolean=monitor.stop_flag());
+  }
+  #endif
+
+  //calls f() with the number of threads and the lock grid of the parameters
+  template <class F>
+  auto run_concurrently(const F& f) const -> decltype(f())
+  {
+  #ifdef CGAL_LINKED_WITH_TBB
+    struct Lock_grid_resolution_setter{
+      int& value;
+      int old_value;
+      Lock_grid_resolution_setter(int& value, int new_value):value(value),old_value(value){ if (new_value>0) value=new_value; }
+      ~Lock_grid_resolution_setter(){ value=old_value; }
+    } setter(CGAL::Mesh_3::Concurrent_mesher_config::get().locking_grid_num_cells_per_axis,lock_grid_resolution);
+    tbb::task_arena arena(!parallel_set ? 1 : (num_threads>0 ? num_threads : SWIG_CGAL::current_concurrency()));
+    return arena.execute(f);
+  #else
+    return f();
+  #endif
+  }
+
+  //same as run_concurrently(), reporting to the refinement monitor
+  template <class F>
+  auto run(const F& f) const -> decltype(f())
+  {
+    struct Monitoring{
+      Mesh_3_refinement_monitor monitor;
+      Monitoring(const Mesh_3_refinement_monitor& m,double time_limit,int max_vertices):monitor(m){ monitor.start(time_limit,max_vertices); }
+      ~Monitoring(){ monitor.finish(); }
+    } monitoring(monitor,refinement_time_limit,refinement_max_vertices);
+    return run_concurrently(f);
+  }
+
+  //runs the optimizers that are set, in the order of make_mesh_3
+  template <class C3T3,class Domain>
+  Mesh_optimization_statistics optimize(C3T3& c3t3,const Domain& domain) const
+  {
+    Mesh_optimization_statistics stats;
+    run_concurrently([&](){
+    #ifdef CGAL_LINKED_WITH_TBB
+      stats.set_number_of_threads(tbb::this_task_arena::max_concurrency());
+    #endif
+      if (lloyd_set)
+        stats.add_phase("lloyd",c3t3,[&](){
+          return CGAL::lloyd_optimize_mesh_3(c3t3,domain,
+            CGAL::parameters::time_limit=lloyd_time_limit,CGAL::parameters::max_iteration_number=lloyd_max_iteration_number,
+            CGAL::parameters::convergence=lloyd_convergence,CGAL::parameters::freeze_bound=lloyd_freeze_bound);
+        });
+      if (odt_set)
+        stats.add_phase("odt",c3t3,[&](){
+          return CGAL::odt_optimize_mesh_3(c3t3,domain,
+            CGAL::parameters::time_limit=odt_time_limit,CGAL::parameters::max_iteration_number=odt_max_iteration_number,
+            CGAL::parameters::convergence=odt_convergence,CGAL::parameters::freeze_bound=odt_freeze_bound);
+        });
+      if (perturb_set)
+        stats.add_phase("perturb",c3t3,[&](){
+          return CGAL::perturb_mesh_3(c3t3,domain,
+            CGAL::parameters::time_limit=perturb_time_limit,CGAL::parameters::sliver_bound=perturb_sliver_bound);
+        });
+      if (exude_set)
+        stats.add_phase("exude",c3t3,[&](){
+          return CGAL::exude_mesh_3(c3t3,exude_time_limit,exude_sliver_bound);
+        });
+    });
+    return stats;
+  }
   #endif
 };
 
@@ -14,6 +14,9 @@
 #include <CGAL/Mesh_criteria_3.h>
 
 #include <CGAL/Polyhedral_mesh_domain_3.h>
+#include <CGAL/Labeled_mesh_domain_3.h>
+#include <CGAL/Mesh_polyhedron_3.h>
+#include <CGAL/Polyhedral_complex_mesh_domain_3.h>
 #include <CGAL/make_mesh_3.h>
 #include <CGAL/refine_mesh_3.h>
 
@@ -55,6 +58,8 @@ public:
 typedef CGAL::Mesh_3::Robust_intersection_traits_3<EPIC_Kernel>           RIT3;
 typedef SWIG_CGAL_Triangle_accessor_3<Polyhedron_3_,EPIC_Kernel,RIT3>     SGTA3;
 typedef CGAL::Polyhedral_mesh_domain_3<Polyhedron_3_, RIT3,SGTA3>         PMD;
+//same Index types as PMD: the labeled domains are meshed in the C3T3 of PMD
+typedef CGAL::Labeled_mesh_domain_3<EPIC_Kernel>                          LMD;
 
 #ifdef CGAL_LINKED_WITH_TBB
 typedef CGAL::Mesh_triangulation_3<PMD, EPIC_Kernel, CGAL::Parallel_tag>::type MT_PMD;
@@ -66,5 +71,17 @@ typedef CGAL::Mesh_complex_3_in_triangulation_3<MT_PMD>                   C3T3_P
 // Criteria
 typedef CGAL::Mesh_criteria_3<MT_PMD>                                     DMC;
 
+// Multi-material domain with features, meshed in its own complex that is then
+// copied into a C3T3_PMD
+typedef CGAL::Mesh_polyhedron_3<EPIC_Kernel>::type                        Mesh_polyhedron_3_;
+typedef CGAL::Polyhedral_complex_mesh_domain_3<EPIC_Kernel,Mesh_polyhedron_3_> PCMD;
+#ifdef CGAL_LINKED_WITH_TBB
+typedef CGAL::Mesh_triangulation_3<PCMD, EPIC_Kernel, CGAL::Parallel_tag>::type MT_PCMD;
+#else
+typedef CGAL::Mesh_triangulation_3<PCMD>::type                                  MT_PCMD;
+#endif
+typedef CGAL::Mesh_complex_3_in_triangulation_3<MT_PCMD,PCMD::Corner_index,PCMD::Curve_index> C3T3_PCMD;
+typedef CGAL::Mesh_criteria_3<MT_PCMD>                                    PCMC;
+
 
 #endif //SWIG_CGAL_MESH_3_TYPEDEFS_H
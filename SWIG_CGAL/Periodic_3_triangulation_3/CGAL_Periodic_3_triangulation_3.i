@@ -0,0 +1,44 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+%define P3T3_DOCSTRING
+"SWIG wrapper for the CGAL 3D Periodic Triangulations package provided under the GPL-3.0+ license"
+%enddef
+%module (package="CGAL", docstring=P3T3_DOCSTRING) CGAL_Periodic_3_triangulation_3
+
+%include "SWIG_CGAL/common.i"
+Decl_void_type()
+
+SWIG_CGAL_add_java_loadLibrary(CGAL_Periodic_3_triangulation_3)
+SWIG_CGAL_package_common()
+
+%import  "SWIG_CGAL/Common/Macros.h"
+%import  "SWIG_CGAL/Kernel/CGAL_Kernel.i"
+
+//typemaps for the insertion of points from arrays and the export to arrays
+%include "SWIG_CGAL/typemaps.i"
+SWIG_CGAL_buffer_of_double_typemap_in
+SWIG_CGAL_buffer_of_double_typemap_out
+SWIG_CGAL_buffer_of_int_typemap_out
+
+//include files
+%{
+  #include <SWIG_CGAL/Periodic_3_triangulation_3/Periodic_3_triangulation_3.h>
+%}
+
+%pragma(java) jniclassimports=%{import CGAL.Kernel.Iso_cuboid_3;%}
+
+//definitions
+SWIG_CGAL_release_gil(Periodic_3_triangulation_3_wrapper::insert_from_array)
+SWIG_CGAL_release_gil(Periodic_3_triangulation_3_wrapper::to_arrays)
+%include "SWIG_CGAL/Periodic_3_triangulation_3/Periodic_3_triangulation_3.h"
+
+%typemap(javaimports) Periodic_3_triangulation_3_wrapper %{import CGAL.Kernel.Iso_cuboid_3;%}
+%template(Periodic_3_Delaunay_triangulation_3) Periodic_3_triangulation_3_wrapper<CGAL_P3DT3,CGAL::Tag_false>;
+%template(Periodic_3_regular_triangulation_3)  Periodic_3_triangulation_3_wrapper<CGAL_P3RT3,CGAL::Tag_true>;
+
+#ifdef SWIG_CGAL_HAS_Periodic_3_triangulation_3_USER_PACKAGE
+%include "SWIG_CGAL/User_packages/Periodic_3_triangulation_3/extensions.i"
+#endif
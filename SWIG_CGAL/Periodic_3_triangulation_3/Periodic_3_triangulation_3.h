@@ -0,0 +1,196 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+
+#ifndef SWIG_CGAL_PERIODIC_3_TRIANGULATION_3_PERIODIC_3_TRIANGULATION_3_H
+#define SWIG_CGAL_PERIODIC_3_TRIANGULATION_3_PERIODIC_3_TRIANGULATION_3_H
+
+#include <SWIG_CGAL/Common/Buffer.h>
+#include <SWIG_CGAL/Kernel/Iso_cuboid_3.h>
+#include <SWIG_CGAL/Periodic_3_triangulation_3/typedefs.h>
+
+#ifndef SWIG
+#include <SWIG_CGAL/Triangulation_3/Point_rows.h>
+
+#include <CGAL/Unique_hash_map.h>
+#include <CGAL/tags.h>
+
+#include <boost/shared_ptr.hpp>
+
+#include <stdexcept>
+#endif
+
+#include <memory>
+#include <vector>
+
+// Result of Periodic_3_triangulation_3_wrapper::to_arrays(), the 1-sheeted
+// covering of the triangulation: row i of point_array() is the point of the
+// i-th vertex (x,y,z, and the weight for a regular triangulation), in the
+// domain, and row j of cell_array() the indices of the vertices of the j-th
+// cell. Row j of offset_array() is the offset (in units of the domain side)
+// of each of these vertices, columns 3k..3k+2 for vertex k: the cell is the
+// tetrahedron of the points translated by their offsets.
+class Periodic_3_triangulation_3_arrays
+{
+  std::size_t m_point_size;
+  std::shared_ptr<std::vector<double> > points_sptr;
+  std::shared_ptr<std::vector<int> >    cells_sptr;
+  std::shared_ptr<std::vector<int> >    offsets_sptr;
+
+public:
+  Periodic_3_triangulation_3_arrays()
+    : m_point_size(3)
+    , points_sptr(new std::vector<double>())
+    , cells_sptr(new std::vector<int>())
+    , offsets_sptr(new std::vector<int>()) {}
+
+  #ifndef SWIG
+  template <class Triangulation, class Weighted_tag>
+  Periodic_3_triangulation_3_arrays(const Triangulation& t, Weighted_tag)
+    : Periodic_3_triangulation_3_arrays()
+  {
+    typedef typename Triangulation::Vertex_handle Vertex_handle;
+
+    m_point_size = Weighted_tag::value ? 4 : 3;
+    CGAL::Unique_hash_map<Vertex_handle, int> vertex_index(-1, t.number_of_vertices());
+    points_sptr->reserve(m_point_size * t.number_of_vertices());
+    int nv = 0;
+    for (typename Triangulation::Vertex_iterator v = t.vertices_begin(); v != t.vertices_end(); ++v)
+    {
+      vertex_index[v] = nv++;
+      SWIG_Triangulation_3::internal::append_point_row(*points_sptr, v->point(), Weighted_tag());
+    }
+
+    cells_sptr->reserve(4 * t.number_of_cells());
+    offsets_sptr->reserve(12 * t.number_of_cells());
+    for (typename Triangulation::Cell_iterator c = t.cells_begin(); c != t.cells_end(); ++c)
+      for (int i = 0; i < 4; ++i)
+      {
+        cells_sptr->push_back(vertex_index[c->vertex(i)]);
+        const typename Triangulation::Offset offset = t.get_offset(c, i);
+        offsets_sptr->push_back(offset.x());
+        offsets_sptr->push_back(offset.y());
+        offsets_sptr->push_back(offset.z());
+      }
+  }
+  #endif
+
+  int number_of_points() const { return int(points_sptr->size() / m_point_size); }
+  int number_of_cells() const { return int(cells_sptr->size() / 4); }
+
+  // (number_of_points(), 3), or (number_of_points(), 4) with the weights
+  SWIG_CGAL::Buffer<double> point_array() const
+  {
+    return SWIG_CGAL::Buffer<double>(points_sptr->data(), points_sptr->size() / m_point_size, m_point_size,
+                                     points_sptr, true);
+  }
+  // (number_of_cells(), 4)
+  SWIG_CGAL::Buffer<int> cell_array() const
+  {
+    return SWIG_CGAL::Buffer<int>(cells_sptr->data(), cells_sptr->size() / 4, 4,
+                                  cells_sptr, true);
+  }
+  // (number_of_cells(), 12)
+  SWIG_CGAL::Buffer<int> offset_array() const
+  {
+    return SWIG_CGAL::Buffer<int>(offsets_sptr->data(), offsets_sptr->size() / 12, 12,
+                                  offsets_sptr, true);
+  }
+};
+
+// Periodic Delaunay (or regular, with Weighted_tag=CGAL::Tag_true)
+// triangulation of the points of a cubic domain, the flat torus of the
+// periodic boundary conditions of a simulation. The points are inserted from
+// arrays of rows (x,y,z), or (x,y,z,weight), in [min,max) of the domain,
+// and the triangulation is exported to arrays. CGAL starts with a 27-sheeted
+// covering of the domain and switches to the 1-sheeted one as soon as the
+// points are dense enough: only this one is exported. Copies share the
+// triangulation.
+template <class Triangulation, class Weighted_tag>
+class Periodic_3_triangulation_3_wrapper
+{
+  boost::shared_ptr<Triangulation> data_sptr;
+
+  #ifndef SWIG
+  typedef typename Triangulation::Iso_cuboid Cpp_domain;
+  typedef typename Triangulation::Vertex::Point Cpp_point;
+
+  static Cpp_domain check_domain(const Cpp_domain& domain)
+  {
+    const double side = domain.xmax() - domain.xmin();
+    if (!(side > 0) || domain.ymax() - domain.ymin() != side || domain.zmax() - domain.zmin() != side)
+      throw std::invalid_argument("The domain must be a cube");
+    return domain;
+  }
+  #endif
+public:
+  #ifndef SWIG
+  typedef Triangulation cpp_base;
+  const cpp_base& get_data() const {return *data_sptr;}
+        cpp_base& get_data()       {return *data_sptr;}
+  #endif
+
+//Creation
+  // the unit cube
+  Periodic_3_triangulation_3_wrapper() : data_sptr(new Triangulation()) {}
+  Periodic_3_triangulation_3_wrapper(const Iso_cuboid_3& domain)
+    : data_sptr(new Triangulation(check_domain(domain.get_data()))) {}
+
+//Insertion
+  // Inserts the rows of a (n,3) array of points, (n,4) with the weights for
+  // a regular triangulation, spatially sorted by CGAL. If large_point_set,
+  // the triangulation is switched to the 1-sheeted covering from the start
+  // (with dummy points, removed afterwards), which is faster for point sets
+  // dense enough to be triangulated in one sheet. Returns the number of new
+  // vertices.
+  int insert_from_array(SWIG_CGAL::Buffer<double> points, bool large_point_set = false)
+  {
+    const std::size_t row_size = Weighted_tag::value ? 4 : 3;
+    if (points.size() % row_size != 0)
+      throw std::invalid_argument(Weighted_tag::value ? "Expecting rows of 4 values (x,y,z,weight)"
+                                                      : "Expecting rows of 3 coordinates");
+    Triangulation& t = get_data();
+    const Cpp_domain& domain = t.domain();
+    const double side = domain.xmax() - domain.xmin();
+    std::vector<Cpp_point> cpp_points;
+    cpp_points.reserve(points.size() / row_size);
+    for (std::size_t k = 0; k < points.size(); k += row_size)
+    {
+      const double* row = points.data() + k;
+      for (int i = 0; i < 3; ++i)
+        if (!(row[i] >= domain.min_coord(i) && row[i] < domain.max_coord(i)))
+          throw std::invalid_argument("The points must be in [min,max) of the domain");
+      if (Weighted_tag::value && !(row[3] >= 0 && row[3] < side * side / 64))
+        throw std::invalid_argument("The weights must be in [0,side^2/64) of the domain");
+      cpp_points.push_back(SWIG_Triangulation_3::internal::make_point<Cpp_point>(row, Weighted_tag()));
+    }
+    const std::size_t before = t.number_of_vertices();
+    t.insert(cpp_points.begin(), cpp_points.end(), large_point_set);
+    return int(t.number_of_vertices() - before);
+  }
+  void clear() { get_data().clear(); }
+
+//Access
+  Iso_cuboid_3 domain() const { return Iso_cuboid_3(get_data().domain()); }
+  int number_of_vertices() const { return int(get_data().number_of_vertices()); }
+  int number_of_cells() const { return int(get_data().number_of_cells()); }
+  bool is_triangulation_in_1_sheet() const { return get_data().is_triangulation_in_1_sheet(); }
+  bool is_valid() const { return get_data().is_valid(); }
+
+//Export
+  // the 1-sheeted covering (see Periodic_3_triangulation_3_arrays); throws if
+  // there are still too few points to triangulate the domain in one sheet
+  Periodic_3_triangulation_3_arrays to_arrays() const
+  {
+    if (!is_triangulation_in_1_sheet())
+      throw std::runtime_error("The triangulation is not yet in the 1-sheeted covering (too few points)");
+    return Periodic_3_triangulation_3_arrays(get_data(), Weighted_tag());
+  }
+
+//Special for SWIG
+  bool same_internal_object(const Periodic_3_triangulation_3_wrapper<Triangulation,Weighted_tag>& other) {return other.data_sptr.get()==data_sptr.get();}
+};
+
+#endif //SWIG_CGAL_PERIODIC_3_TRIANGULATION_3_PERIODIC_3_TRIANGULATION_3_H
@@ -0,0 +1,21 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+#ifndef SWIG_CGAL_PERIODIC_3_TRIANGULATION_3_TYPEDEFS_H
+#define SWIG_CGAL_PERIODIC_3_TRIANGULATION_3_TYPEDEFS_H
+
+#include <SWIG_CGAL/Kernel/typedefs.h>
+
+#include <CGAL/Periodic_3_Delaunay_triangulation_traits_3.h>
+#include <CGAL/Periodic_3_Delaunay_triangulation_3.h>
+#include <CGAL/Periodic_3_regular_triangulation_traits_3.h>
+#include <CGAL/Periodic_3_regular_triangulation_3.h>
+
+typedef CGAL::Periodic_3_Delaunay_triangulation_traits_3<EPIC_Kernel>   P3DT3_traits;
+typedef CGAL::Periodic_3_Delaunay_triangulation_3<P3DT3_traits>         CGAL_P3DT3;
+typedef CGAL::Periodic_3_regular_triangulation_traits_3<EPIC_Kernel>    P3RT3_traits;
+typedef CGAL::Periodic_3_regular_triangulation_3<P3RT3_traits>          CGAL_P3RT3;
+
+#endif //SWIG_CGAL_PERIODIC_3_TRIANGULATION_3_TYPEDEFS_H
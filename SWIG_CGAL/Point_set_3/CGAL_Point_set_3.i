@@ -42,15 +42,136 @@ import java.util.Collection;
 %include "SWIG_CGAL/typemaps.i"
 SWIG_CGAL_array_of_double_to_vector_of_point_3_typemap_in
 SWIG_CGAL_vector_of_string_to_array_of_string_typemap_out
+SWIG_CGAL_array_of_string_to_vector_of_string_typemap_in
+SWIG_CGAL_buffer_of_double_typemap_out
+SWIG_CGAL_buffer_of_int_typemap_out
+SWIG_CGAL_buffer_of_double_typemap_in
+SWIG_CGAL_buffer_of_int_typemap_in
+// narrow property columns
+SWIG_CGAL_buffer_of_float_typemap_out
+SWIG_CGAL_buffer_of_unsigned_char_typemap_out
+SWIG_CGAL_buffer_of_unsigned_short_typemap_out
+SWIG_CGAL_buffer_of_float_typemap_in
+SWIG_CGAL_buffer_of_unsigned_char_typemap_in
+SWIG_CGAL_buffer_of_unsigned_short_typemap_in
+
+#ifdef SWIGPYTHON
+// wrapped below by from_arrays(points, normals=None, **properties)
+%rename(_from_arrays) from_arrays;
+// wrapped below by property_array(name_or_map)
+%rename(_property_array) property_array;
+#endif
+
+// crop filters of Point_set_3 and Point_set_3_octree
+SWIG_CGAL_release_gil(indices_in_bbox)
+SWIG_CGAL_release_gil(indices_in_polygon_2)
+SWIG_CGAL_release_gil(indices_in_frustum)
 
 //definitions
 %include "SWIG_CGAL/Point_set_3/Point_set_3.h"
 %include "SWIG_CGAL/Point_set_3/Point_set_3_Property_map.h"
 
+#ifdef SWIGPYTHON
+%extend Point_set_3_wrapper<CGAL_PS3> {
+%pythoncode %{
+  @staticmethod
+  def from_arrays(points, normals=None, **properties):
+      """Builds a point set from C-contiguous buffers of doubles (3 per point).
+      Keyword arguments are property arrays (1 value per point) of int32,
+      float64, uint8, uint16 or float32, giving the type of the property."""
+      if normals is None:
+          point_set = Point_set_3._from_arrays(points)
+      else:
+          point_set = Point_set_3._from_arrays(points, normals)
+      for name, values in properties.items():
+          if not point_set.set_property_array(name, values):
+              raise ValueError("Property array '" + name + "' must have one value per point")
+      return point_set
+
+  @staticmethod
+  def read_chunks(file, chunk_size):
+      """Generator over the points of a PLY, XYZ or LAS file, read by blocks
+      of at most `chunk_size` points (one Point_set_3 per block)."""
+      reader = Point_set_3_chunk_reader(file, chunk_size)
+      while True:
+          chunk = reader.next()
+          if chunk.empty():
+              return
+          yield chunk
+
+  def property_array(self, map):
+      """Zero-copy view of an int32, float64, uint8, uint16 or float32
+      property column. `map` is either a property name or a map."""
+      if isinstance(map, str):
+          name = map
+          for has, get in ((self.has_int_map, self.int_map),
+                           (self.has_float_map, self.float_map),
+                           (self.has_uint8_map, self.uint8_map),
+                           (self.has_uint16_map, self.uint16_map),
+                           (self.has_float32_map, self.float32_map)):
+              if has(name):
+                  map = get(name)
+                  break
+          else:
+              raise KeyError("No property column named '" + name + "'")
+      return self._property_array(map)
+%}
+}
+#endif
+
+#ifdef SWIGJAVA
+//direct java.nio buffers used in place, see CGAL.Java.Direct_buffers
+%typemap(javacode) Point_set_3_wrapper %{
+  public static $javaclassname fromDirectBuffers(java.nio.DoubleBuffer points) {
+    return from_arrays(points);
+  }
+
+  public static $javaclassname fromDirectBuffers(java.nio.DoubleBuffer points, java.nio.DoubleBuffer normals) {
+    return from_arrays(points, normals);
+  }
+
+  // normals can be null
+  public void toDirectBuffers(java.nio.DoubleBuffer points, java.nio.DoubleBuffer normals) {
+    write_point_array(points);
+    if (normals != null)
+      write_normal_array(normals);
+  }
+
+  public CGAL.Java.Direct_buffers toDirectBuffers() {
+    long size = point_array().capacity();
+    CGAL.Java.Direct_buffers out = new CGAL.Java.Direct_buffers(
+      CGAL.Java.Direct_buffers.allocate_doubles(size), null,
+      has_normal_map() ? CGAL.Java.Direct_buffers.allocate_doubles(size) : null);
+    toDirectBuffers(out.vertices, out.normals);
+    return out;
+  }
+%}
+#endif
+
 //template instantiation
-%typemap(javaimports) Point_set_3_wrapper %{import CGAL.Kernel.Point_3; import CGAL.Kernel.Vector_3; %}
+%typemap(javaimports) Point_set_3_wrapper %{import CGAL.Kernel.Point_3; import CGAL.Kernel.Vector_3; import CGAL.Kernel.Bbox_3; import CGAL.Kernel.Polygon_2; import CGAL.Kernel.Memory_usage; %}
 SWIG_CGAL_declare_identifier_of_template_class(Point_set_3,Point_set_3_wrapper< CGAL_PS3 >)
 
+// memory-mapped columnar point sets
+%include "SWIG_CGAL/Point_set_3/Mapped_point_set_3.h"
+
+#ifdef SWIGPYTHON
+//pickling and shared memory transport, see CGAL.add_pickle_support()
+%pythoncode %{
+import CGAL as _CGAL
+_CGAL.add_pickle_support(Point_set_3)
+%}
+#endif
+
+// block by block reading
+%include "SWIG_CGAL/Point_set_3/Point_set_3_chunk_reader.h"
+SWIG_CGAL_declare_identifier_of_template_class(Point_set_3_chunk_reader,Point_set_3_chunk_reader< CGAL_PS3 >)
+
+// octree for level of detail
+SWIG_CGAL_release_gil(Point_set_3_octree::Point_set_3_octree)
+%typemap(javaimports) Point_set_3_octree %{import CGAL.Kernel.Bbox_3; import CGAL.Kernel.Polygon_2; %}
+%include "SWIG_CGAL/Point_set_3/Point_set_3_octree.h"
+
 // iterators
 %typemap(jstype) int "Integer"  //next() return type must be Integer
 SWIG_CGAL_set_as_java_iterator_non_class(SWIG_CGAL_Iterator,Integer)
@@ -82,3 +203,6 @@ SWIG_CGAL_declare_identifier_of_template_class(Point_set_3_Point_map,SWIG_Point_
 SWIG_CGAL_declare_identifier_of_template_class(Point_set_3_Vector_map,SWIG_Point_set_3::CGAL_Property_map<CGAL_PS3, Vector_3>)
 SWIG_CGAL_declare_identifier_of_template_class(Point_set_3_Int_map,SWIG_Point_set_3::CGAL_Property_map<CGAL_PS3, int>)
 SWIG_CGAL_declare_identifier_of_template_class(Point_set_3_Float_map,SWIG_Point_set_3::CGAL_Property_map<CGAL_PS3, double>)
+SWIG_CGAL_declare_identifier_of_template_class(Point_set_3_Uint8_map,SWIG_Point_set_3::CGAL_Property_map<CGAL_PS3, unsigned char>)
+SWIG_CGAL_declare_identifier_of_template_class(Point_set_3_Uint16_map,SWIG_Point_set_3::CGAL_Property_map<CGAL_PS3, unsigned short>)
+SWIG_CGAL_declare_identifier_of_template_class(Point_set_3_Float32_map,SWIG_Point_set_3::CGAL_Property_map<CGAL_PS3, float>)
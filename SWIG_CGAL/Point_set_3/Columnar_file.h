@@ -0,0 +1,592 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+
+#ifndef SWIG_CGAL_POINT_SET_3_COLUMNAR_FILE_H
+#define SWIG_CGAL_POINT_SET_3_COLUMNAR_FILE_H
+
+#include <SWIG_CGAL/Common/Buffer.h>
+
+#include <CGAL/version.h>
+
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+#ifdef CGAL_LINKED_WITH_ZLIB
+#include <zlib.h>
+#endif
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace SWIG_Point_set_3
+{
+
+// Columnar binary format of a point set (native byte order):
+//   char[8]  magic "CGALPS3C"
+//   uint32   version
+//   uint32   number of columns
+//   uint64   number of points
+//   for each column: uint32 type, uint32 compression, uint32 name size,
+//                    char[] name, uint64 offset, uint64 stored size
+// followed by the columns. Uncompressed columns start on a 64 bytes
+// boundary so that a memory mapping of the file can be used directly as
+// typed arrays. Compressed columns are split in blocks of
+// `columnar_block_scalars` scalars whose bytes are shuffled (all first bytes,
+// then all second bytes...) before being deflated as a single zlib stream.
+// Version 1 files have no compression and no stored size fields.
+enum Column_type { POINT_COLUMN = 0, NORMAL_COLUMN = 1, INT_COLUMN = 2, FLOAT_COLUMN = 3,
+                   UINT8_COLUMN = 4, UINT16_COLUMN = 5, FLOAT32_COLUMN = 6 };
+enum Column_compression { NO_COMPRESSION = 0, ZLIB_COMPRESSION = 1 };
+
+struct Column_info
+{
+  std::string name;
+  std::uint32_t type;
+  std::uint64_t offset;
+  std::uint32_t compression;
+  std::uint64_t stored_size;
+
+  Column_info (const std::string& name = std::string(), std::uint32_t type = POINT_COLUMN)
+    : name (name), type (type), offset (0), compression (NO_COMPRESSION), stored_size (0) { }
+
+  std::size_t value_size() const
+  {
+    if (type == POINT_COLUMN || type == NORMAL_COLUMN)
+      return 3 * sizeof(double);
+    return scalar_size();
+  }
+  // size of the numbers a value is made of
+  std::size_t scalar_size() const
+  {
+    switch (type)
+    {
+    case INT_COLUMN: return sizeof(int);
+    case UINT8_COLUMN: return sizeof(unsigned char);
+    case UINT16_COLUMN: return sizeof(unsigned short);
+    case FLOAT32_COLUMN: return sizeof(float);
+    default: return sizeof(double);
+    }
+  }
+};
+
+static const char columnar_magic[8] = { 'C', 'G', 'A', 'L', 'P', 'S', '3', 'C' };
+static const std::uint32_t columnar_version = 2;
+static const std::size_t columnar_block_scalars = 65536;
+
+inline std::uint64_t columnar_align (std::uint64_t offset)
+{
+  return (offset + 63) & ~std::uint64_t(63);
+}
+
+inline void columnar_shuffle (const char* in, char* out, std::size_t nb_scalars,
+                              std::size_t scalar_size)
+{
+  for (std::size_t i = 0; i < nb_scalars; ++ i)
+    for (std::size_t b = 0; b < scalar_size; ++ b)
+      out[b * nb_scalars + i] = in[i * scalar_size + b];
+}
+
+inline void columnar_unshuffle (const char* in, char* out, std::size_t nb_scalars,
+                                std::size_t scalar_size)
+{
+  for (std::size_t i = 0; i < nb_scalars; ++ i)
+    for (std::size_t b = 0; b < scalar_size; ++ b)
+      out[i * scalar_size + b] = in[b * nb_scalars + i];
+}
+
+// Destination of the bytes of a column
+class Columnar_sink
+{
+protected:
+  std::ostream& m_os;
+  std::uint64_t m_written;
+
+public:
+  Columnar_sink (std::ostream& os) : m_os (os), m_written (0) { }
+  virtual ~Columnar_sink() { }
+
+  virtual void write (const char* data, std::size_t size)
+  {
+    m_os.write (data, std::streamsize(size));
+    m_written += size;
+  }
+  virtual void finish() { }
+
+  std::uint64_t written() const { return m_written; }
+};
+
+#ifdef CGAL_LINKED_WITH_ZLIB
+// Shuffles and deflates the bytes of a column into the stream
+class Columnar_deflate_sink : public Columnar_sink
+{
+  z_stream m_zs;
+  std::size_t m_scalar_size;
+  std::vector<char> m_block;
+  std::size_t m_block_size;
+  std::vector<char> m_shuffled;
+  std::vector<char> m_out;
+
+  void deflate_block (int flush)
+  {
+    std::size_t nb_scalars = m_block_size / m_scalar_size;
+    columnar_shuffle (m_block.data(), m_shuffled.data(), nb_scalars, m_scalar_size);
+    m_zs.next_in = reinterpret_cast<Bytef*>(m_shuffled.data());
+    m_zs.avail_in = uInt(m_block_size);
+    do
+    {
+      m_zs.next_out = reinterpret_cast<Bytef*>(m_out.data());
+      m_zs.avail_out = uInt(m_out.size());
+      deflate (&m_zs, flush);
+      Columnar_sink::write (m_out.data(), m_out.size() - m_zs.avail_out);
+    }
+    while (m_zs.avail_out == 0);
+    m_block_size = 0;
+  }
+
+public:
+  Columnar_deflate_sink (std::ostream& os, std::size_t scalar_size)
+    : Columnar_sink (os), m_scalar_size (scalar_size)
+    , m_block (columnar_block_scalars * scalar_size), m_block_size (0)
+    , m_shuffled (m_block.size()), m_out (m_block.size())
+  {
+    std::memset (&m_zs, 0, sizeof(z_stream));
+    if (deflateInit (&m_zs, Z_DEFAULT_COMPRESSION) != Z_OK)
+      throw std::runtime_error("Cannot initialize zlib compression");
+  }
+  ~Columnar_deflate_sink() { deflateEnd (&m_zs); }
+
+  void write (const char* data, std::size_t size)
+  {
+    while (size != 0)
+    {
+      std::size_t chunk = std::min (size, m_block.size() - m_block_size);
+      std::memcpy (m_block.data() + m_block_size, data, chunk);
+      m_block_size += chunk;
+      data += chunk;
+      size -= chunk;
+      if (m_block_size == m_block.size())
+        deflate_block (Z_NO_FLUSH);
+    }
+  }
+
+  void finish() { deflate_block (Z_FINISH); }
+};
+#endif
+
+template <typename T, typename Point_set_base>
+typename Point_set_base::template Property_map<T>
+columnar_property_map (Point_set_base& point_set, const std::string& name)
+{
+#if CGAL_VERSION_NR >= 1060000000
+  return *(point_set.template property_map<T>(name));
+#else
+  return point_set.template property_map<T>(name).first;
+#endif
+}
+
+template <typename T>
+void columnar_write_value (std::ostream& os, const T& t)
+{
+  os.write (reinterpret_cast<const char*>(&t), sizeof(T));
+}
+
+template <typename Point_set_base, typename Map>
+void columnar_write_column (Columnar_sink& sink, Point_set_base& point_set, Map map,
+                            std::size_t value_size)
+{
+  if (!point_set.empty())
+  {
+    if (!point_set.has_garbage())
+      // all stored items are alive: the storage is written in one call
+      sink.write (reinterpret_cast<const char*>(&(map[typename Point_set_base::Index(0)])),
+                  point_set.size() * value_size);
+    else
+      for (typename Point_set_base::Index idx : point_set)
+        sink.write (reinterpret_cast<const char*>(&(map[idx])), value_size);
+  }
+  sink.finish();
+}
+
+inline void columnar_write_directory (std::ostream& os, const std::vector<Column_info>& columns,
+                                      std::uint64_t nb_points)
+{
+  os.write (columnar_magic, sizeof(columnar_magic));
+  columnar_write_value (os, columnar_version);
+  columnar_write_value (os, std::uint32_t(columns.size()));
+  columnar_write_value (os, nb_points);
+  for (const Column_info& c : columns)
+  {
+    columnar_write_value (os, c.type);
+    columnar_write_value (os, c.compression);
+    columnar_write_value (os, std::uint32_t(c.name.size()));
+    os.write (c.name.data(), std::streamsize(c.name.size()));
+    columnar_write_value (os, c.offset);
+    columnar_write_value (os, c.stored_size);
+  }
+}
+
+// Writes the points, normals and int/float/uint8/uint16/float32 properties
+// of `point_set` (removed points are skipped). Properties of other types are ignored.
+// With `compress`, columns are deflated (requires zlib) and the directory
+// is rewritten once their sizes are known.
+template <typename Point_set_base>
+bool write_columnar_point_set (std::ostream& os, Point_set_base& point_set,
+                               bool compress = false)
+{
+#ifndef CGAL_LINKED_WITH_ZLIB
+  if (compress)
+  {
+    std::cerr << "Error: compressed point sets require zlib" << std::endl;
+    return false;
+  }
+#endif
+
+  std::vector<Column_info> columns;
+  columns.push_back (Column_info ("point", POINT_COLUMN));
+  if (point_set.has_normal_map())
+    columns.push_back (Column_info ("normal", NORMAL_COLUMN));
+  for (const std::string& name : point_set.properties())
+  {
+    if (name == "index" || name == "point" || name == "normal")
+      continue;
+    if (point_set.template has_property_map<int>(name))
+      columns.push_back (Column_info (name, INT_COLUMN));
+    else if (point_set.template has_property_map<double>(name))
+      columns.push_back (Column_info (name, FLOAT_COLUMN));
+    else if (point_set.template has_property_map<unsigned char>(name))
+      columns.push_back (Column_info (name, UINT8_COLUMN));
+    else if (point_set.template has_property_map<unsigned short>(name))
+      columns.push_back (Column_info (name, UINT16_COLUMN));
+    else if (point_set.template has_property_map<float>(name))
+      columns.push_back (Column_info (name, FLOAT32_COLUMN));
+  }
+
+  const std::uint64_t nb_points = point_set.size();
+  for (Column_info& c : columns)
+  {
+    c.compression = (compress ? ZLIB_COMPRESSION : NO_COMPRESSION);
+    c.stored_size = nb_points * c.value_size();
+  }
+
+  const std::streamoff start = os.tellp();
+  columnar_write_directory (os, columns, nb_points);
+
+  for (Column_info& c : columns)
+  {
+    static const char padding[64] = { 0 };
+    std::uint64_t position = std::uint64_t(os.tellp() - start);
+    os.write (padding, std::streamsize(columnar_align (position) - position));
+    c.offset = columnar_align (position);
+
+    std::unique_ptr<Columnar_sink> sink;
+#ifdef CGAL_LINKED_WITH_ZLIB
+    if (compress)
+      sink.reset (new Columnar_deflate_sink (os, c.scalar_size()));
+    else
+#endif
+      sink.reset (new Columnar_sink (os));
+
+    if (c.type == POINT_COLUMN)
+      columnar_write_column (*sink, point_set, point_set.point_map(), c.value_size());
+    else if (c.type == NORMAL_COLUMN)
+      columnar_write_column (*sink, point_set, point_set.normal_map(), c.value_size());
+    else if (c.type == INT_COLUMN)
+      columnar_write_column (*sink, point_set, columnar_property_map<int>(point_set, c.name),
+                             c.value_size());
+    else if (c.type == UINT8_COLUMN)
+      columnar_write_column (*sink, point_set, columnar_property_map<unsigned char>(point_set, c.name),
+                             c.value_size());
+    else if (c.type == UINT16_COLUMN)
+      columnar_write_column (*sink, point_set, columnar_property_map<unsigned short>(point_set, c.name),
+                             c.value_size());
+    else if (c.type == FLOAT32_COLUMN)
+      columnar_write_column (*sink, point_set, columnar_property_map<float>(point_set, c.name),
+                             c.value_size());
+    else
+      columnar_write_column (*sink, point_set, columnar_property_map<double>(point_set, c.name),
+                             c.value_size());
+    c.stored_size = sink->written();
+  }
+
+  // offsets and sizes are now known
+  const std::streamoff end = os.tellp();
+  os.seekp (start);
+  columnar_write_directory (os, columns, nb_points);
+  os.seekp (end);
+  return bool(os);
+}
+
+// Read-only memory mapping of a file written by write_columnar_point_set().
+// Opening the file only parses the column directory: columns are paged in
+// by the system when they are accessed. The same bytes can also be read
+// from memory, e.g. from a shared memory segment.
+class Columnar_file
+{
+  std::shared_ptr<void> m_owner; // keeps the bytes alive
+  const char* m_base;
+  std::size_t m_size;
+  std::uint64_t m_nb_points;
+  std::vector<Column_info> m_columns;
+
+  template <typename T>
+  T read_value (std::size_t& pos) const
+  {
+    if (pos + sizeof(T) > m_size)
+      throw std::runtime_error("Truncated columnar point set file");
+    T out;
+    std::memcpy (&out, m_base + pos, sizeof(T));
+    pos += sizeof(T);
+    return out;
+  }
+
+  void read_directory (const std::string& source)
+  {
+    if (m_size < sizeof(columnar_magic)
+        || std::memcmp (m_base, columnar_magic, sizeof(columnar_magic)) != 0)
+      throw std::runtime_error("Not a columnar point set file: " + source);
+
+    std::size_t pos = sizeof(columnar_magic);
+    std::uint32_t version = read_value<std::uint32_t>(pos);
+    if (version == 0 || version > columnar_version)
+      throw std::runtime_error("Unsupported columnar point set version: " + source);
+    std::uint32_t nb_columns = read_value<std::uint32_t>(pos);
+    m_nb_points = read_value<std::uint64_t>(pos);
+
+    m_columns.resize (nb_columns);
+    for (Column_info& c : m_columns)
+    {
+      c.type = read_value<std::uint32_t>(pos);
+      if (version >= 2)
+        c.compression = read_value<std::uint32_t>(pos);
+      std::uint32_t name_size = read_value<std::uint32_t>(pos);
+      if (pos + name_size > m_size)
+        throw std::runtime_error("Truncated columnar point set file");
+      c.name = std::string (m_base + pos, name_size);
+      pos += name_size;
+      c.offset = read_value<std::uint64_t>(pos);
+      c.stored_size = (version >= 2 ? read_value<std::uint64_t>(pos)
+                       : m_nb_points * c.value_size());
+      if (c.type > FLOAT32_COLUMN || c.compression > ZLIB_COMPRESSION
+          || (c.compression == NO_COMPRESSION && c.stored_size != m_nb_points * c.value_size())
+          || c.offset + c.stored_size > m_size)
+        throw std::runtime_error("Corrupted column " + c.name + " in " + source);
+#ifndef CGAL_LINKED_WITH_ZLIB
+      if (c.compression == ZLIB_COMPRESSION)
+        throw std::runtime_error("Reading compressed column " + c.name + " requires zlib");
+#endif
+    }
+  }
+
+public:
+
+  explicit Columnar_file (const std::string& filename)
+  {
+    boost::interprocess::file_mapping file (filename.c_str(), boost::interprocess::read_only);
+    std::shared_ptr<boost::interprocess::mapped_region> region
+      = std::make_shared<boost::interprocess::mapped_region> (file, boost::interprocess::read_only);
+    m_owner = region;
+    m_base = static_cast<const char*>(region->get_address());
+    m_size = region->get_size();
+    read_directory (filename);
+  }
+
+  // the `size` bytes at `data`, kept alive by `owner` (if null, the bytes
+  // and the views must not be used after `data` is released)
+  Columnar_file (const char* data, std::size_t size, std::shared_ptr<void> owner,
+                 const std::string& source)
+    : m_owner (owner), m_base (data), m_size (size)
+  {
+    read_directory (source);
+  }
+
+  std::size_t number_of_points() const { return std::size_t(m_nb_points); }
+  const std::vector<Column_info>& columns() const { return m_columns; }
+
+  const Column_info* find (const std::string& name, std::uint32_t type) const
+  {
+    for (const Column_info& c : m_columns)
+      if (c.type == type && (type <= NORMAL_COLUMN || c.name == name))
+        return &c;
+    return nullptr;
+  }
+
+  const char* data (const Column_info& column) const
+  {
+    return m_base + column.offset;
+  }
+
+  // Copies (and inflates if needed) the values of `column` to `target`
+  void read (const Column_info& column, char* target) const
+  {
+    const std::size_t size = std::size_t(m_nb_points * column.value_size());
+    if (column.compression == NO_COMPRESSION)
+    {
+      std::memcpy (target, data (column), size);
+      return;
+    }
+#ifdef CGAL_LINKED_WITH_ZLIB
+    z_stream zs;
+    std::memset (&zs, 0, sizeof(z_stream));
+    if (inflateInit (&zs) != Z_OK)
+      throw std::runtime_error("Cannot initialize zlib decompression");
+    zs.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data (column)));
+    // zlib counts in 32 bits: the input is given by parts
+    const std::uint64_t max_input = std::uint64_t(1) << 30;
+    std::uint64_t remaining_input = column.stored_size;
+
+    const std::size_t scalar_size = column.scalar_size();
+    std::vector<char> shuffled (columnar_block_scalars * scalar_size);
+    int status = Z_OK;
+    for (std::size_t done = 0; done < size; )
+    {
+      const std::size_t block = std::min (shuffled.size(), size - done);
+      zs.next_out = reinterpret_cast<Bytef*>(shuffled.data());
+      zs.avail_out = uInt(block);
+      while (zs.avail_out != 0 && status == Z_OK)
+      {
+        if (zs.avail_in == 0 && remaining_input != 0)
+        {
+          zs.avail_in = uInt(std::min (remaining_input, max_input));
+          remaining_input -= zs.avail_in;
+        }
+        status = inflate (&zs, Z_NO_FLUSH);
+      }
+      if (zs.avail_out != 0)
+      {
+        inflateEnd (&zs);
+        throw std::runtime_error("Corrupted compressed column " + column.name);
+      }
+      columnar_unshuffle (shuffled.data(), target + done, block / scalar_size, scalar_size);
+      done += block;
+    }
+    inflateEnd (&zs);
+#endif
+  }
+
+  // Read-only view of a column, keeping the mapping alive. Compressed
+  // columns are inflated into a buffer owned by the result.
+  template <typename T>
+  SWIG_CGAL::Buffer<T> view (const Column_info* column, std::size_t components) const
+  {
+    if (column == nullptr)
+      return SWIG_CGAL::Buffer<T>();
+    if (column->compression != NO_COMPRESSION)
+    {
+      std::vector<T> values (number_of_points() * components);
+      if (!values.empty())
+        read (*column, reinterpret_cast<char*>(values.data()));
+      return SWIG_CGAL::Buffer<T> (std::move(values), components);
+    }
+    return SWIG_CGAL::Buffer<T> (reinterpret_cast<T*>(const_cast<char*>(data (*column))),
+                                 number_of_points(), components, m_owner, true);
+  }
+
+  // Replaces the content of `point_set` by the columns of the file,
+  // with one copy per column.
+  template <typename Point_set_base>
+  void load (Point_set_base& point_set) const
+  {
+    load (point_set, m_columns);
+  }
+
+  // Same as above, restricted to points and to the columns named in `names`
+  // ("normal" for the normals), so that only these columns are read.
+  template <typename Point_set_base>
+  void load (Point_set_base& point_set, const std::vector<std::string>& names) const
+  {
+    std::vector<Column_info> columns;
+    for (const Column_info& c : m_columns)
+      if (c.type == POINT_COLUMN
+          || std::find (names.begin(), names.end(), c.name) != names.end())
+        columns.push_back (c);
+    load (point_set, columns);
+  }
+
+  // Replaces the content of `point_set` by the points [first, first + count)
+  // of the file with all their columns, copying only these rows: the file
+  // can then be processed by blocks with a bounded memory use. Compressed
+  // columns being inflated as a whole, the file must not be compressed.
+  template <typename Point_set_base>
+  void load_range (Point_set_base& point_set, std::size_t first, std::size_t count) const
+  {
+    if (first > number_of_points() || count > number_of_points() - first)
+      throw std::out_of_range("The range exceeds the points of the file");
+    for (const Column_info& c : m_columns)
+      if (c.compression != NO_COMPRESSION)
+        throw std::invalid_argument("Cannot load a range of the compressed column " + c.name);
+    load (point_set, m_columns, first, count);
+  }
+
+private:
+
+  template <typename Point_set_base>
+  void load (Point_set_base& point_set, const std::vector<Column_info>& columns) const
+  {
+    load (point_set, columns, 0, number_of_points());
+  }
+
+  template <typename Point_set_base>
+  void load (Point_set_base& point_set, const std::vector<Column_info>& columns,
+             std::size_t first, std::size_t count) const
+  {
+    typedef typename Point_set_base::Index Index;
+
+    point_set.clear();
+    for (const Column_info& c : columns)
+    {
+      if (c.type == NORMAL_COLUMN)
+        point_set.add_normal_map();
+      else if (c.type == INT_COLUMN)
+        point_set.template add_property_map<int>(c.name, 0);
+      else if (c.type == FLOAT_COLUMN)
+        point_set.template add_property_map<double>(c.name, 0.);
+      else if (c.type == UINT8_COLUMN)
+        point_set.template add_property_map<unsigned char>(c.name, 0);
+      else if (c.type == UINT16_COLUMN)
+        point_set.template add_property_map<unsigned short>(c.name, 0);
+      else if (c.type == FLOAT32_COLUMN)
+        point_set.template add_property_map<float>(c.name, 0.f);
+    }
+    point_set.resize (count);
+    if (count == 0)
+      return;
+
+    for (const Column_info& c : columns)
+    {
+      void* target = nullptr;
+      if (c.type == POINT_COLUMN)
+        target = &(point_set.point_map()[Index(0)]);
+      else if (c.type == NORMAL_COLUMN)
+        target = &(point_set.normal_map()[Index(0)]);
+      else if (c.type == INT_COLUMN)
+        target = &(columnar_property_map<int>(point_set, c.name)[Index(0)]);
+      else if (c.type == UINT8_COLUMN)
+        target = &(columnar_property_map<unsigned char>(point_set, c.name)[Index(0)]);
+      else if (c.type == UINT16_COLUMN)
+        target = &(columnar_property_map<unsigned short>(point_set, c.name)[Index(0)]);
+      else if (c.type == FLOAT32_COLUMN)
+        target = &(columnar_property_map<float>(point_set, c.name)[Index(0)]);
+      else
+        target = &(columnar_property_map<double>(point_set, c.name)[Index(0)]);
+      if (count == number_of_points())
+        read (c, static_cast<char*>(target));
+      else
+        std::memcpy (target, data (c) + first * std::size_t(c.value_size()),
+                     count * std::size_t(c.value_size()));
+    }
+  }
+};
+
+} // namespace SWIG_Point_set_3
+
+#endif // SWIG_CGAL_POINT_SET_3_COLUMNAR_FILE_H
@@ -0,0 +1,159 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+
+#ifndef SWIG_CGAL_POINT_SET_3_MAPPED_POINT_SET_3_H
+#define SWIG_CGAL_POINT_SET_3_MAPPED_POINT_SET_3_H
+
+#include <SWIG_CGAL/Common/Buffer.h>
+#include <SWIG_CGAL/Common/Shared_memory.h>
+#include <SWIG_CGAL/Point_set_3/typedefs.h>
+#include <SWIG_CGAL/Point_set_3/Point_set_3.h>
+#include <SWIG_CGAL/Point_set_3/Columnar_file.h>
+
+#include <boost/shared_ptr.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+// Point set stored in a columnar file (see Point_set_3::write() with the
+// .ps3 extension) and accessed through a read-only memory mapping: opening
+// it costs no parsing, and the views of its columns (point_array()...) are
+// paged in on demand, so that the functions taking arrays read files larger
+// than the available memory. Compressed files (.psz extension) are read the
+// same way, columns being inflated when they are accessed.
+//
+// The processing functions taking a Point_set_3 need a copy in memory:
+// load() is a fast loader (one copy per column, no parsing), whose peak
+// memory is the one of Point_set_3.read(). load_range() copies a block of
+// points only, to process an uncompressed file by blocks out of core.
+class Mapped_point_set_3
+{
+  std::shared_ptr<SWIG_Point_set_3::Columnar_file> m_file;
+
+#ifndef SWIG
+  Mapped_point_set_3 (std::shared_ptr<SWIG_Point_set_3::Columnar_file> file)
+    : m_file (file) { }
+#endif
+
+public:
+
+  Mapped_point_set_3 (const std::string& file)
+    : m_file (new SWIG_Point_set_3::Columnar_file(file)) { }
+
+  // Attaches to a shared memory segment written by
+  // Point_set_3.to_shared_memory(): the columns are viewed in the pages of
+  // the segment, shared by all the processes attached to it, without copy.
+  static Mapped_point_set_3 from_shared_memory (const std::string& name)
+  {
+    std::shared_ptr<boost::interprocess::mapped_region> region
+      = SWIG_CGAL::map_shared_memory (name);
+    return Mapped_point_set_3 (std::make_shared<SWIG_Point_set_3::Columnar_file>
+                               (static_cast<const char*>(region->get_address()),
+                                region->get_size(), region, name));
+  }
+
+  std::size_t number_of_points() const { return m_file->number_of_points(); }
+  std::size_t size() const { return m_file->number_of_points(); }
+
+  bool has_normal_map() const
+  {
+    return m_file->find ("normal", SWIG_Point_set_3::NORMAL_COLUMN) != nullptr;
+  }
+  bool has_int_map (const std::string& name) const
+  {
+    return m_file->find (name, SWIG_Point_set_3::INT_COLUMN) != nullptr;
+  }
+  bool has_float_map (const std::string& name) const
+  {
+    return m_file->find (name, SWIG_Point_set_3::FLOAT_COLUMN) != nullptr;
+  }
+  bool has_uint8_map (const std::string& name) const
+  {
+    return m_file->find (name, SWIG_Point_set_3::UINT8_COLUMN) != nullptr;
+  }
+  bool has_uint16_map (const std::string& name) const
+  {
+    return m_file->find (name, SWIG_Point_set_3::UINT16_COLUMN) != nullptr;
+  }
+  bool has_float32_map (const std::string& name) const
+  {
+    return m_file->find (name, SWIG_Point_set_3::FLOAT32_COLUMN) != nullptr;
+  }
+
+  boost::shared_ptr<std::vector<std::string> > properties() const
+  {
+    boost::shared_ptr<std::vector<std::string> > out (new std::vector<std::string>());
+    for (const SWIG_Point_set_3::Column_info& c : m_file->columns())
+      out->push_back (c.name);
+    return out;
+  }
+
+  // read-only zero-copy views of the columns
+  SWIG_CGAL::Buffer<double> point_array() const
+  {
+    return m_file->view<double> (m_file->find ("point", SWIG_Point_set_3::POINT_COLUMN), 3);
+  }
+  SWIG_CGAL::Buffer<double> normal_array() const
+  {
+    return m_file->view<double> (m_file->find ("normal", SWIG_Point_set_3::NORMAL_COLUMN), 3);
+  }
+  SWIG_CGAL::Buffer<int> int_array (const std::string& name) const
+  {
+    return m_file->view<int> (m_file->find (name, SWIG_Point_set_3::INT_COLUMN), 1);
+  }
+  SWIG_CGAL::Buffer<double> float_array (const std::string& name) const
+  {
+    return m_file->view<double> (m_file->find (name, SWIG_Point_set_3::FLOAT_COLUMN), 1);
+  }
+  SWIG_CGAL::Buffer<unsigned char> uint8_array (const std::string& name) const
+  {
+    return m_file->view<unsigned char> (m_file->find (name, SWIG_Point_set_3::UINT8_COLUMN), 1);
+  }
+  SWIG_CGAL::Buffer<unsigned short> uint16_array (const std::string& name) const
+  {
+    return m_file->view<unsigned short> (m_file->find (name, SWIG_Point_set_3::UINT16_COLUMN), 1);
+  }
+  SWIG_CGAL::Buffer<float> float32_array (const std::string& name) const
+  {
+    return m_file->view<float> (m_file->find (name, SWIG_Point_set_3::FLOAT32_COLUMN), 1);
+  }
+
+  // copies the whole file in memory
+  Point_set_3_wrapper<CGAL_PS3> load() const
+  {
+    Point_set_3_wrapper<CGAL_PS3> out;
+    m_file->load (out.get_data());
+    return out;
+  }
+
+  // loads the points and the listed columns only ("normal" for the normals)
+  Point_set_3_wrapper<CGAL_PS3> load (boost::shared_ptr<std::vector<std::string> > columns) const
+  {
+    Point_set_3_wrapper<CGAL_PS3> out;
+    m_file->load (out.get_data(), *columns);
+    return out;
+  }
+
+  // loads the points [first, first + count) with all their columns (see
+  // above; not available for compressed files)
+  Point_set_3_wrapper<CGAL_PS3> load_range (std::size_t first, std::size_t count) const
+  {
+    Point_set_3_wrapper<CGAL_PS3> out;
+    m_file->load_range (out.get_data(), first, count);
+    return out;
+  }
+
+  bool is_compressed() const
+  {
+    for (const SWIG_Point_set_3::Column_info& c : m_file->columns())
+      if (c.compression != SWIG_Point_set_3::NO_COMPRESSION)
+        return true;
+    return false;
+  }
+};
+
+#endif // SWIG_CGAL_POINT_SET_3_MAPPED_POINT_SET_3_H
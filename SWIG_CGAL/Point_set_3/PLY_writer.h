@@ -0,0 +1,192 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+
+#ifndef SWIG_CGAL_POINT_SET_3_PLY_WRITER_H
+#define SWIG_CGAL_POINT_SET_3_PLY_WRITER_H
+
+#include <SWIG_CGAL/Point_set_3/Columnar_file.h>
+
+#include <cstring>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace SWIG_Point_set_3
+{
+
+inline bool ply_is_color_property (const std::string& p)
+{
+  return (p == "R" || p == "r" || p == "red" ||
+          p == "G" || p == "g" || p == "green" ||
+          p == "B" || p == "b" || p == "blue" ||
+          p == "A" || p == "a" || p == "alpha");
+}
+
+template <typename T>
+void ply_append_value (char*& out, const T& t)
+{
+  std::memcpy (out, &t, sizeof(T));
+  out += sizeof(T);
+}
+
+// Writes the points, normals and int/float/uint8/uint16/float32 properties
+// of `point_set` as a binary PLY file (native byte order). Narrow properties
+// keep their type. Int color properties are narrowed to uchar on the fly,
+// so that no temporary property column is created.
+template <typename Point_set_base>
+bool write_binary_ply_point_set (std::ostream& os, Point_set_base& point_set)
+{
+  typedef typename Point_set_base::Index Index;
+  typedef typename Point_set_base::template Property_map<int> Int_pmap;
+  typedef typename Point_set_base::template Property_map<double> Double_pmap;
+  typedef typename Point_set_base::template Property_map<unsigned char> Uint8_pmap;
+  typedef typename Point_set_base::template Property_map<unsigned short> Uint16_pmap;
+  typedef typename Point_set_base::template Property_map<float> Float_pmap;
+
+  struct Column
+  {
+    std::string name;
+    // 'u' for int written as uchar, 'i' for int, 'd' for double,
+    // 'b' for uint8, 'w' for uint16, 'f' for float
+    char type;
+    Int_pmap int_map;
+    Double_pmap double_map;
+    Uint8_pmap uint8_map;
+    Uint16_pmap uint16_map;
+    Float_pmap float_map;
+  };
+
+  std::vector<Column> columns;
+  for (const std::string& name : point_set.properties())
+  {
+    if (name == "index" || name == "point" || name == "normal")
+      continue;
+    Column c;
+    c.name = name;
+    if (point_set.template has_property_map<int>(name))
+    {
+      c.type = ply_is_color_property (name) ? 'u' : 'i';
+      c.int_map = columnar_property_map<int>(point_set, name);
+    }
+    else if (point_set.template has_property_map<double>(name))
+    {
+      c.type = 'd';
+      c.double_map = columnar_property_map<double>(point_set, name);
+    }
+    else if (point_set.template has_property_map<unsigned char>(name))
+    {
+      c.type = 'b';
+      c.uint8_map = columnar_property_map<unsigned char>(point_set, name);
+    }
+    else if (point_set.template has_property_map<unsigned short>(name))
+    {
+      c.type = 'w';
+      c.uint16_map = columnar_property_map<unsigned short>(point_set, name);
+    }
+    else if (point_set.template has_property_map<float>(name))
+    {
+      c.type = 'f';
+      c.float_map = columnar_property_map<float>(point_set, name);
+    }
+    else
+      continue;
+    columns.push_back (c);
+  }
+
+  const bool normals = point_set.has_normal_map();
+  static const int one = 1;
+  const bool little_endian = (*reinterpret_cast<const char*>(&one) == 1);
+  os << "ply" << std::endl
+     << "format " << (little_endian ? "binary_little_endian" : "binary_big_endian")
+     << " 1.0" << std::endl
+     << "comment Generated by the CGAL library" << std::endl
+     << "element vertex " << point_set.size() << std::endl
+     << "property double x" << std::endl
+     << "property double y" << std::endl
+     << "property double z" << std::endl;
+  if (normals)
+    os << "property double nx" << std::endl
+       << "property double ny" << std::endl
+       << "property double nz" << std::endl;
+
+  std::size_t row_size = (normals ? 6 : 3) * sizeof(double);
+  for (const Column& c : columns)
+  {
+    if (c.type == 'u' || c.type == 'b')
+    {
+      os << "property uchar " << c.name << std::endl;
+      row_size += sizeof(unsigned char);
+    }
+    else if (c.type == 'w')
+    {
+      os << "property ushort " << c.name << std::endl;
+      row_size += sizeof(unsigned short);
+    }
+    else if (c.type == 'f')
+    {
+      os << "property float " << c.name << std::endl;
+      row_size += sizeof(float);
+    }
+    else if (c.type == 'i')
+    {
+      os << "property int " << c.name << std::endl;
+      row_size += sizeof(int);
+    }
+    else
+    {
+      os << "property double " << c.name << std::endl;
+      row_size += sizeof(double);
+    }
+  }
+  os << "end_header" << std::endl;
+
+  // rows are written by blocks to limit the number of stream calls
+  const std::size_t rows_per_block = 4096;
+  std::vector<char> block (row_size * rows_per_block);
+  char* out = block.data();
+  for (Index idx : point_set)
+  {
+    const typename Point_set_base::Point& p = point_set.point(idx);
+    ply_append_value (out, double(p.x()));
+    ply_append_value (out, double(p.y()));
+    ply_append_value (out, double(p.z()));
+    if (normals)
+    {
+      const typename Point_set_base::Vector& n = point_set.normal(idx);
+      ply_append_value (out, double(n.x()));
+      ply_append_value (out, double(n.y()));
+      ply_append_value (out, double(n.z()));
+    }
+    for (const Column& c : columns)
+    {
+      if (c.type == 'u')
+        ply_append_value (out, static_cast<unsigned char>(c.int_map[idx]));
+      else if (c.type == 'i')
+        ply_append_value (out, c.int_map[idx]);
+      else if (c.type == 'b')
+        ply_append_value (out, c.uint8_map[idx]);
+      else if (c.type == 'w')
+        ply_append_value (out, c.uint16_map[idx]);
+      else if (c.type == 'f')
+        ply_append_value (out, c.float_map[idx]);
+      else
+        ply_append_value (out, c.double_map[idx]);
+    }
+
+    if (out == block.data() + block.size())
+    {
+      os.write (block.data(), std::streamsize(block.size()));
+      out = block.data();
+    }
+  }
+  os.write (block.data(), std::streamsize(out - block.data()));
+
+  return bool(os);
+}
+
+} // namespace SWIG_Point_set_3
+
+#endif // SWIG_CGAL_POINT_SET_3_PLY_WRITER_H
@@ -13,13 +13,28 @@
 #include <SWIG_CGAL/Common/Macros.h>
 #include <SWIG_CGAL/Kernel/Point_3.h>
 #include <SWIG_CGAL/Kernel/Vector_3.h>
+#include <SWIG_CGAL/Kernel/Bbox_3.h>
+#include <SWIG_CGAL/Kernel/Polygon_2.h>
 #include <SWIG_CGAL/Common/Iterator.h>
+#include <SWIG_CGAL/Common/Buffer.h>
+#include <SWIG_CGAL/Common/Memory_usage.h>
+#include <SWIG_CGAL/Common/Shared_memory.h>
+#include <SWIG_CGAL/Common/Space_filling_curve.h>
 
 #include <SWIG_CGAL/Point_set_3/typedefs.h>
 #include <SWIG_CGAL/Point_set_3/Point_set_3_Property_map.h>
+#include <SWIG_CGAL/Point_set_3/Columnar_file.h>
+#include <SWIG_CGAL/Point_set_3/PLY_writer.h>
+#include <SWIG_CGAL/Point_set_3/Region_queries.h>
+
+#include <CGAL/for_each.h>
 
 #include <sstream>
 #include <fstream>
+#include <cstring>
+#include <functional>
+#include <stdexcept>
+#include <vector>
 
 template <typename Point_set_base, typename T>
 struct Nested_iterator_helper
@@ -54,6 +69,10 @@ public:
   typedef SWIG_Point_set_3::CGAL_Property_map<Point_set_base, Vector_3> Vector_map;
   typedef SWIG_Point_set_3::CGAL_Property_map<Point_set_base, int> Int_map;
   typedef SWIG_Point_set_3::CGAL_Property_map<Point_set_base, double> Float_map;
+  // narrow maps, with the storage types of PLY/LAS attributes
+  typedef SWIG_Point_set_3::CGAL_Property_map<Point_set_base, unsigned char> Uint8_map;
+  typedef SWIG_Point_set_3::CGAL_Property_map<Point_set_base, unsigned short> Uint16_map;
+  typedef SWIG_Point_set_3::CGAL_Property_map<Point_set_base, float> Float32_map;
 
   Point_set_3_wrapper(bool with_normal_map = false) : data_sptr (new cpp_base(with_normal_map)) { }
 
@@ -65,9 +84,52 @@ public:
   SWIG_CGAL_FORWARD_CALL_0(int, number_of_points)
   SWIG_CGAL_FORWARD_CALL_0(int, size)
 
+  // Appends the points of `other`, adding the properties this set lacks.
+  // The property arrays are resized once and filled in parallel, instead
+  // of point by point (falls back on the point by point join if a property
+  // has a type unknown to the bindings)
   bool join (Self other)
   {
-    return data_sptr->join (other.get_data());
+    typedef typename Point_set_base::Index Index;
+    compact();
+    data_sptr->copy_properties (other.get_data());
+    const std::size_t first = storage_size();
+    const std::vector<Index> rows (other.get_data().begin(), other.get_data().end());
+    std::vector<std::function<void()> > tasks;
+    if (!copy_properties_from (other.get_data(), rows, first, tasks))
+      return data_sptr->join (other.get_data());
+    data_sptr->resize (first + rows.size());
+    run_tasks (tasks);
+    return true;
+  }
+
+  // New point set made of the points `indices` (indices of points of this
+  // set, possibly repeated), in this order, with all the properties. The
+  // property arrays are filled in parallel.
+  Self subset (SWIG_CGAL::Buffer<int> indices)
+  {
+    typedef typename Point_set_base::Index Index;
+    std::vector<Index> rows;
+    rows.reserve (indices.size());
+    for (std::size_t k = 0; k < indices.size(); ++ k)
+    {
+      if (indices[k] < 0 || std::size_t(indices[k]) >= storage_size()
+          || data_sptr->is_removed (Index(indices[k])))
+        throw std::out_of_range("Invalid point index " + std::to_string(indices[k]));
+      rows.push_back (Index(indices[k]));
+    }
+    Self out;
+    out.get_data().copy_properties (get_data());
+    std::vector<std::function<void()> > tasks;
+    if (!out.copy_properties_from (get_data(), rows, 0, tasks))
+    {
+      for (const Index& i : rows)
+        out.get_data().insert (get_data(), i);
+      return out;
+    }
+    out.get_data().resize (rows.size());
+    out.run_tasks (tasks);
+    return out;
   }
 
   SWIG_CGAL_FORWARD_CALL_0(void, clear)
@@ -76,6 +138,38 @@ public:
   SWIG_CGAL_FORWARD_CALL_1(void, reserve, int)
   SWIG_CGAL_FORWARD_CALL_1(void, resize, int)
 
+  // The indices and the points as structure, the other property arrays
+  // (normals included) as properties, all of them with the removed points.
+  // The capacity reserved by reserve() and the properties of a type
+  // unknown to the bindings are not counted.
+  SWIG_CGAL::Memory_usage memory_usage() const
+  {
+    std::size_t structure = 0, properties = 0;
+    for (const std::string& name : data_sptr->properties())
+    {
+      std::size_t value_size = 0;
+      if (!property_value_size<typename Point_set_base::Index,
+                               bool, char, signed char, unsigned char, short, unsigned short,
+                               int, unsigned int, long, unsigned long, long long, unsigned long long,
+                               float, double, typename Point_3::cpp_base,
+                               typename Vector_3::cpp_base> (name, value_size))
+        continue;
+      (name == "index" || name == "point" ? structure : properties) += value_size * storage_size();
+    }
+    return SWIG_CGAL::Memory_usage (structure, properties);
+  }
+
+  // Removes the points marked as removed (see compact()) then releases the
+  // unused capacity of each property array in place: the property maps
+  // (Int_map, normal map...) stay valid, while the buffer views of the
+  // arrays (point_array(), property_array()...) are invalidated, the values
+  // being moved.
+  void shrink_to_fit()
+  {
+    compact();
+    data_sptr->base().shrink_to_fit();
+  }
+
   int insert ()
   {
     return (int)(*(data_sptr->insert()));
@@ -103,6 +197,74 @@ public:
       data_sptr->insert(p);
   }
 
+  // Appends the points (and normals) stored as 3 contiguous doubles per
+  // point: property arrays are resized once and filled with a single copy.
+  void insert_arrays (SWIG_CGAL::Buffer<double> points)
+  {
+    std::size_t first = resize_for_arrays (points);
+    copy_array (data_sptr->point_map(), points, first);
+  }
+
+  void insert_arrays (SWIG_CGAL::Buffer<double> points, SWIG_CGAL::Buffer<double> normals)
+  {
+    if (normals.size() != points.size())
+      throw std::invalid_argument("Points and normals arrays must have the same size");
+    if (!data_sptr->has_normal_map())
+      data_sptr->add_normal_map();
+    std::size_t first = resize_for_arrays (points);
+    copy_array (data_sptr->point_map(), points, first);
+    copy_array (data_sptr->normal_map(), normals, first);
+  }
+
+  static Self from_arrays (SWIG_CGAL::Buffer<double> points)
+  {
+    Self out;
+    out.insert_arrays (points);
+    return out;
+  }
+
+  static Self from_arrays (SWIG_CGAL::Buffer<double> points, SWIG_CGAL::Buffer<double> normals)
+  {
+    Self out (true);
+    out.insert_arrays (points, normals);
+    return out;
+  }
+
+  // Copies one value per stored point into the int (resp. float) property
+  // `name`, created if needed. Returns false if the sizes do not match.
+  bool set_property_array (const std::string& name, SWIG_CGAL::Buffer<int> values)
+  {
+    return copy_to_property<int> (name, values);
+  }
+
+  bool set_property_array (const std::string& name, SWIG_CGAL::Buffer<double> values)
+  {
+    return copy_to_property<double> (name, values);
+  }
+
+  bool set_property_array (const std::string& name, SWIG_CGAL::Buffer<unsigned char> values)
+  {
+    return copy_to_property<unsigned char> (name, values);
+  }
+
+  bool set_property_array (const std::string& name, SWIG_CGAL::Buffer<unsigned short> values)
+  {
+    return copy_to_property<unsigned short> (name, values);
+  }
+
+  bool set_property_array (const std::string& name, SWIG_CGAL::Buffer<float> values)
+  {
+    return copy_to_property<float> (name, values);
+  }
+
+  // Zero-copy views of an int (resp. float, uint8...) property, indexed like
+  // Int_map::get(), with the same validity rules as point_array()
+  SWIG_CGAL::Buffer<int> property_array (Int_map map) { return property_view<int> (map); }
+  SWIG_CGAL::Buffer<double> property_array (Float_map map) { return property_view<double> (map); }
+  SWIG_CGAL::Buffer<unsigned char> property_array (Uint8_map map) { return property_view<unsigned char> (map); }
+  SWIG_CGAL::Buffer<unsigned short> property_array (Uint16_map map) { return property_view<unsigned short> (map); }
+  SWIG_CGAL::Buffer<float> property_array (Float32_map map) { return property_view<float> (map); }
+
   iterator indices() { return iterator (get_data().begin(), get_data().end()); }
   SWIG_CGAL_FORWARD_CALL_1(Point_3, point, int)
   SWIG_CGAL_FORWARD_CALL_1(Vector_3, normal, int)
@@ -116,6 +278,80 @@ public:
   SWIG_CGAL_FORWARD_CALL_0(bool, has_garbage)
   SWIG_CGAL_FORWARD_CALL_0(void, collect_garbage)
   SWIG_CGAL_FORWARD_CALL_0(void, cancel_removals)
+  // Same as collect_garbage() (the remaining points keep their order), done
+  // in a single pass per property array, the arrays being processed in
+  // parallel, instead of the swaps of all the arrays of collect_garbage().
+  // Falls back on collect_garbage() if a property has a type unknown to
+  // the bindings.
+  void compact()
+  {
+    typedef typename Point_set_base::Index Index;
+    if (!data_sptr->has_garbage())
+      return;
+    if (!gather_points (std::vector<Index> (data_sptr->begin(), data_sptr->end())))
+      data_sptr->collect_garbage();
+  }
+  // Reorders the points along a space-filling curve through their bounding
+  // box, "hilbert" or "morton", so that close points are stored close to
+  // each other for the neighbor queries. Collects the garbage first, then
+  // permutes all the property arrays at once, as compact(). Returns (N,) the
+  // former index of each point: permute(numpy.argsort(order)) restores the
+  // previous order.
+  SWIG_CGAL::Buffer<int> spatial_sort (const std::string& mode = "hilbert")
+  {
+    typedef typename Point_set_base::Index Index;
+    compact();
+    const std::size_t n = storage_size();
+    typename Point_set_base::Point_map points = data_sptr->point_map();
+    const std::vector<std::size_t> curve
+      = SWIG_CGAL::curve_order<SWIG_Point_set_3::Concurrency_tag>
+          (n, [&points](std::size_t k) { return reinterpret_cast<const double*>(&points[Index(k)]); }, mode);
+    std::vector<int> former (curve.begin(), curve.end());
+    if (!gather_points (std::vector<Index> (curve.begin(), curve.end())))
+      throw std::invalid_argument("Cannot reorder a point set with properties of a type unknown to the bindings");
+    return SWIG_CGAL::Buffer<int>(std::move(former));
+  }
+  // Reorders the points, point k becoming the former point order[k]
+  void permute (SWIG_CGAL::Buffer<int> order)
+  {
+    typedef typename Point_set_base::Index Index;
+    compact();
+    const std::size_t n = storage_size();
+    if (order.size() != n)
+      throw std::invalid_argument("The order must have one index per point");
+    std::vector<char> seen (n, 0);
+    std::vector<Index> indices;
+    indices.reserve (n);
+    for (std::size_t k = 0; k < n; ++ k)
+    {
+      if (order[k] < 0 || std::size_t(order[k]) >= n || seen[order[k]])
+        throw std::invalid_argument("The order is not a permutation of the points");
+      seen[order[k]] = 1;
+      indices.push_back (Index(order[k]));
+    }
+    if (!gather_points (indices))
+      throw std::invalid_argument("Cannot reorder a point set with properties of a type unknown to the bindings");
+  }
+
+  // Crop filters: indices of the points in a region, in increasing order,
+  // to be given to subset(). The coordinates are scanned concurrently, by
+  // blocks of contiguous points; Point_set_3_octree prunes the scan.
+  // Points of the box (boundary included)
+  SWIG_CGAL::Buffer<int> indices_in_bbox (const Bbox_3& box) const
+  {
+    return indices_in_region (SWIG_Point_set_3::box_region (box));
+  }
+  // Points above the polygon (in the xy plane) with zmin <= z <= zmax
+  SWIG_CGAL::Buffer<int> indices_in_polygon_2 (const Polygon_2& polygon, double zmin, double zmax) const
+  {
+    return indices_in_region (SWIG_Point_set_3::prism_region (polygon.get_data(), zmin, zmax));
+  }
+  // Points on the negative side (or on) all the planes a*x+b*y+c*z+d=0
+  // given as (K,4) coefficients, e.g. the 6 planes of a view frustum
+  SWIG_CGAL::Buffer<int> indices_in_frustum (SWIG_CGAL::Buffer<double> planes) const
+  {
+    return indices_in_region (SWIG_Point_set_3::Frustum_region (planes));
+  }
 
   bool has_int_map (const std::string& name)
   {
@@ -151,6 +387,63 @@ public:
     return data_sptr->remove_property_map (map.get_data());
   }
 
+  // Narrow maps: PLY uchar/ushort/float and most LAS attributes are read in
+  // such maps, with the type of the file, instead of being widened to int
+  // or double. Values written are truncated to the type of the map.
+  bool has_uint8_map (const std::string& name)
+  {
+    return data_sptr->template has_property_map<unsigned char>(name);
+  }
+  Uint8_map add_uint8_map (const std::string& name, int default_value = 0)
+  {
+    return Uint8_map(data_sptr->template add_property_map<unsigned char>
+                     (name, static_cast<unsigned char>(default_value)));
+  }
+  Uint8_map uint8_map (const std::string& name)
+  {
+    return Uint8_map(data_sptr->template property_map<unsigned char>(name));
+  }
+  bool remove_uint8_map (Uint8_map map)
+  {
+    return data_sptr->remove_property_map (map.get_data());
+  }
+
+  bool has_uint16_map (const std::string& name)
+  {
+    return data_sptr->template has_property_map<unsigned short>(name);
+  }
+  Uint16_map add_uint16_map (const std::string& name, int default_value = 0)
+  {
+    return Uint16_map(data_sptr->template add_property_map<unsigned short>
+                      (name, static_cast<unsigned short>(default_value)));
+  }
+  Uint16_map uint16_map (const std::string& name)
+  {
+    return Uint16_map(data_sptr->template property_map<unsigned short>(name));
+  }
+  bool remove_uint16_map (Uint16_map map)
+  {
+    return data_sptr->remove_property_map (map.get_data());
+  }
+
+  bool has_float32_map (const std::string& name)
+  {
+    return data_sptr->template has_property_map<float>(name);
+  }
+  Float32_map add_float32_map (const std::string& name, double default_value = 0.0)
+  {
+    return Float32_map(data_sptr->template add_property_map<float>
+                       (name, static_cast<float>(default_value)));
+  }
+  Float32_map float32_map (const std::string& name)
+  {
+    return Float32_map(data_sptr->template property_map<float>(name));
+  }
+  bool remove_float32_map (Float32_map map)
+  {
+    return data_sptr->remove_property_map (map.get_data());
+  }
+
   SWIG_CGAL_FORWARD_CALL_0(bool, has_normal_map)
   Vector_map add_normal_map() { return Vector_map (data_sptr->add_normal_map()); }
   Vector_map normal_map() { return Vector_map(data_sptr->normal_map(), data_sptr->has_normal_map()); }
@@ -185,8 +478,56 @@ public:
   Point_iterator points() const { return Point_iterator (get_data().points().begin(), get_data().points().end()); }
   Vector_iterator normals() const { return Vector_iterator (get_data().normals().begin(), get_data().normals().end()); }
 
+  // Zero-copy (N,3) views of the point and normal storage. Rows are indexed
+  // like point() and normal(): removed points keep their row until
+  // collect_garbage() is called. A view is invalidated by any operation that
+  // changes the number of items stored (insert, resize, collect_garbage...).
+  SWIG_CGAL::Buffer<double> point_array() { return coordinate_array (data_sptr->point_map()); }
+  SWIG_CGAL::Buffer<double> normal_array()
+  {
+    if (!data_sptr->has_normal_map())
+      return SWIG_CGAL::Buffer<double>();
+    return coordinate_array (data_sptr->normal_map());
+  }
+  // write the values of point_array() (resp. normal_array()) in `out`, e.g.
+  // a direct java.nio buffer
+  void write_point_array (SWIG_CGAL::Buffer<double> out)
+  {
+    write_coordinates (point_array(), out, "point array");
+  }
+  void write_normal_array (SWIG_CGAL::Buffer<double> out)
+  {
+    if (!data_sptr->has_normal_map())
+      throw std::invalid_argument("The point set has no normal map");
+    write_coordinates (normal_array(), out, "normal array");
+  }
+
+  // Binary state, in the columnar format of write() with the .ps3 extension
+  // (the properties of other types are not stored). Loaded from shared
+  // memory, the columns are copied from the pages of the segment.
+#ifndef SWIG
+  void write_state (std::ostream& os)
+  {
+    if (!SWIG_Point_set_3::write_columnar_point_set (os, *data_sptr))
+      throw std::runtime_error("Cannot write the binary state of a Point_set_3");
+  }
+  void read_state (const char* data, std::size_t size,
+                   const std::shared_ptr<boost::interprocess::mapped_region>& region)
+  {
+    SWIG_Point_set_3::Columnar_file (data, size, region, "binary state").load (*data_sptr);
+  }
+#endif
+  SWIG_CGAL_BINARY_STATE_FUNCTIONS
+
   void read (const std::string& file)
   {
+    if (file.size() > 4 && (file.compare (file.size() - 4, 4, ".ps3") == 0
+                            || file.compare (file.size() - 4, 4, ".psz") == 0))
+    {
+      // columnar file: mapped and copied column by column, no parsing
+      SWIG_Point_set_3::Columnar_file (file).load (*data_sptr);
+      return;
+    }
     std::ifstream ifile (file, std::ios_base::binary);
     ifile >> *data_sptr;
     convert_input_properties();
@@ -210,25 +551,23 @@ public:
       ofile.precision(18);
       return CGAL::write_off_point_set (ofile, *data_sptr);
     }
+    if (extension == "ps3")
+      return SWIG_Point_set_3::write_columnar_point_set (ofile, *data_sptr);
+    if (extension == "psz")
+      return SWIG_Point_set_3::write_columnar_point_set (ofile, *data_sptr, true);
     if (extension == "ply")
-    {
-      convert_ply_output_properties();
-      CGAL::set_binary_mode(ofile);
-      bool out = CGAL::write_ply_point_set (ofile, *data_sptr);
-      convert_input_properties();
-      return out;
-    }
+      return SWIG_Point_set_3::write_binary_ply_point_set (ofile, *data_sptr);
 #ifdef CGAL_LINKED_WITH_LASLIB
     if (extension == "las")
     {
-      convert_las_output_properties();
+      const std::vector<std::string> narrowed = convert_las_output_properties();
       bool out = CGAL::write_las_point_set (ofile, *data_sptr);
-      convert_input_properties();
+      widen_properties (narrowed);
       return out;
     }
-    std::cerr << "Error: unknown extension " << extension << ", possible values are xyz, off, ply or las" << std::endl;
+    std::cerr << "Error: unknown extension " << extension << ", possible values are xyz, off, ply, ps3, psz or las" << std::endl;
 #else
-    std::cerr << "Error: unknown extension " << extension << ", possible values are xyz, off or ply" << std::endl;
+    std::cerr << "Error: unknown extension " << extension << ", possible values are xyz, off, ply, ps3 or psz" << std::endl;
 #endif
 
     return false;
@@ -236,6 +575,269 @@ public:
 
 private:
 
+  // Stores the points of `order` at the beginning of the property arrays,
+  // in this order, the arrays being processed in parallel, and drops the
+  // others. Returns false, changing nothing, if a property has a type
+  // unknown to the bindings.
+  bool gather_points (const std::vector<typename Point_set_base::Index>& order)
+  {
+    typedef typename Point_set_base::Index Index;
+    std::vector<std::function<void()> > tasks;
+    for (const std::string& name : data_sptr->properties())
+      if (name != "index" &&
+          !gather_property<bool, char, signed char, unsigned char, short, unsigned short,
+                           int, unsigned int, long, unsigned long, long long, unsigned long long,
+                           float, double, typename Point_3::cpp_base,
+                           typename Vector_3::cpp_base> (name, order, tasks))
+        return false;
+    auto opt_index = data_sptr->template property_map<Index>("index");
+#if CGAL_VERSION_NR >= 1060000000
+    if (!opt_index)
+      return false;
+    typename Point_set_base::template Property_map<Index> index = *opt_index;
+#else
+    if (!opt_index.second)
+      return false;
+    typename Point_set_base::template Property_map<Index> index = opt_index.first;
+#endif
+
+    run_tasks (tasks);
+    // the points are now stored in the order of the iteration
+    const std::size_t storage = storage_size();
+    for (std::size_t i = 0; i < storage; ++ i)
+      index[Index(i)] = Index(i);
+    data_sptr->cancel_removals();
+    data_sptr->resize (order.size());
+    return true;
+  }
+
+  static void run_tasks (const std::vector<std::function<void()> >& tasks)
+  {
+    CGAL::for_each<SWIG_Point_set_3::Concurrency_tag>
+      (tasks, [](const std::function<void()>& task) -> bool
+       {
+         task();
+         return true;
+       });
+  }
+
+  // adds to `tasks` the copy of the values of the points `rows` of `source`
+  // to the points first, first+1... of this set, for all the properties of
+  // this set that `source` has. Returns false if one of them has a type
+  // unknown to the bindings.
+  bool copy_properties_from (Point_set_base& source,
+                             const std::vector<typename Point_set_base::Index>& rows,
+                             std::size_t first,
+                             std::vector<std::function<void()> >& tasks)
+  {
+    for (const std::string& name : data_sptr->properties())
+      if (name != "index" &&
+          !copy_property<bool, char, signed char, unsigned char, short, unsigned short,
+                         int, unsigned int, long, unsigned long, long long, unsigned long long,
+                         float, double, typename Point_3::cpp_base,
+                         typename Vector_3::cpp_base> (source, name, rows, first, tasks))
+        return false;
+    return true;
+  }
+
+  // the size of the values of the property `name`, if their type is one of T...
+  template <typename T>
+  bool property_value_size (const std::string& name, std::size_t& value_size) const
+  {
+    if (!data_sptr->template has_property_map<T>(name))
+      return false;
+    value_size = sizeof(T);
+    return true;
+  }
+  template <typename T, typename U, typename ... Tail>
+  bool property_value_size (const std::string& name, std::size_t& value_size) const
+  {
+    return property_value_size<T> (name, value_size)
+      || property_value_size<U, Tail...> (name, value_size);
+  }
+
+  // the map `name` of `set` if its values have the type T
+  template <typename T>
+  static bool find_map (Point_set_base& set, const std::string& name,
+                        typename Point_set_base::template Property_map<T>& map)
+  {
+    auto opt_map = set.template property_map<T>(name);
+#if CGAL_VERSION_NR >= 1060000000
+    if (!opt_map)
+      return false;
+    map = *opt_map;
+#else
+    if (!opt_map.second)
+      return false;
+    map = opt_map.first;
+#endif
+    return true;
+  }
+
+  // adds to `tasks` the copy of the property `name` for copy_properties_from(),
+  // if its type is T (nothing to copy if `source` does not have it)
+  template <typename T>
+  bool copy_property (Point_set_base& source, const std::string& name,
+                      const std::vector<typename Point_set_base::Index>& rows,
+                      std::size_t first, std::vector<std::function<void()> >& tasks)
+  {
+    typedef typename Point_set_base::Index Index;
+    typename Point_set_base::template Property_map<T> target, values;
+    if (!find_map<T> (*data_sptr, name, target))
+      return false;
+    if (!source.template has_property_map<T>(name))
+      return true;
+    find_map<T> (source, name, values);
+    tasks.push_back ([target, values, &rows, first]() mutable
+                     {
+                       for (std::size_t k = 0; k < rows.size(); ++ k)
+                         target[Index(first + k)] = values[rows[k]];
+                     });
+    return true;
+  }
+  template <typename T, typename U, typename ... Tail>
+  bool copy_property (Point_set_base& source, const std::string& name,
+                      const std::vector<typename Point_set_base::Index>& rows,
+                      std::size_t first, std::vector<std::function<void()> >& tasks)
+  {
+    return copy_property<T> (source, name, rows, first, tasks)
+      || copy_property<U, Tail...> (source, name, rows, first, tasks);
+  }
+
+  // adds to `tasks` the gathering of the values of the points of `order` at
+  // the beginning of the property array `name`, if its type is one of T...
+  template <typename T>
+  bool gather_property (const std::string& name,
+                        const std::vector<typename Point_set_base::Index>& order,
+                        std::vector<std::function<void()> >& tasks)
+  {
+    typedef typename Point_set_base::Index Index;
+    auto opt_map = data_sptr->template property_map<T>(name);
+#if CGAL_VERSION_NR >= 1060000000
+    if (!opt_map)
+      return false;
+    typename Point_set_base::template Property_map<T> map = *opt_map;
+#else
+    if (!opt_map.second)
+      return false;
+    typename Point_set_base::template Property_map<T> map = opt_map.first;
+#endif
+    tasks.push_back ([map, &order]() mutable
+                     {
+                       std::vector<T> values;
+                       values.reserve (order.size());
+                       for (const Index& i : order)
+                         values.push_back (map[i]);
+                       for (std::size_t k = 0; k < values.size(); ++ k)
+                         map[Index(k)] = values[k];
+                     });
+    return true;
+  }
+  template <typename T, typename U, typename ... Tail>
+  bool gather_property (const std::string& name,
+                        const std::vector<typename Point_set_base::Index>& order,
+                        std::vector<std::function<void()> >& tasks)
+  {
+    return gather_property<T> (name, order, tasks)
+      || gather_property<U, Tail...> (name, order, tasks);
+  }
+
+  // the k-th point of the set is the point of index *(begin()+k), which is
+  // k unless points were removed
+  template <typename Region>
+  SWIG_CGAL::Buffer<int> indices_in_region (const Region& region) const
+  {
+    const Point_set_base& data = *data_sptr;
+    const typename Point_set_base::Point_map points = data.point_map();
+    const typename Point_set_base::const_iterator first = data.begin();
+    std::vector<int> found = SWIG_Point_set_3::positions_in_region<SWIG_Point_set_3::Concurrency_tag>
+      (std::size_t(data.size()),
+       [&](std::size_t k) { return reinterpret_cast<const double*>(&points[*(first + k)]); },
+       region);
+    if (data.has_garbage())
+      for (int& k : found)
+        k = int(*(first + k));
+    return SWIG_CGAL::Buffer<int>(std::move(found));
+  }
+
+  // number of items in the property arrays, including removed points
+  std::size_t storage_size() const
+  {
+    return std::size_t(data_sptr->size() + data_sptr->garbage_size());
+  }
+
+  // collects garbage and makes room for the points of `points`,
+  // returns the index of the first new point
+  std::size_t resize_for_arrays (const SWIG_CGAL::Buffer<double>& points)
+  {
+    if (points.size() % 3 != 0)
+      throw std::invalid_argument("Coordinate arrays must contain 3 values per point");
+    if (data_sptr->has_garbage())
+      data_sptr->collect_garbage();
+    std::size_t first = storage_size();
+    data_sptr->resize (first + points.size() / 3);
+    return first;
+  }
+
+  template <typename Map>
+  void copy_array (Map map, const SWIG_CGAL::Buffer<double>& values, std::size_t first)
+  {
+    typedef typename boost::property_traits<Map>::value_type Value;
+    static_assert(sizeof(Value) == 3 * sizeof(double),
+                  "coordinates must be stored as 3 contiguous doubles");
+    if (values.empty())
+      return;
+    Value& target = map[typename Point_set_base::Index(first)];
+    std::memcpy (&target, values.data(), values.size() * sizeof(double));
+  }
+
+  template <typename T>
+  bool copy_to_property (const std::string& name, const SWIG_CGAL::Buffer<T>& values)
+  {
+    if (values.size() != storage_size())
+      return false;
+    typename Point_set_base::template Property_map<T> map
+      = data_sptr->template add_property_map<T>(name, T()).first;
+    if (!values.empty())
+      std::memcpy (&(map[typename Point_set_base::Index(0)]), values.data(),
+                   values.size() * sizeof(T));
+    return true;
+  }
+
+  template <typename T, typename Map>
+  SWIG_CGAL::Buffer<T> property_view (Map map)
+  {
+    if (!map.is_valid())
+      throw std::invalid_argument("Invalid property map");
+    if (storage_size() == 0)
+      return SWIG_CGAL::Buffer<T>(nullptr, 0, 1, data_sptr);
+    T& first = map.get_data()[typename Point_set_base::Index(0)];
+    return SWIG_CGAL::Buffer<T>(&first, storage_size(), 1, data_sptr);
+  }
+
+  template <typename Map>
+  SWIG_CGAL::Buffer<double> coordinate_array (Map map)
+  {
+    typedef typename boost::property_traits<Map>::value_type Value;
+    static_assert(sizeof(Value) == 3 * sizeof(double),
+                  "coordinates must be stored as 3 contiguous doubles");
+    if (storage_size() == 0)
+      return SWIG_CGAL::Buffer<double>(nullptr, 0, 3, data_sptr);
+    Value& first = map[typename Point_set_base::Index(0)];
+    return SWIG_CGAL::Buffer<double>(reinterpret_cast<double*>(&first),
+                                     storage_size(), 3, data_sptr);
+  }
+
+  static void write_coordinates (const SWIG_CGAL::Buffer<double>& in,
+                                 SWIG_CGAL::Buffer<double>& out, const char* what)
+  {
+    SWIG_CGAL::check_output_buffer (out, in.size(), what);
+    if (!in.empty())
+      std::memcpy (out.data(), in.data(), in.size() * sizeof(double));
+  }
+
+  // the types without maps in the bindings are widened to int or double,
+  // uint8, uint16 and float properties keep the type of the file
   void convert_input_properties()
   {
     std::vector<std::string> properties = data_sptr->properties();
@@ -245,69 +847,52 @@ private:
         continue;
       if (convert_map<signed char, int>(p))
         continue;
-      if (convert_map<unsigned char, int>(p))
-        continue;
       if (convert_map<short, int>(p))
         continue;
-      if (convert_map<unsigned short, int>(p))
-        continue;
       if (convert_map<unsigned int, int>(p))
         continue;
-      if (convert_map<float, double>(p))
-        continue;
     }
   }
 
-  void convert_ply_output_properties()
+  // narrows the int/double LAS attributes to the types expected by the LAS
+  // writer, returns the names of the properties converted
+  std::vector<std::string> convert_las_output_properties()
   {
     std::vector<std::string> properties = data_sptr->properties();
+    std::vector<std::string> out;
     for (const std::string& p : properties)
-      if (p == "R" || p == "r" || p == "red" ||
-          p == "G" || p == "g" || p == "green" ||
-          p == "B" || p == "b" || p == "blue" ||
-          p == "A" || p == "a" || p == "alpha")
-        convert_map<int, unsigned char>(p);
+    {
+      bool converted = false;
+      if (p == "intensity" || p == "point_source_ID"
+          || p == "R" || p == "G" || p == "B" || p == "I")
+        converted = convert_map<int, unsigned short>(p);
+      else if (p == "return_number" || p == "number_of_returns"
+               || p == "scan_direction_flag" || p == "edge_of_flight_line"
+               || p == "classification" || p == "synthetic_flag" || p == "keypoint_flag"
+               || p == "withheld_flag" || p == "user_data")
+        converted = convert_map<int, unsigned char>(p);
+      else if (p == "scan_angle")
+        converted = convert_map<double, float>(p);
+      else if (p == "deleted_flag")
+        converted = convert_map<int, unsigned int>(p);
+      if (converted)
+        out.push_back (p);
+    }
+    return out;
   }
 
-  void convert_las_output_properties()
+  // restores the types of the properties narrowed for an output
+  void widen_properties (const std::vector<std::string>& names)
   {
-    std::vector<std::string> properties = data_sptr->properties();
-    for (const std::string& p : properties)
+    for (const std::string& p : names)
     {
-      if (p == "intensity")
-        convert_map<int, unsigned short>(p);
-      else if (p == "return_number")
-        convert_map<int, unsigned char>(p);
-      else if (p == "number_of_returns")
-        convert_map<int, unsigned char>(p);
-      else if (p == "scan_direction_flag")
-        convert_map<int, unsigned char>(p);
-      else if (p == "edge_of_flight_line")
-        convert_map<int, unsigned char>(p);
-      else if (p == "classification")
-        convert_map<int, unsigned char>(p);
-      else if (p == "synthetic_flag")
-        convert_map<int, unsigned char>(p);
-      else if (p == "keypoint_flag")
-        convert_map<int, unsigned char>(p);
-      else if (p == "withheld_flag")
-        convert_map<int, unsigned char>(p);
-      else if (p == "scan_angle")
-        convert_map<double, float>(p);
-      else if (p == "user_data")
-        convert_map<int, unsigned char>(p);
-      else if (p == "point_source_ID")
-        convert_map<int, unsigned short>(p);
-      else if (p == "deleted_flag")
-        convert_map<int, unsigned int>(p);
-      else if (p == "R")
-        convert_map<int, unsigned short>(p);
-      else if (p == "G")
-        convert_map<int, unsigned short>(p);
-      else if (p == "B")
-        convert_map<int, unsigned short>(p);
-      else if (p == "I")
-        convert_map<int, unsigned short>(p);
+      if (convert_map<unsigned char, int>(p))
+        continue;
+      if (convert_map<unsigned short, int>(p))
+        continue;
+      if (convert_map<unsigned int, int>(p))
+        continue;
+      convert_map<float, double>(p);
     }
   }
 
@@ -328,14 +913,19 @@ private:
     if (!okay)
       return false;
 
-    for (typename Point_set_base::Index idx : *data_sptr)
 #if CGAL_VERSION_NR >= 1060000000
-      omap[idx] = static_cast<Output>((*opt_imap)[idx]);
-    data_sptr->remove_property_map(*opt_imap);
+    typename Point_set_base::template Property_map<Input> imap = *opt_imap;
 #else
-      omap[idx] = static_cast<Output>(opt_imap.first[idx]);
-    data_sptr->remove_property_map(opt_imap.first);
+    typename Point_set_base::template Property_map<Input> imap = opt_imap.first;
 #endif
+    // each index is written once: the copy runs in parallel when TBB is available
+    CGAL::for_each<SWIG_Point_set_3::Concurrency_tag>
+      (*data_sptr, [&](const typename Point_set_base::Index& idx) -> bool
+       {
+         omap[idx] = static_cast<Output>(imap[idx]);
+         return true;
+       });
+    data_sptr->remove_property_map(imap);
     return true;
   }
 
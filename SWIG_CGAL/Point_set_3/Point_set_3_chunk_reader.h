@@ -0,0 +1,404 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+
+#ifndef SWIG_CGAL_POINT_SET_3_POINT_SET_3_CHUNK_READER_H
+#define SWIG_CGAL_POINT_SET_3_POINT_SET_3_CHUNK_READER_H
+
+#include <SWIG_CGAL/Point_set_3/typedefs.h>
+#include <SWIG_CGAL/Point_set_3/Point_set_3.h>
+
+#include <CGAL/IO/PLY/PLY_reader.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#ifndef SWIG
+namespace SWIG_Point_set_3
+{
+
+namespace PLY_internal = CGAL::IO::internal;
+
+// reads the current value of a PLY property of known type
+typedef double (*Ply_number_getter)(const PLY_internal::PLY_read_number*);
+
+template <typename T>
+double ply_number (const PLY_internal::PLY_read_number* property)
+{
+  return double(static_cast<const PLY_internal::PLY_read_typed_number<T>*>(property)->buffer());
+}
+
+// storage type of a property read from a PLY property of type T, as
+// with Point_set_3::read(): 'b' for uint8, 'w' for uint16, 'f' for float,
+// 'd' for double and 'i' (int) for the other integral types
+template <typename T>
+char ply_storage_type()
+{
+  if (std::is_same<T, std::uint8_t>::value)
+    return 'b';
+  if (std::is_same<T, std::uint16_t>::value)
+    return 'w';
+  if (std::is_same<T, float>::value)
+    return 'f';
+  if (std::is_same<T, double>::value)
+    return 'd';
+  return 'i';
+}
+
+template <typename T>
+bool ply_resolve_number (PLY_internal::PLY_read_number* property,
+                         Ply_number_getter& getter, char& storage)
+{
+  if (dynamic_cast<PLY_internal::PLY_read_typed_number<T>*>(property) == nullptr)
+    return false;
+  getter = &ply_number<T>;
+  storage = ply_storage_type<T>();
+  return true;
+}
+
+} // namespace SWIG_Point_set_3
+#endif
+
+// Reads a point set file by blocks of at most `chunk_size` points, so that
+// only one block is in memory at a time. Supported formats are PLY (ASCII
+// and binary), XYZ and LAS (if linked with LASlib). Properties get the same
+// types as with Point_set_3::read(): uint8, uint16 and float values keep
+// their type, other integral values are stored in int maps and double
+// values in double maps.
+template <typename Point_set_base>
+class Point_set_3_chunk_reader
+{
+public:
+  typedef Point_set_3_wrapper<Point_set_base> Point_set;
+
+private:
+  typedef typename Point_set_base::Index Index;
+  typedef typename Point_set_base::Point Point;
+  typedef typename Point_set_base::Vector Vector;
+  typedef typename Point_set_base::template Property_map<int> Int_pmap;
+  typedef typename Point_set_base::template Property_map<double> Double_pmap;
+  typedef typename Point_set_base::template Property_map<unsigned char> Uint8_pmap;
+  typedef typename Point_set_base::template Property_map<unsigned short> Uint16_pmap;
+  typedef typename Point_set_base::template Property_map<float> Float_pmap;
+
+  enum Format { PLY_FORMAT, XYZ_FORMAT, LAS_FORMAT };
+
+  // role of a property of the PLY vertex element
+  struct Ply_column
+  {
+    std::string name;
+    int coordinate;  // 0..2 for the point, 3..5 for the normal, -1 otherwise
+    char storage;  // see SWIG_Point_set_3::ply_storage_type()
+    SWIG_Point_set_3::Ply_number_getter getter;  // nullptr for list properties
+  };
+
+  std::shared_ptr<std::ifstream> m_stream;
+  std::size_t m_chunk_size;
+  Format m_format;
+  bool m_has_normals;
+  bool m_done;
+
+  std::shared_ptr<SWIG_Point_set_3::PLY_internal::PLY_reader> m_ply;
+  SWIG_Point_set_3::PLY_internal::PLY_element* m_ply_vertices;
+  std::size_t m_ply_remaining;
+  std::vector<Ply_column> m_ply_columns;
+
+  std::string m_xyz_line;  // first data line of the file, not yet inserted
+
+#ifdef CGAL_LINKED_WITH_LASLIB
+  std::shared_ptr<LASreaderLAS> m_las;
+#endif
+
+public:
+
+  Point_set_3_chunk_reader (const std::string& file, int chunk_size)
+    : m_stream (new std::ifstream (file, std::ios_base::binary))
+    , m_chunk_size (std::size_t(std::max (chunk_size, 1)))
+    , m_has_normals (false)
+    , m_done (false)
+    , m_ply_vertices (nullptr)
+    , m_ply_remaining (0)
+  {
+    if (!*m_stream)
+      throw std::runtime_error("Cannot open " + file);
+
+    std::string extension = (file.size() < 3 ? file : file.substr (file.size() - 3));
+    std::transform(extension.begin(), extension.end(), extension.begin(),
+                   [](unsigned char c){ return std::tolower(c); });
+
+    if (extension == "ply")
+      init_ply (file);
+    else if (extension == "xyz")
+      init_xyz();
+#ifdef CGAL_LINKED_WITH_LASLIB
+    else if (extension == "las")
+      init_las (file);
+    else
+      throw std::runtime_error("Unknown extension " + extension + ", possible values are xyz, ply or las");
+#else
+    else
+      throw std::runtime_error("Unknown extension " + extension + ", possible values are xyz or ply");
+#endif
+  }
+
+  int chunk_size() const { return int(m_chunk_size); }
+  bool has_normal_map() const { return m_has_normals; }
+  bool is_done() const { return m_done; }
+
+  // Returns the next block of points, or an empty point set at the end of the file
+  Point_set next()
+  {
+    Point_set out (m_has_normals);
+    if (m_done)
+      return out;
+
+    out.get_data().reserve (m_chunk_size);
+    if (m_format == PLY_FORMAT)
+      read_ply (out.get_data());
+    else if (m_format == XYZ_FORMAT)
+      read_xyz (out.get_data());
+#ifdef CGAL_LINKED_WITH_LASLIB
+    else
+      read_las (out.get_data());
+#endif
+
+    if (out.get_data().empty())
+      m_done = true;
+    return out;
+  }
+
+private:
+
+  void init_ply (const std::string& file)
+  {
+    namespace PLY = SWIG_Point_set_3::PLY_internal;
+
+    m_format = PLY_FORMAT;
+    m_ply = std::make_shared<PLY::PLY_reader>(false);
+    if (!m_ply->init (*m_stream))
+      throw std::runtime_error("Cannot read the PLY header of " + file);
+
+    for (std::size_t i = 0; i < m_ply->number_of_elements(); ++ i)
+    {
+      PLY::PLY_element& element = m_ply->element(i);
+      if (element.name() == "vertex" || element.name() == "vertices")
+      {
+        m_ply_vertices = &element;
+        break;
+      }
+      // elements stored before the vertices are skipped
+      for (std::size_t j = 0; j < element.number_of_items(); ++ j)
+        for (std::size_t k = 0; k < element.number_of_properties(); ++ k)
+          element.property(k)->get (*m_stream);
+    }
+    if (m_ply_vertices == nullptr)
+    {
+      m_done = true;
+      return;
+    }
+    m_ply_remaining = m_ply_vertices->number_of_items();
+
+    static const char* coordinates[] = { "x", "y", "z", "nx", "ny", "nz" };
+    for (std::size_t k = 0; k < m_ply_vertices->number_of_properties(); ++ k)
+    {
+      PLY::PLY_read_number* property = m_ply_vertices->property(k);
+      Ply_column column;
+      column.name = property->name();
+      column.coordinate = -1;
+      for (int c = 0; c < 6; ++ c)
+        if (column.name == coordinates[c])
+          column.coordinate = c;
+      column.getter = nullptr;
+      column.storage = 'd';
+      SWIG_Point_set_3::ply_resolve_number<std::int8_t>(property, column.getter, column.storage)
+        || SWIG_Point_set_3::ply_resolve_number<std::uint8_t>(property, column.getter, column.storage)
+        || SWIG_Point_set_3::ply_resolve_number<std::int16_t>(property, column.getter, column.storage)
+        || SWIG_Point_set_3::ply_resolve_number<std::uint16_t>(property, column.getter, column.storage)
+        || SWIG_Point_set_3::ply_resolve_number<std::int32_t>(property, column.getter, column.storage)
+        || SWIG_Point_set_3::ply_resolve_number<std::uint32_t>(property, column.getter, column.storage)
+        || SWIG_Point_set_3::ply_resolve_number<float>(property, column.getter, column.storage)
+        || SWIG_Point_set_3::ply_resolve_number<double>(property, column.getter, column.storage);
+      if (column.coordinate >= 3)
+        m_has_normals = true;
+      m_ply_columns.push_back (column);
+    }
+  }
+
+  void read_ply (Point_set_base& point_set)
+  {
+    std::vector<Int_pmap> int_maps (m_ply_columns.size());
+    std::vector<Double_pmap> double_maps (m_ply_columns.size());
+    std::vector<Uint8_pmap> uint8_maps (m_ply_columns.size());
+    std::vector<Uint16_pmap> uint16_maps (m_ply_columns.size());
+    std::vector<Float_pmap> float_maps (m_ply_columns.size());
+    for (std::size_t k = 0; k < m_ply_columns.size(); ++ k)
+    {
+      const Ply_column& column = m_ply_columns[k];
+      if (column.coordinate != -1 || column.getter == nullptr)
+        continue;
+      if (column.storage == 'i')
+        int_maps[k] = point_set.template add_property_map<int>(column.name, 0).first;
+      else if (column.storage == 'b')
+        uint8_maps[k] = point_set.template add_property_map<unsigned char>(column.name, 0).first;
+      else if (column.storage == 'w')
+        uint16_maps[k] = point_set.template add_property_map<unsigned short>(column.name, 0).first;
+      else if (column.storage == 'f')
+        float_maps[k] = point_set.template add_property_map<float>(column.name, 0.f).first;
+      else
+        double_maps[k] = point_set.template add_property_map<double>(column.name, 0.).first;
+    }
+
+    double coordinates[6] = { 0., 0., 0., 0., 0., 0. };
+    for (std::size_t n = 0; n < m_chunk_size && m_ply_remaining != 0; ++ n, -- m_ply_remaining)
+    {
+      for (std::size_t k = 0; k < m_ply_columns.size(); ++ k)
+      {
+        m_ply_vertices->property(k)->get (*m_stream);
+        if (m_stream->fail())
+          throw std::runtime_error("Truncated PLY file");
+      }
+
+      Index idx = *(point_set.insert());
+      for (std::size_t k = 0; k < m_ply_columns.size(); ++ k)
+      {
+        const Ply_column& column = m_ply_columns[k];
+        if (column.getter == nullptr)
+          continue;
+        double value = column.getter (m_ply_vertices->property(k));
+        if (column.coordinate != -1)
+          coordinates[column.coordinate] = value;
+        else if (column.storage == 'i')
+          int_maps[k][idx] = int(value);
+        else if (column.storage == 'b')
+          uint8_maps[k][idx] = static_cast<unsigned char>(value);
+        else if (column.storage == 'w')
+          uint16_maps[k][idx] = static_cast<unsigned short>(value);
+        else if (column.storage == 'f')
+          float_maps[k][idx] = static_cast<float>(value);
+        else
+          double_maps[k][idx] = value;
+      }
+      point_set.point(idx) = Point (coordinates[0], coordinates[1], coordinates[2]);
+      if (m_has_normals)
+        point_set.normal(idx) = Vector (coordinates[3], coordinates[4], coordinates[5]);
+    }
+  }
+
+  void init_xyz()
+  {
+    m_format = XYZ_FORMAT;
+    // the first data line tells if the file has normals
+    while (std::getline (*m_stream, m_xyz_line))
+    {
+      if (is_xyz_data (m_xyz_line))
+      {
+        std::istringstream iss (m_xyz_line);
+        double v[6];
+        m_has_normals = bool(iss >> v[0] >> v[1] >> v[2] >> v[3] >> v[4] >> v[5]);
+        return;
+      }
+    }
+    m_xyz_line.clear();
+  }
+
+  static bool is_xyz_data (const std::string& line)
+  {
+    std::size_t first = line.find_first_not_of (" \t\r");
+    return first != std::string::npos && line[first] != '#';
+  }
+
+  void read_xyz (Point_set_base& point_set)
+  {
+    std::string line;
+    std::size_t n = 0;
+    while (n < m_chunk_size)
+    {
+      if (!m_xyz_line.empty())
+        std::swap (line, m_xyz_line);
+      else if (!std::getline (*m_stream, line))
+        break;
+      if (!is_xyz_data (line))
+        continue;
+
+      std::istringstream iss (line);
+      double x, y, z, nx = 0., ny = 0., nz = 0.;
+      if (!(iss >> x >> y >> z))
+        throw std::runtime_error("Cannot read XYZ line: " + line);
+      if (m_has_normals)
+      {
+        iss >> nx >> ny >> nz;
+        point_set.insert (Point (x, y, z), Vector (nx, ny, nz));
+      }
+      else
+        point_set.insert (Point (x, y, z));
+      line.clear();
+      ++ n;
+    }
+  }
+
+#ifdef CGAL_LINKED_WITH_LASLIB
+  void init_las (const std::string& file)
+  {
+    m_format = LAS_FORMAT;
+    m_las = std::make_shared<LASreaderLAS>();
+    if (!m_las->open (*m_stream))
+      throw std::runtime_error("Cannot read the LAS header of " + file);
+  }
+
+  void read_las (Point_set_base& point_set)
+  {
+    // same types as the LAS reader of CGAL
+    static const char* uint8_names[] = {
+      "return_number", "number_of_returns", "scan_direction_flag", "edge_of_flight_line",
+      "classification", "synthetic_flag", "keypoint_flag", "withheld_flag", "user_data" };
+    static const char* uint16_names[] = { "intensity", "point_source_ID", "R", "G", "B", "I" };
+    const LASpoint& p = m_las->point;
+    const std::size_t nb_uint16 = p.have_nir ? 6 : (p.have_rgb ? 5 : 2);
+
+    Uint8_pmap uint8_maps[9];
+    for (std::size_t i = 0; i < 9; ++ i)
+      uint8_maps[i] = point_set.template add_property_map<unsigned char>(uint8_names[i], 0).first;
+    Uint16_pmap uint16_maps[6];
+    for (std::size_t i = 0; i < nb_uint16; ++ i)
+      uint16_maps[i] = point_set.template add_property_map<unsigned short>(uint16_names[i], 0).first;
+    Float_pmap scan_angle = point_set.template add_property_map<float>("scan_angle", 0.f).first;
+    Double_pmap gps_time;
+    if (p.have_gps_time)
+      gps_time = point_set.template add_property_map<double>("gps_time", 0.).first;
+
+    for (std::size_t n = 0; n < m_chunk_size && m_las->read_point(); ++ n)
+    {
+      Index idx = *(point_set.insert (Point (p.get_x(), p.get_y(), p.get_z())));
+      const unsigned char uint8_values[9] = {
+        (unsigned char)(p.get_return_number()), (unsigned char)(p.get_number_of_returns()),
+        (unsigned char)(p.get_scan_direction_flag()), (unsigned char)(p.get_edge_of_flight_line()),
+        (unsigned char)(p.get_classification()), (unsigned char)(p.get_synthetic_flag()),
+        (unsigned char)(p.get_keypoint_flag()), (unsigned char)(p.get_withheld_flag()),
+        (unsigned char)(p.get_user_data()) };
+      const unsigned short uint16_values[6] = {
+        (unsigned short)(p.get_intensity()), (unsigned short)(p.get_point_source_ID()),
+        (unsigned short)(p.rgb[0]), (unsigned short)(p.rgb[1]), (unsigned short)(p.rgb[2]),
+        (unsigned short)(p.rgb[3]) };
+      for (std::size_t i = 0; i < 9; ++ i)
+        uint8_maps[i][idx] = uint8_values[i];
+      for (std::size_t i = 0; i < nb_uint16; ++ i)
+        uint16_maps[i][idx] = uint16_values[i];
+      scan_angle[idx] = float(p.get_scan_angle_rank());
+      if (p.have_gps_time)
+        gps_time[idx] = p.get_gps_time();
+    }
+  }
+#endif
+};
+
+#endif // SWIG_CGAL_POINT_SET_3_POINT_SET_3_CHUNK_READER_H
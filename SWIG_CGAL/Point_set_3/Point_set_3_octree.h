@@ -0,0 +1,310 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+
+#ifndef SWIG_CGAL_POINT_SET_3_POINT_SET_3_OCTREE_H
+#define SWIG_CGAL_POINT_SET_3_POINT_SET_3_OCTREE_H
+
+#include <SWIG_CGAL/Common/Buffer.h>
+#include <SWIG_CGAL/Common/Space_filling_curve.h>
+#include <SWIG_CGAL/Point_set_3/Point_set_3.h>
+#include <SWIG_CGAL/Point_set_3/Region_queries.h>
+#include <SWIG_CGAL/Point_set_3/typedefs.h>
+
+#include <CGAL/for_each.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Octree over the points of a Point_set_3 for level-of-detail streaming.
+// The points are sorted in Morton order inside the bounding cube of the
+// point set, so that the points of each node are a range of index_array().
+// A node is split in its non-empty octants while it has more than
+// max_points_per_node points, down to max_depth. The nodes are numbered
+// level by level (the root is 0), the children of a node being contiguous.
+// Each node also has representative samples: the first point of each
+// non-empty cell of a grid of 2^sample_depth cells per side over the node,
+// as the points kept by grid_simplify_point_set() at this resolution.
+// With `reorder`, the point set itself is permuted to this order, and the
+// ranges index its points directly (index_array() is then 0,1,2...).
+class Point_set_3_octree
+{
+#ifndef SWIG
+  struct Data
+  {
+    SWIG_CGAL::Curve_cube cube;
+    std::vector<int> indices;       // point indices in Morton order
+    std::vector<int> depths;        // per node
+    std::vector<int> parents;       // per node, -1 for the root
+    std::vector<int> child_ranges;  // 2 per node: [first, end) children
+    std::vector<int> point_ranges;  // 2 per node: [begin, end) in indices
+    std::vector<int> coordinates;   // 3 per node: integer coordinates at its depth
+    std::vector<int> sample_offsets;// samples of node v: [offsets[v], offsets[v+1])
+    std::vector<int> samples;       // point indices
+  };
+
+  std::shared_ptr<Data> data_sptr;
+
+  template <class T>
+  SWIG_CGAL::Buffer<T> view (const std::vector<T>& v, std::size_t cols) const
+  {
+    return SWIG_CGAL::Buffer<T>(const_cast<T*>(v.data()), v.size() / cols, cols, data_sptr, true);
+  }
+
+  void node_box (std::size_t v, double* lo, double* hi) const
+  {
+    const Data& data = *data_sptr;
+    const double side = data.cube.extent / double(std::uint64_t(1) << data.depths[v]);
+    for (int i = 0; i < 3; ++i)
+    {
+      lo[i] = data.cube.min[i] + side * data.coordinates[3 * v + i];
+      hi[i] = data.cube.min[i] + side * (data.coordinates[3 * v + i] + 1);
+    }
+  }
+
+  // Indices of the points of `point_set` in `region`: the nodes outside are
+  // skipped, the ones inside copied, and the points of the leaves crossing
+  // it tested, by chunks processed concurrently.
+  template <class Region>
+  SWIG_CGAL::Buffer<int> indices_in_region (Point_set_3_wrapper<CGAL_PS3>& point_set,
+                                            const Region& region) const
+  {
+    typedef CGAL_PS3::Index Index;
+    const Data& data = *data_sptr;
+    if (point_set.get_data().has_garbage() || point_set.get_data().size() != data.indices.size())
+      throw std::invalid_argument("The point set does not match the octree");
+
+    // [begin, end) ranges of index_array(), and if their points must be tested
+    struct Chunk { int begin, end; bool test; };
+    const int chunk_size = 65536;
+    std::vector<Chunk> chunks;
+    std::vector<int> stack (1, 0);
+    while (!stack.empty())
+    {
+      const int v = stack.back();
+      stack.pop_back();
+      double lo[3], hi[3];
+      node_box (std::size_t(v), lo, hi);
+      const SWIG_Point_set_3::Region_side side = region.classify (lo, hi);
+      if (side == SWIG_Point_set_3::REGION_OUTSIDE)
+        continue;
+      const int first_child = data.child_ranges[2 * v], end_child = data.child_ranges[2 * v + 1];
+      if (side == SWIG_Point_set_3::REGION_CROSSING && first_child != end_child)
+      {
+        for (int c = end_child - 1; c >= first_child; --c)
+          stack.push_back (c);
+        continue;
+      }
+      for (int k = data.point_ranges[2 * v]; k < data.point_ranges[2 * v + 1]; k += chunk_size)
+        chunks.push_back (Chunk{ k, (std::min)(k + chunk_size, data.point_ranges[2 * v + 1]),
+                                 side == SWIG_Point_set_3::REGION_CROSSING });
+    }
+
+    CGAL_PS3::Point_map point_map = point_set.get_data().point_map();
+    std::vector<std::vector<int> > found (chunks.size());
+    std::vector<std::size_t> ids (chunks.size());
+    for (std::size_t c = 0; c < chunks.size(); ++c)
+      ids[c] = c;
+    CGAL::for_each<SWIG_Point_set_3::Concurrency_tag>(ids, [&](const std::size_t& c) -> bool
+    {
+      const Chunk& chunk = chunks[c];
+      if (!chunk.test)
+        found[c].assign (data.indices.begin() + chunk.begin, data.indices.begin() + chunk.end);
+      else
+        for (int k = chunk.begin; k < chunk.end; ++k)
+          if (region.contains (reinterpret_cast<const double*>(&point_map[Index(data.indices[k])])))
+            found[c].push_back (data.indices[k]);
+      return true;
+    });
+    std::vector<int> out;
+    for (const std::vector<int>& f : found)
+      out.insert (out.end(), f.begin(), f.end());
+    return SWIG_CGAL::Buffer<int>(std::move(out));
+  }
+
+  void build (Point_set_3_wrapper<CGAL_PS3>& point_set, int max_points_per_node,
+              int max_depth, int sample_depth, bool reorder)
+  {
+    typedef CGAL_PS3::Index Index;
+    typedef std::pair<std::uint64_t, std::size_t> Key;
+    const int bits = SWIG_CGAL::curve_bits;
+    if (max_points_per_node < 1)
+      throw std::invalid_argument("The maximum number of points per node must be positive");
+    if (max_depth < 0 || max_depth > bits)
+      throw std::invalid_argument("The maximum depth must be in [0, " + std::to_string(bits) + "]");
+    if (sample_depth < 0)
+      throw std::invalid_argument("The sample depth must be non-negative");
+
+    Data& data = *data_sptr;
+    point_set.compact();
+    const std::size_t n = point_set.get_data().size();
+    if (n > std::size_t((std::numeric_limits<int>::max)()))
+      throw std::invalid_argument("Too many points");
+    CGAL_PS3::Point_map point_map = point_set.get_data().point_map();
+    auto point = [&point_map](std::size_t k) { return reinterpret_cast<const double*>(&point_map[Index(k)]); };
+    data.cube = SWIG_CGAL::bounding_cube(n, point);
+    std::vector<Key> keys
+      = SWIG_CGAL::sorted_curve_keys<SWIG_Point_set_3::Concurrency_tag>(n, point, data.cube, false);
+    data.indices.resize(n);
+    for (std::size_t k = 0; k < n; ++k)
+      data.indices[k] = int(keys[k].second);
+    if (reorder)
+    {
+      point_set.permute(SWIG_CGAL::Buffer<int>(std::vector<int>(data.indices)));
+      for (std::size_t k = 0; k < n; ++k)
+        data.indices[k] = int(k);
+    }
+
+    // level by level: the octants of the nodes of a level are computed in parallel
+    data.depths.push_back(0);
+    data.parents.push_back(-1);
+    data.point_ranges.insert(data.point_ranges.end(), {0, int(n)});
+    data.coordinates.insert(data.coordinates.end(), {0, 0, 0});
+    std::size_t level_begin = 0;
+    for (int depth = 0; level_begin < data.depths.size(); ++depth)
+    {
+      const std::size_t level_end = data.depths.size();
+      std::vector<std::size_t> level;
+      for (std::size_t v = level_begin; v < level_end; ++v)
+        level.push_back(v);
+      // [begin, end) of the 8 octants of each node, empty if it is a leaf
+      std::vector<std::vector<int> > octants(level.size());
+      CGAL::for_each<SWIG_Point_set_3::Concurrency_tag>(level, [&](const std::size_t& v) -> bool
+      {
+        const int begin = data.point_ranges[2 * v], end = data.point_ranges[2 * v + 1];
+        if (end - begin <= max_points_per_node || depth >= max_depth)
+          return true;
+        const int shift = 3 * (bits - depth - 1);
+        std::vector<int>& bounds = octants[v - level_begin];
+        bounds.push_back(begin);
+        for (std::uint64_t octant = 1; octant < 8; ++octant)
+        {
+          const std::uint64_t prefix = (keys[begin].first >> (shift + 3) << 3 | octant) << shift;
+          bounds.push_back(int(std::lower_bound(keys.begin() + begin, keys.begin() + end,
+                                                Key(prefix, 0)) - keys.begin()));
+        }
+        bounds.push_back(end);
+        return true;
+      });
+      data.child_ranges.resize(2 * level_end, 0);
+      for (std::size_t v = level_begin; v < level_end; ++v)
+      {
+        const std::vector<int>& bounds = octants[v - level_begin];
+        data.child_ranges[2 * v] = data.child_ranges[2 * v + 1] = int(data.depths.size());
+        if (bounds.empty()) continue;
+        for (int octant = 0; octant < 8; ++octant)
+        {
+          if (bounds[octant] == bounds[octant + 1]) continue;
+          data.depths.push_back(depth + 1);
+          data.parents.push_back(int(v));
+          data.point_ranges.insert(data.point_ranges.end(), {bounds[octant], bounds[octant + 1]});
+          for (int i = 0; i < 3; ++i)
+            data.coordinates.push_back(2 * data.coordinates[3 * v + i] + ((octant >> (2 - i)) & 1));
+        }
+        data.child_ranges[2 * v + 1] = int(data.depths.size());
+      }
+      level_begin = level_end;
+    }
+
+    // samples of the nodes, in parallel
+    std::vector<std::size_t> nodes(data.depths.size());
+    for (std::size_t v = 0; v < nodes.size(); ++v)
+      nodes[v] = v;
+    std::vector<std::vector<int> > node_samples(nodes.size());
+    CGAL::for_each<SWIG_Point_set_3::Concurrency_tag>(nodes, [&](const std::size_t& v) -> bool
+    {
+      const int shift = 3 * (bits - (std::min)(data.depths[v] + sample_depth, bits));
+      std::vector<int>& out = node_samples[v];
+      for (int k = data.point_ranges[2 * v]; k < data.point_ranges[2 * v + 1]; ++k)
+        if (k == data.point_ranges[2 * v] || (keys[k].first >> shift) != (keys[k - 1].first >> shift))
+          out.push_back(data.indices[k]);
+      return true;
+    });
+    data.sample_offsets.push_back(0);
+    for (const std::vector<int>& s : node_samples)
+    {
+      data.samples.insert(data.samples.end(), s.begin(), s.end());
+      data.sample_offsets.push_back(int(data.samples.size()));
+    }
+  }
+#endif
+
+public:
+
+  Point_set_3_octree (Point_set_3_wrapper<CGAL_PS3> point_set, int max_points_per_node = 20000,
+                      int max_depth = 12, int sample_depth = 6, bool reorder = false)
+    : data_sptr(new Data())
+  {
+    build (point_set, max_points_per_node, max_depth, sample_depth, reorder);
+  }
+
+  int number_of_nodes() const { return int(data_sptr->depths.size()); }
+  int number_of_points() const { return int(data_sptr->indices.size()); }
+  int depth() const { return data_sptr->depths.back(); }
+
+  // (N,) indices of the points in the point set, sorted by node
+  SWIG_CGAL::Buffer<int> index_array() const { return view(data_sptr->indices, 1); }
+  // (M,) depth of each node, 0 for the root
+  SWIG_CGAL::Buffer<int> depth_array() const { return view(data_sptr->depths, 1); }
+  // (M,) parent of each node, -1 for the root
+  SWIG_CGAL::Buffer<int> parent_array() const { return view(data_sptr->parents, 1); }
+  // (M,2) [first, end) children of each node, empty for the leaves
+  SWIG_CGAL::Buffer<int> child_range_array() const { return view(data_sptr->child_ranges, 2); }
+  // (M,2) [begin, end) of the points of each node in index_array()
+  SWIG_CGAL::Buffer<int> point_range_array() const { return view(data_sptr->point_ranges, 2); }
+  // (M,3) integer coordinates of each node in the grid of its depth
+  SWIG_CGAL::Buffer<int> node_coordinate_array() const { return view(data_sptr->coordinates, 3); }
+  // (M+1,) offsets in sample_array() of the samples of each node
+  SWIG_CGAL::Buffer<int> sample_offset_array() const { return view(data_sptr->sample_offsets, 1); }
+  // (S,) indices of the points in the point set chosen as samples
+  SWIG_CGAL::Buffer<int> sample_array() const { return view(data_sptr->samples, 1); }
+
+  // (4,) corner and side of the cube of the root: xmin, ymin, zmin, side
+  SWIG_CGAL::Buffer<double> bounding_cube_array() const
+  {
+    const SWIG_CGAL::Curve_cube& cube = data_sptr->cube;
+    return SWIG_CGAL::Buffer<double>(std::vector<double>{cube.min[0], cube.min[1], cube.min[2], cube.extent});
+  }
+  // (M,6) box of each node: xmin, ymin, zmin, xmax, ymax, zmax
+  SWIG_CGAL::Buffer<double> node_bbox_array() const
+  {
+    const Data& data = *data_sptr;
+    std::vector<double> out;
+    out.reserve(6 * data.depths.size());
+    for (std::size_t v = 0; v < data.depths.size(); ++v)
+    {
+      double lo[3], hi[3];
+      node_box(v, lo, hi);
+      out.insert(out.end(), {lo[0], lo[1], lo[2], hi[0], hi[1], hi[2]});
+    }
+    return SWIG_CGAL::Buffer<double>(std::move(out), 6);
+  }
+
+  // Crop filters of Point_set_3 on `point_set`, the point set the octree was
+  // built on (unchanged since, or reordered by it), pruned by the nodes.
+  // The indices are in the order of index_array().
+  SWIG_CGAL::Buffer<int> indices_in_bbox (Point_set_3_wrapper<CGAL_PS3> point_set, const Bbox_3& box) const
+  {
+    return indices_in_region (point_set, SWIG_Point_set_3::box_region(box));
+  }
+  SWIG_CGAL::Buffer<int> indices_in_polygon_2 (Point_set_3_wrapper<CGAL_PS3> point_set, const Polygon_2& polygon,
+                                               double zmin, double zmax) const
+  {
+    return indices_in_region (point_set, SWIG_Point_set_3::prism_region(polygon.get_data(), zmin, zmax));
+  }
+  SWIG_CGAL::Buffer<int> indices_in_frustum (Point_set_3_wrapper<CGAL_PS3> point_set,
+                                             SWIG_CGAL::Buffer<double> planes) const
+  {
+    return indices_in_region (point_set, SWIG_Point_set_3::Frustum_region(planes));
+  }
+};
+
+#endif //SWIG_CGAL_POINT_SET_3_POINT_SET_3_OCTREE_H
@@ -0,0 +1,195 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+
+#ifndef SWIG_CGAL_POINT_SET_3_REGION_QUERIES_H
+#define SWIG_CGAL_POINT_SET_3_REGION_QUERIES_H
+
+#include <SWIG_CGAL/Common/Buffer.h>
+
+#include <CGAL/for_each.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace SWIG_Point_set_3 {
+
+// Regions of the crop filters of Point_set_3 and Point_set_3_octree.
+// contains(p) tells if the point p (double[3]) is in the region (boundary
+// included), classify(lo, hi) where the box [lo, hi] is with respect to it.
+enum Region_side { REGION_OUTSIDE, REGION_INSIDE, REGION_CROSSING };
+
+struct Box_region
+{
+  double lo[3], hi[3];
+
+  bool contains(const double* p) const
+  {
+    return p[0] >= lo[0] && p[0] <= hi[0]
+        && p[1] >= lo[1] && p[1] <= hi[1]
+        && p[2] >= lo[2] && p[2] <= hi[2];
+  }
+
+  Region_side classify(const double* blo, const double* bhi) const
+  {
+    bool inside = true;
+    for (int i = 0; i < 3; ++i)
+    {
+      if (bhi[i] < lo[i] || blo[i] > hi[i])
+        return REGION_OUTSIDE;
+      inside = inside && blo[i] >= lo[i] && bhi[i] <= hi[i];
+    }
+    return inside ? REGION_INSIDE : REGION_CROSSING;
+  }
+};
+
+// vertical prism over a polygon (x0,y0,x1,y1...) between zmin and zmax
+struct Prism_region
+{
+  std::vector<double> xy;
+  Box_region box; // bounding box of the prism
+
+  Prism_region(std::vector<double>&& polygon, double zmin, double zmax)
+    : xy(std::move(polygon))
+  {
+    if (xy.size() < 6)
+      throw std::invalid_argument("The polygon must have at least 3 vertices");
+    box.lo[0] = box.hi[0] = xy[0];
+    box.lo[1] = box.hi[1] = xy[1];
+    for (std::size_t v = 2; v < xy.size(); v += 2)
+    {
+      box.lo[0] = (std::min)(box.lo[0], xy[v]);
+      box.hi[0] = (std::max)(box.hi[0], xy[v]);
+      box.lo[1] = (std::min)(box.lo[1], xy[v + 1]);
+      box.hi[1] = (std::max)(box.hi[1], xy[v + 1]);
+    }
+    box.lo[2] = zmin;
+    box.hi[2] = zmax;
+  }
+
+  // crossing number, the points on the boundary may be on either side
+  bool contains(const double* p) const
+  {
+    if (!box.contains(p))
+      return false;
+    bool inside = false;
+    const std::size_t n = xy.size();
+    for (std::size_t i = 0, j = n - 2; i < n; j = i, i += 2)
+      if ((xy[i + 1] > p[1]) != (xy[j + 1] > p[1])
+          && p[0] < xy[i] + (p[1] - xy[i + 1]) * (xy[j] - xy[i]) / (xy[j + 1] - xy[i + 1]))
+        inside = !inside;
+    return inside;
+  }
+
+  // only pruned by the bounding box
+  Region_side classify(const double* blo, const double* bhi) const
+  {
+    return box.classify(blo, bhi) == REGION_OUTSIDE ? REGION_OUTSIDE : REGION_CROSSING;
+  }
+};
+
+// intersection of the negative sides of planes a*x + b*y + c*z + d = 0
+struct Frustum_region
+{
+  std::vector<double> planes; // a,b,c,d for each plane
+
+  explicit Frustum_region(const SWIG_CGAL::Buffer<double>& coefficients)
+    : planes(coefficients.data(), coefficients.data() + coefficients.size())
+  {
+    if (planes.size() % 4 != 0 || (coefficients.cols() != 1 && coefficients.cols() != 4))
+      throw std::invalid_argument("The planes must be given as (K,4) coefficients a,b,c,d");
+  }
+
+  bool contains(const double* p) const
+  {
+    for (std::size_t k = 0; k < planes.size(); k += 4)
+      if (planes[k] * p[0] + planes[k + 1] * p[1] + planes[k + 2] * p[2] + planes[k + 3] > 0)
+        return false;
+    return true;
+  }
+
+  Region_side classify(const double* blo, const double* bhi) const
+  {
+    bool inside = true;
+    for (std::size_t k = 0; k < planes.size(); k += 4)
+    {
+      // the smallest and largest values over the corners of the box
+      double smallest = planes[k + 3], largest = planes[k + 3];
+      for (int i = 0; i < 3; ++i)
+      {
+        const double a = planes[k + i] * blo[i], b = planes[k + i] * bhi[i];
+        smallest += (std::min)(a, b);
+        largest += (std::max)(a, b);
+      }
+      if (smallest > 0)
+        return REGION_OUTSIDE;
+      inside = inside && largest <= 0;
+    }
+    return inside ? REGION_INSIDE : REGION_CROSSING;
+  }
+};
+
+// regions of the wrapped kernel objects
+template <class Bbox>
+Box_region box_region(const Bbox& bbox)
+{
+  Box_region region;
+  region.lo[0] = bbox.xmin(); region.lo[1] = bbox.ymin(); region.lo[2] = bbox.zmin();
+  region.hi[0] = bbox.xmax(); region.hi[1] = bbox.ymax(); region.hi[2] = bbox.zmax();
+  return region;
+}
+
+template <class Polygon>
+Prism_region prism_region(const Polygon& polygon, double zmin, double zmax)
+{
+  std::vector<double> xy;
+  for (typename Polygon::Vertex_const_iterator v = polygon.vertices_begin(); v != polygon.vertices_end(); ++v)
+  {
+    xy.push_back(v->x());
+    xy.push_back(v->y());
+  }
+  return Prism_region(std::move(xy), zmin, zmax);
+}
+
+// Positions k in [0,n) of the points in `region`, in increasing order,
+// `point(k)` giving the coordinates (double[3]) of the k-th point. The
+// points are tested concurrently with Parallel_tag, by blocks written at
+// their offsets in the result.
+template <class Concurrency_tag, class Point_coordinates, class Region>
+std::vector<int> positions_in_region(std::size_t n, const Point_coordinates& point, const Region& region)
+{
+  const std::size_t block_size = 4096;
+  const std::size_t nb_blocks = (n + block_size - 1) / block_size;
+  std::vector<std::size_t> blocks(nb_blocks);
+  for (std::size_t b = 0; b < nb_blocks; ++b)
+    blocks[b] = b;
+  std::vector<std::vector<int> > found(nb_blocks);
+  CGAL::for_each<Concurrency_tag>(blocks, [&](const std::size_t& b) -> bool
+  {
+    const std::size_t end = (std::min)((b + 1) * block_size, n);
+    for (std::size_t k = b * block_size; k < end; ++k)
+      if (region.contains(point(k)))
+        found[b].push_back(int(k));
+    return true;
+  });
+
+  std::vector<std::size_t> offsets(nb_blocks + 1, 0);
+  for (std::size_t b = 0; b < nb_blocks; ++b)
+    offsets[b + 1] = offsets[b] + found[b].size();
+  std::vector<int> positions(offsets[nb_blocks]);
+  CGAL::for_each<Concurrency_tag>(blocks, [&](const std::size_t& b) -> bool
+  {
+    std::copy(found[b].begin(), found[b].end(), positions.begin() + offsets[b]);
+    return true;
+  });
+  return positions;
+}
+
+} // namespace SWIG_Point_set_3
+
+#endif //SWIG_CGAL_POINT_SET_3_REGION_QUERIES_H
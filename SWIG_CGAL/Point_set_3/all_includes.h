@@ -10,5 +10,8 @@
 #include <SWIG_CGAL/Point_set_3/typedefs.h>
 #include <SWIG_CGAL/Point_set_3/Point_set_3.h>
 #include <SWIG_CGAL/Point_set_3/Point_set_3_Property_map.h>
+#include <SWIG_CGAL/Point_set_3/Mapped_point_set_3.h>
+#include <SWIG_CGAL/Point_set_3/Point_set_3_chunk_reader.h>
+#include <SWIG_CGAL/Point_set_3/Point_set_3_octree.h>
 
 #endif //SWIG_CGAL_POINT_SET_3_ALL_INCLUDES_H
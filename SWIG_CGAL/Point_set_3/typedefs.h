@@ -12,4 +12,12 @@
 
 typedef CGAL::Point_set_3<EPIC_Kernel::Point_3> CGAL_PS3;
 
+namespace SWIG_Point_set_3 {
+#ifdef CGAL_LINKED_WITH_TBB
+typedef CGAL::Parallel_tag Concurrency_tag;
+#else
+typedef CGAL::Sequential_tag Concurrency_tag;
+#endif
+}
+
 #endif //SWIG_CGAL_POINT_SET_3_TYPEDEFS_H
@@ -17,6 +17,8 @@ SWIG_CGAL_package_common()
 %import  "SWIG_CGAL/Common/Macros.h"
 %import  "SWIG_CGAL/Kernel/CGAL_Kernel.i"
 %import  "SWIG_CGAL/Point_set_3/CGAL_Point_set_3.i"
+// for the Voronoi covariance measure computed in a Parallel_Delaunay_triangulation_3
+%import  "SWIG_CGAL/Triangulation_3/CGAL_Triangulation_3.i"
 %include "SWIG_CGAL/Common/Iterator.h"
 
 %pragma(java) jniclassimports=%{
@@ -24,6 +26,8 @@ import CGAL.Kernel.Point_3;
 import CGAL.Kernel.Vector_3;
 import CGAL.Point_set_3.Point_set_3;
 import CGAL.Point_set_3.Point_set_3_Int_map;
+import CGAL.Point_set_3.Point_set_3_Float_map;
+import CGAL.Kernel.Cancellation_token;
 import java.util.Iterator;
 import java.util.Collection;
 %}
@@ -33,6 +37,8 @@ import CGAL.Kernel.Point_3;
 import CGAL.Kernel.Vector_3;
 import CGAL.Point_set_3.Point_set_3;
 import CGAL.Point_set_3.Point_set_3_Int_map;
+import CGAL.Point_set_3.Point_set_3_Float_map;
+import CGAL.Kernel.Cancellation_token;
 import java.util.Iterator;
 import java.util.Collection;
 %};
@@ -49,15 +55,106 @@ namespace std {
   %template(StringMap) map<string, string>;
 }
 
+// typemaps.i is already processed by the import of Point_set_3: the
+// conversion code used by the buffer typemaps is included explicitly
+%include "SWIG_CGAL/typemaps.i"
+%{
+#ifdef SWIGPYTHON
+#include <SWIG_CGAL/Python/Buffer.h>
+#endif
+#ifdef SWIGJAVA
+#include <SWIG_CGAL/Java/Buffer.h>
+#endif
+%}
+SWIG_CGAL_buffer_of_double_typemap_out
+SWIG_CGAL_buffer_of_int_typemap_out
+
+%typemap(javaimports) CGAL_SWIG::Neighborhood_cache %{
+import CGAL.Point_set_3.Point_set_3;
+import CGAL.Point_set_3.Point_set_3_Int_map;
+import CGAL.Point_set_3.Point_set_3_Float_map;
+%}
+%include "SWIG_CGAL/Point_set_processing_3/Neighborhood_cache.h"
+
+// the point sets are converted before the call: the heavy functions run
+// without the GIL
+SWIG_CGAL_release_gil(CGAL_SWIG::bilateral_smooth_point_set)
+SWIG_CGAL_release_gil(CGAL_SWIG::edge_aware_upsample_point_set)
+SWIG_CGAL_release_gil(CGAL_SWIG::jet_estimate_normals)
+SWIG_CGAL_release_gil(CGAL_SWIG::jet_estimate_normals_with_k_map)
+SWIG_CGAL_release_gil(CGAL_SWIG::jet_smooth_point_set)
+SWIG_CGAL_release_gil(CGAL_SWIG::mst_orient_normals)
+SWIG_CGAL_release_gil(CGAL_SWIG::tiled_mst_orient_normals)
+SWIG_CGAL_release_gil(CGAL_SWIG::pca_estimate_normals)
+SWIG_CGAL_release_gil(CGAL_SWIG::pca_estimate_normals_with_k_map)
+SWIG_CGAL_release_gil(CGAL_SWIG::estimate_local_k_neighbor_scales)
+SWIG_CGAL_release_gil(CGAL_SWIG::estimate_local_range_scales)
+SWIG_CGAL_release_gil(CGAL_SWIG::remove_outliers)
+SWIG_CGAL_release_gil(CGAL_SWIG::remove_statistical_outliers)
+SWIG_CGAL_release_gil(CGAL_SWIG::remove_radius_outliers)
+SWIG_CGAL_release_gil(CGAL_SWIG::wlop_simplify_and_regularize_point_set)
+SWIG_CGAL_release_gil(CGAL_SWIG::registration_transformation_opengr)
+SWIG_CGAL_release_gil(CGAL_SWIG::registration_transformation_pointmatcher)
+SWIG_CGAL_buffer_of_double_typemap_in
+%typemap(javaimports) CGAL_SWIG::Registration_result %{import CGAL.Point_set_3.Point_set_3;%}
 %include "SWIG_CGAL/Point_set_processing_3/functions.h"
 
+SWIG_CGAL_vector_of_string_to_array_of_string_typemap_out
+SWIG_CGAL_release_gil(CGAL_SWIG::Point_set_pipeline::run)
+%include "SWIG_CGAL/Point_set_processing_3/Pipeline.h"
+
 %{
   #include <SWIG_CGAL/Point_set_processing_3/functions.h>
+  #include <SWIG_CGAL/Point_set_processing_3/Pipeline.h>
+  #include <SWIG_CGAL/Point_set_processing_3/Multi_registration.h>
+  #include <SWIG_CGAL/Point_set_processing_3/Streaming_grid_simplification.h>
+  #include <SWIG_CGAL/Point_set_processing_3/Voronoi_covariance_measure.h>
 %}
 
 // Expose ICP_config_wrapper class for PointMatcher
 %template(ICP_config_vector) std::vector<CGAL_SWIG::ICP_config_wrapper>;
 
+SWIG_CGAL_buffer_of_int_typemap_in
+%typemap(javaimports) CGAL_SWIG::Multi_registration %{
+import CGAL.Point_set_3.Point_set_3;
+import CGAL.Kernel.Cancellation_token;
+%}
+SWIG_CGAL_release_gil(CGAL_SWIG::Multi_registration::run_opengr)
+SWIG_CGAL_release_gil(CGAL_SWIG::Multi_registration::run_icp)
+SWIG_CGAL_release_gil(CGAL_SWIG::Multi_registration::optimize_poses)
+%include "SWIG_CGAL/Point_set_processing_3/Multi_registration.h"
+
+%typemap(javaimports) CGAL_SWIG::Streaming_grid_simplify_point_set %{
+import CGAL.Point_set_3.Point_set_3;
+import CGAL.Kernel.Cancellation_token;
+%}
+SWIG_CGAL_release_gil(CGAL_SWIG::Streaming_grid_simplify_point_set::insert)
+SWIG_CGAL_release_gil(CGAL_SWIG::Streaming_grid_simplify_point_set::insert_array)
+SWIG_CGAL_release_gil(CGAL_SWIG::Streaming_grid_simplify_point_set::insert_file)
+SWIG_CGAL_release_gil(CGAL_SWIG::Streaming_grid_simplify_point_set::result)
+%include "SWIG_CGAL/Point_set_processing_3/Streaming_grid_simplification.h"
+
+%typemap(javaimports) CGAL_SWIG::Voronoi_covariance_measure %{
+import CGAL.Point_set_3.Point_set_3;
+import CGAL.Triangulation_3.Parallel_Delaunay_triangulation_3;
+import CGAL.Kernel.Cancellation_token;
+%}
+SWIG_CGAL_release_gil(CGAL_SWIG::Voronoi_covariance_measure::compute)
+SWIG_CGAL_release_gil(CGAL_SWIG::Voronoi_covariance_measure::compute_in_triangulation)
+SWIG_CGAL_release_gil(CGAL_SWIG::Voronoi_covariance_measure::covariance_array)
+SWIG_CGAL_release_gil(CGAL_SWIG::Voronoi_covariance_measure::estimate_normals)
+SWIG_CGAL_release_gil(CGAL_SWIG::vcm_estimate_normals)
+%include "SWIG_CGAL/Point_set_processing_3/Voronoi_covariance_measure.h"
+
+#ifdef SWIGPYTHON
+//asynchronous variants, see CGAL.run_async()
+%pythoncode %{
+import CGAL as _CGAL
+registration_transformation_opengr_async = _CGAL.async_variant(registration_transformation_opengr)
+registration_transformation_pointmatcher_async = _CGAL.async_variant(registration_transformation_pointmatcher)
+%}
+#endif
+
 #ifdef SWIG_CGAL_HAS_Point_set_processing_3_USER_PACKAGE
 %include "SWIG_CGAL/User_packages/Point_set_processing_3/extensions.i"
 #endif
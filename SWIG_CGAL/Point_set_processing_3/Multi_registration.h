@@ -0,0 +1,430 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+#ifndef SWIG_CGAL_POINT_SET_PROCESSING_3_MULTI_REGISTRATION_H
+#define SWIG_CGAL_POINT_SET_PROCESSING_3_MULTI_REGISTRATION_H
+
+#include <SWIG_CGAL/Common/Buffer.h>
+#include <SWIG_CGAL/Common/Cancellation_token.h>
+#include <SWIG_CGAL/Point_set_processing_3/functions.h>
+
+#include <CGAL/Search_traits_3.h>
+#include <CGAL/Orthogonal_k_neighbor_search.h>
+#include <CGAL/for_each.h>
+
+#include <Eigen/Dense>
+
+#include <algorithm>
+#include <memory>
+#include <queue>
+#include <stdexcept>
+#include <vector>
+
+namespace CGAL_SWIG {
+
+// Registration of N scans given by Point_set_3. The pairs to align are the
+// edges of an overlap graph (add_edge()/add_edges(), or add_overlapping_edges()
+// for the pairs of scans with overlapping bounding boxes). run_opengr() and
+// run_icp() align all the pairs in parallel, icp using the current transform
+// of each edge as initial guess. For an edge (i, j), the transform maps scan j
+// onto scan i, and its fitness is the fraction of the points of the mapped
+// scan j having a point of scan i closer than `inlier_distance`.
+// optimize_poses() then computes the pose of each scan in the frame of the
+// reference scan: spanning tree of the edges of best fitness, refined by
+// iterations where each pose is set to the fitness weighted average of the
+// poses given by its neighbors (rotations averaged in the chordal sense).
+// The matrices are 4x4 row major. The scans are not modified before
+// apply_poses(), but the ones without normal map get one.
+class Multi_registration
+{
+#ifndef SWIG
+  typedef EPIC_Kernel::Point_3 Point;
+  typedef EPIC_Kernel::Aff_transformation_3 Transformation;
+  typedef CGAL::Search_traits_3<EPIC_Kernel> Search_traits;
+  typedef CGAL::Orthogonal_k_neighbor_search<Search_traits> Neighbor_search;
+  typedef Neighbor_search::Tree Tree;
+  // not aligned, to be stored in std containers
+  typedef Eigen::Matrix<double, 4, 4, Eigen::DontAlign> Matrix;
+
+  struct Edge
+  {
+    int source, target;
+    Matrix transform;
+    double fitness;
+  };
+
+  std::vector<Point_set_3_wrapper<CGAL_PS3> > m_scans;
+  std::vector<Edge> m_edges;
+  std::vector<Matrix> m_poses;
+  std::vector<int> m_registered;
+  double m_inlier_distance;
+  int m_fitness_samples;
+
+  void check_scan (int i) const
+  {
+    if (i < 0 || i >= number_of_scans())
+      throw std::out_of_range("Scan index out of range");
+  }
+
+  void prepare_scans()
+  {
+    for (Point_set_3_wrapper<CGAL_PS3>& scan : m_scans)
+      if (!scan.get_data().has_normal_map())
+        scan.get_data().add_normal_map();
+  }
+
+  static Matrix to_matrix (const Transformation& t)
+  {
+    Matrix m = Matrix::Identity();
+    for (int i = 0; i < 3; ++i)
+      for (int j = 0; j < 4; ++j)
+        m(i, j) = t.m(i, j);
+    return m;
+  }
+
+  static Transformation to_transformation (const Matrix& m)
+  {
+    return Transformation (m(0,0), m(0,1), m(0,2), m(0,3),
+                           m(1,0), m(1,1), m(1,2), m(1,3),
+                           m(2,0), m(2,1), m(2,2), m(2,3));
+  }
+
+  // inverse of a rigid transformation
+  static Matrix inverse (const Matrix& m)
+  {
+    Matrix out = Matrix::Identity();
+    out.topLeftCorner<3,3>() = m.topLeftCorner<3,3>().transpose();
+    out.topRightCorner<3,1>() = - out.topLeftCorner<3,3>() * m.topRightCorner<3,1>();
+    return out;
+  }
+
+  // fraction of the (sampled) points of scan `target` mapped by `m` whose
+  // nearest neighbor in `tree` is closer than the inlier distance
+  double fitness (const Tree& tree, int target, const Matrix& m) const
+  {
+    const CGAL_PS3& points = m_scans[std::size_t(target)].get_data();
+    if (points.empty() || tree.size() == 0)
+      return 0.;
+    const std::size_t step = std::max<std::size_t>
+      (1, points.size() / std::size_t(std::max(1, m_fitness_samples)));
+    const Transformation t = to_transformation(m);
+    const double sq_dist = m_inlier_distance * m_inlier_distance;
+    std::size_t nb_samples = 0, nb_inliers = 0;
+    for (std::size_t i = 0; i < points.size(); i += step)
+    {
+      Neighbor_search search (tree, t.transform(points.point(*(points.begin() + i))), 1);
+      ++ nb_samples;
+      if (search.begin() != search.end() && search.begin()->second <= sq_dist)
+        ++ nb_inliers;
+    }
+    return nb_inliers / double(nb_samples);
+  }
+
+  // one tree per scan used as source of an edge, built beforehand so that
+  // the queries of the parallel tasks are read only
+  std::vector<std::unique_ptr<Tree> > build_trees() const
+  {
+    std::vector<std::unique_ptr<Tree> > trees (m_scans.size());
+    for (const Edge& e : m_edges)
+    {
+      std::unique_ptr<Tree>& tree = trees[std::size_t(e.source)];
+      if (tree)
+        continue;
+      const CGAL_PS3& points = m_scans[std::size_t(e.source)].get_data();
+      tree.reset (new Tree (points.points().begin(), points.points().end()));
+      tree->build();
+    }
+    return trees;
+  }
+
+  template <class Align>
+  void run (Align align, const SWIG_CGAL::Cancellation_token& token)
+  {
+    prepare_scans();
+    std::vector<std::unique_ptr<Tree> > trees = build_trees();
+    std::vector<std::size_t> indices (m_edges.size());
+    for (std::size_t i = 0; i < indices.size(); ++i)
+      indices[i] = i;
+    CGAL::for_each<Concurrency_tag>
+      (indices, [&](std::size_t i) -> bool
+       {
+         if (token.is_cancelled())
+           return false;
+         Edge& e = m_edges[i];
+         e.transform = align (m_scans[std::size_t(e.source)].get_data(),
+                              m_scans[std::size_t(e.target)].get_data(),
+                              e.transform);
+         e.fitness = fitness (*trees[std::size_t(e.source)], e.target, e.transform);
+         return true;
+       });
+    token.throw_if_cancelled();
+    m_poses.clear();
+    m_registered.clear();
+  }
+
+  // pose of `k` given by its neighbor through edge `e`
+  Matrix predicted_pose (const Edge& e, int k) const
+  {
+    if (e.target == k)
+      return m_poses[std::size_t(e.source)] * e.transform;
+    return m_poses[std::size_t(e.target)] * inverse(e.transform);
+  }
+#endif
+
+public:
+
+  Multi_registration (double inlier_distance, int fitness_samples = 1000)
+    : m_inlier_distance (inlier_distance), m_fitness_samples (fitness_samples)
+  {
+    if (inlier_distance <= 0.)
+      throw std::invalid_argument("The inlier distance must be positive");
+  }
+
+  // returns the index of the scan
+  int add_scan (Point_set_3_wrapper<CGAL_PS3> scan)
+  {
+    m_scans.push_back (scan);
+    return number_of_scans() - 1;
+  }
+  int number_of_scans() const { return int(m_scans.size()); }
+
+  // scan j is aligned onto scan i
+  void add_edge (int i, int j)
+  {
+    check_scan(i);
+    check_scan(j);
+    if (i == j)
+      throw std::invalid_argument("An edge must join two different scans");
+    Edge e = { i, j, Matrix::Identity(), 0. };
+    m_edges.push_back (e);
+  }
+  // rows (i, j) of an (E, 2) array
+  void add_edges (SWIG_CGAL::Buffer<int> edges)
+  {
+    if (edges.size() % 2 != 0)
+      throw std::invalid_argument("Expecting two scan indices per edge");
+    for (std::size_t k = 0; k < edges.size(); k += 2)
+      add_edge (edges[k], edges[k + 1]);
+  }
+  // adds the edges (i, j), i < j, of the scans whose bounding boxes
+  // enlarged by `margin` intersect; returns the number of edges added
+  int add_overlapping_edges (double margin = 0.)
+  {
+    std::vector<CGAL::Bbox_3> boxes;
+    boxes.reserve (m_scans.size());
+    for (const Point_set_3_wrapper<CGAL_PS3>& scan : m_scans)
+    {
+      CGAL::Bbox_3 box = CGAL::bbox_3 (scan.get_data().points().begin(),
+                                       scan.get_data().points().end());
+      boxes.push_back (CGAL::Bbox_3 (box.xmin() - margin, box.ymin() - margin, box.zmin() - margin,
+                                     box.xmax() + margin, box.ymax() + margin, box.zmax() + margin));
+    }
+    const std::size_t before = m_edges.size();
+    for (int i = 0; i < number_of_scans(); ++i)
+      for (int j = i + 1; j < number_of_scans(); ++j)
+        if (!m_scans[std::size_t(i)].get_data().empty() &&
+            !m_scans[std::size_t(j)].get_data().empty() &&
+            CGAL::do_overlap (boxes[std::size_t(i)], boxes[std::size_t(j)]))
+          add_edge (i, j);
+    return int(m_edges.size() - before);
+  }
+  int number_of_edges() const { return int(m_edges.size()); }
+  void clear_edges()
+  {
+    m_edges.clear();
+    m_poses.clear();
+    m_registered.clear();
+  }
+
+  // same parameters as register_point_sets_opengr()
+  void run_opengr (int number_of_samples = 200,
+                   double maximum_normal_deviation = 90.0,
+                   double accuracy = 5.0,
+                   double overlap = 0.2,
+                   int maximum_running_time = 1000,
+                   SWIG_CGAL::Cancellation_token token = SWIG_CGAL::Cancellation_token())
+  {
+    run ([&](const CGAL_PS3& ps1, const CGAL_PS3& ps2, const Matrix&) -> Matrix
+         {
+           return to_matrix (CGAL::OpenGR::compute_registration_transformation
+             (ps1, ps2,
+              ps1.parameters()
+                .point_map(ps1.point_map())
+                .normal_map(ps1.normal_map())
+                .number_of_samples(number_of_samples)
+                .maximum_normal_deviation(maximum_normal_deviation)
+                .accuracy(accuracy)
+                .overlap(overlap)
+                .maximum_running_time(maximum_running_time),
+              ps2.parameters()
+                .point_map(ps2.point_map())
+                .normal_map(ps2.normal_map())).first);
+         }, token);
+  }
+
+  // same parameters as register_point_sets_pointmatcher(), empty lists of
+  // filters or checkers meaning none
+  void run_icp (const std::vector<ICP_config_wrapper>& point_set_filters = {},
+                const ICP_config_wrapper& matcher = CGAL_SWIG::ICP_config_wrapper("KDTreeMatcher", {{"knn", "1"}}),
+                const std::vector<ICP_config_wrapper>& outlier_filters = {},
+                const ICP_config_wrapper& error_minimizer =
+                    CGAL_SWIG::ICP_config_wrapper("PointToPlaneErrorMinimizer", {}),
+                const std::vector<ICP_config_wrapper>& transformation_checkers =
+                    {CGAL_SWIG::ICP_config_wrapper("CounterTransformationChecker", {{"maxIterationCount", "150"}})},
+                SWIG_CGAL::Cancellation_token token = SWIG_CGAL::Cancellation_token())
+  {
+    const auto filters = convert_icp_configs(point_set_filters);
+    const auto outliers = convert_icp_configs(outlier_filters);
+    const auto checkers = convert_icp_configs(transformation_checkers);
+    const auto match_config = matcher.to_cgal_config();
+    const auto minimizer_config = error_minimizer.to_cgal_config();
+    run ([&](const CGAL_PS3& ps1, const CGAL_PS3& ps2, const Matrix& initial) -> Matrix
+         {
+           auto result = CGAL::pointmatcher::compute_registration_transformation
+             (ps1, ps2,
+              ps1.parameters()
+                .point_map(ps1.point_map())
+                .normal_map(ps1.normal_map()),
+              ps2.parameters()
+                .point_map(ps2.point_map())
+                .normal_map(ps2.normal_map())
+                .point_set_filters(filters)
+                .matcher(match_config)
+                .outlier_filters(outliers)
+                .error_minimizer(minimizer_config)
+                .transformation_checkers(checkers)
+                .transformation(to_transformation(initial)));
+           // a diverged alignment keeps its initial guess
+           return result.second ? to_matrix(result.first) : initial;
+         }, token);
+  }
+
+  // edges whose fitness is below `minimum_fitness` are ignored; the scans not
+  // connected to `reference` by the other edges keep the identity as pose and
+  // are flagged 0 in registered_array()
+  void optimize_poses (int reference = 0, int iterations = 10, double minimum_fitness = 0.1)
+  {
+    check_scan(reference);
+    const std::size_t n = m_scans.size();
+    std::vector<std::vector<std::size_t> > incident (n);
+    for (std::size_t i = 0; i < m_edges.size(); ++i)
+      if (m_edges[i].fitness >= minimum_fitness && m_edges[i].fitness > 0.)
+      {
+        incident[std::size_t(m_edges[i].source)].push_back(i);
+        incident[std::size_t(m_edges[i].target)].push_back(i);
+      }
+
+    // maximum spanning tree (Prim) from the reference scan
+    m_poses.assign (n, Matrix::Identity());
+    m_registered.assign (n, 0);
+    typedef std::pair<double, std::size_t> Candidate;
+    std::priority_queue<Candidate> queue;
+    m_registered[std::size_t(reference)] = 1;
+    for (std::size_t e : incident[std::size_t(reference)])
+      queue.push (Candidate (m_edges[e].fitness, e));
+    std::vector<std::size_t> order;
+    while (!queue.empty())
+    {
+      const Edge& e = m_edges[queue.top().second];
+      queue.pop();
+      const int k = m_registered[std::size_t(e.source)] ? e.target : e.source;
+      if (m_registered[std::size_t(k)])
+        continue;
+      m_poses[std::size_t(k)] = predicted_pose (e, k);
+      m_registered[std::size_t(k)] = 1;
+      order.push_back (std::size_t(k));
+      for (std::size_t f : incident[std::size_t(k)])
+        queue.push (Candidate (m_edges[f].fitness, f));
+    }
+
+    // Gauss-Seidel refinement using all the edges of the registered scans
+    for (int it = 0; it < iterations; ++it)
+      for (std::size_t k : order)
+      {
+        Eigen::Matrix3d rotation = Eigen::Matrix3d::Zero();
+        Eigen::Vector3d translation = Eigen::Vector3d::Zero();
+        double weight = 0.;
+        for (std::size_t f : incident[k])
+        {
+          const Matrix pose = predicted_pose (m_edges[f], int(k));
+          const double w = m_edges[f].fitness;
+          rotation += w * pose.topLeftCorner<3,3>();
+          translation += w * pose.topRightCorner<3,1>();
+          weight += w;
+        }
+        // closest rotation to the weighted sum
+        Eigen::JacobiSVD<Eigen::Matrix3d> svd (rotation, Eigen::ComputeFullU | Eigen::ComputeFullV);
+        Eigen::Matrix3d u = svd.matrixU();
+        if ((u * svd.matrixV().transpose()).determinant() < 0.)
+          u.col(2) *= -1.;
+        m_poses[k].topLeftCorner<3,3>() = u * svd.matrixV().transpose();
+        m_poses[k].topRightCorner<3,1>() = translation / weight;
+      }
+  }
+
+  // transforms each registered scan (points and normals) by its pose
+  void apply_poses()
+  {
+    if (m_poses.size() != m_scans.size())
+      throw std::logic_error("optimize_poses() must be called first");
+    for (std::size_t k = 0; k < m_scans.size(); ++k)
+    {
+      if (!m_registered[k])
+        continue;
+      internal::transform_point_set (m_scans[k].get_data(), to_transformation(m_poses[k]));
+    }
+  }
+
+  // (E, 2) array of the scans (i, j) of each edge
+  SWIG_CGAL::Buffer<int> edge_array() const
+  {
+    std::vector<int> out;
+    out.reserve (2 * m_edges.size());
+    for (const Edge& e : m_edges)
+    {
+      out.push_back (e.source);
+      out.push_back (e.target);
+    }
+    return SWIG_CGAL::Buffer<int> (std::move(out), 2);
+  }
+  // (E, 16) array of the transform of each edge
+  SWIG_CGAL::Buffer<double> transform_array() const
+  {
+    std::vector<double> out;
+    out.reserve (16 * m_edges.size());
+    for (const Edge& e : m_edges)
+      for (int i = 0; i < 4; ++i)
+        for (int j = 0; j < 4; ++j)
+          out.push_back (e.transform(i, j));
+    return SWIG_CGAL::Buffer<double> (std::move(out), 16);
+  }
+  SWIG_CGAL::Buffer<double> fitness_array() const
+  {
+    std::vector<double> out;
+    out.reserve (m_edges.size());
+    for (const Edge& e : m_edges)
+      out.push_back (e.fitness);
+    return SWIG_CGAL::Buffer<double> (std::move(out));
+  }
+  // (N, 16) array of the poses computed by optimize_poses()
+  SWIG_CGAL::Buffer<double> pose_array() const
+  {
+    std::vector<double> out;
+    out.reserve (16 * m_poses.size());
+    for (const Matrix& m : m_poses)
+      for (int i = 0; i < 4; ++i)
+        for (int j = 0; j < 4; ++j)
+          out.push_back (m(i, j));
+    return SWIG_CGAL::Buffer<double> (std::move(out), 16);
+  }
+  SWIG_CGAL::Buffer<int> registered_array() const
+  {
+    return SWIG_CGAL::Buffer<int> (std::vector<int>(m_registered));
+  }
+};
+
+} // end namespace CGAL_SWIG
+
+#endif //SWIG_CGAL_POINT_SET_PROCESSING_3_MULTI_REGISTRATION_H
@@ -0,0 +1,425 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+#ifndef SWIG_CGAL_POINT_SET_PROCESSING_3_NEIGHBORHOOD_CACHE_H
+#define SWIG_CGAL_POINT_SET_PROCESSING_3_NEIGHBORHOOD_CACHE_H
+
+#include <SWIG_CGAL/Common/Buffer.h>
+#include <SWIG_CGAL/Point_set_3/Point_set_3.h>
+
+#include <CGAL/Monge_via_jet_fitting.h>
+#include <CGAL/linear_least_squares_fitting_3.h>
+#include <CGAL/Search_traits_3.h>
+#include <CGAL/Search_traits_adapter.h>
+#include <CGAL/Orthogonal_k_neighbor_search.h>
+#include <CGAL/for_each.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+namespace CGAL_SWIG {
+
+// k nearest neighbors (the point itself included, as with the `k` parameter
+// of the functions of Point_set_processing_3) of all the points of a point
+// set, computed once with a single kd-tree. The methods estimating normals,
+// spacing and outliers reuse them instead of building their own tree and
+// running their own queries. Copies share the same cache. The cache is
+// rebuilt by update() (called by these methods) when the points were
+// modified since the last build.
+class Neighborhood_cache
+{
+#ifndef SWIG
+  typedef CGAL_PS3::Index Index;
+  typedef CGAL_PS3::Point_map Point_map;
+  typedef CGAL::Search_traits_3<EPIC_Kernel> Traits_base;
+  typedef CGAL::Search_traits_adapter<Index, Point_map, Traits_base> Traits;
+  typedef CGAL::Orthogonal_k_neighbor_search<Traits> Neighbor_search;
+  typedef Neighbor_search::Tree Tree;
+  typedef Neighbor_search::Distance Distance;
+
+  struct Data
+  {
+    std::size_t k;
+    std::uint64_t signature;
+    std::vector<int> indices;  // points in iteration order
+    // k values per point, replaced (not modified) when rebuilt so that
+    // exported arrays stay valid
+    std::shared_ptr<std::vector<int> > neighbors;
+    std::shared_ptr<std::vector<double> > squared_distances;
+    bool built;
+  };
+#endif
+
+  Point_set_3_wrapper<CGAL_PS3> m_point_set;
+  std::shared_ptr<Data> m_data;
+
+  // FNV-1a like hash (on 64 bits words) of the indices and coordinates
+  std::uint64_t compute_signature() const
+  {
+    const CGAL_PS3& points = m_point_set.get_data();
+    std::uint64_t hash = 14695981039346656037ULL;
+    auto combine = [&](std::uint64_t word) { hash = (hash ^ word) * 1099511628211ULL; };
+    combine (points.size());
+    for (Index idx : points)
+    {
+      combine (std::uint64_t(std::uint32_t(idx)));
+      const EPIC_Kernel::Point_3& p = points.point(idx);
+      double coordinates[3] = { p.x(), p.y(), p.z() };
+      std::uint64_t words[3];
+      std::memcpy (words, coordinates, sizeof(words));
+      combine (words[0]);
+      combine (words[1]);
+      combine (words[2]);
+    }
+    return hash;
+  }
+
+  // average (squared) distance of the point number `row` to its neighbors
+  double average_distance (std::size_t row, bool squared) const
+  {
+    const int* neighbors = this->neighbors (row);
+    const double* distances = squared_distances (row);
+    double sum = 0.;
+    std::size_t nb = 0;
+    for (std::size_t j = 0; j < m_data->k; ++ j)
+      if (neighbors[j] != -1)
+      {
+        sum += (squared ? distances[j] : std::sqrt (distances[j]));
+        ++ nb;
+      }
+    return (nb == 0 ? 0. : sum / double(nb));
+  }
+
+  // fits a normal to the neighborhood of each point with `fit`
+  template <typename Fitting>
+  void estimate_normals (const Fitting& fit)
+  {
+    update();
+    CGAL_PS3& points = m_point_set.get_data();
+    points.add_normal_map();
+    CGAL_PS3::Vector_map normals = points.normal_map();
+
+    std::vector<std::size_t> rows (m_data->indices.size());
+    for (std::size_t i = 0; i < rows.size(); ++ i)
+      rows[i] = i;
+    CGAL::for_each<SWIG_Point_set_3::Concurrency_tag>
+      (rows, [&](const std::size_t& row) -> bool
+       {
+         std::vector<EPIC_Kernel::Point_3> neighborhood;
+         neighborhood.reserve (m_data->k);
+         const int* neighbors = this->neighbors (row);
+         for (std::size_t j = 0; j < m_data->k; ++ j)
+           if (neighbors[j] != -1)
+             neighborhood.push_back (points.point (Index (neighbors[j])));
+         normals[Index (m_data->indices[row])] = fit (neighborhood);
+         return true;
+       });
+  }
+
+  // Marks the points flagged in `is_outlier` (indexed by point index) in
+  // `outlier_map` (if valid) and removes them if `remove` is true (moved at
+  // the end of the range and removed at once). Returns their number.
+  int apply_outliers (const std::vector<char>& is_outlier,
+                       Point_set_3_wrapper<CGAL_PS3>::Int_map outlier_map, bool remove)
+  {
+    CGAL_PS3& points = m_point_set.get_data();
+    int nb_outliers = 0;
+    for (Index idx : points)
+    {
+      if (outlier_map.is_valid())
+        outlier_map.get_data()[idx] = is_outlier[std::size_t(idx)];
+      nb_outliers += is_outlier[std::size_t(idx)];
+    }
+    if (remove && nb_outliers != 0)
+    {
+      CGAL_PS3::iterator it = std::stable_partition
+        (points.begin(), points.end(),
+         [&](const Index& idx) { return is_outlier[std::size_t(idx)] == 0; });
+      points.remove_from (it);
+    }
+    return nb_outliers;
+  }
+
+public:
+
+  Neighborhood_cache (Point_set_3_wrapper<CGAL_PS3> point_set, int k)
+    : m_point_set (point_set), m_data (new Data())
+  {
+    if (k < 1)
+      throw std::invalid_argument("Number of neighbors must be positive");
+    m_data->k = std::size_t(k);
+    m_data->signature = 0;
+    m_data->built = false;
+    update();
+  }
+
+  int k() const { return int(m_data->k); }
+  int size() const { return int(m_data->indices.size()); }
+
+  bool is_up_to_date() const
+  {
+    return m_data->built && m_data->signature == compute_signature();
+  }
+
+  // Recomputes the neighbors if the points changed. Returns true if rebuilt.
+  bool update()
+  {
+    std::uint64_t signature = compute_signature();
+    if (m_data->built && m_data->signature == signature)
+      return false;
+
+    const CGAL_PS3& points = m_point_set.get_data();
+    const std::size_t k = m_data->k;
+    const std::size_t nb_points = points.size();
+
+    m_data->indices.clear();
+    m_data->indices.reserve (nb_points);
+    for (Index idx : points)
+      m_data->indices.push_back (int(idx));
+    std::shared_ptr<std::vector<int> > neighbors
+      = std::make_shared<std::vector<int> >(nb_points * k, -1);
+    std::shared_ptr<std::vector<double> > squared_distances
+      = std::make_shared<std::vector<double> >(nb_points * k, 0.);
+
+    Tree tree (points.begin(), points.end(), Tree::Splitter(), Traits (points.point_map()));
+    tree.build();  // the tree must be built before concurrent queries
+    Distance distance (points.point_map());
+
+    std::vector<std::size_t> rows (nb_points);
+    for (std::size_t i = 0; i < nb_points; ++ i)
+      rows[i] = i;
+
+    CGAL::for_each<SWIG_Point_set_3::Concurrency_tag>
+      (rows, [&](const std::size_t& row) -> bool
+       {
+         const Index query = Index (m_data->indices[row]);
+         // as in the functions of CGAL, the query point is its own first neighbor
+         Neighbor_search search (tree, points.point(query), unsigned(k), 0, true, distance);
+         std::size_t n = 0;
+         for (auto it = search.begin(); it != search.end() && n < k; ++ it)
+         {
+           (*neighbors)[row * k + n] = int(it->first);
+           (*squared_distances)[row * k + n] = it->second;
+           ++ n;
+         }
+         return true;
+       });
+
+    m_data->neighbors = neighbors;
+    m_data->squared_distances = squared_distances;
+    m_data->signature = signature;
+    m_data->built = true;
+    return true;
+  }
+
+  // (size, k) array of the neighbor indices of the points in iteration
+  // order (-1 if the point set has less than k points)
+  SWIG_CGAL::Buffer<int> neighbor_array() const
+  {
+    return SWIG_CGAL::Buffer<int> (m_data->neighbors->data(), m_data->indices.size(),
+                                   m_data->k, m_data->neighbors, true);
+  }
+
+  // (size, k) array of the squared distances to the neighbors
+  SWIG_CGAL::Buffer<double> squared_distance_array() const
+  {
+    return SWIG_CGAL::Buffer<double> (m_data->squared_distances->data(), m_data->indices.size(),
+                                      m_data->k, m_data->squared_distances, true);
+  }
+
+  // same as CGAL::compute_average_spacing() with k neighbors
+  double compute_average_spacing()
+  {
+    update();
+    const std::size_t nb_points = m_data->indices.size();
+    if (nb_points == 0)
+      return 0.;
+    double sum = 0.;
+    for (std::size_t row = 0; row < nb_points; ++ row)
+      sum += average_distance (row, false);
+    return sum / double(nb_points);
+  }
+
+  // same as CGAL::pca_estimate_normals() with k neighbors
+  void pca_estimate_normals()
+  {
+    estimate_normals ([&](const std::vector<EPIC_Kernel::Point_3>& neighborhood)
+                      {
+                        EPIC_Kernel::Plane_3 plane;
+                        CGAL::linear_least_squares_fitting_3
+                          (neighborhood.begin(), neighborhood.end(), plane, CGAL::Dimension_tag<0>());
+                        return plane.orthogonal_vector();
+                      });
+  }
+
+  // same as CGAL::jet_estimate_normals() with k neighbors
+  void jet_estimate_normals (int degree_fitting = 2)
+  {
+    typedef CGAL::Monge_via_jet_fitting<EPIC_Kernel> Monge_jet_fitting;
+    estimate_normals ([&](const std::vector<EPIC_Kernel::Point_3>& neighborhood)
+                      {
+                        Monge_jet_fitting monge_fit;
+                        typename Monge_jet_fitting::Monge_form monge_form
+                          = monge_fit (neighborhood.begin(), neighborhood.end(), degree_fitting, 1);
+                        return monge_form.normal_direction();
+                      });
+  }
+
+  // Same as CGAL::remove_outliers() with k neighbors: removes at most
+  // `threshold_percent` percents of the points, those with the largest
+  // average squared distance to their neighbors if larger than
+  // `threshold_distance` squared.
+  void remove_outliers (double threshold_percent = 10., double threshold_distance = 0.)
+  {
+    update();
+    CGAL_PS3& points = m_point_set.get_data();
+    const std::size_t nb_points = m_data->indices.size();
+
+    std::vector<std::pair<double, int> > scores (nb_points);
+    for (std::size_t row = 0; row < nb_points; ++ row)
+      scores[row] = std::make_pair (average_distance (row, true), m_data->indices[row]);
+
+    std::size_t nb_removed = std::size_t (double(nb_points) * threshold_percent / 100.);
+    nb_removed = (std::min) (nb_removed, nb_points);
+    std::partial_sort (scores.begin(), scores.begin() + nb_removed, scores.end(),
+                       std::greater<std::pair<double, int> >());
+    const double threshold = threshold_distance * threshold_distance;
+    std::size_t first_kept = 0;
+    while (first_kept < nb_removed && scores[first_kept].first > threshold)
+      ++ first_kept;
+    if (first_kept == 0)
+      return;
+
+    std::vector<char> is_outlier (points.size() + points.garbage_size(), 0);
+    for (std::size_t i = 0; i < first_kept; ++ i)
+      is_outlier[std::size_t(scores[i].second)] = 1;
+    apply_outliers (is_outlier, Point_set_3_wrapper<CGAL_PS3>::Int_map(), true);
+  }
+
+  // Writes in `scores` the average distance of each point to its k
+  // neighbors (the score used by remove_outliers(), not squared)
+  void compute_outlier_scores (Point_set_3_wrapper<CGAL_PS3>::Float_map scores)
+  {
+    if (!scores.is_valid())
+      throw std::invalid_argument("Invalid property map");
+    update();
+    std::vector<std::size_t> rows (m_data->indices.size());
+    for (std::size_t i = 0; i < rows.size(); ++ i)
+      rows[i] = i;
+    CGAL::for_each<SWIG_Point_set_3::Concurrency_tag>
+      (rows, [&](const std::size_t& row) -> bool
+       {
+         scores.get_data()[Index (m_data->indices[row])] = average_distance (row, false);
+         return true;
+       });
+  }
+
+  // Statistical mode: the outliers are the points whose average distance to
+  // their k neighbors is larger than the mean of this distance over the
+  // point set plus `std_ratio` standard deviations. The distances are
+  // written in `scores` and the outliers are marked 1 in `outlier_map`
+  // (if valid), and removed if `remove` is true. Returns the number of outliers.
+  int remove_statistical_outliers (double std_ratio = 2.,
+                                   Point_set_3_wrapper<CGAL_PS3>::Float_map
+                                   scores = Point_set_3_wrapper<CGAL_PS3>::Float_map(),
+                                   Point_set_3_wrapper<CGAL_PS3>::Int_map
+                                   outlier_map = Point_set_3_wrapper<CGAL_PS3>::Int_map(),
+                                   bool remove = true)
+  {
+    update();
+    const std::size_t nb_points = m_data->indices.size();
+    if (nb_points == 0)
+      return 0;
+    std::vector<double> distances (nb_points);
+    std::vector<std::size_t> rows (nb_points);
+    for (std::size_t i = 0; i < nb_points; ++ i)
+      rows[i] = i;
+    CGAL::for_each<SWIG_Point_set_3::Concurrency_tag>
+      (rows, [&](const std::size_t& row) -> bool
+       {
+         distances[row] = average_distance (row, false);
+         return true;
+       });
+
+    double mean = 0.;
+    for (double d : distances)
+      mean += d;
+    mean /= double(nb_points);
+    double variance = 0.;
+    for (double d : distances)
+      variance += (d - mean) * (d - mean);
+    const double threshold = mean + std_ratio * std::sqrt (variance / double(nb_points));
+
+    CGAL_PS3& points = m_point_set.get_data();
+    std::vector<char> is_outlier (points.size() + points.garbage_size(), 0);
+    for (std::size_t row = 0; row < nb_points; ++ row)
+    {
+      const Index idx (m_data->indices[row]);
+      if (scores.is_valid())
+        scores.get_data()[idx] = distances[row];
+      is_outlier[std::size_t(idx)] = (distances[row] > threshold ? 1 : 0);
+    }
+    return apply_outliers (is_outlier, outlier_map, remove);
+  }
+
+  // Radius mode: the outliers are the points having less than
+  // `minimum_neighbors` of their k neighbors (themselves excluded) closer
+  // than `radius`. Same outputs as remove_statistical_outliers().
+  int remove_radius_outliers (double radius, int minimum_neighbors,
+                              Point_set_3_wrapper<CGAL_PS3>::Int_map
+                              outlier_map = Point_set_3_wrapper<CGAL_PS3>::Int_map(),
+                              bool remove = true)
+  {
+    if (minimum_neighbors >= int(m_data->k))
+      throw std::invalid_argument("The minimum number of neighbors must be smaller than k");
+    update();
+    CGAL_PS3& points = m_point_set.get_data();
+    const std::size_t nb_points = m_data->indices.size();
+    const double squared_radius = radius * radius;
+    std::vector<char> is_outlier (points.size() + points.garbage_size(), 0);
+    std::vector<std::size_t> rows (nb_points);
+    for (std::size_t i = 0; i < nb_points; ++ i)
+      rows[i] = i;
+    CGAL::for_each<SWIG_Point_set_3::Concurrency_tag>
+      (rows, [&](const std::size_t& row) -> bool
+       {
+         const int* neighbors = this->neighbors (row);
+         const double* distances = squared_distances (row);
+         int nb = 0;
+         // the first neighbor is the point itself
+         for (std::size_t j = 1; j < m_data->k; ++ j)
+           if (neighbors[j] != -1 && distances[j] <= squared_radius)
+             ++ nb;
+         is_outlier[std::size_t(m_data->indices[row])] = (nb < minimum_neighbors ? 1 : 0);
+         return true;
+       });
+    return apply_outliers (is_outlier, outlier_map, remove);
+  }
+
+#ifndef SWIG
+  const Point_set_3_wrapper<CGAL_PS3>& point_set() const { return m_point_set; }
+  const std::vector<int>& indices() const { return m_data->indices; }
+  // neighbors of the point number `row` in iteration order
+  const int* neighbors (std::size_t row) const { return m_data->neighbors->data() + row * m_data->k; }
+  const double* squared_distances (std::size_t row) const
+  {
+    return m_data->squared_distances->data() + row * m_data->k;
+  }
+  bool shares_point_set (const Point_set_3_wrapper<CGAL_PS3>& other) const
+  {
+    return &(other.get_data()) == &(m_point_set.get_data());
+  }
+#endif
+};
+
+} // end namespace CGAL_SWIG
+
+#endif //SWIG_CGAL_POINT_SET_PROCESSING_3_NEIGHBORHOOD_CACHE_H
@@ -0,0 +1,160 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+#ifndef SWIG_CGAL_POINT_SET_PROCESSING_3_PIPELINE_H
+#define SWIG_CGAL_POINT_SET_PROCESSING_3_PIPELINE_H
+
+#include <SWIG_CGAL/Common/Buffer.h>
+#include <SWIG_CGAL/Common/Cancellation_token.h>
+#include <SWIG_CGAL/Point_set_processing_3/functions.h>
+#include <SWIG_CGAL/Point_set_processing_3/Neighborhood_cache.h>
+
+#include <boost/shared_ptr.hpp>
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace CGAL_SWIG {
+
+// Chain of point set processing stages, described once and run in a single
+// call. Removed points are only collected at the end of the run (by
+// Point_set_3::compact(), unless `collect_garbage` is false), and the
+// stages working on the same k nearest neighbors share a Neighborhood_cache
+// (rebuilt only when a previous stage moved or removed points). The
+// duration of each stage of the last run is returned by timings(). A
+// cancelled `token` stops the run (and throws) at the latest between stages.
+class Point_set_pipeline
+{
+#ifndef SWIG
+  enum Stage_type
+  {
+    REMOVE_OUTLIERS, GRID_SIMPLIFY, RANDOM_SIMPLIFY, JET_SMOOTH,
+    JET_ESTIMATE_NORMALS, PCA_ESTIMATE_NORMALS, MST_ORIENT_NORMALS
+  };
+
+  struct Stage
+  {
+    Stage_type type;
+    std::string name;
+    int k;
+    double p0, p1;
+    int i0, i1;
+  };
+#endif
+
+  std::vector<Stage> m_stages;
+  std::vector<double> m_timings;
+
+  void add (Stage_type type, const std::string& name, int k = 0,
+            double p0 = 0., double p1 = 0., int i0 = 0, int i1 = 0)
+  {
+    Stage stage = { type, name, k, p0, p1, i0, i1 };
+    m_stages.push_back (stage);
+  }
+
+public:
+
+  void add_remove_outliers (int k, double threshold_percent = 10.,
+                            double threshold_distance = 0.)
+  {
+    add (REMOVE_OUTLIERS, "remove_outliers", k, threshold_percent, threshold_distance);
+  }
+  void add_grid_simplify_point_set (double epsilon)
+  {
+    add (GRID_SIMPLIFY, "grid_simplify_point_set", 0, epsilon);
+  }
+  void add_random_simplify_point_set (double removed_percentage)
+  {
+    add (RANDOM_SIMPLIFY, "random_simplify_point_set", 0, removed_percentage);
+  }
+  void add_jet_smooth_point_set (int k, int degree_fitting = 2, int degree_monge = 2)
+  {
+    add (JET_SMOOTH, "jet_smooth_point_set", k, 0., 0., degree_fitting, degree_monge);
+  }
+  void add_jet_estimate_normals (int k, int degree_fitting = 2)
+  {
+    add (JET_ESTIMATE_NORMALS, "jet_estimate_normals", k, 0., 0., degree_fitting);
+  }
+  void add_pca_estimate_normals (int k)
+  {
+    add (PCA_ESTIMATE_NORMALS, "pca_estimate_normals", k);
+  }
+  void add_mst_orient_normals (int k)
+  {
+    add (MST_ORIENT_NORMALS, "mst_orient_normals", k);
+  }
+
+  int number_of_stages() const { return int(m_stages.size()); }
+  void clear() { m_stages.clear(); m_timings.clear(); }
+
+  boost::shared_ptr<std::vector<std::string> > stage_names() const
+  {
+    boost::shared_ptr<std::vector<std::string> > out (new std::vector<std::string>());
+    for (const Stage& s : m_stages)
+      out->push_back (s.name);
+    return out;
+  }
+
+  // duration in seconds of each stage of the last run
+  SWIG_CGAL::Buffer<double> timings() const
+  {
+    return SWIG_CGAL::Buffer<double> (std::vector<double>(m_timings));
+  }
+
+  void run (Point_set_3_wrapper<CGAL_PS3> point_set, bool collect_garbage = true,
+            SWIG_CGAL::Cancellation_token token = SWIG_CGAL::Cancellation_token())
+  {
+    typedef std::chrono::steady_clock Clock;
+
+    std::unique_ptr<Neighborhood_cache> cache;
+    auto cache_for = [&](int k) -> Neighborhood_cache&
+    {
+      if (!cache || cache->k() != k)
+        cache.reset (new Neighborhood_cache (point_set, k));
+      return *cache;
+    };
+
+    m_timings.clear();
+    for (const Stage& s : m_stages)
+    {
+      token.throw_if_cancelled();
+      Clock::time_point start = Clock::now();
+      switch (s.type)
+      {
+      case REMOVE_OUTLIERS:
+        cache_for (s.k).remove_outliers (s.p0, s.p1);
+        break;
+      case GRID_SIMPLIFY:
+        grid_simplify_point_set (point_set, s.p0);
+        break;
+      case RANDOM_SIMPLIFY:
+        random_simplify_point_set (point_set, s.p0);
+        break;
+      case JET_SMOOTH:
+        jet_smooth_point_set (point_set, s.k, 0., s.i0, s.i1, token);
+        break;
+      case JET_ESTIMATE_NORMALS:
+        cache_for (s.k).jet_estimate_normals (s.i0);
+        break;
+      case PCA_ESTIMATE_NORMALS:
+        cache_for (s.k).pca_estimate_normals();
+        break;
+      case MST_ORIENT_NORMALS:
+        mst_orient_normals (point_set, s.k);
+        break;
+      }
+      m_timings.push_back (std::chrono::duration<double>(Clock::now() - start).count());
+    }
+
+    if (collect_garbage)
+      point_set.compact();
+  }
+};
+
+} // end namespace CGAL_SWIG
+
+#endif //SWIG_CGAL_POINT_SET_PROCESSING_3_PIPELINE_H
@@ -0,0 +1,232 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+#ifndef SWIG_CGAL_POINT_SET_PROCESSING_3_STREAMING_GRID_SIMPLIFICATION_H
+#define SWIG_CGAL_POINT_SET_PROCESSING_3_STREAMING_GRID_SIMPLIFICATION_H
+
+#include <SWIG_CGAL/Common/Buffer.h>
+#include <SWIG_CGAL/Common/Cancellation_token.h>
+#include <SWIG_CGAL/Point_set_3/Point_set_3.h>
+#include <SWIG_CGAL/Point_set_3/Point_set_3_chunk_reader.h>
+#include <SWIG_CGAL/Point_set_processing_3/functions.h>
+
+#include <CGAL/for_each.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace CGAL_SWIG {
+
+// Grid simplification of a point set given by blocks (chunks of a
+// Point_set_3_chunk_reader, arrays...), that only keeps in memory one
+// representative point per occupied cell of side `epsilon`. The
+// representative of a cell is the first inserted point of the cell (as
+// grid_simplify_point_set() keeps the first point of each cell of a point
+// set), whatever the number of threads. The points of a block are inserted
+// in parallel in a hash map of cells split into `number_of_shards` shards,
+// each with its own lock. Only the points and normals are kept.
+class Streaming_grid_simplify_point_set
+{
+#ifndef SWIG
+  typedef EPIC_Kernel::Point_3 Point;
+  typedef EPIC_Kernel::Vector_3 Vector;
+  typedef std::array<std::int64_t, 3> Cell;
+
+  struct Cell_hash
+  {
+    std::size_t operator() (const Cell& c) const
+    {
+      std::uint64_t h = std::uint64_t(c[0]) * 73856093u;
+      h ^= std::uint64_t(c[1]) * 19349663u;
+      h ^= std::uint64_t(c[2]) * 83492791u;
+      return std::size_t(h ^ (h >> 29));
+    }
+  };
+
+  struct Sample
+  {
+    Point point;
+    Vector normal;
+    std::uint64_t rank;  // position of the point in the input
+  };
+
+  struct Shard
+  {
+    std::mutex mutex;
+    std::unordered_map<Cell, Sample, Cell_hash> cells;
+  };
+
+  // points are hashed and inserted by blocks, each block locking each
+  // shard at most once
+  static const std::size_t block_size = 1 << 12;
+
+  double m_epsilon;
+  std::vector<std::unique_ptr<Shard> > m_shards;
+  std::uint64_t m_nb_inserted;
+  bool m_has_normals;
+
+  Cell cell_of (const Point& p) const
+  {
+    return {{ std::int64_t(std::floor(p.x() / m_epsilon)),
+              std::int64_t(std::floor(p.y() / m_epsilon)),
+              std::int64_t(std::floor(p.z() / m_epsilon)) }};
+  }
+
+  // inserts the points get(0) ... get(n-1), `get(i, sample)` filling the
+  // point and normal of the sample
+  template <class Get>
+  void insert_samples (std::size_t n, Get get, const SWIG_CGAL::Cancellation_token& token)
+  {
+    const std::uint64_t first_rank = m_nb_inserted;
+    std::vector<std::size_t> blocks ((n + block_size - 1) / block_size);
+    for (std::size_t b = 0; b < blocks.size(); ++ b)
+      blocks[b] = b;
+    CGAL::for_each<Concurrency_tag>
+      (blocks, [&](std::size_t b) -> bool
+       {
+         if (token.is_cancelled())
+           return false;
+         std::vector<std::vector<std::pair<Cell, Sample> > > per_shard (m_shards.size());
+         const std::size_t last = std::min (n, (b + 1) * block_size);
+         for (std::size_t i = b * block_size; i < last; ++ i)
+         {
+           Sample s;
+           get (i, s);
+           s.rank = first_rank + i;
+           const Cell c = cell_of (s.point);
+           per_shard[Cell_hash()(c) % m_shards.size()].push_back (std::make_pair (c, s));
+         }
+         for (std::size_t sh = 0; sh < per_shard.size(); ++ sh)
+         {
+           if (per_shard[sh].empty())
+             continue;
+           Shard& shard = *m_shards[sh];
+           std::lock_guard<std::mutex> lock (shard.mutex);
+           for (const std::pair<Cell, Sample>& cs : per_shard[sh])
+           {
+             auto inserted = shard.cells.insert (cs);
+             if (!inserted.second && cs.second.rank < inserted.first->second.rank)
+               inserted.first->second = cs.second;
+           }
+         }
+         return true;
+       });
+    m_nb_inserted += n;
+    token.throw_if_cancelled();
+  }
+#endif
+
+public:
+
+  Streaming_grid_simplify_point_set (double epsilon, int number_of_shards = 64)
+    : m_epsilon (epsilon), m_nb_inserted (0), m_has_normals (false)
+  {
+    if (epsilon <= 0.)
+      throw std::invalid_argument("The cell size must be positive");
+    m_shards.resize (std::size_t (std::max (1, number_of_shards)));
+    for (std::unique_ptr<Shard>& shard : m_shards)
+      shard.reset (new Shard());
+  }
+
+  double epsilon() const { return m_epsilon; }
+  // number of points inserted so far
+  long long number_of_input_points() const { return (long long)(m_nb_inserted); }
+  // number of occupied cells, that is of points of the result
+  int number_of_cells() const
+  {
+    std::size_t n = 0;
+    for (const std::unique_ptr<Shard>& shard : m_shards)
+      n += shard->cells.size();
+    return int(n);
+  }
+
+  // inserts the points (and normals, if any) of `points`
+  void insert (Point_set_3_wrapper<CGAL_PS3> points,
+               SWIG_CGAL::Cancellation_token token = SWIG_CGAL::Cancellation_token())
+  {
+    const CGAL_PS3& ps = points.get_data();
+    const bool normals = ps.has_normal_map();
+    m_has_normals = m_has_normals || normals;
+    const std::vector<CGAL_PS3::Index> indices (ps.begin(), ps.end());
+    insert_samples (indices.size(), [&](std::size_t i, Sample& s)
+                    {
+                      s.point = ps.point(indices[i]);
+                      s.normal = (normals ? ps.normal(indices[i]) : Vector (CGAL::NULL_VECTOR));
+                    }, token);
+  }
+
+  // inserts the rows of an (N, 3) array of coordinates
+  void insert_array (SWIG_CGAL::Buffer<double> points,
+                     SWIG_CGAL::Cancellation_token token = SWIG_CGAL::Cancellation_token())
+  {
+    if (points.size() % 3 != 0)
+      throw std::invalid_argument("Coordinate arrays must contain 3 values per point");
+    insert_samples (points.size() / 3, [&](std::size_t i, Sample& s)
+                    {
+                      s.point = Point (points[3 * i], points[3 * i + 1], points[3 * i + 2]);
+                      s.normal = Vector (CGAL::NULL_VECTOR);
+                    }, token);
+  }
+
+  // inserts all the points of a file read by blocks of `chunk_size` points
+  // by a Point_set_3_chunk_reader; returns the number of points read
+  long long insert_file (const std::string& file, int chunk_size = 1000000,
+                         SWIG_CGAL::Cancellation_token token = SWIG_CGAL::Cancellation_token())
+  {
+    Point_set_3_chunk_reader<CGAL_PS3> reader (file, chunk_size);
+    long long nb_read = 0;
+    for (Point_set_3_wrapper<CGAL_PS3> chunk = reader.next(); !chunk.get_data().empty();
+         chunk = reader.next())
+    {
+      nb_read += (long long)(chunk.get_data().size());
+      insert (chunk, token);
+    }
+    return nb_read;
+  }
+
+  // representatives of the cells, in the order of the input
+  Point_set_3_wrapper<CGAL_PS3> result() const
+  {
+    std::vector<const Sample*> samples;
+    samples.reserve (std::size_t (number_of_cells()));
+    for (const std::unique_ptr<Shard>& shard : m_shards)
+      for (const auto& cs : shard->cells)
+        samples.push_back (&cs.second);
+    std::sort (samples.begin(), samples.end(),
+               [](const Sample* a, const Sample* b) { return a->rank < b->rank; });
+
+    Point_set_3_wrapper<CGAL_PS3> out (m_has_normals);
+    CGAL_PS3& ps = out.get_data();
+    ps.reserve (samples.size());
+    for (const Sample* s : samples)
+    {
+      if (m_has_normals)
+        ps.insert (s->point, s->normal);
+      else
+        ps.insert (s->point);
+    }
+    return out;
+  }
+
+  void clear()
+  {
+    for (std::unique_ptr<Shard>& shard : m_shards)
+      std::unordered_map<Cell, Sample, Cell_hash>().swap (shard->cells);
+    m_nb_inserted = 0;
+    m_has_normals = false;
+  }
+};
+
+} // end namespace CGAL_SWIG
+
+#endif //SWIG_CGAL_POINT_SET_PROCESSING_3_STREAMING_GRID_SIMPLIFICATION_H
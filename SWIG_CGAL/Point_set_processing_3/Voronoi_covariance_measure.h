@@ -0,0 +1,407 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+#ifndef SWIG_CGAL_POINT_SET_PROCESSING_3_VORONOI_COVARIANCE_MEASURE_H
+#define SWIG_CGAL_POINT_SET_PROCESSING_3_VORONOI_COVARIANCE_MEASURE_H
+
+#include <SWIG_CGAL/Common/Buffer.h>
+#include <SWIG_CGAL/Common/Cancellation_token.h>
+#include <SWIG_CGAL/Point_set_processing_3/functions.h>
+#include <SWIG_CGAL/Triangulation_3/all_includes.h>
+
+#include <CGAL/Default_diagonalize_traits.h>
+#include <CGAL/Fuzzy_sphere.h>
+#include <CGAL/Orthogonal_k_neighbor_search.h>
+#include <CGAL/Search_traits_3.h>
+#include <CGAL/Search_traits_adapter.h>
+#include <CGAL/for_each.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+typedef Delaunay_triangulation_3_wrapper<CGAL_PDT3,
+                                         SWIG_Triangulation_3::CGAL_Vertex_handle<CGAL_PDT3,Point_3>,
+                                         SWIG_Triangulation_3::CGAL_Cell_handle<CGAL_PDT3,Point_3> >
+  Parallel_Delaunay_triangulation_3_SWIG_wrapper;
+
+namespace CGAL_SWIG {
+
+#ifndef SWIG
+namespace internal {
+
+// Convex polytope given by its faces, in coordinates relative to a point
+typedef std::vector<EPIC_Kernel::Vector_3> Vcm_polygon;
+typedef std::vector<Vcm_polygon> Vcm_polytope;
+
+// Intersection of `polytope` with the halfspace x * n <= d. The new face
+// is made of the points of the edges crossing the plane, sorted by angle.
+inline void clip_polytope (Vcm_polytope& polytope, const EPIC_Kernel::Vector_3& n, double d)
+{
+  typedef EPIC_Kernel::Vector_3 Vector;
+  Vcm_polytope out;
+  Vcm_polygon cap;
+  out.reserve (polytope.size() + 1);
+  for (const Vcm_polygon& face : polytope)
+  {
+    Vcm_polygon clipped;
+    for (std::size_t i = 0; i < face.size(); ++ i)
+    {
+      const Vector& a = face[i];
+      const Vector& b = face[(i + 1) % face.size()];
+      const double da = a * n - d;
+      const double db = b * n - d;
+      if (da <= 0.)
+        clipped.push_back (a);
+      if (da == 0.)
+        cap.push_back (a);
+      else if ((da < 0.) != (db < 0.) && db != 0.)
+      {
+        const Vector x = a + (b - a) * (da / (da - db));
+        clipped.push_back (x);
+        cap.push_back (x);
+      }
+    }
+    if (clipped.size() >= 3)
+      out.push_back (clipped);
+  }
+  if (cap.size() >= 3)
+  {
+    Vector centroid = CGAL::NULL_VECTOR;
+    for (const Vector& x : cap)
+      centroid = centroid + x;
+    centroid = centroid / double(cap.size());
+    const double length = std::sqrt ((cap[0] - centroid).squared_length());
+    if (length == 0.)
+    {
+      polytope.swap (out);
+      return;
+    }
+    const Vector u = (cap[0] - centroid) / length;
+    const Vector v = CGAL::cross_product (n, u);
+    std::sort (cap.begin(), cap.end(), [&](const Vector& a, const Vector& b)
+               {
+                 return std::atan2 ((a - centroid) * v, (a - centroid) * u)
+                   < std::atan2 ((b - centroid) * v, (b - centroid) * u);
+               });
+    out.push_back (cap);
+  }
+  polytope.swap (out);
+}
+
+// Dodecahedron whose inscribed sphere is the ball of radius `radius`
+// centered on the origin, the discretization of the offset of a point
+inline Vcm_polytope ball_polytope (double radius)
+{
+  typedef EPIC_Kernel::Vector_3 Vector;
+  const double r = 2. * radius;
+  const std::array<Vector, 8> c
+    = {{ Vector(-r,-r,-r), Vector(r,-r,-r), Vector(r,r,-r), Vector(-r,r,-r),
+         Vector(-r,-r,r), Vector(r,-r,r), Vector(r,r,r), Vector(-r,r,r) }};
+  Vcm_polytope polytope
+    = { { c[0], c[3], c[2], c[1] }, { c[4], c[5], c[6], c[7] }, { c[0], c[1], c[5], c[4] },
+        { c[2], c[3], c[7], c[6] }, { c[1], c[2], c[6], c[5] }, { c[0], c[4], c[7], c[3] } };
+  const double phi = (1. + std::sqrt (5.)) / 2.;
+  for (int s0 = -1; s0 <= 1; s0 += 2)
+    for (int s1 = -1; s1 <= 1; s1 += 2)
+    {
+      const std::array<Vector, 3> normals
+        = {{ Vector(0., s0, s1 * phi), Vector(s0, s1 * phi, 0.), Vector(s1 * phi, 0., s0) }};
+      for (const Vector& n : normals)
+        clip_polytope (polytope, n, radius * std::sqrt (n.squared_length()));
+    }
+  return polytope;
+}
+
+// Covariance (xx, xy, xz, yy, yz, zz) of a convex polytope containing the
+// origin, summed over the tetrahedra joining the origin to its faces
+inline std::array<double, 6> polytope_covariance (const Vcm_polytope& polytope)
+{
+  typedef EPIC_Kernel::Vector_3 Vector;
+  std::array<double, 6> cov = {{ 0., 0., 0., 0., 0., 0. }};
+  for (const Vcm_polygon& face : polytope)
+    for (std::size_t i = 1; i + 1 < face.size(); ++ i)
+    {
+      const Vector& a = face[0];
+      const Vector& b = face[i];
+      const Vector& c = face[i + 1];
+      const double w = std::abs (CGAL::determinant (a, b, c)) / 120.;
+      const Vector s = a + b + c;
+      const std::array<const Vector*, 4> terms = {{ &a, &b, &c, &s }};
+      for (const Vector* t : terms)
+      {
+        const Vector& x = *t;
+        cov[0] += w * x.x() * x.x(); cov[1] += w * x.x() * x.y(); cov[2] += w * x.x() * x.z();
+        cov[3] += w * x.y() * x.y(); cov[4] += w * x.y() * x.z(); cov[5] += w * x.z() * x.z();
+      }
+    }
+  return cov;
+}
+
+} // namespace internal
+#endif
+
+// Voronoi covariance measure (VCM) of a point set, as used by
+// vcm_estimate_normals(): the covariance of the Voronoi cell of each point
+// intersected with a ball of radius `offset_radius` (the offset covariance),
+// convolved by the sum over the neighbors of each point. The offset
+// covariances, the costly part, are computed once by compute() and shared by
+// all the convolutions, from a Delaunay triangulation built concurrently, or
+// given to compute_in_triangulation() to reuse it. The cells are computed in
+// parallel, each one by clipping a discretized ball by the bisectors with the
+// neighbors of the point in the triangulation. Covariances are given as
+// (xx, xy, xz, yy, yz, zz), in the iteration order of the point set.
+class Voronoi_covariance_measure
+{
+#ifndef SWIG
+  typedef CGAL_PS3::Index Index;
+  typedef CGAL_PDT3::Vertex_handle Vertex_handle;
+  typedef CGAL::Search_traits_3<EPIC_Kernel> Traits_base;
+  typedef CGAL::Search_traits_adapter<Index, CGAL_PS3::Point_map, Traits_base> Traits;
+  typedef CGAL::Orthogonal_k_neighbor_search<Traits> Neighbor_search;
+  typedef Neighbor_search::Tree Tree;
+  typedef Neighbor_search::Distance Distance;
+  typedef CGAL::Fuzzy_sphere<Traits> Sphere;
+#endif
+
+  Point_set_3_wrapper<CGAL_PS3> m_point_set;
+  double m_offset_radius;
+  std::vector<Index> m_indices;
+  std::shared_ptr<std::vector<double> > m_covariances;
+
+#ifndef SWIG
+  static void insert_points (CGAL_PDT3& dt, const CGAL_PS3& points)
+  {
+#ifdef CGAL_LINKED_WITH_TBB
+    if (dt.get_lock_data_structure() == nullptr && !points.empty())
+    {
+      // the threads lock the cells they modify with a grid covering the points
+      const CGAL::Bbox_3 bbox = CGAL::bbox_3 (points.points().begin(), points.points().end());
+      CGAL_PDT3::Lock_data_structure lock_ds (bbox, 50);
+      dt.set_lock_data_structure (&lock_ds);
+      dt.insert (points.points().begin(), points.points().end());
+      dt.set_lock_data_structure (nullptr);
+      return;
+    }
+#endif
+    dt.insert (points.points().begin(), points.points().end());
+  }
+
+  void compute_offset_covariances (const CGAL_PDT3& dt, const SWIG_CGAL::Cancellation_token& token)
+  {
+    const CGAL_PS3& points = m_point_set.get_data();
+    m_indices.assign (points.begin(), points.end());
+
+    // vertex of each point, found by a binary search among the sorted vertices
+    std::vector<Vertex_handle> vertices;
+    vertices.reserve (dt.number_of_vertices());
+    for (CGAL_PDT3::Finite_vertices_iterator v = dt.finite_vertices_begin();
+         v != dt.finite_vertices_end(); ++ v)
+      vertices.push_back (v);
+    std::sort (vertices.begin(), vertices.end(), [](const Vertex_handle& a, const Vertex_handle& b)
+               { return a->point() < b->point(); });
+
+    const internal::Vcm_polytope ball = internal::ball_polytope (m_offset_radius);
+    std::shared_ptr<std::vector<double> > covariances
+      = std::make_shared<std::vector<double> >(6 * m_indices.size(), 0.);
+    std::vector<std::size_t> rows (m_indices.size());
+    for (std::size_t i = 0; i < rows.size(); ++ i)
+      rows[i] = i;
+
+    std::atomic<bool> missing (false);
+    CGAL::for_each<Concurrency_tag>
+      (rows, [&](std::size_t row) -> bool
+       {
+         if (token.is_cancelled() || missing)
+           return false;
+         const EPIC_Kernel::Point_3& p = points.point (m_indices[row]);
+         auto found = std::lower_bound (vertices.begin(), vertices.end(), p,
+                                        [](const Vertex_handle& v, const EPIC_Kernel::Point_3& q)
+                                        { return v->point() < q; });
+         if (found == vertices.end() || (*found)->point() != p)
+         {
+           missing = true;
+           return false;
+         }
+
+         // incident_cells() marks the cells, the threadsafe variant does not
+         std::vector<CGAL_PDT3::Cell_handle> cells;
+         dt.incident_cells_threadsafe (*found, std::back_inserter (cells));
+         std::vector<Vertex_handle> neighbors;
+         for (const CGAL_PDT3::Cell_handle& c : cells)
+           for (int i = 0; i < 4; ++ i)
+             if (c->vertex(i) != *found && !dt.is_infinite (c->vertex(i)))
+               neighbors.push_back (c->vertex(i));
+         std::sort (neighbors.begin(), neighbors.end());
+         neighbors.erase (std::unique (neighbors.begin(), neighbors.end()), neighbors.end());
+
+         internal::Vcm_polytope cell = ball;
+         for (const Vertex_handle& q : neighbors)
+         {
+           const EPIC_Kernel::Vector_3 n = q->point() - p;
+           const double d = n.squared_length() / 2.;
+           // bisectors farther than all the vertices of the cell do not cut it
+           double extent = 0.;
+           for (const internal::Vcm_polygon& face : cell)
+             for (const EPIC_Kernel::Vector_3& x : face)
+               extent = (std::max) (extent, x * n);
+           if (extent > d)
+             internal::clip_polytope (cell, n, d);
+         }
+         const std::array<double, 6> cov = internal::polytope_covariance (cell);
+         std::copy (cov.begin(), cov.end(), covariances->begin() + 6 * row);
+         return true;
+       });
+    token.throw_if_cancelled();
+    if (missing)
+      throw std::invalid_argument("The triangulation does not contain all the points");
+    m_covariances = covariances;
+  }
+
+  // sum of the offset covariances of the neighbors of each point, the
+  // neighbors being the points closer than `convolution_radius` or, if `k`
+  // is positive, the k nearest neighbors
+  std::vector<double> convolve (double convolution_radius, int k,
+                                const SWIG_CGAL::Cancellation_token& token) const
+  {
+    if (!is_computed())
+      throw std::runtime_error("compute() must be called first");
+    if (k <= 0 && convolution_radius <= 0.)
+      throw std::invalid_argument("The convolution radius must be positive");
+    const CGAL_PS3& points = m_point_set.get_data();
+    std::vector<int> row_of (points.size() + points.number_of_removed_points(), -1);
+    for (std::size_t row = 0; row < m_indices.size(); ++ row)
+      row_of[m_indices[row]] = int(row);
+
+    Tree tree (m_indices.begin(), m_indices.end(), Tree::Splitter(), Traits (points.point_map()));
+    tree.build();  // the tree must be built before concurrent queries
+    const Distance distance (points.point_map());
+    std::vector<double> out (m_covariances->size(), 0.);
+    std::vector<std::size_t> rows (m_indices.size());
+    for (std::size_t i = 0; i < rows.size(); ++ i)
+      rows[i] = i;
+
+    CGAL::for_each<Concurrency_tag>
+      (rows, [&](std::size_t row) -> bool
+       {
+         if (token.is_cancelled())
+           return false;
+         const EPIC_Kernel::Point_3& p = points.point (m_indices[row]);
+         std::vector<Index> neighbors;
+         if (k > 0)
+         {
+           Neighbor_search search (tree, p, unsigned(k), 0, true, distance);
+           for (const auto& n : search)
+             neighbors.push_back (n.first);
+         }
+         else
+           tree.search (std::back_inserter (neighbors),
+                        Sphere (m_indices[row], convolution_radius, 0., Traits (points.point_map())));
+         for (Index n : neighbors)
+         {
+           const double* cov = m_covariances->data() + 6 * row_of[n];
+           for (std::size_t i = 0; i < 6; ++ i)
+             out[6 * row + i] += cov[i];
+         }
+         return true;
+       });
+    token.throw_if_cancelled();
+    return out;
+  }
+#endif
+
+public:
+
+  Voronoi_covariance_measure (Point_set_3_wrapper<CGAL_PS3> point_set, double offset_radius)
+    : m_point_set (point_set), m_offset_radius (offset_radius)
+  {
+    if (offset_radius <= 0.)
+      throw std::invalid_argument("The offset radius must be positive");
+  }
+
+  double offset_radius() const { return m_offset_radius; }
+  int size() const { return int(m_indices.size()); }
+  bool is_computed() const { return bool(m_covariances); }
+
+  // Computes the offset covariances with a Delaunay triangulation of the
+  // points built for this call
+  void compute (SWIG_CGAL::Cancellation_token token = SWIG_CGAL::Cancellation_token())
+  {
+    CGAL_PDT3 dt;
+    insert_points (dt, m_point_set.get_data());
+    compute_offset_covariances (dt, token);
+  }
+
+  // Same as compute() with a triangulation containing all the points (and
+  // possibly others). If empty, the points are inserted in `triangulation`,
+  // which can then be reused.
+  void compute_in_triangulation (Parallel_Delaunay_triangulation_3_SWIG_wrapper& triangulation,
+                                 SWIG_CGAL::Cancellation_token token = SWIG_CGAL::Cancellation_token())
+  {
+    CGAL_PDT3& dt = triangulation.get_data();
+    if (dt.number_of_vertices() == 0)
+      insert_points (dt, m_point_set.get_data());
+    compute_offset_covariances (dt, token);
+  }
+
+  // (size, 6) array of the offset covariances
+  SWIG_CGAL::Buffer<double> offset_covariance_array() const
+  {
+    if (!is_computed())
+      throw std::runtime_error("compute() must be called first");
+    return SWIG_CGAL::Buffer<double> (m_covariances->data(), m_indices.size(), 6,
+                                      m_covariances, true);
+  }
+
+  // (size, 6) array of the convolved covariances, the input of sharp
+  // feature detection (see CGAL::vcm_is_on_feature_edge())
+  SWIG_CGAL::Buffer<double> covariance_array (double convolution_radius, int k = 0,
+                                              SWIG_CGAL::Cancellation_token token = SWIG_CGAL::Cancellation_token()) const
+  {
+    return SWIG_CGAL::Buffer<double> (convolve (convolution_radius, k, token), 6);
+  }
+
+  // Normal of each point: the eigenvector of the largest eigenvalue of its
+  // convolved covariance (unoriented)
+  void estimate_normals (double convolution_radius, int k = 0,
+                         SWIG_CGAL::Cancellation_token token = SWIG_CGAL::Cancellation_token())
+  {
+    typedef CGAL::Default_diagonalize_traits<double, 3> Diagonalize_traits;
+    const std::vector<double> cov = convolve (convolution_radius, k, token);
+    CGAL_PS3& points = m_point_set.get_data();
+    points.add_normal_map();
+    std::vector<std::size_t> rows (m_indices.size());
+    for (std::size_t i = 0; i < rows.size(); ++ i)
+      rows[i] = i;
+    CGAL::for_each<Concurrency_tag>
+      (rows, [&](std::size_t row) -> bool
+       {
+         std::array<double, 6> c;
+         std::copy (cov.begin() + 6 * row, cov.begin() + 6 * row + 6, c.begin());
+         std::array<double, 3> n = {{ 0., 0., 0. }};
+         Diagonalize_traits::extract_largest_eigenvector_of_covariance_matrix (c, n);
+         points.normal (m_indices[row]) = EPIC_Kernel::Vector_3 (n[0], n[1], n[2]);
+         return true;
+       });
+  }
+};
+
+// Parallel version of CGAL::vcm_estimate_normals(), with the same parameters
+void vcm_estimate_normals (Point_set_3_wrapper<CGAL_PS3> point_set,
+                           double offset_radius, double convolution_radius, int k = 0)
+{
+  Voronoi_covariance_measure vcm (point_set, offset_radius);
+  vcm.compute();
+  vcm.estimate_normals (convolution_radius, k);
+}
+
+} // end namespace CGAL_SWIG
+
+#endif //SWIG_CGAL_POINT_SET_PROCESSING_3_VORONOI_COVARIANCE_MEASURE_H
@@ -9,6 +9,10 @@
 #include <SWIG_CGAL/Kernel/Point_3.h>
 #include <SWIG_CGAL/Kernel/Vector_3.h>
 #include <SWIG_CGAL/Point_set_3/Point_set_3.h>
+#include <SWIG_CGAL/Common/Buffer.h>
+#include <SWIG_CGAL/Common/Cancellation_token.h>
+#include <SWIG_CGAL/Kernel/Thread_pool.h>
+#include <SWIG_CGAL/Point_set_processing_3/Neighborhood_cache.h>
 
 #include <CGAL/bilateral_smooth_point_set.h>
 #include <CGAL/compute_average_spacing.h>
@@ -22,14 +26,31 @@
 #include <CGAL/pca_estimate_normals.h>
 #include <CGAL/random_simplify_point_set.h>
 #include <CGAL/remove_outliers.h>
-#include <CGAL/vcm_estimate_normals.h>
 #include <CGAL/wlop_simplify_and_regularize_point_set.h>
+#include <CGAL/for_each.h>
+#include <CGAL/linear_least_squares_fitting_3.h>
+#include <CGAL/Monge_via_jet_fitting.h>
+#include <CGAL/Orthogonal_k_neighbor_search.h>
+#include <CGAL/Search_traits_3.h>
 
 #include <CGAL/OpenGR/register_point_sets.h>
 #include <CGAL/pointmatcher/register_point_sets.h>
+#include <CGAL/property_map.h>
+#include <CGAL/Random.h>
+
+#include <array>
+#include <cmath>
+#include <cstdlib>
 #include <vector>
 #include <map>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <stdexcept>
 #include <string>
+#include <thread>
+#include <tuple>
+#include <type_traits>
 
 #ifdef CGAL_LINKED_WITH_TBB
 typedef CGAL::Parallel_tag Concurrency_tag;
@@ -39,14 +60,21 @@ typedef CGAL::Sequential_tag Concurrency_tag;
 
 namespace CGAL_SWIG {
 
+// The functions taking a `token` stop early and throw once it is cancelled.
+// The functions removing points leave them as garbage, unless `compact` is
+// true: the point set is then compacted with Point_set_3::compact().
+
 void bilateral_smooth_point_set (Point_set_3_wrapper<CGAL_PS3> point_set, int k,
                                  double neighbor_radius = 0.,
-                                 double sharpness_angle = 30.)
+                                 double sharpness_angle = 30.,
+                                 SWIG_CGAL::Cancellation_token token = SWIG_CGAL::Cancellation_token())
 {
   CGAL::bilateral_smooth_point_set<Concurrency_tag>
     (point_set.get_data(), k,
      point_set.get_data().parameters().neighbor_radius(neighbor_radius).
-     sharpness_angle(sharpness_angle));
+     sharpness_angle(sharpness_angle).
+     callback(token.callback()));
+  token.throw_if_cancelled();
 }
 
 double compute_average_spacing(Point_set_3_wrapper<CGAL_PS3> point_set, int k)
@@ -54,23 +82,111 @@ double compute_average_spacing(Point_set_3_wrapper<CGAL_PS3> point_set, int k)
   return CGAL::compute_average_spacing<Concurrency_tag> (point_set.get_data(), k);
 }
 
+#ifndef SWIG
+namespace internal {
+
+// Makes the random choices of the CGAL function called in its scope
+// depend only on `seed` (if not negative): the random generators are reset
+// and the calls with a seed are serialized, std::rand being global.
+class Seeded_scope
+{
+  std::unique_lock<std::mutex> m_lock;
+
+  static std::mutex& mutex()
+  {
+    static std::mutex m;
+    return m;
+  }
+
+public:
+  explicit Seeded_scope (int seed)
+  {
+    if (seed < 0)
+      return;
+    m_lock = std::unique_lock<std::mutex> (mutex());
+    std::srand (unsigned(seed));
+    CGAL::get_default_random() = CGAL::Random (unsigned(seed));
+  }
+};
+
+// Output iterator functor inserting points with normals in a point set by
+// blocks of block_size, the capacity of the point set growing geometrically
+class Block_inserter
+{
+  static const std::size_t block_size = 1 << 14;
+  typedef std::pair<EPIC_Kernel::Point_3, EPIC_Kernel::Vector_3> Point_with_normal;
+
+  struct State
+  {
+    CGAL_PS3& point_set;
+    std::size_t capacity;
+    std::vector<Point_with_normal> block;
+
+    State (CGAL_PS3& point_set, std::size_t capacity)
+      : point_set (point_set), capacity (capacity)
+    {
+      point_set.reserve (capacity);
+      block.reserve (block_size);
+    }
+    void flush()
+    {
+      const std::size_t needed = point_set.size() + point_set.number_of_removed_points() + block.size();
+      if (needed > capacity)
+      {
+        capacity = std::max (needed, 2 * capacity);
+        point_set.reserve (capacity);
+      }
+      for (const Point_with_normal& p : block)
+        point_set.insert (p.first, p.second);
+      block.clear();
+    }
+  };
+  std::shared_ptr<State> m_state;
+
+public:
+  // `expected_size` is the expected final size of the point set
+  Block_inserter (CGAL_PS3& point_set, std::size_t expected_size)
+    : m_state (std::make_shared<State>
+               (point_set, std::max (expected_size,
+                                     point_set.size() + point_set.number_of_removed_points()))) { }
+
+  void operator() (const Point_with_normal& p) const
+  {
+    m_state->block.push_back (p);
+    if (m_state->block.size() == block_size)
+      m_state->flush();
+  }
+  // to be called after the output
+  void flush() const { m_state->flush(); }
+};
+
+} // namespace internal
+#endif
+
+// The functions taking a `seed` give the same result for the same seed and
+// input, the parallel loops of their CGAL algorithms being computed per point.
+
 void edge_aware_upsample_point_set (Point_set_3_wrapper<CGAL_PS3> point_set,
                                     double sharpness_angle = 30.,
                                     double edge_sensitivity = 1.,
                                     double neighbor_radius = -1.,
-                                    int number_of_output_points = 1000)
+                                    int number_of_output_points = 1000,
+                                    int seed = -1)
 {
-  CGAL::edge_aware_upsample_point_set<Concurrency_tag>
-    (point_set.get_data(),
-     boost::make_function_output_iterator
-     ([&](const std::pair<EPIC_Kernel::Point_3, EPIC_Kernel::Vector_3>& p)
-      {
-        point_set.get_data().insert (p.first, p.second);
-      }),
-     point_set.get_data().parameters().sharpness_angle(sharpness_angle).
-     edge_sensitivity(edge_sensitivity).
-     neighbor_radius(neighbor_radius).
-     number_of_output_points(number_of_output_points));
+  // the output points are inserted by blocks, in a point set reserved for all of them
+  internal::Block_inserter inserter (point_set.get_data(),
+                                     std::size_t (std::max (0, number_of_output_points)));
+  {
+    internal::Seeded_scope scope (seed);
+    CGAL::edge_aware_upsample_point_set<Concurrency_tag>
+      (point_set.get_data(),
+       boost::make_function_output_iterator (inserter),
+       point_set.get_data().parameters().sharpness_angle(sharpness_angle).
+       edge_sensitivity(edge_sensitivity).
+       neighbor_radius(neighbor_radius).
+       number_of_output_points(number_of_output_points));
+  }
+  inserter.flush();
 }
 
 int estimate_global_k_neighbor_scale (Point_set_3_wrapper<CGAL_PS3> point_set)
@@ -83,118 +199,534 @@ double estimate_global_range_scale (Point_set_3_wrapper<CGAL_PS3> point_set)
   return CGAL::estimate_global_range_scale (point_set.get_data(), point_set.get_data().parameters());
 }
 
-// TODO if needed: estimate local scales
+#ifndef SWIG
+namespace internal {
+
+// Runs `estimate(queries, output)` on chunks of the points of `point_set`
+// (one per thread), writing the scale of each point in `scales`. The CGAL
+// estimation functions are sequential and build their own search structure
+// on the whole point set: the chunks are only as many as the threads.
+template <class Map, class Estimate>
+void estimate_local_scales (CGAL_PS3& point_set, Map& scales, Estimate estimate,
+                            const SWIG_CGAL::Cancellation_token& token)
+{
+  const std::vector<CGAL_PS3::Index> indices (point_set.begin(), point_set.end());
+  std::vector<EPIC_Kernel::Point_3> queries;
+  queries.reserve (indices.size());
+  for (CGAL_PS3::Index i : indices)
+    queries.push_back (point_set.point(i));
+
+  std::size_t nb_chunks = 1;
+  if (std::is_same<Concurrency_tag, CGAL::Parallel_tag>::value)
+    nb_chunks = std::size_t (SWIG_CGAL::current_concurrency());
+  nb_chunks = std::min (nb_chunks, std::max<std::size_t> (1, indices.size()));
+  std::vector<std::size_t> chunks (nb_chunks);
+  for (std::size_t c = 0; c < nb_chunks; ++ c)
+    chunks[c] = c;
+  CGAL::for_each<Concurrency_tag>
+    (chunks, [&](std::size_t c) -> bool
+     {
+       if (token.is_cancelled())
+         return false;
+       const std::size_t first = c * indices.size() / nb_chunks;
+       const std::size_t last = (c + 1) * indices.size() / nb_chunks;
+       std::vector<EPIC_Kernel::Point_3> chunk (queries.begin() + first, queries.begin() + last);
+       std::size_t j = first;
+       estimate (chunk, boost::make_function_output_iterator
+                 ([&](const typename Map::value_type& scale)
+                  {
+                    scales[indices[j ++]] = scale;
+                  }));
+       return true;
+     });
+  token.throw_if_cancelled();
+}
+
+// Normal of each point computed by `fit(neighbors)` on its k nearest
+// neighbors, k being given per point by `k_map`
+template <class Fit>
+void estimate_normals_with_k_map (CGAL_PS3& point_set, CGAL_PS3::Property_map<int> k_map,
+                                  int minimum_k, Fit fit,
+                                  const SWIG_CGAL::Cancellation_token& token)
+{
+  typedef CGAL::Search_traits_3<EPIC_Kernel> Search_traits;
+  typedef CGAL::Orthogonal_k_neighbor_search<Search_traits> Neighbor_search;
+  typedef Neighbor_search::Tree Tree;
+
+  point_set.add_normal_map();
+  Tree tree (point_set.points().begin(), point_set.points().end());
+  tree.build();
+  const std::vector<CGAL_PS3::Index> indices (point_set.begin(), point_set.end());
+  CGAL::for_each<Concurrency_tag>
+    (indices, [&](CGAL_PS3::Index i) -> bool
+     {
+       if (token.is_cancelled())
+         return false;
+       const unsigned int k = unsigned(std::max (minimum_k, k_map[i]));
+       std::vector<EPIC_Kernel::Point_3> neighbors;
+       neighbors.reserve (k);
+       Neighbor_search search (tree, point_set.point(i), k);
+       for (const auto& n : search)
+         neighbors.push_back (n.first);
+       point_set.normal(i) = fit (neighbors);
+       return true;
+     });
+  token.throw_if_cancelled();
+}
+
+} // namespace internal
+#endif
 
-void grid_simplify_point_set (Point_set_3_wrapper<CGAL_PS3> point_set, double epsilon)
+// Scale of each point, in number of neighbors, written in `scales`
+void estimate_local_k_neighbor_scales (Point_set_3_wrapper<CGAL_PS3> point_set,
+                                       typename Point_set_3_wrapper<CGAL_PS3>::Int_map scales,
+                                       SWIG_CGAL::Cancellation_token token = SWIG_CGAL::Cancellation_token())
+{
+  if (!scales.is_valid())
+    throw std::invalid_argument("Invalid property map");
+  CGAL_PS3& points = point_set.get_data();
+  internal::estimate_local_scales
+    (points, scales.get_data(),
+     [&](const std::vector<EPIC_Kernel::Point_3>& queries, auto output)
+     {
+       std::vector<std::size_t> out;
+       CGAL::estimate_local_k_neighbor_scales
+         (points, queries, std::back_inserter(out), points.parameters());
+       for (std::size_t s : out)
+         *output ++ = int(s);
+     }, token);
+}
+
+// Scale of each point, as a distance, written in `scales`
+void estimate_local_range_scales (Point_set_3_wrapper<CGAL_PS3> point_set,
+                                  typename Point_set_3_wrapper<CGAL_PS3>::Float_map scales,
+                                  SWIG_CGAL::Cancellation_token token = SWIG_CGAL::Cancellation_token())
+{
+  if (!scales.is_valid())
+    throw std::invalid_argument("Invalid property map");
+  CGAL_PS3& points = point_set.get_data();
+  internal::estimate_local_scales
+    (points, scales.get_data(),
+     [&](const std::vector<EPIC_Kernel::Point_3>& queries, auto output)
+     {
+       CGAL::estimate_local_range_scales (points, queries, output, points.parameters());
+     }, token);
+}
+
+void grid_simplify_point_set (Point_set_3_wrapper<CGAL_PS3> point_set, double epsilon,
+                              bool compact = false)
 {
   point_set.get_data().remove_from
     (CGAL::grid_simplify_point_set (point_set.get_data(), epsilon));
+  if (compact)
+    point_set.compact();
 }
 
 void hierarchy_simplify_point_set (Point_set_3_wrapper<CGAL_PS3> point_set,
                                    int size = 10,
-                                   double maximum_variation = 1./3.)
+                                   double maximum_variation = 1./3.,
+                                   bool compact = false)
 {
   point_set.get_data().remove_from
     (CGAL::hierarchy_simplify_point_set (point_set.get_data(),
                                          point_set.get_data().parameters().size(size).
                                          maximum_variation(maximum_variation)));
+  if (compact)
+    point_set.compact();
 }
 
 void jet_estimate_normals (Point_set_3_wrapper<CGAL_PS3> point_set, int k,
                            double neighbor_radius = 0.,
-                           int degree_fitting = 2)
+                           int degree_fitting = 2,
+                           SWIG_CGAL::Cancellation_token token = SWIG_CGAL::Cancellation_token())
 {
   point_set.get_data().add_normal_map();
   CGAL::jet_estimate_normals<Concurrency_tag>
     (point_set.get_data(), k,
      point_set.get_data().parameters().neighbor_radius (neighbor_radius).
-     degree_fitting (degree_fitting));
+     degree_fitting (degree_fitting).
+     callback (token.callback()));
+  token.throw_if_cancelled();
+}
+
+// Same as jet_estimate_normals() with the number of neighbors of each point
+// given by `k_map` (e.g. filled by estimate_local_k_neighbor_scales()),
+// increased to the minimum needed by the fitting. Not an overload, so that
+// the keyword arguments of jet_estimate_normals() keep working in Python.
+void jet_estimate_normals_with_k_map (Point_set_3_wrapper<CGAL_PS3> point_set,
+                           typename Point_set_3_wrapper<CGAL_PS3>::Int_map k_map,
+                           int degree_fitting = 2,
+                           SWIG_CGAL::Cancellation_token token = SWIG_CGAL::Cancellation_token())
+{
+  if (!k_map.is_valid())
+    throw std::invalid_argument("Invalid property map");
+  internal::estimate_normals_with_k_map
+    (point_set.get_data(), k_map.get_data(), (degree_fitting + 1) * (degree_fitting + 2) / 2,
+     [&](const std::vector<EPIC_Kernel::Point_3>& neighbors) -> EPIC_Kernel::Vector_3
+     {
+       typedef CGAL::Monge_via_jet_fitting<EPIC_Kernel> Monge_jet_fitting;
+       Monge_jet_fitting fitter;
+       return fitter (neighbors.begin(), neighbors.end(), degree_fitting, 1).normal_direction();
+     }, token);
 }
 
 void jet_smooth_point_set (Point_set_3_wrapper<CGAL_PS3> point_set, int k,
                            double neighbor_radius = 0.,
                            int degree_fitting = 2,
-                           int degree_monge = 2)
+                           int degree_monge = 2,
+                           SWIG_CGAL::Cancellation_token token = SWIG_CGAL::Cancellation_token())
 {
   CGAL::jet_smooth_point_set<Concurrency_tag>
     (point_set.get_data(), k,
      point_set.get_data().parameters().neighbor_radius(neighbor_radius).
      degree_fitting(degree_fitting).
-     degree_monge(degree_monge));
+     degree_monge(degree_monge).
+     callback(token.callback()));
+  token.throw_if_cancelled();
 }
 
+// If `unoriented_map` is valid, the points whose normal could not be
+// oriented are marked 1 in it (the others 0) instead of being removed.
 void mst_orient_normals (Point_set_3_wrapper<CGAL_PS3> point_set, int k,
                          double neighbor_radius = 0.,
                          typename Point_set_3_wrapper<CGAL_PS3>::Int_map
-                         constrained_map = typename Point_set_3_wrapper<CGAL_PS3>::Int_map())
-{
-  if (constrained_map.is_valid())
-    point_set.get_data().remove_from
-      (CGAL::mst_orient_normals
-       (point_set.get_data(), k,
-        point_set.get_data().parameters().neighbor_radius (neighbor_radius).
-        point_is_constrained_map(constrained_map.get_data())));
+                         constrained_map = typename Point_set_3_wrapper<CGAL_PS3>::Int_map(),
+                         typename Point_set_3_wrapper<CGAL_PS3>::Int_map
+                         unoriented_map = typename Point_set_3_wrapper<CGAL_PS3>::Int_map(),
+                         bool compact = false)
+{
+  CGAL_PS3& points = point_set.get_data();
+  CGAL_PS3::iterator first_unoriented
+    = constrained_map.is_valid()
+    ? CGAL::mst_orient_normals
+      (points, k,
+       points.parameters().neighbor_radius (neighbor_radius).
+       point_is_constrained_map(constrained_map.get_data()))
+    : CGAL::mst_orient_normals
+      (points, k,
+       points.parameters().neighbor_radius (neighbor_radius));
+  if (unoriented_map.is_valid())
+  {
+    for (CGAL_PS3::iterator it = points.begin(); it != first_unoriented; ++ it)
+      unoriented_map.get_data()[*it] = 0;
+    for (CGAL_PS3::iterator it = first_unoriented; it != points.end(); ++ it)
+      unoriented_map.get_data()[*it] = 1;
+  }
+  else
+  {
+    points.remove_from (first_unoriented);
+    if (compact)
+      point_set.compact();
+  }
+}
+
+#ifndef SWIG
+namespace internal {
+
+// point of a tile of tiled_mst_orient_normals(), with its index in the point set
+typedef std::tuple<EPIC_Kernel::Point_3, EPIC_Kernel::Vector_3, CGAL_PS3::Index> Tile_point;
+
+struct Tile
+{
+  std::vector<Tile_point> points;
+  std::size_t nb_oriented;
+  std::map<std::size_t, double> agreement; // with the neighbor tiles
+  bool flip;
+};
+
+} // namespace internal
+#endif
+
+// Parallel version of mst_orient_normals(): the point set is cut into cubic
+// tiles of side `tile_size`, each tile enlarged by `tile_overlap` times its
+// side is oriented independently (in parallel), and the tiles are then
+// flipped to agree with their neighbors on the points they share, starting
+// from the tile of the highest point (oriented upwards as by
+// mst_orient_normals()). The points whose normal could not be oriented are
+// removed, or marked 1 in `unoriented_map` if it is valid.
+void tiled_mst_orient_normals (Point_set_3_wrapper<CGAL_PS3> point_set, int k,
+                               double tile_size,
+                               double neighbor_radius = 0.,
+                               double tile_overlap = 0.1,
+                               typename Point_set_3_wrapper<CGAL_PS3>::Int_map
+                               unoriented_map = typename Point_set_3_wrapper<CGAL_PS3>::Int_map(),
+                               bool compact = false,
+                               SWIG_CGAL::Cancellation_token token = SWIG_CGAL::Cancellation_token())
+{
+  typedef std::array<long, 3> Cell;
+  typedef internal::Tile_point Tile_point;
+  if (tile_size <= 0.)
+    throw std::invalid_argument("The tile size must be positive");
+  CGAL_PS3& points = point_set.get_data();
+  if (points.empty())
+    return;
+  if (!points.has_normal_map())
+    throw std::invalid_argument("The point set must have normals");
+
+  auto cell_of = [&](const EPIC_Kernel::Point_3& p) -> Cell
+  {
+    return {{ long(std::floor(p.x() / tile_size)), long(std::floor(p.y() / tile_size)),
+              long(std::floor(p.z() / tile_size)) }};
+  };
+
+  // tiles of the points (core points first), and tile of each point
+  std::map<Cell, std::size_t> tile_ids;
+  std::vector<internal::Tile> tiles;
+  // indexed by the point indices, including the removed points
+  const std::size_t nb_indices = points.size() + points.number_of_removed_points();
+  std::vector<std::size_t> tile_of (nb_indices);
+  CGAL_PS3::Index top = *points.begin();
+  for (CGAL_PS3::Index i : points)
+  {
+    const Cell c = cell_of (points.point(i));
+    std::size_t id = tile_ids.insert (std::make_pair (c, tiles.size())).first->second;
+    if (id == tiles.size())
+      tiles.push_back (internal::Tile());
+    tiles[id].points.push_back (Tile_point (points.point(i), points.normal(i), i));
+    tile_of[std::size_t(i)] = id;
+    if (points.point(i).z() > points.point(top).z())
+      top = i;
+  }
+  // the points closer than the overlap to a neighbor tile are added to it
+  const double margin = tile_overlap * tile_size;
+  if (margin > 0.)
+    for (CGAL_PS3::Index i : points)
+    {
+      const EPIC_Kernel::Point_3& p = points.point(i);
+      const Cell c = cell_of (p);
+      for (long dx = -1; dx <= 1; ++ dx)
+        for (long dy = -1; dy <= 1; ++ dy)
+          for (long dz = -1; dz <= 1; ++ dz)
+          {
+            if (dx == 0 && dy == 0 && dz == 0)
+              continue;
+            const Cell n = {{ c[0] + dx, c[1] + dy, c[2] + dz }};
+            auto it = tile_ids.find (n);
+            if (it == tile_ids.end())
+              continue;
+            bool close = true;
+            for (int d = 0; d < 3 && close; ++ d)
+            {
+              const double lo = n[std::size_t(d)] * tile_size, hi = lo + tile_size;
+              close = (p[d] >= lo - margin && p[d] <= hi + margin);
+            }
+            if (close)
+              tiles[it->second].points.push_back (Tile_point (p, points.normal(i), i));
+          }
+    }
+
+  // independent orientation of the tiles
+  std::vector<std::size_t> tile_indices (tiles.size());
+  for (std::size_t t = 0; t < tiles.size(); ++ t)
+    tile_indices[t] = t;
+  CGAL::for_each<Concurrency_tag>
+    (tile_indices, [&](std::size_t t) -> bool
+     {
+       if (token.is_cancelled())
+         return false;
+       std::vector<Tile_point>& tile = tiles[t].points;
+       const int tile_k = int(std::min<std::size_t> (std::size_t(k), tile.size() - 1));
+       if (tile_k < 2)
+       {
+         tiles[t].nb_oriented = 0;
+         return true;
+       }
+       tiles[t].nb_oriented = std::size_t
+         (CGAL::mst_orient_normals
+          (tile, tile_k,
+           CGAL::parameters::point_map (CGAL::Nth_of_tuple_property_map<0, Tile_point>()).
+           normal_map (CGAL::Nth_of_tuple_property_map<1, Tile_point>()).
+           neighbor_radius (neighbor_radius)) - tile.begin());
+       return true;
+     });
+  token.throw_if_cancelled();
+
+  // normals of the core points, and agreement of the tiles on the shared points
+  std::vector<char> oriented (nb_indices, 0);
+  for (std::size_t t = 0; t < tiles.size(); ++ t)
+    for (std::size_t j = 0; j < tiles[t].nb_oriented; ++ j)
+    {
+      const Tile_point& tp = tiles[t].points[j];
+      const CGAL_PS3::Index i = std::get<2>(tp);
+      if (tile_of[std::size_t(i)] != t)
+        continue;
+      points.normal(i) = std::get<1>(tp);
+      oriented[std::size_t(i)] = 1;
+    }
+  for (std::size_t t = 0; t < tiles.size(); ++ t)
+  {
+    for (std::size_t j = 0; j < tiles[t].nb_oriented; ++ j)
+    {
+      const Tile_point& tp = tiles[t].points[j];
+      const CGAL_PS3::Index i = std::get<2>(tp);
+      const std::size_t u = tile_of[std::size_t(i)];
+      if (u == t || !oriented[std::size_t(i)])
+        continue;
+      const double dot = std::get<1>(tp) * points.normal(i);
+      tiles[t].agreement[u] += (dot > 0. ? 1. : (dot < 0. ? -1. : 0.));
+    }
+    std::vector<Tile_point>().swap (tiles[t].points);
+  }
+
+  // propagation along the pairs of tiles sharing the most points
+  std::vector<char> visited (tiles.size(), 0);
+  typedef std::pair<double, std::pair<std::size_t, std::size_t> > Candidate;
+  std::priority_queue<Candidate> queue;
+  std::vector<std::map<std::size_t, double> > adjacency (tiles.size());
+  for (std::size_t t = 0; t < tiles.size(); ++ t)
+    for (const auto& a : tiles[t].agreement)
+    {
+      adjacency[t][a.first] += a.second;
+      adjacency[a.first][t] += a.second;
+    }
+  for (internal::Tile& tile : tiles)
+    tile.flip = false;
+  const std::size_t root = tile_of[std::size_t(top)];
+  // the highest point is oriented upwards
+  if (oriented[std::size_t(top)] && points.normal(top).z() < 0.)
+    tiles[root].flip = true;
+  visited[root] = 1;
+  for (const auto& a : adjacency[root])
+    queue.push (Candidate (std::abs(a.second), std::make_pair (root, a.first)));
+  while (!queue.empty())
+  {
+    const std::size_t from = queue.top().second.first, t = queue.top().second.second;
+    queue.pop();
+    if (visited[t])
+      continue;
+    visited[t] = 1;
+    tiles[t].flip = (tiles[from].flip != (adjacency[from][t] < 0.));
+    for (const auto& a : adjacency[t])
+      if (!visited[a.first])
+        queue.push (Candidate (std::abs(a.second), std::make_pair (t, a.first)));
+  }
+
+  for (CGAL_PS3::Index i : points)
+    if (oriented[std::size_t(i)] && tiles[tile_of[std::size_t(i)]].flip)
+      points.normal(i) = - points.normal(i);
+
+  if (unoriented_map.is_valid())
+  {
+    for (CGAL_PS3::Index i : points)
+      unoriented_map.get_data()[i] = (oriented[std::size_t(i)] ? 0 : 1);
+  }
   else
-    point_set.get_data().remove_from
-      (CGAL::mst_orient_normals
-       (point_set.get_data(), k,
-        point_set.get_data().parameters().neighbor_radius (neighbor_radius)));
+  {
+    std::vector<CGAL_PS3::Index> unoriented;
+    for (CGAL_PS3::Index i : points)
+      if (!oriented[std::size_t(i)])
+        unoriented.push_back (i);
+    for (CGAL_PS3::Index i : unoriented)
+      points.remove (i);
+    if (compact)
+      point_set.compact();
+  }
 }
 
 void pca_estimate_normals (Point_set_3_wrapper<CGAL_PS3> point_set, int k,
-                           double neighbor_radius = 0.)
+                           double neighbor_radius = 0.,
+                           SWIG_CGAL::Cancellation_token token = SWIG_CGAL::Cancellation_token())
 {
   point_set.get_data().add_normal_map();
   CGAL::pca_estimate_normals<Concurrency_tag>
-    (point_set.get_data(), k, point_set.get_data().parameters().neighbor_radius(neighbor_radius));
+    (point_set.get_data(), k, point_set.get_data().parameters().neighbor_radius(neighbor_radius).
+     callback(token.callback()));
+  token.throw_if_cancelled();
 }
 
-void random_simplify_point_set (Point_set_3_wrapper<CGAL_PS3> point_set, double removed_percentage)
+// Same as pca_estimate_normals() with the number of neighbors of each point
+// given by `k_map`
+void pca_estimate_normals_with_k_map (Point_set_3_wrapper<CGAL_PS3> point_set,
+                           typename Point_set_3_wrapper<CGAL_PS3>::Int_map k_map,
+                           SWIG_CGAL::Cancellation_token token = SWIG_CGAL::Cancellation_token())
+{
+  if (!k_map.is_valid())
+    throw std::invalid_argument("Invalid property map");
+  internal::estimate_normals_with_k_map
+    (point_set.get_data(), k_map.get_data(), 3,
+     [](const std::vector<EPIC_Kernel::Point_3>& neighbors) -> EPIC_Kernel::Vector_3
+     {
+       EPIC_Kernel::Plane_3 plane;
+       CGAL::linear_least_squares_fitting_3 (neighbors.begin(), neighbors.end(), plane,
+                                             CGAL::Dimension_tag<0>());
+       return plane.orthogonal_vector();
+     }, token);
+}
+
+void random_simplify_point_set (Point_set_3_wrapper<CGAL_PS3> point_set, double removed_percentage,
+                                bool compact = false)
 {
   point_set.get_data().remove_from
     (CGAL::random_simplify_point_set (point_set.get_data(), removed_percentage));
+  if (compact)
+    point_set.compact();
 }
 
 void remove_outliers (Point_set_3_wrapper<CGAL_PS3> point_set, int k,
                       double neighbor_radius = 0.,
                       double threshold_percent = 10.,
-                      double threshold_distance = 0.)
-{
-  point_set.get_data().remove_from(
-      CGAL::remove_outliers<Concurrency_tag>
-     (point_set.get_data(), k,
-                            point_set.get_data().parameters().neighbor_radius(neighbor_radius).
-                            threshold_percent(threshold_percent).
-                            threshold_distance(threshold_distance)));
+                      double threshold_distance = 0.,
+                      bool compact = false,
+                      SWIG_CGAL::Cancellation_token token = SWIG_CGAL::Cancellation_token())
+{
+  CGAL_PS3::iterator first_removed
+    = CGAL::remove_outliers<Concurrency_tag>
+    (point_set.get_data(), k,
+     point_set.get_data().parameters().neighbor_radius(neighbor_radius).
+     threshold_percent(threshold_percent).
+     threshold_distance(threshold_distance).
+     callback(token.callback()));
+  token.throw_if_cancelled();
+  point_set.get_data().remove_from(first_removed);
+  if (compact)
+    point_set.compact();
 }
 
-// TODO: structure_point_set() if/once Shape_detection is wrapped
+// Statistical outlier removal (see Neighborhood_cache::remove_statistical_outliers())
+int remove_statistical_outliers (Point_set_3_wrapper<CGAL_PS3> point_set, int k,
+                                 double std_ratio = 2.,
+                                 typename Point_set_3_wrapper<CGAL_PS3>::Float_map
+                                 scores = typename Point_set_3_wrapper<CGAL_PS3>::Float_map(),
+                                 typename Point_set_3_wrapper<CGAL_PS3>::Int_map
+                                 outlier_map = typename Point_set_3_wrapper<CGAL_PS3>::Int_map(),
+                                 bool remove = true)
+{
+  return Neighborhood_cache (point_set, k).remove_statistical_outliers
+    (std_ratio, scores, outlier_map, remove);
+}
 
-void vcm_estimate_normals (Point_set_3_wrapper<CGAL_PS3> point_set,
-                           double offset_radius, double convolution_radius, int k = 0)
+// Radius outlier removal (see Neighborhood_cache::remove_radius_outliers())
+int remove_radius_outliers (Point_set_3_wrapper<CGAL_PS3> point_set, int k,
+                            double radius, int minimum_neighbors,
+                            typename Point_set_3_wrapper<CGAL_PS3>::Int_map
+                            outlier_map = typename Point_set_3_wrapper<CGAL_PS3>::Int_map(),
+                            bool remove = true)
 {
-  point_set.get_data().add_normal_map();
-  if (k == 0)
-    CGAL::vcm_estimate_normals (point_set.get_data(), offset_radius, convolution_radius);
-  else
-    CGAL::vcm_estimate_normals (point_set.get_data(), offset_radius, (unsigned int)k);
+  return Neighborhood_cache (point_set, k).remove_radius_outliers
+    (radius, minimum_neighbors, outlier_map, remove);
 }
 
+// TODO: structure_point_set() if/once Shape_detection is wrapped
+
 void wlop_simplify_and_regularize_point_set (Point_set_3_wrapper<CGAL_PS3> input,
                                              Point_set_3_wrapper<CGAL_PS3> output,
                                              double select_percentage = 5.,
                                              double neighbor_radius = -1.,
                                              int number_of_iterations = 35,
-                                             bool require_uniform_sampling = false)
+                                             bool require_uniform_sampling = false,
+                                             int seed = -1,
+                                             SWIG_CGAL::Cancellation_token token = SWIG_CGAL::Cancellation_token())
 {
+  internal::Seeded_scope scope (seed);
   CGAL::wlop_simplify_and_regularize_point_set<Concurrency_tag>
     (input.get_data(),
      output.get_data().point_back_inserter(),
      input.get_data().parameters().select_percentage(select_percentage).
      neighbor_radius(neighbor_radius).
      number_of_iterations(number_of_iterations).
-     require_uniform_sampling(require_uniform_sampling));
+     require_uniform_sampling(require_uniform_sampling).
+     callback(token.callback()));
+  token.throw_if_cancelled();
 }
 
 // ==============================================================================
@@ -325,6 +857,187 @@ bool register_point_sets_pointmatcher(
   );
 }
 
+#ifndef SWIG
+namespace internal {
+
+// applies `t` to the points and to the normals of `point_set`
+inline void transform_point_set (CGAL_PS3& point_set, const EPIC_Kernel::Aff_transformation_3& t)
+{
+  for (CGAL_PS3::Index i : point_set)
+  {
+    point_set.point(i) = t.transform(point_set.point(i));
+    if (point_set.has_normal_map())
+      point_set.normal(i) = t.transform(point_set.normal(i));
+  }
+}
+
+// copy of the points and normals of `point_set` simplified on a grid of
+// cell size `epsilon`
+inline CGAL_PS3 grid_simplified_copy (const CGAL_PS3& point_set, double epsilon)
+{
+  CGAL_PS3 out;
+  out.add_normal_map();
+  out.reserve (point_set.size());
+  for (CGAL_PS3::Index i : point_set)
+    out.insert (point_set.point(i), point_set.normal(i));
+  out.remove_from (CGAL::grid_simplify_point_set (out, epsilon));
+  out.collect_garbage();
+  return out;
+}
+
+} // namespace internal
+#endif
+
+// Transformation mapping `point_set_2` onto `point_set_1` computed by the
+// registration_transformation_* functions, which can be applied to other
+// point sets (e.g. the full resolution scans of downsampled ones).
+// `score` is the OpenGR score (1 for a converged ICP) and `converged` is
+// false if ICP diverged or if the OpenGR score is 0.
+class Registration_result
+{
+  EPIC_Kernel::Aff_transformation_3 m_transformation;
+  double m_score;
+  bool m_converged;
+
+public:
+#ifndef SWIG
+  Registration_result (const EPIC_Kernel::Aff_transformation_3& transformation,
+                       double score, bool converged)
+    : m_transformation (transformation), m_score (score), m_converged (converged) { }
+  const EPIC_Kernel::Aff_transformation_3& transformation() const { return m_transformation; }
+#endif
+
+  double score() const { return m_score; }
+  bool converged() const { return m_converged; }
+
+  // (4, 4) row major matrix of the transformation
+  SWIG_CGAL::Buffer<double> transform_array() const
+  {
+    std::vector<double> out;
+    out.reserve (16);
+    for (int i = 0; i < 4; ++i)
+      for (int j = 0; j < 4; ++j)
+        out.push_back (m_transformation.m(i, j));
+    return SWIG_CGAL::Buffer<double> (std::move(out), 4);
+  }
+
+  // transforms the points and normals of `point_set`
+  void apply (Point_set_3_wrapper<CGAL_PS3> point_set) const
+  {
+    internal::transform_point_set (point_set.get_data(), m_transformation);
+  }
+};
+
+// Same as register_point_sets_opengr(), returning the transformation;
+// `point_set_2` is transformed unless `dry_run` is true
+Registration_result registration_transformation_opengr(
+    Point_set_3_wrapper<CGAL_PS3> point_set_1,
+    Point_set_3_wrapper<CGAL_PS3> point_set_2,
+    int number_of_samples = 200,
+    double maximum_normal_deviation = 90.0,
+    double accuracy = 5.0,
+    double overlap = 0.2,
+    int maximum_running_time = 1000,
+    bool dry_run = false)
+{
+  if (!point_set_1.get_data().has_normal_map())
+    point_set_1.get_data().add_normal_map();
+  if (!point_set_2.get_data().has_normal_map())
+    point_set_2.get_data().add_normal_map();
+
+  std::pair<EPIC_Kernel::Aff_transformation_3, double> res
+    = CGAL::OpenGR::compute_registration_transformation(
+      point_set_1.get_data(),
+      point_set_2.get_data(),
+      point_set_1.get_data().parameters()
+        .point_map(point_set_1.get_data().point_map())
+        .normal_map(point_set_1.get_data().normal_map())
+        .number_of_samples(number_of_samples)
+        .maximum_normal_deviation(maximum_normal_deviation)
+        .accuracy(accuracy)
+        .overlap(overlap)
+        .maximum_running_time(maximum_running_time),
+      point_set_2.get_data().parameters()
+        .point_map(point_set_2.get_data().point_map())
+        .normal_map(point_set_2.get_data().normal_map()));
+
+  Registration_result result (res.first, res.second, res.second > 0.);
+  if (!dry_run)
+    result.apply (point_set_2);
+  return result;
+}
+
+// Same as register_point_sets_pointmatcher(), returning the transformation;
+// `point_set_2` is transformed unless `dry_run` is true. If `grid_sizes`
+// (decreasing cell sizes) is not empty, ICP is first run coarse to fine on
+// copies of both point sets simplified on grids of these sizes, each level
+// starting from the transformation of the previous one; the last pass on
+// the full point sets is skipped if `full_resolution` is false. Empty lists
+// of filters or checkers mean none.
+Registration_result registration_transformation_pointmatcher(
+    Point_set_3_wrapper<CGAL_PS3> point_set_1,
+    Point_set_3_wrapper<CGAL_PS3> point_set_2,
+    const std::vector<ICP_config_wrapper>& point_set_filters = {},
+    const ICP_config_wrapper& matcher = CGAL_SWIG::ICP_config_wrapper("KDTreeMatcher", {{"knn", "1"}}),
+    const std::vector<ICP_config_wrapper>& outlier_filters = {},
+    const ICP_config_wrapper& error_minimizer =
+        CGAL_SWIG::ICP_config_wrapper("PointToPlaneErrorMinimizer", {}),
+    const std::vector<ICP_config_wrapper>& transformation_checkers =
+        {CGAL_SWIG::ICP_config_wrapper("CounterTransformationChecker", {{"maxIterationCount", "150"}})},
+    SWIG_CGAL::Buffer<double> grid_sizes = SWIG_CGAL::Buffer<double>(),
+    bool full_resolution = true,
+    bool dry_run = false)
+{
+  if (grid_sizes.empty() && !full_resolution)
+    throw std::invalid_argument("Expecting at least one level of registration");
+  if (!point_set_1.get_data().has_normal_map())
+    point_set_1.get_data().add_normal_map();
+  if (!point_set_2.get_data().has_normal_map())
+    point_set_2.get_data().add_normal_map();
+
+  const auto filters = convert_icp_configs(point_set_filters);
+  const auto outliers = convert_icp_configs(outlier_filters);
+  const auto checkers = convert_icp_configs(transformation_checkers);
+  const auto match_config = matcher.to_cgal_config();
+  const auto minimizer_config = error_minimizer.to_cgal_config();
+
+  EPIC_Kernel::Aff_transformation_3 transformation (CGAL::IDENTITY);
+  bool converged = true;
+  auto icp = [&](const CGAL_PS3& ps1, const CGAL_PS3& ps2)
+  {
+    std::pair<EPIC_Kernel::Aff_transformation_3, bool> res
+      = CGAL::pointmatcher::compute_registration_transformation(
+        ps1, ps2,
+        ps1.parameters()
+          .point_map(ps1.point_map())
+          .normal_map(ps1.normal_map()),
+        ps2.parameters()
+          .point_map(ps2.point_map())
+          .normal_map(ps2.normal_map())
+          .point_set_filters(filters)
+          .matcher(match_config)
+          .outlier_filters(outliers)
+          .error_minimizer(minimizer_config)
+          .transformation_checkers(checkers)
+          .transformation(transformation));
+    // a diverged level keeps the transformation of the previous one
+    if (res.second)
+      transformation = res.first;
+    converged = res.second;
+  };
+
+  for (std::size_t i = 0; i < grid_sizes.size(); ++i)
+    icp (internal::grid_simplified_copy (point_set_1.get_data(), grid_sizes[i]),
+         internal::grid_simplified_copy (point_set_2.get_data(), grid_sizes[i]));
+  if (full_resolution)
+    icp (point_set_1.get_data(), point_set_2.get_data());
+
+  Registration_result result (transformation, converged ? 1. : 0., converged);
+  if (!dry_run)
+    result.apply (point_set_2);
+  return result;
+}
+
 } // end namespace CGAL_SWIG
 
 #endif //SWIG_CGAL_POINT_SET_PROCESSING_3_H
@@ -23,6 +23,9 @@ SWIG_CGAL_package_common()
 %{
   #include <SWIG_CGAL/Common/Iterator.h>
   #include <SWIG_CGAL/Polyhedron_3/all_includes.h>
+  #include <SWIG_CGAL/AABB_tree/all_includes.h>
+  #include <SWIG_CGAL/Surface_mesh/all_includes.h>
+  #include <SWIG_CGAL/Point_set_3/Point_set_3.h>
   #include <SWIG_CGAL/Polygon_mesh_processing/all_includes.h>
 %}
 
@@ -34,6 +37,8 @@ import CGAL.Polyhedron_3.Polyhedron_3;
 import CGAL.Polyhedron_3.Polyhedron_3_Facet_handle;
 import CGAL.Polyhedron_3.Polyhedron_3_Vertex_handle;
 import CGAL.Polyhedron_3.Polyhedron_3_Halfedge_handle;
+import CGAL.Surface_mesh.Surface_mesh_3;
+import CGAL.Point_set_3.Point_set_3;
 import CGAL.Kernel.Point_3;
 import CGAL.Kernel.Vector_3;
 import CGAL.Kernel.Plane_3;
@@ -47,6 +52,8 @@ import CGAL.Polyhedron_3.Polyhedron_3;
 import CGAL.Polyhedron_3.Polyhedron_3_Facet_handle;
 import CGAL.Polyhedron_3.Polyhedron_3_Vertex_handle;
 import CGAL.Polyhedron_3.Polyhedron_3_Halfedge_handle;
+import CGAL.Surface_mesh.Surface_mesh_3;
+import CGAL.Point_set_3.Point_set_3;
 import CGAL.Kernel.Point_3;
 import CGAL.Kernel.Vector_3;
 import CGAL.Kernel.Plane_3;
@@ -62,13 +69,52 @@ SWIG_CGAL_import_Polyhedron_3_Halfedge_handle_SWIG_wrapper
 SWIG_CGAL_import_Polyhedron_3_Facet_handle_SWIG_wrapper
 SWIG_CGAL_import_Polyhedron_3_Vertex_handle_SWIG_wrapper
 
+//import definitions of Surface_mesh objects
+%import "SWIG_CGAL/Surface_mesh/CGAL_Surface_mesh.i"
+
+//import definitions of Point_set_3 objects (output of the sampling)
+%import "SWIG_CGAL/Point_set_3/CGAL_Point_set_3.i"
+
+//import the AABB tree on Polyhedron_3 facets
+%import "SWIG_CGAL/AABB_tree/CGAL_AABB_tree.i"
+SWIG_CGAL_import_AABB_tree_Polyhedron_3_Facet_handle_SWIG_wrapper
+
+%include "SWIG_CGAL/typemaps.i"
+SWIG_CGAL_buffer_of_double_typemap_in
+SWIG_CGAL_buffer_of_float_typemap_in
+SWIG_CGAL_buffer_of_int_typemap_in
+SWIG_CGAL_buffer_of_double_typemap_out
+SWIG_CGAL_buffer_of_float_typemap_out
+SWIG_CGAL_buffer_of_int_typemap_out
+SWIG_CGAL_buffer_of_long_long_typemap_out
+SWIG_CGAL_buffer_of_signed_char_typemap_out
+
+SWIG_CGAL_release_gil(Polygon_mesh_slicer_wrapper::slice_batch)
 %include "SWIG_CGAL/Polygon_mesh_processing/Polygon_mesh_slicer.h"
 %typemap(javaimports) Polygon_mesh_slicer_wrapper %{import CGAL.Kernel.Plane_3; import CGAL.Polyhedron_3.Polyhedron_3;%}
 SWIG_CGAL_declare_identifier_of_template_class(Polygon_mesh_slicer,Polygon_mesh_slicer_wrapper<Polyhedron_3_SWIG_wrapper>)
 
+SWIG_CGAL_release_gil(Side_of_triangle_mesh_wrapper::bounded_side_batch)
 %include "SWIG_CGAL/Polygon_mesh_processing/Side_of_triangle_mesh.h"
-%typemap(javaimports) Side_of_triangle_mesh_wrapper %{import CGAL.Kernel.Point_3; import CGAL.Kernel.Bounded_side; import CGAL.Polyhedron_3.Polyhedron_3;%}
-SWIG_CGAL_declare_identifier_of_template_class(Side_of_triangle_mesh,Side_of_triangle_mesh_wrapper<Polyhedron_3_SWIG_wrapper>)
+%typemap(javaimports) Side_of_triangle_mesh_wrapper %{import CGAL.Kernel.Point_3; import CGAL.Kernel.Bounded_side; import CGAL.Polyhedron_3.Polyhedron_3; import CGAL.AABB_tree.AABB_tree_Polyhedron_3_Facet_handle;%}
+SWIG_CGAL_declare_identifier_of_template_class(Side_of_triangle_mesh,Side_of_triangle_mesh_wrapper<Polyhedron_3_SWIG_wrapper,AABB_tree_Polyhedron_3_Facet_handle_SWIG_wrapper>)
+
+SWIG_CGAL_release_gil(Heat_method_3_wrapper::Heat_method_3_wrapper)
+SWIG_CGAL_release_gil(Heat_method_3_wrapper::distances)
+SWIG_CGAL_release_gil(Heat_method_3_wrapper::distances_batch)
+%include "SWIG_CGAL/Polygon_mesh_processing/Heat_method.h"
+%typemap(javaimports) Heat_method_3_wrapper %{import CGAL.Polyhedron_3.Polyhedron_3;%}
+SWIG_CGAL_declare_identifier_of_template_class(Heat_method_3,Heat_method_3_wrapper<Polyhedron_3_SWIG_wrapper>)
+
+%include "SWIG_CGAL/Polygon_mesh_processing/Hole_filling.h"
+%include "SWIG_CGAL/Polygon_mesh_processing/Connected_components.h"
+%include "SWIG_CGAL/Polygon_mesh_processing/Mesh_tiling.h"
+%include "SWIG_CGAL/Polygon_mesh_processing/Polygon_soup.h"
+%include "SWIG_CGAL/Polygon_mesh_processing/Locate.h"
+%include "SWIG_CGAL/Polygon_mesh_processing/Mesh_sampling.h"
+
+%typemap(javaimports) Exact_mesh_3 %{import CGAL.Surface_mesh.Surface_mesh_3;%}
+%include "SWIG_CGAL/Polygon_mesh_processing/Exact_mesh_3.h"
 
 %include "SWIG_CGAL/Common/triple.h"
 SWIG_CGAL_declare_identifier_of_template_class(Integer_triple,SWIG_CGAL::Triple<int,int,int>)
@@ -91,6 +137,12 @@ SWIG_CGAL_declare_identifier_of_template_class(Halfedge_pair,std::pair<Polyhedro
 %template(Int_Vector) std::vector<int>;
 %template(Polygon_Vector) std::vector< std::vector<int> >;
 %template(Polylines) std::vector< std::vector<Point_3> >;
+%typemap(javaimports) std::vector<Polyhedron_3_SWIG_wrapper>
+  %{ import CGAL.Polyhedron_3.Polyhedron_3; %}
+%template(Polyhedron_3_Vector) std::vector<Polyhedron_3_SWIG_wrapper>;
+%typemap(javaimports) std::vector<Surface_mesh_3>
+  %{ import CGAL.Surface_mesh.Surface_mesh_3; %}
+%template(Surface_mesh_3_Vector) std::vector<Surface_mesh_3>;
 
 
 //includes
@@ -99,6 +151,7 @@ SWIG_CGAL_declare_identifier_of_template_class(Halfedge_pair,std::pair<Polyhedro
   #include <CGAL/Polygon_mesh_processing/clip.h>
   #include <SWIG_CGAL/Common/Wrapper_iterator_helper.h>
   #include <SWIG_CGAL/Common/triple.h>
+  #include <SWIG_CGAL/Common/Gil_release.h>
   #include <SWIG_CGAL/Polygon_mesh_processing/utils.h>
   #include <iostream>
 %}
@@ -195,6 +248,29 @@ SWIG_CGAL_python_vector_of_int_typecheck
   namespace PMP=CGAL::Polygon_mesh_processing;
   namespace params=CGAL::Polygon_mesh_processing::parameters;
 
+  #ifdef CGAL_LINKED_WITH_TBB
+  typedef CGAL::Parallel_tag Concurrency_tag;
+  #else
+  typedef CGAL::Sequential_tag Concurrency_tag;
+  #endif
+
+  // the facets of P by id, compacting the ids if needed
+  std::vector<Polyhedron_3_SWIG_wrapper::cpp_base::Facet_handle> facets_by_id(Polyhedron_3_SWIG_wrapper& P)
+  {
+    if (!P.has_compact_ids()) P.compact();
+    return SWIG_PMP::internal::handles_by_id<Polyhedron_3_SWIG_wrapper::cpp_base::Facet_handle>(
+      P.get_data().facets_begin(), P.get_data().facets_end(), P.size_of_facets());
+  }
+  // a halfedge per edge of P, in the order of P.edges()
+  std::vector<Polyhedron_3_SWIG_wrapper::cpp_base::Halfedge_handle> edge_halfedges(Polyhedron_3_SWIG_wrapper& P)
+  {
+    std::vector<Polyhedron_3_SWIG_wrapper::cpp_base::Halfedge_handle> out;
+    out.reserve(P.size_of_halfedges() / 2);
+    for (Polyhedron_3_SWIG_wrapper::cpp_base::Edge_iterator e = P.get_data().edges_begin(); e != P.get_data().edges_end(); ++e)
+      out.push_back(e);
+    return out;
+  }
+
   struct Is_constrained_map{
     typedef boost::graph_traits<Polyhedron_3_SWIG_wrapper::cpp_base>::edge_descriptor key_type;
     std::set<key_type>* m_set;
@@ -252,6 +328,35 @@ SWIG_CGAL_python_vector_of_int_typecheck
     PMP::fair(P.get_data(), vertex_range,
               params::fairing_continuity(fairing_continuity));
   }
+//   Smoothing, the vertices of the array `constrained` (ids, the ids of P
+//   being compacted first if needed) being kept in place, see Smoothing.h.
+//   tangential_relaxation() moves all the vertices at once at each
+//   iteration (Jacobi updates), computed concurrently.
+  void tangential_relaxation(Polyhedron_3_SWIG_wrapper& P, int number_of_iterations = 1,
+                             SWIG_CGAL::Buffer<int> constrained = SWIG_CGAL::Buffer<int>())
+  {
+    SWIG_CGAL::Gil_release gil_release;
+    if (!P.has_compact_ids()) P.compact();
+    SWIG_PMP::tangential_relaxation<Concurrency_tag>(P.get_data(), number_of_iterations, constrained);
+  }
+//   CGAL::Polygon_mesh_processing::angle_and_area_smoothing() (CGAL 5.5)
+  void angle_and_area_smoothing(Polyhedron_3_SWIG_wrapper& P, int number_of_iterations = 1,
+                                SWIG_CGAL::Buffer<int> constrained = SWIG_CGAL::Buffer<int>(),
+                                bool use_angle_smoothing = true, bool use_area_smoothing = true)
+  {
+    SWIG_CGAL::Gil_release gil_release;
+    if (!P.has_compact_ids()) P.compact();
+    SWIG_PMP::angle_and_area_smoothing(P.get_data(), number_of_iterations, constrained,
+                                       use_angle_smoothing, use_area_smoothing);
+  }
+//   CGAL::Polygon_mesh_processing::smooth_shape()
+  void smooth_shape(Polyhedron_3_SWIG_wrapper& P, double time, int number_of_iterations = 1,
+                    SWIG_CGAL::Buffer<int> constrained = SWIG_CGAL::Buffer<int>())
+  {
+    SWIG_CGAL::Gil_release gil_release;
+    if (!P.has_compact_ids()) P.compact();
+    SWIG_PMP::smooth_shape(P.get_data(), time, number_of_iterations, constrained);
+  }
 //   CGAL::Polygon_mesh_processing::refine()
   void refine( Polyhedron_3_SWIG_wrapper& P,
                Facet_range facet_range,
@@ -302,9 +407,11 @@ SWIG_CGAL_python_vector_of_int_typecheck
     std::set<edge_descriptor> constrained_edges;
     BOOST_FOREACH(Polyhedron::Halfedge_handle h, constraints)
       constrained_edges.insert(edge(h,P.get_data()));
-    CGAL::set_halfedgeds_items_id(P.get_data());
     // isotropic_remeshing requires a ForwardIterator
     std::vector<Polyhedron_3_SWIG_wrapper::cpp_base::Face_handle> faces(facet_range.first, facet_range.second);
+    // the input ranges are read: remesh without the GIL
+    SWIG_CGAL::Gil_release gil_release;
+    P.compact();
     PMP::isotropic_remeshing(faces, target_edge_length, P.get_data(),
                              params::number_of_iterations(number_of_iterations).
                              edge_is_constrained_map(
@@ -317,20 +424,41 @@ SWIG_CGAL_python_vector_of_int_typecheck
                            Polyhedron_3_SWIG_wrapper& P,
                            int number_of_iterations)
   {
-    CGAL::set_halfedgeds_items_id(P.get_data());
     // isotropic_remeshing requires a ForwardIterator
     std::vector<Polyhedron_3_SWIG_wrapper::cpp_base::Face_handle> faces(facet_range.first, facet_range.second);
+    SWIG_CGAL::Gil_release gil_release;
+    P.compact();
     PMP::isotropic_remeshing(faces, target_edge_length, P.get_data(),
                              params::number_of_iterations(number_of_iterations));
   }
+  // if `parallel`, the facets are split in patches remeshed concurrently
+  // (see Parallel_remeshing.h): all the handles of P are invalidated
+  void isotropic_remeshing(Facet_range facet_range,
+                           double target_edge_length,
+                           Polyhedron_3_SWIG_wrapper& P,
+                           int number_of_iterations,
+                           bool parallel)
+  {
+    std::vector<Polyhedron_3_SWIG_wrapper::cpp_base::Face_handle> faces(facet_range.first, facet_range.second);
+    SWIG_CGAL::Gil_release gil_release;
+    P.compact();
+    if (parallel)
+      SWIG_PMP::parallel_isotropic_remeshing<Polyhedron_3_SWIG_wrapper::cpp_base, Concurrency_tag>
+        (faces, target_edge_length, P.get_data(), number_of_iterations);
+    else
+      PMP::isotropic_remeshing(faces, target_edge_length, P.get_data(),
+                               params::number_of_iterations(number_of_iterations));
+    P.compact();
+  }
   void isotropic_remeshing(Facet_range facet_range,
                            double target_edge_length,
                            Polyhedron_3_SWIG_wrapper& P)
   {
-    CGAL::set_halfedgeds_items_id(P.get_data());
     // isotropic_remeshing requires a ForwardIterator
     std::vector<Polyhedron_3_SWIG_wrapper::cpp_base::Face_handle> faces(facet_range.first, facet_range.second);
-    PMP::isotropic_remeshing(make_range(facet_range), target_edge_length, P.get_data());
+    SWIG_CGAL::Gil_release gil_release;
+    P.compact();
+    PMP::isotropic_remeshing(faces, target_edge_length, P.get_data());
   }
 //   CGAL::Polygon_mesh_processing::split_long_edges() (4.8)
   void split_long_edges(Halfedge_range halfedge_range,
@@ -405,6 +533,24 @@ SWIG_CGAL_python_vector_of_int_typecheck
                                           params::density_control_factor(density_control_factor).
                                           fairing_continuity(fairing_continuity));
   }
+//   batch variant: fills all the holes of P with at most `max_hole_size`
+//   border edges (all of them if max_hole_size<=0), concurrently. All the
+//   handles on the border of P are invalidated.
+  Hole_filling_statistics fill_all_holes(Polyhedron_3_SWIG_wrapper& P,
+                                         int max_hole_size,
+                                         Hole_filling_mode mode,
+                                         double density_control_factor=1.4142135623730951,
+                                         int fairing_continuity=1)
+  {
+    SWIG_CGAL::Gil_release gil_release;
+    Hole_filling_statistics stats;
+    P.compact();
+    SWIG_PMP::fill_all_holes<Concurrency_tag>(P.get_data(), max_hole_size, mode,
+                                              density_control_factor, fairing_continuity,
+                                              stats);
+    P.compact();
+    return stats;
+  }
 //   CGAL::Polygon_mesh_processing::triangulate_hole_polyline()
   void triangulate_hole_polyline 	(Point_3_range points,
   		                             Point_3_range third_points,
@@ -427,7 +573,8 @@ SWIG_CGAL_python_vector_of_int_typecheck
 //   CGAL::Polygon_mesh_processing::does_self_intersect()
   bool does_self_intersect(Polyhedron_3_SWIG_wrapper& P)
   {
-    return PMP::does_self_intersect(P.get_data());
+    SWIG_CGAL::Gil_release gil_release;
+    return PMP::does_self_intersect<Concurrency_tag>(P.get_data());
   }
 //   CGAL::Polygon_mesh_processing::self_intersections()
   void self_intersections(Polyhedron_3_SWIG_wrapper& P,
@@ -435,6 +582,24 @@ SWIG_CGAL_python_vector_of_int_typecheck
   {
     PMP::self_intersections(P.get_data(), out);
   }
+  // (N,2) array of the ids of the pairs of intersecting facets, which are
+  // (re)numbered in iteration order
+  SWIG_CGAL::Buffer<int> self_intersections(Polyhedron_3_SWIG_wrapper& P)
+  {
+    SWIG_CGAL::Gil_release gil_release;
+    typedef Polyhedron_3_SWIG_wrapper::cpp_base::Facet_handle Facet_handle;
+    P.compact();
+    std::vector< std::pair<Facet_handle, Facet_handle> > pairs;
+    PMP::self_intersections<Concurrency_tag>(P.get_data(), std::back_inserter(pairs));
+    std::vector<int> ids;
+    ids.reserve(2 * pairs.size());
+    for (const std::pair<Facet_handle, Facet_handle>& p : pairs)
+    {
+      ids.push_back(int(p.first->id()));
+      ids.push_back(int(p.second->id()));
+    }
+    return SWIG_CGAL::Buffer<int>(std::move(ids), 2);
+  }
 //   CGAL::Polygon_mesh_processing::do_intersect()
   bool do_intersect(Polyhedron_3_SWIG_wrapper& P,
                     Polyhedron_3_SWIG_wrapper& Q)
@@ -474,6 +639,36 @@ SWIG_CGAL_python_vector_of_int_typecheck
         points.push_back( Point_3(cgal_points[i]) );
     return res;
   }
+  // the (V,3) array points and the (F,3) array faces oriented consistently,
+  // see Triangle_soup::has_duplicated_points()
+  Triangle_soup orient_polygon_soup(SWIG_CGAL::Buffer<double> points,
+                                    SWIG_CGAL::Buffer<int> faces)
+  {
+    SWIG_CGAL::Gil_release gil_release;
+    Triangle_soup out;
+    SWIG_PMP::orient_polygon_soup(points, faces, out);
+    return out;
+  }
+//   CGAL::Polygon_mesh_processing::repair_polygon_soup()
+  Triangle_soup repair_polygon_soup(SWIG_CGAL::Buffer<double> points,
+                                    SWIG_CGAL::Buffer<int> faces,
+                                    bool erase_all_duplicates = false,
+                                    bool require_same_orientation = false)
+  {
+    SWIG_CGAL::Gil_release gil_release;
+    Triangle_soup out;
+    SWIG_PMP::repair_polygon_soup(points, faces, erase_all_duplicates, require_same_orientation, out);
+    return out;
+  }
+//   CGAL::Polygon_mesh_processing::autorefine_triangle_soup()
+  Triangle_soup autorefine_triangle_soup(SWIG_CGAL::Buffer<double> points,
+                                         SWIG_CGAL::Buffer<int> faces)
+  {
+    SWIG_CGAL::Gil_release gil_release;
+    Triangle_soup out;
+    SWIG_PMP::autorefine_triangle_soup<Concurrency_tag>(points, faces, out);
+    return out;
+  }
 //
 // Combinatorial Repairing Functions
 //   CGAL::Polygon_mesh_processing::stitch_borders()
@@ -524,8 +719,8 @@ SWIG_CGAL_python_vector_of_int_typecheck
   void compute_face_normals(Polyhedron_3_SWIG_wrapper& P,
                             Vector_3_output_iterator out)
   {
-    CGAL::set_halfedgeds_items_id(P.get_data());
-    std::vector< EPIC_Kernel::Vector_3 > normals(P.get_data().size_of_vertices());
+    P.compact();
+    std::vector< EPIC_Kernel::Vector_3 > normals(P.get_data().size_of_facets());
     typedef Polyhedron_3_SWIG_wrapper::cpp_base::Facet_handle Facet_handle;
     X_from_id_pmap<Facet_handle, EPIC_Kernel::Vector_3> ppmap(normals);
     PMP::compute_face_normals(P.get_data(), ppmap);
@@ -549,7 +744,7 @@ SWIG_CGAL_python_vector_of_int_typecheck
   void compute_vertex_normals(Polyhedron_3_SWIG_wrapper& P,
                               Vector_3_output_iterator out)
   {
-    CGAL::set_halfedgeds_items_id(P.get_data());
+    P.compact();
     std::vector< EPIC_Kernel::Vector_3 > normals(P.get_data().size_of_vertices());
     typedef Polyhedron_3_SWIG_wrapper::cpp_base::Vertex_handle Vertex_handle;
     X_from_id_pmap<Vertex_handle, EPIC_Kernel::Vector_3> ppmap(normals);
@@ -557,6 +752,66 @@ SWIG_CGAL_python_vector_of_int_typecheck
     BOOST_FOREACH(const EPIC_Kernel::Vector_3& v, normals)
       *out++=v;
   }
+//   parallel variants writing the normals in a writable (N,3) array of
+//   float64 or float32, at the rows given by the ids (see Polyhedron_3.compact()).
+//   With `changed_facets`, an array of facet ids, only the normals around these
+//   facets are recomputed: the ids must not have changed since the last call.
+  void compute_face_normals(Polyhedron_3_SWIG_wrapper& P,
+                            SWIG_CGAL::Buffer<double> normals)
+  {
+    SWIG_CGAL::Gil_release gil_release;
+    if (!P.has_compact_ids()) P.compact();
+    SWIG_PMP::face_normals_to_buffer<Concurrency_tag>(P.get_data(), normals);
+  }
+  void compute_face_normals(Polyhedron_3_SWIG_wrapper& P,
+                            SWIG_CGAL::Buffer<double> normals,
+                            SWIG_CGAL::Buffer<int> changed_facets)
+  {
+    SWIG_CGAL::Gil_release gil_release;
+    SWIG_PMP::face_normals_to_buffer<Concurrency_tag>(P.get_data(), normals, &changed_facets);
+  }
+  void compute_face_normals(Polyhedron_3_SWIG_wrapper& P,
+                            SWIG_CGAL::Buffer<float> normals)
+  {
+    SWIG_CGAL::Gil_release gil_release;
+    if (!P.has_compact_ids()) P.compact();
+    SWIG_PMP::face_normals_to_buffer<Concurrency_tag>(P.get_data(), normals);
+  }
+  void compute_face_normals(Polyhedron_3_SWIG_wrapper& P,
+                            SWIG_CGAL::Buffer<float> normals,
+                            SWIG_CGAL::Buffer<int> changed_facets)
+  {
+    SWIG_CGAL::Gil_release gil_release;
+    SWIG_PMP::face_normals_to_buffer<Concurrency_tag>(P.get_data(), normals, &changed_facets);
+  }
+  void compute_vertex_normals(Polyhedron_3_SWIG_wrapper& P,
+                              SWIG_CGAL::Buffer<double> normals)
+  {
+    SWIG_CGAL::Gil_release gil_release;
+    if (!P.has_compact_ids()) P.compact();
+    SWIG_PMP::vertex_normals_to_buffer<Concurrency_tag>(P.get_data(), normals);
+  }
+  void compute_vertex_normals(Polyhedron_3_SWIG_wrapper& P,
+                              SWIG_CGAL::Buffer<double> normals,
+                              SWIG_CGAL::Buffer<int> changed_facets)
+  {
+    SWIG_CGAL::Gil_release gil_release;
+    SWIG_PMP::vertex_normals_to_buffer<Concurrency_tag>(P.get_data(), normals, &changed_facets);
+  }
+  void compute_vertex_normals(Polyhedron_3_SWIG_wrapper& P,
+                              SWIG_CGAL::Buffer<float> normals)
+  {
+    SWIG_CGAL::Gil_release gil_release;
+    if (!P.has_compact_ids()) P.compact();
+    SWIG_PMP::vertex_normals_to_buffer<Concurrency_tag>(P.get_data(), normals);
+  }
+  void compute_vertex_normals(Polyhedron_3_SWIG_wrapper& P,
+                              SWIG_CGAL::Buffer<float> normals,
+                              SWIG_CGAL::Buffer<int> changed_facets)
+  {
+    SWIG_CGAL::Gil_release gil_release;
+    SWIG_PMP::vertex_normals_to_buffer<Concurrency_tag>(P.get_data(), normals, &changed_facets);
+  }
 //   CGAL::Polygon_mesh_processing::compute_normals()
 //
 // Connected Components
@@ -571,13 +826,25 @@ SWIG_CGAL_python_vector_of_int_typecheck
   boost::shared_ptr<std::vector<int> >
   connected_components(Polyhedron_3_SWIG_wrapper& P)
   {
-    CGAL::set_halfedgeds_items_id(P.get_data());
+    P.compact();
     boost::shared_ptr<std::vector<int> > cc_ids( new std::vector<int>(P.size_of_facets()) );
     typedef Polyhedron_3_SWIG_wrapper::cpp_base::Facet_handle Facet_handle;
     Int_from_id_pmap<Facet_handle> pmap(*cc_ids);
     PMP::connected_components(P.get_data(), pmap);
     return cc_ids;
   }
+//   array variant: the component of each facet (in the order of the ids)
+//   and the number of facets, area and bounding box of each component,
+//   computed concurrently
+  Face_components connected_component_labels(Polyhedron_3_SWIG_wrapper& P)
+  {
+    SWIG_CGAL::Gil_release gil_release;
+    typedef Polyhedron_3_SWIG_wrapper::cpp_base::Facet_handle Facet_handle;
+    Face_components out;
+    SWIG_PMP::label_connected_components<Concurrency_tag>(
+      P.get_data(), facets_by_id(P), [](Facet_handle f) { return std::size_t(f->id()); }, out);
+    return out;
+  }
 
   //   CGAL::Polygon_mesh_processing::keep_large_connected_components() (4.8)
   int keep_large_connected_components(Polyhedron_3_SWIG_wrapper& P,
@@ -605,13 +872,25 @@ SWIG_CGAL_python_vector_of_int_typecheck
                                  boost::shared_ptr<std::vector<int> > components_to_keep,
                                  boost::shared_ptr<std::vector<int> > fcm)
   {
-    CGAL::set_halfedgeds_items_id(P.get_data());
+    P.compact();
     typedef Polyhedron_3_SWIG_wrapper::cpp_base::Facet_handle Facet_handle;
     Int_from_id_pmap<Facet_handle> pmap(*fcm);
     PMP::keep_connected_components(P.get_data(),
                                    *components_to_keep,
                                    pmap);
   }
+//   with the labels of connected_component_labels(), P being unchanged since
+  void keep_connected_components(Polyhedron_3_SWIG_wrapper& P,
+                                 SWIG_CGAL::Buffer<int> components_to_keep,
+                                 const Face_components& labels)
+  {
+    if (!P.has_compact_ids() || std::size_t(labels.number_of_faces()) != P.size_of_facets())
+      throw std::invalid_argument("The labels are not the ones of this polyhedron");
+    typedef Polyhedron_3_SWIG_wrapper::cpp_base::Facet_handle Facet_handle;
+    Int_from_id_pmap<Facet_handle> pmap(labels.component_ids());
+    std::vector<int> components(components_to_keep.data(), components_to_keep.data() + components_to_keep.size());
+    PMP::keep_connected_components(P.get_data(), components, pmap);
+  }
 
 //   CGAL::Polygon_mesh_processing::remove_connected_components()
 
@@ -626,13 +905,24 @@ SWIG_CGAL_python_vector_of_int_typecheck
                                  boost::shared_ptr<std::vector<int> > components_to_remove,
                                  boost::shared_ptr<std::vector<int> > fcm)
   {
-    CGAL::set_halfedgeds_items_id(P.get_data());
+    P.compact();
     typedef Polyhedron_3_SWIG_wrapper::cpp_base::Facet_handle Facet_handle;
     Int_from_id_pmap<Facet_handle> pmap(*fcm);
     PMP::remove_connected_components(P.get_data(),
                                      *components_to_remove,
                                      pmap);
   }
+  void remove_connected_components(Polyhedron_3_SWIG_wrapper& P,
+                                   SWIG_CGAL::Buffer<int> components_to_remove,
+                                   const Face_components& labels)
+  {
+    if (!P.has_compact_ids() || std::size_t(labels.number_of_faces()) != P.size_of_facets())
+      throw std::invalid_argument("The labels are not the ones of this polyhedron");
+    typedef Polyhedron_3_SWIG_wrapper::cpp_base::Facet_handle Facet_handle;
+    Int_from_id_pmap<Facet_handle> pmap(labels.component_ids());
+    std::vector<int> components(components_to_remove.data(), components_to_remove.data() + components_to_remove.size());
+    PMP::remove_connected_components(P.get_data(), components, pmap);
+  }
 //
 
 // Geometric Measure functions
@@ -669,6 +959,110 @@ SWIG_CGAL_python_vector_of_int_typecheck
   {
     return PMP::face_border_length(hedge.get_data(), P.get_data());
   }
+//   parallel variants for all the facets, in the order of their ids (see
+//   Polyhedron_3.compact()), or all the edges, in the order of P.edges():
+//   (F,) areas, (F,3) centroids, (E,) lengths and (E,) dihedral angles in
+//   degrees (0 for flat edges, positive for convex ones, NaN on the border)
+  SWIG_CGAL::Buffer<double> face_areas(Polyhedron_3_SWIG_wrapper& P)
+  {
+    SWIG_CGAL::Gil_release gil_release;
+    std::vector<double> out(P.size_of_facets());
+    SWIG_PMP::face_areas<Concurrency_tag>(P.get_data(), facets_by_id(P), out.data());
+    return SWIG_CGAL::Buffer<double>(std::move(out), 1);
+  }
+  SWIG_CGAL::Buffer<double> face_centroids(Polyhedron_3_SWIG_wrapper& P)
+  {
+    SWIG_CGAL::Gil_release gil_release;
+    std::vector<double> out(3 * std::size_t(P.size_of_facets()));
+    SWIG_PMP::face_centroids<Concurrency_tag>(P.get_data(), facets_by_id(P), out.data());
+    return SWIG_CGAL::Buffer<double>(std::move(out), 3);
+  }
+  SWIG_CGAL::Buffer<double> edge_lengths(Polyhedron_3_SWIG_wrapper& P)
+  {
+    SWIG_CGAL::Gil_release gil_release;
+    std::vector<double> out(P.size_of_halfedges() / 2);
+    SWIG_PMP::edge_lengths<Concurrency_tag>(P.get_data(), edge_halfedges(P), out.data());
+    return SWIG_CGAL::Buffer<double>(std::move(out), 1);
+  }
+  SWIG_CGAL::Buffer<double> dihedral_angles(Polyhedron_3_SWIG_wrapper& P)
+  {
+    SWIG_CGAL::Gil_release gil_release;
+    std::vector<double> out(P.size_of_halfedges() / 2);
+    SWIG_PMP::dihedral_angles<Concurrency_tag>(P.get_data(), edge_halfedges(P), out.data());
+    return SWIG_CGAL::Buffer<double>(std::move(out), 1);
+  }
+//
+// Distance functions
+//   CGAL::Polygon_mesh_processing::approximate_Hausdorff_distance() and
+//   approximate_symmetric_Hausdorff_distance(), sampling the faces with
+//   points_per_area_unit points (CGAL's default sampling if not positive)
+  double approximate_Hausdorff_distance(Polyhedron_3_SWIG_wrapper& A, Polyhedron_3_SWIG_wrapper& B,
+                                        double points_per_area_unit = 0)
+  {
+    SWIG_CGAL::Gil_release gil_release;
+    return SWIG_PMP::approximate_Hausdorff_distance<Concurrency_tag>(A.get_data(), B.get_data(),
+                                                                     points_per_area_unit, false);
+  }
+  double approximate_symmetric_Hausdorff_distance(Polyhedron_3_SWIG_wrapper& A, Polyhedron_3_SWIG_wrapper& B,
+                                                  double points_per_area_unit = 0)
+  {
+    SWIG_CGAL::Gil_release gil_release;
+    return SWIG_PMP::approximate_Hausdorff_distance<Concurrency_tag>(A.get_data(), B.get_data(),
+                                                                     points_per_area_unit, true);
+  }
+//   CGAL::Polygon_mesh_processing::max_distance_to_triangle_mesh(), for a (n,3) array
+  double max_distance_to_triangle_mesh(SWIG_CGAL::Buffer<double> points, Polyhedron_3_SWIG_wrapper& P)
+  {
+    SWIG_CGAL::Gil_release gil_release;
+    return SWIG_PMP::max_distance_to_triangle_mesh<Concurrency_tag>(points, P.get_data());
+  }
+//   (n,) distances of the points of a (n,3) array to P, negative inside P
+//   if `with_sign` (P must then be closed), computed concurrently. The
+//   variants with `out` write them in a writable (n,) array of float64 or
+//   float32, such as the view of a Point_set_3 property (property_array()).
+  SWIG_CGAL::Buffer<double> distances_to_triangle_mesh(SWIG_CGAL::Buffer<double> points, Polyhedron_3_SWIG_wrapper& P,
+                                                       bool with_sign = false)
+  {
+    SWIG_CGAL::Gil_release gil_release;
+    std::vector<double> out(points.size() / 3);
+    SWIG_PMP::distances_to_triangle_mesh<Concurrency_tag>(P.get_data(), points, with_sign, out.data());
+    return SWIG_CGAL::Buffer<double>(std::move(out), 1);
+  }
+  void distances_to_triangle_mesh(SWIG_CGAL::Buffer<double> points, Polyhedron_3_SWIG_wrapper& P,
+                                  SWIG_CGAL::Buffer<double> out, bool with_sign)
+  {
+    SWIG_CGAL::Gil_release gil_release;
+    SWIG_PMP::distances_to_triangle_mesh<Concurrency_tag>(P.get_data(), points, with_sign, out);
+  }
+  void distances_to_triangle_mesh(SWIG_CGAL::Buffer<double> points, Polyhedron_3_SWIG_wrapper& P,
+                                  SWIG_CGAL::Buffer<float> out, bool with_sign)
+  {
+    SWIG_CGAL::Gil_release gil_release;
+    SWIG_PMP::distances_to_triangle_mesh<Concurrency_tag>(P.get_data(), points, with_sign, out);
+  }
+//   CGAL::Polygon_mesh_processing::locate_with_AABB_tree(), for the rows of
+//   a (n,3) array: closest facet and barycentric coordinates of each point
+//   (see Face_locations), computed concurrently with the tree of the facets
+//   cached by P
+  Face_locations locate_with_AABB_tree(SWIG_CGAL::Buffer<double> points, Polyhedron_3_SWIG_wrapper& P)
+  {
+    SWIG_CGAL::Gil_release gil_release;
+    Face_locations out;
+    SWIG_PMP::locate_with_AABB_tree<Concurrency_tag>(P, points, out);
+    return out;
+  }
+//   CGAL::Polygon_mesh_processing::sample_triangle_mesh(), appending the
+//   samples to `out` with the normals and the ids of their facets
+//   (property "face_id"), see Mesh_sampling_mode. The facets are sampled
+//   concurrently, the sample only depending on `seed`. Returns the number
+//   of points added.
+  int sample_triangle_mesh(Polyhedron_3_SWIG_wrapper& P, Point_set_3_wrapper<CGAL_PS3>& out,
+                           Mesh_sampling_mode mode, double parameter, int seed = 0)
+  {
+    SWIG_CGAL::Gil_release gil_release;
+    return int(SWIG_PMP::sample_triangle_mesh<Concurrency_tag>(P.get_data(), facets_by_id(P), mode, parameter,
+                                                               (unsigned int)seed, out.get_data()));
+  }
 //
 // Miscellaneous
   Bbox_3 bbox(Polyhedron_3_SWIG_wrapper& P)
@@ -687,16 +1081,60 @@ SWIG_CGAL_python_vector_of_int_typecheck
   {
     return PMP::corefine_and_compute_union(A.get_data(), B.get_data(), out.get_data());
   }
+  // with exact=True, the operation is computed on exact copies of A and B
+  // (see Exact_mesh_3), whose self-intersections are tested concurrently
+  // first, and out is the result rounded to double: A and B are unchanged
+  bool corefine_and_compute_union(Polyhedron_3_SWIG_wrapper& A, Polyhedron_3_SWIG_wrapper& B, Polyhedron_3_SWIG_wrapper& out, bool exact)
+  {
+    SWIG_CGAL::Gil_release gil_release;
+    if (!exact)
+      return PMP::corefine_and_compute_union(A.get_data(), B.get_data(), out.get_data());
+    return SWIG_PMP::exact_boolean_operation<Concurrency_tag>(
+      A.get_data(), B.get_data(), out.get_data(),
+      [](SWIG_PMP::Exact_surface_mesh& a, SWIG_PMP::Exact_surface_mesh& b, SWIG_PMP::Exact_surface_mesh& r)
+      { return PMP::corefine_and_compute_union(a, b, r); });
+  }
 
   bool corefine_and_compute_intersection(Polyhedron_3_SWIG_wrapper& A, Polyhedron_3_SWIG_wrapper& B, Polyhedron_3_SWIG_wrapper& out)
   {
     return PMP::corefine_and_compute_intersection(A.get_data(), B.get_data(), out.get_data());
   }
+  bool corefine_and_compute_intersection(Polyhedron_3_SWIG_wrapper& A, Polyhedron_3_SWIG_wrapper& B, Polyhedron_3_SWIG_wrapper& out, bool exact)
+  {
+    SWIG_CGAL::Gil_release gil_release;
+    if (!exact)
+      return PMP::corefine_and_compute_intersection(A.get_data(), B.get_data(), out.get_data());
+    return SWIG_PMP::exact_boolean_operation<Concurrency_tag>(
+      A.get_data(), B.get_data(), out.get_data(),
+      [](SWIG_PMP::Exact_surface_mesh& a, SWIG_PMP::Exact_surface_mesh& b, SWIG_PMP::Exact_surface_mesh& r)
+      { return PMP::corefine_and_compute_intersection(a, b, r); });
+  }
 
   bool corefine_and_compute_difference(Polyhedron_3_SWIG_wrapper& A, Polyhedron_3_SWIG_wrapper& B, Polyhedron_3_SWIG_wrapper& out)
   {
     return PMP::corefine_and_compute_difference(A.get_data(), B.get_data(), out.get_data());
   }
+  bool corefine_and_compute_difference(Polyhedron_3_SWIG_wrapper& A, Polyhedron_3_SWIG_wrapper& B, Polyhedron_3_SWIG_wrapper& out, bool exact)
+  {
+    SWIG_CGAL::Gil_release gil_release;
+    if (!exact)
+      return PMP::corefine_and_compute_difference(A.get_data(), B.get_data(), out.get_data());
+    return SWIG_PMP::exact_boolean_operation<Concurrency_tag>(
+      A.get_data(), B.get_data(), out.get_data(),
+      [](SWIG_PMP::Exact_surface_mesh& a, SWIG_PMP::Exact_surface_mesh& b, SWIG_PMP::Exact_surface_mesh& r)
+      { return PMP::corefine_and_compute_difference(a, b, r); });
+  }
+
+  // union of all the meshes, see SWIG_PMP::union_all()
+  bool corefine_and_compute_union_all(const std::vector<Polyhedron_3_SWIG_wrapper>& meshes, Polyhedron_3_SWIG_wrapper& out)
+  {
+    SWIG_CGAL::Gil_release gil_release;
+    std::vector<const Polyhedron_3_SWIG_wrapper::cpp_base*> parts;
+    parts.reserve(meshes.size());
+    for (const Polyhedron_3_SWIG_wrapper& m : meshes)
+      parts.push_back(&m.get_data());
+    return SWIG_PMP::union_all(parts, out.get_data());
+  }
 
   bool clip(Polyhedron_3_SWIG_wrapper& A, Polyhedron_3_SWIG_wrapper& B)
   {
@@ -717,18 +1155,402 @@ SWIG_CGAL_python_vector_of_int_typecheck
   {
     PMP::split(A.get_data(), plane.get_data());
   }
+//   tiling: the triangles of the pieces of P in each cell of a grid (of
+//   square cells in the xy plane, or of the given sizes along x, y and z,
+//   0 for an axis not split) or of an arrangement of (N,4) planes (a,b,c,d),
+//   all cut in one pass, concurrently. A is not modified.
+  Mesh_tiles split_by_grid(Polyhedron_3_SWIG_wrapper& A, const Point_3& origin, double cell_size)
+  {
+    SWIG_CGAL::Gil_release gil_release;
+    Mesh_tiles out;
+    SWIG_PMP::split_by_grid<Concurrency_tag>(A.get_data(), {{origin.x(), origin.y(), origin.z()}},
+                                             {{cell_size, cell_size, 0}}, out);
+    return out;
+  }
+  Mesh_tiles split_by_grid(Polyhedron_3_SWIG_wrapper& A, const Point_3& origin, const Vector_3& cell_sizes)
+  {
+    SWIG_CGAL::Gil_release gil_release;
+    Mesh_tiles out;
+    SWIG_PMP::split_by_grid<Concurrency_tag>(A.get_data(), {{origin.x(), origin.y(), origin.z()}},
+                                             {{cell_sizes.get_data().x(), cell_sizes.get_data().y(), cell_sizes.get_data().z()}}, out);
+    return out;
+  }
+  Mesh_tiles split_by_planes(Polyhedron_3_SWIG_wrapper& A, SWIG_CGAL::Buffer<double> planes)
+  {
+    SWIG_CGAL::Gil_release gil_release;
+    Mesh_tiles out;
+    SWIG_PMP::split_by_planes<Concurrency_tag>(A.get_data(), planes, out);
+    return out;
+  }
 
 //   CGAL::Polygon_mesh_processing::border_halfedges() (4.8)
   void border_halfedges(Facet_range facet_range,
                         Polyhedron_3_SWIG_wrapper& P,
                         Halfedge_output_iterator out)
   {
-    CGAL::set_halfedgeds_items_id(P.get_data());
+    P.compact();
     PMP::border_halfedges(make_range(facet_range), P.get_data(), out);
   }
 
 %}
 
+// Surface_mesh_3 variants: per-element results are arrays indexed like the
+// elements, after removed elements are collected
+%inline %{
+  #ifndef SWIG
+  std::vector<Surface_mesh_3_::Face_index> faces_by_index(Surface_mesh_3_& mesh)
+  {
+    mesh.collect_garbage();
+    return std::vector<Surface_mesh_3_::Face_index>(mesh.faces().begin(), mesh.faces().end());
+  }
+  std::vector<Surface_mesh_3_::Halfedge_index> edge_halfedges(Surface_mesh_3_& mesh)
+  {
+    mesh.collect_garbage();
+    std::vector<Surface_mesh_3_::Halfedge_index> out;
+    out.reserve(mesh.number_of_edges());
+    for (Surface_mesh_3_::Edge_index e : mesh.edges())
+      out.push_back(mesh.halfedge(e));
+    return out;
+  }
+  // copies a property of the elements of a mesh without removed elements
+  // into an array indexed like its elements
+  template <class Index>
+  SWIG_CGAL::Buffer<double> normals_to_buffer(Surface_mesh_3_& mesh,
+                                              Surface_mesh_3_::Property_map<Index, EPIC_Kernel::Vector_3> normals,
+                                              std::size_t size)
+  {
+    std::vector<double> out(3 * size);
+    for (std::size_t i = 0; i < size; ++i)
+    {
+      const EPIC_Kernel::Vector_3& v = normals[Index(Surface_mesh_3_::size_type(i))];
+      out[3*i] = v.x();
+      out[3*i+1] = v.y();
+      out[3*i+2] = v.z();
+    }
+    mesh.remove_property_map(normals);
+    return SWIG_CGAL::Buffer<double>(std::move(out), 3);
+  }
+  #endif
+
+// Meshing Functions
+  void triangulate_faces(Surface_mesh_3& M)
+  {
+    PMP::triangulate_faces(M.get_data());
+  }
+  void isotropic_remeshing(double target_edge_length,
+                           Surface_mesh_3& M,
+                           int number_of_iterations=1)
+  {
+    SWIG_CGAL::Gil_release gil_release;
+    PMP::isotropic_remeshing(faces(M.get_data()), target_edge_length, M.get_data(),
+                             params::number_of_iterations(number_of_iterations));
+  }
+  void split_long_edges(const double& max_length,
+                        Surface_mesh_3& M)
+  {
+    std::vector<Surface_mesh_3_::Edge_index> edges(M.get_data().edges().begin(), M.get_data().edges().end());
+    PMP::split_long_edges(edges, max_length, M.get_data());
+  }
+// Predicate Functions
+  bool does_self_intersect(Surface_mesh_3& M)
+  {
+    SWIG_CGAL::Gil_release gil_release;
+    return PMP::does_self_intersect<Concurrency_tag>(M.get_data());
+  }
+  // (N,2) array of the indices of the pairs of intersecting faces
+  SWIG_CGAL::Buffer<int> self_intersections(Surface_mesh_3& M)
+  {
+    SWIG_CGAL::Gil_release gil_release;
+    typedef Surface_mesh_3::cpp_base::Face_index Face_index;
+    std::vector< std::pair<Face_index, Face_index> > pairs;
+    PMP::self_intersections<Concurrency_tag>(M.get_data(), std::back_inserter(pairs));
+    std::vector<int> ids;
+    ids.reserve(2 * pairs.size());
+    for (const std::pair<Face_index, Face_index>& p : pairs)
+    {
+      ids.push_back(int(p.first));
+      ids.push_back(int(p.second));
+    }
+    return SWIG_CGAL::Buffer<int>(std::move(ids), 2);
+  }
+  bool do_intersect(Surface_mesh_3& M, Surface_mesh_3& N)
+  {
+    return PMP::do_intersect(M.get_data(), N.get_data());
+  }
+// Orientation Functions
+  bool is_outward_oriented(Surface_mesh_3& M)
+  {
+    return PMP::is_outward_oriented(M.get_data());
+  }
+  void reverse_face_orientations(Surface_mesh_3& M)
+  {
+    PMP::reverse_face_orientations(M.get_data());
+  }
+// Combinatorial Repairing Functions
+  void stitch_borders(Surface_mesh_3& M)
+  {
+    PMP::stitch_borders(M.get_data());
+  }
+  void polygon_soup_to_polygon_mesh(const std::vector<Point_3>& points,
+                                    const std::vector< std::vector<int> >& polygons,
+                                    Surface_mesh_3& M)
+  {
+    std::vector< Point_3::cpp_base > cgal_points;
+    cgal_points.reserve(points.size());
+    BOOST_FOREACH(const Point_3& pt, points)
+      cgal_points.push_back( pt.get_data() );
+    PMP::polygon_soup_to_polygon_mesh(cgal_points, polygons, M.get_data());
+  }
+  void remove_isolated_vertices(Surface_mesh_3& M)
+  {
+    PMP::remove_isolated_vertices(M.get_data());
+  }
+// Normal Computation Functions, (n,3) arrays
+  SWIG_CGAL::Buffer<double> compute_face_normals(Surface_mesh_3& M)
+  {
+    M.get_data().collect_garbage();
+    Surface_mesh_3_::Property_map<Surface_mesh_3_::Face_index, EPIC_Kernel::Vector_3> normals =
+      M.get_data().add_property_map<Surface_mesh_3_::Face_index, EPIC_Kernel::Vector_3>("f:SWIG_CGAL_normal", CGAL::NULL_VECTOR).first;
+    PMP::compute_face_normals(M.get_data(), normals);
+    return normals_to_buffer(M.get_data(), normals, M.get_data().number_of_faces());
+  }
+  SWIG_CGAL::Buffer<double> compute_vertex_normals(Surface_mesh_3& M)
+  {
+    M.get_data().collect_garbage();
+    Surface_mesh_3_::Property_map<Surface_mesh_3_::Vertex_index, EPIC_Kernel::Vector_3> normals =
+      M.get_data().add_property_map<Surface_mesh_3_::Vertex_index, EPIC_Kernel::Vector_3>("v:SWIG_CGAL_normal", CGAL::NULL_VECTOR).first;
+    PMP::compute_vertex_normals(M.get_data(), normals);
+    return normals_to_buffer(M.get_data(), normals, M.get_data().number_of_vertices());
+  }
+// Connected Components
+  // id of the connected component of each face
+  boost::shared_ptr<std::vector<int> >
+  connected_components(Surface_mesh_3& M)
+  {
+    M.get_data().collect_garbage();
+    Surface_mesh_3_::Property_map<Surface_mesh_3_::Face_index, int> fcm =
+      M.get_data().add_property_map<Surface_mesh_3_::Face_index, int>("f:SWIG_CGAL_component", -1).first;
+    PMP::connected_components(M.get_data(), fcm);
+    boost::shared_ptr<std::vector<int> > cc_ids( new std::vector<int>(fcm.begin(), fcm.begin() + M.get_data().number_of_faces()) );
+    M.get_data().remove_property_map(fcm);
+    return cc_ids;
+  }
+  Face_components connected_component_labels(Surface_mesh_3& M)
+  {
+    SWIG_CGAL::Gil_release gil_release;
+    Face_components out;
+    SWIG_PMP::label_connected_components<Concurrency_tag>(
+      M.get_data(), faces_by_index(M.get_data()), [](Surface_mesh_3_::Face_index f) { return std::size_t(f); }, out);
+    return out;
+  }
+  int keep_large_connected_components(Surface_mesh_3& M,
+                                      int threshold_components_to_keep)
+  {
+    return PMP::keep_large_connected_components(M.get_data(),
+                                                threshold_components_to_keep);
+  }
+  int keep_largest_connected_components(Surface_mesh_3& M,
+                                        int nb_components_to_keep)
+  {
+    return PMP::keep_largest_connected_components(M.get_data(),
+                                                  nb_components_to_keep);
+  }
+// Geometric Measure functions
+  double area(Surface_mesh_3& M)
+  {
+    return PMP::area(M.get_data());
+  }
+  double volume(Surface_mesh_3& M)
+  {
+    return PMP::volume(M.get_data());
+  }
+  Bbox_3 bbox(Surface_mesh_3& M)
+  {
+    return Bbox_3( PMP::bbox(M.get_data()));
+  }
+  // the samples of the faces, with the indices of the faces (see
+  // sample_triangle_mesh() on Polyhedron_3)
+  int sample_triangle_mesh(Surface_mesh_3& M, Point_set_3_wrapper<CGAL_PS3>& out,
+                           Mesh_sampling_mode mode, double parameter, int seed = 0)
+  {
+    SWIG_CGAL::Gil_release gil_release;
+    std::vector<Surface_mesh_3_::Face_index> faces = faces_by_index(M.get_data());
+    return int(SWIG_PMP::sample_triangle_mesh<Concurrency_tag>(M.get_data(), faces, mode, parameter,
+                                                               (unsigned int)seed, out.get_data()));
+  }
+  SWIG_CGAL::Buffer<double> face_areas(Surface_mesh_3& M)
+  {
+    SWIG_CGAL::Gil_release gil_release;
+    std::vector<Surface_mesh_3_::Face_index> faces = faces_by_index(M.get_data());
+    std::vector<double> out(faces.size());
+    SWIG_PMP::face_areas<Concurrency_tag>(M.get_data(), faces, out.data());
+    return SWIG_CGAL::Buffer<double>(std::move(out), 1);
+  }
+  SWIG_CGAL::Buffer<double> face_centroids(Surface_mesh_3& M)
+  {
+    SWIG_CGAL::Gil_release gil_release;
+    std::vector<Surface_mesh_3_::Face_index> faces = faces_by_index(M.get_data());
+    std::vector<double> out(3 * faces.size());
+    SWIG_PMP::face_centroids<Concurrency_tag>(M.get_data(), faces, out.data());
+    return SWIG_CGAL::Buffer<double>(std::move(out), 3);
+  }
+  SWIG_CGAL::Buffer<double> edge_lengths(Surface_mesh_3& M)
+  {
+    SWIG_CGAL::Gil_release gil_release;
+    std::vector<Surface_mesh_3_::Halfedge_index> edges = edge_halfedges(M.get_data());
+    std::vector<double> out(edges.size());
+    SWIG_PMP::edge_lengths<Concurrency_tag>(M.get_data(), edges, out.data());
+    return SWIG_CGAL::Buffer<double>(std::move(out), 1);
+  }
+  SWIG_CGAL::Buffer<double> dihedral_angles(Surface_mesh_3& M)
+  {
+    SWIG_CGAL::Gil_release gil_release;
+    std::vector<Surface_mesh_3_::Halfedge_index> edges = edge_halfedges(M.get_data());
+    std::vector<double> out(edges.size());
+    SWIG_PMP::dihedral_angles<Concurrency_tag>(M.get_data(), edges, out.data());
+    return SWIG_CGAL::Buffer<double>(std::move(out), 1);
+  }
+// Distance functions
+  double approximate_Hausdorff_distance(Surface_mesh_3& A, Surface_mesh_3& B,
+                                        double points_per_area_unit = 0)
+  {
+    SWIG_CGAL::Gil_release gil_release;
+    return SWIG_PMP::approximate_Hausdorff_distance<Concurrency_tag>(A.get_data(), B.get_data(),
+                                                                     points_per_area_unit, false);
+  }
+  double approximate_symmetric_Hausdorff_distance(Surface_mesh_3& A, Surface_mesh_3& B,
+                                                  double points_per_area_unit = 0)
+  {
+    SWIG_CGAL::Gil_release gil_release;
+    return SWIG_PMP::approximate_Hausdorff_distance<Concurrency_tag>(A.get_data(), B.get_data(),
+                                                                     points_per_area_unit, true);
+  }
+  double max_distance_to_triangle_mesh(SWIG_CGAL::Buffer<double> points, Surface_mesh_3& M)
+  {
+    SWIG_CGAL::Gil_release gil_release;
+    return SWIG_PMP::max_distance_to_triangle_mesh<Concurrency_tag>(points, M.get_data());
+  }
+  SWIG_CGAL::Buffer<double> distances_to_triangle_mesh(SWIG_CGAL::Buffer<double> points, Surface_mesh_3& M,
+                                                       bool with_sign = false)
+  {
+    SWIG_CGAL::Gil_release gil_release;
+    std::vector<double> out(points.size() / 3);
+    SWIG_PMP::distances_to_triangle_mesh<Concurrency_tag>(M.get_data(), points, with_sign, out.data());
+    return SWIG_CGAL::Buffer<double>(std::move(out), 1);
+  }
+  void distances_to_triangle_mesh(SWIG_CGAL::Buffer<double> points, Surface_mesh_3& M,
+                                  SWIG_CGAL::Buffer<double> out, bool with_sign)
+  {
+    SWIG_CGAL::Gil_release gil_release;
+    SWIG_PMP::distances_to_triangle_mesh<Concurrency_tag>(M.get_data(), points, with_sign, out);
+  }
+  void distances_to_triangle_mesh(SWIG_CGAL::Buffer<double> points, Surface_mesh_3& M,
+                                  SWIG_CGAL::Buffer<float> out, bool with_sign)
+  {
+    SWIG_CGAL::Gil_release gil_release;
+    SWIG_PMP::distances_to_triangle_mesh<Concurrency_tag>(M.get_data(), points, with_sign, out);
+  }
+// Corefinement based
+  void corefine(Surface_mesh_3& A, Surface_mesh_3& B)
+  {
+    SWIG_CGAL::Gil_release gil_release;
+    PMP::corefine(A.get_data(), B.get_data());
+  }
+  bool corefine_and_compute_union(Surface_mesh_3& A, Surface_mesh_3& B, Surface_mesh_3& out)
+  {
+    SWIG_CGAL::Gil_release gil_release;
+    return PMP::corefine_and_compute_union(A.get_data(), B.get_data(), out.get_data());
+  }
+  bool corefine_and_compute_union(Surface_mesh_3& A, Surface_mesh_3& B, Surface_mesh_3& out, bool exact)
+  {
+    SWIG_CGAL::Gil_release gil_release;
+    if (!exact)
+      return PMP::corefine_and_compute_union(A.get_data(), B.get_data(), out.get_data());
+    return SWIG_PMP::exact_boolean_operation<Concurrency_tag>(
+      A.get_data(), B.get_data(), out.get_data(),
+      [](SWIG_PMP::Exact_surface_mesh& a, SWIG_PMP::Exact_surface_mesh& b, SWIG_PMP::Exact_surface_mesh& r)
+      { return PMP::corefine_and_compute_union(a, b, r); });
+  }
+  bool corefine_and_compute_intersection(Surface_mesh_3& A, Surface_mesh_3& B, Surface_mesh_3& out)
+  {
+    SWIG_CGAL::Gil_release gil_release;
+    return PMP::corefine_and_compute_intersection(A.get_data(), B.get_data(), out.get_data());
+  }
+  bool corefine_and_compute_intersection(Surface_mesh_3& A, Surface_mesh_3& B, Surface_mesh_3& out, bool exact)
+  {
+    SWIG_CGAL::Gil_release gil_release;
+    if (!exact)
+      return PMP::corefine_and_compute_intersection(A.get_data(), B.get_data(), out.get_data());
+    return SWIG_PMP::exact_boolean_operation<Concurrency_tag>(
+      A.get_data(), B.get_data(), out.get_data(),
+      [](SWIG_PMP::Exact_surface_mesh& a, SWIG_PMP::Exact_surface_mesh& b, SWIG_PMP::Exact_surface_mesh& r)
+      { return PMP::corefine_and_compute_intersection(a, b, r); });
+  }
+  bool corefine_and_compute_difference(Surface_mesh_3& A, Surface_mesh_3& B, Surface_mesh_3& out)
+  {
+    SWIG_CGAL::Gil_release gil_release;
+    return PMP::corefine_and_compute_difference(A.get_data(), B.get_data(), out.get_data());
+  }
+  bool corefine_and_compute_difference(Surface_mesh_3& A, Surface_mesh_3& B, Surface_mesh_3& out, bool exact)
+  {
+    SWIG_CGAL::Gil_release gil_release;
+    if (!exact)
+      return PMP::corefine_and_compute_difference(A.get_data(), B.get_data(), out.get_data());
+    return SWIG_PMP::exact_boolean_operation<Concurrency_tag>(
+      A.get_data(), B.get_data(), out.get_data(),
+      [](SWIG_PMP::Exact_surface_mesh& a, SWIG_PMP::Exact_surface_mesh& b, SWIG_PMP::Exact_surface_mesh& r)
+      { return PMP::corefine_and_compute_difference(a, b, r); });
+  }
+  bool corefine_and_compute_union_all(const std::vector<Surface_mesh_3>& meshes, Surface_mesh_3& out)
+  {
+    SWIG_CGAL::Gil_release gil_release;
+    std::vector<const Surface_mesh_3::cpp_base*> parts;
+    parts.reserve(meshes.size());
+    for (const Surface_mesh_3& m : meshes)
+      parts.push_back(&m.get_data());
+    return SWIG_PMP::union_all(parts, out.get_data());
+  }
+  bool clip(Surface_mesh_3& A, Surface_mesh_3& B)
+  {
+    return PMP::clip(A.get_data(), B.get_data());
+  }
+  bool clip(Surface_mesh_3& A, Plane_3& plane)
+  {
+    return PMP::clip(A.get_data(), plane.get_data());
+  }
+  void split(Surface_mesh_3& A, Surface_mesh_3& B)
+  {
+    PMP::split(A.get_data(), B.get_data());
+  }
+  void split(Surface_mesh_3& A, Plane_3& plane)
+  {
+    PMP::split(A.get_data(), plane.get_data());
+  }
+  Mesh_tiles split_by_grid(Surface_mesh_3& A, const Point_3& origin, double cell_size)
+  {
+    SWIG_CGAL::Gil_release gil_release;
+    Mesh_tiles out;
+    SWIG_PMP::split_by_grid<Concurrency_tag>(A.get_data(), {{origin.x(), origin.y(), origin.z()}},
+                                             {{cell_size, cell_size, 0}}, out);
+    return out;
+  }
+  Mesh_tiles split_by_grid(Surface_mesh_3& A, const Point_3& origin, const Vector_3& cell_sizes)
+  {
+    SWIG_CGAL::Gil_release gil_release;
+    Mesh_tiles out;
+    SWIG_PMP::split_by_grid<Concurrency_tag>(A.get_data(), {{origin.x(), origin.y(), origin.z()}},
+                                             {{cell_sizes.get_data().x(), cell_sizes.get_data().y(), cell_sizes.get_data().z()}}, out);
+    return out;
+  }
+  Mesh_tiles split_by_planes(Surface_mesh_3& A, SWIG_CGAL::Buffer<double> planes)
+  {
+    SWIG_CGAL::Gil_release gil_release;
+    Mesh_tiles out;
+    SWIG_PMP::split_by_planes<Concurrency_tag>(A.get_data(), planes, out);
+    return out;
+  }
+%}
+
 #ifdef SWIGJAVA
 SWIG_CGAL_array_of_double_to_vector_of_point_3_typemap_in
 SWIG_CGAL_array_of_int_to_vector_of_vector_of_int_typemap_in
@@ -745,6 +1567,14 @@ void polygon_soup_to_polygon_mesh(boost::shared_ptr< std::vector<EPIC_Kernel::Po
 %}
 #endif
 
+#ifdef SWIGPYTHON
+//asynchronous variants, see CGAL.run_async()
+%pythoncode %{
+import CGAL as _CGAL
+isotropic_remeshing_async = _CGAL.async_variant(isotropic_remeshing)
+%}
+#endif
+
 #ifdef SWIG_CGAL_HAS_Polygon_mesh_processing_USER_PACKAGE
 %include "SWIG_CGAL/User_packages/Polygon_mesh_processing/extensions.i"
 #endif
@@ -0,0 +1,227 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+
+#ifndef SWIG_CGAL_PMP_CONNECTED_COMPONENTS_H
+#define SWIG_CGAL_PMP_CONNECTED_COMPONENTS_H
+
+#include <SWIG_CGAL/Common/Buffer.h>
+
+#ifndef SWIG
+#include <SWIG_CGAL/Polygon_mesh_processing/Measures.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <unordered_map>
+#endif
+
+#include <memory>
+#include <vector>
+
+// Result of connected_component_labels(): the component of each face, in
+// the order of the face ids, and for each component its number of faces,
+// its area and its bounding box (xmin, ymin, zmin, xmax, ymax, zmax). The
+// components are numbered in the order of their first face.
+class Face_components
+{
+  std::shared_ptr<std::vector<int> >    component_ids_sptr;
+  std::shared_ptr<std::vector<int> >    face_counts_sptr;
+  std::shared_ptr<std::vector<double> > areas_sptr;
+  std::shared_ptr<std::vector<double> > bboxes_sptr;
+
+public:
+  Face_components()
+    : component_ids_sptr(new std::vector<int>())
+    , face_counts_sptr(new std::vector<int>())
+    , areas_sptr(new std::vector<double>())
+    , bboxes_sptr(new std::vector<double>()) {}
+  #ifndef SWIG
+  std::vector<int>& component_ids() const { return *component_ids_sptr; }
+  std::vector<int>& face_counts() const { return *face_counts_sptr; }
+  std::vector<double>& areas() const { return *areas_sptr; }
+  std::vector<double>& bboxes() const { return *bboxes_sptr; }
+  #endif
+
+  int number_of_faces() const { return int(component_ids_sptr->size()); }
+  int number_of_components() const { return int(face_counts_sptr->size()); }
+
+  // (F,) component of each face
+  SWIG_CGAL::Buffer<int> component_id_array() const
+  {
+    return SWIG_CGAL::Buffer<int>(component_ids_sptr->data(), component_ids_sptr->size(), 1,
+                                  component_ids_sptr, true);
+  }
+  // (C,) number of faces of each component
+  SWIG_CGAL::Buffer<int> face_count_array() const
+  {
+    return SWIG_CGAL::Buffer<int>(face_counts_sptr->data(), face_counts_sptr->size(), 1,
+                                  face_counts_sptr, true);
+  }
+  // (C,) area of each component
+  SWIG_CGAL::Buffer<double> area_array() const
+  {
+    return SWIG_CGAL::Buffer<double>(areas_sptr->data(), areas_sptr->size(), 1,
+                                     areas_sptr, true);
+  }
+  // (C,6) bounding box of each component
+  SWIG_CGAL::Buffer<double> bbox_array() const
+  {
+    return SWIG_CGAL::Buffer<double>(bboxes_sptr->data(), bboxes_sptr->size() / 6, 6,
+                                     bboxes_sptr, true);
+  }
+};
+
+#ifndef SWIG
+namespace SWIG_PMP {
+
+namespace internal {
+
+// Root of x in the concurrent union-find `parents`, halving the path. A
+// parent always has a smaller index than its child, so that the root of
+// a set is its smallest element and the unions cannot create cycles.
+inline int find_root(std::vector<std::atomic<int> >& parents, int x)
+{
+  for (;;)
+  {
+    int p = parents[x].load(std::memory_order_relaxed);
+    if (p == x) return x;
+    const int gp = parents[p].load(std::memory_order_relaxed);
+    if (gp != p)
+      parents[x].compare_exchange_weak(p, gp, std::memory_order_relaxed);
+    x = gp;
+  }
+}
+
+inline void unite(std::vector<std::atomic<int> >& parents, int a, int b)
+{
+  for (;;)
+  {
+    a = find_root(parents, a);
+    b = find_root(parents, b);
+    if (a == b) return;
+    if (a < b) std::swap(a, b);
+    // links the larger root to the smaller one, unless a was linked meanwhile
+    int expected = a;
+    if (parents[a].compare_exchange_strong(expected, b))
+      return;
+  }
+}
+
+struct Component_statistics
+{
+  int nb_faces;
+  double area;
+  double bbox[6];
+
+  Component_statistics() : nb_faces(0), area(0)
+  {
+    for (int i = 0; i < 3; ++i)
+    {
+      bbox[i] = (std::numeric_limits<double>::max)();
+      bbox[i + 3] = -(std::numeric_limits<double>::max)();
+    }
+  }
+  void add(const Component_statistics& other)
+  {
+    nb_faces += other.nb_faces;
+    area += other.area;
+    for (int i = 0; i < 3; ++i)
+    {
+      bbox[i] = (std::min)(bbox[i], other.bbox[i]);
+      bbox[i + 3] = (std::max)(bbox[i + 3], other.bbox[i + 3]);
+    }
+  }
+};
+
+} // namespace internal
+
+// Labels the connected components of the faces of `mesh` (faces sharing an
+// edge), faces[i] having the id i (face_id(faces[i]) == i). The unions over
+// the edges and the statistics are computed concurrently by blocks of faces.
+// The area of a face is the one of face_areas().
+template <class Concurrency_tag, class Mesh, class Face, class Face_id>
+void label_connected_components(const Mesh& mesh, const std::vector<Face>& faces,
+                                const Face_id& face_id, Face_components& out)
+{
+  typedef typename boost::graph_traits<Mesh>::halfedge_descriptor halfedge_descriptor;
+  if (faces.size() > std::size_t((std::numeric_limits<int>::max)()))
+    throw std::invalid_argument("Too many faces");
+  const int n = int(faces.size());
+  typename boost::property_map<Mesh, CGAL::vertex_point_t>::const_type vpm = get(CGAL::vertex_point, mesh);
+
+  std::vector<std::atomic<int> > parents(faces.size());
+  for (int f = 0; f < n; ++f)
+    parents[f].store(f, std::memory_order_relaxed);
+  internal::for_each_element_block<Concurrency_tag>(faces.size(), [&](std::size_t begin, std::size_t end)
+  {
+    for (std::size_t f = begin; f < end; ++f)
+    {
+      for (halfedge_descriptor h : CGAL::halfedges_around_face(halfedge(faces[f], mesh), mesh))
+      {
+        const halfedge_descriptor o = opposite(h, mesh);
+        if (is_border(o, mesh)) continue;
+        const std::size_t g = face_id(face(o, mesh));
+        if (g > f)
+          internal::unite(parents, int(f), int(g));
+      }
+    }
+  });
+
+  // the root of a component is its first face
+  std::vector<int>& ids = out.component_ids();
+  ids.resize(faces.size());
+  int nb_components = 0;
+  for (int f = 0; f < n; ++f)
+  {
+    const int r = internal::find_root(parents, f);
+    ids[f] = r == f ? nb_components++ : ids[r];
+  }
+
+  std::vector<internal::Component_statistics> statistics(nb_components);
+  std::vector<std::unordered_map<int, internal::Component_statistics> >
+    block_statistics((faces.size() + internal::element_block_size - 1) / internal::element_block_size);
+  internal::for_each_element_block<Concurrency_tag>(faces.size(), [&](std::size_t begin, std::size_t end)
+  {
+    std::unordered_map<int, internal::Component_statistics>& local
+      = block_statistics[begin / internal::element_block_size];
+    for (std::size_t f = begin; f < end; ++f)
+    {
+      internal::Component_statistics& s = local[ids[f]];
+      ++s.nb_faces;
+      for (halfedge_descriptor h : CGAL::halfedges_around_face(halfedge(faces[f], mesh), mesh))
+      {
+        const auto& p = get(vpm, target(h, mesh));
+        const double c[3] = {p.x(), p.y(), p.z()};
+        for (int i = 0; i < 3; ++i)
+        {
+          s.bbox[i] = (std::min)(s.bbox[i], c[i]);
+          s.bbox[i + 3] = (std::max)(s.bbox[i + 3], c[i]);
+        }
+      }
+      s.area += internal::norm(internal::vector_area(faces[f], mesh, vpm));
+    }
+  });
+  for (const std::unordered_map<int, internal::Component_statistics>& local : block_statistics)
+    for (const auto& s : local)
+      statistics[s.first].add(s.second);
+
+  out.face_counts().resize(nb_components);
+  out.areas().resize(nb_components);
+  out.bboxes().resize(6 * std::size_t(nb_components));
+  for (int c = 0; c < nb_components; ++c)
+  {
+    out.face_counts()[c] = statistics[c].nb_faces;
+    out.areas()[c] = statistics[c].area;
+    std::copy(statistics[c].bbox, statistics[c].bbox + 6, out.bboxes().begin() + 6 * c);
+  }
+}
+
+} // namespace SWIG_PMP
+#endif
+
+#endif //SWIG_CGAL_PMP_CONNECTED_COMPONENTS_H
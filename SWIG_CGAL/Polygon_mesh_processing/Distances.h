@@ -0,0 +1,135 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+
+#ifndef SWIG_CGAL_PMP_DISTANCES_H
+#define SWIG_CGAL_PMP_DISTANCES_H
+
+#include <SWIG_CGAL/Common/Buffer.h>
+#include <SWIG_CGAL/Kernel/typedefs.h>
+#include <SWIG_CGAL/AABB_tree/typedefs.h>
+#include <SWIG_CGAL/Polygon_mesh_processing/Measures.h>
+
+#include <CGAL/AABB_face_graph_triangle_primitive.h>
+#include <CGAL/AABB_tree.h>
+#include <CGAL/boost/graph/helpers.h>
+#include <CGAL/Polygon_mesh_processing/distance.h>
+#include <CGAL/Side_of_triangle_mesh.h>
+
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace SWIG_PMP {
+
+// points of a (n,3) array
+inline std::vector<EPIC_Kernel::Point_3> points_of_buffer(const SWIG_CGAL::Buffer<double>& coordinates)
+{
+  if (coordinates.size() % 3 != 0)
+    throw std::invalid_argument("The number of coordinates must be a multiple of 3");
+  std::vector<EPIC_Kernel::Point_3> points;
+  points.reserve(coordinates.size() / 3);
+  for (std::size_t i = 0; i < coordinates.size(); i += 3)
+    points.push_back(EPIC_Kernel::Point_3(coordinates[i], coordinates[i + 1], coordinates[i + 2]));
+  return points;
+}
+
+// out[i]: distance of the point of row i of the (n,3) array `points` to the
+// triangle mesh `mesh`, negative if the point is inside the mesh when
+// `with_sign` (the mesh must then be closed). The distances are computed
+// concurrently with an AABB tree on the faces, built once, also used to
+// find the side of the points.
+template <class Concurrency_tag, class Mesh, class T>
+void distances_to_triangle_mesh(const Mesh& mesh, const SWIG_CGAL::Buffer<double>& points,
+                                bool with_sign, T* out)
+{
+  typedef CGAL::AABB_face_graph_triangle_primitive<Mesh> Primitive;
+  typedef CGAL::AABB_tree<AABB_traits_class<EPIC_Kernel, Primitive> > Tree;
+  typedef CGAL::Side_of_triangle_mesh<Mesh, EPIC_Kernel, CGAL::Default, Tree> Side;
+
+  if (points.size() % 3 != 0)
+    throw std::invalid_argument("The number of coordinates must be a multiple of 3");
+  if (faces(mesh).first == faces(mesh).second)
+    throw std::invalid_argument("The mesh has no faces");
+  if (!CGAL::is_triangle_mesh(mesh))
+    throw std::invalid_argument("The mesh must be a triangle mesh");
+  if (with_sign && !CGAL::is_closed(mesh))
+    throw std::invalid_argument("The signed distances need a closed mesh");
+  const std::size_t nb_points = points.size() / 3;
+  if (nb_points == 0)
+    return;
+
+  Tree tree(faces(mesh).first, faces(mesh).second, mesh);
+  tree.build();
+  tree.accelerate_distance_queries();
+  std::unique_ptr<Side> side(with_sign ? new Side(tree) : nullptr);
+  auto distance = [&](std::size_t row) -> T
+  {
+    const double* p = points.data() + 3 * row;
+    const EPIC_Kernel::Point_3 q(p[0], p[1], p[2]);
+    const double d = std::sqrt(tree.squared_distance(q));
+    return T(side && (*side)(q) == CGAL::ON_BOUNDED_SIDE ? -d : d);
+  };
+  // the first query builds the search structures, the others only read them
+  out[0] = distance(0);
+  internal::for_each_element_block<Concurrency_tag>(nb_points - 1, [&](std::size_t begin, std::size_t end)
+  {
+    for (std::size_t row = begin; row < end; ++row)
+      out[row + 1] = distance(row + 1);
+  });
+}
+
+template <class Concurrency_tag, class Mesh, class T>
+void distances_to_triangle_mesh(const Mesh& mesh, const SWIG_CGAL::Buffer<double>& points,
+                                bool with_sign, SWIG_CGAL::Buffer<T>& out)
+{
+  SWIG_CGAL::check_output_buffer(out, points.size() / 3, "distances");
+  distances_to_triangle_mesh<Concurrency_tag>(mesh, points, with_sign, out.data());
+}
+
+// Approximate Hausdorff distance from A to B (both ways if `symmetric`),
+// the faces being sampled with `points_per_area_unit` points, or with the
+// default sampling of CGAL if it is not positive. The distances of the
+// samples are computed concurrently with Parallel_tag.
+template <class Concurrency_tag, class Mesh>
+double approximate_Hausdorff_distance(const Mesh& A, const Mesh& B, double points_per_area_unit, bool symmetric)
+{
+  namespace PMP = CGAL::Polygon_mesh_processing;
+  namespace params = CGAL::Polygon_mesh_processing::parameters;
+  if (points_per_area_unit > 0)
+  {
+    if (symmetric)
+      return PMP::approximate_symmetric_Hausdorff_distance<Concurrency_tag>(
+        A, B, params::number_of_points_per_area_unit(points_per_area_unit),
+        params::number_of_points_per_area_unit(points_per_area_unit));
+    return PMP::approximate_Hausdorff_distance<Concurrency_tag>(
+      A, B, params::number_of_points_per_area_unit(points_per_area_unit),
+      params::vertex_point_map(get(CGAL::vertex_point, B)));
+  }
+  if (symmetric)
+    return PMP::approximate_symmetric_Hausdorff_distance<Concurrency_tag>(
+      A, B, params::vertex_point_map(get(CGAL::vertex_point, A)),
+      params::vertex_point_map(get(CGAL::vertex_point, B)));
+  return PMP::approximate_Hausdorff_distance<Concurrency_tag>(
+    A, B, params::vertex_point_map(get(CGAL::vertex_point, A)),
+    params::vertex_point_map(get(CGAL::vertex_point, B)));
+}
+
+// largest distance of the points of a (n,3) array to `mesh`, computed
+// concurrently
+template <class Concurrency_tag, class Mesh>
+double max_distance_to_triangle_mesh(const SWIG_CGAL::Buffer<double>& points, const Mesh& mesh)
+{
+  namespace params = CGAL::Polygon_mesh_processing::parameters;
+  return CGAL::Polygon_mesh_processing::max_distance_to_triangle_mesh<Concurrency_tag>(
+    points_of_buffer(points), mesh, params::vertex_point_map(get(CGAL::vertex_point, mesh)));
+}
+
+} // namespace SWIG_PMP
+
+#endif //SWIG_CGAL_PMP_DISTANCES_H
@@ -0,0 +1,188 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+
+#ifndef SWIG_CGAL_PMP_EXACT_MESH_3_H
+#define SWIG_CGAL_PMP_EXACT_MESH_3_H
+
+#include <SWIG_CGAL/Common/Buffer.h>
+
+#include <memory>
+
+#ifndef SWIG
+#include <SWIG_CGAL/Surface_mesh/all_includes.h>
+#include <CGAL/Exact_predicates_exact_constructions_kernel.h>
+#include <CGAL/Surface_mesh.h>
+#include <CGAL/boost/graph/copy_face_graph.h>
+#include <CGAL/boost/graph/helpers.h>
+#include <CGAL/Polygon_mesh_processing/corefinement.h>
+#include <CGAL/Polygon_mesh_processing/self_intersections.h>
+
+#include <stdexcept>
+#include <vector>
+
+namespace SWIG_PMP {
+
+typedef CGAL::Exact_predicates_exact_constructions_kernel EPECK_Kernel;
+typedef CGAL::Surface_mesh<EPECK_Kernel::Point_3>        Exact_surface_mesh;
+
+// Evaluates the points of mesh exactly: their approximations (which are
+// converted to double) are then as tight as possible, and the expression
+// DAGs of the intersection points are released.
+inline void exact_points(Exact_surface_mesh& mesh)
+{
+  for (Exact_surface_mesh::Vertex_index v : mesh.vertices())
+    CGAL::exact(mesh.point(v));
+}
+
+// Replaces the points of mesh by their nearest doubles
+inline void round_points(Exact_surface_mesh& mesh)
+{
+  for (Exact_surface_mesh::Vertex_index v : mesh.vertices())
+  {
+    EPECK_Kernel::Point_3& p = mesh.point(v);
+    p = EPECK_Kernel::Point_3(CGAL::to_double(CGAL::exact(p.x())),
+                              CGAL::to_double(CGAL::exact(p.y())),
+                              CGAL::to_double(CGAL::exact(p.z())));
+  }
+}
+
+// Boolean operation `op` of the closed meshes A and B (with double points)
+// computed with exact points, the result being rounded to double in out.
+// The inputs are tested for self-intersections concurrently first, as the
+// corefinement requires them not to self-intersect (std::invalid_argument).
+template <class Concurrency_tag, class Mesh, class Operation>
+bool exact_boolean_operation(const Mesh& A, const Mesh& B, Mesh& out, const Operation& op)
+{
+  if (CGAL::Polygon_mesh_processing::does_self_intersect<Concurrency_tag>(A))
+    throw std::invalid_argument("The first mesh self-intersects");
+  if (CGAL::Polygon_mesh_processing::does_self_intersect<Concurrency_tag>(B))
+    throw std::invalid_argument("The second mesh self-intersects");
+  Exact_surface_mesh exact_A, exact_B, result;
+  CGAL::copy_face_graph(A, exact_A);
+  CGAL::copy_face_graph(B, exact_B);
+  if (!op(exact_A, exact_B, result))
+    return false;
+  round_points(result);
+  out.clear();
+  CGAL::copy_face_graph(result, out);
+  return true;
+}
+
+} // namespace SWIG_PMP
+#endif
+
+// Triangle mesh with lazy exact points (CGAL::Epeck): the points are kept as
+// intervals and an expression DAG, which is only evaluated exactly when the
+// intervals are not enough to decide a predicate. The intersection points
+// created by the corefinements are kept exactly, so that consecutive Boolean
+// operations on Exact_mesh_3 objects do not round them and stay robust. The
+// conversions from Surface_mesh_3 are exact and cheap; the conversions to
+// Surface_mesh_3 and arrays round each coordinate to the nearest double.
+// The Boolean operations evaluate the points of their result exactly, so
+// that the DAGs do not grow along a chain of operations.
+class Exact_mesh_3
+{
+#ifndef SWIG
+  typedef SWIG_PMP::Exact_surface_mesh Mesh;
+  std::shared_ptr<Mesh> data_sptr;
+#endif
+
+public:
+  Exact_mesh_3() : data_sptr(new Mesh()) {}
+  explicit Exact_mesh_3(const Surface_mesh_3& mesh) : data_sptr(new Mesh())
+  {
+    CGAL::copy_face_graph(mesh.get_data(), *data_sptr);
+  }
+  // see the array constructor of Surface_mesh_3
+  Exact_mesh_3(SWIG_CGAL::Buffer<double> vertices, SWIG_CGAL::Buffer<int> faces) : data_sptr(new Mesh())
+  {
+    CGAL::copy_face_graph(Surface_mesh_3(vertices, faces).get_data(), *data_sptr);
+  }
+
+#ifndef SWIG
+  Mesh& get_data() { return *data_sptr; }
+  const Mesh& get_data() const { return *data_sptr; }
+#endif
+
+  int number_of_vertices() const { return int(data_sptr->number_of_vertices()); }
+  int number_of_faces() const { return int(data_sptr->number_of_faces()); }
+  bool is_closed() const { return CGAL::is_closed(*data_sptr); }
+  // exact test
+  bool does_self_intersect() const { return CGAL::Polygon_mesh_processing::does_self_intersect(*data_sptr); }
+
+  // rounded points, in out which is cleared first
+  void to_surface_mesh(Surface_mesh_3& out) const
+  {
+    out.get_data().clear();
+    exact_points();
+    CGAL::copy_face_graph(*data_sptr, out.get_data());
+  }
+  // (number_of_vertices(), 3), rounded
+  SWIG_CGAL::Buffer<double> vertex_array() const
+  {
+    Surface_mesh_3 mesh;
+    to_surface_mesh(mesh);
+    return mesh.vertex_array();
+  }
+  // (number_of_faces(), 3), the rows of vertex_array()
+  SWIG_CGAL::Buffer<int> face_array() const
+  {
+    Surface_mesh_3 mesh;
+    to_surface_mesh(mesh);
+    return mesh.face_array();
+  }
+
+  // snaps the points to their nearest doubles, e.g. to reset the cost of
+  // exact points after many operations; the mesh may then self-intersect
+  void round_points() { SWIG_PMP::round_points(*data_sptr); }
+
+  Exact_mesh_3 deepcopy() const
+  {
+    Exact_mesh_3 out;
+    out.get_data() = get_data();
+    return out;
+  }
+
+private:
+#ifndef SWIG
+  // evaluates the points exactly, so that their approximations (which are
+  // converted to double) are as tight as possible
+  void exact_points() const { SWIG_PMP::exact_points(*data_sptr); }
+#endif
+};
+
+// Boolean operations of the closed meshes A and B, which are corefined, into
+// out (which may be A or B); false if the output is not manifold
+inline bool corefine_and_compute_union(Exact_mesh_3& A, Exact_mesh_3& B, Exact_mesh_3& out)
+{
+  if (!CGAL::Polygon_mesh_processing::corefine_and_compute_union(A.get_data(), B.get_data(), out.get_data()))
+    return false;
+  SWIG_PMP::exact_points(out.get_data());
+  return true;
+}
+
+inline bool corefine_and_compute_intersection(Exact_mesh_3& A, Exact_mesh_3& B, Exact_mesh_3& out)
+{
+  if (!CGAL::Polygon_mesh_processing::corefine_and_compute_intersection(A.get_data(), B.get_data(), out.get_data()))
+    return false;
+  SWIG_PMP::exact_points(out.get_data());
+  return true;
+}
+
+inline bool corefine_and_compute_difference(Exact_mesh_3& A, Exact_mesh_3& B, Exact_mesh_3& out)
+{
+  if (!CGAL::Polygon_mesh_processing::corefine_and_compute_difference(A.get_data(), B.get_data(), out.get_data()))
+    return false;
+  SWIG_PMP::exact_points(out.get_data());
+  return true;
+}
+
+inline void corefine(Exact_mesh_3& A, Exact_mesh_3& B)
+{
+  CGAL::Polygon_mesh_processing::corefine(A.get_data(), B.get_data());
+}
+
+#endif //SWIG_CGAL_PMP_EXACT_MESH_3_H
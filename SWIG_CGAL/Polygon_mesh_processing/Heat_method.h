@@ -0,0 +1,149 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+
+#ifndef SWIG_CGAL_PMP_HEAT_METHOD_H
+#define SWIG_CGAL_PMP_HEAT_METHOD_H
+
+#include <SWIG_CGAL/Common/Buffer.h>
+
+#ifndef SWIG
+#include <SWIG_CGAL/Polygon_mesh_processing/utils.h>
+
+#include <CGAL/Heat_method_3/Surface_mesh_geodesic_distances_3.h>
+#include <CGAL/boost/graph/helpers.h>
+
+#include <cstddef>
+#include <mutex>
+#include <stdexcept>
+#endif
+
+#include <memory>
+#include <vector>
+
+// Geodesic distances from vertices of a triangle mesh by the heat method
+// of CGAL: the matrices of the mesh are factorized once, when constructed,
+// and each query only runs the solves of these factorizations. The vertices
+// are given and reported by id (the ids of the mesh are compacted first if
+// needed). The mesh must not be modified while the object is used; the
+// copies share the factorization, and their queries run one at a time.
+template <class Polyhedron_wrapper>
+class Heat_method_3_wrapper
+{
+  typedef Heat_method_3_wrapper<Polyhedron_wrapper> Self;
+  //disable deep copy
+  Self deepcopy();
+  void deepcopy(const Self&);
+
+public:
+  #ifndef SWIG
+  typedef typename Polyhedron_wrapper::cpp_base Mesh;
+  typedef typename Mesh::Vertex_handle Vertex_handle;
+  typedef CGAL::Heat_method_3::Surface_mesh_geodesic_distances_3<Mesh> cpp_base;
+  #endif
+
+private:
+#ifndef SWIG
+  struct Data
+  {
+    // kept alive as the solver refers to it
+    Polyhedron_wrapper mesh;
+    std::vector<Vertex_handle> vertices; // by id
+    cpp_base solver;
+    std::vector<double> distances;
+    std::mutex mutex;
+
+    Data(Polyhedron_wrapper& poly, std::vector<Vertex_handle>&& vertices)
+      : mesh(poly), vertices(std::move(vertices)), solver(poly.get_data()), distances(this->vertices.size()) {}
+  };
+
+  static std::vector<Vertex_handle> vertices_by_id(Polyhedron_wrapper& poly)
+  {
+    Mesh& P = poly.get_data();
+    if (P.size_of_facets() == 0)
+      throw std::invalid_argument("The mesh has no faces");
+    if (!CGAL::is_triangle_mesh(P))
+      throw std::invalid_argument("The mesh must be a triangle mesh");
+    if (!poly.has_compact_ids()) poly.compact();
+    std::vector<Vertex_handle> vertices(P.size_of_vertices());
+    for (typename Mesh::Vertex_iterator v = P.vertices_begin(); v != P.vertices_end(); ++v)
+      vertices[v->id()] = v;
+    return vertices;
+  }
+
+  Vertex_handle vertex(int id) const
+  {
+    if (id < 0 || id >= number_of_vertices())
+      throw std::out_of_range("Vertex id out of range");
+    return data_sptr->vertices[std::size_t(id)];
+  }
+
+  // distances from the sources, the mutex being locked
+  template <class T>
+  void estimate(const std::vector<Vertex_handle>& sources, T* out) const
+  {
+    cpp_base& solver = data_sptr->solver;
+    solver.clear_sources();
+    solver.add_sources(sources);
+    solver.estimate_geodesic_distances(X_from_id_pmap<Vertex_handle, double>(data_sptr->distances));
+    for (std::size_t v = 0; v < data_sptr->distances.size(); ++v)
+      out[v] = T(data_sptr->distances[v]);
+  }
+#endif
+
+  std::shared_ptr<Data> data_sptr;
+
+public:
+  Heat_method_3_wrapper(Polyhedron_wrapper& poly)
+    : data_sptr(new Data(poly, vertices_by_id(poly)))
+  {}
+
+  int number_of_vertices() const { return int(data_sptr->vertices.size()); }
+
+  // (V,) distances of the vertices to the vertex `source`
+  SWIG_CGAL::Buffer<double> distances(int source) const
+  {
+    const std::vector<Vertex_handle> sources(1, vertex(source));
+    std::vector<double> out(data_sptr->vertices.size());
+    std::lock_guard<std::mutex> lock(data_sptr->mutex);
+    estimate(sources, out.data());
+    return SWIG_CGAL::Buffer<double>(std::move(out));
+  }
+
+  // (V,) distances of the vertices to the closest of the vertices of the
+  // (n,) array `sources`
+  SWIG_CGAL::Buffer<double> distances(SWIG_CGAL::Buffer<int> sources) const
+  {
+    if (sources.size() == 0)
+      throw std::invalid_argument("Expecting at least one source");
+    std::vector<Vertex_handle> cgal_sources;
+    cgal_sources.reserve(sources.size());
+    for (std::size_t i = 0; i < sources.size(); ++i)
+      cgal_sources.push_back(vertex(sources[i]));
+    std::vector<double> out(data_sptr->vertices.size());
+    std::lock_guard<std::mutex> lock(data_sptr->mutex);
+    estimate(cgal_sources, out.data());
+    return SWIG_CGAL::Buffer<double>(std::move(out));
+  }
+
+  // (S,V) distances of the vertices to each of the S vertices of the array
+  // `sources`, row s for sources[s], in single precision
+  SWIG_CGAL::Buffer<float> distances_batch(SWIG_CGAL::Buffer<int> sources) const
+  {
+    const std::size_t nv = data_sptr->vertices.size();
+    std::vector<Vertex_handle> cgal_sources;
+    cgal_sources.reserve(sources.size());
+    for (std::size_t i = 0; i < sources.size(); ++i)
+      cgal_sources.push_back(vertex(sources[i]));
+    std::vector<float> out(sources.size() * nv);
+    std::lock_guard<std::mutex> lock(data_sptr->mutex);
+    for (std::size_t s = 0; s < cgal_sources.size(); ++s)
+      estimate(std::vector<Vertex_handle>(1, cgal_sources[s]), out.data() + s * nv);
+    return SWIG_CGAL::Buffer<float>(std::move(out), nv);
+  }
+};
+
+
+#endif //SWIG_CGAL_PMP_HEAT_METHOD_H
@@ -0,0 +1,376 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+
+#ifndef SWIG_CGAL_PMP_HOLE_FILLING_H
+#define SWIG_CGAL_PMP_HOLE_FILLING_H
+
+#include <SWIG_CGAL/Common/Buffer.h>
+
+#ifndef SWIG
+#include <CGAL/Polygon_mesh_processing/triangulate_hole.h>
+#include <CGAL/Polygon_mesh_processing/orient_polygon_soup.h>
+#include <CGAL/Polygon_mesh_processing/polygon_soup_to_polygon_mesh.h>
+#include <CGAL/boost/graph/Euler_operations.h>
+#include <CGAL/Polyhedron_items_with_id_3.h>
+#include <CGAL/for_each.h>
+#include <CGAL/tags.h>
+
+#include <array>
+#include <cstddef>
+#include <deque>
+#include <map>
+#include <memory>
+#include <tuple>
+#include <utility>
+#endif
+
+#include <vector>
+
+enum Hole_filling_mode { TRIANGULATE_HOLE = 0, TRIANGULATE_AND_REFINE_HOLE, TRIANGULATE_REFINE_AND_FAIR_HOLE };
+
+// Result of fill_all_holes(): row i of each array describes the i-th hole
+// found. The status of a hole is 1 if it was filled, 0 if the filling (or
+// the fairing) failed and -1 if it was skipped because it is too large.
+class Hole_filling_statistics
+{
+  std::shared_ptr<std::vector<int> >         border_sizes_sptr;
+  std::shared_ptr<std::vector<int> >         facet_counts_sptr;
+  std::shared_ptr<std::vector<int> >         vertex_counts_sptr;
+  std::shared_ptr<std::vector<signed char> > status_sptr;
+
+public:
+  Hole_filling_statistics()
+    : border_sizes_sptr(new std::vector<int>())
+    , facet_counts_sptr(new std::vector<int>())
+    , vertex_counts_sptr(new std::vector<int>())
+    , status_sptr(new std::vector<signed char>()) {}
+  #ifndef SWIG
+  void push_back(int border_size, int nb_facets, int nb_vertices, signed char status)
+  {
+    border_sizes_sptr->push_back(border_size);
+    facet_counts_sptr->push_back(nb_facets);
+    vertex_counts_sptr->push_back(nb_vertices);
+    status_sptr->push_back(status);
+  }
+  void set(std::size_t i, int nb_facets, int nb_vertices, signed char status)
+  {
+    (*facet_counts_sptr)[i] = nb_facets;
+    (*vertex_counts_sptr)[i] = nb_vertices;
+    (*status_sptr)[i] = status;
+  }
+  #endif
+
+  int number_of_holes() const { return int(status_sptr->size()); }
+  int number_of_filled_holes() const
+  {
+    int n = 0;
+    for (signed char s : *status_sptr)
+      if (s == 1) ++n;
+    return n;
+  }
+
+  // number of border edges of each hole
+  SWIG_CGAL::Buffer<int> border_size_array() const
+  {
+    return SWIG_CGAL::Buffer<int>(border_sizes_sptr->data(), border_sizes_sptr->size(), 1,
+                                  border_sizes_sptr, true);
+  }
+  // number of facets added in each hole
+  SWIG_CGAL::Buffer<int> facet_count_array() const
+  {
+    return SWIG_CGAL::Buffer<int>(facet_counts_sptr->data(), facet_counts_sptr->size(), 1,
+                                  facet_counts_sptr, true);
+  }
+  // number of vertices added in each hole
+  SWIG_CGAL::Buffer<int> vertex_count_array() const
+  {
+    return SWIG_CGAL::Buffer<int>(vertex_counts_sptr->data(), vertex_counts_sptr->size(), 1,
+                                  vertex_counts_sptr, true);
+  }
+  SWIG_CGAL::Buffer<signed char> status_array() const
+  {
+    return SWIG_CGAL::Buffer<signed char>(status_sptr->data(), status_sptr->size(), 1,
+                                          status_sptr, true);
+  }
+};
+
+#ifndef SWIG
+namespace SWIG_PMP {
+
+// Fills the holes of P with at most `max_hole_size` border edges (all the
+// holes if max_hole_size<=0). The ids of P must be compact.
+// Each hole is filled in a copy of the rings of facets around it, so that
+// the holes are filled (and faired) concurrently; holes whose rings overlap
+// are filled one after the other in the same copy. The patches are then
+// added to P.
+template <class Concurrency_tag, class Polyhedron>
+void fill_all_holes(Polyhedron& P, int max_hole_size, Hole_filling_mode mode,
+                    double density_control_factor, int fairing_continuity,
+                    Hole_filling_statistics& stats)
+{
+  namespace PMP = CGAL::Polygon_mesh_processing;
+  typedef typename Polyhedron::Point_3 Point;
+  typedef typename Polyhedron::Vertex_handle Vertex_handle;
+  typedef typename Polyhedron::Halfedge_handle Halfedge_handle;
+  typedef typename Polyhedron::Facet_handle Facet_handle;
+
+  // border cycles
+  std::vector<Halfedge_handle> holes;
+  {
+    std::vector<bool> visited(P.size_of_halfedges(), false);
+    for (Halfedge_handle h = P.halfedges_begin(); h != P.halfedges_end(); ++h)
+    {
+      if (!h->is_border() || visited[h->id()]) continue;
+      int size = 0;
+      Halfedge_handle c = h;
+      do {
+        visited[c->id()] = true;
+        ++size;
+        c = c->next();
+      } while (c != h);
+      const bool skipped = max_hole_size > 0 && size > max_hole_size;
+      stats.push_back(size, 0, 0, skipped ? -1 : 0);
+      holes.push_back(skipped ? Halfedge_handle() : h);
+    }
+  }
+
+  // facets within `nb_rings` rings of the border vertices of each hole;
+  // holes sharing facets are grouped with a union-find
+  const int nb_rings = mode == TRIANGULATE_REFINE_AND_FAIR_HOLE ? fairing_continuity + 1 : 1;
+  std::vector<std::size_t> parent(holes.size());
+  for (std::size_t i = 0; i < holes.size(); ++i)
+    parent[i] = i;
+  auto find = [&](std::size_t i) -> std::size_t
+  {
+    while (parent[i] != i)
+      i = parent[i] = parent[parent[i]];
+    return i;
+  };
+  const std::size_t none = std::size_t(-1);
+  std::vector<std::size_t> owner(P.size_of_facets(), none);
+  std::vector<std::size_t> vertex_mark(P.size_of_vertices(), none);
+  for (std::size_t i = 0; i < holes.size(); ++i)
+  {
+    if (holes[i] == Halfedge_handle()) continue;
+    std::vector<Vertex_handle> front;
+    Halfedge_handle c = holes[i];
+    do {
+      vertex_mark[c->vertex()->id()] = i;
+      front.push_back(c->vertex());
+      c = c->next();
+    } while (c != holes[i]);
+    for (int r = 0; r < nb_rings; ++r)
+    {
+      std::vector<Vertex_handle> next_front;
+      for (Vertex_handle v : front)
+      {
+        typename Polyhedron::Halfedge_around_vertex_circulator hv = v->vertex_begin(), done = hv;
+        do {
+          if (hv->is_border()) continue;
+          Facet_handle f = hv->facet();
+          if (owner[f->id()] == none) owner[f->id()] = i;
+          else
+          {
+            std::size_t ra = find(owner[f->id()]), rb = find(i);
+            if (ra != rb) parent[ra] = rb;
+          }
+          typename Polyhedron::Halfedge_around_facet_circulator hf = f->facet_begin(), fdone = hf;
+          do {
+            if (vertex_mark[hf->vertex()->id()] != i)
+            {
+              vertex_mark[hf->vertex()->id()] = i;
+              next_front.push_back(hf->vertex());
+            }
+          } while (++hf != fdone);
+        } while (++hv != done);
+      }
+      front.swap(next_front);
+    }
+  }
+
+  std::vector<std::size_t> group_of_root(holes.size(), none);
+  std::vector<std::vector<std::size_t> > group_holes;
+  for (std::size_t i = 0; i < holes.size(); ++i)
+  {
+    if (holes[i] == Halfedge_handle()) continue;
+    std::size_t r = find(i);
+    if (group_of_root[r] == none)
+    {
+      group_of_root[r] = group_holes.size();
+      group_holes.push_back(std::vector<std::size_t>());
+    }
+    group_holes[group_of_root[r]].push_back(i);
+  }
+  std::vector<std::vector<Facet_handle> > group_facets(group_holes.size());
+  for (Facet_handle f = P.facets_begin(); f != P.facets_end(); ++f)
+    if (owner[f->id()] != none)
+      group_facets[group_of_root[find(owner[f->id()])]].push_back(f);
+
+  // filling of the copies
+  struct Filled_hole
+  {
+    std::vector<typename Polyhedron::Facet_handle> facets;
+    std::vector<typename Polyhedron::Vertex_handle> vertices;
+    bool success;
+    Filled_hole() : success(false) {}
+  };
+  struct Group
+  {
+    Polyhedron local;
+    std::vector<Vertex_handle> origin; // vertex of P of the local vertices, by id
+    std::vector<Filled_hole> filled;
+  };
+  std::vector<std::unique_ptr<Group> > groups(group_holes.size());
+  std::vector<std::size_t> group_ids(group_holes.size());
+  for (std::size_t g = 0; g < group_ids.size(); ++g)
+    group_ids[g] = g;
+  CGAL::for_each<Concurrency_tag>
+    (group_ids, [&](const std::size_t& g) -> bool
+     {
+       groups[g].reset(new Group());
+       Group& group = *groups[g];
+
+       // polygon soup of the facets of the group (orient_polygon_soup()
+       // duplicates the non-manifold vertices at the end of the points)
+       std::map<std::size_t, std::size_t> point_id; // by vertex id
+       std::vector<Vertex_handle> ring_vertices;
+       std::vector<Point> points;
+       std::vector<std::vector<std::size_t> > polygons;
+       for (Facet_handle f : group_facets[g])
+       {
+         std::vector<std::size_t> polygon;
+         typename Polyhedron::Halfedge_around_facet_circulator hf = f->facet_begin(), fdone = hf;
+         do {
+           std::map<std::size_t, std::size_t>::iterator it
+             = point_id.insert(std::make_pair(hf->vertex()->id(), points.size())).first;
+           if (it->second == points.size())
+           {
+             points.push_back(hf->vertex()->point());
+             ring_vertices.push_back(hf->vertex());
+           }
+           polygon.push_back(it->second);
+         } while (++hf != fdone);
+         polygons.push_back(polygon);
+       }
+       std::map<Point, Vertex_handle> vertex_at;
+       for (Vertex_handle v : ring_vertices)
+         vertex_at.insert(std::make_pair(v->point(), v));
+       PMP::orient_polygon_soup(points, polygons);
+       PMP::polygon_soup_to_polygon_mesh(points, polygons, group.local);
+       CGAL::set_halfedgeds_items_id(group.local);
+
+       // local border halfedges of the holes, the local vertices being in
+       // the order of the points
+       std::vector<Halfedge_handle> local_holes;
+       for (std::size_t i : group_holes[g])
+       {
+         const Point& source = holes[i]->opposite()->vertex()->point();
+         const Point& target = holes[i]->vertex()->point();
+         Halfedge_handle local_h;
+         for (Halfedge_handle h = group.local.halfedges_begin(); h != group.local.halfedges_end(); ++h)
+           if (h->is_border() && h->vertex()->point() == target && h->opposite()->vertex()->point() == source)
+           {
+             local_h = h;
+             break;
+           }
+         local_holes.push_back(local_h);
+       }
+       std::vector<Vertex_handle> local_vertices;
+       for (Vertex_handle v = group.local.vertices_begin(); v != group.local.vertices_end(); ++v)
+         local_vertices.push_back(v);
+
+       group.filled.resize(local_holes.size());
+       for (std::size_t j = 0; j < local_holes.size(); ++j)
+       {
+         Filled_hole& filled = group.filled[j];
+         if (local_holes[j] == Halfedge_handle()) continue;
+         std::back_insert_iterator<std::vector<Facet_handle> > fout(filled.facets);
+         std::back_insert_iterator<std::vector<Vertex_handle> > vout(filled.vertices);
+         filled.success = true;
+         switch (mode)
+         {
+         case TRIANGULATE_HOLE:
+           PMP::triangulate_hole(group.local, local_holes[j], fout);
+           break;
+         case TRIANGULATE_AND_REFINE_HOLE:
+           PMP::triangulate_and_refine_hole(group.local, local_holes[j], fout, vout,
+                                            PMP::parameters::density_control_factor(density_control_factor));
+           break;
+         default:
+           filled.success = std::get<0>(
+             PMP::triangulate_refine_and_fair_hole(group.local, local_holes[j], fout, vout,
+                                                   PMP::parameters::density_control_factor(density_control_factor).
+                                                   fairing_continuity(fairing_continuity)));
+         }
+         if (filled.facets.empty()) filled.success = false;
+       }
+
+       CGAL::set_halfedgeds_items_id(group.local);
+       group.origin.resize(group.local.size_of_vertices());
+       for (std::size_t k = 0; k < local_vertices.size(); ++k)
+       {
+         if (k < ring_vertices.size())
+           group.origin[local_vertices[k]->id()] = ring_vertices[k];
+         else
+         {
+           typename std::map<Point, Vertex_handle>::iterator it = vertex_at.find(local_vertices[k]->point());
+           if (it != vertex_at.end())
+             group.origin[local_vertices[k]->id()] = it->second;
+         }
+       }
+       return true;
+     });
+
+  // addition of the patches to P: a facet whose addition would not be
+  // manifold yet is retried once its neighbors are added
+  for (std::size_t g = 0; g < groups.size(); ++g)
+  {
+    Group& group = *groups[g];
+    for (std::size_t j = 0; j < group.filled.size(); ++j)
+    {
+      const std::size_t i = group_holes[g][j];
+      Filled_hole& filled = group.filled[j];
+      if (filled.facets.empty())
+        continue;
+      for (Vertex_handle v : filled.vertices)
+      {
+        Vertex_handle nv = CGAL::add_vertex(P);
+        nv->point() = v->point();
+        group.origin[v->id()] = nv;
+      }
+      std::deque<Facet_handle> queue(filled.facets.begin(), filled.facets.end());
+      std::size_t failures = 0;
+      int nb_facets = 0;
+      while (!queue.empty() && failures < queue.size())
+      {
+        Facet_handle f = queue.front();
+        queue.pop_front();
+        std::array<Vertex_handle, 3> triangle;
+        Halfedge_handle h = f->halfedge();
+        for (int k = 0; k < 3; ++k, h = h->next())
+          triangle[k] = group.origin[h->vertex()->id()];
+        if (CGAL::Euler::add_face(triangle, P) == Facet_handle())
+        {
+          queue.push_back(f);
+          ++failures;
+        }
+        else
+        {
+          failures = 0;
+          ++nb_facets;
+        }
+      }
+      if (!queue.empty()) filled.success = false;
+      stats.set(i, nb_facets, int(filled.vertices.size()), filled.success ? 1 : 0);
+    }
+    group.local.clear();
+  }
+}
+
+} // namespace SWIG_PMP
+#endif
+
+#endif //SWIG_CGAL_PMP_HOLE_FILLING_H
@@ -0,0 +1,144 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+
+#ifndef SWIG_CGAL_PMP_LOCATE_H
+#define SWIG_CGAL_PMP_LOCATE_H
+
+#include <SWIG_CGAL/Common/Buffer.h>
+
+#ifndef SWIG
+#include <SWIG_CGAL/Kernel/typedefs.h>
+#include <SWIG_CGAL/AABB_tree/typedefs.h>
+#include <SWIG_CGAL/Polygon_mesh_processing/Measures.h>
+
+#include <CGAL/AABB_face_graph_triangle_primitive.h>
+#include <CGAL/AABB_tree.h>
+#include <CGAL/boost/graph/helpers.h>
+#include <CGAL/Polygon_mesh_processing/locate.h>
+
+#include <cstddef>
+#include <stdexcept>
+#endif
+
+#include <memory>
+#include <vector>
+
+// Result of locate_with_AABB_tree(): row i of face_array() is the id of the
+// facet closest to the i-th query, row i of vertex_array() the ids of its
+// vertices, and row i of barycentric_array() the barycentric coordinates of
+// the closest point with respect to these vertices, so that an attribute
+// of the vertices is interpolated as sum_k b[i,k] * attribute[v[i,k]].
+class Face_locations
+{
+  std::shared_ptr<std::vector<int> >    faces_sptr;
+  std::shared_ptr<std::vector<int> >    vertices_sptr;
+  std::shared_ptr<std::vector<double> > barycentric_sptr;
+
+public:
+  Face_locations()
+    : faces_sptr(new std::vector<int>())
+    , vertices_sptr(new std::vector<int>())
+    , barycentric_sptr(new std::vector<double>()) {}
+  #ifndef SWIG
+  explicit Face_locations(std::size_t nb_queries)
+    : faces_sptr(new std::vector<int>(nb_queries, -1))
+    , vertices_sptr(new std::vector<int>(3 * nb_queries, -1))
+    , barycentric_sptr(new std::vector<double>(3 * nb_queries, 0.)) {}
+  int*    face_data()        { return faces_sptr->data(); }
+  int*    vertex_data()      { return vertices_sptr->data(); }
+  double* barycentric_data() { return barycentric_sptr->data(); }
+  #endif
+
+  int number_of_queries() const { return int(faces_sptr->size()); }
+
+  // (n,1)
+  SWIG_CGAL::Buffer<int> face_array() const
+  {
+    return SWIG_CGAL::Buffer<int>(faces_sptr->data(), faces_sptr->size(), 1,
+                                  faces_sptr, true);
+  }
+  // (n,3)
+  SWIG_CGAL::Buffer<int> vertex_array() const
+  {
+    return SWIG_CGAL::Buffer<int>(vertices_sptr->data(), vertices_sptr->size() / 3, 3,
+                                  vertices_sptr, true);
+  }
+  // (n,3)
+  SWIG_CGAL::Buffer<double> barycentric_array() const
+  {
+    return SWIG_CGAL::Buffer<double>(barycentric_sptr->data(), barycentric_sptr->size() / 3, 3,
+                                     barycentric_sptr, true);
+  }
+};
+
+#ifndef SWIG
+namespace SWIG_PMP {
+
+// CGAL::Polygon_mesh_processing::locate_with_AABB_tree() for the rows of a
+// (n,3) array of points, computed concurrently. The AABB tree of the facets
+// is cached by the polyhedron (see Polyhedron_3.clear_cache()), so that
+// successive batches on the same mesh build it once. The ids of the
+// polyhedron are compacted first if needed.
+template <class Concurrency_tag, class Polyhedron_wrapper>
+void locate_with_AABB_tree(Polyhedron_wrapper& poly, const SWIG_CGAL::Buffer<double>& points,
+                           Face_locations& out)
+{
+  namespace PMP = CGAL::Polygon_mesh_processing;
+  typedef typename Polyhedron_wrapper::cpp_base                    Polyhedron;
+  typedef CGAL::AABB_face_graph_triangle_primitive<Polyhedron>     Primitive;
+  typedef CGAL::AABB_tree<AABB_traits_class<EPIC_Kernel, Primitive> > Tree;
+  typedef typename boost::graph_traits<Polyhedron>::halfedge_descriptor halfedge_descriptor;
+
+  if (points.size() % 3 != 0)
+    throw std::invalid_argument("The number of coordinates must be a multiple of 3");
+  const Polyhedron& P = poly.get_data();
+  if (P.size_of_facets() == 0)
+    throw std::invalid_argument("The mesh has no faces");
+  if (!CGAL::is_triangle_mesh(P))
+    throw std::invalid_argument("The mesh must be a triangle mesh");
+  const std::size_t nb_points = points.size() / 3;
+  out = Face_locations(nb_points);
+  if (nb_points == 0)
+    return;
+
+  if (!poly.has_compact_ids()) poly.compact();
+  std::shared_ptr<const Tree> tree = poly.cache().template get<Tree>(P, [&P]()
+  {
+    std::shared_ptr<Tree> tree(new Tree(faces(P).first, faces(P).second, P));
+    tree->build();
+    tree->accelerate_distance_queries();
+    return tree;
+  });
+
+  int* face_ids = out.face_data();
+  int* vertex_ids = out.vertex_data();
+  double* barycentric = out.barycentric_data();
+  auto locate = [&](std::size_t row)
+  {
+    const double* p = points.data() + 3 * row;
+    const auto location = PMP::locate_with_AABB_tree(EPIC_Kernel::Point_3(p[0], p[1], p[2]), *tree, P);
+    // the order of the barycentric coordinates of CGAL
+    const halfedge_descriptor h = halfedge(location.first, P);
+    face_ids[row] = int(location.first->id());
+    vertex_ids[3 * row] = int(source(h, P)->id());
+    vertex_ids[3 * row + 1] = int(target(h, P)->id());
+    vertex_ids[3 * row + 2] = int(target(next(h, P), P)->id());
+    for (int k = 0; k < 3; ++k)
+      barycentric[3 * row + k] = location.second[k];
+  };
+  // the first query builds the search structures, the others only read them
+  locate(0);
+  internal::for_each_element_block<Concurrency_tag>(nb_points - 1, [&](std::size_t begin, std::size_t end)
+  {
+    for (std::size_t row = begin; row < end; ++row)
+      locate(row + 1);
+  });
+}
+
+} // namespace SWIG_PMP
+#endif
+
+#endif //SWIG_CGAL_PMP_LOCATE_H
@@ -0,0 +1,174 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+
+#ifndef SWIG_CGAL_PMP_MEASURES_H
+#define SWIG_CGAL_PMP_MEASURES_H
+
+#include <CGAL/boost/graph/helpers.h>
+#include <CGAL/boost/graph/iterator.h>
+#include <CGAL/for_each.h>
+#include <CGAL/tags.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+// Measures of all the faces or edges of a mesh at once, written in arrays in
+// the order of the given elements and computed concurrently. The points are
+// read as doubles.
+namespace SWIG_PMP {
+
+namespace internal {
+
+// elements processed by a task
+const std::size_t element_block_size = 4096;
+
+// calls f(begin, end) on blocks of element_block_size of the elements [0, n),
+// concurrently with Parallel_tag
+template <class Concurrency_tag, class F>
+void for_each_element_block(std::size_t n, const F& f)
+{
+  std::vector<std::size_t> blocks((n + element_block_size - 1) / element_block_size);
+  for (std::size_t b = 0; b < blocks.size(); ++b)
+    blocks[b] = b * element_block_size;
+  CGAL::for_each<Concurrency_tag>(blocks, [&](const std::size_t& begin) -> bool
+  {
+    f(begin, (std::min)(begin + element_block_size, n));
+    return true;
+  });
+}
+
+typedef std::array<double, 3> Vector;
+
+inline Vector cross(const Vector& u, const Vector& v)
+{
+  return {{u[1] * v[2] - u[2] * v[1], u[2] * v[0] - u[0] * v[2], u[0] * v[1] - u[1] * v[0]}};
+}
+inline double dot(const Vector& u, const Vector& v) { return u[0] * v[0] + u[1] * v[1] + u[2] * v[2]; }
+inline double norm(const Vector& u) { return std::sqrt(dot(u, u)); }
+
+template <class Point>
+Vector to_vector(const Point& p) { return {{double(p.x()), double(p.y()), double(p.z())}}; }
+
+inline Vector difference(const Vector& p, const Vector& q) { return {{p[0] - q[0], p[1] - q[1], p[2] - q[2]}}; }
+
+// Vector area of the face f: normal to f, its norm being the area of f if f
+// is planar
+template <class Mesh, class Face, class Vpm>
+Vector vector_area(Face f, const Mesh& mesh, Vpm vpm)
+{
+  typedef typename boost::graph_traits<Mesh>::halfedge_descriptor halfedge_descriptor;
+  const halfedge_descriptor h0 = halfedge(f, mesh);
+  const Vector p0 = to_vector(get(vpm, target(h0, mesh)));
+  Vector area = {{0, 0, 0}};
+  for (halfedge_descriptor h : CGAL::halfedges_around_face(h0, mesh))
+  {
+    const Vector c = cross(difference(to_vector(get(vpm, target(h, mesh))), p0),
+                           difference(to_vector(get(vpm, target(next(h, mesh), mesh))), p0));
+    for (int i = 0; i < 3; ++i)
+      area[i] += 0.5 * c[i];
+  }
+  return area;
+}
+
+} // namespace internal
+
+// out[i]: area of faces[i]
+template <class Concurrency_tag, class Mesh, class Face>
+void face_areas(const Mesh& mesh, const std::vector<Face>& faces, double* out)
+{
+  typename boost::property_map<Mesh, CGAL::vertex_point_t>::const_type vpm = get(CGAL::vertex_point, mesh);
+  internal::for_each_element_block<Concurrency_tag>(faces.size(), [&](std::size_t begin, std::size_t end)
+  {
+    for (std::size_t f = begin; f < end; ++f)
+      out[f] = internal::norm(internal::vector_area(faces[f], mesh, vpm));
+  });
+}
+
+// out[3*i..3*i+2]: centroid of the area of faces[i], the centroid of its
+// vertices if its area is zero
+template <class Concurrency_tag, class Mesh, class Face>
+void face_centroids(const Mesh& mesh, const std::vector<Face>& faces, double* out)
+{
+  typedef typename boost::graph_traits<Mesh>::halfedge_descriptor halfedge_descriptor;
+  typename boost::property_map<Mesh, CGAL::vertex_point_t>::const_type vpm = get(CGAL::vertex_point, mesh);
+  internal::for_each_element_block<Concurrency_tag>(faces.size(), [&](std::size_t begin, std::size_t end)
+  {
+    for (std::size_t f = begin; f < end; ++f)
+    {
+      // triangles of a fan around p0, weighted by their area along the normal
+      const internal::Vector normal = internal::vector_area(faces[f], mesh, vpm);
+      const halfedge_descriptor h0 = halfedge(faces[f], mesh);
+      const internal::Vector p0 = internal::to_vector(get(vpm, target(h0, mesh)));
+      internal::Vector centroid = {{0, 0, 0}}, mean = {{0, 0, 0}};
+      double weight = 0;
+      std::size_t nb_vertices = 0;
+      for (halfedge_descriptor h : CGAL::halfedges_around_face(h0, mesh))
+      {
+        const internal::Vector p = internal::to_vector(get(vpm, target(h, mesh)));
+        const internal::Vector q = internal::to_vector(get(vpm, target(next(h, mesh), mesh)));
+        const double w = internal::dot(internal::cross(internal::difference(p, p0), internal::difference(q, p0)), normal);
+        for (int i = 0; i < 3; ++i)
+        {
+          centroid[i] += w * (p0[i] + p[i] + q[i]) / 3;
+          mean[i] += p[i];
+        }
+        weight += w;
+        ++nb_vertices;
+      }
+      for (int i = 0; i < 3; ++i)
+        out[3 * f + i] = weight > 0 ? centroid[i] / weight : mean[i] / nb_vertices;
+    }
+  });
+}
+
+// out[i]: length of the edge of edges[i] (a halfedge per edge)
+template <class Concurrency_tag, class Mesh, class Halfedge>
+void edge_lengths(const Mesh& mesh, const std::vector<Halfedge>& edges, double* out)
+{
+  typename boost::property_map<Mesh, CGAL::vertex_point_t>::const_type vpm = get(CGAL::vertex_point, mesh);
+  internal::for_each_element_block<Concurrency_tag>(edges.size(), [&](std::size_t begin, std::size_t end)
+  {
+    for (std::size_t e = begin; e < end; ++e)
+      out[e] = internal::norm(internal::difference(internal::to_vector(get(vpm, target(edges[e], mesh))),
+                                                   internal::to_vector(get(vpm, source(edges[e], mesh)))));
+  });
+}
+
+// out[i]: angle in degrees between the normals of the two faces of the edge
+// of edges[i] (a halfedge per edge): 0 for a flat edge, positive for a convex
+// edge and negative for a concave one, in ]-180,180]. NaN for a border edge.
+template <class Concurrency_tag, class Mesh, class Halfedge>
+void dihedral_angles(const Mesh& mesh, const std::vector<Halfedge>& edges, double* out)
+{
+  typename boost::property_map<Mesh, CGAL::vertex_point_t>::const_type vpm = get(CGAL::vertex_point, mesh);
+  internal::for_each_element_block<Concurrency_tag>(edges.size(), [&](std::size_t begin, std::size_t end)
+  {
+    for (std::size_t e = begin; e < end; ++e)
+    {
+      const Halfedge h = edges[e], o = opposite(h, mesh);
+      if (is_border(h, mesh) || is_border(o, mesh))
+      {
+        out[e] = std::numeric_limits<double>::quiet_NaN();
+        continue;
+      }
+      const internal::Vector n1 = internal::vector_area(face(h, mesh), mesh, vpm);
+      const internal::Vector n2 = internal::vector_area(face(o, mesh), mesh, vpm);
+      const internal::Vector direction = internal::difference(internal::to_vector(get(vpm, target(h, mesh))),
+                                                              internal::to_vector(get(vpm, source(h, mesh))));
+      const double length = internal::norm(direction);
+      const double sine = length > 0 ? internal::dot(internal::cross(n1, n2), direction) / length : 0;
+      out[e] = std::atan2(sine, internal::dot(n1, n2)) * 180 / 3.14159265358979323846;
+    }
+  });
+}
+
+} // namespace SWIG_PMP
+
+#endif //SWIG_CGAL_PMP_MEASURES_H
@@ -0,0 +1,249 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+
+#ifndef SWIG_CGAL_PMP_MESH_SAMPLING_H
+#define SWIG_CGAL_PMP_MESH_SAMPLING_H
+
+#ifndef SWIG
+#include <SWIG_CGAL/Point_set_3/typedefs.h>
+#include <SWIG_CGAL/Polygon_mesh_processing/Measures.h>
+
+#include <CGAL/Random.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <stdexcept>
+#include <vector>
+#endif
+
+// Sampling modes of sample_triangle_mesh(), following the ones of
+// CGAL::Polygon_mesh_processing::sample_triangle_mesh():
+//   RANDOM_UNIFORM_SAMPLING: `parameter` points in total, spread uniformly
+//                            over the area
+//   GRID_SAMPLING:           points of a grid of step `parameter` in each face
+//   MONTE_CARLO_SAMPLING:    `parameter` points per area unit in each face,
+//                            at least one per face with a non-zero area
+//   POISSON_DISK_SAMPLING:   random points at least `parameter` apart
+enum Mesh_sampling_mode { RANDOM_UNIFORM_SAMPLING = 0, GRID_SAMPLING, MONTE_CARLO_SAMPLING, POISSON_DISK_SAMPLING };
+
+#ifndef SWIG
+namespace SWIG_PMP {
+
+namespace internal {
+
+typedef Vector Sample_point;
+
+// seed of the random generator of the face f: the samples only depend on
+// the seed and on the face, not on the scheduling of the blocks
+inline unsigned int face_seed(unsigned int seed, std::size_t f)
+{
+  std::uint64_t z = (std::uint64_t(seed) << 32) + std::uint64_t(f) + 0x9e3779b97f4a7c15ULL;
+  z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+  return static_cast<unsigned int>(z ^ (z >> 31));
+}
+
+// the point of barycentric coordinates (1-u-v, u, v) of t
+inline Sample_point triangle_point(const std::array<Sample_point, 3>& t, double u, double v)
+{
+  Sample_point p;
+  for (int i = 0; i < 3; ++i)
+    p[i] = (1 - u - v) * t[0][i] + u * t[1][i] + v * t[2][i];
+  return p;
+}
+
+inline Sample_point random_triangle_point(const std::array<Sample_point, 3>& t, CGAL::Random& rng)
+{
+  const double r = std::sqrt(rng.get_double());
+  const double s = rng.get_double();
+  return triangle_point(t, r * (1 - s), r * s);
+}
+
+inline double length(const Sample_point& a, const Sample_point& b)
+{
+  return std::sqrt((a[0] - b[0]) * (a[0] - b[0]) + (a[1] - b[1]) * (a[1] - b[1]) + (a[2] - b[2]) * (a[2] - b[2]));
+}
+
+// number of steps of the grid of `step` on the longest edge of t
+inline std::size_t grid_steps(const std::array<Sample_point, 3>& t, double step)
+{
+  const double longest = (std::max)((std::max)(length(t[0], t[1]), length(t[1], t[2])), length(t[2], t[0]));
+  return std::size_t(std::ceil(longest / step));
+}
+
+// Poisson disk sample of the candidates (in their order): a candidate is
+// kept if no kept point is closer than `radius`, found with a grid of
+// cells of side `radius`
+inline std::vector<std::size_t> poisson_disk_subset(const std::vector<Sample_point>& candidates, double radius)
+{
+  typedef std::array<long, 3> Cell;
+  std::map<Cell, std::vector<std::size_t> > grid;
+  std::vector<std::size_t> kept;
+  for (std::size_t i = 0; i < candidates.size(); ++i)
+  {
+    const Sample_point& p = candidates[i];
+    const Cell cell = {{ long(std::floor(p[0] / radius)), long(std::floor(p[1] / radius)),
+                         long(std::floor(p[2] / radius)) }};
+    bool free = true;
+    for (long dx = -1; dx <= 1 && free; ++dx)
+      for (long dy = -1; dy <= 1 && free; ++dy)
+        for (long dz = -1; dz <= 1 && free; ++dz)
+        {
+          const Cell c = {{ cell[0] + dx, cell[1] + dy, cell[2] + dz }};
+          const auto it = grid.find(c);
+          if (it == grid.end()) continue;
+          for (std::size_t j : it->second)
+            if (length(p, candidates[j]) < radius) { free = false; break; }
+        }
+    if (!free) continue;
+    grid[cell].push_back(i);
+    kept.push_back(i);
+  }
+  return kept;
+}
+
+} // namespace internal
+
+// Samples the triangle faces `faces` of `mesh` (see Mesh_sampling_mode) into
+// `out`: the points are appended with the unit normal of their face and the
+// index of the face in `faces` (property "face_id", -1 for the points that
+// were already there). The faces are sampled concurrently, by blocks, and
+// the sample only depends on `seed`. Returns the number of points added.
+template <class Concurrency_tag, class Mesh, class Face>
+std::size_t sample_triangle_mesh(const Mesh& mesh, const std::vector<Face>& faces,
+                                 Mesh_sampling_mode mode, double parameter, unsigned int seed,
+                                 CGAL_PS3& out)
+{
+  typedef internal::Sample_point Sample_point;
+  typedef std::array<Sample_point, 3> Triangle;
+  if (!(parameter > 0))
+    throw std::invalid_argument("The sampling parameter must be positive");
+
+  if (!CGAL::is_triangle_mesh(mesh))
+    throw std::invalid_argument("The mesh must be a triangle mesh");
+
+  const auto vpm = get(CGAL::vertex_point, mesh);
+  const std::size_t nf = faces.size();
+  std::vector<Triangle> triangles(nf);
+  std::vector<double> areas(nf);
+  internal::for_each_element_block<Concurrency_tag>(nf, [&](std::size_t begin, std::size_t end)
+  {
+    for (std::size_t f = begin; f < end; ++f)
+    {
+      int k = 0;
+      for (auto v : CGAL::vertices_around_face(halfedge(faces[f], mesh), mesh))
+        triangles[f][k++] = internal::to_vector(get(vpm, v));
+      areas[f] = internal::norm(internal::vector_area(faces[f], mesh, vpm));
+    }
+  });
+  double total_area = 0;
+  for (double a : areas)
+    total_area += a;
+
+  // points per area unit of the random modes
+  double density = parameter;
+  if (mode == RANDOM_UNIFORM_SAMPLING)
+    density = total_area > 0 ? parameter / total_area : 0;
+  else if (mode == POISSON_DISK_SAMPLING)
+    density = 8 / (3.14159265358979323846 * parameter * parameter);
+
+  // number of points of each face, then their offsets
+  std::vector<std::size_t> offsets(nf + 1, 0);
+  internal::for_each_element_block<Concurrency_tag>(nf, [&](std::size_t begin, std::size_t end)
+  {
+    for (std::size_t f = begin; f < end; ++f)
+    {
+      std::size_t& n = offsets[f + 1];
+      if (mode == GRID_SAMPLING)
+      {
+        const std::size_t k = internal::grid_steps(triangles[f], parameter);
+        n = (k + 1) * (k + 2) / 2;
+      }
+      else if (mode == MONTE_CARLO_SAMPLING)
+        n = std::size_t(std::ceil(areas[f] * density));
+      else
+      {
+        // the expected number of points, the fractional part by a draw
+        CGAL::Random rng(internal::face_seed(seed, f) ^ 0x5bd1e995u);
+        const double expected = areas[f] * density;
+        n = std::size_t(expected) + (rng.get_double() < expected - std::floor(expected) ? 1 : 0);
+      }
+    }
+  });
+  for (std::size_t f = 0; f < nf; ++f)
+    offsets[f + 1] += offsets[f];
+
+  std::vector<Sample_point> samples(offsets[nf]);
+  internal::for_each_element_block<Concurrency_tag>(nf, [&](std::size_t begin, std::size_t end)
+  {
+    for (std::size_t f = begin; f < end; ++f)
+    {
+      const Triangle& t = triangles[f];
+      Sample_point* s = samples.data() + offsets[f];
+      if (mode == GRID_SAMPLING)
+      {
+        const std::size_t k = internal::grid_steps(t, parameter);
+        for (std::size_t i = 0; i <= k; ++i)
+          for (std::size_t j = 0; i + j <= k; ++j)
+            *s++ = k == 0 ? t[0] : internal::triangle_point(t, double(i) / double(k), double(j) / double(k));
+      }
+      else
+      {
+        CGAL::Random rng(internal::face_seed(seed, f));
+        for (std::size_t i = offsets[f]; i < offsets[f + 1]; ++i)
+          *s++ = internal::random_triangle_point(t, rng);
+      }
+    }
+  });
+
+  // the face of each sample, then the samples kept
+  std::vector<std::size_t> sample_faces(samples.size());
+  for (std::size_t f = 0; f < nf; ++f)
+    std::fill(sample_faces.begin() + offsets[f], sample_faces.begin() + offsets[f + 1], f);
+  std::vector<std::size_t> kept;
+  if (mode == POISSON_DISK_SAMPLING)
+    kept = internal::poisson_disk_subset(samples, parameter);
+  else
+  {
+    kept.resize(samples.size());
+    for (std::size_t i = 0; i < kept.size(); ++i)
+      kept[i] = i;
+  }
+
+  if (out.has_garbage())
+    out.collect_garbage();
+  const std::size_t first = out.size();
+  out.add_normal_map();
+  CGAL_PS3::Property_map<int> face_ids = out.add_property_map<int>("face_id", -1).first;
+  out.resize(first + kept.size());
+  CGAL_PS3::Point_map points = out.point_map();
+  CGAL_PS3::Vector_map normals = out.normal_map();
+  internal::for_each_element_block<Concurrency_tag>(kept.size(), [&](std::size_t begin, std::size_t end)
+  {
+    for (std::size_t i = begin; i < end; ++i)
+    {
+      const Sample_point& p = samples[kept[i]];
+      const std::size_t f = sample_faces[kept[i]];
+      const Triangle& t = triangles[f];
+      const internal::Vector n = internal::cross(internal::difference(t[1], t[0]), internal::difference(t[2], t[0]));
+      const double l = internal::norm(n);
+      const CGAL_PS3::Index index(CGAL_PS3::size_type(first + i));
+      points[index] = EPIC_Kernel::Point_3(p[0], p[1], p[2]);
+      normals[index] = l > 0 ? EPIC_Kernel::Vector_3(n[0] / l, n[1] / l, n[2] / l) : CGAL::NULL_VECTOR;
+      face_ids[index] = int(f);
+    }
+  });
+  return kept.size();
+}
+
+} // namespace SWIG_PMP
+#endif
+
+#endif //SWIG_CGAL_PMP_MESH_SAMPLING_H
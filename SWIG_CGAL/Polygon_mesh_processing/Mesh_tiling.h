@@ -0,0 +1,425 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+
+#ifndef SWIG_CGAL_PMP_MESH_TILING_H
+#define SWIG_CGAL_PMP_MESH_TILING_H
+
+#include <SWIG_CGAL/Common/Buffer.h>
+
+#ifndef SWIG
+#include <SWIG_CGAL/Polygon_mesh_processing/Measures.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+#include <map>
+#include <stdexcept>
+#include <unordered_map>
+#endif
+
+#include <memory>
+#include <vector>
+
+// Result of split_by_grid() and split_by_planes(): the triangle meshes of
+// the tiles, sorted by key. The vertices and the faces of the tile t are the
+// rows [vertex_offsets[t], vertex_offsets[t+1]) of the vertex array and
+// [face_offsets[t], face_offsets[t+1]) of the face array, the faces indexing
+// the vertices of their tile.
+class Mesh_tiles
+{
+  int m_key_size;
+  std::shared_ptr<std::vector<int> >    keys_sptr;
+  std::shared_ptr<std::vector<double> > vertices_sptr;
+  std::shared_ptr<std::vector<int> >    vertex_offsets_sptr;
+  std::shared_ptr<std::vector<int> >    faces_sptr;
+  std::shared_ptr<std::vector<int> >    face_offsets_sptr;
+
+  void check_tile(int t) const
+  {
+    if (t < 0 || t >= number_of_tiles())
+      throw std::out_of_range("Tile index out of range");
+  }
+
+public:
+  Mesh_tiles()
+    : m_key_size(0)
+    , keys_sptr(new std::vector<int>())
+    , vertices_sptr(new std::vector<double>())
+    , vertex_offsets_sptr(new std::vector<int>(1, 0))
+    , faces_sptr(new std::vector<int>())
+    , face_offsets_sptr(new std::vector<int>(1, 0)) {}
+  #ifndef SWIG
+  void set_key_size(int k) { m_key_size = k; }
+  std::vector<int>& keys() const { return *keys_sptr; }
+  std::vector<double>& vertices() const { return *vertices_sptr; }
+  std::vector<int>& vertex_offsets() const { return *vertex_offsets_sptr; }
+  std::vector<int>& faces() const { return *faces_sptr; }
+  std::vector<int>& face_offsets() const { return *face_offsets_sptr; }
+  #endif
+
+  int number_of_tiles() const { return int(face_offsets_sptr->size()) - 1; }
+
+  // (T,k) key of each tile: the (i,j,k) cell of the grid for split_by_grid(),
+  // the side of each plane (0 negative, 1 positive) for split_by_planes()
+  SWIG_CGAL::Buffer<int> key_array() const
+  {
+    return SWIG_CGAL::Buffer<int>(keys_sptr->data(), m_key_size == 0 ? 0 : keys_sptr->size() / m_key_size,
+                                  m_key_size, keys_sptr, true);
+  }
+  // (V,3) vertices of all the tiles
+  SWIG_CGAL::Buffer<double> vertices_array() const
+  {
+    return SWIG_CGAL::Buffer<double>(vertices_sptr->data(), vertices_sptr->size() / 3, 3,
+                                     vertices_sptr, true);
+  }
+  // (T+1,)
+  SWIG_CGAL::Buffer<int> vertex_offset_array() const
+  {
+    return SWIG_CGAL::Buffer<int>(vertex_offsets_sptr->data(), vertex_offsets_sptr->size(), 1,
+                                  vertex_offsets_sptr, true);
+  }
+  // (F,3) faces of all the tiles
+  SWIG_CGAL::Buffer<int> faces_array() const
+  {
+    return SWIG_CGAL::Buffer<int>(faces_sptr->data(), faces_sptr->size() / 3, 3,
+                                  faces_sptr, true);
+  }
+  // (T+1,)
+  SWIG_CGAL::Buffer<int> face_offset_array() const
+  {
+    return SWIG_CGAL::Buffer<int>(face_offsets_sptr->data(), face_offsets_sptr->size(), 1,
+                                  face_offsets_sptr, true);
+  }
+  // (V_t,3) and (F_t,3) arrays of the tile t, e.g. for Polyhedron_3.from_arrays()
+  SWIG_CGAL::Buffer<double> tile_vertices(int t) const
+  {
+    check_tile(t);
+    const int begin = (*vertex_offsets_sptr)[t], end = (*vertex_offsets_sptr)[t + 1];
+    return SWIG_CGAL::Buffer<double>(vertices_sptr->data() + 3 * std::size_t(begin), end - begin, 3,
+                                     vertices_sptr, true);
+  }
+  SWIG_CGAL::Buffer<int> tile_faces(int t) const
+  {
+    check_tile(t);
+    const int begin = (*face_offsets_sptr)[t], end = (*face_offsets_sptr)[t + 1];
+    return SWIG_CGAL::Buffer<int>(faces_sptr->data() + 3 * std::size_t(begin), end - begin, 3,
+                                  faces_sptr, true);
+  }
+};
+
+#ifndef SWIG
+namespace SWIG_PMP {
+
+namespace internal {
+
+typedef std::vector<Vector> Polygon;
+
+// Splits the convex polygon `in` by the plane {p, dot(p, normal) == offset}
+// into its parts below and above the plane. An edge is always cut from its
+// lexicographically smaller endpoint, so that the polygons sharing the edge
+// get the same point.
+inline void split_polygon(const Polygon& in, const Vector& normal, double offset,
+                          Polygon& below, Polygon& above)
+{
+  below.clear();
+  above.clear();
+  const std::size_t n = in.size();
+  for (std::size_t i = 0; i < n; ++i)
+  {
+    const Vector& p = in[i];
+    const Vector& q = in[(i + 1) % n];
+    const double dp = dot(p, normal) - offset, dq = dot(q, normal) - offset;
+    if (dp <= 0) below.push_back(p);
+    if (dp >= 0) above.push_back(p);
+    if ((dp < 0 && dq > 0) || (dp > 0 && dq < 0))
+    {
+      const bool forward = p < q;
+      const Vector& a = forward ? p : q;
+      const Vector& b = forward ? q : p;
+      const double da = forward ? dp : dq, db = forward ? dq : dp;
+      const double t = da / (da - db);
+      const Vector x = {{a[0] + t * (b[0] - a[0]), a[1] + t * (b[1] - a[1]), a[2] + t * (b[2] - a[2])}};
+      below.push_back(x);
+      above.push_back(x);
+    }
+  }
+  if (below.size() < 3) below.clear();
+  if (above.size() < 3) above.clear();
+}
+
+// Calls f(key, piece) for the pieces of the triangle t in the cells of a
+// grid. Along an axis a, the cell i is [origin[a] + i*sizes[a], origin[a] + (i+1)*sizes[a]],
+// an axis with a size 0 not being split.
+struct Grid_splitter
+{
+  Vector origin, sizes;
+
+  std::size_t key_size() const { return 3; }
+
+  template <class F>
+  void operator()(const Polygon& t, const F& f) const
+  {
+    std::vector<std::pair<std::array<int, 3>, Polygon> > pieces(1), next;
+    pieces[0].first = {{0, 0, 0}};
+    pieces[0].second = t;
+    Polygon below, above;
+    for (int a = 0; a < 3; ++a)
+    {
+      if (sizes[a] <= 0) continue;
+      Vector normal = {{0, 0, 0}};
+      normal[a] = 1;
+      next.clear();
+      for (std::pair<std::array<int, 3>, Polygon>& piece : pieces)
+      {
+        double lo = piece.second[0][a], hi = lo;
+        for (const Vector& p : piece.second)
+        {
+          lo = (std::min)(lo, p[a]);
+          hi = (std::max)(hi, p[a]);
+        }
+        const int first = int(std::floor((lo - origin[a]) / sizes[a]));
+        const int last = (std::max)(first, int(std::ceil((hi - origin[a]) / sizes[a])) - 1);
+        // cuts off the cells of the piece one after the other
+        Polygon rest = piece.second;
+        for (int i = first; i <= last && !rest.empty(); ++i)
+        {
+          if (i == last)
+            below = rest, above.clear();
+          else
+            split_polygon(rest, normal, origin[a] + (i + 1) * sizes[a], below, above);
+          if (!below.empty())
+          {
+            next.emplace_back(piece.first, below);
+            next.back().first[a] = i;
+          }
+          rest.swap(above);
+        }
+      }
+      pieces.swap(next);
+    }
+    std::vector<int> key(3);
+    for (const std::pair<std::array<int, 3>, Polygon>& piece : pieces)
+    {
+      std::copy(piece.first.begin(), piece.first.end(), key.begin());
+      f(key, piece.second);
+    }
+  }
+};
+
+// Calls f(key, piece) for the pieces of the triangle t in the cells of the
+// arrangement of planes, key[i] being 0 below the plane i and 1 above it.
+// A plane is (a, b, c, d), of equation a*x + b*y + c*z + d = 0.
+struct Planes_splitter
+{
+  std::vector<std::pair<Vector, double> > planes;
+
+  std::size_t key_size() const { return planes.size(); }
+
+  template <class F>
+  void operator()(const Polygon& t, const F& f) const
+  {
+    std::vector<std::pair<std::vector<int>, Polygon> > pieces(1), next;
+    pieces[0].first.reserve(planes.size());
+    pieces[0].second = t;
+    Polygon below, above;
+    for (const std::pair<Vector, double>& plane : planes)
+    {
+      next.clear();
+      for (std::pair<std::vector<int>, Polygon>& piece : pieces)
+      {
+        split_polygon(piece.second, plane.first, plane.second, below, above);
+        if (!below.empty())
+        {
+          next.emplace_back(piece.first, below);
+          next.back().first.push_back(0);
+        }
+        if (!above.empty())
+        {
+          next.emplace_back(std::move(piece.first), above);
+          next.back().first.push_back(1);
+        }
+      }
+      pieces.swap(next);
+    }
+    for (const std::pair<std::vector<int>, Polygon>& piece : pieces)
+      f(piece.first, piece.second);
+  }
+};
+
+struct Coordinates_hash
+{
+  std::size_t operator()(const Vector& p) const
+  {
+    std::size_t h = 0;
+    for (int i = 0; i < 3; ++i)
+    {
+      // +0.0 and -0.0 have the same hash
+      const double c = p[i] == 0 ? 0. : p[i];
+      unsigned long long bits;
+      std::memcpy(&bits, &c, sizeof(bits));
+      h ^= std::hash<unsigned long long>()(bits) + 0x9e3779b97f4a7c15ULL + (h << 6) + (h >> 2);
+    }
+    return h;
+  }
+};
+
+// triangles (9 coordinates each) of the pieces in a tile
+typedef std::map<std::vector<int>, std::vector<double> > Tile_triangles;
+
+} // namespace internal
+
+// Splits the triangles (9 coordinates each) with `splitter` and writes the
+// tiles in `out`. The triangles are split concurrently by blocks, then the
+// tiles are built concurrently, their vertices being merged.
+template <class Concurrency_tag, class Splitter>
+void split_triangles(const std::vector<double>& triangles, const Splitter& splitter, Mesh_tiles& out)
+{
+  const std::size_t nb_triangles = triangles.size() / 9;
+  const std::size_t nb_blocks = (nb_triangles + internal::element_block_size - 1) / internal::element_block_size;
+  std::vector<internal::Tile_triangles> block_tiles(nb_blocks);
+  internal::for_each_element_block<Concurrency_tag>(nb_triangles, [&](std::size_t begin, std::size_t end)
+  {
+    internal::Tile_triangles& tiles = block_tiles[begin / internal::element_block_size];
+    internal::Polygon triangle(3);
+    for (std::size_t t = begin; t < end; ++t)
+    {
+      for (int i = 0; i < 3; ++i)
+        triangle[i] = {{triangles[9 * t + 3 * i], triangles[9 * t + 3 * i + 1], triangles[9 * t + 3 * i + 2]}};
+      splitter(triangle, [&](const std::vector<int>& key, const internal::Polygon& piece)
+      {
+        // the pieces are convex
+        std::vector<double>& coordinates = tiles[key];
+        for (std::size_t i = 1; i + 1 < piece.size(); ++i)
+          for (const internal::Vector* p : {&piece[0], &piece[i], &piece[i + 1]})
+            coordinates.insert(coordinates.end(), p->begin(), p->end());
+      });
+    }
+  });
+
+  // keys of the tiles, sorted
+  internal::Tile_triangles all_tiles;
+  for (const internal::Tile_triangles& tiles : block_tiles)
+    for (const auto& tile : tiles)
+      all_tiles[tile.first];
+  std::vector<const std::vector<int>*> keys;
+  keys.reserve(all_tiles.size());
+  for (const auto& tile : all_tiles)
+    keys.push_back(&tile.first);
+
+  std::vector<std::vector<double> > tile_vertices(keys.size());
+  std::vector<std::vector<int> > tile_faces(keys.size());
+  std::vector<std::size_t> tile_ids(keys.size());
+  for (std::size_t t = 0; t < keys.size(); ++t)
+    tile_ids[t] = t;
+  CGAL::for_each<Concurrency_tag>(tile_ids, [&](const std::size_t& t) -> bool
+  {
+    std::unordered_map<internal::Vector, int, internal::Coordinates_hash> ids;
+    std::vector<double>& vertices = tile_vertices[t];
+    std::vector<int>& faces = tile_faces[t];
+    for (const internal::Tile_triangles& tiles : block_tiles)
+    {
+      internal::Tile_triangles::const_iterator it = tiles.find(*keys[t]);
+      if (it == tiles.end()) continue;
+      const std::vector<double>& coordinates = it->second;
+      for (std::size_t i = 0; i < coordinates.size(); i += 9)
+      {
+        int face[3];
+        for (int j = 0; j < 3; ++j)
+        {
+          const internal::Vector p = {{coordinates[i + 3 * j], coordinates[i + 3 * j + 1], coordinates[i + 3 * j + 2]}};
+          std::pair<std::unordered_map<internal::Vector, int, internal::Coordinates_hash>::iterator, bool> inserted
+            = ids.emplace(p, int(vertices.size() / 3));
+          if (inserted.second)
+            vertices.insert(vertices.end(), p.begin(), p.end());
+          face[j] = inserted.first->second;
+        }
+        // drops the triangles degenerated by the merge
+        if (face[0] != face[1] && face[1] != face[2] && face[2] != face[0])
+          faces.insert(faces.end(), face, face + 3);
+      }
+    }
+    return true;
+  });
+
+  out.set_key_size(int(splitter.key_size()));
+  std::vector<int>& out_keys = out.keys();
+  std::vector<double>& out_vertices = out.vertices();
+  std::vector<int>& out_faces = out.faces();
+  out_keys.clear();
+  out_vertices.clear();
+  out_faces.clear();
+  out.vertex_offsets().assign(1, 0);
+  out.face_offsets().assign(1, 0);
+  for (std::size_t t = 0; t < keys.size(); ++t)
+  {
+    if (tile_faces[t].empty()) continue;
+    out_keys.insert(out_keys.end(), keys[t]->begin(), keys[t]->end());
+    out_vertices.insert(out_vertices.end(), tile_vertices[t].begin(), tile_vertices[t].end());
+    out_faces.insert(out_faces.end(), tile_faces[t].begin(), tile_faces[t].end());
+    out.vertex_offsets().push_back(int(out_vertices.size() / 3));
+    out.face_offsets().push_back(int(out_faces.size() / 3));
+  }
+}
+
+// Triangles of the faces of `mesh`, triangulated as fans
+template <class Mesh>
+std::vector<double> triangle_soup(const Mesh& mesh)
+{
+  typedef typename boost::graph_traits<Mesh>::face_descriptor face_descriptor;
+  typedef typename boost::graph_traits<Mesh>::halfedge_descriptor halfedge_descriptor;
+  typename boost::property_map<Mesh, CGAL::vertex_point_t>::const_type vpm = get(CGAL::vertex_point, mesh);
+  std::vector<double> triangles;
+  triangles.reserve(9 * num_faces(mesh));
+  internal::Polygon polygon;
+  for (face_descriptor f : faces(mesh))
+  {
+    polygon.clear();
+    for (halfedge_descriptor h : CGAL::halfedges_around_face(halfedge(f, mesh), mesh))
+      polygon.push_back(internal::to_vector(get(vpm, target(h, mesh))));
+    for (std::size_t i = 1; i + 1 < polygon.size(); ++i)
+      for (const internal::Vector* p : {&polygon[0], &polygon[i], &polygon[i + 1]})
+        triangles.insert(triangles.end(), p->begin(), p->end());
+  }
+  return triangles;
+}
+
+// Tiles of `mesh` in the cells of a grid (see internal::Grid_splitter)
+template <class Concurrency_tag, class Mesh>
+void split_by_grid(const Mesh& mesh, const internal::Vector& origin, const internal::Vector& sizes, Mesh_tiles& out)
+{
+  for (int a = 0; a < 3; ++a)
+    if (!(sizes[a] >= 0) || !std::isfinite(sizes[a]))
+      throw std::invalid_argument("The cell sizes must be positive, or 0 for an axis not split");
+  internal::Grid_splitter splitter;
+  splitter.origin = origin;
+  splitter.sizes = sizes;
+  split_triangles<Concurrency_tag>(triangle_soup(mesh), splitter, out);
+}
+
+// Tiles of `mesh` in the cells of the arrangement of the (N,4) planes
+// (a, b, c, d) of equation a*x + b*y + c*z + d = 0
+template <class Concurrency_tag, class Mesh>
+void split_by_planes(const Mesh& mesh, const SWIG_CGAL::Buffer<double>& planes, Mesh_tiles& out)
+{
+  if (planes.size() % 4 != 0 || (planes.size() != 0 && planes.cols() != 4))
+    throw std::invalid_argument("Expecting (N,4) planes (a, b, c, d)");
+  internal::Planes_splitter splitter;
+  for (std::size_t i = 0; i < planes.size(); i += 4)
+  {
+    const internal::Vector normal = {{planes[i], planes[i + 1], planes[i + 2]}};
+    if (internal::dot(normal, normal) == 0)
+      throw std::invalid_argument("Degenerate plane");
+    splitter.planes.emplace_back(normal, -planes[i + 3]);
+  }
+  split_triangles<Concurrency_tag>(triangle_soup(mesh), splitter, out);
+}
+
+} // namespace SWIG_PMP
+#endif
+
+#endif //SWIG_CGAL_PMP_MESH_TILING_H
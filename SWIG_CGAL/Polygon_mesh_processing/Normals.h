@@ -0,0 +1,146 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+
+#ifndef SWIG_CGAL_PMP_NORMALS_H
+#define SWIG_CGAL_PMP_NORMALS_H
+
+#include <SWIG_CGAL/Common/Buffer.h>
+
+#include <CGAL/Polygon_mesh_processing/compute_normal.h>
+#include <CGAL/for_each.h>
+#include <CGAL/tags.h>
+
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+namespace SWIG_PMP {
+
+namespace internal {
+
+// Checks that `normals` is a writable array of n normals
+template <class T>
+void check_normals_buffer(const SWIG_CGAL::Buffer<T>& normals, std::size_t n)
+{
+  if (normals.is_readonly())
+    throw std::invalid_argument("The array of normals is read-only");
+  if (normals.size() != 3 * n)
+    throw std::invalid_argument("Expecting an (N,3) array of normals, N being the number of elements");
+}
+
+// The handles of [begin,end) indexed by their ids, which must be compact
+template <class Handle, class Iterator>
+std::vector<Handle> handles_by_id(Iterator begin, Iterator end, std::size_t n)
+{
+  std::vector<Handle> handles(n);
+  for (; begin != end; ++begin)
+  {
+    if (begin->id() >= n)
+      throw std::invalid_argument("The ids of the polyhedron are not compact");
+    handles[begin->id()] = begin;
+  }
+  return handles;
+}
+
+// Computes concurrently the normals of `elements` and writes each of them
+// in the row of `normals` given by its id
+template <class Concurrency_tag, class Handle, class Normal, class T>
+void write_normals(const std::vector<Handle>& elements, const Normal& normal,
+                   SWIG_CGAL::Buffer<T>& normals)
+{
+  CGAL::for_each<Concurrency_tag>
+    (elements, [&](const Handle& h) -> bool
+     {
+       const auto n = normal(h);
+       T* row = normals.data() + 3 * h->id();
+       row[0] = T(n.x());
+       row[1] = T(n.y());
+       row[2] = T(n.z());
+       return true;
+     });
+}
+
+template <class Handle>
+std::vector<Handle> changed_elements(const std::vector<Handle>& by_id,
+                                     const SWIG_CGAL::Buffer<int>& ids)
+{
+  std::vector<Handle> out;
+  out.reserve(ids.size());
+  for (std::size_t i = 0; i < ids.size(); ++i)
+  {
+    if (ids[i] < 0 || std::size_t(ids[i]) >= by_id.size())
+      throw std::invalid_argument("Facet id out of range");
+    out.push_back(by_id[ids[i]]);
+  }
+  return out;
+}
+
+} // namespace internal
+
+// Writes the normals of the facets of P, whose ids must be compact, in the
+// (size_of_facets(),3) array `normals`. If `changed_facets` (ids of facets)
+// is given, only the normals of these facets are recomputed.
+template <class Concurrency_tag, class Polyhedron, class T>
+void face_normals_to_buffer(Polyhedron& P, SWIG_CGAL::Buffer<T>& normals,
+                            const SWIG_CGAL::Buffer<int>* changed_facets = nullptr)
+{
+  typedef typename Polyhedron::Facet_handle Facet_handle;
+  internal::check_normals_buffer(normals, P.size_of_facets());
+  std::vector<Facet_handle> facets
+    = internal::handles_by_id<Facet_handle>(P.facets_begin(), P.facets_end(), P.size_of_facets());
+  if (changed_facets != nullptr)
+    facets = internal::changed_elements(facets, *changed_facets);
+  internal::write_normals<Concurrency_tag>
+    (facets,
+     [&P](Facet_handle f) { return CGAL::Polygon_mesh_processing::compute_face_normal(f, P); },
+     normals);
+}
+
+// Writes the normals of the vertices of P, whose ids must be compact, in the
+// (size_of_vertices(),3) array `normals`. If `changed_facets` (ids of facets)
+// is given, only the normals of the vertices of these facets are recomputed:
+// if a vertex was moved, all its incident facets must be given.
+template <class Concurrency_tag, class Polyhedron, class T>
+void vertex_normals_to_buffer(Polyhedron& P, SWIG_CGAL::Buffer<T>& normals,
+                              const SWIG_CGAL::Buffer<int>* changed_facets = nullptr)
+{
+  typedef typename Polyhedron::Vertex_handle Vertex_handle;
+  typedef typename Polyhedron::Facet_handle Facet_handle;
+  typedef typename Polyhedron::Halfedge_around_facet_circulator Circulator;
+  internal::check_normals_buffer(normals, P.size_of_vertices());
+  std::vector<Vertex_handle> vertices;
+  if (changed_facets == nullptr)
+    vertices = internal::handles_by_id<Vertex_handle>(P.vertices_begin(), P.vertices_end(), P.size_of_vertices());
+  else
+  {
+    std::vector<Facet_handle> facets
+      = internal::changed_elements(internal::handles_by_id<Facet_handle>(P.facets_begin(), P.facets_end(), P.size_of_facets()),
+                                   *changed_facets);
+    std::vector<bool> seen(P.size_of_vertices(), false);
+    for (Facet_handle f : facets)
+    {
+      Circulator c = f->facet_begin(), done = c;
+      do {
+        Vertex_handle v = c->vertex();
+        if (v->id() >= seen.size())
+          throw std::invalid_argument("The ids of the polyhedron are not compact");
+        if (!seen[v->id()])
+        {
+          seen[v->id()] = true;
+          vertices.push_back(v);
+        }
+      } while (++c != done);
+    }
+  }
+  internal::write_normals<Concurrency_tag>
+    (vertices,
+     [&P](Vertex_handle v) { return CGAL::Polygon_mesh_processing::compute_vertex_normal(v, P); },
+     normals);
+}
+
+} // namespace SWIG_PMP
+
+#endif //SWIG_CGAL_PMP_NORMALS_H
@@ -0,0 +1,311 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+
+#ifndef SWIG_CGAL_PMP_PARALLEL_REMESHING_H
+#define SWIG_CGAL_PMP_PARALLEL_REMESHING_H
+
+#include <SWIG_CGAL/Kernel/Thread_pool.h>
+
+#include <CGAL/Polygon_mesh_processing/remesh.h>
+#include <CGAL/Polygon_mesh_processing/polygon_soup_to_polygon_mesh.h>
+#include <CGAL/boost/graph/Euler_operations.h>
+#include <CGAL/boost/graph/Face_filtered_graph.h>
+#include <CGAL/boost/graph/copy_face_graph.h>
+#include <CGAL/boost/graph/helpers.h>
+#include <CGAL/Polyhedron_items_with_id_3.h>
+#include <CGAL/property_map.h>
+#include <CGAL/centroid.h>
+#include <CGAL/for_each.h>
+#include <CGAL/tags.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <map>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace SWIG_PMP {
+
+namespace internal {
+
+// Assigns the patch ids [first_patch, first_patch+nb_patches) to the faces
+// of [begin,end) by recursive median splits of their centroids along the
+// longest side of their bounding box
+template <class Point>
+void split_in_patches(std::vector<std::pair<Point, std::size_t> >& centroids,
+                      std::size_t begin, std::size_t end,
+                      int first_patch, int nb_patches,
+                      std::vector<int>& patch_of_face)
+{
+  if (nb_patches == 1 || end - begin < 2)
+  {
+    for (std::size_t i = begin; i < end; ++i)
+      patch_of_face[centroids[i].second] = first_patch;
+    return;
+  }
+  CGAL::Bbox_3 bbox;
+  for (std::size_t i = begin; i < end; ++i)
+    bbox += centroids[i].first.bbox();
+  int axis = 0;
+  for (int a = 1; a < 3; ++a)
+    if (bbox.max(a) - bbox.min(a) > bbox.max(axis) - bbox.min(axis))
+      axis = a;
+  std::size_t middle = begin + (end - begin) / 2;
+  std::nth_element(centroids.begin() + begin, centroids.begin() + middle, centroids.begin() + end,
+                   [axis](const std::pair<Point, std::size_t>& a, const std::pair<Point, std::size_t>& b)
+                   { return a.first[axis] < b.first[axis]; });
+  split_in_patches(centroids, begin, middle, first_patch, nb_patches / 2, patch_of_face);
+  split_in_patches(centroids, middle, end, first_patch + nb_patches / 2, nb_patches - nb_patches / 2, patch_of_face);
+}
+
+// Splits the face of the chain of halfedges q, which is a triangle once the
+// chain is seen as one edge, by connecting the targets of the halfedges of
+// the chain to the apex of the face. The new faces get the next ids and the
+// patch of the face.
+template <class Polyhedron>
+void fan_triangulate(const std::vector<typename Polyhedron::Halfedge_handle>& q, Polyhedron& P,
+                     std::vector<int>& patch_of_face)
+{
+  typedef typename Polyhedron::Halfedge_handle Halfedge_handle;
+  if (q.front()->is_border()) return;
+  const int patch = patch_of_face[q.front()->facet()->id()];
+  Halfedge_handle apex = q.back()->next();
+  for (std::size_t j = q.size() - 1; j > 0; --j)
+  {
+    Halfedge_handle h3 = CGAL::Euler::split_face(q[j - 1], apex, P);
+    h3->opposite()->facet()->id() = patch_of_face.size();
+    patch_of_face.push_back(patch);
+    apex = h3;
+  }
+}
+
+} // namespace internal
+
+// Isotropic remeshing of the facets `selection` of the triangulated
+// polyhedron P, whose ids must be compact. The selection is split into
+// patches that are remeshed concurrently in separate polyhedra, the edges
+// between patches being first split to the target length and then frozen.
+// The polyhedron is then rebuilt from the patches and the facets that are
+// not selected, and a sequential pass of isotropic remeshing is run on the
+// facets incident to the seams between patches. All handles and ids of P
+// are invalidated. The border of the selection is kept as is.
+template <class Polyhedron, class Concurrency_tag>
+void parallel_isotropic_remeshing(const std::vector<typename Polyhedron::Facet_handle>& selection,
+                                  double target_edge_length,
+                                  Polyhedron& P,
+                                  int number_of_iterations)
+{
+  namespace PMP = CGAL::Polygon_mesh_processing;
+  typedef typename Polyhedron::Point_3 Point;
+  typedef typename Polyhedron::Vertex_handle Vertex_handle;
+  typedef typename Polyhedron::Halfedge_handle Halfedge_handle;
+  typedef typename Polyhedron::Facet_handle Facet_handle;
+  typedef typename boost::graph_traits<Polyhedron>::edge_descriptor edge_descriptor;
+
+  const std::size_t min_patch_size = 5000;
+  std::size_t nb_threads = std::size_t(SWIG_CGAL::current_concurrency());
+  int nb_patches = int((std::min)(4 * nb_threads, selection.size() / min_patch_size));
+  if (nb_patches < 2 || std::is_same<Concurrency_tag, CGAL::Sequential_tag>::value)
+  {
+    PMP::isotropic_remeshing(selection, target_edge_length, P,
+                             PMP::parameters::number_of_iterations(number_of_iterations));
+    return;
+  }
+
+  // patches of the selected facets (-1 for the others)
+  std::vector<int> patch_of_face(P.size_of_facets(), -1);
+  {
+    std::vector<std::pair<Point, std::size_t> > centroids;
+    centroids.reserve(selection.size());
+    for (Facet_handle f : selection)
+    {
+      Halfedge_handle h = f->halfedge();
+      centroids.push_back(std::make_pair(CGAL::centroid(h->vertex()->point(),
+                                                        h->next()->vertex()->point(),
+                                                        h->prev()->vertex()->point()),
+                                         f->id()));
+    }
+    internal::split_in_patches(centroids, 0, centroids.size(), 0, nb_patches, patch_of_face);
+  }
+
+  // seams: edges between facets of different patches, or between a patch
+  // and an unselected facet or the border
+  auto patch = [&](Halfedge_handle h) -> int
+  {
+    return h->is_border() ? -1 : patch_of_face[h->facet()->id()];
+  };
+  std::vector<Halfedge_handle> seams;
+  for (Facet_handle f : selection)
+  {
+    Halfedge_handle h = f->halfedge();
+    for (int i = 0; i < 3; ++i, h = h->next())
+    {
+      int p = patch(h), q = patch(h->opposite());
+      if (p != q && (q == -1 || p < q))
+        seams.push_back(h);
+    }
+  }
+
+  // split the long seams in both incident facets, so that the patches agree
+  // on their common border
+  const double max_length = 4. / 3. * target_edge_length;
+  std::vector<Vertex_handle> seam_vertices, inner_seam_vertices;
+  for (Halfedge_handle h : seams)
+  {
+    const bool inner = patch(h->opposite()) != -1;
+    const Point a = h->opposite()->vertex()->point(), b = h->vertex()->point();
+    const int k = int(std::ceil(std::sqrt(CGAL::squared_distance(a, b)) / max_length));
+    std::vector<Halfedge_handle> chain;
+    for (int i = 1; i < k; ++i)
+    {
+      Halfedge_handle hnew = CGAL::Euler::split_edge(h, P);
+      hnew->vertex()->point() = a + (b - a) * (double(i) / k);
+      chain.push_back(hnew);
+    }
+    chain.push_back(h);
+    for (Halfedge_handle c : chain)
+    {
+      seam_vertices.push_back(c->vertex());
+      if (inner) inner_seam_vertices.push_back(c->vertex());
+    }
+    seam_vertices.push_back(h->opposite()->vertex());
+    if (inner) inner_seam_vertices.push_back(h->opposite()->vertex());
+    if (k < 2) continue;
+    internal::fan_triangulate(chain, P, patch_of_face);
+    std::vector<Halfedge_handle> opposite_chain;
+    for (std::size_t i = chain.size(); i > 0; --i)
+      opposite_chain.push_back(chain[i - 1]->opposite());
+    internal::fan_triangulate(opposite_chain, P, patch_of_face);
+  }
+  // the new items are at the end of the lists, in the order of their
+  // creation: existing ids and those given to the new facets do not change
+  CGAL::set_halfedgeds_items_id(P);
+
+  std::vector<std::vector<Facet_handle> > patch_faces(nb_patches);
+  for (Facet_handle f = P.facets_begin(); f != P.facets_end(); ++f)
+    if (patch_of_face[f->id()] != -1)
+      patch_faces[patch_of_face[f->id()]].push_back(f);
+
+  // remesh the patches concurrently, their borders being protected
+  std::vector<Polyhedron> patches(nb_patches);
+  std::vector<int> patch_ids(nb_patches);
+  for (int p = 0; p < nb_patches; ++p)
+    patch_ids[p] = p;
+  CGAL::for_each<Concurrency_tag>
+    (patch_ids, [&](const int& p) -> bool
+     {
+       CGAL::Face_filtered_graph<Polyhedron> ffg(P, patch_faces[p]);
+       Polyhedron& local = patches[p];
+       CGAL::copy_face_graph(ffg, local);
+       CGAL::set_halfedgeds_items_id(local);
+       std::set<edge_descriptor> border;
+       for (edge_descriptor e : edges(local))
+         if (CGAL::is_border(e, local))
+           border.insert(e);
+       PMP::isotropic_remeshing(faces(local), target_edge_length, local,
+                                PMP::parameters::number_of_iterations(number_of_iterations)
+                                .edge_is_constrained_map(CGAL::make_boolean_property_map(border))
+                                .protect_constraints(true));
+       return true;
+     });
+
+  // polygon soup of the unselected facets and of the remeshed patches, the
+  // frozen borders of the patches being identified with the seam vertices
+  std::vector<Point> points;
+  std::vector<std::array<std::size_t, 3> > triangles;
+  std::vector<bool> from_patch;
+  points.reserve(P.size_of_vertices());
+  for (Vertex_handle v = P.vertices_begin(); v != P.vertices_end(); ++v)
+    points.push_back(v->point());
+  std::map<Point, std::size_t> seam_point_ids;
+  for (Vertex_handle v : seam_vertices)
+    seam_point_ids.insert(std::make_pair(v->point(), v->id()));
+  std::vector<bool> inner_seam(P.size_of_vertices(), false);
+  for (Vertex_handle v : inner_seam_vertices)
+    inner_seam[v->id()] = true;
+  for (Facet_handle f = P.facets_begin(); f != P.facets_end(); ++f)
+  {
+    if (patch_of_face[f->id()] != -1) continue;
+    Halfedge_handle h = f->halfedge();
+    triangles.push_back({{h->vertex()->id(), h->next()->vertex()->id(), h->prev()->vertex()->id()}});
+    from_patch.push_back(false);
+  }
+  for (Polyhedron& local : patches)
+  {
+    std::map<Vertex_handle, std::size_t> point_id;
+    for (Vertex_handle v = local.vertices_begin(); v != local.vertices_end(); ++v)
+    {
+      if (CGAL::is_border(v, local))
+      {
+        typename std::map<Point, std::size_t>::iterator it = seam_point_ids.find(v->point());
+        if (it == seam_point_ids.end())
+          throw std::runtime_error("A border vertex of a patch was modified");
+        point_id[v] = it->second;
+      }
+      else
+      {
+        point_id[v] = points.size();
+        points.push_back(v->point());
+        inner_seam.push_back(false);
+      }
+    }
+    for (Facet_handle f = local.facets_begin(); f != local.facets_end(); ++f)
+    {
+      Halfedge_handle h = f->halfedge();
+      triangles.push_back({{point_id[h->vertex()], point_id[h->next()->vertex()], point_id[h->prev()->vertex()]}});
+      from_patch.push_back(true);
+    }
+    local.clear();
+  }
+
+  // drop the vertices of the original selection
+  std::vector<std::size_t> new_id(points.size(), std::size_t(-1));
+  std::vector<Point> used_points;
+  std::vector<bool> used_inner_seam;
+  for (std::array<std::size_t, 3>& t : triangles)
+    for (std::size_t& i : t)
+    {
+      if (new_id[i] == std::size_t(-1))
+      {
+        new_id[i] = used_points.size();
+        used_points.push_back(points[i]);
+        used_inner_seam.push_back(inner_seam[i]);
+      }
+      i = new_id[i];
+    }
+
+  P.clear();
+  PMP::polygon_soup_to_polygon_mesh(used_points, triangles, P);
+  CGAL::set_halfedgeds_items_id(P);
+
+  // seam pass: vertices and facets are in the order of the soup
+  std::vector<Facet_handle> seam_faces;
+  std::size_t t = 0;
+  for (Facet_handle f = P.facets_begin(); f != P.facets_end(); ++f, ++t)
+  {
+    if (t >= from_patch.size() || !from_patch[t]) continue;
+    Halfedge_handle h = f->halfedge();
+    for (int i = 0; i < 3; ++i, h = h->next())
+      if (used_inner_seam[h->vertex()->id()])
+      {
+        seam_faces.push_back(f);
+        break;
+      }
+  }
+  if (!seam_faces.empty())
+    PMP::isotropic_remeshing(seam_faces, target_edge_length, P,
+                             PMP::parameters::number_of_iterations(1));
+}
+
+} // namespace SWIG_PMP
+
+#endif //SWIG_CGAL_PMP_PARALLEL_REMESHING_H
@@ -12,8 +12,16 @@
 #include <SWIG_CGAL/Kernel/Plane_3.h>
 #include <SWIG_CGAL/Common/Input_iterator_wrapper.h>
 #include <SWIG_CGAL/Common/Output_iterator_wrapper.h>
+#include <SWIG_CGAL/Common/Buffer.h>
+#include <SWIG_CGAL/AABB_tree/typedefs.h>
 
 #include <CGAL/Polygon_mesh_slicer.h>
+#include <CGAL/for_each.h>
+#include <CGAL/tags.h>
+
+#include <memory>
+#include <stdexcept>
+#include <vector>
 
 /* #if !SWIG_CGAL_NON_SUPPORTED_TARGET_LANGUAGE
 template <class Primitive_object>
@@ -29,6 +37,62 @@ typedef Generic_input_iterator<Point_3> Point_range;
 #endif
  */
 
+// Result of Polygon_mesh_slicer_wrapper::slice_batch(): the polylines of
+// plane i are polylines plane_offset_array()[i] to plane_offset_array()[i+1]
+// (excluded), and the points of polyline j are the rows polyline_offset_array()[j]
+// to polyline_offset_array()[j+1] (excluded) of point_array(). The first
+// point of a closed polyline is repeated at its end.
+class Polyline_batch
+{
+  std::shared_ptr<std::vector<double> >    points_sptr;
+  std::shared_ptr<std::vector<long long> > polyline_offsets_sptr;
+  std::shared_ptr<std::vector<long long> > plane_offsets_sptr;
+
+public:
+  Polyline_batch()
+    : points_sptr(new std::vector<double>())
+    , polyline_offsets_sptr(new std::vector<long long>(1, 0))
+    , plane_offsets_sptr(new std::vector<long long>(1, 0)) {}
+  #ifndef SWIG
+  // appends the polylines of the next plane
+  void push_back(const std::vector< std::vector<EPIC_Kernel::Point_3> >& polylines)
+  {
+    for (const std::vector<EPIC_Kernel::Point_3>& polyline : polylines)
+    {
+      for (const EPIC_Kernel::Point_3& p : polyline)
+      {
+        points_sptr->push_back(p.x());
+        points_sptr->push_back(p.y());
+        points_sptr->push_back(p.z());
+      }
+      polyline_offsets_sptr->push_back((long long)(points_sptr->size() / 3));
+    }
+    plane_offsets_sptr->push_back((long long)(polyline_offsets_sptr->size() - 1));
+  }
+  #endif
+
+  int number_of_planes() const { return int(plane_offsets_sptr->size() - 1); }
+  int number_of_polylines() const { return int(polyline_offsets_sptr->size() - 1); }
+  int number_of_points() const { return int(points_sptr->size() / 3); }
+
+  // (number_of_points(), 3)
+  SWIG_CGAL::Buffer<double> point_array() const
+  {
+    return SWIG_CGAL::Buffer<double>(points_sptr->data(), points_sptr->size() / 3, 3,
+                                     points_sptr, true);
+  }
+  SWIG_CGAL::Buffer<long long> polyline_offset_array() const
+  {
+    return SWIG_CGAL::Buffer<long long>(polyline_offsets_sptr->data(), polyline_offsets_sptr->size(), 1,
+                                        polyline_offsets_sptr, true);
+  }
+  SWIG_CGAL::Buffer<long long> plane_offset_array() const
+  {
+    return SWIG_CGAL::Buffer<long long>(plane_offsets_sptr->data(), plane_offsets_sptr->size(), 1,
+                                        plane_offsets_sptr, true);
+  }
+};
+
 template <class Polyhedron_wrapper>
 class Polygon_mesh_slicer_wrapper
 {
@@ -39,14 +103,46 @@ class Polygon_mesh_slicer_wrapper
 
 public:
   #ifndef SWIG
-  typedef CGAL::Polygon_mesh_slicer<typename Polyhedron_wrapper::cpp_base, EPIC_Kernel> cpp_base;
+  typedef typename Polyhedron_wrapper::cpp_base Mesh;
+  typedef typename boost::property_map<Mesh, CGAL::vertex_point_t>::type Vertex_point_map;
+  typedef CGAL::AABB_halfedge_graph_segment_primitive<Mesh, Vertex_point_map> Edge_primitive;
+  typedef CGAL::AABB_tree<AABB_traits_class<EPIC_Kernel, Edge_primitive> > Edge_tree;
+  typedef CGAL::Polygon_mesh_slicer<Mesh, EPIC_Kernel, Vertex_point_map, Edge_tree> cpp_base;
+private:
+  std::shared_ptr<const Edge_tree> tree_sptr; // cached by the mesh
+public:
   cpp_base data;
   const cpp_base& get_data() const {return data;}
         cpp_base& get_data()       {return data;}
   #endif
 
+private:
+#ifndef SWIG
+#ifdef CGAL_LINKED_WITH_TBB
+  typedef CGAL::Parallel_tag Concurrency_tag;
+#else
+  typedef CGAL::Sequential_tag Concurrency_tag;
+#endif
+
+  static std::shared_ptr<const Edge_tree> edge_tree(Polyhedron_wrapper& poly)
+  {
+    Mesh& P = poly.get_data();
+    return poly.cache().template get<Edge_tree>(P, [&P]()
+    {
+      std::shared_ptr<Edge_tree> tree(new Edge_tree());
+      tree->insert(edges(P).first, edges(P).second, P, get(CGAL::vertex_point, P));
+      tree->build();
+      return tree;
+    });
+  }
+#endif
+
+public:
+  // the AABB tree of the edges is cached by the mesh (see
+  // Polyhedron_3.clear_cache()), which must outlive the slicer
   Polygon_mesh_slicer_wrapper(Polyhedron_wrapper& poly)
-    : data(poly.get_data())
+    : tree_sptr(edge_tree(poly))
+    , data(poly.get_data(), *tree_sptr, get(CGAL::vertex_point, poly.get_data()))
   {}
 
   void slice(const Plane_3& plane, std::vector< std::vector<Point_3> >& out)
@@ -60,6 +156,38 @@ public:
         out.back().push_back( Point_3(p) );
     }
   }
+
+  // slices the mesh with the planes a*x+b*y+c*z+d=0 of a (n,4) array of
+  // coefficients, concurrently
+  Polyline_batch slice_batch(SWIG_CGAL::Buffer<double> planes)
+  {
+    if (planes.size() % 4 != 0)
+      throw std::invalid_argument("The number of plane coefficients must be a multiple of 4");
+    const std::size_t nb_planes = planes.size() / 4;
+    std::vector< std::vector< std::vector<EPIC_Kernel::Point_3> > > polylines(nb_planes);
+    auto slice_plane = [&](const std::size_t& i) -> bool
+    {
+      const double* c = planes.data() + 4 * i;
+      data(EPIC_Kernel::Plane_3(c[0], c[1], c[2], c[3]), std::back_inserter(polylines[i]));
+      return true;
+    };
+    // the first plane is sliced alone so that the tree is built before the
+    // concurrent queries
+    if (nb_planes != 0)
+      slice_plane(0);
+    std::vector<std::size_t> rows(nb_planes == 0 ? 0 : nb_planes - 1);
+    for (std::size_t i = 0; i < rows.size(); ++i)
+      rows[i] = i + 1;
+    CGAL::for_each<Concurrency_tag>(rows, slice_plane);
+
+    Polyline_batch out;
+    for (std::size_t i = 0; i < nb_planes; ++i)
+    {
+      out.push_back(polylines[i]);
+      std::vector< std::vector<EPIC_Kernel::Point_3> >().swap(polylines[i]);
+    }
+    return out;
+  }
 };
 
 
@@ -0,0 +1,182 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+
+#ifndef SWIG_CGAL_PMP_POLYGON_SOUP_H
+#define SWIG_CGAL_PMP_POLYGON_SOUP_H
+
+#include <SWIG_CGAL/Common/Buffer.h>
+
+#ifndef SWIG
+#include <SWIG_CGAL/Kernel/typedefs.h>
+
+#include <CGAL/version.h>
+#include <CGAL/Polygon_mesh_processing/repair_polygon_soup.h>
+#include <CGAL/Polygon_mesh_processing/orient_polygon_soup.h>
+#if CGAL_VERSION_NR >= 1060000000
+#include <CGAL/Polygon_mesh_processing/autorefinement.h>
+#endif
+#include <CGAL/tags.h>
+
+#include <cstddef>
+#include <stdexcept>
+#endif
+
+#include <memory>
+#include <vector>
+
+// Result of repair_polygon_soup(), orient_polygon_soup() and
+// autorefine_triangle_soup() on arrays: row i of point_array() is the i-th
+// point and row j of face_array() the indices of the points of the j-th
+// triangle, without building a mesh.
+class Triangle_soup
+{
+  std::shared_ptr<std::vector<double> > points_sptr;
+  std::shared_ptr<std::vector<int> >    faces_sptr;
+  bool m_duplicated_points;
+
+public:
+  Triangle_soup()
+    : points_sptr(new std::vector<double>())
+    , faces_sptr(new std::vector<int>())
+    , m_duplicated_points(false) {}
+  #ifndef SWIG
+  std::vector<double>& points() const { return *points_sptr; }
+  std::vector<int>& faces() const { return *faces_sptr; }
+  void set_duplicated_points(bool b) { m_duplicated_points = b; }
+  #endif
+
+  int number_of_points() const { return int(points_sptr->size() / 3); }
+  int number_of_faces() const { return int(faces_sptr->size() / 3); }
+  // true if orient_polygon_soup() had to duplicate points (around
+  // non-manifold points, or to orient a non-orientable soup)
+  bool has_duplicated_points() const { return m_duplicated_points; }
+
+  // (V,3)
+  SWIG_CGAL::Buffer<double> point_array() const
+  {
+    return SWIG_CGAL::Buffer<double>(points_sptr->data(), points_sptr->size() / 3, 3,
+                                     points_sptr, true);
+  }
+  // (F,3)
+  SWIG_CGAL::Buffer<int> face_array() const
+  {
+    return SWIG_CGAL::Buffer<int>(faces_sptr->data(), faces_sptr->size() / 3, 3,
+                                  faces_sptr, true);
+  }
+};
+
+#ifndef SWIG
+namespace SWIG_PMP {
+
+namespace internal {
+
+typedef std::vector<EPIC_Kernel::Point_3>            Soup_points;
+typedef std::vector<std::vector<std::size_t> >       Soup_polygons;
+
+// the soup of the (V,3) array points and the (F,3) array faces
+inline void read_triangle_soup(const SWIG_CGAL::Buffer<double>& points, const SWIG_CGAL::Buffer<int>& faces,
+                               Soup_points& cgal_points, Soup_polygons& polygons)
+{
+  if (points.size() % 3 != 0)
+    throw std::invalid_argument("Expecting rows of 3 coordinates");
+  if (faces.size() % 3 != 0)
+    throw std::invalid_argument("Expecting rows of 3 point indices");
+  const std::size_t nb_points = points.size() / 3;
+  cgal_points.reserve(nb_points);
+  for (std::size_t i = 0; i < nb_points; ++i)
+    cgal_points.push_back(EPIC_Kernel::Point_3(points[3*i], points[3*i+1], points[3*i+2]));
+  polygons.reserve(faces.size() / 3);
+  for (std::size_t k = 0; k < faces.size(); k += 3)
+  {
+    std::vector<std::size_t> polygon(3);
+    for (int i = 0; i < 3; ++i)
+    {
+      if (faces[k+i] < 0 || std::size_t(faces[k+i]) >= nb_points)
+        throw std::out_of_range("Point index out of range");
+      polygon[i] = std::size_t(faces[k+i]);
+    }
+    polygons.push_back(polygon);
+  }
+}
+
+inline void write_triangle_soup(const Soup_points& cgal_points, const Soup_polygons& polygons,
+                                Triangle_soup& out)
+{
+  out.points().reserve(3 * cgal_points.size());
+  for (const EPIC_Kernel::Point_3& p : cgal_points)
+  {
+    out.points().push_back(p.x());
+    out.points().push_back(p.y());
+    out.points().push_back(p.z());
+  }
+  out.faces().reserve(3 * polygons.size());
+  for (const std::vector<std::size_t>& polygon : polygons)
+  {
+    if (polygon.size() != 3)
+      throw std::runtime_error("The soup is not a triangle soup");
+    for (std::size_t v : polygon)
+      out.faces().push_back(int(v));
+  }
+}
+
+} // namespace internal
+
+// CGAL::Polygon_mesh_processing::repair_polygon_soup() on arrays: merges
+// the duplicated points and removes the degenerate and duplicated triangles
+// (all copies of them if erase_all_duplicates, and only the ones with the
+// same orientation if require_same_orientation) and the isolated points
+inline void repair_polygon_soup(const SWIG_CGAL::Buffer<double>& points, const SWIG_CGAL::Buffer<int>& faces,
+                                bool erase_all_duplicates, bool require_same_orientation,
+                                Triangle_soup& out)
+{
+  namespace PMP = CGAL::Polygon_mesh_processing;
+  internal::Soup_points cgal_points;
+  internal::Soup_polygons polygons;
+  internal::read_triangle_soup(points, faces, cgal_points, polygons);
+  PMP::repair_polygon_soup(cgal_points, polygons,
+                           PMP::parameters::erase_all_duplicates(erase_all_duplicates)
+                                           .require_same_orientation(require_same_orientation));
+  internal::write_triangle_soup(cgal_points, polygons, out);
+}
+
+// CGAL::Polygon_mesh_processing::orient_polygon_soup() on arrays: points
+// are duplicated where the soup cannot be oriented consistently
+inline void orient_polygon_soup(const SWIG_CGAL::Buffer<double>& points, const SWIG_CGAL::Buffer<int>& faces,
+                                Triangle_soup& out)
+{
+  namespace PMP = CGAL::Polygon_mesh_processing;
+  internal::Soup_points cgal_points;
+  internal::Soup_polygons polygons;
+  internal::read_triangle_soup(points, faces, cgal_points, polygons);
+  out.set_duplicated_points(!PMP::orient_polygon_soup(cgal_points, polygons));
+  internal::write_triangle_soup(cgal_points, polygons, out);
+}
+
+// CGAL::Polygon_mesh_processing::autorefine_triangle_soup() on arrays: the
+// triangles are split along their intersections, computed concurrently
+// with Concurrency_tag=CGAL::Parallel_tag (CGAL 6.0 or later)
+template <class Concurrency_tag>
+void autorefine_triangle_soup(const SWIG_CGAL::Buffer<double>& points, const SWIG_CGAL::Buffer<int>& faces,
+                              Triangle_soup& out)
+{
+#if CGAL_VERSION_NR >= 1060000000
+  namespace PMP = CGAL::Polygon_mesh_processing;
+  internal::Soup_points cgal_points;
+  internal::Soup_polygons polygons;
+  internal::read_triangle_soup(points, faces, cgal_points, polygons);
+  PMP::autorefine_triangle_soup(cgal_points, polygons,
+                                PMP::parameters::concurrency_tag(Concurrency_tag()));
+  internal::write_triangle_soup(cgal_points, polygons, out);
+#else
+  (void)points; (void)faces; (void)out;
+  throw std::runtime_error("autorefine_triangle_soup() needs CGAL 6.0 or later");
+#endif
+}
+
+} // namespace SWIG_PMP
+#endif
+
+#endif //SWIG_CGAL_PMP_POLYGON_SOUP_H
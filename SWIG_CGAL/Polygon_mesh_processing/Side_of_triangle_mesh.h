@@ -7,38 +7,105 @@
 #ifndef SWIG_CGAL_PMP_SIDE_OF_TRIANGLE_MESH_H
 #define SWIG_CGAL_PMP_SIDE_OF_TRIANGLE_MESH_H
 
+#include <SWIG_CGAL/Common/Buffer.h>
 #include <SWIG_CGAL/Kernel/Point_3.h>
 #include <SWIG_CGAL/Kernel/enum.h>
 #include <CGAL/Side_of_triangle_mesh.h>
+#include <CGAL/for_each.h>
+#include <CGAL/tags.h>
 
-template <class Polyhedron_wrapper>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+// Tree_wrapper is the wrapper of an AABB tree on the faces of a
+// Polyhedron_wrapper; a Side_of_triangle_mesh created from such a tree
+// uses it, and the tree must outlive it. Created from a mesh, it uses the
+// tree of the faces cached by the mesh (see Polyhedron_3.clear_cache()),
+// and the mesh must outlive it.
+template <class Polyhedron_wrapper, class Tree_wrapper>
 class Side_of_triangle_mesh_wrapper
 {
-  typedef Side_of_triangle_mesh_wrapper<Polyhedron_wrapper> Self;
+  typedef Side_of_triangle_mesh_wrapper<Polyhedron_wrapper, Tree_wrapper> Self;
   //disable deep copy
   Self deepcopy();
   void deepcopy(const Self&);
 
 public:
   #ifndef SWIG
-  typedef CGAL::Side_of_triangle_mesh<typename Polyhedron_wrapper::cpp_base, EPIC_Kernel> cpp_base;
-  cpp_base data;
-  const cpp_base& get_data() const {return data;}
-        cpp_base& get_data()       {return data;}
+  typedef typename Tree_wrapper::cpp_base Tree;
+  typedef CGAL::Side_of_triangle_mesh<typename Polyhedron_wrapper::cpp_base, EPIC_Kernel,
+                                      CGAL::Default, Tree> cpp_base;
   #endif
 
+private:
+  std::shared_ptr<const Tree> cached_tree_sptr;  // null if created from a tree
+  std::shared_ptr<cpp_base> data_sptr;
+
+#ifndef SWIG
+#ifdef CGAL_LINKED_WITH_TBB
+  typedef CGAL::Parallel_tag Concurrency_tag;
+#else
+  typedef CGAL::Sequential_tag Concurrency_tag;
+#endif
+
+  CGAL::Bounded_side side (const EPIC_Kernel::Point_3& p) const
+  {
+    return (*data_sptr)(p);
+  }
+
+  static std::shared_ptr<const Tree> face_tree(Polyhedron_wrapper& poly)
+  {
+    typename Polyhedron_wrapper::cpp_base& P = poly.get_data();
+    return poly.cache().template get<Tree>(P, [&P]()
+    {
+      std::shared_ptr<Tree> tree(new Tree());
+      for (typename Polyhedron_wrapper::cpp_base::Facet_iterator f = P.facets_begin(); f != P.facets_end(); ++f)
+        tree->insert(typename Tree::Primitive(f));
+      tree->build();
+      return tree;
+    });
+  }
+#endif
+
+public:
   Side_of_triangle_mesh_wrapper(Polyhedron_wrapper& poly)
-    : data(poly.get_data())
+    : cached_tree_sptr(face_tree(poly))
+    , data_sptr(new cpp_base(*cached_tree_sptr))
   {}
 
-  // TODO this constructor requires an update of the AABB-tree wrapped package
-  //      to the new API using BGL
-  // Side_of_triangle_mesh_wrapper(AABB_tree& tree)
-  //   : data(poly.get_data())
-  // {}
+  Side_of_triangle_mesh_wrapper(Tree_wrapper& tree)
+    : data_sptr(new cpp_base(tree.get_data()))
+  {}
 
   Bounded_side bounded_side(Point_3& p){
-    return Bounded_side( data(p.get_data()) );
+    return Bounded_side( side(p.get_data()) );
+  }
+
+  // sides of the points of a (n,3) array (-1 for the unbounded side, 0 for
+  // the boundary and 1 for the bounded side), computed concurrently
+  SWIG_CGAL::Buffer<signed char> bounded_side_batch(SWIG_CGAL::Buffer<double> points)
+  {
+    if (points.size() % 3 != 0)
+      throw std::invalid_argument("The number of coordinates must be a multiple of 3");
+    const std::size_t nb_points = points.size() / 3;
+    std::vector<signed char> out (nb_points);
+    if (nb_points == 0)
+      return SWIG_CGAL::Buffer<signed char>(std::move(out));
+
+    // the first query builds the tree, the others only read it
+    out[0] = static_cast<signed char>(side(EPIC_Kernel::Point_3(points[0], points[1], points[2])));
+    std::vector<std::size_t> rows (nb_points - 1);
+    for (std::size_t i = 0; i < rows.size(); ++ i)
+      rows[i] = i + 1;
+    CGAL::for_each<Concurrency_tag>
+      (rows, [&](const std::size_t& row) -> bool
+       {
+         const double* p = points.data() + 3 * row;
+         out[row] = static_cast<signed char>(side(EPIC_Kernel::Point_3(p[0], p[1], p[2])));
+         return true;
+       });
+    return SWIG_CGAL::Buffer<signed char>(std::move(out));
   }
 };
 
@@ -0,0 +1,159 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+
+#ifndef SWIG_CGAL_PMP_SMOOTHING_H
+#define SWIG_CGAL_PMP_SMOOTHING_H
+
+#include <SWIG_CGAL/Common/Buffer.h>
+#include <SWIG_CGAL/Polygon_mesh_processing/Measures.h>
+#include <SWIG_CGAL/Polygon_mesh_processing/Normals.h>
+
+#include <CGAL/version.h>
+#include <CGAL/boost/graph/helpers.h>
+#include <CGAL/boost/graph/iterator.h>
+#include <CGAL/Polygon_mesh_processing/smooth_shape.h>
+#if CGAL_VERSION_NR >= 1050500000
+#include <CGAL/Polygon_mesh_processing/angle_and_area_smoothing.h>
+#endif
+
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// Smoothing of the vertices of a polyhedron, the vertices of the array
+// `constrained` (ids, see Polyhedron_3.compact()) being kept in place.
+namespace SWIG_PMP {
+
+namespace internal {
+
+// readable vertex map of the vertices flagged in a vector indexed by id
+template <class Vertex_handle>
+struct Is_constrained_vertex_map
+{
+  const std::vector<char>* flags;
+  typedef boost::readable_property_map_tag category;
+  typedef Vertex_handle key_type;
+  typedef bool value_type;
+  typedef bool reference;
+
+  friend bool get(const Is_constrained_vertex_map& map, const Vertex_handle& v)
+  {
+    return (*map.flags)[v->id()] != 0;
+  }
+};
+
+// flags of the vertices of a polyhedron with nb_vertices compact ids
+inline std::vector<char> constrained_flags(const SWIG_CGAL::Buffer<int>& constrained, std::size_t nb_vertices)
+{
+  std::vector<char> flags(nb_vertices, 0);
+  for (std::size_t i = 0; i < constrained.size(); ++i)
+  {
+    if (constrained[i] < 0 || std::size_t(constrained[i]) >= nb_vertices)
+      throw std::out_of_range("Invalid vertex id " + std::to_string(constrained[i]));
+    flags[std::size_t(constrained[i])] = 1;
+  }
+  return flags;
+}
+
+} // namespace internal
+
+// Tangential relaxation with Jacobi updates: at each iteration, each free
+// vertex not on the border moves towards the centroid of its neighbors,
+// projected on the plane orthogonal to its normal, all the new positions
+// being computed concurrently from the positions of the previous iteration.
+// The ids of P must be compact.
+template <class Concurrency_tag, class Polyhedron>
+void tangential_relaxation(Polyhedron& P, int nb_iterations, const SWIG_CGAL::Buffer<int>& constrained)
+{
+  typedef typename Polyhedron::Vertex_handle Vertex_handle;
+  typedef typename Polyhedron::Point_3 Point;
+  typedef internal::Vector Vector;
+  const std::vector<Vertex_handle> vertices
+    = internal::handles_by_id<Vertex_handle>(P.vertices_begin(), P.vertices_end(), P.size_of_vertices());
+  const std::vector<char> flags = internal::constrained_flags(constrained, vertices.size());
+  const auto vpm = get(CGAL::vertex_point, P);
+
+  std::vector<Vector> positions(vertices.size());
+  for (int it = 0; it < nb_iterations; ++it)
+  {
+    internal::for_each_element_block<Concurrency_tag>(vertices.size(), [&](std::size_t begin, std::size_t end)
+    {
+      for (std::size_t i = begin; i < end; ++i)
+      {
+        const Vertex_handle v = vertices[i];
+        const Vector p = internal::to_vector(get(vpm, v));
+        positions[i] = p;
+        if (flags[i] || v->halfedge() == nullptr || CGAL::is_border(v, P))
+          continue;
+        Vector normal = {{0, 0, 0}};
+        Vector centroid = {{0, 0, 0}};
+        std::size_t degree = 0;
+        for (auto h : CGAL::halfedges_around_target(v->halfedge(), P))
+        {
+          const Vector a = internal::vector_area(face(h, P), P, vpm);
+          const Vector q = internal::to_vector(get(vpm, source(h, P)));
+          for (int k = 0; k < 3; ++k)
+          {
+            normal[k] += a[k];
+            centroid[k] += q[k];
+          }
+          ++degree;
+        }
+        const double n = internal::norm(normal);
+        if (degree == 0 || n == 0)
+          continue;
+        Vector d = internal::difference({{centroid[0] / degree, centroid[1] / degree, centroid[2] / degree}}, p);
+        const double t = internal::dot(d, normal) / (n * n);
+        for (int k = 0; k < 3; ++k)
+          positions[i][k] = p[k] + d[k] - t * normal[k];
+      }
+    });
+    internal::for_each_element_block<Concurrency_tag>(vertices.size(), [&](std::size_t begin, std::size_t end)
+    {
+      for (std::size_t i = begin; i < end; ++i)
+        put(vpm, vertices[i], Point(positions[i][0], positions[i][1], positions[i][2]));
+    });
+  }
+}
+
+// CGAL::Polygon_mesh_processing::angle_and_area_smoothing() (CGAL 5.5 or
+// later; the area smoothing needs the Ceres solver), on all the faces
+template <class Polyhedron>
+void angle_and_area_smoothing(Polyhedron& P, int nb_iterations, const SWIG_CGAL::Buffer<int>& constrained,
+                              bool use_angle_smoothing, bool use_area_smoothing)
+{
+#if CGAL_VERSION_NR >= 1050500000
+  typedef typename Polyhedron::Vertex_handle Vertex_handle;
+  const std::vector<char> flags = internal::constrained_flags(constrained, P.size_of_vertices());
+  internal::Is_constrained_vertex_map<Vertex_handle> is_constrained = {&flags};
+  CGAL::Polygon_mesh_processing::angle_and_area_smoothing(
+    P, CGAL::Polygon_mesh_processing::parameters::number_of_iterations(nb_iterations)
+                                             .vertex_is_constrained_map(is_constrained)
+                                             .use_angle_smoothing(use_angle_smoothing)
+                                             .use_area_smoothing(use_area_smoothing));
+#else
+  (void)P; (void)nb_iterations; (void)constrained; (void)use_angle_smoothing; (void)use_area_smoothing;
+  throw std::runtime_error("angle_and_area_smoothing() needs CGAL 5.5 or later");
+#endif
+}
+
+// CGAL::Polygon_mesh_processing::smooth_shape(), the mean curvature flow of
+// all the faces with the time step `time`
+template <class Polyhedron>
+void smooth_shape(Polyhedron& P, double time, int nb_iterations, const SWIG_CGAL::Buffer<int>& constrained)
+{
+  typedef typename Polyhedron::Vertex_handle Vertex_handle;
+  const std::vector<char> flags = internal::constrained_flags(constrained, P.size_of_vertices());
+  internal::Is_constrained_vertex_map<Vertex_handle> is_constrained = {&flags};
+  CGAL::Polygon_mesh_processing::smooth_shape(
+    P, time, CGAL::Polygon_mesh_processing::parameters::number_of_iterations(nb_iterations)
+                                                   .vertex_is_constrained_map(is_constrained));
+}
+
+} // namespace SWIG_PMP
+
+#endif //SWIG_CGAL_PMP_SMOOTHING_H
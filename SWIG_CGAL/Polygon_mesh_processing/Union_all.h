@@ -0,0 +1,147 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+
+#ifndef SWIG_CGAL_PMP_UNION_ALL_H
+#define SWIG_CGAL_PMP_UNION_ALL_H
+
+#include <CGAL/Polygon_mesh_processing/corefinement.h>
+#include <CGAL/Polygon_mesh_processing/bbox.h>
+#include <CGAL/boost/graph/copy_face_graph.h>
+#include <CGAL/box_intersection_d.h>
+#include <CGAL/for_each.h>
+#include <CGAL/tags.h>
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace SWIG_PMP {
+
+#ifdef CGAL_LINKED_WITH_TBB
+typedef CGAL::Parallel_tag Union_all_concurrency_tag;
+#else
+typedef CGAL::Sequential_tag Union_all_concurrency_tag;
+#endif
+
+// Unions the meshes of `parts` pairwise, level by level, until one is left.
+// The pairs of a level are independent and handled concurrently. Meshes with
+// disjoint bounding boxes are simply appended one to the other. Returns false
+// if the union of a pair could not be computed; both meshes are then appended
+// as they are.
+template <class Mesh>
+bool reduce_by_union(std::vector<std::unique_ptr<Mesh> >& parts)
+{
+  namespace PMP = CGAL::Polygon_mesh_processing;
+  std::atomic<bool> ok(true);
+  while (parts.size() > 1)
+  {
+    std::vector<std::size_t> pairs (parts.size() / 2);
+    for (std::size_t i = 0; i < pairs.size(); ++ i)
+      pairs[i] = i;
+    std::vector<std::unique_ptr<Mesh> > next ((parts.size() + 1) / 2);
+    CGAL::for_each<Union_all_concurrency_tag>
+      (pairs, [&](const std::size_t& i) -> bool
+       {
+         std::unique_ptr<Mesh>& a = parts[2 * i];
+         std::unique_ptr<Mesh>& b = parts[2 * i + 1];
+         if (CGAL::do_overlap(PMP::bbox(*a), PMP::bbox(*b)))
+         {
+           std::unique_ptr<Mesh> out (new Mesh());
+           if (PMP::corefine_and_compute_union(*a, *b, *out))
+           {
+             next[i] = std::move(out);
+             return true;
+           }
+           ok = false;
+         }
+         CGAL::copy_face_graph(*b, *a);
+         next[i] = std::move(a);
+         return true;
+       });
+    if (parts.size() % 2 == 1)
+      next.back() = std::move(parts.back());
+    parts.swap(next);
+  }
+  return ok;
+}
+
+// Computes the union of the closed meshes `meshes` into `out`. The meshes
+// are grouped with Box_intersection_d into groups whose bounding boxes
+// overlap transitively, so that unions are only computed within a group;
+// groups are reduced concurrently and their results appended into `out`.
+// The input meshes are not modified.
+template <class Mesh>
+bool union_all(const std::vector<const Mesh*>& meshes, Mesh& out)
+{
+  namespace PMP = CGAL::Polygon_mesh_processing;
+  typedef CGAL::Box_intersection_d::Box_with_info_d<double, 3, std::size_t> Box;
+
+  const std::size_t n = meshes.size();
+  std::vector<Box> boxes;
+  boxes.reserve(n);
+  for (std::size_t i = 0; i < n; ++ i)
+    boxes.push_back(Box(PMP::bbox(*meshes[i]), i));
+
+  // union-find on the overlap graph of the bounding boxes
+  std::vector<std::size_t> parent (n);
+  for (std::size_t i = 0; i < n; ++ i)
+    parent[i] = i;
+  auto find = [&](std::size_t i) -> std::size_t
+  {
+    while (parent[i] != i)
+      i = parent[i] = parent[parent[i]];
+    return i;
+  };
+  CGAL::box_intersection_d(boxes.begin(), boxes.end(),
+                           [&](const Box& a, const Box& b)
+                           {
+                             std::size_t ra = find(a.info()), rb = find(b.info());
+                             if (ra != rb) parent[ra] = rb;
+                           });
+
+  std::vector<std::size_t> group_of_root (n, n);
+  std::vector<std::vector<std::size_t> > groups;
+  for (std::size_t i = 0; i < n; ++ i)
+  {
+    std::size_t r = find(i);
+    if (group_of_root[r] == n)
+    {
+      group_of_root[r] = groups.size();
+      groups.push_back(std::vector<std::size_t>());
+    }
+    groups[group_of_root[r]].push_back(i);
+  }
+
+  std::vector<std::unique_ptr<Mesh> > results (groups.size());
+  std::vector<std::size_t> group_ids (groups.size());
+  for (std::size_t g = 0; g < groups.size(); ++ g)
+    group_ids[g] = g;
+  std::atomic<bool> ok(true);
+  CGAL::for_each<Union_all_concurrency_tag>
+    (group_ids, [&](const std::size_t& g) -> bool
+     {
+       // corefinement modifies its inputs: work on copies
+       std::vector<std::unique_ptr<Mesh> > parts;
+       parts.reserve(groups[g].size());
+       for (std::size_t i : groups[g])
+         parts.push_back(std::unique_ptr<Mesh>(new Mesh(*meshes[i])));
+       if (!reduce_by_union(parts))
+         ok = false;
+       results[g] = std::move(parts.front());
+       return true;
+     });
+
+  out.clear();
+  for (const std::unique_ptr<Mesh>& r : results)
+    CGAL::copy_face_graph(*r, out);
+  return ok;
+}
+
+} // namespace SWIG_PMP
+
+#endif //SWIG_CGAL_PMP_UNION_ALL_H
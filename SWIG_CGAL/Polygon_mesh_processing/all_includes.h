@@ -9,5 +9,19 @@
 #include <SWIG_CGAL/Polygon_mesh_processing/Side_of_triangle_mesh.h>
 #include <SWIG_CGAL/Polygon_mesh_processing/Polygon_mesh_slicer.h>
 #include <SWIG_CGAL/Polygon_mesh_processing/utils.h>
+#include <SWIG_CGAL/Polygon_mesh_processing/Union_all.h>
+#include <SWIG_CGAL/Polygon_mesh_processing/Parallel_remeshing.h>
+#include <SWIG_CGAL/Polygon_mesh_processing/Normals.h>
+#include <SWIG_CGAL/Polygon_mesh_processing/Measures.h>
+#include <SWIG_CGAL/Polygon_mesh_processing/Distances.h>
+#include <SWIG_CGAL/Polygon_mesh_processing/Hole_filling.h>
+#include <SWIG_CGAL/Polygon_mesh_processing/Connected_components.h>
+#include <SWIG_CGAL/Polygon_mesh_processing/Mesh_tiling.h>
+#include <SWIG_CGAL/Polygon_mesh_processing/Polygon_soup.h>
+#include <SWIG_CGAL/Polygon_mesh_processing/Locate.h>
+#include <SWIG_CGAL/Polygon_mesh_processing/Heat_method.h>
+#include <SWIG_CGAL/Polygon_mesh_processing/Mesh_sampling.h>
+#include <SWIG_CGAL/Polygon_mesh_processing/Smoothing.h>
+#include <SWIG_CGAL/Polygon_mesh_processing/Exact_mesh_3.h>
 
 #endif //SWIG_CGAL_POLYGON_MESH_PROCESSING_ALL_INCLUDES_H
@@ -0,0 +1,213 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+
+#ifndef SWIG_CGAL_POLYHEDRON_3_BUILD_FROM_ARRAYS_H
+#define SWIG_CGAL_POLYHEDRON_3_BUILD_FROM_ARRAYS_H
+
+#include <CGAL/Modifier_base.h>
+#include <CGAL/Polyhedron_incremental_builder_3.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace SWIG_Polyhedron_3{
+
+// Builds a polyhedral surface from nb_vertices coordinate triples and
+// nb_faces polygons of k vertex indices, stored contiguously. The arrays
+// must outlive the call to delegate().
+template <class HDS>
+class Build_from_arrays : public CGAL::Modifier_base<HDS>{
+  const double* vertices;
+  std::size_t nb_vertices;
+  const int* faces;
+  std::size_t nb_faces;
+  std::size_t k;
+  const std::uint32_t* degrees;
+  const int* offsets;
+  bool repair;
+  std::size_t nb_skipped;
+public:
+  Build_from_arrays(const double* vertices, std::size_t nb_vertices,
+                    const int* faces, std::size_t nb_faces, std::size_t k)
+    : vertices(vertices), nb_vertices(nb_vertices), faces(faces), nb_faces(nb_faces), k(k),
+      degrees(nullptr), offsets(nullptr), repair(false), nb_skipped(0)
+  {}
+  // facet f has degrees[f] vertices, the vertex ids of the facets following
+  // each other in `faces`
+  Build_from_arrays(const double* vertices, std::size_t nb_vertices,
+                    const int* faces, const std::uint32_t* degrees, std::size_t nb_faces)
+    : vertices(vertices), nb_vertices(nb_vertices), faces(faces), nb_faces(nb_faces), k(0),
+      degrees(degrees), offsets(nullptr), repair(false), nb_skipped(0)
+  {}
+  // facet f has the vertices faces[offsets[f]] to faces[offsets[f+1]-1]
+  // (compressed sparse rows, nb_faces+1 offsets starting at 0). With
+  // `repair`, the repeated consecutive vertices of a facet are removed, and
+  // the facets left with less than 3 vertices or which would make the
+  // surface non-manifold or inconsistently oriented are skipped instead of
+  // throwing, as well as the vertices they leave unconnected.
+  Build_from_arrays(const double* vertices, std::size_t nb_vertices,
+                    const int* faces, const int* offsets, std::size_t nb_faces, bool repair)
+    : vertices(vertices), nb_vertices(nb_vertices), faces(faces), nb_faces(nb_faces), k(0),
+      degrees(nullptr), offsets(offsets), repair(repair), nb_skipped(0)
+  {}
+
+  // number of facets skipped by the repair
+  std::size_t nb_skipped_facets() const {return nb_skipped;}
+
+  void operator()(HDS& hds)
+  {
+    typedef typename HDS::Vertex::Point Point;
+    std::size_t nb_ids=nb_faces*k;
+    if (degrees!=nullptr)
+    {
+      nb_ids=0;
+      for (std::size_t f=0; f<nb_faces; ++f)
+      {
+        if (degrees[f]<3)
+          throw std::invalid_argument("Facets must have at least 3 vertices");
+        nb_ids+=degrees[f];
+      }
+    }
+    if (offsets!=nullptr)
+    {
+      if (offsets[0]!=0)
+        throw std::invalid_argument("The first offset must be 0");
+      for (std::size_t f=0; f<nb_faces; ++f)
+      {
+        if (offsets[f+1]<offsets[f])
+          throw std::invalid_argument("The offsets must be non-decreasing");
+        if (!repair && offsets[f+1]-offsets[f]<3)
+          throw std::invalid_argument("Facets must have at least 3 vertices");
+      }
+      nb_ids=std::size_t(offsets[nb_faces]);
+    }
+    for (std::size_t i=0; i<nb_ids; ++i)
+      if (faces[i]<0 || std::size_t(faces[i])>=nb_vertices)
+        throw std::invalid_argument("Vertex index out of range");
+
+    CGAL::Polyhedron_incremental_builder_3<HDS> B(hds, false);
+    B.begin_surface(nb_vertices, nb_faces, nb_ids);
+    for (std::size_t i=0; i<nb_vertices; ++i)
+      B.add_vertex(Point(vertices[3*i], vertices[3*i+1], vertices[3*i+2]));
+    // the repaired facet, reused from one facet to the next
+    std::vector<int> repaired;
+    nb_skipped=0;
+    const int* polygon = faces;
+    for (std::size_t f=0; f<nb_faces; ++f)
+    {
+      std::size_t degree = k;
+      if (degrees!=nullptr) degree=degrees[f];
+      if (offsets!=nullptr) degree=std::size_t(offsets[f+1]-offsets[f]);
+      const int* begin = polygon;
+      const int* end = polygon+degree;
+      polygon+=degree;
+      if (repair)
+      {
+        repaired.clear();
+        for (const int* v=begin; v!=end; ++v)
+          if (repaired.empty() || repaired.back()!=*v)
+            repaired.push_back(*v);
+        while (repaired.size()>1 && repaired.front()==repaired.back())
+          repaired.pop_back();
+        begin=repaired.data();
+        end=begin+repaired.size();
+        if (repaired.size()<3 || !B.test_facet(begin, end))
+        {
+          ++nb_skipped;
+          continue;
+        }
+      }
+      else if (!B.test_facet(begin, end))
+      {
+        B.rollback();
+        throw std::invalid_argument("The faces do not form an oriented 2-manifold (facet "
+                                    + std::to_string(f) + ")");
+      }
+      B.add_facet(begin, end);
+    }
+    B.end_surface();
+    if (!B.error() && repair && B.check_unconnected_vertices())
+      B.remove_unconnected_vertices();
+    if (B.error())
+    {
+      B.rollback();
+      throw std::invalid_argument("The faces do not form a valid polyhedral surface");
+    }
+  }
+};
+
+// (V,3) coordinates of the vertices and (F,3) vertex ids of the facets of
+// a pure triangle polyhedron, the row of an item being its id: the ids must
+// be compact (see has_compact_ids()). The arrays are written in place and
+// must hold 3*size_of_vertices() and 3*size_of_facets() values.
+template <class Polyhedron>
+void write_arrays(const Polyhedron& P, double* vertices, int* faces)
+{
+  if (faces!=nullptr && !P.is_pure_triangle())
+    throw std::runtime_error("The polyhedron is not a triangle mesh");
+  if (vertices!=nullptr)
+  {
+    for (typename Polyhedron::Vertex_const_iterator v=P.vertices_begin(); v!=P.vertices_end(); ++v)
+    {
+      double* row = vertices + 3*v->id();
+      row[0]=v->point().x();
+      row[1]=v->point().y();
+      row[2]=v->point().z();
+    }
+  }
+  if (faces==nullptr) return;
+  for (typename Polyhedron::Facet_const_iterator f=P.facets_begin(); f!=P.facets_end(); ++f)
+  {
+    typename Polyhedron::Halfedge_const_handle h=f->halfedge();
+    int* row = faces + 3*f->id();
+    row[0]=int(h->vertex()->id());
+    row[1]=int(h->next()->vertex()->id());
+    row[2]=int(h->next()->next()->vertex()->id());
+  }
+}
+
+// same as write_arrays(), resizing the vectors
+template <class Polyhedron>
+void export_to_arrays(const Polyhedron& P, std::vector<double>* vertices, std::vector<int>* faces)
+{
+  if (faces!=nullptr && !P.is_pure_triangle())
+    throw std::runtime_error("The polyhedron is not a triangle mesh");
+  if (vertices!=nullptr)
+    vertices->resize(3*P.size_of_vertices());
+  if (faces!=nullptr)
+    faces->resize(3*P.size_of_facets());
+  write_arrays(P, vertices!=nullptr ? vertices->data() : nullptr,
+                  faces!=nullptr ? faces->data() : nullptr);
+}
+
+// number of vertices of each facet and their ids, the facets being ordered
+// by id: the ids must be compact
+template <class Polyhedron>
+void export_polygons(const Polyhedron& P, std::vector<std::uint32_t>& degrees, std::vector<int>& faces)
+{
+  degrees.assign(P.size_of_facets(), 0);
+  std::vector<std::vector<int> > polygons(P.size_of_facets());
+  for (typename Polyhedron::Facet_const_iterator f=P.facets_begin(); f!=P.facets_end(); ++f)
+  {
+    std::vector<int>& polygon = polygons[f->id()];
+    typename Polyhedron::Halfedge_around_facet_const_circulator h=f->facet_begin(), end=h;
+    do{
+      polygon.push_back(int(h->vertex()->id()));
+    } while(++h!=end);
+    degrees[f->id()]=std::uint32_t(polygon.size());
+  }
+  faces.clear();
+  faces.reserve(P.size_of_halfedges()/2);
+  for (const std::vector<int>& polygon : polygons)
+    faces.insert(faces.end(), polygon.begin(), polygon.end());
+}
+
+} //namespace SWIG_Polyhedron_3
+
+#endif //SWIG_CGAL_POLYHEDRON_3_BUILD_FROM_ARRAYS_H
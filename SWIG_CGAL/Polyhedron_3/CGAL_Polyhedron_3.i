@@ -33,9 +33,22 @@ SWIG_CGAL_package_common()
 
 //include files
 
+#if !SWIG_CGAL_NON_SUPPORTED_TARGET_LANGUAGE
+%include "SWIG_CGAL/typemaps.i"
+SWIG_CGAL_buffer_of_double_typemap_in
+SWIG_CGAL_buffer_of_int_typemap_in
+SWIG_CGAL_buffer_of_double_typemap_out
+SWIG_CGAL_buffer_of_int_typemap_out
+SWIG_CGAL_buffer_of_unsigned_char_typemap_in
+SWIG_CGAL_buffer_of_unsigned_char_typemap_out
+#endif
 
 %pragma(java) jniclassimports=%{import CGAL.Kernel.Point_3; import java.util.Iterator; import java.util.Collection; import CGAL.Java.JavaData;%}
 
+//file I/O without Python objects
+SWIG_CGAL_release_gil(read_mesh)
+SWIG_CGAL_release_gil(write_mesh)
+
 //definitions
 %include "SWIG_CGAL/Polyhedron_3/Polyhedron_3.h"
 %include "SWIG_CGAL/Polyhedron_3/polyhedron_3_handles.h"
@@ -53,7 +66,48 @@ SWIG_CGAL_declare_identifier_of_template_class(Polyhedron_3_Vertex_handle,SWIG_P
 #endif
 SWIG_CGAL_declare_identifier_of_template_class(Polyhedron_3_Facet_handle,SWIG_Polyhedron_3::CGAL_Facet_handle<Polyhedron_3_>)
 
-%typemap(javaimports)                       Polyhedron_3_wrapper %{import CGAL.Kernel.Point_3;%}
+%typemap(javaimports)                       Polyhedron_3_wrapper %{import CGAL.Kernel.Point_3; import CGAL.Kernel.Memory_usage;%}
+%define SWIG_CGAL_Polyhedron_3_wrapper_type Polyhedron_3_wrapper< Polyhedron_3_,SWIG_Polyhedron_3::CGAL_Vertex_handle<Polyhedron_3_>,SWIG_Polyhedron_3::CGAL_Halfedge_handle<Polyhedron_3_>,SWIG_Polyhedron_3::CGAL_Facet_handle<Polyhedron_3_> > %enddef
+#ifdef SWIGPYTHON
+%extend SWIG_CGAL_Polyhedron_3_wrapper_type {
+  %pythoncode %{
+    def to_arrays(self):
+      return self.vertex_array(), self.face_array()
+  %}
+}
+#endif
+#ifdef SWIGJAVA
+SWIG_CGAL_array_of_double_to_vector_of_double_typemap_in
+SWIG_CGAL_array_of_int_to_vector_of_int_typemap_in
+//overload for Java primitive arrays of triangles
+%extend SWIG_CGAL_Polyhedron_3_wrapper_type {
+  static SWIG_CGAL_Polyhedron_3_wrapper_type from_arrays(boost::shared_ptr<std::vector<double> > vertices, boost::shared_ptr<std::vector<int> > faces)
+  {
+    if (vertices->size()%3!=0 || faces->size()%3!=0)
+      throw std::invalid_argument("Expecting (V,3) vertices and (F,3) vertex indices");
+    return SWIG_CGAL_Polyhedron_3_wrapper_type::from_arrays(vertices->data(), vertices->size()/3, faces->data(), faces->size()/3, 3);
+  }
+}
+//direct java.nio buffers used in place, see CGAL.Java.Direct_buffers
+%typemap(javacode) Polyhedron_3_wrapper %{
+  public static $javaclassname fromDirectBuffers(java.nio.DoubleBuffer vertices, java.nio.IntBuffer faces) {
+    return from_arrays(vertices, faces);
+  }
+
+  public void toDirectBuffers(java.nio.DoubleBuffer vertices, java.nio.IntBuffer faces) {
+    write_vertex_array(vertices);
+    write_face_array(faces);
+  }
+
+  public CGAL.Java.Direct_buffers toDirectBuffers() {
+    CGAL.Java.Direct_buffers out = new CGAL.Java.Direct_buffers(
+      CGAL.Java.Direct_buffers.allocate_doubles(3 * size_of_vertices()),
+      CGAL.Java.Direct_buffers.allocate_ints(3 * size_of_facets()), null);
+    toDirectBuffers(out.vertices, out.faces);
+    return out;
+  }
+%}
+#endif
 SWIG_CGAL_declare_identifier_of_template_class(Polyhedron_3,Polyhedron_3_wrapper< Polyhedron_3_,SWIG_Polyhedron_3::CGAL_Vertex_handle<Polyhedron_3_>,SWIG_Polyhedron_3::CGAL_Halfedge_handle<Polyhedron_3_>,SWIG_Polyhedron_3::CGAL_Facet_handle<Polyhedron_3_> >)
 
 //general modifier
@@ -87,6 +141,14 @@ SWIG_CGAL_declare_identifier_of_template_class(Polyhedron_3_Halfedge_around_vert
 SWIG_CGAL_set_as_java_iterator(SWIG_CGAL_Circulator,Polyhedron_3_Halfedge_handle,)
 SWIG_CGAL_declare_identifier_of_template_class(Polyhedron_3_Halfedge_around_facet_circulator,SWIG_CGAL_Circulator< Polyhedron_3_::Halfedge_around_facet_circulator,SWIG_Polyhedron_3::CGAL_Halfedge_handle<Polyhedron_3_> >)
 
+#ifdef SWIGPYTHON
+//pickling and shared memory transport, see CGAL.add_pickle_support()
+%pythoncode %{
+import CGAL as _CGAL
+_CGAL.add_pickle_support(Polyhedron_3)
+%}
+#endif
+
 #ifdef SWIG_CGAL_HAS_Polyhedron_3_USER_PACKAGE
 %include "SWIG_CGAL/User_packages/Polyhedron_3/extensions.i"
 #endif
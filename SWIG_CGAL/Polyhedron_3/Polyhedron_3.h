@@ -14,25 +14,48 @@
 
 
 #include <SWIG_CGAL/Kernel/typedefs.h>
+#include <SWIG_CGAL/Common/Buffer.h>
 #include <SWIG_CGAL/Common/Macros.h>
+#include <SWIG_CGAL/Common/Shared_memory.h>
+#include <SWIG_CGAL/Common/Mesh_file.h>
 #include <SWIG_CGAL/Common/Iterator.h>
 #include <SWIG_CGAL/Kernel/Point_3.h>
 #include <SWIG_CGAL/Kernel/Plane_3.h>
 #include <SWIG_CGAL/Polyhedron_3/Modifier_base.h>
 #include <SWIG_CGAL/Polyhedron_3/general_modifier.h>
+#include <SWIG_CGAL/Polyhedron_3/Build_from_arrays.h>
+#include <SWIG_CGAL/Polyhedron_3/Polyhedron_ids.h>
+#include <SWIG_CGAL/Polyhedron_3/Polyhedron_cache.h>
 #include <boost/shared_ptr.hpp>
 
+#include <cstdint>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
 template <class Polyhedron_base,class Vertex_handle,class Halfedge_handle,class Facet_handle>
 class Polyhedron_3_wrapper{
   boost::shared_ptr<Polyhedron_base> data_sptr;
- 
+  boost::shared_ptr<SWIG_Polyhedron_3::Next_ids> next_ids_sptr; //shared with the copies, as the polyhedron
+  boost::shared_ptr<SWIG_Polyhedron_3::Polyhedron_cache> cache_sptr; //idem
+
+  #ifndef SWIG
+  //gives ids to the items created by an editing operation
+  Halfedge_handle with_new_ids(const Halfedge_handle& h)
+  {
+    SWIG_Polyhedron_3::assign_new_ids(get_data(), *next_ids_sptr);
+    return h;
+  }
+  #endif
+
 public:
   #ifndef SWIG
   typedef Polyhedron_base cpp_base;
   const cpp_base& get_data() const {return *data_sptr;}
         cpp_base& get_data()       {return *data_sptr;}
   boost::shared_ptr<cpp_base> shared_ptr() {return data_sptr;}      
-  Polyhedron_3_wrapper(const cpp_base& base):data_sptr(new cpp_base(base)){}
+  SWIG_Polyhedron_3::Polyhedron_cache& cache() {return *cache_sptr;}
+  Polyhedron_3_wrapper(const cpp_base& base):data_sptr(new cpp_base(base)),next_ids_sptr(new SWIG_Polyhedron_3::Next_ids()),cache_sptr(new SWIG_Polyhedron_3::Polyhedron_cache()){}
   #endif
   
   typedef SWIG_CGAL_Iterator<typename Polyhedron_base::Vertex_iterator,Vertex_handle>     Vertex_iterator;
@@ -45,8 +68,8 @@ public:
   #endif    
     
 //Creation
-  Polyhedron_3_wrapper():data_sptr(new cpp_base()){}
-  Polyhedron_3_wrapper(const char* off_filename):data_sptr(new cpp_base()){
+  Polyhedron_3_wrapper():data_sptr(new cpp_base()),next_ids_sptr(new SWIG_Polyhedron_3::Next_ids()),cache_sptr(new SWIG_Polyhedron_3::Polyhedron_cache()){}
+  Polyhedron_3_wrapper(const char* off_filename):data_sptr(new cpp_base()),next_ids_sptr(new SWIG_Polyhedron_3::Next_ids()),cache_sptr(new SWIG_Polyhedron_3::Polyhedron_cache()){
     std::ifstream file(off_filename);
     if (!file) std::cerr << "Error cannot open file: " << off_filename << std::endl;
     else{
@@ -54,12 +77,18 @@ public:
       file.close();
     }
   }
-  Polyhedron_3_wrapper(unsigned v, unsigned h, unsigned f):data_sptr(new cpp_base(v,h,f)){}
+  Polyhedron_3_wrapper(unsigned v, unsigned h, unsigned f):data_sptr(new cpp_base(v,h,f)),next_ids_sptr(new SWIG_Polyhedron_3::Next_ids()),cache_sptr(new SWIG_Polyhedron_3::Polyhedron_cache()){}
   SWIG_CGAL_FORWARD_CALL_3(void,reserve,unsigned,unsigned,unsigned)
-  SWIG_CGAL_FORWARD_CALL_AND_REF_0(Halfedge_handle,make_tetrahedron)
-  SWIG_CGAL_FORWARD_CALL_AND_REF_4(Halfedge_handle,make_tetrahedron,Point_3,Point_3,Point_3,Point_3)
-  SWIG_CGAL_FORWARD_CALL_AND_REF_0(Halfedge_handle,make_triangle)
-  SWIG_CGAL_FORWARD_CALL_AND_REF_3(Halfedge_handle,make_triangle,Point_3,Point_3,Point_3)
+  Halfedge_handle make_tetrahedron() {return with_new_ids(Halfedge_handle(get_data().make_tetrahedron()));}
+  void make_tetrahedron(Halfedge_handle& ret) {ret=make_tetrahedron();}
+  Halfedge_handle make_tetrahedron(const Point_3& p1, const Point_3& p2, const Point_3& p3, const Point_3& p4)
+  {return with_new_ids(Halfedge_handle(get_data().make_tetrahedron(p1.get_data(),p2.get_data(),p3.get_data(),p4.get_data())));}
+  void make_tetrahedron(const Point_3& p1, const Point_3& p2, const Point_3& p3, const Point_3& p4, Halfedge_handle& ret) {ret=make_tetrahedron(p1,p2,p3,p4);}
+  Halfedge_handle make_triangle() {return with_new_ids(Halfedge_handle(get_data().make_triangle()));}
+  void make_triangle(Halfedge_handle& ret) {ret=make_triangle();}
+  Halfedge_handle make_triangle(const Point_3& p1, const Point_3& p2, const Point_3& p3)
+  {return with_new_ids(Halfedge_handle(get_data().make_triangle(p1.get_data(),p2.get_data(),p3.get_data())));}
+  void make_triangle(const Point_3& p1, const Point_3& p2, const Point_3& p3, Halfedge_handle& ret) {ret=make_triangle(p1,p2,p3);}
 //Access Member Functions
   SWIG_CGAL_FORWARD_CALL_0(bool,empty)
   SWIG_CGAL_FORWARD_CALL_0(unsigned,size_of_vertices)
@@ -88,25 +117,38 @@ public:
   SWIG_CGAL_FORWARD_CALL_1(bool,is_triangle,Halfedge_handle)
   SWIG_CGAL_FORWARD_CALL_1(bool,is_tetrahedron,Halfedge_handle)
 
-  SWIG_CGAL_FORWARD_CALL_AND_REF_2(Halfedge_handle,split_facet,Halfedge_handle,Halfedge_handle)
+  Halfedge_handle split_facet(const Halfedge_handle& h, const Halfedge_handle& g)
+  {return with_new_ids(Halfedge_handle(get_data().split_facet(h.get_data(),g.get_data())));}
+  void split_facet(const Halfedge_handle& h, const Halfedge_handle& g, Halfedge_handle& ret) {ret=split_facet(h,g);}
   SWIG_CGAL_FORWARD_CALL_AND_REF_1(Halfedge_handle,join_facet,Halfedge_handle)
 
-  SWIG_CGAL_FORWARD_CALL_AND_REF_2(Halfedge_handle,split_vertex,Halfedge_handle,Halfedge_handle)
+  Halfedge_handle split_vertex(const Halfedge_handle& h, const Halfedge_handle& g)
+  {return with_new_ids(Halfedge_handle(get_data().split_vertex(h.get_data(),g.get_data())));}
+  void split_vertex(const Halfedge_handle& h, const Halfedge_handle& g, Halfedge_handle& ret) {ret=split_vertex(h,g);}
   SWIG_CGAL_FORWARD_CALL_AND_REF_1(Halfedge_handle,join_vertex,Halfedge_handle)
-  SWIG_CGAL_FORWARD_CALL_AND_REF_1(Halfedge_handle,split_edge,Halfedge_handle)
+  Halfedge_handle split_edge(const Halfedge_handle& h) {return with_new_ids(Halfedge_handle(get_data().split_edge(h.get_data())));}
+  void split_edge(const Halfedge_handle& h, Halfedge_handle& ret) {ret=split_edge(h);}
   SWIG_CGAL_FORWARD_CALL_AND_REF_1(Halfedge_handle,flip_edge,Halfedge_handle)
 
-  SWIG_CGAL_FORWARD_CALL_AND_REF_1(Halfedge_handle,create_center_vertex,Halfedge_handle)
+  Halfedge_handle create_center_vertex(const Halfedge_handle& h) {return with_new_ids(Halfedge_handle(get_data().create_center_vertex(h.get_data())));}
+  void create_center_vertex(const Halfedge_handle& h, Halfedge_handle& ret) {ret=create_center_vertex(h);}
   SWIG_CGAL_FORWARD_CALL_AND_REF_1(Halfedge_handle,erase_center_vertex,Halfedge_handle)
 
-  SWIG_CGAL_FORWARD_CALL_AND_REF_3(Halfedge_handle,split_loop,Halfedge_handle,Halfedge_handle,Halfedge_handle)
+  Halfedge_handle split_loop(const Halfedge_handle& h, const Halfedge_handle& i, const Halfedge_handle& j)
+  {return with_new_ids(Halfedge_handle(get_data().split_loop(h.get_data(),i.get_data(),j.get_data())));}
+  void split_loop(const Halfedge_handle& h, const Halfedge_handle& i, const Halfedge_handle& j, Halfedge_handle& ret) {ret=split_loop(h,i,j);}
   SWIG_CGAL_FORWARD_CALL_AND_REF_2(Halfedge_handle,join_loop,Halfedge_handle,Halfedge_handle)
 
   SWIG_CGAL_FORWARD_CALL_AND_REF_1(Halfedge_handle,make_hole,Halfedge_handle)
-  SWIG_CGAL_FORWARD_CALL_AND_REF_1(Halfedge_handle,fill_hole,Halfedge_handle)
+  Halfedge_handle fill_hole(const Halfedge_handle& h) {return with_new_ids(Halfedge_handle(get_data().fill_hole(h.get_data())));}
+  void fill_hole(const Halfedge_handle& h, Halfedge_handle& ret) {ret=fill_hole(h);}
 
-  SWIG_CGAL_FORWARD_CALL_AND_REF_2(Halfedge_handle,add_vertex_and_facet_to_border,Halfedge_handle,Halfedge_handle)
-  SWIG_CGAL_FORWARD_CALL_AND_REF_2(Halfedge_handle,add_facet_to_border,Halfedge_handle,Halfedge_handle)
+  Halfedge_handle add_vertex_and_facet_to_border(const Halfedge_handle& h, const Halfedge_handle& g)
+  {return with_new_ids(Halfedge_handle(get_data().add_vertex_and_facet_to_border(h.get_data(),g.get_data())));}
+  void add_vertex_and_facet_to_border(const Halfedge_handle& h, const Halfedge_handle& g, Halfedge_handle& ret) {ret=add_vertex_and_facet_to_border(h,g);}
+  Halfedge_handle add_facet_to_border(const Halfedge_handle& h, const Halfedge_handle& g)
+  {return with_new_ids(Halfedge_handle(get_data().add_facet_to_border(h.get_data(),g.get_data())));}
+  void add_facet_to_border(const Halfedge_handle& h, const Halfedge_handle& g, Halfedge_handle& ret) {ret=add_facet_to_border(h,g);}
 
   SWIG_CGAL_FORWARD_CALL_1(void,erase_facet,Halfedge_handle)
   SWIG_CGAL_FORWARD_CALL_1(void,erase_connected_component,Halfedge_handle)
@@ -126,8 +168,8 @@ public:
   SWIG_CGAL_FORWARD_CALL_0(void,inside_out)
   SWIG_CGAL_FORWARD_CALL_0(bool,is_valid) //bool P.is_valid ( bool verbose = false, int level = 0)
   SWIG_CGAL_FORWARD_CALL_0(bool,normalized_border_is_valid)  //bool P.normalized_border_is_valid ( bool verbose = false)
-  void delegate(Modifier_base<Polyhedron_base> modifier){get_data().delegate(modifier.get_data());}
-  void delegate(General_modifier<typename Polyhedron_base::HalfedgeDS> modifier){get_data().delegate(modifier);}
+  void delegate(Modifier_base<Polyhedron_base> modifier){get_data().delegate(modifier.get_data()); with_new_ids(Halfedge_handle());}
+  void delegate(General_modifier<typename Polyhedron_base::HalfedgeDS> modifier){get_data().delegate(modifier); with_new_ids(Halfedge_handle());}
   void write_to_file(const char* off_filename, int prec=5) const
   {
     std::ofstream file(off_filename);
@@ -137,10 +179,177 @@ public:
       file.close();
     }
   }
+  // OFF, OBJ, PLY or STL file (ASCII or binary for PLY and STL), as given
+  // by the extension of `filename`. The file is mapped in memory and the
+  // text formats are parsed by chunks in parallel, then the polyhedron is
+  // built from the arrays read (with `repair`, as with from_csr_arrays()).
+  // Unlike the constructor, the text OFF files must have one vertex or
+  // facet per line.
+  void read_mesh(const std::string& filename, bool repair=false)
+  {
+    SWIG_CGAL::Mesh_arrays mesh;
+    SWIG_CGAL::read_mesh_file(filename, mesh);
+    Self P;
+    SWIG_Polyhedron_3::Build_from_arrays<typename Polyhedron_base::HalfedgeDS>
+      builder(mesh.vertices.data(), mesh.number_of_vertices(), mesh.indices.data(),
+              mesh.offsets.data(), mesh.number_of_faces(), repair);
+    P.get_data().delegate(builder);
+    P.compact();
+    *this=P;
+  }
+  // text OFF or OBJ with `precision` significant digits (17 to read the
+  // same coordinates back), binary PLY or binary STL (triangles only), in
+  // the order of the ids (see compact(), called first if the ids are not
+  // compact). Returns false if the file cannot be written.
+  bool write_mesh(const std::string& filename, int precision=17)
+  {
+    if (!has_compact_ids()) compact();
+    SWIG_CGAL::Mesh_arrays mesh;
+    std::vector<std::uint32_t> degrees;
+    SWIG_Polyhedron_3::export_to_arrays(get_data(), &mesh.vertices, nullptr);
+    SWIG_Polyhedron_3::export_polygons(get_data(), degrees, mesh.indices);
+    mesh.offsets.resize(degrees.size()+1);
+    mesh.offsets[0]=0;
+    for (std::size_t f=0; f<degrees.size(); ++f)
+      mesh.offsets[f+1]=mesh.offsets[f]+int(degrees[f]);
+    return SWIG_CGAL::write_mesh_file(filename, mesh, precision);
+  }
+//Ids
+  // Items created by the editing operations above get the next free id of
+  // their kind, so that ids are unique but not contiguous after removals or
+  // after edits made by other packages: compact() renumbers the vertices,
+  // halfedges and facets from 0 in iteration order, in linear time.
+  void compact() {SWIG_Polyhedron_3::compact_ids(get_data(), *next_ids_sptr);}
+  bool has_compact_ids() const {return SWIG_Polyhedron_3::has_compact_ids(get_data());}
+//Cache
+  // The AABB trees used by Side_of_triangle_mesh and Polygon_mesh_slicer are
+  // built once and shared as long as the polyhedron is not modified;
+  // clear_cache() releases them.
+  void clear_cache() {cache_sptr->clear();}
+//Memory
+  // The items of the polyhedron are allocated one by one: its structure is
+  // bytes_reserved(), there is no capacity to release. The AABB trees of
+  // the cache are counted as caches.
+  SWIG_CGAL::Memory_usage memory_usage() const
+  {return SWIG_CGAL::Memory_usage(get_data().bytes_reserved(), 0, 0, cache_sptr->bytes());}
 //Deep copy
   typedef Polyhedron_3_wrapper<Polyhedron_base,Vertex_handle,Halfedge_handle,Facet_handle> Self;
   Self deepcopy() const {return Self(*this);}
   void deepcopy(const Self& other){*this=other;}
+//Arrays
+  #ifndef SWIG
+  static Self from_arrays(const double* vertices, std::size_t nb_vertices,
+                          const int* faces, std::size_t nb_faces, std::size_t k)
+  {
+    Self P;
+    SWIG_Polyhedron_3::Build_from_arrays<typename Polyhedron_base::HalfedgeDS>
+      builder(vertices, nb_vertices, faces, nb_faces, k);
+    P.get_data().delegate(builder);
+    P.compact();
+    return P;
+  }
+  #endif
+  // from a (V,3) array of vertices and a (F,k) array of vertex indices of
+  // polygons with k vertices (a one-dimensional array holds triangles)
+  static Self from_arrays(SWIG_CGAL::Buffer<double> vertices, SWIG_CGAL::Buffer<int> faces)
+  {
+    const std::size_t k = faces.cols()==1 ? 3 : faces.cols();
+    if (vertices.size()%3!=0 || k<3 || faces.size()%k!=0)
+      throw std::invalid_argument("Expecting (V,3) vertices and (F,k) vertex indices with k>=3");
+    return from_arrays(vertices.data(), vertices.size()/3, faces.data(), faces.size()/k, k);
+  }
+  // from a (V,3) array of vertices and facets of any degree in compressed
+  // sparse rows: facet f has the vertices indices[offsets[f]] to
+  // indices[offsets[f+1]-1], offsets having F+1 values. With `repair`, the
+  // facets which would make the surface invalid are skipped instead of
+  // throwing (see Build_from_arrays), size_of_facets() telling how many.
+  static Self from_csr_arrays(SWIG_CGAL::Buffer<double> vertices, SWIG_CGAL::Buffer<int> offsets,
+                              SWIG_CGAL::Buffer<int> indices, bool repair=false)
+  {
+    if (vertices.size()%3!=0 || offsets.size()==0)
+      throw std::invalid_argument("Expecting (V,3) vertices and F+1 offsets");
+    const int last = offsets.data()[offsets.size()-1];
+    if (last<0 || std::size_t(last)>indices.size())
+      throw std::invalid_argument("The last offset must be at most the number of indices");
+    Self P;
+    SWIG_Polyhedron_3::Build_from_arrays<typename Polyhedron_base::HalfedgeDS>
+      builder(vertices.data(), vertices.size()/3, indices.data(), offsets.data(), offsets.size()-1, repair);
+    P.get_data().delegate(builder);
+    P.compact();
+    return P;
+  }
+  // (size_of_vertices(), 3), the row of a vertex is its id and the row of a
+  // facet is its id (see compact(), called first if the ids are not compact)
+  SWIG_CGAL::Buffer<double> vertex_array()
+  {
+    if (!has_compact_ids()) compact();
+    std::vector<double> out;
+    SWIG_Polyhedron_3::export_to_arrays(get_data(), &out, nullptr);
+    return SWIG_CGAL::Buffer<double>(std::move(out), 3);
+  }
+  // (size_of_facets(), 3), for pure triangle polyhedra
+  SWIG_CGAL::Buffer<int> face_array()
+  {
+    if (!has_compact_ids()) compact();
+    std::vector<int> out;
+    SWIG_Polyhedron_3::export_to_arrays(get_data(), nullptr, &out);
+    return SWIG_CGAL::Buffer<int>(std::move(out), 3);
+  }
+  // write the values of vertex_array() (resp. face_array()) in `out`, e.g. a
+  // direct java.nio buffer, without intermediate array
+  void write_vertex_array(SWIG_CGAL::Buffer<double> out)
+  {
+    if (!has_compact_ids()) compact();
+    SWIG_CGAL::check_output_buffer(out, 3*std::size_t(get_data().size_of_vertices()), "vertex array");
+    SWIG_Polyhedron_3::write_arrays(get_data(), out.data(), nullptr);
+  }
+  void write_face_array(SWIG_CGAL::Buffer<int> out)
+  {
+    if (!has_compact_ids()) compact();
+    SWIG_CGAL::check_output_buffer(out, 3*std::size_t(get_data().size_of_facets()), "face array");
+    SWIG_Polyhedron_3::write_arrays(get_data(), nullptr, out.data());
+  }
+//Binary state
+  // the vertices and the facets, in the order of their ids (see compact(),
+  // called first if the ids are not compact)
+  #ifndef SWIG
+  void write_state(std::ostream& os)
+  {
+    if (!has_compact_ids()) compact();
+    std::vector<double> vertices;
+    std::vector<std::uint32_t> degrees;
+    std::vector<int> faces;
+    SWIG_Polyhedron_3::export_to_arrays(get_data(), &vertices, nullptr);
+    SWIG_Polyhedron_3::export_polygons(get_data(), degrees, faces);
+    SWIG_CGAL::write_state_magic(os, "CGALPH3S");
+    SWIG_CGAL::write_state_array(os, vertices.data(), vertices.size());
+    SWIG_CGAL::write_state_array(os, degrees.data(), degrees.size());
+    SWIG_CGAL::write_state_array(os, faces.data(), faces.size());
+  }
+  void read_state(const char* data, std::size_t size,
+                  const std::shared_ptr<boost::interprocess::mapped_region>&)
+  {
+    SWIG_CGAL::Memory_istream is(data, size);
+    SWIG_CGAL::read_state_magic(is, "CGALPH3S", "Polyhedron_3");
+    std::vector<double> vertices;
+    std::vector<std::uint32_t> degrees;
+    std::vector<int> faces;
+    SWIG_CGAL::read_state_array(is, vertices);
+    SWIG_CGAL::read_state_array(is, degrees);
+    SWIG_CGAL::read_state_array(is, faces);
+    std::size_t nb_ids=0;
+    for (std::uint32_t d : degrees) nb_ids+=d;
+    if (vertices.size()%3!=0 || nb_ids!=faces.size())
+      throw std::runtime_error("Corrupted binary state of a Polyhedron_3");
+    Self P;
+    SWIG_Polyhedron_3::Build_from_arrays<typename Polyhedron_base::HalfedgeDS>
+      builder(vertices.data(), vertices.size()/3, faces.data(), degrees.data(), degrees.size());
+    P.get_data().delegate(builder);
+    P.compact();
+    *this=P;
+  }
+  #endif
+  SWIG_CGAL_BINARY_STATE_FUNCTIONS
 };
 
 #endif //SWIG_CGAL_POLYHEDRON_3_POLYHEDRON_3_H
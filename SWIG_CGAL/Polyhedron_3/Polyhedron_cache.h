@@ -0,0 +1,105 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+
+#ifndef SWIG_CGAL_POLYHEDRON_3_POLYHEDRON_CACHE_H
+#define SWIG_CGAL_POLYHEDRON_3_POLYHEDRON_CACHE_H
+
+#include <SWIG_CGAL/Common/Memory_usage.h>
+
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <typeindex>
+
+namespace SWIG_Polyhedron_3{
+
+// Structures computed from a polyhedron (AABB trees...) that the wrappers
+// using the polyhedron share instead of building their own. An entry is
+// valid as long as the polyhedron has the same signature: numbers of items,
+// connectivity and coordinates of the points. Computing the signature is
+// linear, hence much cheaper than rebuilding a tree.
+class Polyhedron_cache{
+  struct Signature{
+    std::size_t vertices, halfedges, facets, hash;
+    bool operator==(const Signature& other) const
+    {
+      return vertices == other.vertices && halfedges == other.halfedges
+          && facets == other.facets && hash == other.hash;
+    }
+  };
+
+  struct Entry{
+    Signature signature;
+    std::shared_ptr<void> structure;
+    std::size_t bytes;
+  };
+
+  std::map<std::type_index, Entry> entries;
+  std::mutex mutex;
+
+  static void combine(std::size_t& seed, std::size_t value)
+  {
+    seed ^= value + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+  }
+
+  template <class Polyhedron>
+  static Signature signature(const Polyhedron& P)
+  {
+    Signature s = {P.size_of_vertices(), P.size_of_halfedges(), P.size_of_facets(), 0};
+    std::hash<double> hash_double;
+    std::hash<const void*> hash_pointer;
+    for (typename Polyhedron::Vertex_const_iterator v = P.vertices_begin(); v != P.vertices_end(); ++v)
+      for (int i = 0; i < 3; ++i)
+        combine(s.hash, hash_double(v->point()[i]));
+    for (typename Polyhedron::Halfedge_const_iterator h = P.halfedges_begin(); h != P.halfedges_end(); ++h)
+    {
+      combine(s.hash, hash_pointer(&*h->vertex()));
+      combine(s.hash, hash_pointer(&*h->next()));
+    }
+    return s;
+  }
+
+public:
+  // the structure T of P, built with build() if there is none or if P
+  // was modified since it was built
+  template <class T, class Polyhedron, class Builder>
+  std::shared_ptr<const T> get(const Polyhedron& P, const Builder& build)
+  {
+    const Signature s = signature(P);
+    std::lock_guard<std::mutex> lock(mutex);
+    Entry& entry = entries[std::type_index(typeid(T))];
+    if (!entry.structure || !(entry.signature == s))
+    {
+      std::shared_ptr<T> t = build();
+      entry.signature = s;
+      entry.structure = std::shared_ptr<void>(t);
+      entry.bytes = SWIG_CGAL::internal::memory_usage_of(*t).total();
+    }
+    return std::static_pointer_cast<const T>(entry.structure);
+  }
+
+  // bytes of the structures cached, valid or not
+  std::size_t bytes()
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    std::size_t total = 0;
+    for (const auto& entry : entries)
+      total += entry.second.bytes;
+    return total;
+  }
+
+  void clear()
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    entries.clear();
+  }
+};
+
+} //namespace SWIG_Polyhedron_3
+
+#endif //SWIG_CGAL_POLYHEDRON_3_POLYHEDRON_CACHE_H
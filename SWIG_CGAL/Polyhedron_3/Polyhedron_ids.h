@@ -0,0 +1,109 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+
+#ifndef SWIG_CGAL_POLYHEDRON_3_POLYHEDRON_IDS_H
+#define SWIG_CGAL_POLYHEDRON_3_POLYHEDRON_IDS_H
+
+#include <CGAL/Polyhedron_items_with_id_3.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+namespace SWIG_Polyhedron_3{
+
+// Ids of the items of a polyhedron are maintained by Polyhedron_3_wrapper:
+// the items created by its editing operations get the next free id of their
+// kind, and compact_ids() renumbers all the items from 0 in iteration order.
+// Items created since the last update have the id std::size_t(-1); they are
+// always at the end of the item lists.
+struct Next_ids{
+  std::size_t vertex, halfedge, facet;
+  bool valid; // false until the ids of the polyhedron have been scanned
+  Next_ids() : vertex(0), halfedge(0), facet(0), valid(false) {}
+};
+
+namespace internal{
+
+template <class Iterator>
+std::size_t next_id(Iterator begin, Iterator end)
+{
+  std::size_t next = 0;
+  for (; begin != end; ++begin)
+    if (begin->id() != std::size_t(-1))
+      next = (std::max)(next, begin->id() + 1);
+  return next;
+}
+
+template <class Iterator>
+void assign_trailing_ids(Iterator begin, Iterator end, std::size_t& next)
+{
+  Iterator it = end;
+  while (it != begin)
+  {
+    --it;
+    if (it->id() != std::size_t(-1)) { ++it; break; }
+  }
+  for (; it != end; ++it)
+    it->id() = next++;
+}
+
+} //namespace internal
+
+template <class Polyhedron>
+void compact_ids(Polyhedron& P, Next_ids& next)
+{
+  CGAL::set_halfedgeds_items_id(P);
+  next.vertex = P.size_of_vertices();
+  next.halfedge = P.size_of_halfedges();
+  next.facet = P.size_of_facets();
+  next.valid = true;
+}
+
+// gives ids to the items created since the last update
+template <class Polyhedron>
+void assign_new_ids(Polyhedron& P, Next_ids& next)
+{
+  if (!next.valid)
+  {
+    next.vertex = internal::next_id(P.vertices_begin(), P.vertices_end());
+    next.halfedge = internal::next_id(P.halfedges_begin(), P.halfedges_end());
+    next.facet = internal::next_id(P.facets_begin(), P.facets_end());
+    next.valid = true;
+  }
+  // the ids may have been renumbered from 0 since (see compact_ids())
+  next.vertex = (std::max)(next.vertex, P.size_of_vertices());
+  next.halfedge = (std::max)(next.halfedge, P.size_of_halfedges());
+  next.facet = (std::max)(next.facet, P.size_of_facets());
+  internal::assign_trailing_ids(P.vertices_begin(), P.vertices_end(), next.vertex);
+  internal::assign_trailing_ids(P.halfedges_begin(), P.halfedges_end(), next.halfedge);
+  internal::assign_trailing_ids(P.facets_begin(), P.facets_end(), next.facet);
+}
+
+// true if the ids of the items in [begin,end) are 0,...,n-1 in some order
+template <class Iterator>
+bool has_compact_ids(Iterator begin, Iterator end, std::size_t n)
+{
+  std::vector<bool> seen (n, false);
+  for (; begin != end; ++begin)
+  {
+    if (begin->id() >= n || seen[begin->id()]) return false;
+    seen[begin->id()] = true;
+  }
+  return true;
+}
+
+template <class Polyhedron>
+bool has_compact_ids(const Polyhedron& P)
+{
+  return has_compact_ids(P.vertices_begin(), P.vertices_end(), P.size_of_vertices())
+      && has_compact_ids(P.halfedges_begin(), P.halfedges_end(), P.size_of_halfedges())
+      && has_compact_ids(P.facets_begin(), P.facets_end(), P.size_of_facets());
+}
+
+} //namespace SWIG_Polyhedron_3
+
+#endif //SWIG_CGAL_POLYHEDRON_3_POLYHEDRON_IDS_H
@@ -0,0 +1,42 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+
+#ifndef SWIG_CGAL_POLYHEDRON_3_POLYHEDRON_LEAN_ITEMS_3_H
+#define SWIG_CGAL_POLYHEDRON_3_POLYHEDRON_LEAN_ITEMS_3_H
+
+#include <CGAL/HalfedgeDS_vertex_max_base_with_id.h>
+#include <CGAL/HalfedgeDS_halfedge_max_base_with_id.h>
+#include <CGAL/HalfedgeDS_face_max_base_with_id.h>
+
+#include <cstddef>
+
+namespace CGAL{
+
+// Items of Polyhedron_3_ when built with SWIG_CGAL_LEAN_POLYHEDRON: the ones
+// of Polyhedron_items_with_id_3 without the plane of the facets (4 doubles
+// per facet), which the bindings do not use. The ids, used by the bindings
+// and the property maps of the packages, and the previous halfedges, used
+// by the BGL interface, are kept.
+class Polyhedron_lean_items_3 {
+public:
+    template < class Refs, class Traits>
+    struct Vertex_wrapper {
+        typedef typename Traits::Point_3 Point;
+        typedef HalfedgeDS_vertex_max_base_with_id< Refs, Point, std::size_t> Vertex;
+    };
+    template < class Refs, class Traits>
+    struct Halfedge_wrapper {
+        typedef HalfedgeDS_halfedge_max_base_with_id<Refs, std::size_t> Halfedge;
+    };
+    template < class Refs, class Traits>
+    struct Face_wrapper {
+        typedef HalfedgeDS_face_max_base_with_id< Refs, Tag_false, std::size_t> Face;
+    };
+};
+
+}//namespace CGAL
+
+#endif //SWIG_CGAL_POLYHEDRON_3_POLYHEDRON_LEAN_ITEMS_3_H
@@ -10,5 +10,8 @@
 #include <SWIG_CGAL/Polyhedron_3/typedefs.h>
 #include <SWIG_CGAL/Polyhedron_3/Polyhedron_3.h>
 #include <SWIG_CGAL/Polyhedron_3/polyhedron_3_handles.h>
+#include <SWIG_CGAL/Polyhedron_3/Build_from_arrays.h>
+#include <SWIG_CGAL/Polyhedron_3/Polyhedron_ids.h>
+#include <SWIG_CGAL/Polyhedron_3/Polyhedron_cache.h>
 
 #endif //SWIG_CGAL_POLYHEDRON_3_ALL_INCLUDES_H
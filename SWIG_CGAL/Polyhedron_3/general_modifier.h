@@ -10,6 +10,9 @@
 #include <SWIG_CGAL/Common/Input_iterator_wrapper.h>
 #include <CGAL/Polyhedron_incremental_builder_3.h>
 
+#include <cstddef>
+#include <vector>
+
 //TODO: a specific Input_iterator_wrapper for int and a SWIG macro
 //typedef std::pair<Input_iterator_wrapper<int,int>,Input_iterator_wrapper<int,int> > Integer_range;
 
@@ -29,10 +32,12 @@ class General_modifier
   typedef typename HDS::Vertex::Point Point;
   
   typedef std::vector<Point> Point_container;
-  typedef std::vector< std::list<int> > Facet_container;
   
   Point_container points;
-  Facet_container facets;
+  // vertex ids of all the facets, facet f being facet_vertices[facet_offsets[f]]
+  // to the start of the next one
+  std::vector<int> facet_vertices;
+  std::vector<std::size_t> facet_offsets;
   int m_h;
   int m_mode;
   
@@ -41,17 +46,18 @@ public:
     void begin_surface(int v,int f,int h=0,Modifier_mode mode=RELATIVE_INDEXING)
     {
       points.reserve(v);
-      facets.reserve(f);
+      facet_offsets.reserve(f);
+      facet_vertices.reserve(h!=0 ? std::size_t(h) : 3*std::size_t(f));
       m_h=h;
       m_mode=mode;
     }
     void end_surface(){}
     void add_vertex(const Point_3& p){points.push_back(p.get_data());}
-    void begin_facet(){facets.push_back(std::list<int>());}
+    void begin_facet(){facet_offsets.push_back(facet_vertices.size());}
     void end_facet(){}
-    void add_vertex_to_facet(int i){facets.back().push_back(i);}
-    void rollback() {points.clear(); facets.clear();}
-    void clear() {points.clear(); facets.clear();}
+    void add_vertex_to_facet(int i){facet_vertices.push_back(i);}
+    void rollback() {clear();}
+    void clear() {points.clear(); facet_vertices.clear(); facet_offsets.clear();}
 //    void add_facet(Integer_range range){
 //      facets.push_back(std::list<int>());
 //      std::copy( range.first,range.second,std::back_inserter(facets.back()) );
@@ -60,13 +66,16 @@ public:
     void operator()( HDS& hds) {
         // Postcondition: `hds' is a valid polyhedral surface.
         CGAL::Polyhedron_incremental_builder_3<HDS> B( hds, true);
-        B.begin_surface(points.size(),facets.size(),m_h,m_mode);
+        B.begin_surface(points.size(),facet_offsets.size(),m_h,m_mode);
 
         for (typename Point_container::const_iterator it=points.begin();it!=points.end();++it)
           B.add_vertex(*it);
         
-        for (typename Facet_container::const_iterator it=facets.begin();it!=facets.end();++it)
-          B.add_facet(it->begin(),it->end());
+        for (std::size_t f=0;f<facet_offsets.size();++f)
+        {
+          std::size_t end = f+1<facet_offsets.size() ? facet_offsets[f+1] : facet_vertices.size();
+          B.add_facet(facet_vertices.begin()+facet_offsets[f],facet_vertices.begin()+end);
+        }
         B.end_surface();
     }
 #endif
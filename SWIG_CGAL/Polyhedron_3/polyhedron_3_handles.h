@@ -8,9 +8,11 @@
 #define SWIG_CGAL_POLYHEDRON_3_HANDLES_H
 
 #include <SWIG_CGAL/Common/Macros.h>
+#include <SWIG_CGAL/Kernel/Pooled_allocation.h>
 #include <CGAL/Polyhedron_3.h>
 #include <CGAL/Polyhedron_items_with_id_3.h>
 #include <SWIG_CGAL/Polyhedron_3/Polyhedron_items_with_id_and_info_3.h>
+#include <SWIG_CGAL/Polyhedron_3/Polyhedron_lean_items_3.h>
 
 namespace internal{
 
@@ -30,6 +32,14 @@ namespace internal{
     static void set(T& data,int i){data->id()=i;};
   };
 
+  template <>
+  struct Id<CGAL::Polyhedron_lean_items_3>{
+    template <class T>
+    static int get(const T& data){return data->id();};
+    template <class T>
+    static void set(T& data,int i){data->id()=i;};
+  };
+
   template <class I>
   struct Id<CGAL::Polyhedron_items_with_id_and_info_3<I> >{
     template <class T>
@@ -64,6 +74,7 @@ public:
   CGAL_Halfedge_handle(typename boost::graph_traits<Polyhedron_base>::edge_descriptor e):data(e.get_data().halfedge()){}
   const cpp_base& get_data() const {return data;}
         cpp_base& get_data()       {return data;}
+  SWIG_CGAL_POOLED_ALLOCATION
   #endif
   typedef SWIG_CGAL_Circulator<typename Polyhedron_base::Halfedge_around_vertex_circulator,CGAL_Halfedge_handle<Polyhedron_base> > Halfedge_around_vertex_circulator;
   typedef SWIG_CGAL_Circulator<typename Polyhedron_base::Halfedge_around_facet_circulator,CGAL_Halfedge_handle<Polyhedron_base> >  Halfedge_around_facet_circulator;
@@ -117,6 +128,7 @@ public:
   CGAL_Edge_handle(cpp_base h):data(h){}
   const cpp_base& get_data() const {return data;}
         cpp_base& get_data()       {return data;}
+  SWIG_CGAL_POOLED_ALLOCATION
   #endif
   typedef CGAL_Edge_handle<Polyhedron_base> Self;
 
@@ -141,6 +153,7 @@ public:
   CGAL_Vertex_handle(cpp_base h):data(h){}
   const cpp_base& get_data() const {return data;}
         cpp_base& get_data()       {return data;}
+  SWIG_CGAL_POOLED_ALLOCATION
   #endif
   typedef SWIG_CGAL_Circulator<typename Polyhedron_base::Halfedge_around_vertex_circulator,CGAL_Halfedge_handle<Polyhedron_base> > Halfedge_around_vertex_circulator;
   typedef SWIG_CGAL_Circulator<typename Polyhedron_base::Halfedge_around_facet_circulator,CGAL_Halfedge_handle<Polyhedron_base> >  Halfedge_around_facet_circulator;
@@ -180,6 +193,7 @@ public:
   CGAL_Facet_handle(cpp_base h):data(h){}
   const cpp_base& get_data() const {return data;}
         cpp_base& get_data()       {return data;}
+  SWIG_CGAL_POOLED_ALLOCATION
   #endif
 
   typedef SWIG_CGAL_Circulator<typename Polyhedron_base::Halfedge_around_facet_circulator,CGAL_Halfedge_handle<Polyhedron_base> >  Halfedge_around_facet_circulator;
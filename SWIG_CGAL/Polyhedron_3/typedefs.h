@@ -10,9 +10,14 @@
 #include <CGAL/Polyhedron_3.h>
 
 #ifndef SWIGJAVA
+#ifdef SWIG_CGAL_LEAN_POLYHEDRON
+#include "SWIG_CGAL/Polyhedron_3/Polyhedron_lean_items_3.h"
+typedef CGAL::Polyhedron_3<EPIC_Kernel, CGAL::Polyhedron_lean_items_3>        Polyhedron_3_;
+#else
 #include <CGAL/Polyhedron_items_with_id_3.h>
 #define SWIG_CGAL_FACET_SUPPORTS_PLANE
 typedef CGAL::Polyhedron_3<EPIC_Kernel, CGAL::Polyhedron_items_with_id_3>     Polyhedron_3_;
+#endif //SWIG_CGAL_LEAN_POLYHEDRON
 #else
 #include "SWIG_CGAL/Java/JavaData.h"
 #include "SWIG_CGAL/Polyhedron_3/Polyhedron_items_with_id_and_info_3.h"
@@ -15,6 +15,14 @@ SWIG_CGAL_add_java_loadLibrary(CGAL_Polyline_simplification_2)
 
 %import  "SWIG_CGAL/Common/Macros.h"
 %import  "SWIG_CGAL/Kernel/CGAL_Kernel.i"
+
+//typemaps for the insertion and location of points and the insertion of constraints from arrays,
+//and for the simplification of polylines given as arrays
+%include "SWIG_CGAL/typemaps.i"
+SWIG_CGAL_buffer_of_double_typemap_in
+SWIG_CGAL_buffer_of_int_typemap_in
+SWIG_CGAL_buffer_of_double_typemap_out
+SWIG_CGAL_buffer_of_int_typemap_out
 %include  "SWIG_CGAL/Common/Wrapper_iterator_helper.h"
 %include  "SWIG_CGAL/Common/Output_iterator_wrapper.h"
 %include "SWIG_CGAL/Common/Iterator.h"
@@ -32,6 +40,7 @@ SWIG_CGAL_add_java_loadLibrary(CGAL_Polyline_simplification_2)
   #include <SWIG_CGAL/Triangulation_2/Constrained_triangulation_plus_2.h>
   #include <SWIG_CGAL/Polyline_simplification_2/typedefs.h>
   #include <SWIG_CGAL/Polyline_simplification_2/Polyline_simplification_2.h>
+  #include <SWIG_CGAL/Polyline_simplification_2/Polyline_simplification_2_arrays.h>
 %}
 
 %pragma(java) jniclassimports=%{
@@ -55,6 +64,7 @@ SWIG_CGAL_add_java_loadLibrary(CGAL_Polyline_simplification_2)
 %}
 
 %include "SWIG_CGAL/Polyline_simplification_2/Polyline_simplification_2.h"
+%include "SWIG_CGAL/Polyline_simplification_2/Polyline_simplification_2_arrays.h"
 
 // define a new CDT_plus_2 matching vertex requirements
 %include "SWIG_CGAL/Triangulation_2/declare_constrained_Delaunay_triangulation_plus_2.i"
@@ -129,3 +139,28 @@ declare_simply_functions_point_range(Scaled_squared_distance_cost_wrapper<PS_CDT
 declare_simply_functions_point_range(Squared_distance_cost_wrapper<PS_CDTP2>,Stop_above_cost_threshold_wrapper<PS_CDTP2>)
 declare_simply_functions_point_range(Squared_distance_cost_wrapper<PS_CDTP2>,Stop_below_count_ratio_threshold_wrapper<PS_CDTP2>)
 declare_simply_functions_point_range(Squared_distance_cost_wrapper<PS_CDTP2>,Stop_below_count_threshold_wrapper<PS_CDTP2>)
+
+// simplification of polylines given as arrays of coordinates and offsets
+SWIG_CGAL_release_gil(simplify_polylines)
+declare_simplify_polylines_function(Hybrid_squared_distance_cost_wrapper<PS_CDTP2>,Stop_above_cost_threshold_wrapper<PS_CDTP2>)
+declare_simplify_polylines_function(Hybrid_squared_distance_cost_wrapper<PS_CDTP2>,Stop_below_count_ratio_threshold_wrapper<PS_CDTP2>)
+declare_simplify_polylines_function(Hybrid_squared_distance_cost_wrapper<PS_CDTP2>,Stop_below_count_threshold_wrapper<PS_CDTP2>)
+
+declare_simplify_polylines_function(Scaled_squared_distance_cost_wrapper<PS_CDTP2>,Stop_above_cost_threshold_wrapper<PS_CDTP2>)
+declare_simplify_polylines_function(Scaled_squared_distance_cost_wrapper<PS_CDTP2>,Stop_below_count_ratio_threshold_wrapper<PS_CDTP2>)
+declare_simplify_polylines_function(Scaled_squared_distance_cost_wrapper<PS_CDTP2>,Stop_below_count_threshold_wrapper<PS_CDTP2>)
+
+declare_simplify_polylines_function(Squared_distance_cost_wrapper<PS_CDTP2>,Stop_above_cost_threshold_wrapper<PS_CDTP2>)
+declare_simplify_polylines_function(Squared_distance_cost_wrapper<PS_CDTP2>,Stop_below_count_ratio_threshold_wrapper<PS_CDTP2>)
+declare_simplify_polylines_function(Squared_distance_cost_wrapper<PS_CDTP2>,Stop_below_count_threshold_wrapper<PS_CDTP2>)
+
+// tiled simplification, the stop criterion being evaluated per tile (not declared with count thresholds)
+SWIG_CGAL_release_gil(simplify_polylines_tiled)
+declare_simplify_polylines_tiled_function(Hybrid_squared_distance_cost_wrapper<PS_CDTP2>,Stop_above_cost_threshold_wrapper<PS_CDTP2>)
+declare_simplify_polylines_tiled_function(Hybrid_squared_distance_cost_wrapper<PS_CDTP2>,Stop_below_count_ratio_threshold_wrapper<PS_CDTP2>)
+
+declare_simplify_polylines_tiled_function(Scaled_squared_distance_cost_wrapper<PS_CDTP2>,Stop_above_cost_threshold_wrapper<PS_CDTP2>)
+declare_simplify_polylines_tiled_function(Scaled_squared_distance_cost_wrapper<PS_CDTP2>,Stop_below_count_ratio_threshold_wrapper<PS_CDTP2>)
+
+declare_simplify_polylines_tiled_function(Squared_distance_cost_wrapper<PS_CDTP2>,Stop_above_cost_threshold_wrapper<PS_CDTP2>)
+declare_simplify_polylines_tiled_function(Squared_distance_cost_wrapper<PS_CDTP2>,Stop_below_count_ratio_threshold_wrapper<PS_CDTP2>)
@@ -0,0 +1,347 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+
+#ifndef SWIG_CGAL_POLYLINE_SIMPLIFICATION_2_ARRAYS_H
+#define SWIG_CGAL_POLYLINE_SIMPLIFICATION_2_ARRAYS_H
+
+#include <SWIG_CGAL/Common/Buffer.h>
+
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+// Result of simplify_polylines() and simplify_polylines_tiled(): the points of polyline i are the rows
+// [offsets[i], offsets[i+1]) of point_array().
+class Simplified_polylines
+{
+  std::shared_ptr<std::vector<double> > points_sptr;
+  std::shared_ptr<std::vector<int> > offsets_sptr;
+
+public:
+  Simplified_polylines()
+    : points_sptr(new std::vector<double>())
+    , offsets_sptr(new std::vector<int>(1, 0)) {}
+
+  #ifndef SWIG
+  std::vector<double>& points() { return *points_sptr; }
+  std::vector<int>& offsets() { return *offsets_sptr; }
+  #endif
+
+  int number_of_polylines() const { return int(offsets_sptr->size()) - 1; }
+
+  // (number of points, 2)
+  SWIG_CGAL::Buffer<double> point_array() const
+  {
+    return SWIG_CGAL::Buffer<double>(points_sptr->data(), points_sptr->size() / 2, 2, points_sptr, true);
+  }
+  // (number_of_polylines() + 1, 1)
+  SWIG_CGAL::Buffer<int> offset_array() const
+  {
+    return SWIG_CGAL::Buffer<int>(offsets_sptr->data(), offsets_sptr->size(), 1, offsets_sptr, true);
+  }
+};
+
+#ifndef SWIG
+#include <SWIG_CGAL/Polyline_simplification_2/typedefs.h>
+#include <CGAL/Polyline_simplification_2/Stop_above_cost_threshold.h>
+#include <CGAL/for_each.h>
+#include <CGAL/tags.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace SWIG_Polyline_simplification_2 {
+
+#ifdef CGAL_LINKED_WITH_TBB
+typedef CGAL::Parallel_tag Concurrency_tag;
+#else
+typedef CGAL::Sequential_tag Concurrency_tag;
+#endif
+
+// number of polylines of the (N, 2) array coords cut by offsets
+inline std::size_t number_of_polylines (const SWIG_CGAL::Buffer<double>& coords,
+                                        const SWIG_CGAL::Buffer<int>& offsets)
+{
+  if (coords.size() % 2 != 0 || (coords.cols() != 1 && coords.cols() != 2))
+    throw std::invalid_argument ("The points must be given as rows of 2 coordinates");
+  const int nb_points = int(coords.size() / 2);
+  if (offsets.size() == 0 || offsets.data()[0] != 0 || offsets.data()[offsets.size() - 1] != nb_points)
+    throw std::invalid_argument ("The offsets must start with 0 and end with the number of points");
+  for (std::size_t i = 1; i < offsets.size(); ++ i)
+    if (offsets.data()[i] < offsets.data()[i - 1])
+      throw std::invalid_argument ("The offsets must be increasing");
+  return offsets.size() - 1;
+}
+
+// Simplifies the polylines whose points are the rows [offsets[i],
+// offsets[i+1]) of the (N, 2) array coords, all inserted as constraints of
+// a single PS_CDTP2 so that the simplified polylines do not intersect each
+// other more than the input ones. The stop criterion applies to the whole
+// set of polylines. If closed is true, each polyline is closed, and its
+// first point is not repeated at its end in the result. Polylines of less
+// than 2 points are returned unchanged.
+template <class Cost, class Stop>
+Simplified_polylines simplify_polylines (const SWIG_CGAL::Buffer<double>& coords,
+                                         const SWIG_CGAL::Buffer<int>& offsets,
+                                         const Cost& cost, const Stop& stop, bool closed)
+{
+  typedef PS_CDTP2::Point Point;
+  typedef PS_CDTP2::Constraint_id Constraint_id;
+
+  const std::size_t nb_polylines = number_of_polylines (coords, offsets);
+  PS_CDTP2 ct;
+  std::vector<Constraint_id> constraints (nb_polylines);
+  std::vector<Point> polyline;
+  for (std::size_t i = 0; i < nb_polylines; ++ i)
+  {
+    const int begin = offsets.data()[i], end = offsets.data()[i + 1];
+    if (end - begin < 2)
+      continue;
+    polyline.clear();
+    for (int j = begin; j < end; ++ j)
+      polyline.push_back (Point (coords.data()[2 * j], coords.data()[2 * j + 1]));
+    constraints[i] = ct.insert_constraint (polyline.begin(), polyline.end(), closed);
+  }
+  CGAL::Polyline_simplification_2::simplify (ct, cost, stop);
+
+  Simplified_polylines result;
+  std::vector<double>& points = result.points();
+  for (std::size_t i = 0; i < nb_polylines; ++ i)
+  {
+    const int begin = offsets.data()[i], end = offsets.data()[i + 1];
+    if (end - begin < 2)
+      points.insert (points.end(), coords.data() + 2 * begin, coords.data() + 2 * end);
+    else
+    {
+      const std::size_t first = points.size();
+      for (PS_CDTP2::Vertices_in_constraint_iterator v = ct.vertices_in_constraint_begin (constraints[i]);
+           v != ct.vertices_in_constraint_end (constraints[i]); ++ v)
+      {
+        points.push_back ((*v)->point().x());
+        points.push_back ((*v)->point().y());
+      }
+      if (closed && points.size() - first > 2) // the first vertex is repeated at the end
+        points.resize (points.size() - 2);
+    }
+    result.offsets().push_back (int(points.size() / 2));
+  }
+  return result;
+}
+
+// Stop criterion forwarding to `stop`, recording the largest cost of the
+// vertices it let be removed
+template <class Stop>
+struct Recording_stop
+{
+  const Stop& stop;
+  double& max_cost;
+
+  Recording_stop (const Stop& stop, double& max_cost) : stop(stop), max_cost(max_cost) {}
+
+  template <class CT, class Vertex_handle>
+  bool operator() (const CT& ct, Vertex_handle v, double cost,
+                   std::size_t initial_count, std::size_t current_count) const
+  {
+    if (stop (ct, v, cost, initial_count, current_count))
+      return true;
+    max_cost = (std::max) (max_cost, cost);
+    return false;
+  }
+};
+
+// Same as simplify_polylines(), on a grid of tiles_per_side x tiles_per_side
+// tiles of the bounding box of the points, the tiles being simplified
+// concurrently when linked with TBB.
+// A polyline is cut into runs of consecutive vertices in the same tile, the
+// segments joining two tiles being fixed: their vertices are seam vertices,
+// not removable in the tiles. The CDT+ of a tile holds its runs and the fixed
+// segments crossing it, so the removal of a vertex of a run, which only
+// changes the polyline inside the (convex) tile, is checked against all the
+// constraints it may intersect: the simplified polylines intersect each
+// other as the input ones, as in a sequential run. A final pass on a CDT+ of
+// all the polylines, where only the seam vertices are removable, removes
+// the seam vertices whose cost does not exceed the largest cost of a vertex
+// removed in the tiles (their cost no longer accounting for the points
+// removed in the tiles). The stop criterion is evaluated in each tile.
+template <class Cost, class Stop>
+Simplified_polylines simplify_polylines_tiled (const SWIG_CGAL::Buffer<double>& coords,
+                                               const SWIG_CGAL::Buffer<int>& offsets,
+                                               const Cost& cost, const Stop& stop,
+                                               int tiles_per_side, bool closed)
+{
+  typedef PS_CDTP2::Point Point;
+  typedef PS_CDTP2::Constraint_id Constraint_id;
+
+  if (tiles_per_side < 1)
+    throw std::invalid_argument ("The number of tiles must be positive");
+  const std::size_t nb_polylines = number_of_polylines (coords, offsets);
+  const double* xy = coords.data();
+  const int* off = offsets.data();
+  // vertex k of polyline i, the first vertex being repeated at the end of closed polylines
+  auto nb_vertices = [&](std::size_t i) -> int
+  {
+    const int n = off[i + 1] - off[i];
+    return n < 2 ? n : n + (closed ? 1 : 0);
+  };
+  auto row = [&](std::size_t i, int k) -> int
+  { return off[i] + (k == off[i + 1] - off[i] ? 0 : k); };
+
+  double bbox[4] = { 0, 0, 0, 0 }; // xmin, ymin, xmax, ymax
+  for (std::size_t j = 0; j < coords.size() / 2; ++ j)
+    for (int c = 0; c < 2; ++ c)
+    {
+      const double v = xy[2 * j + c];
+      if (j == 0 || v < bbox[c]) bbox[c] = v;
+      if (j == 0 || v > bbox[c + 2]) bbox[c + 2] = v;
+    }
+  const int nt = tiles_per_side;
+  auto tile_coordinate = [&](double v, int c) -> int
+  {
+    const double size = bbox[c + 2] - bbox[c];
+    const int t = size > 0 ? int ((v - bbox[c]) / size * nt) : 0;
+    return (std::min) ((std::max) (t, 0), nt - 1);
+  };
+  auto tile = [&](int r) -> int
+  { return tile_coordinate (xy[2 * r + 1], 1) * nt + tile_coordinate (xy[2 * r], 0); };
+
+  // runs [first, last] (last > first) of the polylines in each tile, and
+  // fixed segments (i, k, k + 1) overlapping each tile
+  struct Run { std::size_t polyline; int first, last; };
+  std::vector<std::vector<Run> > runs (std::size_t (nt) * nt);
+  std::vector<std::vector<Run> > fixed (std::size_t (nt) * nt);
+  for (std::size_t i = 0; i < nb_polylines; ++ i)
+  {
+    const int n = nb_vertices (i);
+    int first = 0;
+    for (int k = 1; k <= n; ++ k)
+    {
+      if (k < n && tile (row (i, k)) == tile (row (i, first)))
+        continue;
+      if (k - 1 > first)
+        runs[tile (row (i, first))].push_back (Run { i, first, k - 1 });
+      if (k < n)
+      {
+        const int r0 = row (i, k - 1), r1 = row (i, k);
+        const int tx0 = tile_coordinate (xy[2 * r0], 0), tx1 = tile_coordinate (xy[2 * r1], 0);
+        const int ty0 = tile_coordinate (xy[2 * r0 + 1], 1), ty1 = tile_coordinate (xy[2 * r1 + 1], 1);
+        for (int ty = (std::min) (ty0, ty1); ty <= (std::max) (ty0, ty1); ++ ty)
+          for (int tx = (std::min) (tx0, tx1); tx <= (std::max) (tx0, tx1); ++ tx)
+            fixed[ty * nt + tx].push_back (Run { i, k - 1, k });
+      }
+      first = k;
+    }
+  }
+
+  // simplified runs of each tile
+  std::vector<std::vector<std::vector<Point> > > simplified (runs.size());
+  std::vector<double> max_costs (runs.size(), -1.);
+  std::vector<std::size_t> tiles (runs.size());
+  for (std::size_t t = 0; t < tiles.size(); ++ t)
+    tiles[t] = t;
+  CGAL::for_each<Concurrency_tag>
+    (tiles, [&](const std::size_t& t) -> bool
+     {
+       if (runs[t].empty())
+         return true;
+       PS_CDTP2 ct;
+       std::vector<Constraint_id> constraints;
+       std::vector<Point> polyline;
+       for (const Run& run : fixed[t])
+         ct.insert_constraint (Point (xy[2 * row (run.polyline, run.first)], xy[2 * row (run.polyline, run.first) + 1]),
+                               Point (xy[2 * row (run.polyline, run.last)], xy[2 * row (run.polyline, run.last) + 1]));
+       for (const Run& run : runs[t])
+       {
+         polyline.clear();
+         for (int k = run.first; k <= run.last; ++ k)
+           polyline.push_back (Point (xy[2 * row (run.polyline, k)], xy[2 * row (run.polyline, k) + 1]));
+         // the ends of the run are ends of its constraint, thus not removable
+         constraints.push_back (ct.insert_constraint (polyline.begin(), polyline.end()));
+       }
+       CGAL::Polyline_simplification_2::simplify (ct, cost, Recording_stop<Stop> (stop, max_costs[t]));
+       simplified[t].resize (constraints.size());
+       for (std::size_t r = 0; r < constraints.size(); ++ r)
+         for (PS_CDTP2::Vertices_in_constraint_iterator v = ct.vertices_in_constraint_begin (constraints[r]);
+              v != ct.vertices_in_constraint_end (constraints[r]); ++ v)
+           simplified[t][r].push_back ((*v)->point());
+       return true;
+     });
+
+  // final pass on the seams, with the runs in the order they were made
+  PS_CDTP2 ct;
+  std::vector<Constraint_id> constraints (nb_polylines);
+  std::vector<Point> seams;
+  std::vector<std::size_t> next_run (runs.size(), 0);
+  std::vector<Point> polyline;
+  for (std::size_t i = 0; i < nb_polylines; ++ i)
+  {
+    const int n = nb_vertices (i);
+    if (n < 2)
+      continue;
+    polyline.clear();
+    int first = 0;
+    for (int k = 1; k <= n; ++ k)
+    {
+      const int t = tile (row (i, first));
+      if (k < n && tile (row (i, k)) == t)
+        continue;
+      if (k - 1 > first)
+      {
+        const std::vector<Point>& run = simplified[t][next_run[t] ++];
+        polyline.insert (polyline.end(), run.begin(), run.end());
+      }
+      else
+        polyline.push_back (Point (xy[2 * row (i, first)], xy[2 * row (i, first) + 1]));
+      // the ends of the runs are kept by the simplification of the tiles
+      if (first != 0)
+        seams.push_back (Point (xy[2 * row (i, first)], xy[2 * row (i, first) + 1]));
+      if (k < n)
+        seams.push_back (polyline.back());
+      first = k;
+    }
+    constraints[i] = ct.insert_constraint (polyline.begin(), polyline.end());
+  }
+  double max_cost = -1.;
+  for (double c : max_costs)
+    max_cost = (std::max) (max_cost, c);
+  if (max_cost >= 0 && !seams.empty())
+  {
+    for (PS_CDTP2::Finite_vertices_iterator v = ct.finite_vertices_begin(); v != ct.finite_vertices_end(); ++ v)
+      v->set_removable (false);
+    for (const Point& p : seams)
+      ct.insert (p)->set_removable (true);
+    CGAL::Polyline_simplification_2::simplify
+      (ct, cost, CGAL::Polyline_simplification_2::Stop_above_cost_threshold
+                   (std::nextafter (max_cost, std::numeric_limits<double>::infinity())));
+  }
+
+  Simplified_polylines result;
+  std::vector<double>& points = result.points();
+  for (std::size_t i = 0; i < nb_polylines; ++ i)
+  {
+    if (nb_vertices (i) < 2)
+      points.insert (points.end(), xy + 2 * off[i], xy + 2 * off[i + 1]);
+    else
+    {
+      const std::size_t first = points.size();
+      for (PS_CDTP2::Vertices_in_constraint_iterator v = ct.vertices_in_constraint_begin (constraints[i]);
+           v != ct.vertices_in_constraint_end (constraints[i]); ++ v)
+      {
+        points.push_back ((*v)->point().x());
+        points.push_back ((*v)->point().y());
+      }
+      if (closed && points.size() - first > 2) // the first vertex is repeated at the end
+        points.resize (points.size() - 2);
+    }
+    result.offsets().push_back (int(points.size() / 2));
+  }
+  return result;
+}
+
+} // namespace SWIG_Polyline_simplification_2
+#endif
+
+#endif //SWIG_CGAL_POLYLINE_SIMPLIFICATION_2_ARRAYS_H
@@ -29,3 +29,21 @@
     }
   %}
 %enddef
+
+%define declare_simplify_polylines_function(COST, STOP)
+  %inline %{
+    Simplified_polylines simplify_polylines(SWIG_CGAL::Buffer<double> coords, SWIG_CGAL::Buffer<int> offsets, COST cost, STOP stop, bool closed=false)
+    {
+      return SWIG_Polyline_simplification_2::simplify_polylines(coords, offsets, cost.get_data(), stop.get_data(), closed);
+    }
+  %}
+%enddef
+
+%define declare_simplify_polylines_tiled_function(COST, STOP)
+  %inline %{
+    Simplified_polylines simplify_polylines_tiled(SWIG_CGAL::Buffer<double> coords, SWIG_CGAL::Buffer<int> offsets, COST cost, STOP stop, int tiles_per_side, bool closed=false)
+    {
+      return SWIG_Polyline_simplification_2::simplify_polylines_tiled(coords, offsets, cost.get_data(), stop.get_data(), tiles_per_side, closed);
+    }
+  %}
+%enddef
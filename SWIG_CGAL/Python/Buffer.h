@@ -0,0 +1,224 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+
+#ifndef SWIG_CGAL_PYTHON_BUFFER_H
+#define SWIG_CGAL_PYTHON_BUFFER_H
+
+#include <SWIG_CGAL/Common/Buffer.h>
+
+#include <cstring>
+
+namespace SWIG_CGAL {
+
+// Python object exporting a Buffer through the buffer protocol.
+// It holds a reference on the owner of the storage, so that the memory
+// stays valid as long as a consumer (memoryview, numpy.ndarray...) uses it.
+struct Python_buffer_object
+{
+  PyObject_HEAD
+  void* data;
+  Py_ssize_t shape[2];
+  Py_ssize_t strides[2];
+  int ndim;
+  Py_ssize_t itemsize;
+  const char* format;
+  int readonly;
+  std::shared_ptr<void>* owner;
+};
+
+inline int python_buffer_getbuffer(PyObject* self, Py_buffer* view, int flags)
+{
+  Python_buffer_object* buffer = reinterpret_cast<Python_buffer_object*>(self);
+  if (buffer->readonly && (flags & PyBUF_WRITABLE) == PyBUF_WRITABLE)
+  {
+    PyErr_SetString(PyExc_BufferError, "Buffer is read-only");
+    view->obj = nullptr;
+    return -1;
+  }
+
+  view->buf = buffer->data;
+  view->obj = self;
+  Py_INCREF(self);
+  view->len = buffer->shape[0] * buffer->itemsize;
+  if (buffer->ndim == 2)
+    view->len *= buffer->shape[1];
+  view->itemsize = buffer->itemsize;
+  view->readonly = buffer->readonly;
+  view->ndim = buffer->ndim;
+  view->format = (flags & PyBUF_FORMAT) ? const_cast<char*>(buffer->format) : nullptr;
+  view->shape = (flags & PyBUF_ND) ? buffer->shape : nullptr;
+  view->strides = ((flags & PyBUF_STRIDES) == PyBUF_STRIDES) ? buffer->strides : nullptr;
+  view->suboffsets = nullptr;
+  view->internal = nullptr;
+  return 0;
+}
+
+inline void python_buffer_dealloc(PyObject* self)
+{
+  Python_buffer_object* buffer = reinterpret_cast<Python_buffer_object*>(self);
+  delete buffer->owner;
+  PyTypeObject* type = Py_TYPE(self);
+  type->tp_free(self);
+#if PY_VERSION_HEX >= 0x03080000
+  Py_DECREF(type);
+#endif
+}
+
+inline PyTypeObject* python_buffer_type()
+{
+  static PyObject* type = nullptr;
+  if (type == nullptr)
+  {
+    static PyType_Slot slots[] = {
+      { Py_bf_getbuffer, reinterpret_cast<void*>(&python_buffer_getbuffer) },
+      { Py_tp_dealloc, reinterpret_cast<void*>(&python_buffer_dealloc) },
+      { 0, nullptr }
+    };
+    static PyType_Spec spec = {
+      "CGAL.Buffer", sizeof(Python_buffer_object), 0, Py_TPFLAGS_DEFAULT, slots
+    };
+    type = PyType_FromSpec(&spec);
+  }
+  return reinterpret_cast<PyTypeObject*>(type);
+}
+
+// Returns a memoryview on `buffer`, or nullptr with a Python exception set.
+// One-column buffers are exported as 1D arrays, others as (rows, cols) arrays.
+template <typename T>
+PyObject* buffer_to_python(const Buffer<T>& buffer)
+{
+  static T empty_storage[1];
+
+  PyTypeObject* type = python_buffer_type();
+  if (type == nullptr)
+    return nullptr;
+
+  Python_buffer_object* object = PyObject_New(Python_buffer_object, type);
+  if (object == nullptr)
+    return nullptr;
+
+  object->data = buffer.empty() ? empty_storage : buffer.data();
+  object->itemsize = sizeof(T);
+  object->format = Buffer_format<T>::format();
+  object->readonly = buffer.is_readonly() ? 1 : 0;
+  object->ndim = (buffer.cols() == 1) ? 1 : 2;
+  object->shape[0] = Py_ssize_t(buffer.rows());
+  object->shape[1] = Py_ssize_t(buffer.cols());
+  object->strides[0] = Py_ssize_t(buffer.cols() * sizeof(T));
+  object->strides[1] = Py_ssize_t(sizeof(T));
+  if (object->ndim == 1)
+    object->strides[0] = Py_ssize_t(sizeof(T));
+  object->owner = new std::shared_ptr<void>(buffer.owner());
+
+  PyObject* view = PyMemoryView_FromObject(reinterpret_cast<PyObject*>(object));
+  Py_DECREF(object);
+  return view;
+}
+
+// Holds a Py_buffer acquired from an input object for the duration of a call.
+class Python_buffer_guard
+{
+  Py_buffer m_view;
+  bool m_acquired;
+
+  Python_buffer_guard(const Python_buffer_guard&);
+  Python_buffer_guard& operator=(const Python_buffer_guard&);
+
+public:
+  Python_buffer_guard() : m_acquired(false) { }
+  ~Python_buffer_guard() { if (m_acquired) PyBuffer_Release(&m_view); }
+
+  Py_buffer* acquire (PyObject* input, bool writable)
+  {
+    int flags = PyBUF_C_CONTIGUOUS | PyBUF_FORMAT;
+    if (writable)
+      flags |= PyBUF_WRITABLE;
+    if (PyObject_GetBuffer(input, &m_view, flags) != 0)
+      return nullptr;
+    m_acquired = true;
+    return &m_view;
+  }
+};
+
+// Checks that a struct module format code is compatible with T
+template <typename T>
+bool python_buffer_format_matches(const char* format, Py_ssize_t itemsize)
+{
+  if (itemsize != Py_ssize_t(sizeof(T)))
+    return false;
+  if (format == nullptr)
+    return Buffer_format<T>::kind() == 'u' && sizeof(T) == 1;
+
+  static const int one = 1;
+  const bool little_endian = (*reinterpret_cast<const char*>(&one) == 1);
+  switch (*format)
+  {
+  case '@': case '=': ++format; break;
+  case '<': if (!little_endian) return false; ++format; break;
+  case '>': case '!': if (little_endian) return false; ++format; break;
+  default: break;
+  }
+  if (format[0] == '\0' || format[1] != '\0')
+    return false;
+
+  switch (Buffer_format<T>::kind())
+  {
+  case 'i': return std::strchr("bhilqn", *format) != nullptr;
+  case 'u': return std::strchr("BHILQN", *format) != nullptr;
+  default:  return std::strchr("fd", *format) != nullptr;
+  }
+}
+
+// Checks that `input` implements the buffer protocol with elements of type T
+template <typename T>
+bool python_buffer_check (PyObject* input)
+{
+  if (!PyObject_CheckBuffer(input))
+    return false;
+  Py_buffer view;
+  if (PyObject_GetBuffer(input, &view, PyBUF_FORMAT | PyBUF_ND) != 0)
+  {
+    PyErr_Clear();
+    return false;
+  }
+  bool out = python_buffer_format_matches<T>(view.format, view.itemsize);
+  PyBuffer_Release(&view);
+  return out;
+}
+
+// Builds a Buffer that borrows the memory of any C-contiguous object
+// implementing the buffer protocol (numpy.ndarray, array.array...).
+// On error, a Python exception is set and an empty Buffer is returned.
+template <typename T>
+Buffer<T> python_to_buffer (PyObject* input, Python_buffer_guard& guard,
+                            bool writable = false)
+{
+  Py_buffer* view = guard.acquire(input, writable);
+  if (view == nullptr)
+    return Buffer<T>();
+
+  if (!python_buffer_format_matches<T>(view->format, view->itemsize))
+  {
+    PyErr_Format(PyExc_TypeError, "Expecting a buffer of elements of format '%s'",
+                 Buffer_format<T>::format());
+    return Buffer<T>();
+  }
+
+  std::size_t rows = 1, cols = 1;
+  if (view->ndim >= 1)
+    rows = std::size_t(view->shape[0]);
+  for (int i = 1; i < view->ndim; ++i)
+    cols *= std::size_t(view->shape[i]);
+  if (view->ndim == 0 || view->shape == nullptr)
+    rows = std::size_t(view->len / view->itemsize);
+
+  return Buffer<T>(static_cast<T*>(view->buf), rows, cols,
+                   std::shared_ptr<void>(), view->readonly != 0);
+}
+
+} // namespace SWIG_CGAL
+
+#endif //SWIG_CGAL_PYTHON_BUFFER_H
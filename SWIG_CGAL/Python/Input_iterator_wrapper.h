@@ -8,20 +8,30 @@
 #define SWIG_CGAL_PYTHON_INPUT_ITERATOR_WRAPPER_H
 
 #include <boost/iterator/iterator_facade.hpp>
+#include <boost/shared_ptr.hpp>
+#include <cstddef>
 #include <stdexcept>
+#include <vector>
 
 #include <SWIG_CGAL/Python/exceptions.h>
+#include <SWIG_CGAL/Kernel/Profiling.h>
 
 #ifdef SWIG
 %include exception.i
 #endif
 
+// Iterator on the C++ objects of a Python iterable of wrappers. All the
+// objects are converted when the range is created (in a single loop over
+// the items for lists and tuples) and stored in a vector shared by the
+// copies of the iterator, so that the range can be traversed several times,
+// with random access (spatial sorting, reserve before insertion...) and
+// without using the Python API. The default iterator is the end of any range.
 template <class Cpp_wrapper,class Cpp_base>
 class Input_iterator_wrapper:
 public boost::iterator_facade<
     Input_iterator_wrapper<Cpp_wrapper,Cpp_base>,
     Cpp_base,
-    boost::single_pass_traversal_tag,
+    boost::random_access_traversal_tag,
     typename boost::mpl::if_<
           boost::mpl::bool_<internal::Converter<Cpp_wrapper>::is_reference>, 
           Cpp_base&, Cpp_base
@@ -29,79 +39,90 @@ public boost::iterator_facade<
     >
 {
   friend class boost::iterator_core_access;
+  typedef std::vector<Cpp_base> Storage;
 
-  void update_with_next_point(){
-    if (m_item!=nullptr){ Py_DECREF(m_item); }
-    m_item = PyIter_Next(m_iterator);
-    if ( m_item!=nullptr ){
-      void* ret=0;
-      int res = SWIG_ConvertPtr(m_item, &ret, m_type,  0  | 0);
-      if (!SWIG_IsOK(res)) {// object is not of correct type
-        SWIG_SetErrorMsg(PyExc_TypeError, "object is of incorrect type.");
-        m_current_ptr=nullptr;
-        throw Bad_element_type();
-        return;
-      }
-      m_current_ptr=reinterpret_cast<Cpp_wrapper*> (ret);
+  static const Cpp_wrapper& to_wrapper(PyObject* item, swig_type_info* type)
+  {
+    void* ret=0;
+    int res = SWIG_ConvertPtr(item, &ret, type,  0  | 0);
+    if (!SWIG_IsOK(res)) {// object is not of correct type
+      SWIG_SetErrorMsg(PyExc_TypeError, "object is of incorrect type.");
+      throw Bad_element_type();
     }
-    else
-      m_current_ptr=nullptr;
+    return *reinterpret_cast<Cpp_wrapper*> (ret);
   }
-  
-  PyObject* m_iterator;
-  PyObject* m_item; //m_item must stay valid so that m_current_ptr is
-  Cpp_wrapper* m_current_ptr;
-  swig_type_info* m_type;
-  
-  
-public:
-  Input_iterator_wrapper():m_iterator(nullptr),m_item(nullptr),m_current_ptr(nullptr){}
-  Input_iterator_wrapper(const Input_iterator_wrapper& other)
-    :m_iterator(other.m_iterator),m_item(other.m_item),m_current_ptr(other.m_current_ptr),m_type(other.m_type)
+
+  void push_back(PyObject* item, swig_type_info* type)
   {
-    if (m_iterator!=nullptr){ Py_INCREF(m_iterator); }
-    if (m_item!=nullptr) { Py_INCREF(m_item);  }
+    m_storage->push_back( internal::Converter<Cpp_wrapper>::convert(to_wrapper(item, type)) );
   }
+
+  // position, the end of the range of other for the end iterator
+  std::ptrdiff_t position(const Input_iterator_wrapper& other) const
+  {
+    if (m_storage) return std::ptrdiff_t(m_index);
+    return other.m_storage ? std::ptrdiff_t(other.m_storage->size()) : 0;
+  }
+
+  boost::shared_ptr<Storage> m_storage;
+  std::size_t m_index;
+
+public:
+  Input_iterator_wrapper():m_index(0){}
   Input_iterator_wrapper(PyObject * container,swig_type_info* tinfo)
-    :m_iterator(nullptr),m_item(nullptr),m_type(tinfo)
+    :m_storage(new Storage()),m_index(0)
   {
-    m_iterator=PyObject_GetIter(container);
-    
+    SWIG_CGAL::Conversion_timer timer(true);
+    if (PyList_Check(container) || PyTuple_Check(container)){
+      const Py_ssize_t size = PySequence_Fast_GET_SIZE(container);
+      PyObject** items = PySequence_Fast_ITEMS(container);
+      m_storage->reserve(std::size_t(size));
+      for (Py_ssize_t i=0; i<size; ++i)
+        push_back(items[i], tinfo);
+      return;
+    }
+
+    PyObject* iterator=PyObject_GetIter(container);
     //only for function with overload !!!
-    if (!(PyIter_Check(m_iterator)) ){
+    if (iterator==nullptr || !(PyIter_Check(iterator)) ){
       SWIG_SetErrorMsg(PyExc_TypeError, "Not an iterator.");
-      if (m_iterator!=nullptr) {Py_DECREF(m_iterator); m_iterator=nullptr;}
+      if (iterator!=nullptr) {Py_DECREF(iterator);}
       throw Not_an_iterator();
     }
-    update_with_next_point();
-  }
-  ~Input_iterator_wrapper(){
-    if (m_iterator!=nullptr){ Py_DECREF(m_iterator); }
-    if (m_item!=nullptr) { Py_DECREF(m_item);  }
+    const Py_ssize_t hint = PyObject_LengthHint(container, 0);
+    if (hint > 0) m_storage->reserve(std::size_t(hint));
+    else if (hint < 0) PyErr_Clear();
+    while (PyObject* item = PyIter_Next(iterator)){
+      try{
+        push_back(item, tinfo);
+      }
+      catch(...){
+        Py_DECREF(item);
+        Py_DECREF(iterator);
+        throw;
+      }
+      Py_DECREF(item);
+    }
+    Py_DECREF(iterator);
+    if (PyErr_Occurred()) // raised by the iterator
+      throw Bad_element_type();
   }
-  Input_iterator_wrapper&  operator=(const Input_iterator_wrapper& other){
-    //cleanup
-    if (m_iterator!=nullptr){ Py_DECREF(m_iterator); }
-    if (m_item!=nullptr) { Py_DECREF(m_item);  }
-    //copy
-    m_iterator=other.m_iterator;
-    m_item=other.m_item;
-    m_current_ptr=other.m_current_ptr;
-    m_type=other.m_type;
-    if (m_iterator!=nullptr){ Py_INCREF(m_iterator); }
-    if (m_item!=nullptr) { Py_INCREF(m_item);  }
-    return *this;
+
+  void increment(){ ++m_index; }
+  void decrement(){ --m_index; }
+  void advance(std::ptrdiff_t n){ m_index = std::size_t(std::ptrdiff_t(m_index) + n); }
+  std::ptrdiff_t distance_to(const Input_iterator_wrapper& other) const
+  {
+    return other.position(*this) - position(other);
   }
-  
-  void increment(){update_with_next_point();}
-  bool equal(const Input_iterator_wrapper & other) const{ return m_current_ptr==other.m_current_ptr; }
+  bool equal(const Input_iterator_wrapper & other) const{ return distance_to(other)==0; }
 
   typename boost::mpl::if_<
         boost::mpl::bool_<internal::Converter<Cpp_wrapper>::is_reference>, 
         Cpp_base&, Cpp_base
       >::type
     dereference() const { 
-      return internal::Converter<Cpp_wrapper>::convert(*m_current_ptr);
+      return (*m_storage)[m_index];
     }
 };
 
@@ -9,6 +9,7 @@
 
 #include <boost/iterator/function_output_iterator.hpp>
 #include <SWIG_CGAL/Python/exceptions.h>
+#include <SWIG_CGAL/Kernel/Profiling.h>
 
 template<class Cpp_wrapper,class Cpp_base>
 class Container_writer{
@@ -29,6 +30,7 @@ public:
   }
  
   void operator()(const Cpp_base& new_base) {
+    SWIG_CGAL::Conversion_timer timer;
     Cpp_base* result = new Cpp_base(new_base);
     PyObject* py_object= SWIG_NewPointerObj(SWIG_as_voidptr(result), type, 1);
     assert(py_object!=nullptr);
@@ -55,7 +57,7 @@ public:
   }
  
   void operator()(int new_base) {
-    
+    SWIG_CGAL::Conversion_timer timer;
     PyObject* py_object=PyInt_FromLong(new_base);
     assert(py_object!=nullptr);
     PyList_Append(list,py_object);
@@ -3,6 +3,12 @@
 // SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
 // ------------------------------------------------------------------------------
 
+// outside of the guard: the file may have been processed by an %import
+// (which ignores the code blocks) before being included
+%{
+#include <SWIG_CGAL/Python/Buffer.h>
+%}
+
 #ifndef SWIG_CGAL_PYTHON_TYPEMAPS_I
 #define SWIG_CGAL_PYTHON_TYPEMAPS_I
 
@@ -39,15 +45,20 @@
           PyErr_SetString(PyExc_ValueError,"Expecting a sequence");
           return nullptr;
   }
-  int length=PySequence_Length($input);
-  res->reserve(length);
-  for (int i=0; i<length; i += 3){
+  PyObject* seq = PySequence_Fast($input, "Expecting a sequence");
+  if (seq == nullptr)
+    return nullptr;
+  Py_ssize_t length=PySequence_Fast_GET_SIZE(seq);
+  PyObject** items=PySequence_Fast_ITEMS(seq); //borrowed references
+  res->reserve(length / 3);
+  for (Py_ssize_t i=0; i+2<length; i += 3){
     res->push_back(EPIC_Kernel::Point_3
-                   (PyFloat_AsDouble(PySequence_GetItem($input,i)),
-                     PyFloat_AsDouble(PySequence_GetItem($input,i+1)),
-                     PyFloat_AsDouble(PySequence_GetItem($input,i+2))
+                   (PyFloat_AsDouble(items[i]),
+                     PyFloat_AsDouble(items[i+1]),
+                     PyFloat_AsDouble(items[i+2])
                      ));
   }
+  Py_DECREF(seq);
   $1=res;
 }
 %enddef
@@ -154,6 +165,35 @@
 }
 %enddef
 
+//IN typemap for vector of string from a sequence of string
+%define SWIG_CGAL_array_of_string_to_vector_of_string_typemap_in
+%typemap(in) boost::shared_ptr<std::vector< std::string > > {
+  boost::shared_ptr<std::vector< std::string > > res(new std::vector<std::string>());
+  if (!PySequence_Check($input) || PyUnicode_Check($input)) {
+          PyErr_SetString(PyExc_ValueError,"Expecting a sequence of str");
+          return nullptr;
+  }
+  int length=PySequence_Length($input);
+  res->reserve(length);
+  for (int i=0; i<length;++i){
+    PyObject *o = PySequence_GetItem($input,i);
+    const char* str = (o != nullptr && PyUnicode_Check(o)) ? PyUnicode_AsUTF8(o) : nullptr;
+    if (str == nullptr)
+    {
+       Py_XDECREF(o);
+       PyErr_SetString(PyExc_ValueError,"Expecting a sequence of str");
+       return nullptr;
+    }
+    res->push_back(str);
+    Py_DECREF(o);
+  }
+  $1=res;
+}
+%typemap(typecheck,precedence=SWIG_TYPECHECK_STRING_ARRAY) boost::shared_ptr<std::vector< std::string > > {
+  $1 = (PySequence_Check($input) && !PyUnicode_Check($input)) ? 1 : 0;
+}
+%enddef
+
 %define SWIG_CGAL_python_vector_of_int_typecheck
 %typemap(typecheck,precedence=0) boost::shared_ptr<std::vector< int > > {
   if (PySequence_Check($input) && PySequence_Length($input)!=0)
@@ -173,4 +213,60 @@
 }
 %enddef
 
+//OUT typemap for a SWIG_CGAL::Buffer to a memoryview (buffer protocol, no copy)
+%define SWIG_CGAL_buffer_typemap_out_advanced(TYPE,JAVA_BUFFER)
+%typemap(out) SWIG_CGAL::Buffer< TYPE > {
+  $result = SWIG_CGAL::buffer_to_python(static_cast<const SWIG_CGAL::Buffer< TYPE >&>($1));
+  if ($result == nullptr) SWIG_fail;
+}
+%enddef
+%define SWIG_CGAL_buffer_of_double_typemap_out
+SWIG_CGAL_buffer_typemap_out_advanced(double,DoubleBuffer)
+%enddef
+%define SWIG_CGAL_buffer_of_float_typemap_out
+SWIG_CGAL_buffer_typemap_out_advanced(float,FloatBuffer)
+%enddef
+%define SWIG_CGAL_buffer_of_int_typemap_out
+SWIG_CGAL_buffer_typemap_out_advanced(int,IntBuffer)
+%enddef
+%define SWIG_CGAL_buffer_of_long_long_typemap_out
+SWIG_CGAL_buffer_typemap_out_advanced(long long,LongBuffer)
+%enddef
+%define SWIG_CGAL_buffer_of_signed_char_typemap_out
+SWIG_CGAL_buffer_typemap_out_advanced(signed char,ByteBuffer)
+%enddef
+%define SWIG_CGAL_buffer_of_unsigned_char_typemap_out
+SWIG_CGAL_buffer_typemap_out_advanced(unsigned char,ByteBuffer)
+%enddef
+%define SWIG_CGAL_buffer_of_unsigned_short_typemap_out
+SWIG_CGAL_buffer_typemap_out_advanced(unsigned short,ShortBuffer)
+%enddef
+
+//IN typemap for a SWIG_CGAL::Buffer from any C-contiguous object implementing
+//the buffer protocol (numpy.ndarray, array.array, memoryview...), no copy
+%define SWIG_CGAL_buffer_typemap_in_advanced(TYPE,JAVA_BUFFER)
+%typemap(in) SWIG_CGAL::Buffer< TYPE > (SWIG_CGAL::Python_buffer_guard guard) {
+  $1 = SWIG_CGAL::python_to_buffer< TYPE >($input, guard);
+  if (PyErr_Occurred()) SWIG_fail;
+}
+%typemap(typecheck,precedence=SWIG_TYPECHECK_POINTER) SWIG_CGAL::Buffer< TYPE > {
+  $1 = SWIG_CGAL::python_buffer_check< TYPE >($input) ? 1 : 0;
+}
+%enddef
+%define SWIG_CGAL_buffer_of_double_typemap_in
+SWIG_CGAL_buffer_typemap_in_advanced(double,DoubleBuffer)
+%enddef
+%define SWIG_CGAL_buffer_of_float_typemap_in
+SWIG_CGAL_buffer_typemap_in_advanced(float,FloatBuffer)
+%enddef
+%define SWIG_CGAL_buffer_of_int_typemap_in
+SWIG_CGAL_buffer_typemap_in_advanced(int,IntBuffer)
+%enddef
+%define SWIG_CGAL_buffer_of_unsigned_char_typemap_in
+SWIG_CGAL_buffer_typemap_in_advanced(unsigned char,ByteBuffer)
+%enddef
+%define SWIG_CGAL_buffer_of_unsigned_short_typemap_in
+SWIG_CGAL_buffer_typemap_in_advanced(unsigned short,ShortBuffer)
+%enddef
+
 #endif // SWIG_CGAL_PYTHON_TYPEMAPS_I
@@ -17,13 +17,21 @@ SWIG_CGAL_package_common()
 %import  "SWIG_CGAL/Common/Macros.h"
 %import  "SWIG_CGAL/Kernel/CGAL_Kernel.i"
 %import  "SWIG_CGAL/Point_set_3/CGAL_Point_set_3.i"
+%import  "SWIG_CGAL/Point_set_processing_3/CGAL_Point_set_processing_3.i"
 %include "SWIG_CGAL/Common/Iterator.h"
+//typemaps for the export of the detected shapes to arrays
+%include "SWIG_CGAL/typemaps.i"
+SWIG_CGAL_buffer_of_double_typemap_in
+SWIG_CGAL_buffer_of_double_typemap_out
+SWIG_CGAL_buffer_of_int_typemap_out
 
 %pragma(java) jniclassimports=%{
 import CGAL.Kernel.Point_3;
 import CGAL.Kernel.Vector_3;
 import CGAL.Point_set_3.Point_set_3;
 import CGAL.Point_set_3.Point_set_3_Int_map;
+import CGAL.Point_set_processing_3.Neighborhood_cache;
+import CGAL.Polyhedron_3.Polyhedron_3;
 import java.util.Iterator;
 import java.util.Collection;
 %}
@@ -33,6 +41,8 @@ import CGAL.Kernel.Point_3;
 import CGAL.Kernel.Vector_3;
 import CGAL.Point_set_3.Point_set_3;
 import CGAL.Point_set_3.Point_set_3_Int_map;
+import CGAL.Point_set_processing_3.Neighborhood_cache;
+import CGAL.Polyhedron_3.Polyhedron_3;
 import java.util.Iterator;
 import java.util.Collection;
 %};
@@ -40,10 +50,35 @@ import java.util.Collection;
 %types(Point_3*,Point_3);//needed so that the identifier SWIGTYPE_p_Point_3 is generated
 %types(Vector_3*,Vector_3);//needed so that the identifier SWIGTYPE_p_Vector_3 is generated
 
+%typemap(javaimports) Region_growing_neighbor_query %{import CGAL.Point_set_3.Point_set_3;
+import CGAL.Point_set_processing_3.Neighborhood_cache;%}
+%typemap(javaimports) Efficient_RANSAC_detector %{import CGAL.Point_set_3.Point_set_3;%}
 %include "SWIG_CGAL/Shape_detection/impl.h"
+%include "SWIG_CGAL/Shape_detection/Ransac_arrays.h"
+%include "SWIG_CGAL/Shape_detection/Region_growing_arrays.h"
 
 %{
+  #include <SWIG_CGAL/Polyhedron_3/all_includes.h>
   #include <SWIG_CGAL/Shape_detection/impl.h>
+  #include <SWIG_CGAL/Shape_detection/Ransac_arrays.h>
+  #include <SWIG_CGAL/Shape_detection/Region_growing_arrays.h>
+%}
+
+//import definitions of Polyhedron objects
+%import "SWIG_CGAL/Polyhedron_3/CGAL_Polyhedron_3.i"
+SWIG_CGAL_import_Polyhedron_3_SWIG_wrapper
+
+%inline %{
+  // planar segmentation of the facets of the polyhedron (ids in facet
+  // iteration order), see Region_growing_arrays.h
+  Region_growing_regions
+  region_growing_on_polyhedron (const Polyhedron_3_SWIG_wrapper& polyhedron,
+                                int min_faces = 1,
+                                double epsilon = -1,
+                                double normal_treshold = 0.9)
+  {
+    return SWIG_Shape_detection::detect_planes_on_mesh (polyhedron.get_data(), min_faces, epsilon, normal_treshold);
+  }
 %}
 
 #ifdef SWIG_CGAL_HAS_Shape_detection_USER_PACKAGE
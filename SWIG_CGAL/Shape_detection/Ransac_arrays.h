@@ -0,0 +1,394 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+#ifndef SWIG_CGAL_SHAPE_DETECTION_RANSAC_ARRAYS_H
+#define SWIG_CGAL_SHAPE_DETECTION_RANSAC_ARRAYS_H
+
+#include <SWIG_CGAL/Common/Buffer.h>
+#include <SWIG_CGAL/Common/Gil_release.h>
+#include <SWIG_CGAL/Point_set_3/Point_set_3.h>
+
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#ifndef SWIG
+#include <CGAL/Shape_detection/Efficient_RANSAC.h>
+#include <CGAL/property_map.h>
+#include <CGAL/for_each.h>
+#include <CGAL/tags.h>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <map>
+#include <mutex>
+#include <utility>
+#endif
+
+enum Ransac_shape_type { RANSAC_PLANE=0, RANSAC_SPHERE, RANSAC_CYLINDER, RANSAC_CONE, RANSAC_TORUS };
+
+// Result of efficient_RANSAC_arrays(). Row s of shape_type_array() is the
+// Ransac_shape_type of the s-th shape and row s of shape_parameter_array()
+// its parameters, padded with 0:
+//   plane:    normal (3), d (nx*x + ny*y + nz*z + d = 0)
+//   sphere:   center (3), radius
+//   cylinder: point of the axis (3), unit direction of the axis (3), radius
+//   cone:     apex (3), unit direction of the axis (3), half opening angle
+//   torus:    center (3), unit direction of the axis (3), major radius, minor radius
+// Row i of shape_id_array() is the shape of the i-th point of the point set
+// (in the order of its indices), -1 for the unassigned points.
+class Ransac_shapes
+{
+  std::shared_ptr<std::vector<int> >    types_sptr;
+  std::shared_ptr<std::vector<double> > parameters_sptr;
+  std::shared_ptr<std::vector<int> >    shape_ids_sptr;
+
+public:
+  Ransac_shapes()
+    : types_sptr(new std::vector<int>())
+    , parameters_sptr(new std::vector<double>())
+    , shape_ids_sptr(new std::vector<int>()) {}
+
+  #ifndef SWIG
+  static const int parameters_per_shape = 8;
+
+  std::vector<int>& types() { return *types_sptr; }
+  std::vector<double>& parameters() { return *parameters_sptr; }
+  std::vector<int>& shape_ids() { return *shape_ids_sptr; }
+  #endif
+
+  int number_of_shapes() const { return int(types_sptr->size()); }
+  int number_of_points() const { return int(shape_ids_sptr->size()); }
+
+  // (number_of_shapes(), 1)
+  SWIG_CGAL::Buffer<int> shape_type_array() const
+  {
+    return SWIG_CGAL::Buffer<int>(types_sptr->data(), types_sptr->size(), 1,
+                                  types_sptr, true);
+  }
+  // (number_of_shapes(), 8)
+  SWIG_CGAL::Buffer<double> shape_parameter_array() const
+  {
+    return SWIG_CGAL::Buffer<double>(parameters_sptr->data(), parameters_sptr->size() / parameters_per_shape,
+                                     parameters_per_shape, parameters_sptr, true);
+  }
+  // (number_of_points(), 1)
+  SWIG_CGAL::Buffer<int> shape_id_array() const
+  {
+    return SWIG_CGAL::Buffer<int>(shape_ids_sptr->data(), shape_ids_sptr->size(), 1,
+                                  shape_ids_sptr, true);
+  }
+};
+
+#ifndef SWIG
+namespace SWIG_Shape_detection {
+namespace internal {
+
+typedef std::pair<EPIC_Kernel::Point_3, EPIC_Kernel::Vector_3>                  Point_with_normal;
+typedef std::vector<Point_with_normal>                                          Pwn_vector;
+typedef CGAL::Shape_detection::Efficient_RANSAC_traits
+  <EPIC_Kernel, Pwn_vector,
+   CGAL::First_of_pair_property_map<Point_with_normal>,
+   CGAL::Second_of_pair_property_map<Point_with_normal> >                       Ransac_traits;
+typedef CGAL::Shape_detection::Efficient_RANSAC<Ransac_traits>                  Efficient_ransac;
+
+// the type and the parameters of a detected shape, see Ransac_shapes
+inline int shape_parameters(const Efficient_ransac::Shape& shape, double* out)
+{
+  typedef EPIC_Kernel::Vector_3 Vector;
+  const auto unit = [](const Vector& v) { return v / std::sqrt(v.squared_length()); };
+  if (const auto* plane = dynamic_cast<const CGAL::Shape_detection::Plane<Ransac_traits>*>(&shape))
+  {
+    const Vector n = plane->plane_normal();
+    out[0] = n.x(); out[1] = n.y(); out[2] = n.z(); out[3] = plane->d();
+    return RANSAC_PLANE;
+  }
+  if (const auto* sphere = dynamic_cast<const CGAL::Shape_detection::Sphere<Ransac_traits>*>(&shape))
+  {
+    const EPIC_Kernel::Point_3 c = sphere->center();
+    out[0] = c.x(); out[1] = c.y(); out[2] = c.z(); out[3] = sphere->radius();
+    return RANSAC_SPHERE;
+  }
+  if (const auto* cylinder = dynamic_cast<const CGAL::Shape_detection::Cylinder<Ransac_traits>*>(&shape))
+  {
+    const EPIC_Kernel::Line_3 axis = cylinder->axis();
+    const EPIC_Kernel::Point_3 p = axis.point(0);
+    const Vector d = unit(axis.to_vector());
+    out[0] = p.x(); out[1] = p.y(); out[2] = p.z();
+    out[3] = d.x(); out[4] = d.y(); out[5] = d.z(); out[6] = cylinder->radius();
+    return RANSAC_CYLINDER;
+  }
+  if (const auto* cone = dynamic_cast<const CGAL::Shape_detection::Cone<Ransac_traits>*>(&shape))
+  {
+    const EPIC_Kernel::Point_3 a = cone->apex();
+    const Vector d = unit(cone->axis());
+    out[0] = a.x(); out[1] = a.y(); out[2] = a.z();
+    out[3] = d.x(); out[4] = d.y(); out[5] = d.z(); out[6] = cone->angle();
+    return RANSAC_CONE;
+  }
+  const auto& torus = dynamic_cast<const CGAL::Shape_detection::Torus<Ransac_traits>&>(shape);
+  const EPIC_Kernel::Point_3 c = torus.center();
+  const Vector d = unit(torus.axis());
+  out[0] = c.x(); out[1] = c.y(); out[2] = c.z();
+  out[3] = d.x(); out[4] = d.y(); out[5] = d.z();
+  out[6] = torus.major_radius(); out[7] = torus.minor_radius();
+  return RANSAC_TORUS;
+}
+
+// the shapes detected in a set of points, and for each of its points the
+// index of its shape in them (-1 if unassigned)
+struct Tile_shapes
+{
+  std::vector<int>    types;
+  std::vector<double> parameters;
+  std::vector<int>    shape_ids;
+};
+
+inline void add_shape_factories (Efficient_ransac& ransac, bool planes, bool cones, bool cylinders,
+                                 bool spheres, bool tori)
+{
+  if (planes)
+    ransac.add_shape_factory<CGAL::Shape_detection::Plane<Ransac_traits> >();
+  if (cones)
+    ransac.add_shape_factory<CGAL::Shape_detection::Cone<Ransac_traits> >();
+  if (cylinders)
+    ransac.add_shape_factory<CGAL::Shape_detection::Cylinder<Ransac_traits> >();
+  if (spheres)
+    ransac.add_shape_factory<CGAL::Shape_detection::Sphere<Ransac_traits> >();
+  if (tori)
+    ransac.add_shape_factory<CGAL::Shape_detection::Torus<Ransac_traits> >();
+}
+
+// the parameters of a detection, epsilon and cluster_epsilon being 1% of
+// bbox_diagonal if -1
+inline Efficient_ransac::Parameters ransac_parameters (int min_points, double epsilon, double cluster_epsilon,
+                                                       double normal_threshold, double probability,
+                                                       double bbox_diagonal)
+{
+  Efficient_ransac::Parameters parameters;
+  parameters.probability = probability;
+  parameters.min_points = min_points;
+  parameters.epsilon = (epsilon == -1 ? 0.01 * bbox_diagonal : epsilon);
+  parameters.cluster_epsilon = (cluster_epsilon == -1 ? 0.01 * bbox_diagonal : cluster_epsilon);
+  parameters.normal_threshold = normal_threshold;
+  return parameters;
+}
+
+// the shapes detected by ransac on nb_points points
+inline void collect_shapes (const Efficient_ransac& ransac, std::size_t nb_points, Tile_shapes& out)
+{
+  out.shape_ids.assign (nb_points, -1);
+  for (auto shape : ransac.shapes())
+  {
+    double shape_parameters_row[Ransac_shapes::parameters_per_shape] = { 0, 0, 0, 0, 0, 0, 0, 0 };
+    out.types.push_back (shape_parameters (*shape, shape_parameters_row));
+    out.parameters.insert (out.parameters.end(), shape_parameters_row,
+                           shape_parameters_row + Ransac_shapes::parameters_per_shape);
+    for (std::size_t idx : shape->indices_of_assigned_points())
+      out.shape_ids[idx] = int(out.types.size()) - 1;
+  }
+}
+
+// the points of a point set with their normals, added to bbox
+inline Pwn_vector points_with_normals (const CGAL_PS3& ps, CGAL::Bbox_3& bbox)
+{
+  if (!ps.has_normal_map())
+    throw std::invalid_argument("The point set must have normals");
+  Pwn_vector points;
+  points.reserve (ps.size());
+  for (CGAL_PS3::const_iterator it = ps.begin(); it != ps.end(); ++ it)
+  {
+    points.push_back (Point_with_normal (ps.point(*it), ps.normal(*it)));
+    bbox += points.back().first.bbox();
+  }
+  return points;
+}
+
+inline double diagonal (const CGAL::Bbox_3& bbox)
+{
+  if (bbox.xmin() > bbox.xmax())
+    return 0;
+  return std::sqrt((bbox.xmax() - bbox.xmin()) * (bbox.xmax() - bbox.xmin())
+                   + (bbox.ymax() - bbox.ymin()) * (bbox.ymax() - bbox.ymin())
+                   + (bbox.zmax() - bbox.zmin()) * (bbox.zmax() - bbox.zmin()));
+}
+
+} //namespace internal
+} //namespace SWIG_Shape_detection
+#endif
+
+// Efficient RANSAC detecting in a single run all the selected kinds of shapes,
+// the results being returned as arrays (see Ransac_shapes). The point set
+// must have normals; epsilon and cluster_epsilon default to 1% of the
+// diagonal of its bounding box.
+// If tile_size > 0, the bounding box is cut into cubes of side tile_size and
+// the points of each cube are processed by an independent RANSAC, the cubes
+// being processed in parallel when linked with TBB: a shape crossing several
+// cubes is then detected once per cube. The pieces of a shape can be merged
+// afterwards using their parameters.
+// The points are copied, and the detection runs without the GIL.
+inline Ransac_shapes
+efficient_RANSAC_arrays (Point_set_3_wrapper<CGAL_PS3> point_set,
+                         int min_points = 1,
+                         double epsilon = -1,
+                         double cluster_epsilon = -1,
+                         double normal_threshold = 0.9,
+                         double probability = 0.01,
+                         bool planes = true,
+                         bool cones = false,
+                         bool cylinders = false,
+                         bool spheres = false,
+                         bool tori = false,
+                         double tile_size = 0)
+{
+  using namespace SWIG_Shape_detection::internal;
+
+  CGAL::Bbox_3 bbox;
+  const Pwn_vector points = points_with_normals (point_set.get_data(), bbox);
+
+  SWIG_CGAL::Gil_release gil;
+
+  Ransac_shapes result;
+  result.shape_ids().assign (points.size(), -1);
+  if (points.empty())
+    return result;
+
+  // the positions of the points of each tile, in the order of the tiles
+  std::vector<std::vector<std::size_t> > tiles;
+  if (tile_size > 0)
+  {
+    std::map<std::array<long, 3>, std::vector<std::size_t> > cubes;
+    for (std::size_t i = 0; i < points.size(); ++ i)
+    {
+      const EPIC_Kernel::Point_3& p = points[i].first;
+      const std::array<long, 3> cube = { { long(std::floor ((p.x() - bbox.xmin()) / tile_size)),
+                                           long(std::floor ((p.y() - bbox.ymin()) / tile_size)),
+                                           long(std::floor ((p.z() - bbox.zmin()) / tile_size)) } };
+      cubes[cube].push_back (i);
+    }
+    tiles.reserve (cubes.size());
+    for (auto& cube : cubes)
+      tiles.push_back (std::move (cube.second));
+  }
+  else
+  {
+    tiles.resize (1);
+    tiles[0].resize (points.size());
+    for (std::size_t i = 0; i < points.size(); ++ i)
+      tiles[0][i] = i;
+  }
+
+  const Efficient_ransac::Parameters parameters
+    = ransac_parameters (min_points, epsilon, cluster_epsilon, normal_threshold, probability, diagonal (bbox));
+
+  std::vector<Tile_shapes> tile_shapes (tiles.size());
+  std::vector<std::size_t> tile_ids (tiles.size());
+  for (std::size_t t = 0; t < tiles.size(); ++ t)
+    tile_ids[t] = t;
+
+  CGAL::for_each<SWIG_Point_set_3::Concurrency_tag>
+    (tile_ids, [&](const std::size_t& t) -> bool
+     {
+       const std::vector<std::size_t>& tile = tiles[t];
+       if (tile.size() < std::size_t((std::max)(min_points, 1)))
+         return true;
+       Pwn_vector tile_points;
+       tile_points.reserve (tile.size());
+       for (std::size_t i : tile)
+         tile_points.push_back (points[i]);
+
+       Efficient_ransac ransac;
+       ransac.set_input (tile_points);
+       add_shape_factories (ransac, planes, cones, cylinders, spheres, tori);
+       ransac.detect (parameters);
+       collect_shapes (ransac, tile.size(), tile_shapes[t]);
+       return true;
+     });
+
+  for (std::size_t t = 0; t < tiles.size(); ++ t)
+  {
+    const Tile_shapes& shapes = tile_shapes[t];
+    const int offset = result.number_of_shapes();
+    result.types().insert (result.types().end(), shapes.types.begin(), shapes.types.end());
+    result.parameters().insert (result.parameters().end(), shapes.parameters.begin(), shapes.parameters.end());
+    for (std::size_t j = 0; j < shapes.shape_ids.size(); ++ j)
+      if (shapes.shape_ids[j] != -1)
+        result.shape_ids()[tiles[t][j]] = offset + shapes.shape_ids[j];
+  }
+
+  return result;
+}
+
+// Efficient RANSAC whose octrees are built once, when constructed, for
+// detections with different parameters on the same points (for example a
+// sweep of epsilon): each detect() only runs the detection, with the
+// parameters and the results of efficient_RANSAC_arrays() (without tiles).
+// The points are copied, and the kinds of shapes are selected when
+// constructed. The copies share the detector, and their detections run one
+// at a time.
+class Efficient_RANSAC_detector
+{
+#ifndef SWIG
+  struct Data
+  {
+    SWIG_Shape_detection::internal::Pwn_vector points;
+    SWIG_Shape_detection::internal::Efficient_ransac ransac;
+    double bbox_diagonal;
+    std::mutex mutex;
+  };
+#endif
+  std::shared_ptr<Data> data_sptr;
+
+public:
+  Efficient_RANSAC_detector (Point_set_3_wrapper<CGAL_PS3> point_set,
+                             bool planes = true,
+                             bool cones = false,
+                             bool cylinders = false,
+                             bool spheres = false,
+                             bool tori = false)
+    : data_sptr (new Data())
+  {
+    using namespace SWIG_Shape_detection::internal;
+    CGAL::Bbox_3 bbox;
+    data_sptr->points = points_with_normals (point_set.get_data(), bbox);
+    data_sptr->bbox_diagonal = diagonal (bbox);
+
+    SWIG_CGAL::Gil_release gil;
+    Efficient_ransac& ransac = data_sptr->ransac;
+    ransac.set_input (data_sptr->points);
+    add_shape_factories (ransac, planes, cones, cylinders, spheres, tori);
+    if (!data_sptr->points.empty())
+      ransac.preprocess();
+  }
+
+  int number_of_points() const { return int(data_sptr->points.size()); }
+
+  Ransac_shapes detect (int min_points = 1,
+                        double epsilon = -1,
+                        double cluster_epsilon = -1,
+                        double normal_threshold = 0.9,
+                        double probability = 0.01)
+  {
+    using namespace SWIG_Shape_detection::internal;
+    SWIG_CGAL::Gil_release gil;
+
+    Ransac_shapes result;
+    result.shape_ids().assign (data_sptr->points.size(), -1);
+    if (data_sptr->points.empty())
+      return result;
+    std::lock_guard<std::mutex> lock (data_sptr->mutex);
+    Efficient_ransac& ransac = data_sptr->ransac;
+    ransac.detect (ransac_parameters (min_points, epsilon, cluster_epsilon, normal_threshold, probability,
+                                      data_sptr->bbox_diagonal));
+    Tile_shapes shapes;
+    collect_shapes (ransac, data_sptr->points.size(), shapes);
+    result.types() = std::move (shapes.types);
+    result.parameters() = std::move (shapes.parameters);
+    result.shape_ids() = std::move (shapes.shape_ids);
+    return result;
+  }
+};
+
+#endif // SWIG_CGAL_SHAPE_DETECTION_RANSAC_ARRAYS_H
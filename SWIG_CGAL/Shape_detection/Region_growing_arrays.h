@@ -0,0 +1,478 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+#ifndef SWIG_CGAL_SHAPE_DETECTION_REGION_GROWING_ARRAYS_H
+#define SWIG_CGAL_SHAPE_DETECTION_REGION_GROWING_ARRAYS_H
+
+#include <SWIG_CGAL/Common/Buffer.h>
+#include <SWIG_CGAL/Common/Gil_release.h>
+#include <SWIG_CGAL/Shape_detection/impl.h>
+
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#ifndef SWIG
+#include <SWIG_CGAL/Common/Spatial_insertion.h>
+#include <CGAL/Shape_detection/Region_growing/Polygon_mesh.h>
+#include <CGAL/Unique_hash_map.h>
+#include <CGAL/boost/graph/graph_traits_Polyhedron_3.h>
+#include <CGAL/centroid.h>
+#include <CGAL/linear_least_squares_fitting_3.h>
+#include <CGAL/property_map.h>
+#include <CGAL/for_each.h>
+#include <array>
+#include <cmath>
+#include <map>
+#include <numeric>
+#include <utility>
+#endif
+
+// Result of the region growing functions returning arrays: row i of
+// region_id_array() is the region of the i-th item (point or facet, in the
+// order of the input), -1 if unassigned, and row r of primitive_array() the
+// primitive fitted to region r: (a,b,c,d) of the plane ax+by+cz+d=0, or
+// (a,b,c) of the line ax+by+c=0, with (a,b,c) (resp. (a,b)) of unit length.
+class Region_growing_regions
+{
+  std::shared_ptr<std::vector<int> >    region_ids_sptr;
+  std::shared_ptr<std::vector<double> > primitives_sptr;
+  std::size_t m_primitive_size;
+
+public:
+  Region_growing_regions()
+    : region_ids_sptr(new std::vector<int>())
+    , primitives_sptr(new std::vector<double>())
+    , m_primitive_size(4) {}
+
+  #ifndef SWIG
+  explicit Region_growing_regions(std::size_t primitive_size)
+    : Region_growing_regions()
+  { m_primitive_size = primitive_size; }
+
+  std::vector<int>& region_ids() { return *region_ids_sptr; }
+  std::vector<double>& primitives() { return *primitives_sptr; }
+  #endif
+
+  int number_of_regions() const { return int(primitives_sptr->size() / m_primitive_size); }
+  int number_of_items() const { return int(region_ids_sptr->size()); }
+
+  // (number_of_items(), 1)
+  SWIG_CGAL::Buffer<int> region_id_array() const
+  {
+    return SWIG_CGAL::Buffer<int>(region_ids_sptr->data(), region_ids_sptr->size(), 1,
+                                  region_ids_sptr, true);
+  }
+  // (number_of_regions(), 4) for planes, (number_of_regions(), 3) for lines
+  SWIG_CGAL::Buffer<double> primitive_array() const
+  {
+    return SWIG_CGAL::Buffer<double>(primitives_sptr->data(), primitives_sptr->size() / m_primitive_size,
+                                     m_primitive_size, primitives_sptr, true);
+  }
+};
+
+#ifndef SWIG
+namespace SWIG_Shape_detection {
+namespace internal {
+
+inline void push_plane (const EPIC_Kernel::Plane_3& plane, std::vector<double>& out)
+{
+  const double norm = std::sqrt (plane.orthogonal_vector().squared_length());
+  out.push_back (plane.a() / norm);
+  out.push_back (plane.b() / norm);
+  out.push_back (plane.c() / norm);
+  out.push_back (plane.d() / norm);
+}
+
+inline int find_root (std::vector<int>& parents, int i)
+{
+  while (parents[i] != i)
+    i = parents[i] = parents[parents[i]];
+  return i;
+}
+
+} // namespace internal
+
+// Planar segmentation of a polygon mesh with the region growing of CGAL on
+// the adjacency of its faces (Polygon_mesh::One_ring_neighbor_query and
+// Least_squares_plane_fit_region); epsilon defaults to 1% of the diagonal of
+// the bounding box of the mesh.
+template <class PolygonMesh>
+Region_growing_regions
+detect_planes_on_mesh (const PolygonMesh& mesh,
+                       int min_faces,
+                       double epsilon,
+                       double normal_treshold)
+{
+#if CGAL_VERSION_NR >= 1050600900
+  typedef CGAL::Shape_detection::Polygon_mesh::One_ring_neighbor_query<PolygonMesh>             Neighbor_query;
+  typedef CGAL::Shape_detection::Polygon_mesh::Least_squares_plane_fit_region<EPIC_Kernel, PolygonMesh> Region_type;
+  typedef CGAL::Shape_detection::Region_growing<Neighbor_query, Region_type>                    Region_growing;
+  typedef typename Region_type::Item                                                            Item;
+
+  Region_growing_regions result (4);
+  CGAL::Unique_hash_map<Item, int> face_index (-1, num_faces (mesh));
+  int nf = 0;
+  for (Item f : faces (mesh))
+    face_index[f] = nf ++;
+  result.region_ids().assign (std::size_t(nf), -1);
+  if (nf == 0)
+    return result;
+
+  if (epsilon == -1)
+  {
+    CGAL::Bbox_3 bbox;
+    for (auto v : vertices (mesh))
+      bbox += get (CGAL::vertex_point, mesh, v).bbox();
+    epsilon = 0.01 * std::sqrt ((bbox.xmax() - bbox.xmin()) * (bbox.xmax() - bbox.xmin())
+                                + (bbox.ymax() - bbox.ymin()) * (bbox.ymax() - bbox.ymin())
+                                + (bbox.zmax() - bbox.zmin()) * (bbox.zmax() - bbox.zmin()));
+  }
+
+  SWIG_CGAL::Gil_release gil;
+  double angle = 180 * std::acos (normal_treshold) / CGAL_PI;
+  Neighbor_query neighbor_query (mesh);
+  Region_type region_type (mesh, CGAL::parameters::maximum_distance (epsilon).
+                                 maximum_angle (angle).
+                                 minimum_region_size (min_faces));
+  const auto face_range = faces (mesh);
+  Region_growing region_growing (face_range, neighbor_query, region_type);
+
+  int region = 0;
+  region_growing.detect
+    (boost::make_function_output_iterator
+     ([&](const std::pair<typename Region_type::Primitive, std::vector<Item> >& primitive_and_region)
+      {
+        for (Item f : primitive_and_region.second)
+          result.region_ids()[std::size_t(face_index[f])] = region;
+        internal::push_plane (primitive_and_region.first, result.primitives());
+        ++ region;
+      }));
+  return result;
+#else
+  CGAL_USE (mesh); CGAL_USE (min_faces); CGAL_USE (epsilon); CGAL_USE (normal_treshold);
+  throw std::runtime_error ("The region growing on polygon meshes needs CGAL 5.6 or later");
+#endif
+}
+
+} // namespace SWIG_Shape_detection
+#endif
+
+// Region growing of lines on 2D points given as rows (x,y) with their
+// normals (nx,ny), with the neighbors closer than cluster_epsilon (if k is
+// 0) or the k nearest neighbors; epsilon and cluster_epsilon default to 1%
+// of the diagonal of the bounding box of the points.
+inline Region_growing_regions
+region_growing_lines_2 (SWIG_CGAL::Buffer<double> points,
+                        SWIG_CGAL::Buffer<double> normals,
+                        int min_points = 1,
+                        double epsilon = -1,
+                        double cluster_epsilon = -1,
+                        double normal_treshold = 0.9,
+                        int k = 0)
+{
+#if CGAL_VERSION_NR >= 1050600900
+  typedef std::pair<EPIC_Kernel::Point_2, EPIC_Kernel::Vector_2>                        Point_with_normal;
+  typedef std::vector<Point_with_normal>                                                Input_range;
+  typedef Input_range::const_iterator                                                   Item;
+  typedef CGAL::First_of_pair_property_map<Point_with_normal>                           Point_map;
+  typedef CGAL::Second_of_pair_property_map<Point_with_normal>                          Normal_map;
+  typedef CGAL::Shape_detection::Point_set::Sphere_neighbor_query<EPIC_Kernel, Item, Point_map> Sphere_query;
+  typedef CGAL::Shape_detection::Point_set::K_neighbor_query<EPIC_Kernel, Item, Point_map>      K_query;
+  typedef CGAL::Shape_detection::Point_set::Least_squares_line_fit_region
+    <EPIC_Kernel, Item, Point_map, Normal_map>                                          Region_type;
+
+  const std::size_t n = SWIG_CGAL::number_of_rows (points, 2);
+  if (SWIG_CGAL::number_of_rows (normals, 2) != n)
+    throw std::invalid_argument ("The number of normals must be the number of points");
+  Input_range input;
+  input.reserve (n);
+  const double* p = points.data();
+  const double* v = normals.data();
+  for (std::size_t i = 0; i < n; ++ i)
+    input.push_back (Point_with_normal (EPIC_Kernel::Point_2 (p[2 * i], p[2 * i + 1]),
+                                        EPIC_Kernel::Vector_2 (v[2 * i], v[2 * i + 1])));
+
+  SWIG_CGAL::Gil_release gil;
+  Region_growing_regions result (3);
+  result.region_ids().assign (n, -1);
+  if (n == 0)
+    return result;
+
+  if (epsilon == -1 || cluster_epsilon == -1)
+  {
+    CGAL::Bbox_2 bbox;
+    for (const Point_with_normal& pwn : input)
+      bbox += pwn.first.bbox();
+    const double diagonal = std::sqrt ((bbox.xmax() - bbox.xmin()) * (bbox.xmax() - bbox.xmin())
+                                       + (bbox.ymax() - bbox.ymin()) * (bbox.ymax() - bbox.ymin()));
+    if (epsilon == -1)
+      epsilon = 0.01 * diagonal;
+    if (cluster_epsilon == -1)
+      cluster_epsilon = 0.01 * diagonal;
+  }
+
+  double angle = 180 * std::acos (normal_treshold) / CGAL_PI;
+  Region_type region_type (CGAL::parameters::maximum_distance (epsilon).
+                           maximum_angle (angle).
+                           minimum_region_size (min_points).
+                           point_map (Point_map()).normal_map (Normal_map()));
+
+  int region = 0;
+  const auto output = boost::make_function_output_iterator
+    ([&](const std::pair<typename Region_type::Primitive, std::vector<Item> >& primitive_and_region)
+     {
+       for (Item item : primitive_and_region.second)
+         result.region_ids()[std::size_t(item - input.cbegin())] = region;
+       const EPIC_Kernel::Line_2& line = primitive_and_region.first;
+       const double norm = std::sqrt (line.a() * line.a() + line.b() * line.b());
+       result.primitives().push_back (line.a() / norm);
+       result.primitives().push_back (line.b() / norm);
+       result.primitives().push_back (line.c() / norm);
+       ++ region;
+     });
+  if (k == 0)
+  {
+    Sphere_query neighbor_query (input, CGAL::parameters::sphere_radius (cluster_epsilon).point_map (Point_map()));
+    CGAL::Shape_detection::Region_growing<Sphere_query, Region_type> region_growing (input, neighbor_query, region_type);
+    region_growing.detect (output);
+  }
+  else
+  {
+    K_query neighbor_query (input, CGAL::parameters::k_neighbors (k).point_map (Point_map()));
+    CGAL::Shape_detection::Region_growing<K_query, Region_type> region_growing (input, neighbor_query, region_type);
+    region_growing.detect (output);
+  }
+  return result;
+#else
+  throw std::runtime_error ("The region growing of 2D lines needs CGAL 5.6 or later");
+#endif
+}
+
+// Parallel region growing of planes: the bounding box is cut into cubes of
+// side block_size, the points of each cube are segmented independently (in
+// parallel when linked with TBB, neighbors closer than cluster_epsilon found
+// in a voxel grid), then two regions of different cubes are merged if some
+// of their points are closer than cluster_epsilon and their planes agree
+// (angle within normal_treshold and the centroid of each at distance at most
+// epsilon of the plane of the other). min_points applies to the merged
+// regions. Fills plane_map as region_growing() and returns the number of
+// planes. Runs without the GIL once the points are copied.
+inline int
+region_growing_on_blocks (Point_set_3_wrapper<CGAL_PS3> point_set,
+                          typename Point_set_3_wrapper<CGAL_PS3>::Int_map plane_map,
+                          double block_size,
+                          int min_points = 1,
+                          double epsilon = -1,
+                          double cluster_epsilon = -1,
+                          double normal_treshold = 0.9)
+{
+  typedef EPIC_Kernel::Point_3  Point;
+  typedef EPIC_Kernel::Vector_3 Vector;
+
+  const CGAL_PS3& ps = point_set.get_data();
+  if (!ps.has_normal_map())
+    throw std::invalid_argument ("The point set must have normals");
+  if (!(block_size > 0))
+    throw std::invalid_argument ("The block size must be positive");
+
+  for (int& idx : plane_map.get_data())
+    idx = -1;
+  std::vector<Point> points;
+  std::vector<Vector> normals;
+  points.reserve (ps.size());
+  normals.reserve (ps.size());
+  for (CGAL_PS3::const_iterator it = ps.begin(); it != ps.end(); ++ it)
+  {
+    points.push_back (ps.point (*it));
+    normals.push_back (ps.normal (*it));
+  }
+  std::vector<int> regions (points.size(), -1);
+  int nb_planes = 0;
+  {
+    SWIG_CGAL::Gil_release gil;
+    if (points.empty())
+      return 0;
+
+    CGAL::Bbox_3 bbox;
+    for (const Point& p : points)
+      bbox += p.bbox();
+    const double diagonal = SWIG_Shape_detection::internal::bbox_diagonal (ps);
+    if (epsilon == -1)
+      epsilon = 0.01 * diagonal;
+    if (cluster_epsilon == -1)
+      cluster_epsilon = 0.01 * diagonal;
+
+    // the positions of the points of each block
+    std::vector<std::vector<std::size_t> > blocks;
+    std::vector<std::array<long, 3> > block_coordinates;
+    std::vector<int> block_of_point (points.size());
+    {
+      std::map<std::array<long, 3>, std::vector<std::size_t> > cubes;
+      for (std::size_t i = 0; i < points.size(); ++ i)
+      {
+        const std::array<long, 3> cube = { { long (std::floor ((points[i].x() - bbox.xmin()) / block_size)),
+                                             long (std::floor ((points[i].y() - bbox.ymin()) / block_size)),
+                                             long (std::floor ((points[i].z() - bbox.zmin()) / block_size)) } };
+        cubes[cube].push_back (i);
+      }
+      for (auto& cube : cubes)
+      {
+        for (std::size_t i : cube.second)
+          block_of_point[i] = int (blocks.size());
+        block_coordinates.push_back (cube.first);
+        blocks.push_back (std::move (cube.second));
+      }
+    }
+
+    // independent segmentations of the blocks, all the regions being kept
+    std::vector<std::vector<int> > block_regions (blocks.size());
+    std::vector<int> block_sizes (blocks.size(), 0);
+    std::vector<std::size_t> block_ids (blocks.size());
+    std::iota (block_ids.begin(), block_ids.end(), std::size_t(0));
+    CGAL::for_each<SWIG_Point_set_3::Concurrency_tag>
+      (block_ids, [&](const std::size_t& b) -> bool
+       {
+         CGAL_PS3 block_points (true);
+         block_points.reserve (blocks[b].size());
+         for (std::size_t i : blocks[b])
+           block_points.insert (points[i], normals[i]);
+         Voxel_grid_neighbor_query neighbor_query (block_points, cluster_epsilon);
+         block_regions[b].assign (blocks[b].size(), -1);
+         block_sizes[b] = detect_planes_impl (block_points, 1, epsilon, normal_treshold, neighbor_query,
+                                              [&](std::size_t idx, int region) { block_regions[b][idx] = region; });
+         return true;
+       });
+
+    std::vector<int> offsets (blocks.size() + 1, 0);
+    for (std::size_t b = 0; b < blocks.size(); ++ b)
+      offsets[b + 1] = offsets[b] + block_sizes[b];
+    const int nb_regions = offsets.back();
+    for (std::size_t b = 0; b < blocks.size(); ++ b)
+      for (std::size_t j = 0; j < blocks[b].size(); ++ j)
+        if (block_regions[b][j] != -1)
+          regions[blocks[b][j]] = offsets[b] + block_regions[b][j];
+
+    // points of each region and their fitted plane
+    std::vector<int> region_offsets (std::size_t(nb_regions) + 1, 0);
+    for (int r : regions)
+      if (r != -1)
+        ++ region_offsets[std::size_t(r) + 1];
+    std::partial_sum (region_offsets.begin(), region_offsets.end(), region_offsets.begin());
+    std::vector<std::size_t> region_points (std::size_t(region_offsets.back()));
+    {
+      std::vector<int> next (region_offsets.begin(), region_offsets.end() - 1);
+      for (std::size_t i = 0; i < regions.size(); ++ i)
+        if (regions[i] != -1)
+          region_points[std::size_t(next[std::size_t(regions[i])] ++)] = i;
+    }
+    std::vector<EPIC_Kernel::Plane_3> planes (std::size_t(nb_regions));
+    std::vector<Point> centroids (std::size_t(nb_regions));
+    std::vector<std::size_t> region_ids (std::size_t(nb_regions));
+    std::iota (region_ids.begin(), region_ids.end(), std::size_t(0));
+    CGAL::for_each<SWIG_Point_set_3::Concurrency_tag>
+      (region_ids, [&](const std::size_t& r) -> bool
+       {
+         std::vector<Point> region;
+         Vector normal = CGAL::NULL_VECTOR;
+         for (int j = region_offsets[r]; j < region_offsets[r + 1]; ++ j)
+         {
+           region.push_back (points[region_points[std::size_t(j)]]);
+           normal = normal + normals[region_points[std::size_t(j)]];
+         }
+         centroids[r] = CGAL::centroid (region.begin(), region.end());
+         if (region.size() >= 3)
+           CGAL::linear_least_squares_fitting_3 (region.begin(), region.end(), planes[r], centroids[r],
+                                                 CGAL::Dimension_tag<0>());
+         else
+           planes[r] = EPIC_Kernel::Plane_3 (centroids[r], normal);
+         return true;
+       });
+
+    // pairs of regions of different blocks with close points: only the
+    // points close to a face of their block can be close to another block
+    std::vector<double> coordinates;
+    std::vector<std::int32_t> ids;
+    for (std::size_t i = 0; i < points.size(); ++ i)
+    {
+      if (regions[i] == -1)
+        continue;
+      const std::array<long, 3>& cube = block_coordinates[std::size_t(block_of_point[i])];
+      const double c[3] = { points[i].x() - bbox.xmin(), points[i].y() - bbox.ymin(), points[i].z() - bbox.zmin() };
+      bool near_face = false;
+      for (int d = 0; d < 3; ++ d)
+        near_face = near_face || (c[d] - cube[d] * block_size < cluster_epsilon)
+                              || ((cube[d] + 1) * block_size - c[d] < cluster_epsilon);
+      if (!near_face)
+        continue;
+      coordinates.push_back (points[i].x());
+      coordinates.push_back (points[i].y());
+      coordinates.push_back (points[i].z());
+      ids.push_back (std::int32_t (i));
+    }
+    std::vector<std::pair<int, int> > candidates;
+    if (!ids.empty())
+    {
+      const std::vector<std::int32_t> boundary_points (ids);
+      Voxel_grid_3 grid (std::move (coordinates), std::move (ids), cluster_epsilon);
+      for (std::int32_t i : boundary_points)
+      {
+        const double center[3] = { points[std::size_t(i)].x(), points[std::size_t(i)].y(), points[std::size_t(i)].z() };
+        grid.sphere_search (center, cluster_epsilon, boost::make_function_output_iterator
+                            ([&](int j)
+                             {
+                               if (j > i && block_of_point[std::size_t(j)] != block_of_point[std::size_t(i)])
+                                 candidates.push_back (std::make_pair ((std::min) (regions[std::size_t(i)], regions[std::size_t(j)]),
+                                                                       (std::max) (regions[std::size_t(i)], regions[std::size_t(j)])));
+                             }));
+      }
+      std::sort (candidates.begin(), candidates.end());
+      candidates.erase (std::unique (candidates.begin(), candidates.end()), candidates.end());
+    }
+
+    // merge of the compatible regions
+    std::vector<int> parents (std::size_t(nb_regions));
+    std::iota (parents.begin(), parents.end(), 0);
+    for (const std::pair<int, int>& c : candidates)
+    {
+      const EPIC_Kernel::Plane_3& p1 = planes[std::size_t(c.first)];
+      const EPIC_Kernel::Plane_3& p2 = planes[std::size_t(c.second)];
+      Vector n1 = p1.orthogonal_vector(), n2 = p2.orthogonal_vector();
+      if (n1.squared_length() == 0 || n2.squared_length() == 0)
+        continue; // degenerate plane of a tiny region
+      n1 = n1 / std::sqrt (n1.squared_length());
+      n2 = n2 / std::sqrt (n2.squared_length());
+      if (std::abs (n1 * n2) < normal_treshold)
+        continue;
+      if (std::sqrt (CGAL::squared_distance (centroids[std::size_t(c.second)], p1)) > epsilon
+          || std::sqrt (CGAL::squared_distance (centroids[std::size_t(c.first)], p2)) > epsilon)
+        continue;
+      const int r1 = SWIG_Shape_detection::internal::find_root (parents, c.first);
+      const int r2 = SWIG_Shape_detection::internal::find_root (parents, c.second);
+      if (r1 != r2)
+        parents[std::size_t((std::max) (r1, r2))] = (std::min) (r1, r2);
+    }
+
+    // final numbering in the order of the blocks, dropping the small planes
+    std::vector<int> sizes (std::size_t(nb_regions), 0);
+    for (int r = 0; r < nb_regions; ++ r)
+      sizes[std::size_t(SWIG_Shape_detection::internal::find_root (parents, r))]
+        += region_offsets[std::size_t(r) + 1] - region_offsets[std::size_t(r)];
+    std::vector<int> plane_of_root (std::size_t(nb_regions), -1);
+    for (int r = 0; r < nb_regions; ++ r)
+      if (parents[std::size_t(r)] == r && sizes[std::size_t(r)] >= min_points)
+        plane_of_root[std::size_t(r)] = nb_planes ++;
+    for (int& r : regions)
+      if (r != -1)
+        r = plane_of_root[std::size_t(SWIG_Shape_detection::internal::find_root (parents, r))];
+  }
+
+  std::size_t position = 0;
+  for (CGAL_PS3::const_iterator it = ps.begin(); it != ps.end(); ++ it, ++ position)
+    plane_map.set (*it, regions[position]);
+  return nb_planes;
+}
+
+#endif // SWIG_CGAL_SHAPE_DETECTION_REGION_GROWING_ARRAYS_H
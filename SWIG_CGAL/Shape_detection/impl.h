@@ -9,6 +9,8 @@
 #include <SWIG_CGAL/Kernel/Point_3.h>
 #include <SWIG_CGAL/Kernel/Vector_3.h>
 #include <SWIG_CGAL/Point_set_3/Point_set_3.h>
+#include <SWIG_CGAL/Spatial_searching/Voxel_grid.h>
+#include <SWIG_CGAL/Point_set_processing_3/Neighborhood_cache.h>
 
 #include <CGAL/Shape_detection/Efficient_RANSAC.h>
 #include <CGAL/Shape_detection/Region_growing/Region_growing.h>
@@ -20,32 +22,92 @@
 
 #include <boost/iterator/function_output_iterator.hpp>
 
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
 #ifndef SWIG
-template <typename NeighborQuery>
+// Sphere neighbor query on a Voxel_grid_3 of the points of the point set,
+// with voxels of side the radius (a query visits at most 27 voxels)
+class Voxel_grid_neighbor_query
+{
+  const CGAL_PS3& m_points;
+  Voxel_grid_3 m_grid;
+  double m_radius;
+
+  static Voxel_grid_3 make_grid (const CGAL_PS3& points, double radius)
+  {
+    std::vector<double> coordinates;
+    std::vector<std::int32_t> ids;
+    coordinates.reserve (3 * points.size());
+    ids.reserve (points.size());
+    std::size_t position = 0;
+    for (CGAL_PS3::const_iterator it = points.begin(); it != points.end(); ++ it, ++ position)
+    {
+      const EPIC_Kernel::Point_3& p = points.point(*it);
+      coordinates.push_back (p.x());
+      coordinates.push_back (p.y());
+      coordinates.push_back (p.z());
+#if CGAL_VERSION_NR >= 1050600900
+      ids.push_back (std::int32_t(std::size_t(*it)));
+#else
+      ids.push_back (std::int32_t(position));
+#endif
+    }
+    return Voxel_grid_3 (std::move (coordinates), std::move (ids), radius);
+  }
+
+public:
+#if CGAL_VERSION_NR >= 1050600900
+  typedef CGAL_PS3::Index Item;
+#else
+  typedef std::size_t Item;
+#endif
+
+  Voxel_grid_neighbor_query (const CGAL_PS3& points, double radius)
+    : m_points (points), m_grid (make_grid (points, radius)), m_radius (radius) { }
+
+  void operator() (const Item& query, std::vector<Item>& neighbors) const
+  {
+#if CGAL_VERSION_NR >= 1050600900
+    const EPIC_Kernel::Point_3& p = m_points.point(query);
+#else
+    const EPIC_Kernel::Point_3& p = m_points.point(*(m_points.begin() + query));
+#endif
+    double center[3] = { p.x(), p.y(), p.z() };
+    neighbors.clear();
+    m_grid.sphere_search (center, m_radius, boost::make_function_output_iterator
+                          ([&](int id) { neighbors.push_back (Item(std::size_t(id))); }));
+  }
+};
+
+// Region growing of planes on the points, output(idx, plane) being called
+// for the points of each plane. Returns the number of planes.
+template <typename NeighborQuery, typename Output>
 int
-region_growing_impl (Point_set_3_wrapper<CGAL_PS3> point_set,
-                     typename Point_set_3_wrapper<CGAL_PS3>::Int_map plane_map,
-                     int min_points,
-                     double epsilon,
-                     double normal_treshold,
-                     NeighborQuery& neighbor_query)
+detect_planes_impl (const CGAL_PS3& points,
+                    int min_points,
+                    double epsilon,
+                    double normal_treshold,
+                    NeighborQuery& neighbor_query,
+                    const Output& output)
 {
 #if CGAL_VERSION_NR >= 1050600900
   typedef CGAL::Shape_detection::Point_set::Least_squares_plane_fit_region_for_point_set<CGAL_PS3> Region_type;
   typedef CGAL::Shape_detection::Region_growing<NeighborQuery, Region_type> Region_growing;
 
-  // Init map for unassigned points to be -1
-  for (int& idx : plane_map.get_data())
-    idx = -1;
-
   double angle = 180 * std::acos(normal_treshold) / CGAL_PI;
   Region_type region_type =
     CGAL::Shape_detection::Point_set::make_least_squares_plane_fit_region(
-                           point_set.get_data(),
+                           points,
                            CGAL::parameters::maximum_distance(epsilon).
                            maximum_angle(angle).
                            minimum_region_size(min_points));
-  Region_growing region_growing (point_set.get_data(), neighbor_query, region_type);
+  Region_growing region_growing (points, neighbor_query, region_type);
 
   int plane_idx = 0;
   region_growing.detect
@@ -53,7 +115,7 @@ region_growing_impl (Point_set_3_wrapper<CGAL_PS3> point_set,
      ([&](const std::pair<typename Region_type::Primitive,std::vector<typename Region_type::Item>>& primitive_and_region)
       {
         for (std::size_t idx : primitive_and_region.second)
-          plane_map.set(*(point_set.get_data().begin() + idx), plane_idx);
+          output (idx, plane_idx);
         ++ plane_idx;
       }));
 
@@ -66,14 +128,10 @@ region_growing_impl (Point_set_3_wrapper<CGAL_PS3> point_set,
     <CGAL_PS3, NeighborQuery, Region_type>
     Region_growing;
 
-  // Init map for unassigned points to be -1
-  for (int& idx : plane_map.get_data())
-    idx = -1;
-
   double angle = 180 * std::acos(normal_treshold) / CGAL_PI;
-  Region_type region_type (point_set.get_data(), epsilon, angle, min_points,
-                           point_set.get_data().point_map(), point_set.get_data().normal_map());
-  Region_growing region_growing (point_set.get_data(), neighbor_query, region_type);
+  Region_type region_type (points, epsilon, angle, min_points,
+                           points.point_map(), points.normal_map());
+  Region_growing region_growing (points, neighbor_query, region_type);
 
   int plane_idx = 0;
   region_growing.detect
@@ -81,80 +139,268 @@ region_growing_impl (Point_set_3_wrapper<CGAL_PS3> point_set,
      ([&](const std::vector<std::size_t>& region)
       {
         for (std::size_t idx : region)
-          plane_map.set(*(point_set.get_data().begin() + idx), plane_idx);
+          output (idx, plane_idx);
         ++ plane_idx;
       }));
 
   return plane_idx;
 #endif
 }
-#endif
 
+template <typename NeighborQuery>
 int
-region_growing (Point_set_3_wrapper<CGAL_PS3> point_set,
-                typename Point_set_3_wrapper<CGAL_PS3>::Int_map plane_map,
-                int min_points = 1,
-                double epsilon = -1,
-                double cluster_epsilon = -1,
-                double normal_treshold = 0.9,
-                int k = 0)
+region_growing_impl (Point_set_3_wrapper<CGAL_PS3> point_set,
+                     typename Point_set_3_wrapper<CGAL_PS3>::Int_map plane_map,
+                     int min_points,
+                     double epsilon,
+                     double normal_treshold,
+                     NeighborQuery& neighbor_query)
 {
-  if (epsilon == -1 && cluster_epsilon == -1)
-  {
-    CGAL::Bbox_3 bbox = CGAL::bbox_3 (point_set.get_data().points().begin(),
-                                      point_set.get_data().points().end());
-    double bbox_diagonal =
-      CGAL::sqrt((bbox.xmax() - bbox.xmin()) * (bbox.xmax() - bbox.xmin())
-                 + (bbox.ymax() - bbox.ymin()) * (bbox.ymax() - bbox.ymin())
-                 + (bbox.zmax() - bbox.zmin()) * (bbox.zmax() - bbox.zmin()));
+  // Init map for unassigned points to be -1
+  for (int& idx : plane_map.get_data())
+    idx = -1;
 
-    if (epsilon == -1)
-      epsilon = 0.01 * bbox_diagonal;
-    if (cluster_epsilon == -1)
-      cluster_epsilon = 0.01 * bbox_diagonal;
-  }
-#if CGAL_VERSION_NR >= 1050600900
-  if (k == 0)
-  {
-   typedef CGAL::Shape_detection::Point_set::Sphere_neighbor_query_for_point_set<CGAL_PS3> Neighbor_query;
+  return detect_planes_impl (point_set.get_data(), min_points, epsilon, normal_treshold, neighbor_query,
+                             [&](std::size_t idx, int plane)
+                             { plane_map.set(*(point_set.get_data().begin() + idx), plane); });
+}
+#endif
 
-    Neighbor_query neighbor_query =
-      CGAL::Shape_detection::Point_set::make_sphere_neighbor_query(
-        point_set.get_data(), CGAL::parameters::sphere_radius(cluster_epsilon));
-    return region_growing_impl (point_set, plane_map, min_points, epsilon, normal_treshold, neighbor_query);
-  }
-  else
-  {
-    typedef CGAL::Shape_detection::Point_set::K_neighbor_query_for_point_set<CGAL_PS3> Neighbor_query;
+#ifndef SWIG
+namespace SWIG_Shape_detection {
+namespace internal {
+
+// length of the diagonal of the bounding box of the points
+inline double bbox_diagonal (const CGAL_PS3& points)
+{
+  CGAL::Bbox_3 bbox = CGAL::bbox_3 (points.points().begin(), points.points().end());
+  return CGAL::sqrt((bbox.xmax() - bbox.xmin()) * (bbox.xmax() - bbox.xmin())
+                    + (bbox.ymax() - bbox.ymin()) * (bbox.ymax() - bbox.ymin())
+                    + (bbox.zmax() - bbox.zmin()) * (bbox.zmax() - bbox.zmin()));
+}
+
+// owns a neighbor query, constructed in place by `make` as the queries of
+// CGAL hold a kd-tree and are not meant to be copied
+template <typename NeighborQuery>
+struct Neighbor_query_holder
+{
+  NeighborQuery query;
+  template <typename Make>
+  explicit Neighbor_query_holder (const Make& make) : query (make()) { }
+};
+
+} // namespace internal
+} // namespace SWIG_Shape_detection
+#endif
+
+// Neighbor query of region_growing(), built once (kd-tree, voxel grid or k
+// nearest neighbors of a Neighborhood_cache) and reused by the calls on the
+// same point set, e.g. to sweep the region parameters. The diagonal of the
+// bounding box, giving the default parameters, is computed once too. Copies
+// share the same query. The point set must not be modified while the query
+// is used, except for a query on a Neighborhood_cache, which is updated by
+// each call.
+class Region_growing_neighbor_query
+{
+#ifndef SWIG
+public:
+  typedef Voxel_grid_neighbor_query::Item Item;
+  typedef std::function<void(const Item&, std::vector<Item>&)> Function;
 
-    Neighbor_query neighbor_query =
-      CGAL::Shape_detection::Point_set::make_k_neighbor_query(
-        point_set.get_data(), CGAL::parameters::k_neighbors(k));
-    return region_growing_impl (point_set, plane_map, min_points, epsilon, normal_treshold, neighbor_query);
+  // the neighbor query given to Region_growing, cheap to copy
+  struct Query
+  {
+    std::shared_ptr<const Function> function;
+    void operator() (const Item& query, std::vector<Item>& neighbors) const { (*function) (query, neighbors); }
+  };
+
+private:
+  Point_set_3_wrapper<CGAL_PS3> m_point_set;
+  std::size_t m_size;
+  double m_radius;
+  double m_bbox_diagonal;
+  std::shared_ptr<const Function> m_function;
+  std::shared_ptr<CGAL_SWIG::Neighborhood_cache> m_cache;
+
+  Region_growing_neighbor_query (Point_set_3_wrapper<CGAL_PS3> point_set)
+    : m_point_set (point_set)
+    , m_size (point_set.get_data().size())
+    , m_radius (-1)
+    , m_bbox_diagonal (SWIG_Shape_detection::internal::bbox_diagonal (point_set.get_data())) { }
+
+  template <typename NeighborQuery, typename Make>
+  void set_query (const Make& make)
+  {
+    typedef SWIG_Shape_detection::internal::Neighbor_query_holder<NeighborQuery> Holder;
+    std::shared_ptr<Holder> holder = std::make_shared<Holder> (make);
+    m_function = std::make_shared<const Function>
+      ([holder](const Item& query, std::vector<Item>& neighbors) { holder->query (query, neighbors); });
   }
-#else
-  if (k == 0)
+
+  // the k nearest neighbors of the cache, which are stored by rows
+  // (the points in iteration order)
+  void set_cache_query()
   {
-   typedef CGAL::Shape_detection::Point_set::Sphere_neighbor_query
-      <EPIC_Kernel, CGAL_PS3, CGAL_PS3::Point_map>
-      Neighbor_query;
+    std::shared_ptr<CGAL_SWIG::Neighborhood_cache> cache = m_cache;
+    const std::vector<int>& indices = cache->indices();
+    std::shared_ptr<std::vector<int> > row_of_index = std::make_shared<std::vector<int> >
+      (indices.empty() ? 0 : std::size_t(*std::max_element (indices.begin(), indices.end())) + 1, -1);
+    for (std::size_t row = 0; row < indices.size(); ++ row)
+      (*row_of_index)[std::size_t(indices[row])] = int(row);
+    const std::size_t k = std::size_t(cache->k());
+    m_function = std::make_shared<const Function>
+      ([cache, row_of_index, k](const Item& query, std::vector<Item>& neighbors)
+       {
+         neighbors.clear();
+#if CGAL_VERSION_NR >= 1050600900
+         const int* n = cache->neighbors (std::size_t((*row_of_index)[std::size_t(query)]));
+         for (std::size_t j = 0; j < k; ++ j)
+           if (n[j] != -1)
+             neighbors.push_back (Item(std::size_t(n[j])));
+#else
+         // items are the positions of the points, that is the rows
+         const int* n = cache->neighbors (query);
+         for (std::size_t j = 0; j < k; ++ j)
+           if (n[j] != -1)
+             neighbors.push_back (Item((*row_of_index)[std::size_t(n[j])]));
+#endif
+       });
+  }
+#endif
 
-    Neighbor_query neighbor_query (point_set.get_data(), cluster_epsilon, point_set.get_data().point_map());
-    return region_growing_impl (point_set, plane_map, min_points, epsilon, normal_treshold, neighbor_query);
+public:
+  // Points closer than radius (1% of the bbox diagonal if -1), searched in a
+  // kd-tree or in a voxel grid of side radius.
+  static Region_growing_neighbor_query create_sphere (Point_set_3_wrapper<CGAL_PS3> point_set,
+                                                      double radius = -1,
+                                                      bool use_voxel_grid = false)
+  {
+    Region_growing_neighbor_query result (point_set);
+    if (radius == -1)
+      radius = 0.01 * result.m_bbox_diagonal;
+    if (!(radius > 0))
+      throw std::invalid_argument("The radius must be positive");
+    result.m_radius = radius;
+    const CGAL_PS3& points = point_set.get_data();
+    if (use_voxel_grid)
+      result.set_query<Voxel_grid_neighbor_query>
+        ([&]() { return Voxel_grid_neighbor_query (points, radius); });
+    else
+    {
+#if CGAL_VERSION_NR >= 1050600900
+      typedef CGAL::Shape_detection::Point_set::Sphere_neighbor_query_for_point_set<CGAL_PS3> Neighbor_query;
+      result.set_query<Neighbor_query>
+        ([&]() { return CGAL::Shape_detection::Point_set::make_sphere_neighbor_query
+                   (points, CGAL::parameters::sphere_radius(radius)); });
+#else
+      typedef CGAL::Shape_detection::Point_set::Sphere_neighbor_query
+        <EPIC_Kernel, CGAL_PS3, CGAL_PS3::Point_map> Neighbor_query;
+      result.set_query<Neighbor_query>
+        ([&]() { return Neighbor_query (points, radius, points.point_map()); });
+#endif
+    }
+    return result;
   }
-  else
+
+  // k nearest neighbors, searched in a kd-tree
+  static Region_growing_neighbor_query create_k_neighbors (Point_set_3_wrapper<CGAL_PS3> point_set, int k)
   {
+    if (k < 1)
+      throw std::invalid_argument("Number of neighbors must be positive");
+    Region_growing_neighbor_query result (point_set);
+    const CGAL_PS3& points = point_set.get_data();
+#if CGAL_VERSION_NR >= 1050600900
+    typedef CGAL::Shape_detection::Point_set::K_neighbor_query_for_point_set<CGAL_PS3> Neighbor_query;
+    result.set_query<Neighbor_query>
+      ([&]() { return CGAL::Shape_detection::Point_set::make_k_neighbor_query
+                 (points, CGAL::parameters::k_neighbors(k)); });
+#else
     typedef CGAL::Shape_detection::Point_set::K_neighbor_query
-      <EPIC_Kernel, CGAL_PS3, CGAL_PS3::Point_map>
-      Neighbor_query;
+      <EPIC_Kernel, CGAL_PS3, CGAL_PS3::Point_map> Neighbor_query;
+    result.set_query<Neighbor_query>
+      ([&]() { return Neighbor_query (points, k, points.point_map()); });
+#endif
+    return result;
+  }
 
-    Neighbor_query neighbor_query (point_set.get_data(), k, point_set.get_data().point_map());
-    return region_growing_impl (point_set, plane_map, min_points, epsilon, normal_treshold, neighbor_query);
+  // the k nearest neighbors already computed by a Neighborhood_cache
+  // (shared, not copied)
+  static Region_growing_neighbor_query create_from_neighborhood_cache (const CGAL_SWIG::Neighborhood_cache& cache)
+  {
+    Region_growing_neighbor_query result (cache.point_set());
+    result.m_cache = std::make_shared<CGAL_SWIG::Neighborhood_cache> (cache);
+    return result;
   }
 
+  // radius of a sphere query, -1 for the other ones
+  double radius() const { return m_radius; }
+  double bbox_diagonal() const { return m_bbox_diagonal; }
+
+#ifndef SWIG
+  const Point_set_3_wrapper<CGAL_PS3>& point_set() const { return m_point_set; }
+
+  // the query, checked against the points
+  Query query()
+  {
+    if (m_cache)
+    {
+      if (m_cache->update() || !m_function)
+      {
+        m_size = m_point_set.get_data().size();
+        m_bbox_diagonal = SWIG_Shape_detection::internal::bbox_diagonal (m_point_set.get_data());
+        set_cache_query();
+      }
+    }
+    else if (m_point_set.get_data().size() != m_size)
+      throw std::invalid_argument("The point set was modified since the neighbor query was built");
+    Query result;
+    result.function = m_function;
+    return result;
+  }
 #endif
+};
+
+// Region growing with a prebuilt neighbor query: epsilon defaults to 1% of
+// the bbox diagonal cached by the query. (Not an overload of
+// region_growing(), so that both accept keyword arguments in Python.)
+int
+region_growing_with_neighbor_query (Point_set_3_wrapper<CGAL_PS3> point_set,
+                                    typename Point_set_3_wrapper<CGAL_PS3>::Int_map plane_map,
+                                    Region_growing_neighbor_query neighbor_query,
+                                    int min_points = 1,
+                                    double epsilon = -1,
+                                    double normal_treshold = 0.9)
+{
+  if (&(neighbor_query.point_set().get_data()) != &(point_set.get_data()))
+    throw std::invalid_argument("The neighbor query was built on another point set");
+  Region_growing_neighbor_query::Query query = neighbor_query.query();
+  if (epsilon == -1)
+    epsilon = 0.01 * neighbor_query.bbox_diagonal();
+  return region_growing_impl (point_set, plane_map, min_points, epsilon, normal_treshold, query);
+}
 
-  return 0;
+int
+region_growing (Point_set_3_wrapper<CGAL_PS3> point_set,
+                typename Point_set_3_wrapper<CGAL_PS3>::Int_map plane_map,
+                int min_points = 1,
+                double epsilon = -1,
+                double cluster_epsilon = -1,
+                double normal_treshold = 0.9,
+                int k = 0,
+                bool use_voxel_grid = false)
+{
+  if (epsilon == -1 || (k == 0 && cluster_epsilon == -1))
+  {
+    double bbox_diagonal = SWIG_Shape_detection::internal::bbox_diagonal (point_set.get_data());
+    if (epsilon == -1)
+      epsilon = 0.01 * bbox_diagonal;
+    if (cluster_epsilon == -1)
+      cluster_epsilon = 0.01 * bbox_diagonal;
+  }
+  Region_growing_neighbor_query neighbor_query =
+    (k == 0 ? Region_growing_neighbor_query::create_sphere (point_set, cluster_epsilon, use_voxel_grid)
+            : Region_growing_neighbor_query::create_k_neighbors (point_set, k));
+  return region_growing_with_neighbor_query (point_set, plane_map, neighbor_query, min_points, epsilon, normal_treshold);
 }
 
 
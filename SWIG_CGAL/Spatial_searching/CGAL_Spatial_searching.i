@@ -26,7 +26,42 @@ SWIG_CGAL_package_common()
   #include <SWIG_CGAL/Spatial_searching/all_includes.h>
 %}
 
+//batched queries
+%include "SWIG_CGAL/typemaps.i"
+SWIG_CGAL_buffer_of_double_typemap_in
+SWIG_CGAL_buffer_of_float_typemap_in
+SWIG_CGAL_buffer_of_double_typemap_out
+SWIG_CGAL_buffer_of_int_typemap_in
+SWIG_CGAL_buffer_of_int_typemap_out
+SWIG_CGAL_buffer_of_long_long_typemap_out
+%include "SWIG_CGAL/Spatial_searching/Neighbor_batch.h"
+SWIG_CGAL_release_gil(Kd_tree_wrapper::knn_batch)
+SWIG_CGAL_release_gil(Kd_tree_wrapper::radius_neighbors_csr)
+SWIG_CGAL_release_gil(Kd_tree_wrapper::radius_neighbor_counts)
+SWIG_CGAL_release_gil(Kd_tree_wrapper::incremental_search)
+SWIG_CGAL_release_gil(Kd_tree_wrapper::incremental_search_batch)
+
+//kd-tree on point ids
+SWIG_CGAL_release_gil(Index_kd_tree_3::build)
+SWIG_CGAL_release_gil(Index_kd_tree_3::knn_batch)
+SWIG_CGAL_release_gil(Index_kd_tree_3::radius_neighbors_csr)
+SWIG_CGAL_release_gil(Index_kd_tree_3::radius_neighbor_counts)
+%typemap(javaimports) Index_kd_tree_3 %{import CGAL.Kernel.Point_3; import CGAL.Kernel.Memory_usage;%}
+%include "SWIG_CGAL/Spatial_searching/Index_kd_tree.h"
+//kd-tree on feature vectors of any dimension
+SWIG_CGAL_release_gil(Kd_tree_d::Kd_tree_d)
+SWIG_CGAL_release_gil(Kd_tree_d::knn_batch)
+SWIG_CGAL_release_gil(Kd_tree_d::knn_labels)
+%include "SWIG_CGAL/Spatial_searching/Kd_tree_d.h"
+SWIG_CGAL_release_gil(Voxel_grid_3::Voxel_grid_3)
+SWIG_CGAL_release_gil(Voxel_grid_3::radius_neighbors_csr)
+SWIG_CGAL_release_gil(Voxel_grid_3::radius_neighbor_counts)
+%typemap(javaimports) Voxel_grid_3 %{import CGAL.Kernel.Point_3;%}
+%include "SWIG_CGAL/Spatial_searching/Voxel_grid.h"
+
 //definitions
+SWIG_CGAL_release_gil(Kd_tree_wrapper::build)
+SWIG_CGAL_release_gil(Kd_tree_wrapper::freeze)
 %include "SWIG_CGAL/Spatial_searching/Kd_tree.h"
 %include "SWIG_CGAL/Spatial_searching/NN_search.h"
 %include "SWIG_CGAL/Spatial_searching/Fuzzy_objects.h"
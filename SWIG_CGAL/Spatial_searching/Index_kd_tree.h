@@ -0,0 +1,470 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+
+#ifndef SWIG_CGAL_SPATIAL_SEARCHING_INDEX_KD_TREE_H
+#define SWIG_CGAL_SPATIAL_SEARCHING_INDEX_KD_TREE_H
+
+#include <SWIG_CGAL/Common/Buffer.h>
+#include <SWIG_CGAL/Kernel/Point_3.h>
+#include <SWIG_CGAL/Spatial_searching/Neighbor_batch.h>
+#include <SWIG_CGAL/Spatial_searching/typedefs.h>
+
+#include <CGAL/for_each.h>
+
+#include <boost/shared_ptr.hpp>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/task_group.h>
+#endif
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+// 3D kd-tree on point ids: the points are given as a (n,3) array of
+// coordinates (for example Point_set_3.point_array(), whose rows are the
+// indices of the point set) with optional ids (the row numbers otherwise),
+// and the queries report ids. The coordinates are copied: the tree is a
+// snapshot of the points. The tree is built by build(), and a built tree
+// can be saved and loaded back without being rebuilt. Copies share the
+// same tree. The layout of the nodes only depends on the number of points,
+// so that the parallel build gives the same tree as the sequential one.
+class Index_kd_tree_3
+{
+#ifndef SWIG
+  struct Node
+  {
+    double split;
+    std::int32_t dimension;   // -1 for a leaf
+    std::int32_t begin, end;  // range of `order` covered by the node
+    std::int32_t left, right; // children
+  };
+
+  struct Data
+  {
+    std::vector<double> coordinates;   // 3 values per point, in input order
+    std::vector<std::int32_t> ids;     // id of each point, in input order
+    std::vector<std::int32_t> order;   // points sorted by leaf
+    std::vector<Node> nodes;           // nodes[0] is the root
+    std::size_t leaf_size;
+  };
+#endif
+
+  boost::shared_ptr<Data> data_sptr;
+
+#ifndef SWIG
+  const double* point (std::int32_t i) const { return data_sptr->coordinates.data() + 3 * std::size_t(i); }
+
+  // number of nodes of a subtree on n points
+  std::size_t node_count (std::size_t n, std::map<std::size_t, std::size_t>& memo) const
+  {
+    if (n <= data_sptr->leaf_size)
+      return 1;
+    std::map<std::size_t, std::size_t>::iterator it = memo.find (n);
+    if (it != memo.end())
+      return it->second;
+    std::size_t out = 1 + node_count (n / 2, memo) + node_count (n - n / 2, memo);
+    memo[n] = out;
+    return out;
+  }
+
+  // builds the subtree `node_id` (nodes are stored in preorder) on the range
+  // [begin,end) of `order`; subtrees larger than `parallel_size` are built
+  // concurrently. `memo` is only read.
+  void build_node (std::int32_t node_id, std::int32_t begin, std::int32_t end,
+                   const std::map<std::size_t, std::size_t>& memo, std::size_t parallel_size)
+  {
+    Data& data = *data_sptr;
+    Node node = { 0., -1, begin, end, -1, -1 };
+
+    if (std::size_t(end - begin) > data.leaf_size)
+    {
+      // split at the median of the dimension of largest extent
+      double min[3], max[3];
+      for (int d = 0; d < 3; ++ d)
+      {
+        min[d] = std::numeric_limits<double>::max();
+        max[d] = -std::numeric_limits<double>::max();
+      }
+      for (std::int32_t i = begin; i < end; ++ i)
+        for (int d = 0; d < 3; ++ d)
+        {
+          min[d] = (std::min)(min[d], point(data.order[i])[d]);
+          max[d] = (std::max)(max[d], point(data.order[i])[d]);
+        }
+      int dimension = 0;
+      for (int d = 1; d < 3; ++ d)
+        if (max[d] - min[d] > max[dimension] - min[dimension])
+          dimension = d;
+
+      std::int32_t middle = begin + (end - begin) / 2;
+      std::nth_element (data.order.begin() + begin, data.order.begin() + middle, data.order.begin() + end,
+                        [&](std::int32_t a, std::int32_t b) { return point(a)[dimension] < point(b)[dimension]; });
+      node.dimension = dimension;
+      node.split = point(data.order[middle])[dimension];
+
+      std::size_t left_size = std::size_t(middle - begin);
+      std::size_t left_count = 1;
+      if (left_size > data.leaf_size)
+        left_count = memo.find (left_size)->second;
+      node.left = node_id + 1;
+      node.right = node_id + 1 + std::int32_t(left_count);
+
+#ifdef CGAL_LINKED_WITH_TBB
+      if (std::size_t(end - begin) > parallel_size)
+      {
+        tbb::task_group tasks;
+        tasks.run ([&]() { build_node (node.left, begin, middle, memo, parallel_size); });
+        build_node (node.right, middle, end, memo, parallel_size);
+        tasks.wait();
+      }
+      else
+#endif
+      {
+        build_node (node.left, begin, middle, memo, parallel_size);
+        build_node (node.right, middle, end, memo, parallel_size);
+      }
+    }
+    data.nodes[std::size_t(node_id)] = node;
+  }
+
+  // state of a k nearest neighbor search: `heap` is a max-heap on the
+  // squared distance of the (at most k) closest points found, a subtree is
+  // skipped if it cannot hold a point closer than the farthest of them
+  // divided by (1+eps), and at most max_leaves leaves (0 for no limit) are
+  // visited
+  struct Knn_search
+  {
+    std::size_t k;
+    double squared_factor; // (1+eps)^2
+    std::size_t max_leaves;
+    std::size_t leaves;
+    std::vector<std::pair<double, std::int32_t> > heap;
+
+    Knn_search (std::size_t k, double eps = 0, std::size_t max_leaves = 0)
+      : k(k), squared_factor((1 + eps) * (1 + eps)), max_leaves(max_leaves), leaves(0)
+    { heap.reserve (k); }
+  };
+
+  void knn (const double* query, std::int32_t node_id, Knn_search& search) const
+  {
+    const Node& node = data_sptr->nodes[node_id];
+    std::vector<std::pair<double, std::int32_t> >& heap = search.heap;
+    const std::size_t k = search.k;
+    if (node.dimension == -1)
+    {
+      if (search.max_leaves != 0 && search.leaves == search.max_leaves)
+        return;
+      ++ search.leaves;
+      for (std::int32_t i = node.begin; i < node.end; ++ i)
+      {
+        std::int32_t p = data_sptr->order[i];
+        double sd = 0.;
+        for (int d = 0; d < 3; ++ d)
+          sd += (point(p)[d] - query[d]) * (point(p)[d] - query[d]);
+        if (heap.size() < k)
+        {
+          heap.push_back (std::make_pair (sd, p));
+          std::push_heap (heap.begin(), heap.end());
+        }
+        else if (sd < heap.front().first)
+        {
+          std::pop_heap (heap.begin(), heap.end());
+          heap.back() = std::make_pair (sd, p);
+          std::push_heap (heap.begin(), heap.end());
+        }
+      }
+      return;
+    }
+
+    double diff = query[node.dimension] - node.split;
+    std::int32_t first = (diff < 0 ? node.left : node.right);
+    std::int32_t second = (diff < 0 ? node.right : node.left);
+    knn (query, first, search);
+    if (heap.size() < k || diff * diff * search.squared_factor < heap.front().first)
+      knn (query, second, search);
+  }
+
+  // reports to `out` the ids of the points in the sphere
+  template <class Output>
+  void sphere_search (const double* center, double squared_radius, std::int32_t node_id,
+                      Output& out) const
+  {
+    const Node& node = data_sptr->nodes[node_id];
+    if (node.dimension == -1)
+    {
+      for (std::int32_t i = node.begin; i < node.end; ++ i)
+      {
+        std::int32_t p = data_sptr->order[i];
+        double sd = 0.;
+        for (int d = 0; d < 3; ++ d)
+          sd += (point(p)[d] - center[d]) * (point(p)[d] - center[d]);
+        if (sd <= squared_radius)
+          *out++ = data_sptr->ids[p];
+      }
+      return;
+    }
+    double diff = center[node.dimension] - node.split;
+    if (diff < 0 || diff * diff <= squared_radius)
+      sphere_search (center, squared_radius, node.left, out);
+    if (diff >= 0 || diff * diff <= squared_radius)
+      sphere_search (center, squared_radius, node.right, out);
+  }
+
+  static std::size_t number_of_queries (const SWIG_CGAL::Buffer<double>& queries)
+  {
+    if (queries.size() % 3 != 0)
+      throw std::invalid_argument("The number of coordinates must be a multiple of 3");
+    return queries.size() / 3;
+  }
+
+  void check_built() const
+  {
+    if (!is_built())
+      throw std::runtime_error("The tree must be built before being queried (call build())");
+  }
+
+  template <typename T>
+  static void write_vector (std::ofstream& os, const std::vector<T>& values)
+  {
+    std::uint64_t size = values.size();
+    os.write (reinterpret_cast<const char*>(&size), sizeof(size));
+    os.write (reinterpret_cast<const char*>(values.data()), std::streamsize(size * sizeof(T)));
+  }
+
+  template <typename T>
+  static void read_vector (std::ifstream& is, std::vector<T>& values)
+  {
+    std::uint64_t size = 0;
+    is.read (reinterpret_cast<char*>(&size), sizeof(size));
+    if (!is)
+      throw std::runtime_error("Truncated kd-tree file");
+    values.resize (std::size_t(size));
+    is.read (reinterpret_cast<char*>(values.data()), std::streamsize(size * sizeof(T)));
+    if (!is)
+      throw std::runtime_error("Truncated kd-tree file");
+  }
+#endif
+
+public:
+#ifndef SWIG
+  static const char* magic() { return "CGALKDT3"; }
+  static std::uint32_t version() { return 1; }
+#endif
+
+  Index_kd_tree_3() : data_sptr(new Data()) { data_sptr->leaf_size = 16; }
+
+  Index_kd_tree_3 (SWIG_CGAL::Buffer<double> points)
+    : data_sptr(new Data())
+  {
+    data_sptr->leaf_size = 16;
+    if (points.size() % 3 != 0)
+      throw std::invalid_argument("The number of coordinates must be a multiple of 3");
+    data_sptr->coordinates.assign (points.data(), points.data() + points.size());
+    data_sptr->ids.resize (points.size() / 3);
+    for (std::size_t i = 0; i < data_sptr->ids.size(); ++ i)
+      data_sptr->ids[i] = std::int32_t(i);
+  }
+
+  Index_kd_tree_3 (SWIG_CGAL::Buffer<double> points, SWIG_CGAL::Buffer<int> ids)
+    : data_sptr(new Data())
+  {
+    data_sptr->leaf_size = 16;
+    if (points.size() != 3 * ids.size())
+      throw std::invalid_argument("Expecting 3 coordinates per id");
+    data_sptr->coordinates.assign (points.data(), points.data() + points.size());
+    data_sptr->ids.assign (ids.data(), ids.data() + ids.size());
+  }
+
+  int size() const { return int(data_sptr->ids.size()); }
+  bool is_built() const { return !data_sptr->nodes.empty(); }
+
+  // the coordinates and the ids as structure, the order of the points and
+  // the nodes as search index
+  SWIG_CGAL::Memory_usage memory_usage() const
+  {
+    const Data& data = *data_sptr;
+    return SWIG_CGAL::Memory_usage (SWIG_CGAL::internal::vector_bytes (data.coordinates)
+                                      + SWIG_CGAL::internal::vector_bytes (data.ids), 0,
+                                    SWIG_CGAL::internal::vector_bytes (data.order)
+                                      + SWIG_CGAL::internal::vector_bytes (data.nodes));
+  }
+
+  // releases the capacity of the arrays left by the successive builds
+  void shrink_to_fit()
+  {
+    Data& data = *data_sptr;
+    data.coordinates.shrink_to_fit();
+    data.ids.shrink_to_fit();
+    data.order.shrink_to_fit();
+    data.nodes.shrink_to_fit();
+  }
+
+  // Builds the tree, with at most `leaf_size` points per leaf. If `parallel`
+  // (and TBB is available), the subtrees of more than 100000 points are
+  // built concurrently.
+  void build (int leaf_size = 16, bool parallel = true)
+  {
+    if (leaf_size < 1)
+      throw std::invalid_argument("Leaf size must be positive");
+    Data& data = *data_sptr;
+    data.leaf_size = std::size_t(leaf_size);
+    data.order.resize (data.ids.size());
+    for (std::size_t i = 0; i < data.order.size(); ++ i)
+      data.order[i] = std::int32_t(i);
+
+    std::map<std::size_t, std::size_t> memo;
+    data.nodes.assign (node_count (data.order.size(), memo), Node());
+    build_node (0, 0, std::int32_t(data.order.size()), memo,
+                parallel ? std::size_t(100000) : (std::numeric_limits<std::size_t>::max)());
+  }
+
+  // id of the point closest to `query`, -1 if the tree is empty
+  int nearest (const Point_3& query) const
+  {
+    check_built();
+    double q[3] = { query.x(), query.y(), query.z() };
+    Knn_search search (1);
+    knn (q, 0, search);
+    return search.heap.empty() ? -1 : data_sptr->ids[search.heap.front().second];
+  }
+
+  // ids of the points at distance at most `radius` of `center`, in no particular order
+  SWIG_CGAL::Buffer<int> search (const Point_3& center, double radius) const
+  {
+    check_built();
+    double c[3] = { center.x(), center.y(), center.z() };
+    std::vector<int> out;
+    std::back_insert_iterator<std::vector<int> > output (out);
+    sphere_search (c, radius * radius, 0, output);
+    return SWIG_CGAL::Buffer<int>(std::move(out));
+  }
+
+  // ids of the points at distance at most `radius` of each query of a flat
+  // array of 3 coordinates per query, as a sparse matrix
+  Radius_neighbors radius_neighbors_csr (SWIG_CGAL::Buffer<double> queries, double radius) const
+  {
+    check_built();
+    return SWIG_Spatial_searching::radius_neighbors_csr
+      (number_of_queries (queries), [&](std::size_t row, auto out)
+       { sphere_search (queries.data() + 3 * row, radius * radius, 0, out); });
+  }
+
+  // number of points at distance at most `radius` of each query
+  SWIG_CGAL::Buffer<int> radius_neighbor_counts (SWIG_CGAL::Buffer<double> queries, double radius) const
+  {
+    check_built();
+    return SWIG_CGAL::Buffer<int>(SWIG_Spatial_searching::radius_neighbor_counts
+      (number_of_queries (queries), [&](std::size_t row, auto out)
+       { sphere_search (queries.data() + 3 * row, radius * radius, 0, out); }));
+  }
+
+  // k nearest neighbors (as ids) of each query of a flat array of 3
+  // coordinates per query. With eps > 0, the search is approximate: the i-th
+  // neighbor is at most (1+eps) times farther than the exact one. With
+  // max_leaf_visits > 0, the search of a query stops after this number of
+  // leaves (first the ones closest to the query), bounding its time; the
+  // neighbors are then the closest points among these leaves. The number of
+  // leaves visited per query is reported (see Neighbor_batch).
+  Neighbor_batch knn_batch (SWIG_CGAL::Buffer<double> queries, int k, double eps = 0,
+                            int max_leaf_visits = 0) const
+  {
+    check_built();
+    if (k < 1)
+      throw std::invalid_argument("Number of neighbors must be positive");
+    if (eps < 0 || max_leaf_visits < 0)
+      throw std::invalid_argument("eps and the maximum number of leaf visits must be non-negative");
+    if (queries.size() % 3 != 0)
+      throw std::invalid_argument("The number of coordinates must be a multiple of 3");
+
+    const std::size_t nb_queries = queries.size() / 3;
+    const std::size_t nk = std::size_t(k);
+    Neighbor_batch out (nb_queries, nk);
+    int* indices = out.index_data();
+    double* distances = out.distance_data();
+    int* leaf_visits = out.leaf_visit_data();
+
+    std::vector<std::size_t> rows (nb_queries);
+    for (std::size_t i = 0; i < nb_queries; ++ i)
+      rows[i] = i;
+    CGAL::for_each<SWIG_Spatial_searching::Concurrency_tag>
+      (rows, [&](const std::size_t& row) -> bool
+       {
+         Knn_search search (nk, eps, std::size_t(max_leaf_visits));
+         knn (queries.data() + 3 * row, 0, search);
+         leaf_visits[row] = int(search.leaves);
+         std::vector<std::pair<double, std::int32_t> >& heap = search.heap;
+         std::sort_heap (heap.begin(), heap.end());
+         for (std::size_t n = 0; n < heap.size(); ++ n)
+         {
+           indices[row * nk + n] = data_sptr->ids[heap[n].second];
+           distances[row * nk + n] = std::sqrt (heap[n].first);
+         }
+         return true;
+       });
+    return out;
+  }
+
+  // binary file with the coordinates, the ids and the built tree
+  void save (const std::string& filename) const
+  {
+    check_built();
+    std::ofstream os (filename.c_str(), std::ios::binary);
+    if (!os)
+      throw std::runtime_error("Cannot open file " + filename);
+    std::uint32_t version = Index_kd_tree_3::version();
+    std::uint64_t leaf_size = data_sptr->leaf_size;
+    os.write (magic(), 8);
+    os.write (reinterpret_cast<const char*>(&version), sizeof(version));
+    os.write (reinterpret_cast<const char*>(&leaf_size), sizeof(leaf_size));
+    write_vector (os, data_sptr->coordinates);
+    write_vector (os, data_sptr->ids);
+    write_vector (os, data_sptr->order);
+    write_vector (os, data_sptr->nodes);
+    if (!os)
+      throw std::runtime_error("Cannot write file " + filename);
+  }
+
+  static Index_kd_tree_3 load (const std::string& filename)
+  {
+    std::ifstream is (filename.c_str(), std::ios::binary);
+    if (!is)
+      throw std::runtime_error("Cannot open file " + filename);
+    char header[8];
+    std::uint32_t version = 0;
+    std::uint64_t leaf_size = 0;
+    is.read (header, 8);
+    is.read (reinterpret_cast<char*>(&version), sizeof(version));
+    is.read (reinterpret_cast<char*>(&leaf_size), sizeof(leaf_size));
+    if (!is || std::memcmp (header, magic(), 8) != 0)
+      throw std::runtime_error(filename + " is not a kd-tree file");
+    if (version != Index_kd_tree_3::version())
+      throw std::runtime_error("Unsupported kd-tree file version");
+
+    Index_kd_tree_3 out;
+    Data& data = *out.data_sptr;
+    data.leaf_size = std::size_t(leaf_size);
+    read_vector (is, data.coordinates);
+    read_vector (is, data.ids);
+    read_vector (is, data.order);
+    read_vector (is, data.nodes);
+    if (data.coordinates.size() != 3 * data.ids.size() || data.order.size() != data.ids.size()
+        || data.nodes.empty())
+      throw std::runtime_error(filename + " is not a valid kd-tree file");
+    return out;
+  }
+};
+
+#endif //SWIG_CGAL_SPATIAL_SEARCHING_INDEX_KD_TREE_H
@@ -12,7 +12,11 @@
 #include <SWIG_CGAL/Common/Iterator.h>
 #include <SWIG_CGAL/Common/Input_iterator_wrapper.h>
 #include <SWIG_CGAL/Common/Output_iterator_wrapper.h>
+#include <SWIG_CGAL/Common/Buffer.h>
+#include <SWIG_CGAL/Common/Freeze_state.h>
+#include <SWIG_CGAL/Spatial_searching/Neighbor_batch.h>
 #include <boost/shared_ptr.hpp>
+#include <stdexcept>
 
 #if !SWIG_CGAL_NON_SUPPORTED_TARGET_LANGUAGE
 template <class Query>
@@ -27,6 +31,53 @@ template<class Cpp_base, class Query, class Fuzzy_sphere, class Fuzzy_iso_box>
 class Kd_tree_wrapper{
   boost::shared_ptr<Cpp_base> data_sptr;
   typedef Kd_tree_wrapper<Cpp_base,Query,Fuzzy_sphere,Fuzzy_iso_box>  Self;
+  #ifndef SWIG
+  typedef SWIG_Spatial_searching::Indexed_kd_tree<
+    typename SWIG_Spatial_searching::Geometric_point<typename Cpp_base::Point_d>::type > Index_tree;
+  //built by the first batched query (or freeze()), reset when points are inserted or removed
+  boost::shared_ptr<Index_tree> index_tree_sptr;
+  SWIG_CGAL::Freeze_state freeze_state;
+  void build_index_tree()
+  {
+    if (!index_tree_sptr)
+      index_tree_sptr.reset(new Index_tree(get_data().begin(), get_data().end()));
+  }
+  const Index_tree& index_tree()
+  {
+    freeze_state.build_if_not_frozen([this](){ build_index_tree(); });
+    return *index_tree_sptr;
+  }
+  //checks the queries and builds the index tree if needed
+  const Index_tree& index_tree(const SWIG_CGAL::Buffer<double>& queries)
+  {
+    if (queries.size() % Index_tree::dimension != 0)
+      throw std::invalid_argument("The number of coordinates must be a multiple of the dimension");
+    return index_tree();
+  }
+  //filter of the incremental searches: the points i with mask[i]==value, all
+  //the points if the mask is empty
+  struct Mask_filter
+  {
+    const SWIG_CGAL::Buffer<int>* mask;
+    int value;
+    bool operator()(std::size_t i) const { return mask->size() == 0 || (*mask)[i] == value; }
+  };
+  const Index_tree& check_fuzzy_search(const SWIG_CGAL::Buffer<double>& queries, double r, double epsilon)
+  {
+    if (r < 0 || epsilon < 0)
+      throw std::invalid_argument("The radius and epsilon must be non-negative");
+    return index_tree(queries);
+  }
+  void check_incremental_search(int max_count, double max_distance, const SWIG_CGAL::Buffer<int>& mask, int max_pops)
+  {
+    if (max_count < 1)
+      throw std::invalid_argument("Number of neighbors must be positive");
+    if (max_distance < 0 || max_pops < 0)
+      throw std::invalid_argument("The maximum distance and number of pops must be non-negative");
+    if (mask.size() != 0 && mask.size() != std::size_t(size()))
+      throw std::invalid_argument("Expecting one mask value per point (or an empty mask)");
+  }
+  #endif
   Kd_tree_wrapper(const Self&); //right now CGAL's KDtree does not have a copy constructor.
   //disable deep copy
   Self deepcopy();
@@ -52,11 +103,20 @@ public:
   Kd_tree_wrapper(Point_range range):data_sptr(new cpp_base(SWIG_CGAL::get_begin(range),SWIG_CGAL::get_end(range))){}
   
 //Operations
-  SWIG_CGAL_FORWARD_CALL_1(void,insert,Point_d)
-  void insert(Point_range range){ get_data().insert(SWIG_CGAL::get_begin(range),SWIG_CGAL::get_end(range));}
+  void insert(const Point_d& p){ freeze_state.check_not_frozen("insert"); index_tree_sptr.reset(); get_data().insert(internal::Converter<Point_d>::convert(p));}
+  void insert(Point_range range){ freeze_state.check_not_frozen("insert"); index_tree_sptr.reset(); get_data().insert(SWIG_CGAL::get_begin(range),SWIG_CGAL::get_end(range));}
   Iterator iterator(){return Iterator(get_data().begin(),get_data().end());}
-  SWIG_CGAL_FORWARD_CALL_0(void,clear)
+  void clear(){ freeze_state.check_not_frozen("clear"); index_tree_sptr.reset(); get_data().clear();}
   SWIG_CGAL_FORWARD_CALL_0(int,size)
+  //the points and the nodes of the CGAL tree, and the tree of the batched
+  //queries as cache (released by the modifications of the tree)
+  SWIG_CGAL::Memory_usage memory_usage() const
+  {
+    SWIG_CGAL::Memory_usage usage = SWIG_CGAL::internal::kd_tree_memory_usage(get_data());
+    if (index_tree_sptr)
+      usage += SWIG_CGAL::Memory_usage(0, 0, 0, index_tree_sptr->memory_usage().total());
+    return usage;
+  }
   #if !SWIG_CGAL_NON_SUPPORTED_TARGET_LANGUAGE
   void search(typename Query_iterator_helper<Query>::output out, const Fuzzy_sphere& fsphere) { get_data().search(out,fsphere.get_data());}
   void search(typename Query_iterator_helper<Query>::output out, const Fuzzy_iso_box& fbox)   { get_data().search(out,fbox.get_data());}
@@ -65,7 +125,111 @@ public:
   void search(Generic_output_iterator<Query> out, const Fuzzy_iso_box& fbox)   { get_data().search(out,fbox.get_data());}
   #endif
   
-  SWIG_CGAL_FORWARD_CALL_0(void,build)
+  void build(){ freeze_state.check_not_frozen("build"); get_data().build(); }
+  //if parallel (and TBB is available), subtrees are split concurrently;
+  //the tree and the query results are the same as with build()
+  void build(bool parallel)
+  {
+    freeze_state.check_not_frozen("build");
+    if (parallel)
+      get_data().template build<SWIG_Spatial_searching::Concurrency_tag>();
+    else
+      get_data().build();
+  }
+
+  //k nearest neighbors of each query, given as a flat array of coordinates
+  //(2 or 3 per query), found concurrently (see Neighbor_batch); with eps>0, the
+  //i-th neighbor is at most (1+eps) times farther than the exact one, and
+  //fewer leaves are visited
+  Neighbor_batch knn_batch(SWIG_CGAL::Buffer<double> queries, int k, double eps=0)
+  {
+    if (k < 1)
+      throw std::invalid_argument("Number of neighbors must be positive");
+    const Index_tree& tree = index_tree(queries);
+    const std::size_t nb_queries = queries.size() / Index_tree::dimension;
+    Neighbor_batch out(nb_queries, std::size_t(k));
+    tree.knn_batch(queries.data(), nb_queries, std::size_t(k), eps, out);
+    return out;
+  }
+
+  //indices of the points at distance at most r of each query (see Radius_neighbors),
+  //up to epsilon as with a Fuzzy_sphere (the points closer than r-epsilon are
+  //reported, the ones farther than r+epsilon are not)
+  Radius_neighbors radius_neighbors_csr(SWIG_CGAL::Buffer<double> queries, double r, double epsilon=0)
+  {
+    const Index_tree& tree = check_fuzzy_search(queries, r, epsilon);
+    return SWIG_Spatial_searching::radius_neighbors_csr
+      (queries.size() / Index_tree::dimension, [&](std::size_t row, auto out)
+       { tree.sphere_search(queries.data() + row * Index_tree::dimension, r, epsilon, out); });
+  }
+
+  //number of points at distance at most r of each query, up to epsilon
+  SWIG_CGAL::Buffer<int> radius_neighbor_counts(SWIG_CGAL::Buffer<double> queries, double r, double epsilon=0)
+  {
+    const Index_tree& tree = check_fuzzy_search(queries, r, epsilon);
+    return SWIG_CGAL::Buffer<int>(SWIG_Spatial_searching::radius_neighbor_counts
+      (queries.size() / Index_tree::dimension, [&](std::size_t row, auto out)
+       { tree.sphere_search(queries.data() + row * Index_tree::dimension, r, epsilon, out); }));
+  }
+  //Incremental nearest neighbor search of `query`, run in C++: the (at most
+  //max_count) closest points at distance at most max_distance whose mask
+  //value (one per point, in insertion order) is mask_value, or all the points
+  //if `mask` is empty, for example "not removed" or "same label" queries. The
+  //search gives up after max_pops points (0 for no limit), so that
+  //strict filters do not traverse the whole tree. The result is a single row
+  //of a Neighbor_batch of width max_count.
+  Neighbor_batch incremental_search(const Point_d& query, int max_count, double max_distance,
+                                    SWIG_CGAL::Buffer<int> mask, int mask_value, int max_pops=0)
+  {
+    check_incremental_search(max_count, max_distance, mask, max_pops);
+    const Index_tree& tree = index_tree();
+    Neighbor_batch out(1, std::size_t(max_count));
+    Mask_filter accept = { &mask, mask_value };
+    tree.filtered_search(internal::Converter<Point_d>::convert(query), std::size_t(max_count), max_distance,
+                         std::size_t(max_pops), accept, out.index_data(), out.distance_data());
+    return out;
+  }
+
+  //incremental_search() of each query of a flat array of coordinates, run
+  //concurrently, with the mask value of each query (or a single one for all)
+  Neighbor_batch incremental_search_batch(SWIG_CGAL::Buffer<double> queries, int max_count, double max_distance,
+                                          SWIG_CGAL::Buffer<int> mask, SWIG_CGAL::Buffer<int> mask_values,
+                                          int max_pops=0)
+  {
+    check_incremental_search(max_count, max_distance, mask, max_pops);
+    const Index_tree& tree = index_tree(queries);
+    const std::size_t dimension = Index_tree::dimension;
+    const std::size_t nb_queries = queries.size() / dimension;
+    if (mask.size() != 0 && mask_values.size() != 1 && mask_values.size() != nb_queries)
+      throw std::invalid_argument("Expecting one mask value per query (or a single one)");
+    const std::size_t nk = std::size_t(max_count);
+    Neighbor_batch out(nb_queries, nk);
+    int* indices = out.index_data();
+    double* distances = out.distance_data();
+    CGAL::for_each<SWIG_Spatial_searching::Concurrency_tag>
+      (SWIG_Spatial_searching::query_rows(nb_queries), [&](const std::size_t& row) -> bool
+       {
+         Mask_filter accept = { &mask, mask.size() == 0 ? 0 : mask_values[mask_values.size() == 1 ? 0 : row] };
+         tree.filtered_search(Index_tree::point(queries.data() + row * dimension),
+                              nk, max_distance, std::size_t(max_pops), accept,
+                              indices + row * nk, distances + row * nk);
+         return true;
+       });
+    return out;
+  }
+//Concurrent queries
+  //builds the tree (concurrently if parallel) and the index tree of the batched
+  //queries; the tree can then be queried from several threads at the same time,
+  //and insert(), clear() and build() throw
+  void freeze(bool parallel=true)
+  {
+    freeze_state.freeze([this,parallel](){
+      if (!get_data().is_built())
+        build(parallel);
+      build_index_tree();
+    });
+  }
+  bool is_frozen() const { return freeze_state.is_frozen(); }
 //Special for SWIG
   bool same_internal_object(const Kd_tree_wrapper<Cpp_base,Query,Fuzzy_sphere,Fuzzy_iso_box>& other) {return other.data_sptr.get()==data_sptr.get();}
 };
@@ -0,0 +1,204 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+
+#ifndef SWIG_CGAL_SPATIAL_SEARCHING_KD_TREE_D_H
+#define SWIG_CGAL_SPATIAL_SEARCHING_KD_TREE_D_H
+
+#include <SWIG_CGAL/Common/Buffer.h>
+#include <SWIG_CGAL/Spatial_searching/Neighbor_batch.h>
+#include <SWIG_CGAL/Spatial_searching/typedefs.h>
+
+#ifndef SWIG
+#include <CGAL/Search_traits.h>
+#include <CGAL/Euclidean_distance.h>
+#include <CGAL/Orthogonal_k_neighbor_search.h>
+#include <CGAL/Dimension.h>
+#include <CGAL/for_each.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace SWIG_Spatial_searching {
+
+// a row of a (n,D) array of floats: the point of a kd-tree of dynamic dimension
+struct Float_row
+{
+  const float* begin;
+  const float* end;
+};
+
+struct Construct_float_row_iterator
+{
+  typedef const float* result_type;
+  const float* operator()(const Float_row& r) const { return r.begin; }
+  const float* operator()(const Float_row& r, int) const { return r.end; }
+};
+
+typedef CGAL::Search_traits<double, Float_row, const float*,
+                            Construct_float_row_iterator, CGAL::Dynamic_dimension_tag> Float_row_traits;
+
+} // namespace SWIG_Spatial_searching
+#endif
+
+// kd-tree on the rows of a (n,D) array of floats, of any dimension D (for
+// example feature vectors): the points are the rows of a copy of the array
+// and the queries report row numbers. The tree is built concurrently when
+// constructed, and copies share it. CGAL::Search_traits on views of the rows
+// are used rather than Search_traits_d, so that the points are not copied
+// into Epick_d points.
+class Kd_tree_d
+{
+#ifndef SWIG
+  typedef SWIG_Spatial_searching::Float_row_traits             Traits;
+  typedef CGAL::Orthogonal_k_neighbor_search<Traits>           Search;
+  typedef Search::Tree                                         Tree;
+
+  struct Data
+  {
+    std::vector<float> coordinates;
+    std::size_t dimension;
+    Tree tree;
+
+    explicit Data(int bucket_size) : dimension(1), tree(Tree::Splitter(bucket_size)) {}
+  };
+#endif
+
+  std::shared_ptr<Data> data_sptr;
+
+#ifndef SWIG
+  SWIG_Spatial_searching::Float_row row(const float* values, std::size_t i) const
+  {
+    const std::size_t d = data_sptr->dimension;
+    SWIG_Spatial_searching::Float_row r = { values + i * d, values + (i + 1) * d };
+    return r;
+  }
+
+  std::size_t number_of_queries(const SWIG_CGAL::Buffer<float>& queries) const
+  {
+    if (queries.size() % data_sptr->dimension != 0)
+      throw std::invalid_argument("The queries must have the dimension of the tree");
+    return queries.size() / data_sptr->dimension;
+  }
+
+  // runs `f(query, n, row, distance)` on the n-th of the (at most k)
+  // neighbors of each query, from the closest one, the queries being processed concurrently
+  template <class Function>
+  void for_each_neighbor(const SWIG_CGAL::Buffer<float>& queries, std::size_t k, double eps,
+                         const Function& f) const
+  {
+    const Data& data = *data_sptr;
+    const CGAL::Euclidean_distance<Traits> distance;
+    CGAL::for_each<SWIG_Spatial_searching::Concurrency_tag>
+      (SWIG_Spatial_searching::query_rows(number_of_queries(queries)), [&](const std::size_t& q) -> bool
+       {
+         Search search(data.tree, row(queries.data(), q), (unsigned int)k, eps);
+         std::size_t n = 0;
+         for (Search::iterator it = search.begin(); it != search.end() && n < k; ++it, ++n)
+           f(q, n, int((it->first.begin - data.coordinates.data()) / std::ptrdiff_t(data.dimension)),
+             distance.inverse_of_transformed_distance(it->second));
+         return true;
+       });
+  }
+#endif
+
+public:
+  Kd_tree_d() : data_sptr(new Data(10)) {}
+
+  // `points` is a (n,D) array, `bucket_size` the maximum number of points of a leaf
+  Kd_tree_d(SWIG_CGAL::Buffer<float> points, int bucket_size = 10)
+  {
+    if (bucket_size < 1)
+      throw std::invalid_argument("The bucket size must be positive");
+    data_sptr.reset(new Data(bucket_size));
+    if (points.rows() != 0 && points.cols() == 0)
+      throw std::invalid_argument("The points must have at least one coordinate");
+    Data& data = *data_sptr;
+    data.dimension = (std::max)(points.cols(), std::size_t(1));
+    data.coordinates.assign(points.data(), points.data() + points.size());
+    std::vector<SWIG_Spatial_searching::Float_row> rows;
+    rows.reserve(points.rows());
+    for (std::size_t i = 0; i < points.rows(); ++i)
+      rows.push_back(row(data.coordinates.data(), i));
+    data.tree.insert(rows.begin(), rows.end());
+    // the tree must be built before concurrent queries
+    if (!rows.empty())
+      data.tree.build<SWIG_Spatial_searching::Concurrency_tag>();
+  }
+
+  int size() const { return int(data_sptr->tree.size()); }
+  int dimension() const { return int(data_sptr->dimension); }
+
+  // k nearest neighbors (as rows of the points) of each row of a (m,D) array
+  // of queries, with the approximation factor `eps` of CGAL
+  Neighbor_batch knn_batch(SWIG_CGAL::Buffer<float> queries, int k, double eps = 0) const
+  {
+    if (k < 1)
+      throw std::invalid_argument("Number of neighbors must be positive");
+    const std::size_t nk = std::size_t(k);
+    Neighbor_batch out(number_of_queries(queries), nk);
+    if (size() == 0)
+      return out;
+    int* indices = out.index_data();
+    double* distances = out.distance_data();
+    for_each_neighbor(queries, nk, eps, [&](std::size_t q, std::size_t n, int i, double d)
+    {
+      indices[q * nk + n] = i;
+      distances[q * nk + n] = d;
+    });
+    return out;
+  }
+
+  // Label of each query propagated from `labels` (one per point, negative
+  // for the unlabeled ones): the most frequent label among the labeled points
+  // of its k nearest neighbors, the closest of the tied labels winning, and
+  // -1 if none of them is labeled
+  SWIG_CGAL::Buffer<int> knn_labels(SWIG_CGAL::Buffer<float> queries, SWIG_CGAL::Buffer<int> labels, int k) const
+  {
+    if (k < 1)
+      throw std::invalid_argument("Number of neighbors must be positive");
+    if (labels.size() != std::size_t(size()))
+      throw std::invalid_argument("Expecting one label per point");
+    const std::size_t nk = std::size_t(k);
+    const std::size_t nb_queries = number_of_queries(queries);
+    std::vector<int> neighbors(nb_queries * nk, -1);
+    if (size() != 0)
+      for_each_neighbor(queries, nk, 0., [&](std::size_t q, std::size_t n, int i, double)
+                        { neighbors[q * nk + n] = labels[std::size_t(i)]; });
+
+    std::vector<int> out(nb_queries, -1);
+    CGAL::for_each<SWIG_Spatial_searching::Concurrency_tag>
+      (SWIG_Spatial_searching::query_rows(nb_queries), [&](const std::size_t& q) -> bool
+       {
+         // counts and rank of the closest neighbor with this label
+         std::map<int, std::pair<std::size_t, std::size_t> > votes;
+         for (std::size_t n = 0; n < nk; ++n)
+         {
+           const int label = neighbors[q * nk + n];
+           if (label < 0) continue;
+           std::pair<std::size_t, std::size_t>& vote = votes.insert(std::make_pair(label, std::make_pair(std::size_t(0), n))).first->second;
+           ++vote.first;
+         }
+         std::size_t best_count = 0, best_rank = nk;
+         for (const auto& vote : votes)
+           if (vote.second.first > best_count
+               || (vote.second.first == best_count && vote.second.second < best_rank))
+           {
+             best_count = vote.second.first;
+             best_rank = vote.second.second;
+             out[q] = vote.first;
+           }
+         return true;
+       });
+    return SWIG_CGAL::Buffer<int>(std::move(out));
+  }
+};
+
+#endif //SWIG_CGAL_SPATIAL_SEARCHING_KD_TREE_D_H
@@ -11,6 +11,22 @@
 #include <SWIG_CGAL/Common/Iterator.h>
 #include <boost/shared_ptr.hpp>
 
+#ifndef SWIG
+namespace SWIG_Spatial_searching {
+
+// statistics of a k neighbor search of CGAL, which are protected members of
+// its base class only printed by statistics()
+template <class Search>
+struct Search_statistics : Search
+{
+  static int internal_nodes_visited(const Search& search) { return search.*(&Search_statistics::number_of_internal_nodes_visited); }
+  static int leaf_nodes_visited(const Search& search)     { return search.*(&Search_statistics::number_of_leaf_nodes_visited); }
+  static int items_visited(const Search& search)          { return search.*(&Search_statistics::number_of_items_visited); }
+};
+
+} // namespace SWIG_Spatial_searching
+#endif
+
 template <class Cpp_base,class Query,class Tree>
 class NN_search_wrapper
 {
@@ -40,6 +56,10 @@ public:
   Iterator iterator() {
     return Iterator(data.begin(),data.end());
   }
+//Statistics of the search (to calibrate eps)
+  int number_of_internal_nodes_visited() const {return SWIG_Spatial_searching::Search_statistics<Cpp_base>::internal_nodes_visited(data);}
+  int number_of_leaf_nodes_visited() const     {return SWIG_Spatial_searching::Search_statistics<Cpp_base>::leaf_nodes_visited(data);}
+  int number_of_items_visited() const          {return SWIG_Spatial_searching::Search_statistics<Cpp_base>::items_visited(data);}
 };
 
 template <class Cpp_base,class Query,class Tree>
@@ -0,0 +1,336 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+
+#ifndef SWIG_CGAL_SPATIAL_SEARCHING_NEIGHBOR_BATCH_H
+#define SWIG_CGAL_SPATIAL_SEARCHING_NEIGHBOR_BATCH_H
+
+#include <SWIG_CGAL/Common/Buffer.h>
+#include <SWIG_CGAL/Common/Memory_usage.h>
+#include <SWIG_CGAL/Kernel/typedefs.h>
+#include <SWIG_CGAL/Spatial_searching/typedefs.h>
+#include <SWIG_CGAL/Spatial_searching/NN_search.h>
+
+#include <CGAL/Search_traits_adapter.h>
+#include <CGAL/Orthogonal_k_neighbor_search.h>
+#include <CGAL/Orthogonal_incremental_neighbor_search.h>
+#include <CGAL/Euclidean_distance.h>
+#include <CGAL/property_map.h>
+#include <CGAL/for_each.h>
+
+#include <CGAL/Fuzzy_sphere.h>
+
+#include <boost/iterator/counting_iterator.hpp>
+#include <boost/iterator/function_output_iterator.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+// Result of Kd_tree_wrapper::knn_batch(): a (number_of_queries, k) array of
+// the indices of the neighbors of each query (in the insertion order of the
+// points in the tree), sorted by increasing distance, and the array of the
+// corresponding Euclidean distances. If the tree has less than k points (or
+// if the search ran out of its budget), the missing neighbors have index -1
+// and distance 0. leaf_visit_array() gives the number of leaves of the tree
+// visited by the k nearest neighbor search of each query (0 for the other
+// searches).
+class Neighbor_batch
+{
+  std::shared_ptr<std::vector<int> >    indices_sptr;
+  std::shared_ptr<std::vector<double> > distances_sptr;
+  std::shared_ptr<std::vector<int> >    leaf_visits_sptr;
+  std::size_t m_k;
+
+public:
+  Neighbor_batch()
+    : indices_sptr(new std::vector<int>()), distances_sptr(new std::vector<double>())
+    , leaf_visits_sptr(new std::vector<int>()), m_k(1) {}
+  #ifndef SWIG
+  Neighbor_batch(std::size_t nb_queries, std::size_t k)
+    : indices_sptr(new std::vector<int>(nb_queries * k, -1))
+    , distances_sptr(new std::vector<double>(nb_queries * k, 0.))
+    , leaf_visits_sptr(new std::vector<int>(nb_queries, 0))
+    , m_k(k) {}
+  int*    index_data()       { return indices_sptr->data(); }
+  double* distance_data()    { return distances_sptr->data(); }
+  int*    leaf_visit_data()  { return leaf_visits_sptr->data(); }
+  #endif
+
+  int number_of_queries() const { return int(indices_sptr->size() / m_k); }
+  int k() const { return int(m_k); }
+
+  SWIG_CGAL::Buffer<int> index_array() const
+  {
+    return SWIG_CGAL::Buffer<int>(indices_sptr->data(), indices_sptr->size() / m_k, m_k,
+                                  indices_sptr, true);
+  }
+  SWIG_CGAL::Buffer<double> distance_array() const
+  {
+    return SWIG_CGAL::Buffer<double>(distances_sptr->data(), distances_sptr->size() / m_k, m_k,
+                                     distances_sptr, true);
+  }
+  // (number_of_queries(), 1)
+  SWIG_CGAL::Buffer<int> leaf_visit_array() const
+  {
+    return SWIG_CGAL::Buffer<int>(leaf_visits_sptr->data(), leaf_visits_sptr->size(), 1,
+                                  leaf_visits_sptr, true);
+  }
+  long long total_leaf_visits() const
+  {
+    long long total = 0;
+    for (int n : *leaf_visits_sptr) total += n;
+    return total;
+  }
+};
+
+// Result of the radius_neighbors_csr() functions: the ids of the neighbors of
+// query i are index_array()[offset_array()[i]:offset_array()[i+1]], sorted by
+// increasing id (the compressed sparse row layout of
+// scipy.sparse.csr_matrix).
+class Radius_neighbors
+{
+  std::shared_ptr<std::vector<long long> > offsets_sptr;
+  std::shared_ptr<std::vector<int> >       indices_sptr;
+
+public:
+  Radius_neighbors()
+    : offsets_sptr(new std::vector<long long>(1, 0)), indices_sptr(new std::vector<int>()) {}
+  #ifndef SWIG
+  Radius_neighbors(std::vector<long long>&& offsets, std::vector<int>&& indices)
+    : offsets_sptr(new std::vector<long long>(std::move(offsets)))
+    , indices_sptr(new std::vector<int>(std::move(indices))) {}
+  #endif
+
+  int number_of_queries() const { return int(offsets_sptr->size() - 1); }
+  long long number_of_neighbors() const { return offsets_sptr->back(); }
+
+  // number_of_queries()+1 values
+  SWIG_CGAL::Buffer<long long> offset_array() const
+  {
+    return SWIG_CGAL::Buffer<long long>(offsets_sptr->data(), offsets_sptr->size(), 1,
+                                        offsets_sptr, true);
+  }
+  SWIG_CGAL::Buffer<int> index_array() const
+  {
+    return SWIG_CGAL::Buffer<int>(indices_sptr->data(), indices_sptr->size(), 1,
+                                  indices_sptr, true);
+  }
+  SWIG_CGAL::Buffer<int> count_array() const
+  {
+    std::vector<int> counts(offsets_sptr->size() - 1);
+    for (std::size_t i = 0; i < counts.size(); ++i)
+      counts[i] = int((*offsets_sptr)[i + 1] - (*offsets_sptr)[i]);
+    return SWIG_CGAL::Buffer<int>(std::move(counts));
+  }
+};
+
+#ifndef SWIG
+namespace SWIG_Spatial_searching {
+
+inline std::vector<std::size_t> query_rows(std::size_t nb_queries)
+{
+  std::vector<std::size_t> rows(nb_queries);
+  for (std::size_t i = 0; i < nb_queries; ++i)
+    rows[i] = i;
+  return rows;
+}
+
+// `search(row, output)` reports the ids of the neighbors of the query `row`
+// to the output iterator `output`, and can be called concurrently
+template <class Search>
+std::vector<int> radius_neighbor_counts(std::size_t nb_queries, const Search& search)
+{
+  std::vector<int> counts(nb_queries, 0);
+  CGAL::for_each<Concurrency_tag>
+    (query_rows(nb_queries), [&](const std::size_t& row) -> bool
+     {
+       int n = 0;
+       search(row, boost::make_function_output_iterator([&n](int) { ++n; }));
+       counts[row] = n;
+       return true;
+     });
+  return counts;
+}
+
+// counts the neighbors, then fills the rows (both concurrently)
+template <class Search>
+Radius_neighbors radius_neighbors_csr(std::size_t nb_queries, const Search& search)
+{
+  std::vector<int> counts = radius_neighbor_counts(nb_queries, search);
+  std::vector<long long> offsets(nb_queries + 1, 0);
+  for (std::size_t i = 0; i < nb_queries; ++i)
+    offsets[i + 1] = offsets[i] + counts[i];
+
+  std::vector<int> indices(std::size_t(offsets.back()));
+  CGAL::for_each<Concurrency_tag>
+    (query_rows(nb_queries), [&](const std::size_t& row) -> bool
+     {
+       int* first = indices.data() + offsets[row];
+       int* out = first;
+       search(row, boost::make_function_output_iterator([&out](int id) { *out++ = id; }));
+       std::sort(first, out);
+       return true;
+     });
+  return Radius_neighbors(std::move(offsets), std::move(indices));
+}
+
+// geometric point of a point stored in a tree (the first element of a point with info)
+template <class T>
+struct Geometric_point
+{
+  typedef T type;
+  static const T& get(const T& t) { return t; }
+};
+
+template <class P, class I>
+struct Geometric_point< std::pair<P, I> >
+{
+  typedef P type;
+  static const P& get(const std::pair<P, I>& p) { return p.first; }
+};
+
+// search traits and construction from coordinates of a point type
+template <class Point> struct Indexed_point_traits;
+
+template <>
+struct Indexed_point_traits<EPIC_Kernel::Point_2>
+{
+  typedef CGAL_ST_2 Traits;
+  static const std::size_t dimension = 2;
+  static EPIC_Kernel::Point_2 point(const double* c) { return EPIC_Kernel::Point_2(c[0], c[1]); }
+};
+
+template <>
+struct Indexed_point_traits<EPIC_Kernel::Point_3>
+{
+  typedef CGAL_ST_3 Traits;
+  static const std::size_t dimension = 3;
+  static EPIC_Kernel::Point_3 point(const double* c) { return EPIC_Kernel::Point_3(c[0], c[1], c[2]); }
+};
+
+// kd-tree on the indices of a copy of the points of a tree, used to report
+// neighbors as indices instead of points
+template <class Point>
+class Indexed_kd_tree
+{
+  typedef typename Indexed_point_traits<Point>::Traits                           Base_traits;
+  typedef typename CGAL::Pointer_property_map<Point>::const_type                 Point_map;
+  typedef CGAL::Search_traits_adapter<std::size_t, Point_map, Base_traits>       Traits;
+  typedef CGAL::Distance_adapter<std::size_t, Point_map,
+                                 CGAL::Euclidean_distance<Base_traits> >         Distance;
+  typedef CGAL::Orthogonal_k_neighbor_search<Traits, Distance>                   Search;
+  typedef typename Search::Tree                                                  Tree;
+  typedef CGAL::Orthogonal_incremental_neighbor_search<Traits, Distance,
+                                                       typename Tree::Splitter, Tree> Incremental_search;
+
+  std::vector<Point> m_points;
+  std::unique_ptr<Tree> m_tree;
+
+  Indexed_kd_tree(const Indexed_kd_tree&);
+  Indexed_kd_tree& operator=(const Indexed_kd_tree&);
+
+public:
+  static const std::size_t dimension = Indexed_point_traits<Point>::dimension;
+  static Point point(const double* c) { return Indexed_point_traits<Point>::point(c); }
+
+  template <class Iterator>
+  Indexed_kd_tree(Iterator begin, Iterator end)
+  {
+    typedef Geometric_point<typename std::iterator_traits<Iterator>::value_type> Get_point;
+    for (; begin != end; ++begin)
+      m_points.push_back(Get_point::get(*begin));
+    m_tree.reset(new Tree(boost::counting_iterator<std::size_t>(0),
+                          boost::counting_iterator<std::size_t>(m_points.size()),
+                          typename Tree::Splitter(),
+                          Traits(CGAL::make_property_map(m_points))));
+    // the tree must be built before concurrent queries
+    m_tree->template build<Concurrency_tag>();
+  }
+
+  // the copy of the points as structure, the tree of their indices as
+  // search index
+  SWIG_CGAL::Memory_usage memory_usage() const
+  {
+    const SWIG_CGAL::Memory_usage tree = SWIG_CGAL::internal::kd_tree_memory_usage(*m_tree);
+    return SWIG_CGAL::Memory_usage(SWIG_CGAL::internal::vector_bytes(m_points) + tree.structure(), 0,
+                                   tree.search_index());
+  }
+
+  // reports to `out` the indices of the points at distance at most
+  // `radius` of `center`, up to `epsilon` as with CGAL::Fuzzy_sphere: all the
+  // points at distance at most radius-epsilon and none farther than
+  // radius+epsilon
+  template <class Output>
+  void sphere_search(const double* center, double radius, double epsilon, Output out) const
+  {
+    CGAL::Fuzzy_sphere<Traits> sphere(Indexed_point_traits<Point>::point(center), radius, epsilon,
+                                      m_tree->traits());
+    m_tree->search(boost::make_function_output_iterator([&out](std::size_t i) { *out++ = int(i); }),
+                   sphere);
+  }
+
+  // runs the queries of `coordinates` (`dimension` values per query)
+  void knn_batch(const double* coordinates, std::size_t nb_queries,
+                 std::size_t k, double eps, Neighbor_batch& out) const
+  {
+    int* indices = out.index_data();
+    double* distances = out.distance_data();
+    int* leaf_visits = out.leaf_visit_data();
+    CGAL::for_each<Concurrency_tag>
+      (query_rows(nb_queries), [&](const std::size_t& row) -> bool
+       {
+         Distance distance(CGAL::make_property_map(m_points));
+         Search search(*m_tree, Indexed_point_traits<Point>::point(coordinates + row * dimension),
+                       (unsigned int)k, eps, true, distance);
+         leaf_visits[row] = Search_statistics<Search>::leaf_nodes_visited(search);
+         std::size_t n = 0;
+         for (typename Search::iterator it = search.begin(); it != search.end() && n < k; ++it, ++n)
+         {
+           indices[row * k + n] = int(it->first);
+           distances[row * k + n] = distance.inverse_of_transformed_distance(it->second);
+         }
+         return true;
+       });
+  }
+
+  // Incremental search of the (at most max_count) points closest to `query`
+  // at distance at most `max_distance` and accepted by `accept(index)`,
+  // written to `indices` and `distances` by increasing distance. The search
+  // stops after `max_pops` points of the tree (0 for no limit), accepted or
+  // not. Returns the number of points found.
+  template <class Accept>
+  std::size_t filtered_search(const Point& query, std::size_t max_count, double max_distance,
+                              std::size_t max_pops, const Accept& accept,
+                              int* indices, double* distances) const
+  {
+    if (m_points.empty())
+      return 0;
+    Distance distance(CGAL::make_property_map(m_points));
+    const double max_transformed = distance.transformed_distance(max_distance);
+    Incremental_search search(*m_tree, query, 0., true, distance);
+    std::size_t n = 0, pops = 0;
+    for (typename Incremental_search::iterator it = search.begin();
+         it != search.end() && n < max_count && (max_pops == 0 || pops < max_pops); ++it, ++pops)
+    {
+      if (it->second > max_transformed)
+        break;
+      if (!accept(it->first))
+        continue;
+      indices[n] = int(it->first);
+      distances[n] = distance.inverse_of_transformed_distance(it->second);
+      ++n;
+    }
+    return n;
+  }
+};
+
+} // namespace SWIG_Spatial_searching
+#endif
+
+#endif //SWIG_CGAL_SPATIAL_SEARCHING_NEIGHBOR_BATCH_H
@@ -0,0 +1,293 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+
+#ifndef SWIG_CGAL_SPATIAL_SEARCHING_VOXEL_GRID_H
+#define SWIG_CGAL_SPATIAL_SEARCHING_VOXEL_GRID_H
+
+#include <SWIG_CGAL/Common/Buffer.h>
+#include <SWIG_CGAL/Kernel/Point_3.h>
+#include <SWIG_CGAL/Spatial_searching/Neighbor_batch.h>
+#include <SWIG_CGAL/Spatial_searching/typedefs.h>
+
+#include <CGAL/for_each.h>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/parallel_sort.h>
+#endif
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// Uniform grid of cubic voxels of side cell_size(), anchored at the origin
+// (voxel (i,j,k) covers [i,i+1)x[j,j+1)x[k,k+1) times cell_size(), as the
+// cells of grid_simplify_point_set()). The points (coordinates copied from
+// a (n,3) array, with optional ids, the row numbers otherwise) are stored
+// sorted by voxel, and the occupied voxels are found through a hash table.
+// Lighter than a kd-tree for fixed-radius queries on roughly uniform data.
+// Copies share the same grid.
+class Voxel_grid_3
+{
+#ifndef SWIG
+  struct Cell_key
+  {
+    std::int32_t x, y, z;
+    bool operator== (const Cell_key& other) const
+    { return x == other.x && y == other.y && z == other.z; }
+    bool operator< (const Cell_key& other) const
+    {
+      if (x != other.x) return x < other.x;
+      if (y != other.y) return y < other.y;
+      return z < other.z;
+    }
+  };
+
+  struct Cell_key_hash
+  {
+    std::size_t operator() (const Cell_key& key) const
+    {
+      std::uint64_t h = std::uint64_t(std::uint32_t(key.x)) * 73856093ULL;
+      h ^= std::uint64_t(std::uint32_t(key.y)) * 19349663ULL;
+      h ^= std::uint64_t(std::uint32_t(key.z)) * 83492791ULL;
+      return std::size_t(h);
+    }
+  };
+
+  struct Data
+  {
+    double cell_size;
+    std::vector<double> coordinates;    // 3 values per point, sorted by voxel
+    std::vector<std::int32_t> ids;      // sorted by voxel
+    std::vector<Cell_key> keys;         // occupied voxels, sorted
+    std::vector<long long> offsets;     // points of voxel v: [offsets[v],offsets[v+1])
+    std::unordered_map<Cell_key, std::int32_t, Cell_key_hash> voxels;
+  };
+#endif
+
+  std::shared_ptr<Data> data_sptr;
+
+#ifndef SWIG
+  std::int32_t cell_coordinate (double c) const
+  {
+    double cell = std::floor (c / data_sptr->cell_size);
+    if (!(cell >= double(std::numeric_limits<std::int32_t>::min())
+          && cell <= double(std::numeric_limits<std::int32_t>::max())))
+      throw std::invalid_argument("Point out of the range of the grid (cell size is too small)");
+    return std::int32_t(cell);
+  }
+
+  Cell_key cell_key (const double* p) const
+  {
+    Cell_key key = { cell_coordinate (p[0]), cell_coordinate (p[1]), cell_coordinate (p[2]) };
+    return key;
+  }
+
+  void build (std::vector<double>&& coordinates, std::vector<std::int32_t>&& ids, bool parallel)
+  {
+    Data& data = *data_sptr;
+    const std::size_t nb_points = ids.size();
+
+    std::vector<std::size_t> rows = SWIG_Spatial_searching::query_rows (nb_points);
+    std::vector<std::pair<Cell_key, std::int32_t> > sorted (nb_points);
+    auto compute_key = [&](const std::size_t& row) -> bool
+    {
+      sorted[row] = std::make_pair (cell_key (coordinates.data() + 3 * row), std::int32_t(row));
+      return true;
+    };
+    if (parallel)
+      CGAL::for_each<SWIG_Spatial_searching::Concurrency_tag> (rows, compute_key);
+    else
+      CGAL::for_each<CGAL::Sequential_tag> (rows, compute_key);
+
+#ifdef CGAL_LINKED_WITH_TBB
+    if (parallel)
+      tbb::parallel_sort (sorted.begin(), sorted.end());
+    else
+#endif
+      std::sort (sorted.begin(), sorted.end());
+
+    data.coordinates.resize (coordinates.size());
+    data.ids.resize (nb_points);
+    for (std::size_t i = 0; i < nb_points; ++ i)
+    {
+      std::size_t row = std::size_t(sorted[i].second);
+      std::copy (coordinates.begin() + 3 * row, coordinates.begin() + 3 * row + 3,
+                 data.coordinates.begin() + 3 * i);
+      data.ids[i] = ids[row];
+      if (i == 0 || !(sorted[i].first == sorted[i - 1].first))
+      {
+        data.voxels[sorted[i].first] = std::int32_t(data.keys.size());
+        data.keys.push_back (sorted[i].first);
+        data.offsets.push_back ((long long)(i));
+      }
+    }
+    data.offsets.push_back ((long long)(nb_points));
+  }
+
+  void check_queries (const SWIG_CGAL::Buffer<double>& queries) const
+  {
+    if (queries.size() % 3 != 0)
+      throw std::invalid_argument("The number of coordinates must be a multiple of 3");
+  }
+#endif
+
+public:
+
+  Voxel_grid_3 (SWIG_CGAL::Buffer<double> points, double cell_size, bool parallel = true)
+    : data_sptr(new Data())
+  {
+    if (points.size() % 3 != 0)
+      throw std::invalid_argument("The number of coordinates must be a multiple of 3");
+    std::vector<std::int32_t> ids (points.size() / 3);
+    for (std::size_t i = 0; i < ids.size(); ++ i)
+      ids[i] = std::int32_t(i);
+    init (std::vector<double>(points.data(), points.data() + points.size()), std::move (ids),
+          cell_size, parallel);
+  }
+
+  Voxel_grid_3 (SWIG_CGAL::Buffer<double> points, SWIG_CGAL::Buffer<int> ids,
+                double cell_size, bool parallel = true)
+    : data_sptr(new Data())
+  {
+    if (points.size() != 3 * ids.size())
+      throw std::invalid_argument("Expecting 3 coordinates per id");
+    init (std::vector<double>(points.data(), points.data() + points.size()),
+          std::vector<std::int32_t>(ids.data(), ids.data() + ids.size()), cell_size, parallel);
+  }
+
+#ifndef SWIG
+  // `coordinates` has 3 values per id
+  Voxel_grid_3 (std::vector<double>&& coordinates, std::vector<std::int32_t>&& ids,
+                double cell_size, bool parallel = true)
+    : data_sptr(new Data())
+  {
+    init (std::move (coordinates), std::move (ids), cell_size, parallel);
+  }
+
+  void init (std::vector<double>&& coordinates, std::vector<std::int32_t>&& ids,
+             double cell_size, bool parallel)
+  {
+    if (!(cell_size > 0.))
+      throw std::invalid_argument("Cell size must be positive");
+    data_sptr->cell_size = cell_size;
+    build (std::move (coordinates), std::move (ids), parallel);
+  }
+
+  // reports to `out` the ids of the points at distance at most `radius` of `center`
+  template <class Output>
+  void sphere_search (const double* center, double radius, Output out) const
+  {
+    const Data& data = *data_sptr;
+    const double squared_radius = radius * radius;
+    double min[3] = { center[0] - radius, center[1] - radius, center[2] - radius };
+    double max[3] = { center[0] + radius, center[1] + radius, center[2] + radius };
+    Cell_key first = cell_key (min), last = cell_key (max);
+
+    Cell_key key;
+    for (key.x = first.x; key.x <= last.x; ++ key.x)
+      for (key.y = first.y; key.y <= last.y; ++ key.y)
+        for (key.z = first.z; key.z <= last.z; ++ key.z)
+        {
+          auto it = data.voxels.find (key);
+          if (it == data.voxels.end())
+            continue;
+          for (long long i = data.offsets[it->second]; i < data.offsets[it->second + 1]; ++ i)
+          {
+            const double* p = data.coordinates.data() + 3 * i;
+            double sd = (p[0] - center[0]) * (p[0] - center[0])
+              + (p[1] - center[1]) * (p[1] - center[1])
+              + (p[2] - center[2]) * (p[2] - center[2]);
+            if (sd <= squared_radius)
+              *out++ = data.ids[std::size_t(i)];
+          }
+        }
+  }
+#endif
+
+  double cell_size() const { return data_sptr->cell_size; }
+  int size() const { return int(data_sptr->ids.size()); }
+  int number_of_voxels() const { return int(data_sptr->keys.size()); }
+
+  // index of the voxel containing `p`, -1 if it is empty
+  int voxel_of (const Point_3& p) const
+  {
+    double c[3] = { p.x(), p.y(), p.z() };
+    auto it = data_sptr->voxels.find (cell_key (c));
+    return it == data_sptr->voxels.end() ? -1 : int(it->second);
+  }
+
+  // ids of the points sorted by voxel
+  SWIG_CGAL::Buffer<int> index_array() const
+  {
+    return SWIG_CGAL::Buffer<int>(data_sptr->ids.data(), data_sptr->ids.size(), 1,
+                                  data_sptr, true);
+  }
+
+  // number_of_voxels()+1 offsets in index_array() of the points of each voxel
+  SWIG_CGAL::Buffer<long long> voxel_offset_array() const
+  {
+    return SWIG_CGAL::Buffer<long long>(std::vector<long long>(data_sptr->offsets));
+  }
+
+  // (number_of_voxels(), 3) integer coordinates of the voxels
+  SWIG_CGAL::Buffer<int> voxel_coordinate_array() const
+  {
+    std::vector<int> out;
+    out.reserve (3 * data_sptr->keys.size());
+    for (const Cell_key& key : data_sptr->keys)
+    {
+      out.push_back (key.x);
+      out.push_back (key.y);
+      out.push_back (key.z);
+    }
+    return SWIG_CGAL::Buffer<int>(std::move (out), 3);
+  }
+
+  // id of the first point of each voxel: the points kept by a grid
+  // simplification with this cell size
+  SWIG_CGAL::Buffer<int> representative_array() const
+  {
+    std::vector<int> out (data_sptr->keys.size());
+    for (std::size_t v = 0; v < out.size(); ++ v)
+      out[v] = data_sptr->ids[std::size_t(data_sptr->offsets[v])];
+    return SWIG_CGAL::Buffer<int>(std::move (out));
+  }
+
+  // ids of the points at distance at most `radius` of `center`
+  SWIG_CGAL::Buffer<int> search (const Point_3& center, double radius) const
+  {
+    double c[3] = { center.x(), center.y(), center.z() };
+    std::vector<int> out;
+    sphere_search (c, radius, std::back_inserter (out));
+    return SWIG_CGAL::Buffer<int>(std::move (out));
+  }
+
+  // same as Index_kd_tree_3::radius_neighbors_csr()
+  Radius_neighbors radius_neighbors_csr (SWIG_CGAL::Buffer<double> queries, double radius) const
+  {
+    check_queries (queries);
+    return SWIG_Spatial_searching::radius_neighbors_csr
+      (queries.size() / 3, [&](std::size_t row, auto out)
+       { sphere_search (queries.data() + 3 * row, radius, out); });
+  }
+
+  SWIG_CGAL::Buffer<int> radius_neighbor_counts (SWIG_CGAL::Buffer<double> queries, double radius) const
+  {
+    check_queries (queries);
+    return SWIG_CGAL::Buffer<int>(SWIG_Spatial_searching::radius_neighbor_counts
+      (queries.size() / 3, [&](std::size_t row, auto out)
+       { sphere_search (queries.data() + 3 * row, radius, out); }));
+  }
+};
+
+#endif //SWIG_CGAL_SPATIAL_SEARCHING_VOXEL_GRID_H
@@ -8,7 +8,11 @@
 #define SWIG_CGAL_SPATIAL_SEARCHING_ALL_INCLUDES_H
  
 #include <SWIG_CGAL/Spatial_searching/typedefs.h>
+#include <SWIG_CGAL/Spatial_searching/Neighbor_batch.h>
 #include <SWIG_CGAL/Spatial_searching/Kd_tree.h>
+#include <SWIG_CGAL/Spatial_searching/Index_kd_tree.h>
+#include <SWIG_CGAL/Spatial_searching/Kd_tree_d.h>
+#include <SWIG_CGAL/Spatial_searching/Voxel_grid.h>
 #include <SWIG_CGAL/Spatial_searching/NN_search.h>
 #include <SWIG_CGAL/Spatial_searching/Fuzzy_objects.h>
 
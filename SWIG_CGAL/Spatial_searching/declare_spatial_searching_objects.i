@@ -15,7 +15,7 @@
 // --DIM is the dimension of the point
 
 %define SWIG_CGAL_declare_spatial_searching_objects(EXPOSEDNAMEPREFIX,OTAG,POINT,DIM,NN_SEARCH_WRAPPER)
-%typemap(javaimports)       Kd_tree_wrapper%{import CGAL.Kernel.POINT;import java.util.Iterator; import java.util.Collection;%}
+%typemap(javaimports)       Kd_tree_wrapper%{import CGAL.Kernel.POINT; import CGAL.Kernel.Memory_usage;import java.util.Iterator; import java.util.Collection;%}
 %template(EXPOSEDNAMEPREFIX##_neighbor_search_tree_##DIM) Kd_tree_wrapper<CGAL_##OTAG##_T_##DIM,POINT,SWIG_FS_##DIM,SWIG_FB_##DIM>;
 %typemap(javaimports)       NN_SEARCH_WRAPPER%{import CGAL.Kernel.POINT;%}
 %template(EXPOSEDNAMEPREFIX##_neighbor_search_##DIM) NN_SEARCH_WRAPPER<CGAL_##OTAG##_S_##DIM,POINT,SWIG_##OTAG##_T_##DIM>;
@@ -106,7 +106,7 @@ SWIG_CGAL_output_iterator_typemap_in(Kd_tree_output_iterator_WI_3,SWIG_Point_WI_
 
 //macros with info
 %define SWIG_CGAL_declare_spatial_searching_objects_with_info(EXPOSEDNAMEPREFIX,OTAG,POINT,DIM,NN_SEARCH_WRAPPER)
-%typemap(javaimports)       Kd_tree_wrapper%{import CGAL.Kernel.POINT; import CGAL.Java.JavaData; import java.util.Iterator; import java.util.Collection;%}
+%typemap(javaimports)       Kd_tree_wrapper%{import CGAL.Kernel.POINT; import CGAL.Kernel.Memory_usage; import CGAL.Java.JavaData; import java.util.Iterator; import java.util.Collection;%}
 %template(EXPOSEDNAMEPREFIX##_neighbor_search_tree_with_info_##DIM) Kd_tree_wrapper<CGAL_##OTAG##_WI_T_##DIM,std::pair<POINT,JavaData>,SWIG_FS_WI_##DIM,SWIG_FB_WI_##DIM>;
 %typemap(javaimports)       NN_SEARCH_WRAPPER%{import CGAL.Kernel.POINT; import CGAL.Java.JavaData;%}
 %template(EXPOSEDNAMEPREFIX##_neighbor_search_with_info_##DIM) NN_SEARCH_WRAPPER<CGAL_##OTAG##_WI_S_##DIM,POINT,SWIG_##OTAG##_WI_T_##DIM>;
@@ -46,4 +46,12 @@ typedef CGAL_I_S_3 ::Tree                                         CGAL_I_T_3;
 typedef CGAL_K_S_3 ::Tree                                         CGAL_K_T_3;
 typedef CGAL_OK_S_3::Tree                                         CGAL_OK_T_3;
 
+namespace SWIG_Spatial_searching {
+#ifdef CGAL_LINKED_WITH_TBB
+typedef CGAL::Parallel_tag Concurrency_tag;
+#else
+typedef CGAL::Sequential_tag Concurrency_tag;
+#endif
+} // namespace SWIG_Spatial_searching
+
 #endif //SWIG_CGAL_SPATIAL_SEARCHING_TYPEDEFS_H
@@ -0,0 +1,41 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+%define SURFACE_MESH_DOCSTRING
+"SWIG wrapper for the CGAL Surface Mesh package provided under the GPL-3.0+ license"
+%enddef
+%module (package="CGAL", docstring=SURFACE_MESH_DOCSTRING) CGAL_Surface_mesh
+
+%include "SWIG_CGAL/common.i"
+Decl_void_type()
+
+SWIG_CGAL_add_java_loadLibrary(CGAL_Surface_mesh)
+SWIG_CGAL_package_common()
+
+%import  "SWIG_CGAL/Common/Macros.h"
+%import  "SWIG_CGAL/Kernel/CGAL_Kernel.i"
+
+//include files
+%{
+#include <SWIG_CGAL/Surface_mesh/all_includes.h>
+%}
+
+%pragma(java) jniclassimports=%{import CGAL.Kernel.Point_3;%}
+
+#if !SWIG_CGAL_NON_SUPPORTED_TARGET_LANGUAGE
+%include "SWIG_CGAL/typemaps.i"
+SWIG_CGAL_buffer_of_double_typemap_in
+SWIG_CGAL_buffer_of_int_typemap_in
+SWIG_CGAL_buffer_of_double_typemap_out
+SWIG_CGAL_buffer_of_int_typemap_out
+#endif
+
+//definitions
+%typemap(javaimports) Surface_mesh_3 %{import CGAL.Kernel.Point_3;%}
+%include "SWIG_CGAL/Surface_mesh/Surface_mesh_3.h"
+
+#ifdef SWIG_CGAL_HAS_Surface_mesh_USER_PACKAGE
+%include "SWIG_CGAL/User_packages/Surface_mesh/extensions.i"
+#endif
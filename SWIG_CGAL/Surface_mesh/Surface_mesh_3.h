@@ -0,0 +1,170 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+
+#ifndef SWIG_CGAL_SURFACE_MESH_SURFACE_MESH_3_H
+#define SWIG_CGAL_SURFACE_MESH_SURFACE_MESH_3_H
+
+#include <SWIG_CGAL/Kernel/typedefs.h>
+#include <SWIG_CGAL/Common/Buffer.h>
+#include <SWIG_CGAL/Common/Macros.h>
+#include <SWIG_CGAL/Kernel/Point_3.h>
+#include <SWIG_CGAL/Surface_mesh/typedefs.h>
+
+#include <CGAL/boost/graph/helpers.h>
+#include <boost/shared_ptr.hpp>
+
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+// Index based halfedge data structure. Vertices, halfedges, edges and faces
+// are designated by their index; removed elements keep their index until
+// collect_garbage() is called.
+class Surface_mesh_3
+{
+  boost::shared_ptr<Surface_mesh_3_> data_sptr;
+
+#ifndef SWIG
+  typedef Surface_mesh_3_::Vertex_index Vertex_index;
+  typedef Surface_mesh_3_::Face_index   Face_index;
+
+  Vertex_index vertex(int v) const
+  {
+    if (v < 0 || std::size_t(v) >= get_data().num_vertices() || get_data().is_removed(Vertex_index(v)))
+      throw std::invalid_argument("Invalid vertex index");
+    return Vertex_index(v);
+  }
+
+  void check_no_garbage() const
+  {
+    if (get_data().has_garbage())
+      throw std::runtime_error("The mesh has removed elements (call collect_garbage())");
+  }
+#endif
+
+public:
+  #ifndef SWIG
+  typedef Surface_mesh_3_ cpp_base;
+  const cpp_base& get_data() const {return *data_sptr;}
+        cpp_base& get_data()       {return *data_sptr;}
+  boost::shared_ptr<cpp_base> shared_ptr() {return data_sptr;}
+  Surface_mesh_3(const cpp_base& base):data_sptr(new cpp_base(base)){}
+  #endif
+
+//Creation
+  Surface_mesh_3():data_sptr(new cpp_base()){}
+  Surface_mesh_3(const char* off_filename):data_sptr(new cpp_base()){
+    std::ifstream file(off_filename);
+    if (!file) std::cerr << "Error cannot open file: " << off_filename << std::endl;
+    else{
+      file >> get_data();
+      file.close();
+    }
+  }
+  // from a (V,3) array of vertices and a (F,k) array of vertex indices of
+  // polygons with k vertices, which must form an oriented 2-manifold (a
+  // one-dimensional array holds triangles)
+  Surface_mesh_3(SWIG_CGAL::Buffer<double> vertices, SWIG_CGAL::Buffer<int> faces)
+    : data_sptr(new cpp_base())
+  {
+    if (vertices.size() % 3 != 0)
+      throw std::invalid_argument("Expecting (V,3) vertices");
+    const std::size_t nb_vertices = vertices.size() / 3;
+    const std::size_t k = faces.cols() == 1 ? 3 : faces.cols();
+    if (k < 3 || faces.size() % k != 0)
+      throw std::invalid_argument("Expecting (F,k) vertex indices with k>=3");
+    const std::size_t nb_faces = faces.size() / k;
+    cpp_base& mesh = get_data();
+    mesh.reserve(cpp_base::size_type(nb_vertices), cpp_base::size_type(faces.size()), cpp_base::size_type(nb_faces));
+    for (std::size_t i = 0; i < nb_vertices; ++i)
+      mesh.add_vertex(EPIC_Kernel::Point_3(vertices[3*i], vertices[3*i+1], vertices[3*i+2]));
+    std::vector<Vertex_index> polygon(k);
+    for (std::size_t f = 0; f < nb_faces; ++f)
+    {
+      for (std::size_t j = 0; j < k; ++j)
+      {
+        int v = faces[k*f+j];
+        if (v < 0 || std::size_t(v) >= nb_vertices)
+          throw std::invalid_argument("Vertex index out of range");
+        polygon[j] = Vertex_index(v);
+      }
+      if (mesh.add_face(polygon) == cpp_base::null_face())
+        throw std::invalid_argument("The faces do not form an oriented 2-manifold");
+    }
+  }
+  void write_to_file(const char* off_filename, int prec=5) const
+  {
+    std::ofstream file(off_filename);
+    if (!file) std::cerr << "Error cannot create file: " << off_filename << std::endl;
+    else{
+      file << std::setprecision(prec) << get_data();
+      file.close();
+    }
+  }
+//Modifiers
+  int add_vertex(const Point_3& p) {return int(get_data().add_vertex(p.get_data()));}
+  // -1 if the face cannot be added without breaking the orientability
+  int add_face(int v0, int v1, int v2)
+  {
+    Face_index f = get_data().add_face(vertex(v0), vertex(v1), vertex(v2));
+    return f == cpp_base::null_face() ? -1 : int(f);
+  }
+  void reserve(int nb_vertices, int nb_edges, int nb_faces)
+  {
+    get_data().reserve(cpp_base::size_type(nb_vertices), cpp_base::size_type(nb_edges), cpp_base::size_type(nb_faces));
+  }
+  SWIG_CGAL_FORWARD_CALL_0(void,clear)
+  SWIG_CGAL_FORWARD_CALL_0(void,collect_garbage)
+//Access Member Functions
+  SWIG_CGAL_FORWARD_CALL_0(bool,is_empty)
+  SWIG_CGAL_FORWARD_CALL_0(bool,has_garbage)
+  int number_of_vertices() const {return int(get_data().number_of_vertices());}
+  int number_of_halfedges() const {return int(get_data().number_of_halfedges());}
+  int number_of_edges() const {return int(get_data().number_of_edges());}
+  int number_of_faces() const {return int(get_data().number_of_faces());}
+  Point_3 point(int v) const {return Point_3(get_data().point(vertex(v)));}
+  void set_point(int v, const Point_3& p) {get_data().point(vertex(v)) = p.get_data();}
+//Predicates
+  bool is_valid() const {return get_data().is_valid(false);}
+  bool is_closed() const {return CGAL::is_closed(get_data());}
+  bool is_triangle_mesh() const {return CGAL::is_triangle_mesh(get_data());}
+//Arrays, the row of an element is its index
+  // (number_of_vertices(), 3)
+  SWIG_CGAL::Buffer<double> vertex_array() const
+  {
+    check_no_garbage();
+    std::vector<double> out;
+    out.reserve(3 * get_data().number_of_vertices());
+    for (Vertex_index v : get_data().vertices())
+    {
+      const EPIC_Kernel::Point_3& p = get_data().point(v);
+      out.push_back(p.x());
+      out.push_back(p.y());
+      out.push_back(p.z());
+    }
+    return SWIG_CGAL::Buffer<double>(std::move(out), 3);
+  }
+  // (number_of_faces(), 3), for triangle meshes
+  SWIG_CGAL::Buffer<int> face_array() const
+  {
+    check_no_garbage();
+    if (!is_triangle_mesh())
+      throw std::runtime_error("The mesh is not a triangle mesh");
+    std::vector<int> out;
+    out.reserve(3 * get_data().number_of_faces());
+    for (Face_index f : get_data().faces())
+      for (Vertex_index v : CGAL::vertices_around_face(get_data().halfedge(f), get_data()))
+        out.push_back(int(v));
+    return SWIG_CGAL::Buffer<int>(std::move(out), 3);
+  }
+//Deep copy
+  Surface_mesh_3 deepcopy() const {return Surface_mesh_3(get_data());}
+  void deepcopy(const Surface_mesh_3& other){get_data()=other.get_data();}
+};
+
+#endif //SWIG_CGAL_SURFACE_MESH_SURFACE_MESH_3_H
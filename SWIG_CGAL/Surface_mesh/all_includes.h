@@ -0,0 +1,12 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+#ifndef SWIG_CGAL_SURFACE_MESH_ALL_INCLUDES_H
+#define SWIG_CGAL_SURFACE_MESH_ALL_INCLUDES_H
+
+#include <SWIG_CGAL/Surface_mesh/typedefs.h>
+#include <SWIG_CGAL/Surface_mesh/Surface_mesh_3.h>
+
+#endif //SWIG_CGAL_SURFACE_MESH_ALL_INCLUDES_H
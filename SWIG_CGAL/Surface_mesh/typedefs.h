@@ -0,0 +1,14 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+#ifndef SWIG_CGAL_SURFACE_MESH_TYPEDEFS_H
+#define SWIG_CGAL_SURFACE_MESH_TYPEDEFS_H
+
+#include <SWIG_CGAL/Kernel/typedefs.h>
+#include <CGAL/Surface_mesh.h>
+
+typedef CGAL::Surface_mesh<EPIC_Kernel::Point_3> Surface_mesh_3_;
+
+#endif //SWIG_CGAL_SURFACE_MESH_TYPEDEFS_H
@@ -0,0 +1,98 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+%define SMS_DOCSTRING
+"SWIG wrapper for the CGAL Triangulated Surface Mesh Simplification package provided under the GPL-3.0+ license"
+%enddef
+%module (package="CGAL", docstring=SMS_DOCSTRING) CGAL_Surface_mesh_simplification
+
+%include "SWIG_CGAL/common.i"
+Decl_void_type()
+
+SWIG_CGAL_add_java_loadLibrary(CGAL_Surface_mesh_simplification)
+SWIG_CGAL_package_common()
+
+%import  "SWIG_CGAL/Common/Macros.h"
+%import  "SWIG_CGAL/Kernel/CGAL_Kernel.i"
+
+//include files
+%{
+  #include <SWIG_CGAL/Polyhedron_3/all_includes.h>
+  #include <SWIG_CGAL/Surface_mesh/all_includes.h>
+  #include <SWIG_CGAL/Surface_mesh_simplification/Edge_collapse.h>
+%}
+
+%pragma(java) jniclassimports=%{
+import CGAL.Polyhedron_3.Polyhedron_3;
+import CGAL.Surface_mesh.Surface_mesh_3;
+%}
+
+%pragma(java) moduleimports=%{
+import CGAL.Polyhedron_3.Polyhedron_3;
+import CGAL.Surface_mesh.Surface_mesh_3;
+%};
+
+//import definitions of Polyhedron and Surface_mesh objects
+%import "SWIG_CGAL/Polyhedron_3/CGAL_Polyhedron_3.i"
+SWIG_CGAL_import_Polyhedron_3_SWIG_wrapper
+%import "SWIG_CGAL/Surface_mesh/CGAL_Surface_mesh.i"
+
+%include "SWIG_CGAL/typemaps.i"
+SWIG_CGAL_buffer_of_int_typemap_out
+
+%include "std_string.i"
+%include "std_vector.i"
+%typemap(javaimports) std::vector<Polyhedron_3_SWIG_wrapper>
+  %{ import CGAL.Polyhedron_3.Polyhedron_3; %}
+%template(Polyhedron_3_Vector) std::vector<Polyhedron_3_SWIG_wrapper>;
+%typemap(javaimports) std::vector<Surface_mesh_3>
+  %{ import CGAL.Surface_mesh.Surface_mesh_3; %}
+%template(Surface_mesh_3_Vector) std::vector<Surface_mesh_3>;
+
+//the meshes are only read and modified in C++: the decimation runs without the GIL
+SWIG_CGAL_release_gil(edge_collapse)
+SWIG_CGAL_release_gil(edge_collapse_batch)
+
+//global functions
+%inline %{
+  // see SWIG_Surface_mesh_simplification::edge_collapse(); policy is one of
+  // "plane", "probabilistic_plane", "triangle", "probabilistic_triangle"
+  // (Garland-Heckbert) or "lindstrom_turk"
+  int edge_collapse(Polyhedron_3_SWIG_wrapper& P, int face_count, double max_error=0, const std::string& policy="plane")
+  {
+    return SWIG_Surface_mesh_simplification::edge_collapse(P.get_data(), face_count, max_error, policy);
+  }
+  int edge_collapse(Surface_mesh_3& M, int face_count, double max_error=0, const std::string& policy="plane")
+  {
+    return SWIG_Surface_mesh_simplification::edge_collapse(M.get_data(), face_count, max_error, policy);
+  }
+
+  // the meshes decimated concurrently, each one to face_ratio times its number of faces
+  SWIG_CGAL::Buffer<int> edge_collapse_batch(const std::vector<Polyhedron_3_SWIG_wrapper>& meshes, double face_ratio,
+                                             double max_error=0, const std::string& policy="plane")
+  {
+    // the copies of the wrappers share the polyhedra
+    std::vector<Polyhedron_3_SWIG_wrapper::cpp_base*> parts;
+    parts.reserve(meshes.size());
+    for (const Polyhedron_3_SWIG_wrapper& m : meshes)
+      parts.push_back(&const_cast<Polyhedron_3_SWIG_wrapper&>(m).get_data());
+    return SWIG_CGAL::Buffer<int>(SWIG_Surface_mesh_simplification::edge_collapse_batch(parts, face_ratio, max_error, policy));
+  }
+  SWIG_CGAL::Buffer<int> edge_collapse_batch(const std::vector<Surface_mesh_3>& meshes, double face_ratio,
+                                             double max_error=0, const std::string& policy="plane")
+  {
+    std::vector<Surface_mesh_3::cpp_base*> parts;
+    parts.reserve(meshes.size());
+    for (const Surface_mesh_3& m : meshes)
+      parts.push_back(&const_cast<Surface_mesh_3&>(m).get_data());
+    return SWIG_CGAL::Buffer<int>(SWIG_Surface_mesh_simplification::edge_collapse_batch(parts, face_ratio, max_error, policy));
+  }
+%}
+%feature("except","") edge_collapse;
+%feature("except","") edge_collapse_batch;
+
+#ifdef SWIG_CGAL_HAS_Surface_mesh_simplification_USER_PACKAGE
+%include "SWIG_CGAL/User_packages/Surface_mesh_simplification/extensions.i"
+#endif
@@ -0,0 +1,168 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+
+#ifndef SWIG_CGAL_SURFACE_MESH_SIMPLIFICATION_EDGE_COLLAPSE_H
+#define SWIG_CGAL_SURFACE_MESH_SIMPLIFICATION_EDGE_COLLAPSE_H
+
+#include <SWIG_CGAL/Kernel/typedefs.h>
+
+#include <CGAL/version.h>
+#include <CGAL/boost/graph/helpers.h>
+#include <CGAL/for_each.h>
+#include <CGAL/number_utils.h>
+#include <CGAL/tags.h>
+#include <CGAL/Surface_mesh_simplification/edge_collapse.h>
+#include <CGAL/Surface_mesh_simplification/Policies/Edge_collapse/LindstromTurk_cost.h>
+#include <CGAL/Surface_mesh_simplification/Policies/Edge_collapse/LindstromTurk_placement.h>
+#if CGAL_VERSION_NR >= 1050600000
+#include <CGAL/Surface_mesh_simplification/Policies/Edge_collapse/GarlandHeckbert_plane_policies.h>
+#include <CGAL/Surface_mesh_simplification/Policies/Edge_collapse/GarlandHeckbert_probabilistic_plane_policies.h>
+#include <CGAL/Surface_mesh_simplification/Policies/Edge_collapse/GarlandHeckbert_triangle_policies.h>
+#include <CGAL/Surface_mesh_simplification/Policies/Edge_collapse/GarlandHeckbert_probabilistic_triangle_policies.h>
+#elif CGAL_VERSION_NR >= 1050300000
+#include <CGAL/Surface_mesh_simplification/Policies/Edge_collapse/GarlandHeckbert_policies.h>
+#endif
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace SWIG_Surface_mesh_simplification {
+
+#ifdef CGAL_LINKED_WITH_TBB
+typedef CGAL::Parallel_tag Concurrency_tag;
+#else
+typedef CGAL::Sequential_tag Concurrency_tag;
+#endif
+
+// Stops when the mesh has at most `face_count` faces, or when the cheapest
+// collapse costs more than `max_cost`
+struct Face_count_or_cost_stop_predicate
+{
+  std::size_t face_count;
+  double max_cost;
+
+  template <class FT, class Profile>
+  bool operator()(const FT& current_cost, const Profile& profile, std::size_t, std::size_t) const
+  {
+    return num_faces(profile.surface_mesh()) <= face_count || CGAL::to_double(current_cost) > max_cost;
+  }
+};
+
+// the cost and placement policies of edge_collapse()
+inline void check_policy(const std::string& policy)
+{
+  if (policy == "lindstrom_turk")
+    return;
+#if CGAL_VERSION_NR >= 1050600000
+  if (policy == "plane" || policy == "probabilistic_plane" || policy == "triangle" || policy == "probabilistic_triangle")
+    return;
+  throw std::invalid_argument("Unknown policy '" + policy + "', use 'plane', 'probabilistic_plane', "
+                              "'triangle', 'probabilistic_triangle' or 'lindstrom_turk'");
+#elif CGAL_VERSION_NR >= 1050300000
+  if (policy == "plane")
+    return;
+  throw std::invalid_argument("Unknown policy '" + policy + "', use 'plane' or 'lindstrom_turk' "
+                              "(the other Garland-Heckbert policies need CGAL 5.6)");
+#else
+  throw std::invalid_argument("Unknown policy '" + policy + "', use 'lindstrom_turk' "
+                              "(the Garland-Heckbert policies need CGAL 5.3)");
+#endif
+}
+
+namespace internal {
+
+template <class Mesh, class Cost, class Placement>
+int collapse(Mesh& mesh, const Face_count_or_cost_stop_predicate& stop, const Cost& cost, const Placement& placement)
+{
+  return CGAL::Surface_mesh_simplification::edge_collapse(
+    mesh, stop, CGAL::parameters::get_cost(cost).get_placement(placement));
+}
+
+} // namespace internal
+
+// Decimates the triangle mesh `mesh` by edge collapses until it has at most
+// `face_count` faces, or until the cost of the next collapse is above
+// `max_error` squared (if positive): the costs of the Garland-Heckbert
+// policies are sums of squared distances to the planes (or triangles) of
+// the faces merged, the "probabilistic" variants assuming a noise on them.
+// Returns the number of edges removed.
+template <class Mesh>
+int edge_collapse(Mesh& mesh, int face_count, double max_error, const std::string& policy)
+{
+  namespace SMS = CGAL::Surface_mesh_simplification;
+  check_policy(policy);
+  if (face_count < 0)
+    throw std::invalid_argument("The number of faces must be non-negative");
+  if (!CGAL::is_triangle_mesh(mesh))
+    throw std::invalid_argument("The mesh must be a triangle mesh");
+  const Face_count_or_cost_stop_predicate stop =
+    { std::size_t(face_count), max_error > 0 ? max_error * max_error : (std::numeric_limits<double>::max)() };
+
+  if (policy == "lindstrom_turk")
+    return internal::collapse(mesh, stop, SMS::LindstromTurk_cost<Mesh>(), SMS::LindstromTurk_placement<Mesh>());
+#if CGAL_VERSION_NR >= 1050600000
+  if (policy == "probabilistic_plane")
+  {
+    SMS::GarlandHeckbert_probabilistic_plane_policies<Mesh, EPIC_Kernel> policies(mesh);
+    return internal::collapse(mesh, stop, policies.get_cost(), policies.get_placement());
+  }
+  if (policy == "triangle")
+  {
+    SMS::GarlandHeckbert_triangle_policies<Mesh, EPIC_Kernel> policies(mesh);
+    return internal::collapse(mesh, stop, policies.get_cost(), policies.get_placement());
+  }
+  if (policy == "probabilistic_triangle")
+  {
+    SMS::GarlandHeckbert_probabilistic_triangle_policies<Mesh, EPIC_Kernel> policies(mesh);
+    return internal::collapse(mesh, stop, policies.get_cost(), policies.get_placement());
+  }
+  SMS::GarlandHeckbert_plane_policies<Mesh, EPIC_Kernel> policies(mesh);
+  return internal::collapse(mesh, stop, policies.get_cost(), policies.get_placement());
+#elif CGAL_VERSION_NR >= 1050300000
+  SMS::GarlandHeckbert_policies<Mesh, EPIC_Kernel> policies(mesh);
+  return internal::collapse(mesh, stop, policies.get_cost(), policies.get_placement());
+#else
+  return 0; // unreachable, see check_policy()
+#endif
+}
+
+// Decimates the meshes concurrently with Parallel_tag, each one until it
+// has at most `face_ratio` times its number of faces (see edge_collapse()).
+// Returns the numbers of edges removed.
+template <class Mesh>
+std::vector<int> edge_collapse_batch(const std::vector<Mesh*>& meshes, double face_ratio,
+                                     double max_error, const std::string& policy)
+{
+  check_policy(policy);
+  if (!(face_ratio >= 0 && face_ratio <= 1))
+    throw std::invalid_argument("The ratio of faces kept must be in [0,1]");
+  for (Mesh* mesh : meshes)
+    if (!CGAL::is_triangle_mesh(*mesh))
+      throw std::invalid_argument("The meshes must be triangle meshes");
+  std::vector<std::size_t> indices(meshes.size());
+  for (std::size_t i = 0; i < indices.size(); ++i)
+    indices[i] = i;
+  // the largest meshes first, for the balance of the tasks
+  std::stable_sort(indices.begin(), indices.end(), [&](std::size_t a, std::size_t b)
+                   { return num_faces(*meshes[a]) > num_faces(*meshes[b]); });
+  std::vector<int> removed(meshes.size(), 0);
+  CGAL::for_each<Concurrency_tag>(indices, [&](const std::size_t& i) -> bool
+  {
+    Mesh& mesh = *meshes[i];
+    const int face_count = int(face_ratio * double(num_faces(mesh)));
+    removed[i] = edge_collapse(mesh, face_count, max_error, policy);
+    return true;
+  });
+  return removed;
+}
+
+} // namespace SWIG_Surface_mesh_simplification
+
+#endif //SWIG_CGAL_SURFACE_MESH_SIMPLIFICATION_EDGE_COLLAPSE_H
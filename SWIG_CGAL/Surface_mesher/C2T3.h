@@ -10,6 +10,7 @@
 #include <SWIG_CGAL/Common/Input_iterator_wrapper.h>
 #include <SWIG_CGAL/Common/Output_iterator_wrapper.h>
 #include <SWIG_CGAL/Common/Iterator.h>
+#include <SWIG_CGAL/Surface_mesher/C2T3_arrays.h>
 #include <boost/shared_ptr.hpp>
 
 namespace C2T3_internal{
@@ -92,6 +93,11 @@ public:
   void incident_facets ( Vertex_handle v, Output_iterator out){data.incident_facets(v.get_data(),out);}
   SWIG_CGAL_FORWARD_CALL_AND_REF_2(Facet,neighbor,Facet,int)
   SWIG_CGAL_FORWARD_CALL_AND_REF_3(Facet,neighbor,Cell_handle,int,int)  
+//Export
+  //vertices and consistently oriented facets as arrays, see C2T3_arrays.h
+  C2T3_arrays to_arrays() const {return C2T3_arrays(data);}
+  //binary PLY file of the facets, without building a polyhedron
+  void write_ply(const char* filename) const {C2T3_arrays(data).write_ply(filename);}
 };
 
 
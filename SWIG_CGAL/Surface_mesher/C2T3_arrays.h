@@ -0,0 +1,214 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+
+#ifndef SWIG_CGAL_SURFACE_MESHER_C2T3_ARRAYS_H
+#define SWIG_CGAL_SURFACE_MESHER_C2T3_ARRAYS_H
+
+#include <SWIG_CGAL/Common/Buffer.h>
+
+#include <CGAL/Unique_hash_map.h>
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#ifndef SWIG
+#include <CGAL/number_utils.h>
+#include <algorithm>
+#include <unordered_map>
+#include <utility>
+
+namespace SWIG_Surface_mesher {
+namespace internal {
+
+// Reverses some of the triangles (rows of 3 indices in triangles) so that two
+// triangles sharing an edge that no other triangle contains go through it in
+// opposite directions. Each connected component is then reversed if the
+// volume it bounds is negative, so that closed surfaces are oriented outward.
+inline void orient_triangles(const std::vector<double>& points, std::vector<int>& triangles)
+{
+  typedef std::pair<int, bool> Incident_triangle; // triangle, edge from the smallest index
+  const std::size_t nt = triangles.size() / 3;
+  std::unordered_map<std::uint64_t, std::vector<Incident_triangle> > edges;
+  edges.reserve(3 * nt / 2 + 1);
+  for (std::size_t t = 0; t < nt; ++t)
+    for (int j = 0; j < 3; ++j)
+    {
+      const int a = triangles[3 * t + j], b = triangles[3 * t + (j + 1) % 3];
+      const std::uint64_t key = (std::uint64_t((std::min)(a, b)) << 32) | std::uint32_t((std::max)(a, b));
+      edges[key].push_back(Incident_triangle(int(t), a < b));
+    }
+
+  std::vector<signed char> reversed(nt, -1); // -1: not visited yet
+  std::vector<int> component;
+  for (std::size_t seed = 0; seed < nt; ++seed)
+  {
+    if (reversed[seed] != -1) continue;
+    reversed[seed] = 0;
+    component.assign(1, int(seed));
+    for (std::size_t k = 0; k < component.size(); ++k)
+    {
+      const int t = component[k];
+      for (int j = 0; j < 3; ++j)
+      {
+        const int a = triangles[3 * t + j], b = triangles[3 * t + (j + 1) % 3];
+        const std::uint64_t key = (std::uint64_t((std::min)(a, b)) << 32) | std::uint32_t((std::max)(a, b));
+        const std::vector<Incident_triangle>& incident = edges[key];
+        if (incident.size() != 2) continue; // boundary or non-manifold edge
+        const Incident_triangle& other = incident[incident[0].first == t ? 1 : 0];
+        if (reversed[other.first] != -1) continue;
+        // the directions of the edge in both triangles must differ once reversed
+        reversed[other.first] = reversed[t] ^ ((a < b) == other.second ? 1 : 0);
+        component.push_back(other.first);
+      }
+    }
+
+    double volume = 0;
+    for (int t : component)
+    {
+      const double* p = &points[3 * std::size_t(triangles[3 * t])];
+      const double* q = &points[3 * std::size_t(triangles[3 * t + 1])];
+      const double* r = &points[3 * std::size_t(triangles[3 * t + 2])];
+      const double det = p[0] * (q[1] * r[2] - q[2] * r[1])
+                       - p[1] * (q[0] * r[2] - q[2] * r[0])
+                       + p[2] * (q[0] * r[1] - q[1] * r[0]);
+      volume += reversed[t] ? -det : det;
+    }
+    const signed char outward = (volume < 0) ? 1 : 0;
+    for (int t : component)
+      if ((reversed[t] ^ outward) != 0)
+        std::swap(triangles[3 * t + 1], triangles[3 * t + 2]);
+  }
+}
+
+// Binary PLY file of a triangle mesh, in the byte order of the machine:
+// vertices of double coordinates and faces of int indices.
+inline void write_ply(std::ostream& os, const std::vector<double>& points, const std::vector<int>& triangles)
+{
+  const std::uint16_t one = 1;
+  unsigned char first_byte;
+  std::memcpy(&first_byte, &one, 1);
+  os << "ply\n"
+     << "format " << (first_byte == 1 ? "binary_little_endian" : "binary_big_endian") << " 1.0\n"
+     << "element vertex " << points.size() / 3 << "\n"
+     << "property double x\nproperty double y\nproperty double z\n"
+     << "element face " << triangles.size() / 3 << "\n"
+     << "property list uchar int vertex_indices\n"
+     << "end_header\n";
+  os.write(reinterpret_cast<const char*>(points.data()), std::streamsize(points.size() * sizeof(double)));
+
+  const std::size_t record = 1 + 3 * sizeof(int);
+  std::vector<char> faces(record * (triangles.size() / 3));
+  for (std::size_t t = 0; t < triangles.size() / 3; ++t)
+  {
+    faces[record * t] = 3;
+    std::memcpy(&faces[record * t + 1], &triangles[3 * t], 3 * sizeof(int));
+  }
+  os.write(faces.data(), std::streamsize(faces.size()));
+  if (!os) throw std::runtime_error("Error while writing the PLY file");
+}
+
+} //namespace internal
+} //namespace SWIG_Surface_mesher
+#endif
+
+// Result of C2T3_wrapper::to_arrays(): row i of point_array() is the point
+// (x,y,z) of the i-th vertex of the complex, in the order they are met, and
+// row j of triangle_array() the indices of the vertices of the j-th facet.
+// The facets are oriented consistently across the manifold edges and closed
+// surfaces are oriented outward. write_ply() writes a binary PLY file of
+// these arrays, without building a polyhedron.
+class C2T3_arrays
+{
+  std::shared_ptr<std::vector<double> > points_sptr;
+  std::shared_ptr<std::vector<int> >    triangles_sptr;
+
+public:
+  C2T3_arrays()
+    : points_sptr(new std::vector<double>())
+    , triangles_sptr(new std::vector<int>()) {}
+
+  #ifndef SWIG
+  template <class C2T3>
+  explicit C2T3_arrays(const C2T3& c2t3)
+    : C2T3_arrays()
+  {
+    typedef typename C2T3::Triangulation          Triangulation;
+    typedef typename Triangulation::Vertex_handle Vertex_handle;
+
+    CGAL::Unique_hash_map<Vertex_handle, int> vertex_index(-1, c2t3.triangulation().number_of_vertices());
+    triangles_sptr->reserve(3 * c2t3.number_of_facets());
+    for (typename C2T3::Facet_iterator f = c2t3.facets_begin(); f != c2t3.facets_end(); ++f)
+      for (int j = 0; j < 3; ++j)
+      {
+        const Vertex_handle v = f->first->vertex(Triangulation::vertex_triple_index(f->second, j));
+        int& i = vertex_index[v];
+        if (i == -1)
+        {
+          i = int(points_sptr->size() / 3);
+          points_sptr->push_back(CGAL::to_double(v->point().x()));
+          points_sptr->push_back(CGAL::to_double(v->point().y()));
+          points_sptr->push_back(CGAL::to_double(v->point().z()));
+        }
+        triangles_sptr->push_back(i);
+      }
+    SWIG_Surface_mesher::internal::orient_triangles(*points_sptr, *triangles_sptr);
+  }
+  #endif
+
+  int number_of_points() const { return int(points_sptr->size() / 3); }
+  int number_of_triangles() const { return int(triangles_sptr->size() / 3); }
+
+  // (number_of_points(), 3)
+  SWIG_CGAL::Buffer<double> point_array() const
+  {
+    return SWIG_CGAL::Buffer<double>(points_sptr->data(), points_sptr->size() / 3, 3,
+                                     points_sptr, true);
+  }
+  // (number_of_triangles(), 3)
+  SWIG_CGAL::Buffer<int> triangle_array() const
+  {
+    return SWIG_CGAL::Buffer<int>(triangles_sptr->data(), triangles_sptr->size() / 3, 3,
+                                  triangles_sptr, true);
+  }
+
+  // binary PLY file of the triangles
+  void write_ply(const char* filename) const
+  {
+    std::ofstream out(filename, std::ios::binary);
+    if (!out) throw std::runtime_error(std::string("Cannot create file ") + filename);
+    SWIG_Surface_mesher::internal::write_ply(out, *points_sptr, *triangles_sptr);
+  }
+};
+
+// Result of make_surface_meshes(): the arrays of the mesh of the isosurface
+// of each isovalue, in the order of the isovalues
+class Surface_mesh_batch
+{
+  std::shared_ptr<std::vector<C2T3_arrays> > meshes_sptr;
+
+public:
+  Surface_mesh_batch() : meshes_sptr(new std::vector<C2T3_arrays>()) {}
+
+  #ifndef SWIG
+  explicit Surface_mesh_batch(std::vector<C2T3_arrays>&& meshes)
+    : meshes_sptr(new std::vector<C2T3_arrays>(std::move(meshes))) {}
+  #endif
+
+  int number_of_meshes() const { return int(meshes_sptr->size()); }
+  C2T3_arrays mesh(int i) const
+  {
+    if (i < 0 || i >= number_of_meshes())
+      throw std::out_of_range("Invalid mesh index");
+    return (*meshes_sptr)[std::size_t(i)];
+  }
+};
+
+#endif //SWIG_CGAL_SURFACE_MESHER_C2T3_ARRAYS_H
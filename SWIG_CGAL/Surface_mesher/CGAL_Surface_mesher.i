@@ -16,6 +16,17 @@ SWIG_CGAL_package_common()
 
 %import  "SWIG_CGAL/Common/Macros.h"
 %import  "SWIG_CGAL/Kernel/CGAL_Kernel.i"
+
+//typemaps for the insertion and the moves of points from arrays and the export to arrays
+%include "SWIG_CGAL/typemaps.i"
+SWIG_CGAL_buffer_of_double_typemap_in
+SWIG_CGAL_buffer_of_int_typemap_in
+SWIG_CGAL_buffer_of_float_typemap_in
+SWIG_CGAL_buffer_of_unsigned_short_typemap_in
+SWIG_CGAL_buffer_of_unsigned_char_typemap_in
+SWIG_CGAL_buffer_of_double_typemap_out
+SWIG_CGAL_buffer_of_int_typemap_out
+SWIG_CGAL_buffer_of_signed_char_typemap_out
 %include "SWIG_CGAL/Common/Iterator.h"
 
 //include files
@@ -35,14 +46,26 @@ SWIG_CGAL_package_common()
 
 //definitions
 %include "SWIG_CGAL/Triangulation_3/triangulation_handles.h"
+SWIG_CGAL_release_gil(Triangulation_3_wrapper::to_arrays)
+SWIG_CGAL_release_gil(Triangulation_3_wrapper::write_binary)
+SWIG_CGAL_release_gil(Triangulation_3_wrapper::read_binary)
+%include "SWIG_CGAL/Triangulation_3/Triangulation_3_arrays.h"
+%include "SWIG_CGAL/Common/Location_batch.h"
 %include "SWIG_CGAL/Triangulation_3/Triangulation_3.h"
 %include "SWIG_CGAL/Triangulation_3/Delaunay_triangulation_3.h"
 %include "SWIG_CGAL/Common/triple.h"
+SWIG_CGAL_release_gil(C2T3_wrapper::to_arrays)
+SWIG_CGAL_release_gil(C2T3_wrapper::write_ply)
+SWIG_CGAL_release_gil(C2T3_arrays::write_ply)
+%include "SWIG_CGAL/Surface_mesher/C2T3_arrays.h"
 %include "SWIG_CGAL/Surface_mesher/C2T3.h"
 %include "SWIG_CGAL/Surface_mesher/Surface_mesh_details.h"
+%typemap(javaimports)      Poisson_reconstruction_function_wrapper%{import CGAL.Kernel.Point_3; import CGAL.Kernel.Sphere_3;%}
+%typemap(javaimports)      Sdf_grid_3_wrapper%{import CGAL.Kernel.Point_3;%}
+%include "SWIG_CGAL/Surface_mesher/Implicit_functions.h"
 
 %pragma(java) jniclassimports=%{import CGAL.Kernel.Point_3; import CGAL.Kernel.Line_3; import CGAL.Kernel.Ref_int; import CGAL.Kernel.Sphere_3; import CGAL.Kernel.Triangle_3; import CGAL.Kernel.Segment_3; import CGAL.Kernel.Tetrahedron_3; import java.util.Iterator; import java.util.Collection; import CGAL.Polyhedron_3.Polyhedron_3;%}
-%pragma(java) moduleimports  =%{import CGAL.Polyhedron_3.Polyhedron_3;%} //for global functions
+%pragma(java) moduleimports  =%{import CGAL.Polyhedron_3.Polyhedron_3; import CGAL.Kernel.Sphere_3;%} //for global functions
 
 #if !SWIG_CGAL_NON_SUPPORTED_TARGET_LANGUAGE
 SWIG_CGAL_input_iterator_typemap_in(Weighting_helper_3<CGAL::Tag_false>::Point_range,Point_3,Point_3,Point_3::cpp_base,$descriptor(Point_3*),"(LCGAL/Kernel/Point_3;)J",insert)
@@ -97,6 +120,11 @@ SWIG_CGAL_declare_identifier_of_template_class(Gray_level_image_3,Gray_level_ima
 //--
 %typemap(javaimports)      Implicit_surface_3_wrapper%{import CGAL.Kernel.Sphere_3;%}
 SWIG_CGAL_declare_identifier_of_template_class(Implicit_surface_Gray_level_image_3,Implicit_surface_3_wrapper<IS_GLI_3,Gray_level_image_3_wrapper<GLI_3> >)
+//--implicit functions evaluated in C++: Poisson reconstruction and sampled signed distance
+SWIG_CGAL_declare_identifier_of_template_class(Poisson_reconstruction_function,Poisson_reconstruction_function_wrapper<PRF_3>)
+SWIG_CGAL_declare_identifier_of_template_class(Implicit_surface_Poisson_reconstruction_function,Implicit_surface_3_wrapper<IS_PRF_3,Poisson_reconstruction_function_wrapper<PRF_3> >)
+SWIG_CGAL_declare_identifier_of_template_class(Sdf_grid_3,Sdf_grid_3_wrapper<SDF_3>)
+SWIG_CGAL_declare_identifier_of_template_class(Implicit_surface_Sdf_grid_3,Implicit_surface_3_wrapper<IS_SDF_3,Sdf_grid_3_wrapper<SDF_3> >)
 
 //import Polyhedron_3 wrapper type
 SWIG_CGAL_import_Polyhedron_3_SWIG_wrapper
@@ -122,8 +150,11 @@ SWIG_CGAL_import_Polyhedron_3_SWIG_wrapper
   {
     CGAL:: facets_in_complex_2_to_triangle_mesh(c2t3.get_data(),poly.get_data() );
   }
+%}
 
-  void  make_surface_mesh(Complex_2_in_triangulation_3_SWIG_wrapper& c2t3,const Implicit_surface_3_wrapper<IS_GLI_3,Gray_level_image_3_wrapper<GLI_3> >& surface,const Surface_mesh_criteria_3_wrapper<SMDC_3>& criteria, Surface_mesher_tag tag,int nb)
+%define declare_make_surface_mesh(SURFACE)
+%inline %{
+  void  make_surface_mesh(Complex_2_in_triangulation_3_SWIG_wrapper& c2t3,const SURFACE& surface,const Surface_mesh_criteria_3_wrapper<SMDC_3>& criteria, Surface_mesher_tag tag,int nb)
   {
     switch(tag){
       case MANIFOLD_TAG:
@@ -137,11 +168,63 @@ SWIG_CGAL_import_Polyhedron_3_SWIG_wrapper
       break;
     }
   }
-  void  make_surface_mesh(Complex_2_in_triangulation_3_SWIG_wrapper& c2t3,const Implicit_surface_3_wrapper<IS_GLI_3,Gray_level_image_3_wrapper<GLI_3> >& surface,const Surface_mesh_criteria_3_wrapper<SMDC_3>& criteria, Surface_mesher_tag tag)
+  void  make_surface_mesh(Complex_2_in_triangulation_3_SWIG_wrapper& c2t3,const SURFACE& surface,const Surface_mesh_criteria_3_wrapper<SMDC_3>& criteria, Surface_mesher_tag tag)
   {
     make_surface_mesh(c2t3,surface,criteria,tag,20);
   }
 %}
+%enddef
+
+//the surfaces do not call back into the target language: meshing runs without the GIL
+SWIG_CGAL_release_gil(make_surface_mesh)
+declare_make_surface_mesh(Implicit_surface_Gray_level_image_3_SWIG_wrapper)
+declare_make_surface_mesh(Implicit_surface_Poisson_reconstruction_function_SWIG_wrapper)
+declare_make_surface_mesh(Implicit_surface_Sdf_grid_3_SWIG_wrapper)
+%feature("except","") make_surface_mesh;
+
+//meshes of several isosurfaces of an image, made concurrently
+SWIG_CGAL_release_gil(make_surface_meshes)
+%inline %{
+  Surface_mesh_batch make_surface_meshes(const Gray_level_image_3_SWIG_wrapper& image, SWIG_CGAL::Buffer<double> isovalues,
+                                         const Sphere_3& bounding_sphere, const Surface_mesh_criteria_3_wrapper<SMDC_3>& criteria,
+                                         Surface_mesher_tag tag, double error_bound=1e-3, int nb=20)
+  {
+    switch(tag){
+      case MANIFOLD_TAG:
+        return Surface_mesh_batch(SWIG_Surface_mesher::make_isosurface_meshes(image.get_data(), isovalues, bounding_sphere.get_data(),
+                                                                              error_bound, criteria.get_data(), CGAL::Manifold_tag(), nb));
+      case MANIFOLD_WITH_BOUNDARY_TAG:
+        return Surface_mesh_batch(SWIG_Surface_mesher::make_isosurface_meshes(image.get_data(), isovalues, bounding_sphere.get_data(),
+                                                                              error_bound, criteria.get_data(), CGAL::Manifold_with_boundary_tag(), nb));
+      default:
+        return Surface_mesh_batch(SWIG_Surface_mesher::make_isosurface_meshes(image.get_data(), isovalues, bounding_sphere.get_data(),
+                                                                              error_bound, criteria.get_data(), CGAL::Non_manifold_tag(), nb));
+    }
+  }
+%}
+%feature("except","") make_surface_meshes;
+
+//Poisson surface reconstruction to a Polyhedron_3: the meshing of a computed
+//function (that can be meshed at several resolutions), and the whole pipeline of CGAL
+SWIG_CGAL_release_gil(poisson_surface_mesh)
+SWIG_CGAL_release_gil(poisson_surface_reconstruction_delaunay)
+%inline %{
+  bool poisson_surface_mesh(const Poisson_reconstruction_function_SWIG_wrapper& function, Polyhedron_3_SWIG_wrapper& P,
+                            double sm_angle=20, double sm_radius=30, double sm_distance=0.375, double spacing=0)
+  {
+    return SWIG_Surface_mesher::poisson_triangle_mesh(function.get_data(), spacing > 0 ? spacing : function.average_spacing(),
+                                                      sm_angle, sm_radius, sm_distance, P.get_data());
+  }
+
+  bool poisson_surface_reconstruction_delaunay(SWIG_CGAL::Buffer<double> points, SWIG_CGAL::Buffer<double> normals, Polyhedron_3_SWIG_wrapper& P,
+                                               double spacing=0, double sm_angle=20, double sm_radius=30, double sm_distance=0.375)
+  {
+    return SWIG_Surface_mesher::poisson_surface_reconstruction_delaunay<EPIC_Kernel>(points, normals, P.get_data(),
+                                                                                    spacing, sm_angle, sm_radius, sm_distance);
+  }
+%}
+%feature("except","") poisson_surface_mesh;
+%feature("except","") poisson_surface_reconstruction_delaunay;
 
 #ifdef SWIG_CGAL_HAS_Surface_mesher_USER_PACKAGE
 %include "SWIG_CGAL/User_packages/Surface_mesher/extensions.i"
@@ -0,0 +1,331 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+
+#ifndef SWIG_CGAL_SURFACE_MESHER_IMPLICIT_FUNCTIONS_H
+#define SWIG_CGAL_SURFACE_MESHER_IMPLICIT_FUNCTIONS_H
+
+#include <SWIG_CGAL/Common/Buffer.h>
+#include <SWIG_CGAL/Kernel/Point_3.h>
+#include <SWIG_CGAL/Kernel/Sphere_3.h>
+
+#include <memory>
+
+#ifndef SWIG
+#include <SWIG_CGAL/Common/Gil_release.h>
+#include <SWIG_CGAL/Common/Sampled_grid.h>
+#include <SWIG_CGAL/Common/Spatial_insertion.h>
+#include <SWIG_CGAL/Surface_mesher/C2T3_arrays.h>
+#include <CGAL/compute_average_spacing.h>
+#include <CGAL/for_each.h>
+#include <CGAL/Image_3.h>
+#include <CGAL/property_map.h>
+#include <CGAL/number_utils.h>
+#include <CGAL/tags.h>
+#include <CGAL/Surface_mesh_default_triangulation_3.h>
+#include <CGAL/Complex_2_in_triangulation_3.h>
+#include <CGAL/Surface_mesh_default_criteria_3.h>
+#include <CGAL/Implicit_surface_3.h>
+#include <CGAL/make_surface_mesh.h>
+#include <CGAL/IO/facets_in_complex_2_to_triangle_mesh.h>
+#ifdef CGAL_EIGEN3_ENABLED
+#include <CGAL/Eigen_solver_traits.h>
+#include <CGAL/poisson_surface_reconstruction.h>
+#endif
+#include <cmath>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace SWIG_Surface_mesher {
+
+#ifdef CGAL_LINKED_WITH_TBB
+typedef CGAL::Parallel_tag Concurrency_tag;
+#else
+typedef CGAL::Sequential_tag Concurrency_tag;
+#endif
+
+// pairs (point, normal) of arrays of rows (x,y,z)
+template <class Point_with_normal>
+std::vector<Point_with_normal> points_with_normals(const SWIG_CGAL::Buffer<double>& points,
+                                                   const SWIG_CGAL::Buffer<double>& normals)
+{
+  typedef typename Point_with_normal::first_type  Point;
+  typedef typename Point_with_normal::second_type Vector;
+  const std::size_t n = SWIG_CGAL::number_of_rows(points, 3);
+  if (SWIG_CGAL::number_of_rows(normals, 3) != n)
+    throw std::invalid_argument("The number of normals must be the number of points");
+  if (n == 0)
+    throw std::invalid_argument("At least one point is needed");
+  const double* p = points.data();
+  const double* v = normals.data();
+  std::vector<Point_with_normal> samples;
+  samples.reserve(n);
+  for (std::size_t i = 0; i < n; ++i)
+    samples.push_back(Point_with_normal(Point(p[3 * i], p[3 * i + 1], p[3 * i + 2]),
+                                        Vector(v[3 * i], v[3 * i + 1], v[3 * i + 2])));
+  return samples;
+}
+
+// Solves the Poisson equation of `function` with the sparse solver `solver`:
+// "conjugate_gradient" (iterative, its matrix-vector products using
+// `number_of_threads` threads if Eigen runs with OpenMP, all of them if 0)
+// or "ldlt" (direct, Cholesky factorization). The tolerance and the maximum
+// number of iterations of the conjugate gradient keep the defaults of Eigen
+// if not positive.
+template <class Function>
+bool compute_implicit_function(Function& function, const std::string& solver, double tolerance,
+                               int max_iterations, int number_of_threads, bool smoother_hole_filling)
+{
+  if (solver != "conjugate_gradient" && solver != "ldlt")
+    throw std::invalid_argument("Unknown solver '" + solver + "', use 'conjugate_gradient' or 'ldlt'");
+#ifdef CGAL_EIGEN3_ENABLED
+  typedef CGAL::Eigen_sparse_symmetric_matrix<double>::EigenType Matrix;
+  if (solver == "ldlt")
+    return function.compute_implicit_function(
+      CGAL::Eigen_solver_traits<Eigen::SimplicialLDLT<Matrix> >(), smoother_hole_filling);
+
+  CGAL::Eigen_solver_traits<Eigen::ConjugateGradient<Matrix, Eigen::Lower | Eigen::Upper> > cg;
+  if (tolerance > 0)
+    cg.solver().setTolerance(tolerance);
+  if (max_iterations > 0)
+    cg.solver().setMaxIterations(max_iterations);
+  const int previous_number_of_threads = Eigen::nbThreads();
+  if (number_of_threads > 0)
+    Eigen::setNbThreads(number_of_threads);
+  const bool solved = function.compute_implicit_function(cg, smoother_hole_filling);
+  Eigen::setNbThreads(previous_number_of_threads);
+  return solved;
+#else
+  (void)function; (void)tolerance; (void)max_iterations; (void)number_of_threads; (void)smoother_hole_filling;
+  throw std::runtime_error("The Poisson surface reconstruction needs CGAL configured with Eigen");
+#endif
+}
+
+// Surface of a computed Poisson function copied to the triangle mesh `out`,
+// as done by CGAL::poisson_surface_reconstruction_delaunay(): the criteria
+// `sm_radius` and `sm_distance` are relative to `spacing`. The function is
+// only evaluated, so that it can be meshed several times.
+template <class Function, class Mesh>
+bool poisson_triangle_mesh(const Function& function, double spacing, double sm_angle,
+                           double sm_radius, double sm_distance, Mesh& out)
+{
+  typedef CGAL::Surface_mesh_default_triangulation_3     Tr;
+  typedef Tr::Geom_traits                                GT;
+  typedef CGAL::Complex_2_in_triangulation_3<Tr>         C2t3;
+  typedef CGAL::Implicit_surface_3<GT, Function>         Surface;
+
+  if (!(spacing > 0))
+    throw std::invalid_argument("The spacing must be positive");
+  const typename Function::Point inner_point = function.get_inner_point();
+  const double radius = std::sqrt(CGAL::to_double(function.bounding_sphere().squared_radius()));
+  const double sm_sphere_radius = 5 * radius;
+  const double sm_dichotomy_error = sm_distance * spacing / 1000.;
+  Surface surface(function, GT::Sphere_3(inner_point, sm_sphere_radius * sm_sphere_radius),
+                  sm_dichotomy_error / sm_sphere_radius);
+  CGAL::Surface_mesh_default_criteria_3<Tr> criteria(sm_angle, sm_radius * spacing, sm_distance * spacing);
+  Tr tr;
+  C2t3 c2t3(tr);
+  CGAL::make_surface_mesh(c2t3, surface, criteria, CGAL::Manifold_with_boundary_tag());
+  if (tr.number_of_vertices() == 0)
+    return false;
+  CGAL::facets_in_complex_2_to_triangle_mesh(c2t3, out);
+  return true;
+}
+
+// Meshes of the isosurfaces of a gray level image at each of the
+// isovalues, made concurrently: each task meshes an isovalue in its own
+// triangulation, the images of all the isovalues sharing the voxels of
+// `image`, which are only read. The surfaces are the ones of
+// Implicit_surface_3(image, bounding_sphere, error_bound).
+template <class Image, class Sphere, class Criteria, class Tag>
+std::vector<C2T3_arrays> make_isosurface_meshes(const Image& image, const SWIG_CGAL::Buffer<double>& isovalues,
+                                                const Sphere& bounding_sphere, double error_bound,
+                                                const Criteria& criteria, Tag tag, int nb_initial_points)
+{
+  typedef CGAL::Surface_mesh_default_triangulation_3     Tr;
+  typedef Tr::Geom_traits                                GT;
+  typedef CGAL::Complex_2_in_triangulation_3<Tr>         C2t3;
+  typedef CGAL::Implicit_surface_3<GT, Image>            Surface;
+
+  std::vector<Image> images;
+  images.reserve(isovalues.size());
+  for (std::size_t i = 0; i < isovalues.size(); ++i)
+    images.push_back(Image(static_cast<const CGAL::Image_3&>(image), float(isovalues[i])));
+
+  std::vector<C2T3_arrays> meshes(images.size());
+  std::vector<std::size_t> indices(images.size());
+  std::iota(indices.begin(), indices.end(), std::size_t(0));
+  CGAL::for_each<Concurrency_tag>(indices, [&](const std::size_t& i) -> bool
+  {
+    Tr tr;
+    C2t3 c2t3(tr);
+    CGAL::make_surface_mesh(c2t3, Surface(images[i], bounding_sphere, error_bound), criteria, tag, nb_initial_points);
+    meshes[i] = C2T3_arrays(c2t3);
+    return true;
+  });
+  return meshes;
+}
+
+// CGAL::poisson_surface_reconstruction_delaunay() on arrays of points and
+// oriented normals, the spacing being their average spacing (to their 6
+// nearest neighbors, computed concurrently) if not positive
+template <class Kernel, class Mesh>
+bool poisson_surface_reconstruction_delaunay(const SWIG_CGAL::Buffer<double>& points,
+                                             const SWIG_CGAL::Buffer<double>& normals, Mesh& out,
+                                             double spacing, double sm_angle, double sm_radius,
+                                             double sm_distance)
+{
+  typedef std::pair<typename Kernel::Point_3, typename Kernel::Vector_3> Point_with_normal;
+  typedef CGAL::First_of_pair_property_map<Point_with_normal>  Point_map;
+  typedef CGAL::Second_of_pair_property_map<Point_with_normal> Normal_map;
+
+  const std::vector<Point_with_normal> samples = points_with_normals<Point_with_normal>(points, normals);
+  if (!(spacing > 0))
+    spacing = CGAL::compute_average_spacing<Concurrency_tag>(samples, 6, CGAL::parameters::point_map(Point_map()));
+#ifdef CGAL_EIGEN3_ENABLED
+  return CGAL::poisson_surface_reconstruction_delaunay(samples.begin(), samples.end(), Point_map(), Normal_map(),
+                                                       out, spacing, sm_angle, sm_radius, sm_distance);
+#else
+  (void)out; (void)sm_angle; (void)sm_radius; (void)sm_distance;
+  throw std::runtime_error("The Poisson surface reconstruction needs CGAL configured with Eigen");
+#endif
+}
+
+// Signed distance function sampled on a regular grid, negative inside;
+// trilinear interpolation, the points out of the grid taking the value of
+// the nearest point of the grid. The copies share the samples.
+class Sdf_grid_function
+{
+  std::shared_ptr<const SWIG_CGAL::Sampled_grid<3> > grid_sptr;
+
+public:
+  typedef double FT;
+
+  Sdf_grid_function() {}
+  Sdf_grid_function(const SWIG_CGAL::Buffer<double>& values, const int dims[3],
+                    const double origin[3], const double spacing[3])
+    : grid_sptr(std::make_shared<const SWIG_CGAL::Sampled_grid<3> >(values, dims, origin, spacing)) {}
+
+  template <class Point>
+  FT operator()(const Point& p) const
+  {
+    const double c[3] = { CGAL::to_double(p.x()), CGAL::to_double(p.y()), CGAL::to_double(p.z()) };
+    return grid_sptr->value(c);
+  }
+};
+
+} //namespace SWIG_Surface_mesher
+#endif
+
+// Implicit function of a Poisson surface reconstruction, computed from
+// points with oriented normals given as arrays of rows (x,y,z) when
+// constructed. Needs Eigen. The copies share the solved function, which can
+// be meshed several times (see poisson_surface_mesh()).
+template <class Cpp_base>
+class Poisson_reconstruction_function_wrapper
+{
+  std::shared_ptr<Cpp_base> data_sptr;
+  double m_average_spacing;
+  typedef Poisson_reconstruction_function_wrapper<Cpp_base> Self;
+  //disable deep copy
+  Self deepcopy();
+  void deepcopy(const Self&);
+public:
+  #ifndef SWIG
+  typedef Cpp_base cpp_base;
+  const cpp_base& get_data() const {return *data_sptr;}
+        cpp_base& get_data()       {return *data_sptr;}
+  #endif
+
+  Poisson_reconstruction_function_wrapper(SWIG_CGAL::Buffer<double> points, SWIG_CGAL::Buffer<double> normals)
+  {
+    SWIG_CGAL::Gil_release gil;
+    init(points, normals);
+#ifdef CGAL_EIGEN3_ENABLED
+    if (!data_sptr->compute_implicit_function())
+      throw std::runtime_error("The Poisson implicit function cannot be computed");
+#else
+    throw std::runtime_error("The Poisson surface reconstruction needs CGAL configured with Eigen");
+#endif
+  }
+
+  // the equation solved with the sparse solver "conjugate_gradient" or
+  // "ldlt" (see SWIG_Surface_mesher::compute_implicit_function())
+  Poisson_reconstruction_function_wrapper(SWIG_CGAL::Buffer<double> points, SWIG_CGAL::Buffer<double> normals,
+                                          const std::string& solver, double tolerance = 0, int max_iterations = 0,
+                                          int number_of_threads = 0, bool smoother_hole_filling = false)
+  {
+    SWIG_CGAL::Gil_release gil;
+    init(points, normals);
+    if (!SWIG_Surface_mesher::compute_implicit_function(*data_sptr, solver, tolerance, max_iterations,
+                                                        number_of_threads, smoother_hole_filling))
+      throw std::runtime_error("The Poisson implicit function cannot be computed");
+  }
+
+  //the bounding sphere of the points
+  Sphere_3 bounding_sphere() const {return Sphere_3(data_sptr->bounding_sphere());}
+  //a point where the function is negative
+  Point_3 get_inner_point() const {return Point_3(data_sptr->get_inner_point());}
+  //average distance of the points to their 6 nearest neighbors
+  double average_spacing() const {return m_average_spacing;}
+  double value(const Point_3& p) const {return CGAL::to_double((*data_sptr)(p.get_data()));}
+
+private:
+  #ifndef SWIG
+  // the function of the points and normals, and their average spacing
+  void init(const SWIG_CGAL::Buffer<double>& points, const SWIG_CGAL::Buffer<double>& normals)
+  {
+    typedef typename Cpp_base::Point                   Point;
+    typedef typename Cpp_base::Geom_traits::Vector_3   Vector;
+    typedef std::pair<Point, Vector>                   Point_with_normal;
+    typedef CGAL::First_of_pair_property_map<Point_with_normal>  Point_map;
+    typedef CGAL::Second_of_pair_property_map<Point_with_normal> Normal_map;
+
+    const std::vector<Point_with_normal> samples
+      = SWIG_Surface_mesher::points_with_normals<Point_with_normal>(points, normals);
+    data_sptr = std::make_shared<Cpp_base>(samples.begin(), samples.end(), Point_map(), Normal_map());
+    m_average_spacing = CGAL::compute_average_spacing<SWIG_Surface_mesher::Concurrency_tag>(
+      samples, 6, CGAL::parameters::point_map(Point_map()));
+  }
+  #endif
+};
+
+// Signed distance function sampled on a regular grid (negative inside): the
+// sample (i,j,k) of values is at origin + (i*vx, j*vy, k*vz) and is of index
+// i + xdim*(j + ydim*k). The values are copied, so that meshing never calls
+// back into the target language.
+template <class Cpp_base>
+class Sdf_grid_3_wrapper
+{
+  Cpp_base data;
+  typedef Sdf_grid_3_wrapper<Cpp_base> Self;
+public:
+  #ifndef SWIG
+  typedef Cpp_base cpp_base;
+  const cpp_base& get_data() const {return data;}
+        cpp_base& get_data()       {return data;}
+  Sdf_grid_3_wrapper(const cpp_base& base):data(base){}
+  #endif
+
+  Sdf_grid_3_wrapper(SWIG_CGAL::Buffer<double> values, int xdim, int ydim, int zdim,
+                     const Point_3& origin, double vx, double vy, double vz)
+  {
+    const int dims[3] = { xdim, ydim, zdim };
+    const double o[3] = { origin.x(), origin.y(), origin.z() };
+    const double spacing[3] = { vx, vy, vz };
+    data = Cpp_base(values, dims, o, spacing);
+  }
+
+  double value(const Point_3& p) const {return data(p.get_data());}
+
+  //deep copy (the samples are never modified)
+  Self deepcopy() const {return Self(data);}
+  void deepcopy(const Self& other){data=other.get_data();}
+};
+
+#endif //SWIG_CGAL_SURFACE_MESHER_IMPLICIT_FUNCTIONS_H
@@ -7,8 +7,73 @@
 #ifndef SWIG_CGAL_SURFACE_MESH_DETAILS_H
 #define SWIG_CGAL_SURFACE_MESH_DETAILS_H
 
+#include <SWIG_CGAL/Common/Buffer.h>
 #include <SWIG_CGAL/Kernel/Sphere_3.h>
 
+#include <memory>
+#include <string>
+
+#ifndef SWIG
+#include <CGAL/Image_3.h>
+#include <CGAL/ImageIO.h>
+
+#include <cstring>
+#include <stdexcept>
+
+namespace SWIG_Surface_mesher {
+namespace internal {
+
+// word kind and sign of the voxels of an image of values of type T
+template <class T> struct Image_word;
+template <> struct Image_word<float>
+{ static WORD_KIND kind() { return WK_FLOAT; } static SIGN sign() { return SGN_SIGNED; } };
+template <> struct Image_word<unsigned char>
+{ static WORD_KIND kind() { return WK_FIXED; } static SIGN sign() { return SGN_UNSIGNED; } };
+template <> struct Image_word<unsigned short>
+{ static WORD_KIND kind() { return WK_FIXED; } static SIGN sign() { return SGN_UNSIGNED; } };
+
+// Scalar image of a (zdim, ydim, xdim) array of voxels, the voxel (i,j,k) being
+// of index i + xdim*(j + ydim*k) and of size vx*vy*vz. The image uses the
+// memory of values if it has an owner (kept alive by the caller), and a copy
+// allocated by ImageIO otherwise (values borrowed from the target language
+// only for the duration of a call).
+template <class T>
+CGAL::Image_3 image_from_buffer(const SWIG_CGAL::Buffer<T>& values, int xdim, int ydim, int zdim,
+                                double vx, double vy, double vz)
+{
+  if (xdim < 1 || ydim < 1 || zdim < 1)
+    throw std::invalid_argument("The dimensions of the image must be positive");
+  if (!(vx > 0 && vy > 0 && vz > 0))
+    throw std::invalid_argument("The voxel sizes must be positive");
+  const std::size_t n = std::size_t(xdim) * std::size_t(ydim) * std::size_t(zdim);
+  if (values.size() != n)
+    throw std::invalid_argument("Expecting xdim*ydim*zdim values");
+
+  _image* image = ::_initImage();
+  image->xdim = xdim;
+  image->ydim = ydim;
+  image->zdim = zdim;
+  image->vdim = 1;
+  image->vx = vx;
+  image->vy = vy;
+  image->vz = vz;
+  image->wdim = sizeof(T);
+  image->wordKind = Image_word<T>::kind();
+  image->sign = Image_word<T>::sign();
+  if (values.owner())
+  {
+    image->data = const_cast<T*>(values.data());
+    return CGAL::Image_3(image, CGAL::Image_3::DO_NOT_OWN_THE_DATA);
+  }
+  image->data = ::ImageIO_alloc(n * sizeof(T));
+  std::memcpy(image->data, values.data(), n * sizeof(T));
+  return CGAL::Image_3(image);
+}
+
+} //namespace internal
+} //namespace SWIG_Surface_mesher
+#endif
+
 enum Surface_mesher_tag {MANIFOLD_TAG,MANIFOLD_WITH_BOUNDARY_TAG,NON_MANIFOLD_TAG};
 
 template <class Criteria>
@@ -30,10 +95,13 @@ public:
   
 };
 
+// Gray level image, read from a file or given as a 3D array of voxels, whose
+// isosurface is the surface meshed. The copies share the voxels.
 template <class Cpp_base>
 class Gray_level_image_3_wrapper
 {
   Cpp_base data;
+  std::shared_ptr<void> values_owner; // storage of the voxels if not owned by data
   typedef Gray_level_image_3_wrapper<Cpp_base> Self;
   //disable deep copy
   Self deepcopy();
@@ -46,6 +114,25 @@ public:
   #endif
   
   Gray_level_image_3_wrapper(const std::string& s, double iso_value):data(s.c_str(),iso_value){}
+  // image of a (zdim, ydim, xdim) C-contiguous array of voxels of size
+  // vx*vy*vz, without reading or writing a file (see
+  // SWIG_Surface_mesher::internal::image_from_buffer())
+  Gray_level_image_3_wrapper(SWIG_CGAL::Buffer<float> values, int xdim, int ydim, int zdim,
+                             double vx, double vy, double vz, double iso_value)
+    : data(SWIG_Surface_mesher::internal::image_from_buffer(values, xdim, ydim, zdim, vx, vy, vz), float(iso_value))
+    , values_owner(values.owner()) {}
+  Gray_level_image_3_wrapper(SWIG_CGAL::Buffer<unsigned short> values, int xdim, int ydim, int zdim,
+                             double vx, double vy, double vz, double iso_value)
+    : data(SWIG_Surface_mesher::internal::image_from_buffer(values, xdim, ydim, zdim, vx, vy, vz), float(iso_value))
+    , values_owner(values.owner()) {}
+  Gray_level_image_3_wrapper(SWIG_CGAL::Buffer<unsigned char> values, int xdim, int ydim, int zdim,
+                             double vx, double vy, double vz, double iso_value)
+    : data(SWIG_Surface_mesher::internal::image_from_buffer(values, xdim, ydim, zdim, vx, vy, vz), float(iso_value))
+    , values_owner(values.owner()) {}
+
+  int xdim() const {return int(data.xdim());}
+  int ydim() const {return int(data.ydim());}
+  int zdim() const {return int(data.zdim());}
 };
 
 template<class Cpp_base,class Function>
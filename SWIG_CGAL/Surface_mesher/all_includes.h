@@ -8,6 +8,8 @@
 
 #include  <SWIG_CGAL/Surface_mesher/typedefs.h>
 #include  <SWIG_CGAL/Surface_mesher/Surface_mesh_details.h>
+#include  <SWIG_CGAL/Surface_mesher/Implicit_functions.h>
+#include  <SWIG_CGAL/Surface_mesher/C2T3_arrays.h>
 #include  <SWIG_CGAL/Surface_mesher/C2T3.h>
 
 #endif//SWIG_CGAL_SURFACE_MESHER_ALL_INCLUDES_H
@@ -13,11 +13,18 @@
 #include <CGAL/Implicit_surface_3.h>
 #include <CGAL/IO/Complex_2_in_triangulation_3_file_writer.h>
 #include <CGAL/IO/facets_in_complex_2_to_triangle_mesh.h>
+#include <CGAL/Poisson_reconstruction_function.h>
+#include <SWIG_CGAL/Kernel/typedefs.h>
+#include <SWIG_CGAL/Surface_mesher/Implicit_functions.h>
   
 typedef CGAL::Surface_mesh_default_triangulation_3                      C2T3_DT;
 typedef CGAL::Complex_2_in_triangulation_3<C2T3_DT>                     C2T3;
 typedef CGAL::Surface_mesh_default_criteria_3<C2T3_DT>                  SMDC_3;
 typedef CGAL::Gray_level_image_3<double, C2T3_DT::Point>                GLI_3;
 typedef CGAL::Implicit_surface_3<C2T3_DT::Geom_traits, GLI_3>           IS_GLI_3;
+typedef CGAL::Poisson_reconstruction_function<EPIC_Kernel>              PRF_3;
+typedef CGAL::Implicit_surface_3<C2T3_DT::Geom_traits, PRF_3>           IS_PRF_3;
+typedef SWIG_Surface_mesher::Sdf_grid_function                          SDF_3;
+typedef CGAL::Implicit_surface_3<C2T3_DT::Geom_traits, SDF_3>           IS_SDF_3;
   
 #endif//SWIG_CGAL_SURFACE_MESHER_TYPEDEFS_H
@@ -17,6 +17,15 @@ SWIG_CGAL_package_common()
 %import  "SWIG_CGAL/Common/Macros.h"
 %import  "SWIG_CGAL/Kernel/CGAL_Kernel.i"
 
+//typemaps for the insertion and location of points and the insertion of constraints from arrays,
+//and for the export to arrays
+%include "SWIG_CGAL/typemaps.i"
+SWIG_CGAL_buffer_of_double_typemap_in
+SWIG_CGAL_buffer_of_int_typemap_in
+SWIG_CGAL_buffer_of_double_typemap_out
+SWIG_CGAL_buffer_of_int_typemap_out
+SWIG_CGAL_buffer_of_signed_char_typemap_out
+
 %include "SWIG_CGAL/Common/Iterator.h"
 #ifdef SWIGJAVA
 %include "SWIG_CGAL/Triangulation_2/java_extensions.i"
@@ -33,6 +42,9 @@ SWIG_CGAL_package_common()
 
 
 //definitions
+%include "SWIG_CGAL/Common/Location_batch.h"
+SWIG_CGAL_release_gil(Triangulation_2_wrapper::to_arrays)
+%include "SWIG_CGAL/Triangulation_2/Triangulation_2_arrays.h"
 %include "SWIG_CGAL/Triangulation_2/Triangulation_2.h"
 %include "SWIG_CGAL/Triangulation_2/Delaunay_triangulation_2.h"
 %include "SWIG_CGAL/Triangulation_2/Regular_triangulation_2.h"
@@ -81,6 +93,7 @@ SWIG_CGAL_declare_triangulation_2(Triangulation_2,CGAL_T2,Point_2,CGAL::Tag_fals
 
 %import "SWIG_CGAL/Triangulation_2/declare_Delaunay_triangulation_2.i"
 SWIG_CGAL_declare_Delaunay_triangulation_2(Delaunay_triangulation_2,CGAL_DT2)
+SWIG_CGAL_declare_Delaunay_triangulation_2(Delaunay_triangulation_hierarchy_2,CGAL_DTH2)
 
 %import "SWIG_CGAL/Triangulation_2/declare_regular_triangulation_2.i"
 SWIG_CGAL_declare_regular_triangulation_2(Regular_triangulation_2,CGAL_RT2)
@@ -94,6 +107,14 @@ SWIG_CGAL_declare_constrained_Delaunay_triangulation_2(Constrained_Delaunay_tria
 %import "SWIG_CGAL/Triangulation_2/declare_constrained_Delaunay_triangulation_plus_2.i"
 SWIG_CGAL_declare_constrained_Delaunay_triangulation_plus_2(Constrained_Delaunay_triangulation_plus_2,CGAL_CDTplus2, Triangulation_2)
 
+//Java triangulations without info fields in vertices and faces
+#ifdef ADD_JAVA_DATA_IN_SIMPLICES_DT2
+SWIG_CGAL_declare_Delaunay_triangulation_2(Delaunay_triangulation_2_without_info,CGAL_DT2_without_info)
+#endif
+#ifdef ADD_JAVA_DATA_IN_FACET_CDT_2
+SWIG_CGAL_declare_constrained_Delaunay_triangulation_2(Constrained_Delaunay_triangulation_2_without_info,CGAL_CDT2_without_info, Triangulation_2)
+#endif
+
 #ifdef SWIG_CGAL_HAS_Triangulation_2_USER_PACKAGE
 %include "SWIG_CGAL/User_packages/Triangulation_2/extensions.i"
 #endif
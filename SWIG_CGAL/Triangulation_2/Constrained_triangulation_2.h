@@ -13,6 +13,11 @@
 #include <SWIG_CGAL/Common/Output_iterator_wrapper.h>
 #include <CGAL/Constrained_triangulation_2.h>
 
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
 typedef std::pair<Point_2,Point_2>                                          Constraint;
 
 #if !SWIG_CGAL_NON_SUPPORTED_TARGET_LANGUAGE
@@ -65,6 +70,28 @@ public:
     for (Input_constraint_iterator it=SWIG_CGAL::get_begin(range);it!=SWIG_CGAL::get_end(range);++it)
       this->get_data().push_back(*it);
   }
+  //insertion of the rows (x,y) of `points`, in spatial order, then of a constraint
+  //between rows i and j of `points` for each row (i,j) of `segments`.
+  //Returns the number of inserted points
+  int insert_constraints(SWIG_CGAL::Buffer<double> points, SWIG_CGAL::Buffer<int> segments){
+    const std::size_t n=SWIG_CGAL::number_of_rows(points,2);
+    const std::size_t m=SWIG_CGAL::number_of_rows(segments,2);
+    const double* coords=points.data();
+    const int* ids=segments.data();
+    std::vector<typename Triangulation::Point> cpp_points;
+    cpp_points.reserve(n);
+    for (std::size_t i=0;i<n;++i)
+      cpp_points.push_back(typename Triangulation::Point(coords[2*i],coords[2*i+1]));
+    std::vector<std::pair<std::size_t,std::size_t> > indices;
+    indices.reserve(m);
+    for (std::size_t k=0;k<m;++k){
+      if (ids[2*k]<0 || std::size_t(ids[2*k])>=n || ids[2*k+1]<0 || std::size_t(ids[2*k+1])>=n)
+        throw std::out_of_range("Invalid point index in segment "+std::to_string(k));
+      indices.push_back(std::make_pair(std::size_t(ids[2*k]),std::size_t(ids[2*k+1])));
+    }
+    SWIG_CGAL::Gil_release gil;
+    return static_cast<int>(this->get_data().insert_constraints(cpp_points.begin(),cpp_points.end(),indices.begin(),indices.end()));
+  }
 //Deep copy
   typedef Constrained_triangulation_2_wrapper<Triangulation,Vertex_handle,Face_handle> Self;
   Self deepcopy() const {return Self(this->get_data());}
@@ -33,6 +33,55 @@ namespace Dt2_internal {
   }
 }
 #endif // CGAL < 6.0
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace SWIG_Triangulation_2 {
+
+// Removes the finite vertices of indices ids (in the finite vertices
+// iteration, an index may be repeated) in the order of a Hilbert sort of
+// their points, so that consecutive removals touch neighboring faces.
+// Returns the number of removed vertices.
+template <class Dt>
+std::size_t remove_in_spatial_order(Dt& t, const SWIG_CGAL::Buffer<int>& ids)
+{
+  typedef typename Dt::Vertex_handle                                    Vertex_handle;
+  typedef SWIG_CGAL::Array_point_map<EPIC_Kernel::Point_2,2>            Point_map;
+
+  SWIG_CGAL::Gil_release gil;
+  std::vector<Vertex_handle> vertices;
+  vertices.reserve(t.number_of_vertices());
+  for (typename Dt::Finite_vertices_iterator v = t.finite_vertices_begin(); v != t.finite_vertices_end(); ++v)
+    vertices.push_back(v);
+
+  std::vector<char> selected(vertices.size(), 0);
+  std::vector<Vertex_handle> removed;
+  std::vector<double> coords;
+  for (std::size_t i = 0; i < ids.size(); ++i)
+  {
+    const int id = ids.data()[i];
+    if (id < 0 || std::size_t(id) >= vertices.size())
+      throw std::out_of_range("Invalid vertex id " + std::to_string(id));
+    if (selected[id]) continue;
+    selected[id] = 1;
+    removed.push_back(vertices[id]);
+    coords.push_back(vertices[id]->point().x());
+    coords.push_back(vertices[id]->point().y());
+  }
+
+  std::vector<std::size_t> order(removed.size());
+  for (std::size_t i = 0; i < order.size(); ++i)
+    order[i] = i;
+  CGAL::spatial_sort(order.begin(), order.end(),
+                     CGAL::Spatial_sort_traits_adapter_2<EPIC_Kernel,Point_map>(Point_map(coords.data(),2)));
+  for (std::size_t i : order)
+    t.remove(removed[i]);
+  return removed.size();
+}
+
+} //namespace SWIG_Triangulation_2
 #endif // not SWIG
 
 template <class Triangulation,class Vertex_handle, class Face_handle>
@@ -57,6 +106,15 @@ public:
 //Displacement
   SWIG_CGAL_FORWARD_CALL_AND_REF_2(Vertex_handle,move_if_no_collision,Vertex_handle,Point_2)
   SWIG_CGAL_FORWARD_CALL_AND_REF_2(Vertex_handle,move,Vertex_handle,Point_2)
+//Removal
+  #ifndef CGAL_DO_NOT_DEFINE_FOR_ALPHA_SHAPE_2
+  //removes the vertices of indices vertex_ids in the finite vertices iteration (as in
+  //to_arrays()), in spatial order. Returns the number of removed vertices; the remaining
+  //vertices are renumbered.
+  int remove_batch(SWIG_CGAL::Buffer<int> vertex_ids){
+    return static_cast<int>(SWIG_Triangulation_2::remove_in_spatial_order(this->get_data(),vertex_ids));
+  }
+  #endif
 //Queries
   SWIG_CGAL_FORWARD_CALL_AND_REF_2(Vertex_handle,nearest_vertex,Point_2,Face_handle)
   SWIG_CGAL_FORWARD_CALL_AND_REF_1(Vertex_handle,nearest_vertex,Point_2)
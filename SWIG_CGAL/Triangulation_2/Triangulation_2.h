@@ -23,13 +23,79 @@
 
 #include <SWIG_CGAL/Common/Input_iterator_wrapper.h>
 #include <SWIG_CGAL/Common/Iterator.h>
+#include <SWIG_CGAL/Common/Spatial_insertion.h>
+#include <SWIG_CGAL/Common/Location_batch.h>
+#include <SWIG_CGAL/Common/Memory_usage.h>
+#include <SWIG_CGAL/Triangulation_2/Triangulation_2_arrays.h>
 
 #include <boost/static_assert.hpp>
 
 #include <CGAL/Triangulation_2.h>
+#include <CGAL/Handle_hash_function.h>
+#include <CGAL/Kernel_traits.h>
+#include <CGAL/Spatial_sort_traits_adapter_2.h>
+
+#include <unordered_map>
 
 namespace SWIG_Triangulation_2{
 enum Locate_type { VERTEX=0, EDGE, FACE, OUTSIDE_CONVEX_HULL, OUTSIDE_AFFINE_HULL};
+
+// Result of find_edge() and find_included_edge(), returned by value rather
+// than through Reference_wrapper arguments: whether the edge was found, the
+// edge as (face, index) and its second vertex (vb for find_edge(), the first
+// vertex met on the segment [va,vb] for find_included_edge())
+template <class Vertex_handle, class Face_handle>
+class Edge_lookup
+{
+  bool m_found;
+  Vertex_handle m_vertex;
+  Face_handle m_face;
+  int m_index;
+public:
+  Edge_lookup():m_found(false),m_index(-1){}
+  Edge_lookup(bool found, const Vertex_handle& vertex, const Face_handle& face, int index)
+    :m_found(found),m_vertex(vertex),m_face(face),m_index(index){}
+
+  bool found() const {return m_found;}
+  Vertex_handle vertex() const {return m_vertex;}
+  Face_handle face() const {return m_face;}
+  int index() const {return m_index;}
+  std::pair<Face_handle,int> edge() const {return std::make_pair(m_face,m_index);}
+};
+
+#ifndef SWIG
+namespace internal{
+
+// The point of a row of coordinates (x,y) or (x,y,weight)
+template <class Point>
+Point make_point(const double* row, CGAL::Tag_false)
+{
+  return Point(row[0], row[1]);
+}
+
+template <class Point>
+Point make_point(const double* row, CGAL::Tag_true)
+{
+  typedef typename CGAL::Kernel_traits<Point>::Kernel::Point_2 Bare_point;
+  return Point(Bare_point(row[0], row[1]), row[2]);
+}
+
+// The point of a query (x,y), with a null weight for weighted points
+template <class Point>
+Point make_query_point(const double* row, CGAL::Tag_false)
+{
+  return Point(row[0], row[1]);
+}
+
+template <class Point>
+Point make_query_point(const double* row, CGAL::Tag_true)
+{
+  typedef typename CGAL::Kernel_traits<Point>::Kernel::Point_2 Bare_point;
+  return Point(Bare_point(row[0], row[1]), 0);
+}
+
+} //namespace internal
+#endif
 } //namespace SWIG_Triangulation_2
 
 #if !SWIG_CGAL_NON_SUPPORTED_TARGET_LANGUAGE
@@ -124,6 +190,24 @@ public:
     return res;
   }
 
+  //same as is_edge() and includes_edge() above, the edge being returned by value
+  SWIG_Triangulation_2::Edge_lookup<Vertex_handle,Face_handle> find_edge(Vertex_handle va, Vertex_handle vb) const
+  {
+    typename Face_handle::cpp_base base_f;
+    int base_i=-1;
+    bool res = get_data().is_edge(va.get_data(), vb.get_data(), base_f, base_i);
+    return SWIG_Triangulation_2::Edge_lookup<Vertex_handle,Face_handle>(res, res ? vb : Vertex_handle(), Face_handle(base_f), base_i);
+  }
+
+  SWIG_Triangulation_2::Edge_lookup<Vertex_handle,Face_handle> find_included_edge(Vertex_handle va, Vertex_handle vb) const
+  {
+    typename Face_handle::cpp_base base_f;
+    typename Vertex_handle::cpp_base base_v;
+    int base_i=-1;
+    bool res = get_data().includes_edge(va.get_data(), vb.get_data(), base_v, base_f, base_i);
+    return SWIG_Triangulation_2::Edge_lookup<Vertex_handle,Face_handle>(res, Vertex_handle(base_v), Face_handle(base_f), base_i);
+  }
+
   bool is_face (Vertex_handle v1, Vertex_handle v2, Vertex_handle v3, Reference_wrapper<Face_handle>& fr)
   {
     typename Face_handle::cpp_base base_f;
@@ -143,6 +227,43 @@ public:
     lt.set(CGAL::enum_cast<SWIG_Triangulation_2::Locate_type>(cgal_lt));
     return Face_handle(res);
   }
+  //same as the function above, the location being returned by value
+  Location<Face_handle,SWIG_Triangulation_2::Locate_type> locate_with_type(const Point& query, Face_handle hint=Face_handle()) const {
+    typename cpp_base::Locate_type cgal_lt;
+    int li=-1;
+    typename Face_handle::cpp_base res = get_data().locate(query.get_data(),cgal_lt,li,hint.get_data());
+    return Location<Face_handle,SWIG_Triangulation_2::Locate_type>(Face_handle(res),CGAL::enum_cast<SWIG_Triangulation_2::Locate_type>(cgal_lt),li);
+  }
+#ifndef CGAL_DO_NOT_DEFINE_FOR_ALPHA_SHAPE_2
+  //location of the rows (x,y) of an array, the indices being those of the finite faces iteration.
+  //The walks of Triangulation_2 use its random generator, hence the queries are not run concurrently.
+  Location_batch locate_batch(SWIG_CGAL::Buffer<double> queries) const {
+    typedef typename Point::cpp_base                                    Cpp_point;
+    typedef typename Triangulation::Face_handle                         Cpp_face_handle;
+    typedef SWIG_CGAL::Array_point_map<EPIC_Kernel::Point_2,2>          Point_map;
+    const std::size_t n = SWIG_CGAL::number_of_rows(queries,2);
+    const double* data = queries.data();
+    const Triangulation& t = get_data();
+    std::unordered_map<Cpp_face_handle,int,CGAL::Handle_hash_function> face_index;
+    face_index.reserve(t.number_of_faces());
+    int nf = 0;
+    for (typename Triangulation::Finite_faces_iterator f = t.finite_faces_begin(); f != t.finite_faces_end(); ++f)
+      face_index[f] = nf++;
+    return SWIG_CGAL::locate_in_spatial_order<CGAL::Sequential_tag,Cpp_face_handle>(n,
+      CGAL::Spatial_sort_traits_adapter_2<EPIC_Kernel,Point_map>(Point_map(data,2)),
+      [&t,&face_index,data](std::size_t i, Cpp_face_handle hint, int& index, signed char& type){
+        typename Triangulation::Locate_type lt;
+        int li;
+        Cpp_face_handle f = t.locate(SWIG_Triangulation_2::internal::make_query_point<Cpp_point>(data+2*i,Weighted_tag()),lt,li,hint);
+        typename std::unordered_map<Cpp_face_handle,int,CGAL::Handle_hash_function>::const_iterator it = face_index.find(f);
+        index = it == face_index.end() ? -1 : it->second;
+        type = static_cast<signed char>(lt);
+        return f;
+      });
+  }
+#endif
+//Export of the finite vertices and faces as arrays of points and of indices
+  Triangulation_2_arrays to_arrays() const { return Triangulation_2_arrays(get_data()); }
 // Modifiers
 //  SWIG_CGAL_FORWARD_CALL_2(void,flip,Face_handle,int) TODO: ambiguous call in CDT (their exist an overload with Face_handle&)
 #ifndef CGAL_DO_NOT_DEFINE_FOR_ALPHA_SHAPE_2
@@ -163,6 +284,20 @@ public:
   int insert(Point_range range){
     return get_data().insert(SWIG_CGAL::get_begin(range),SWIG_CGAL::get_end(range));
   }
+  //insertion of the rows (x,y), or (x,y,weight) for weighted points, of an array in spatial order
+  int insert_from_array(SWIG_CGAL::Buffer<double> coords){
+    typedef typename Point::cpp_base                                    Cpp_point;
+    typedef SWIG_CGAL::Array_point_map<EPIC_Kernel::Point_2,2>          Point_map;
+    const std::size_t row_size = Weighted_tag::value ? 3 : 2;
+    const double* data = coords.data();
+    Triangulation& t = get_data();
+    return static_cast<int>(SWIG_CGAL::insert_in_spatial_order(t, SWIG_CGAL::number_of_rows(coords,row_size),
+      CGAL::Spatial_sort_traits_adapter_2<EPIC_Kernel,Point_map>(Point_map(data,row_size)),
+      [data,row_size](std::size_t i){ return SWIG_Triangulation_2::internal::make_point<Cpp_point>(data+row_size*i,Weighted_tag()); },
+      [&t](const Cpp_point& p, typename Triangulation::Vertex_handle previous){
+        return t.insert(p, previous==typename Triangulation::Vertex_handle() ? typename Triangulation::Face_handle() : previous->face());
+      }));
+  }
 #endif
 // Traversal of the Triangulation
   Finite_vertices_iterator finite_vertices(){return Finite_vertices_iterator(get_data().finite_vertices_begin(),get_data().finite_vertices_end());}
@@ -219,6 +354,20 @@ public:
       in >> get_data();
     }
   }
+//Memory
+  // the vertices and faces of the data structure, free slots included
+  SWIG_CGAL::Memory_usage memory_usage() const
+  {
+    return SWIG_CGAL::Memory_usage(SWIG_CGAL::internal::compact_container_bytes(get_data().tds().vertices())
+                                   + SWIG_CGAL::internal::compact_container_bytes(get_data().tds().faces()));
+  }
+  // replaces the triangulation by a copy, which has no free slots: the
+  // handles to its vertices and faces become invalid
+  void shrink_to_fit()
+  {
+    Triangulation t(get_data());
+    get_data().swap(t);
+  }
 //Deep copy
   #ifndef CGAL_DO_NOT_DEFINE_FOR_ALPHA_SHAPE_2
   typedef Triangulation_2_wrapper<Triangulation,Point,Vertex_handle,Face_handle,Weighted_tag> Self;
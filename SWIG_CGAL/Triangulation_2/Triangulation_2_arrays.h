@@ -0,0 +1,123 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+
+#ifndef SWIG_CGAL_TRIANGULATION_2_TRIANGULATION_2_ARRAYS_H
+#define SWIG_CGAL_TRIANGULATION_2_TRIANGULATION_2_ARRAYS_H
+
+#include <SWIG_CGAL/Common/Buffer.h>
+
+#include <CGAL/Unique_hash_map.h>
+
+#include <memory>
+#include <vector>
+
+#ifndef SWIG
+namespace SWIG_Triangulation_2{
+namespace internal{
+//1 if the edge i of f is constrained, for the faces of constrained triangulations
+template <class Face_handle>
+auto is_constrained_edge(Face_handle f, int i, int) -> decltype(f->is_constrained(i), (signed char)(0))
+{ return f->is_constrained(i) ? 1 : 0; }
+template <class Face_handle>
+signed char is_constrained_edge(Face_handle, int, long)
+{ return 0; }
+} //namespace internal
+} //namespace SWIG_Triangulation_2
+#endif
+
+// Result of Triangulation_2_wrapper::to_arrays(): row i of point_array() is
+// the point (x,y) of the i-th finite vertex, row j of face_array() the indices
+// of the vertices of the j-th finite face, and row j of neighbor_array() the
+// indices of its neighbors, -1 being an infinite face. Neighbor k is opposite
+// to vertex k, as in the triangulation, and so is the edge k of
+// constrained_edge_array(), which is 1 for constrained edges (always 0 in
+// triangulations without constraints).
+class Triangulation_2_arrays
+{
+  std::shared_ptr<std::vector<double> >      points_sptr;
+  std::shared_ptr<std::vector<int> >         faces_sptr;
+  std::shared_ptr<std::vector<int> >         neighbors_sptr;
+  std::shared_ptr<std::vector<signed char> > constrained_sptr;
+
+public:
+  Triangulation_2_arrays()
+    : points_sptr(new std::vector<double>())
+    , faces_sptr(new std::vector<int>())
+    , neighbors_sptr(new std::vector<int>())
+    , constrained_sptr(new std::vector<signed char>()) {}
+
+  #ifndef SWIG
+  template <class Triangulation>
+  explicit Triangulation_2_arrays(const Triangulation& t)
+    : Triangulation_2_arrays()
+  {
+    typedef typename Triangulation::Vertex_handle Vertex_handle;
+    typedef typename Triangulation::Face_handle   Face_handle;
+
+    CGAL::Unique_hash_map<Vertex_handle, int> vertex_index(-1, t.number_of_vertices());
+    points_sptr->reserve(2 * t.number_of_vertices());
+    int nv = 0;
+    for (typename Triangulation::Finite_vertices_iterator v = t.finite_vertices_begin();
+         v != t.finite_vertices_end(); ++v)
+    {
+      vertex_index[v] = nv++;
+      points_sptr->push_back(v->point().x());
+      points_sptr->push_back(v->point().y());
+    }
+
+    CGAL::Unique_hash_map<Face_handle, int> face_index(-1, t.number_of_faces());
+    int nf = 0;
+    faces_sptr->reserve(3 * t.number_of_faces());
+    constrained_sptr->reserve(3 * t.number_of_faces());
+    for (typename Triangulation::Finite_faces_iterator f = t.finite_faces_begin();
+         f != t.finite_faces_end(); ++f)
+    {
+      face_index[f] = nf++;
+      for (int i = 0; i < 3; ++i)
+      {
+        faces_sptr->push_back(vertex_index[f->vertex(i)]);
+        constrained_sptr->push_back(SWIG_Triangulation_2::internal::is_constrained_edge(Face_handle(f), i, 0));
+      }
+    }
+
+    neighbors_sptr->reserve(faces_sptr->size());
+    for (typename Triangulation::Finite_faces_iterator f = t.finite_faces_begin();
+         f != t.finite_faces_end(); ++f)
+      for (int i = 0; i < 3; ++i)
+        neighbors_sptr->push_back(face_index[f->neighbor(i)]);
+  }
+  #endif
+
+  int number_of_points() const { return int(points_sptr->size() / 2); }
+  int number_of_faces() const { return int(faces_sptr->size() / 3); }
+
+  // (number_of_points(), 2)
+  SWIG_CGAL::Buffer<double> point_array() const
+  {
+    return SWIG_CGAL::Buffer<double>(points_sptr->data(), points_sptr->size() / 2, 2,
+                                     points_sptr, true);
+  }
+  // (number_of_faces(), 3)
+  SWIG_CGAL::Buffer<int> face_array() const
+  {
+    return SWIG_CGAL::Buffer<int>(faces_sptr->data(), faces_sptr->size() / 3, 3,
+                                  faces_sptr, true);
+  }
+  // (number_of_faces(), 3)
+  SWIG_CGAL::Buffer<int> neighbor_array() const
+  {
+    return SWIG_CGAL::Buffer<int>(neighbors_sptr->data(), neighbors_sptr->size() / 3, 3,
+                                  neighbors_sptr, true);
+  }
+  // (number_of_faces(), 3)
+  SWIG_CGAL::Buffer<signed char> constrained_edge_array() const
+  {
+    return SWIG_CGAL::Buffer<signed char>(constrained_sptr->data(), constrained_sptr->size() / 3, 3,
+                                          constrained_sptr, true);
+  }
+};
+
+#endif //SWIG_CGAL_TRIANGULATION_2_TRIANGULATION_2_ARRAYS_H
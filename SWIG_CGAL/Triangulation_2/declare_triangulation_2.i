@@ -23,8 +23,12 @@
   %include "std_pair.i"
   SWIG_CGAL_declare_identifier_of_template_class(CLASSNAME_PREFIX##_Edge,std::pair<SWIG_Triangulation_2::CGAL_Face_handle<CPPTYPE,POINT_TYPE>,int>)
 
+  //results of locate_with_type(), find_edge() and find_included_edge()
+  SWIG_CGAL_declare_identifier_of_template_class(CLASSNAME_PREFIX##_Location,Location<SWIG_Triangulation_2::CGAL_Face_handle<CPPTYPE,POINT_TYPE>,SWIG_Triangulation_2::Locate_type>)
+  SWIG_CGAL_declare_identifier_of_template_class(CLASSNAME_PREFIX##_Edge_lookup,SWIG_Triangulation_2::Edge_lookup<SWIG_Triangulation_2::CGAL_Vertex_handle<CPPTYPE,POINT_TYPE>,SWIG_Triangulation_2::CGAL_Face_handle<CPPTYPE,POINT_TYPE> >)
+
   //Triangulations
-  %typemap(javaimports)          Triangulation_2_wrapper%{import CGAL.Kernel.Point_2; import CGAL.Kernel.POINT_TYPE; import CGAL.Kernel.Ref_int; import CGAL.Kernel.Segment_2; import CGAL.Kernel.Triangle_2; import CGAL.Kernel.Oriented_side; import CGAL.Triangulation_2.Locate_type; import CGAL.Triangulation_2.Ref_Locate_type_2; import java.util.Iterator; import java.util.Collection;%}
+  %typemap(javaimports)          Triangulation_2_wrapper%{import CGAL.Kernel.Point_2; import CGAL.Kernel.POINT_TYPE; import CGAL.Kernel.Memory_usage; import CGAL.Kernel.Ref_int; import CGAL.Kernel.Segment_2; import CGAL.Kernel.Triangle_2; import CGAL.Kernel.Oriented_side; import CGAL.Triangulation_2.Locate_type; import CGAL.Triangulation_2.Ref_Locate_type_2; import java.util.Iterator; import java.util.Collection;%}
   SWIG_CGAL_declare_identifier_of_template_class(EXPOSEDNAME,Triangulation_2_wrapper<CPPTYPE,POINT_TYPE,SWIG_Triangulation_2::CGAL_Vertex_handle<CPPTYPE,POINT_TYPE>,SWIG_Triangulation_2::CGAL_Face_handle<CPPTYPE,POINT_TYPE>,WTAG>)
 
   //Iterators and circulators
@@ -8,6 +8,7 @@
 #define SWIG_CGAL_TRIANGULATION_2_TRIANGULATION_HANDLES_H
 
 #include <SWIG_CGAL/Common/Macros.h>
+#include <SWIG_CGAL/Kernel/Pooled_allocation.h>
 #include <SWIG_CGAL/Kernel/Point_2.h>
 
 namespace SWIG_Triangulation_2{
@@ -21,6 +22,7 @@ public:
   typedef typename Triangulation::Vertex_handle cpp_base;
   const cpp_base& get_data() const {return data;}
         cpp_base& get_data()       {return data;}
+  SWIG_CGAL_POOLED_ALLOCATION
   #endif
 //Creation
   CGAL_Vertex_handle():data(nullptr){}
@@ -57,6 +59,7 @@ public:
   CGAL_Face_handle(typename Triangulation::Face_handle v):data(v){}
   const cpp_base& get_data() const {return data;}
         cpp_base& get_data()       {return data;}
+  SWIG_CGAL_POOLED_ALLOCATION
   #endif
 
 //Access Functions    
@@ -15,6 +15,8 @@
 #include <CGAL/Constrained_Delaunay_triangulation_2.h>
 #include <CGAL/Constrained_triangulation_2.h>
 #include <CGAL/Constrained_triangulation_plus_2.h>  
+#include <CGAL/Triangulation_hierarchy_2.h>
+#include <CGAL/Triangulation_hierarchy_vertex_base_2.h>
 
 #if defined(ADD_JAVA_DATA_IN_FACET_CDT_2) || defined(ADD_JAVA_DATA_IN_SIMPLICES_DT2)
 #include <SWIG_CGAL/Java/JavaData.h>
@@ -31,6 +33,13 @@ typedef CGAL::Delaunay_triangulation_2<EPIC_Kernel,TDS_DT2>                 CGAL
 #else
 typedef CGAL::Delaunay_triangulation_2<EPIC_Kernel>                         CGAL_DT2;
 #endif
+//Delaunay triangulation hierarchy, for random order insertions and
+//locate() calls without a good hint
+typedef CGAL::Triangulation_hierarchy_vertex_base_2<
+  CGAL::Triangulation_vertex_base_2<EPIC_Kernel> >                          Vbase_DTH2;
+typedef CGAL::Triangulation_data_structure_2<Vbase_DTH2>                    TDS_DTH2;
+typedef CGAL::Triangulation_hierarchy_2<
+  CGAL::Delaunay_triangulation_2<EPIC_Kernel,TDS_DTH2> >                    CGAL_DTH2;
 typedef EPIC_Kernel CGAL_regular_traits;
 typedef CGAL::Regular_triangulation_2<CGAL_regular_traits>                  CGAL_RT2;
 #ifndef ADD_JAVA_DATA_IN_FACET_CDT_2
@@ -50,6 +59,18 @@ typedef CGAL::Constrained_triangulation_2<EPIC_Kernel,CDT_TDS,EP_tag>
 typedef CGAL::Constrained_Delaunay_triangulation_2<EPIC_Kernel,CDT_TDS,EP_tag>      CGAL_CDT2;
 typedef CGAL::Constrained_triangulation_plus_2<CGAL_CDT2>                   CGAL_CDTplus2;
 
+//Instantiations without the info fields, for the users who do not need them
+//(a jobject and a reference counter pointer per vertex and per face)
+#ifdef ADD_JAVA_DATA_IN_SIMPLICES_DT2
+typedef CGAL::Delaunay_triangulation_2<EPIC_Kernel>                         CGAL_DT2_without_info;
+#endif
+#ifdef ADD_JAVA_DATA_IN_FACET_CDT_2
+typedef CGAL::Triangulation_data_structure_2 <
+    CGAL::Triangulation_vertex_base_2<EPIC_Kernel>,
+    CGAL::Constrained_triangulation_face_base_2<EPIC_Kernel> >              CDT_TDS_without_info;
+typedef CGAL::Constrained_Delaunay_triangulation_2<EPIC_Kernel,CDT_TDS_without_info,EP_tag> CGAL_CDT2_without_info;
+#endif
+
 typedef std::pair<EPIC_Kernel::Point_2,EPIC_Kernel::Point_2>                iConstraint;
 
 #endif //SWIG_CGAL_TRIANGULATION_2_TYPEDEFS_H
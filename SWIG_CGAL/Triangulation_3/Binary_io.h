@@ -0,0 +1,259 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+
+#ifndef SWIG_CGAL_TRIANGULATION_3_BINARY_IO_H
+#define SWIG_CGAL_TRIANGULATION_3_BINARY_IO_H
+
+#include <SWIG_CGAL/Triangulation_3/Point_rows.h>
+
+#include <CGAL/Delaunay_triangulation_3.h>
+#include <CGAL/Unique_hash_map.h>
+
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+// Binary format of a triangulation, written in the byte order of the machine:
+//   char[8]  magic "CGALTR3B"
+//   uint32   version
+//   uint32   1 for weighted points, 0 otherwise
+//   int32    dimension
+//   then vectors, each stored as an uint64 size followed by its raw values:
+//   double   coordinates of the finite vertices, 3 (or 4 with the weight) per vertex
+//   uint32   incident cell of each vertex, the infinite vertex first
+//   uint32   4 vertices of each cell
+//   uint32   4 neighbors of each cell
+// Vertex 0 is the infinite vertex and vertex i+1 the i-th finite vertex; all
+// the cells are stored, including the infinite ones, and in dimension d<3 the
+// entries d+1..3 of a cell are null_index(). The hidden points of regular
+// triangulations are not stored, nor the upper levels of a hierarchy (see
+// rebuild_hierarchy()).
+namespace SWIG_Triangulation_3 {
+
+namespace internal{
+
+inline std::uint32_t null_index() { return (std::numeric_limits<std::uint32_t>::max)(); }
+
+// The triangulations without hierarchy are complete once their bottom level
+// is read.
+template <class Triangulation>
+void rebuild_hierarchy(Triangulation&, bool /* handles_requested */) {}
+
+// A Fast_location Delaunay triangulation is read as its bottom level only,
+// whose vertices are not in the upper levels: it is rebuilt by inserting its
+// points, for its locate() to be logarithmic again. The handles of the cells
+// and vertices read are then not kept.
+template <class Gt, class Tds, class Lock>
+void rebuild_hierarchy(CGAL::Delaunay_triangulation_3<Gt, Tds, CGAL::Fast_location, Lock>& t,
+                       bool handles_requested)
+{
+  typedef CGAL::Delaunay_triangulation_3<Gt, Tds, CGAL::Fast_location, Lock> Triangulation;
+  if (handles_requested)
+    throw std::invalid_argument("The cells and vertices of a hierarchy cannot be kept by read_binary()");
+  std::vector<typename Triangulation::Point> points;
+  points.reserve(t.number_of_vertices());
+  for (typename Triangulation::Finite_vertices_iterator v = t.finite_vertices_begin();
+       v != t.finite_vertices_end(); ++v)
+    points.push_back(v->point());
+  Triangulation rebuilt(points.begin(), points.end());
+  t.swap(rebuilt);
+}
+
+template <typename T>
+void write_vector (std::ostream& os, const std::vector<T>& values)
+{
+  std::uint64_t size = values.size();
+  os.write (reinterpret_cast<const char*>(&size), sizeof(size));
+  os.write (reinterpret_cast<const char*>(values.data()), std::streamsize(size * sizeof(T)));
+}
+
+template <typename T>
+void read_vector (std::istream& is, std::vector<T>& values)
+{
+  std::uint64_t size = 0;
+  is.read (reinterpret_cast<char*>(&size), sizeof(size));
+  if (!is)
+    throw std::runtime_error("Truncated triangulation file");
+  values.resize (std::size_t(size));
+  is.read (reinterpret_cast<char*>(values.data()), std::streamsize(size * sizeof(T)));
+  if (!is)
+    throw std::runtime_error("Truncated triangulation file");
+}
+
+} //namespace internal
+
+inline const char* binary_magic() { return "CGALTR3B"; }
+inline std::uint32_t binary_version() { return 1; }
+
+// Writes t to os. If not null, `cells` (resp. `vertices`) receives the cells
+// (resp. finite vertices) in the order they are stored.
+template <class Triangulation>
+void write_binary(std::ostream& os, const Triangulation& t,
+                  std::vector<typename Triangulation::Cell_handle>* cells = nullptr,
+                  std::vector<typename Triangulation::Vertex_handle>* vertices = nullptr)
+{
+  typedef typename Triangulation::Vertex_handle Vertex_handle;
+  typedef typename Triangulation::Cell_handle   Cell_handle;
+  typedef typename Triangulation::Weighted_tag  Weighted_tag;
+
+  const std::size_t nv = t.number_of_vertices() + 1;
+  const std::size_t nc = t.tds().number_of_cells();
+  if (nv >= internal::null_index() || nc >= internal::null_index())
+    throw std::runtime_error("The triangulation is too large for the binary format");
+
+  std::uint32_t version = binary_version();
+  std::uint32_t weighted = Weighted_tag::value ? 1 : 0;
+  std::int32_t dimension = t.dimension();
+  os.write (binary_magic(), 8);
+  os.write (reinterpret_cast<const char*>(&version), sizeof(version));
+  os.write (reinterpret_cast<const char*>(&weighted), sizeof(weighted));
+  os.write (reinterpret_cast<const char*>(&dimension), sizeof(dimension));
+
+  CGAL::Unique_hash_map<Vertex_handle, std::uint32_t> vertex_index(internal::null_index(), nv);
+  std::vector<Vertex_handle> ordered_vertices;
+  ordered_vertices.reserve(nv);
+  ordered_vertices.push_back(t.infinite_vertex());
+  std::vector<double> coordinates;
+  coordinates.reserve((Weighted_tag::value ? 4 : 3) * (nv - 1));
+  for (typename Triangulation::Finite_vertices_iterator v = t.finite_vertices_begin();
+       v != t.finite_vertices_end(); ++v)
+  {
+    ordered_vertices.push_back(v);
+    internal::append_point_row(coordinates, v->point(), Weighted_tag());
+  }
+  for (std::size_t i = 0; i < ordered_vertices.size(); ++i)
+    vertex_index[ordered_vertices[i]] = std::uint32_t(i);
+
+  CGAL::Unique_hash_map<Cell_handle, std::uint32_t> cell_index(internal::null_index(), nc);
+  std::vector<Cell_handle> ordered_cells;
+  ordered_cells.reserve(nc);
+  for (typename Triangulation::Cell_iterator c = t.tds().raw_cells_begin();
+       c != t.tds().raw_cells_end(); ++c)
+  {
+    cell_index[c] = std::uint32_t(ordered_cells.size());
+    ordered_cells.push_back(c);
+  }
+
+  std::vector<std::uint32_t> vertex_cells;
+  vertex_cells.reserve(nv);
+  for (Vertex_handle v : ordered_vertices)
+    vertex_cells.push_back(v->cell() == Cell_handle() ? internal::null_index() : cell_index[v->cell()]);
+
+  std::vector<std::uint32_t> cell_vertices, cell_neighbors;
+  cell_vertices.reserve(4 * nc);
+  cell_neighbors.reserve(4 * nc);
+  for (Cell_handle c : ordered_cells)
+    for (int i = 0; i < 4; ++i)
+    {
+      cell_vertices.push_back(i > dimension ? internal::null_index() : vertex_index[c->vertex(i)]);
+      cell_neighbors.push_back(i > dimension ? internal::null_index() : cell_index[c->neighbor(i)]);
+    }
+
+  internal::write_vector (os, coordinates);
+  internal::write_vector (os, vertex_cells);
+  internal::write_vector (os, cell_vertices);
+  internal::write_vector (os, cell_neighbors);
+  if (!os)
+    throw std::runtime_error("Cannot write the triangulation");
+
+  if (cells != nullptr)
+    cells->swap(ordered_cells);
+  if (vertices != nullptr)
+    vertices->assign(ordered_vertices.begin() + 1, ordered_vertices.end());
+}
+
+// Replaces t by the triangulation read from is. If not null, `cells`
+// (resp. `vertices`) receives the cells (resp. finite vertices) in the order
+// they are stored.
+template <class Triangulation>
+void read_binary(std::istream& is, Triangulation& t,
+                 std::vector<typename Triangulation::Cell_handle>* cells = nullptr,
+                 std::vector<typename Triangulation::Vertex_handle>* vertices = nullptr)
+{
+  typedef typename Triangulation::Vertex_handle Vertex_handle;
+  typedef typename Triangulation::Cell_handle   Cell_handle;
+  typedef typename Triangulation::Weighted_tag  Weighted_tag;
+  typedef typename Triangulation::Point         Cpp_point;
+
+  char header[8];
+  std::uint32_t version = 0, weighted = 0;
+  std::int32_t dimension = 0;
+  is.read (header, 8);
+  is.read (reinterpret_cast<char*>(&version), sizeof(version));
+  is.read (reinterpret_cast<char*>(&weighted), sizeof(weighted));
+  is.read (reinterpret_cast<char*>(&dimension), sizeof(dimension));
+  if (!is || std::memcmp (header, binary_magic(), 8) != 0)
+    throw std::runtime_error("Not a triangulation file");
+  if (version != binary_version())
+    throw std::runtime_error("Unsupported triangulation file version");
+  if (weighted != (Weighted_tag::value ? 1u : 0u))
+    throw std::runtime_error(weighted ? "The file stores a triangulation of weighted points"
+                                      : "The file stores a triangulation of unweighted points");
+
+  const std::size_t row_size = Weighted_tag::value ? 4 : 3;
+  std::vector<double> coordinates;
+  std::vector<std::uint32_t> vertex_cells, cell_vertices, cell_neighbors;
+  internal::read_vector (is, coordinates);
+  internal::read_vector (is, vertex_cells);
+  internal::read_vector (is, cell_vertices);
+  internal::read_vector (is, cell_neighbors);
+  const std::size_t nv = vertex_cells.size();
+  const std::size_t nc = cell_vertices.size() / 4;
+  if (dimension < -1 || dimension > 3 || nv == 0 || coordinates.size() != row_size * (nv - 1)
+      || cell_vertices.size() % 4 != 0 || cell_neighbors.size() != cell_vertices.size())
+    throw std::runtime_error("Invalid triangulation file");
+  for (std::uint32_t c : vertex_cells)
+    if (c != internal::null_index() && c >= nc)
+      throw std::runtime_error("Invalid triangulation file");
+  for (std::size_t k = 0; k < cell_vertices.size(); ++k)
+    if (int(k % 4) <= dimension && (cell_vertices[k] >= nv || cell_neighbors[k] >= nc))
+      throw std::runtime_error("Invalid triangulation file");
+
+  t.clear();
+  if (cells != nullptr) cells->clear();
+  if (vertices != nullptr) vertices->clear();
+  if (dimension == -1) return;
+
+  typename Triangulation::Triangulation_data_structure& tds = t.tds();
+  tds.clear();
+  tds.set_dimension(dimension);
+
+  std::vector<Vertex_handle> new_vertices(nv);
+  new_vertices[0] = tds.create_vertex();
+  t.set_infinite_vertex(new_vertices[0]);
+  for (std::size_t i = 1; i < nv; ++i)
+  {
+    new_vertices[i] = tds.create_vertex();
+    new_vertices[i]->set_point(internal::make_point<Cpp_point>(coordinates.data() + row_size * (i - 1), Weighted_tag()));
+  }
+
+  std::vector<Cell_handle> new_cells(nc);
+  for (std::size_t j = 0; j < nc; ++j)
+  {
+    new_cells[j] = tds.create_cell();
+    for (int i = 0; i <= dimension; ++i)
+      new_cells[j]->set_vertex(i, new_vertices[cell_vertices[4 * j + i]]);
+  }
+  for (std::size_t j = 0; j < nc; ++j)
+    for (int i = 0; i <= dimension; ++i)
+      new_cells[j]->set_neighbor(i, new_cells[cell_neighbors[4 * j + i]]);
+  for (std::size_t i = 0; i < nv; ++i)
+    if (vertex_cells[i] != internal::null_index())
+      new_vertices[i]->set_cell(new_cells[vertex_cells[i]]);
+
+  if (cells != nullptr)
+    cells->swap(new_cells);
+  if (vertices != nullptr)
+    vertices->assign(new_vertices.begin() + 1, new_vertices.end());
+  internal::rebuild_hierarchy(t, cells != nullptr || vertices != nullptr);
+}
+
+} //namespace SWIG_Triangulation_3
+
+#endif //SWIG_CGAL_TRIANGULATION_3_BINARY_IO_H
@@ -16,6 +16,16 @@ SWIG_CGAL_package_common()
 
 %import  "SWIG_CGAL/Common/Macros.h"
 %import  "SWIG_CGAL/Kernel/CGAL_Kernel.i"
+
+//typemaps for the insertion and the moves of points from arrays and the export to arrays
+%include "SWIG_CGAL/typemaps.i"
+SWIG_CGAL_buffer_of_double_typemap_in
+SWIG_CGAL_buffer_of_int_typemap_in
+SWIG_CGAL_buffer_of_double_typemap_out
+SWIG_CGAL_buffer_of_int_typemap_out
+SWIG_CGAL_buffer_of_signed_char_typemap_out
+SWIG_CGAL_buffer_of_unsigned_char_typemap_in
+SWIG_CGAL_buffer_of_unsigned_char_typemap_out
 %include "SWIG_CGAL/Common/Iterator.h"
 
 %include "CGAL/version.h"
@@ -32,6 +42,16 @@ SWIG_CGAL_package_common()
 
 
 //definitions
+SWIG_CGAL_release_gil(Triangulation_3_wrapper::to_arrays)
+SWIG_CGAL_release_gil(Triangulation_3_wrapper::write_binary)
+SWIG_CGAL_release_gil(Triangulation_3_wrapper::read_binary)
+//queries that can run concurrently on a frozen triangulation
+SWIG_CGAL_release_gil(Triangulation_3_wrapper::locate)
+SWIG_CGAL_release_gil(Triangulation_3_wrapper::locate_batch)
+SWIG_CGAL_release_gil(Delaunay_triangulation_3_wrapper::nearest_vertex)
+SWIG_CGAL_release_gil(Regular_triangulation_3_wrapper::nearest_power_vertex)
+%include "SWIG_CGAL/Triangulation_3/Triangulation_3_arrays.h"
+%include "SWIG_CGAL/Common/Location_batch.h"
 %include "SWIG_CGAL/Triangulation_3/Triangulation_3.h"
 %include "SWIG_CGAL/Triangulation_3/Delaunay_triangulation_3.h"
 %include "SWIG_CGAL/Triangulation_3/Regular_triangulation_3.h"
@@ -61,9 +81,25 @@ SWIG_CGAL_declare_triangulation_3(Triangulation_3,CGAL_T3)
 
 %import "SWIG_CGAL/Triangulation_3/declare_Delaunay_triangulation_3.i"
 SWIG_CGAL_declare_Delaunay_triangulation_3(Delaunay_triangulation_3,CGAL_DT3)
+SWIG_CGAL_declare_Delaunay_triangulation_3(Parallel_Delaunay_triangulation_3,CGAL_PDT3)
+SWIG_CGAL_declare_Delaunay_triangulation_3(Fast_location_Delaunay_triangulation_3,CGAL_FDT3)
 
 %import "SWIG_CGAL/Triangulation_3/declare_regular_triangulation_3.i"
 SWIG_CGAL_declare_regular_triangulation_3(Regular_triangulation_3,CGAL_RT3)
+SWIG_CGAL_declare_regular_triangulation_3(Parallel_Regular_triangulation_3,CGAL_PRT3)
+
+#ifdef SWIGPYTHON
+//pickling and shared memory transport, see CGAL.add_pickle_support()
+%pythoncode %{
+import CGAL as _CGAL
+_CGAL.add_pickle_support(Triangulation_3)
+_CGAL.add_pickle_support(Delaunay_triangulation_3)
+_CGAL.add_pickle_support(Parallel_Delaunay_triangulation_3)
+_CGAL.add_pickle_support(Fast_location_Delaunay_triangulation_3)
+_CGAL.add_pickle_support(Regular_triangulation_3)
+_CGAL.add_pickle_support(Parallel_Regular_triangulation_3)
+%}
+#endif
 
 #ifdef SWIG_CGAL_HAS_Triangulation_3_USER_PACKAGE
 %include "SWIG_CGAL/User_packages/Triangulation_3/extensions.i"
@@ -9,6 +9,176 @@
 
 #include <SWIG_CGAL/Triangulation_3/Triangulation_3.h>
 
+#ifndef SWIG
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace SWIG_Triangulation_3 {
+
+// Moves the finite vertex of index ids[i] to the point of the row i of
+// coords, in the order of a Hilbert sort of the new positions so that
+// consecutive moves touch neighboring cells. Dt::move() keeps a vertex in
+// place when the triangulation stays Delaunay, and otherwise inserts the new
+// point near the vertex before removing it. A vertex moved onto another
+// vertex is merged with it. Returns for each row the index of its vertex in
+// the finite vertices iteration after the moves.
+template <class Dt>
+std::vector<int> move_in_spatial_order(Dt& t, const SWIG_CGAL::Buffer<int>& ids,
+                                       const SWIG_CGAL::Buffer<double>& coords)
+{
+  typedef typename Dt::Vertex_handle                                    Vertex_handle;
+  typedef SWIG_CGAL::Array_point_map<EPIC_Kernel::Point_3,3>            Point_map;
+  typedef std::unordered_map<Vertex_handle,std::size_t,CGAL::Handle_hash_function> Row_map;
+
+  const std::size_t n = SWIG_CGAL::number_of_rows(coords,3);
+  if (ids.size() != n)
+    throw std::invalid_argument("The number of vertex ids must be the number of positions");
+  const double* data = coords.data();
+  SWIG_CGAL::Gil_release gil;
+
+  std::vector<Vertex_handle> vertices;
+  vertices.reserve(t.number_of_vertices());
+  for (typename Dt::Finite_vertices_iterator v = t.finite_vertices_begin(); v != t.finite_vertices_end(); ++v)
+    vertices.push_back(v);
+
+  // current[i] is the vertex of row i, unless row i was merged with row merged[i]
+  std::vector<Vertex_handle> current(n);
+  std::vector<std::size_t> merged(n, n);
+  Row_map row_of;
+  row_of.reserve(n);
+  for (std::size_t i = 0; i < n; ++i)
+  {
+    const int id = ids.data()[i];
+    if (id < 0 || std::size_t(id) >= vertices.size())
+      throw std::out_of_range("Invalid vertex id " + std::to_string(id));
+    current[i] = vertices[id];
+    if (!row_of.insert(std::make_pair(current[i], i)).second)
+      throw std::invalid_argument("Vertex id " + std::to_string(id) + " is moved twice");
+  }
+
+  std::vector<std::size_t> order(n);
+  for (std::size_t i = 0; i < n; ++i)
+    order[i] = i;
+  CGAL::spatial_sort(order.begin(), order.end(),
+                     CGAL::Spatial_sort_traits_adapter_3<EPIC_Kernel,Point_map>(Point_map(data,3)));
+
+  for (std::size_t i : order)
+  {
+    const Vertex_handle v = current[i];
+    const Vertex_handle w = t.move(v, typename Dt::Point(data[3*i], data[3*i+1], data[3*i+2]));
+    if (w == v) continue;
+    row_of.erase(v);
+    typename Row_map::iterator it = row_of.find(w);
+    if (it != row_of.end())
+      merged[i] = it->second;
+    else
+    {
+      current[i] = w;
+      row_of.insert(std::make_pair(w, i));
+    }
+  }
+
+  std::unordered_map<Vertex_handle,int,CGAL::Handle_hash_function> vertex_index;
+  vertex_index.reserve(t.number_of_vertices());
+  int nv = 0;
+  for (typename Dt::Finite_vertices_iterator v = t.finite_vertices_begin(); v != t.finite_vertices_end(); ++v)
+    vertex_index[v] = nv++;
+  std::vector<int> indices(n);
+  for (std::size_t i = 0; i < n; ++i)
+  {
+    std::size_t r = i;
+    while (merged[r] != n)
+      r = merged[r];
+    indices[i] = vertex_index[current[r]];
+  }
+  return indices;
+}
+
+namespace internal {
+
+template <class Dt, class Vertex_iterator>
+void remove_range(Dt& t, Vertex_iterator first, Vertex_iterator end, CGAL::Sequential_tag)
+{
+  t.remove(first, end);
+}
+
+#ifdef CGAL_LINKED_WITH_TBB
+// The vertices are removed concurrently, with a lock grid covering the
+// triangulation unless t already has one, as in insert_points()
+template <class Dt, class Vertex_iterator>
+void remove_range(Dt& t, Vertex_iterator first, Vertex_iterator end, CGAL::Parallel_tag)
+{
+  if (first == end) return;
+  if (t.get_lock_data_structure() != nullptr)
+  {
+    t.remove(first, end);
+    return;
+  }
+  CGAL::Bbox_3 bbox = t.finite_vertices_begin()->point().bbox();
+  for (typename Dt::Finite_vertices_iterator v = t.finite_vertices_begin(); v != t.finite_vertices_end(); ++v)
+    bbox += v->point().bbox();
+  typename Dt::Lock_data_structure lock_ds(bbox, 50);
+  t.set_lock_data_structure(&lock_ds);
+  t.remove(first, end);
+  t.set_lock_data_structure(nullptr);
+}
+#endif
+
+} //namespace internal
+
+// Removes the finite vertices of indices ids (in the finite vertices
+// iteration, an index may be repeated) in the order of a Hilbert sort of
+// their points, so that consecutive removals touch neighboring cells, and
+// concurrently if the data structure of t uses CGAL::Parallel_tag. Returns
+// the number of removed vertices.
+template <class Dt>
+std::size_t remove_in_spatial_order(Dt& t, const SWIG_CGAL::Buffer<int>& ids)
+{
+  typedef typename Dt::Vertex_handle                                    Vertex_handle;
+  typedef SWIG_CGAL::Array_point_map<EPIC_Kernel::Point_3,3>            Point_map;
+
+  SWIG_CGAL::Gil_release gil;
+  std::vector<Vertex_handle> vertices;
+  vertices.reserve(t.number_of_vertices());
+  for (typename Dt::Finite_vertices_iterator v = t.finite_vertices_begin(); v != t.finite_vertices_end(); ++v)
+    vertices.push_back(v);
+
+  std::vector<char> selected(vertices.size(), 0);
+  std::vector<Vertex_handle> removed;
+  std::vector<double> coords;
+  for (std::size_t i = 0; i < ids.size(); ++i)
+  {
+    const int id = ids.data()[i];
+    if (id < 0 || std::size_t(id) >= vertices.size())
+      throw std::out_of_range("Invalid vertex id " + std::to_string(id));
+    if (selected[id]) continue;
+    selected[id] = 1;
+    removed.push_back(vertices[id]);
+    coords.push_back(vertices[id]->point().x());
+    coords.push_back(vertices[id]->point().y());
+    coords.push_back(vertices[id]->point().z());
+  }
+
+  std::vector<std::size_t> order(removed.size());
+  for (std::size_t i = 0; i < order.size(); ++i)
+    order[i] = i;
+  CGAL::spatial_sort(order.begin(), order.end(),
+                     CGAL::Spatial_sort_traits_adapter_3<EPIC_Kernel,Point_map>(Point_map(coords.data(),3)));
+  std::vector<Vertex_handle> ordered;
+  ordered.reserve(order.size());
+  for (std::size_t i : order)
+    ordered.push_back(removed[i]);
+
+  const std::size_t size_before = t.number_of_vertices();
+  internal::remove_range(t, ordered.begin(), ordered.end(), typename Dt::Concurrency_tag());
+  return size_before - t.number_of_vertices();
+}
+
+} //namespace SWIG_Triangulation_3
+#endif
+
 template <class Triangulation,class Vertex_handle_, class Cell_handle_, 
 class Memory_holder
 #ifndef SWIG
@@ -43,9 +213,24 @@ public:
   Delaunay_triangulation_3_wrapper(const Delaunay_triangulation_3_wrapper& dt) = default;
   Delaunay_triangulation_3_wrapper(Point_range range):Base(SWIG_CGAL::get_begin(range),SWIG_CGAL::get_end(range)){}
 //Point moving
-  SWIG_CGAL_FORWARD_CALL_AND_REF_2(Vertex_handle,move,Vertex_handle,Point_3);
+  SWIG_CGAL_FORWARD_MODIFYING_CALL_AND_REF_2(Vertex_handle,move,Vertex_handle,Point_3);
+  //the vertex of index vertex_ids[i] in the finite vertices iteration (as in to_arrays())
+  //is moved to the row i (x,y,z) of new_positions. Returns for each row the index of its
+  //vertex in the finite vertices iteration after the moves.
+  SWIG_CGAL::Buffer<int> move_batch(SWIG_CGAL::Buffer<int> vertex_ids, SWIG_CGAL::Buffer<double> new_positions){
+    this->check_not_frozen("move_batch");
+    std::vector<int> indices=SWIG_Triangulation_3::move_in_spatial_order(this->get_data(),vertex_ids,new_positions);
+    return SWIG_CGAL::Buffer<int>(std::move(indices),1);
+  }
 //Removal
-  SWIG_CGAL_FORWARD_CALL_1(void,remove,Vertex_handle)
+  SWIG_CGAL_FORWARD_MODIFYING_CALL_1(void,remove,Vertex_handle)
+  //removes the vertices of indices vertex_ids in the finite vertices iteration (as in
+  //to_arrays()), in spatial order and concurrently for a parallel triangulation. Returns
+  //the number of removed vertices; the remaining vertices are renumbered.
+  int remove_batch(SWIG_CGAL::Buffer<int> vertex_ids){
+    this->check_not_frozen("remove_batch");
+    return static_cast<int>(SWIG_Triangulation_3::remove_in_spatial_order(this->get_data(),vertex_ids));
+  }
 //Queries
   SWIG_CGAL_FORWARD_CALL_2(Bounded_side,side_of_sphere,Cell_handle,Point_3)
   SWIG_CGAL_FORWARD_CALL_2(Bounded_side,side_of_circle,Facet,Point_3)
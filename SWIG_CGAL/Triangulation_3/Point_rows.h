@@ -0,0 +1,67 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+
+#ifndef SWIG_CGAL_TRIANGULATION_3_POINT_ROWS_H
+#define SWIG_CGAL_TRIANGULATION_3_POINT_ROWS_H
+
+#include <CGAL/Kernel_traits.h>
+#include <CGAL/tags.h>
+
+#include <vector>
+
+namespace SWIG_Triangulation_3 {
+namespace internal{
+
+// The point of a row of coordinates (x,y,z) or (x,y,z,weight)
+template <class Point>
+Point make_point(const double* row, CGAL::Tag_false)
+{
+  return Point(row[0], row[1], row[2]);
+}
+
+template <class Point>
+Point make_point(const double* row, CGAL::Tag_true)
+{
+  typedef typename CGAL::Kernel_traits<Point>::Kernel::Point_3 Bare_point;
+  return Point(Bare_point(row[0], row[1], row[2]), row[3]);
+}
+
+// The point of a query (x,y,z), with a null weight for weighted points
+template <class Point>
+Point make_query_point(const double* row, CGAL::Tag_false)
+{
+  return Point(row[0], row[1], row[2]);
+}
+
+template <class Point>
+Point make_query_point(const double* row, CGAL::Tag_true)
+{
+  typedef typename CGAL::Kernel_traits<Point>::Kernel::Point_3 Bare_point;
+  return Point(Bare_point(row[0], row[1], row[2]), 0);
+}
+
+// Appends the coordinates (x,y,z), or (x,y,z,weight) for weighted points, of p
+template <class Point>
+void append_point_row(std::vector<double>& row, const Point& p, CGAL::Tag_false)
+{
+  row.push_back(p.x());
+  row.push_back(p.y());
+  row.push_back(p.z());
+}
+
+template <class Point>
+void append_point_row(std::vector<double>& row, const Point& p, CGAL::Tag_true)
+{
+  row.push_back(p.point().x());
+  row.push_back(p.point().y());
+  row.push_back(p.point().z());
+  row.push_back(p.weight());
+}
+
+} //namespace internal
+} //namespace SWIG_Triangulation_3
+
+#endif //SWIG_CGAL_TRIANGULATION_3_POINT_ROWS_H
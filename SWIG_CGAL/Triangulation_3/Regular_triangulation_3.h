@@ -9,6 +9,43 @@
 
 #include <SWIG_CGAL/Triangulation_3/Triangulation_3.h>
 
+#ifndef SWIG
+#include <algorithm>
+#include <array>
+#include <vector>
+
+namespace SWIG_Triangulation_3 {
+
+// Indices of the rows (x,y,z,weight) of coords whose weighted point is not
+// the point of a finite vertex of t, in increasing order
+template <class Rt>
+std::vector<int> hidden_rows(const Rt& t, const SWIG_CGAL::Buffer<double>& coords)
+{
+  typedef std::array<double,4> Row;
+  const std::size_t n = SWIG_CGAL::number_of_rows(coords,4);
+  const double* data = coords.data();
+  SWIG_CGAL::Gil_release gil;
+  std::vector<Row> vertex_rows;
+  vertex_rows.reserve(t.number_of_vertices());
+  for (typename Rt::Finite_vertices_iterator v = t.finite_vertices_begin(); v != t.finite_vertices_end(); ++v)
+  {
+    const typename Rt::Point& p = v->point();
+    vertex_rows.push_back(Row{{p.point().x(), p.point().y(), p.point().z(), p.weight()}});
+  }
+  std::sort(vertex_rows.begin(), vertex_rows.end());
+  std::vector<int> hidden;
+  for (std::size_t i = 0; i < n; ++i)
+  {
+    const double* r = data + 4 * i;
+    if (!std::binary_search(vertex_rows.begin(), vertex_rows.end(), Row{{r[0], r[1], r[2], r[3]}}))
+      hidden.push_back(int(i));
+  }
+  return hidden;
+}
+
+} //namespace SWIG_Triangulation_3
+#endif
+
 template <class Triangulation,class Vertex_handle_, class Cell_handle_,
 class Memory_holder
 #ifndef SWIG
@@ -36,8 +73,15 @@ public:
   //constructor using a triangulation stored outside the wrapper class ( introduced for C3T3::triangulation() )
   Regular_triangulation_3_wrapper(typename Base::cpp_base* base,Memory_holder mh):Base(base,mh){}
   #endif
+//Hidden points
+  //indices of the rows (x,y,z,weight) of an array, e.g. given to insert_from_array(),
+  //that are not the point of a vertex: hidden points, or points not inserted
+  SWIG_CGAL::Buffer<int> hidden_rows(SWIG_CGAL::Buffer<double> coords) const {
+    std::vector<int> rows=SWIG_Triangulation_3::hidden_rows(this->get_data(),coords);
+    return SWIG_CGAL::Buffer<int>(std::move(rows),1);
+  }
 //Removal
-  SWIG_CGAL_FORWARD_CALL_1(void,remove,Vertex_handle)  
+  SWIG_CGAL_FORWARD_MODIFYING_CALL_1(void,remove,Vertex_handle)  
 //Queries
   SWIG_CGAL_FORWARD_CALL_2(Bounded_side,side_of_power_sphere,Cell_handle,Weighted_point_3)
   SWIG_CGAL_FORWARD_CALL_2(Bounded_side,side_of_power_circle,Facet,Weighted_point_3)
@@ -22,13 +22,92 @@
 #include <SWIG_CGAL/Common/Input_iterator_wrapper.h>
 #include <SWIG_CGAL/Common/Output_iterator_wrapper.h>
 #include <SWIG_CGAL/Common/Iterator.h>
+#include <SWIG_CGAL/Common/Gil_release.h>
+#include <SWIG_CGAL/Common/Freeze_state.h>
+#include <SWIG_CGAL/Common/Shared_memory.h>
+#include <SWIG_CGAL/Common/Spatial_insertion.h>
+#include <SWIG_CGAL/Common/Location_batch.h>
+#include <SWIG_CGAL/Common/Memory_usage.h>
+#include <SWIG_CGAL/Triangulation_3/Triangulation_3_arrays.h>
+#include <SWIG_CGAL/Triangulation_3/Point_rows.h>
+#include <SWIG_CGAL/Triangulation_3/Binary_io.h>
 #include <SWIG_CGAL/Kernel/enum.h>
 
+#include <CGAL/Bbox_3.h>
+#include <CGAL/Handle_hash_function.h>
+#include <CGAL/Spatial_sort_traits_adapter_3.h>
+#include <CGAL/tags.h>
+
 #include <sstream>
+#include <stdexcept>
+#include <string>
 #include <fstream>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
 
 namespace SWIG_Triangulation_3 {
 enum Locate_type { VERTEX=0, EDGE, FACET, CELL, OUTSIDE_CONVEX_HULL, OUTSIDE_AFFINE_HULL};
+
+#ifndef SWIG
+namespace internal{
+
+//locate() does not modify the triangulation, queries can run concurrently
+#ifdef CGAL_LINKED_WITH_TBB
+typedef CGAL::Parallel_tag   Locate_concurrency_tag;
+#else
+typedef CGAL::Sequential_tag Locate_concurrency_tag;
+#endif
+
+template <class Triangulation, class PointIterator>
+std::size_t insert_range(Triangulation& t, PointIterator first, PointIterator end, CGAL::Sequential_tag)
+{
+  return t.insert(first, end);
+}
+
+#ifdef CGAL_LINKED_WITH_TBB
+// The points are inserted concurrently, the threads locking the cells they
+// modify with a grid covering the points and the current triangulation.
+// Unless t already has one, the lock grid only exists during the insertion.
+template <class Triangulation>
+std::size_t insert_points(Triangulation& t, std::vector<typename Triangulation::Point>& points)
+{
+  if (points.empty()) return 0;
+  SWIG_CGAL::Gil_release gil;
+  if (t.get_lock_data_structure() != nullptr)
+    return t.insert(points.begin(), points.end());
+  CGAL::Bbox_3 bbox = points.front().bbox();
+  for (const typename Triangulation::Point& p : points)
+    bbox += p.bbox();
+  for (typename Triangulation::Finite_vertices_iterator v = t.finite_vertices_begin(); v != t.finite_vertices_end(); ++v)
+    bbox += v->point().bbox();
+  typename Triangulation::Lock_data_structure lock_ds(bbox, 50);
+  t.set_lock_data_structure(&lock_ds);
+  std::size_t n = t.number_of_vertices();
+  t.insert(points.begin(), points.end());
+  t.set_lock_data_structure(nullptr);
+  return t.number_of_vertices() - n;
+}
+
+template <class Triangulation, class PointIterator>
+std::size_t insert_range(Triangulation& t, PointIterator first, PointIterator end, CGAL::Parallel_tag)
+{
+  std::vector<typename Triangulation::Point> points(first, end);
+  return insert_points(t, points);
+}
+#endif
+
+} //namespace internal
+
+// Inserts the points of [first,end) in t, concurrently if the data structure
+// of t uses CGAL::Parallel_tag, and returns the number of inserted points
+template <class Triangulation, class PointIterator>
+std::size_t insert_range(Triangulation& t, PointIterator first, PointIterator end)
+{
+  return internal::insert_range(t, first, end, typename Triangulation::Concurrency_tag());
+}
+#endif
+
 } //namespace SWIG_Triangulation_3
 
 #if !SWIG_CGAL_NON_SUPPORTED_TARGET_LANGUAGE
@@ -62,12 +141,23 @@ protected:
   Triangulation* data_ptr;
   Memory_holder mem_holder;
   bool own_triangulation;
+  SWIG_CGAL::Freeze_state freeze_state;
+  void check_not_frozen(const char* function) const {freeze_state.check_not_frozen(function);}
   const typename Triangulation::Cell_handle& convert (const Cell_handle& c) {return c.get_data();}
   typename Triangulation::Cell_handle& convert (Cell_handle& c) {return c.get_data();}
   const typename Triangulation::Vertex_handle& convert (const Vertex_handle& v) {return v.get_data();}
   typename Triangulation::Vertex_handle& convert (Vertex_handle& v) {return v.get_data();}
   template <class T> const T& convert(const Reference_wrapper<T>& ref){return ref.object();}
   template <class T> T& convert(Reference_wrapper<T>& ref){return ref.object();}
+  #ifndef SWIG
+  template <class Hint>
+  Location<Cell_handle,SWIG_Triangulation_3::Locate_type> internal_locate_with_type(const Point& query,const Hint& hint) const {
+    typename cpp_base::Locate_type lt;
+    int li=-1, lj=-1;
+    typename cpp_base::Cell_handle c=get_data().locate(query.get_data(),lt,li,lj,hint);
+    return Location<Cell_handle,SWIG_Triangulation_3::Locate_type>(Cell_handle(c),CGAL::enum_cast<SWIG_Triangulation_3::Locate_type>(lt),li,lj);
+  }
+  #endif
 public:
   #if !SWIG_CGAL_NON_SUPPORTED_TARGET_LANGUAGE
   typedef typename Weighting_helper_3<Weighted_tag>::Point_range Point_range;
@@ -85,16 +175,16 @@ public:
   void share_ownership(Memory_holder mh){own_triangulation=false; mem_holder=mh;}
   //constructor used by inheriting classes  
   template <class PointIterator>
-  Triangulation_3_wrapper(PointIterator first,PointIterator end):data_ptr(new cpp_base())
+  Triangulation_3_wrapper(PointIterator first,PointIterator end):data_ptr(new cpp_base()),own_triangulation(true)
   {
-    data_ptr->insert(first,end);
+    SWIG_Triangulation_3::insert_range(*data_ptr,first,end);
   }
   #endif
   Triangulation_3_wrapper():data_ptr(new cpp_base()),own_triangulation(true){}
   ~Triangulation_3_wrapper(){if (own_triangulation) delete data_ptr;}
-  Triangulation_3_wrapper(Point_range range):data_ptr(new cpp_base())
+  Triangulation_3_wrapper(Point_range range):data_ptr(new cpp_base()),own_triangulation(true)
   {
-    data_ptr->insert(SWIG_CGAL::get_begin(range),SWIG_CGAL::get_end(range));
+    SWIG_Triangulation_3::insert_range(*data_ptr,SWIG_CGAL::get_begin(range),SWIG_CGAL::get_end(range));
   }
   Triangulation_3_wrapper(const Triangulation_3_wrapper& self) = default;
   
@@ -126,7 +216,7 @@ public:
   typedef Generic_output_iterator< SWIG_CGAL::Triple<Cell_handle,int,int> >      Edge_output_iterator;  
   #endif
 //Modifiers
-  SWIG_CGAL_FORWARD_CALL_0(void,clear)  
+  SWIG_CGAL_FORWARD_MODIFYING_CALL_0(void,clear)  
 //Access Functions
 //Non const access
   SWIG_CGAL_FORWARD_CALL_0(int, dimension)
@@ -169,6 +259,41 @@ public:
   Cell_handle locate (const Point& query, Reference_wrapper<SWIG_Triangulation_3::Locate_type> & lt, Reference_wrapper<int>& li, Reference_wrapper<int>& lj,const Vertex_handle& hint){
     return get_data().locate(query.get_data(),(typename cpp_base::Locate_type&) lt.object(),convert(li),convert(lj),hint.get_data());
   }
+  //same as the functions above, the location being returned by value
+  Location<Cell_handle,SWIG_Triangulation_3::Locate_type> locate_with_type (const Point& query) const {
+    return internal_locate_with_type(query,typename cpp_base::Cell_handle());
+  }
+  Location<Cell_handle,SWIG_Triangulation_3::Locate_type> locate_with_type (const Point& query,const Cell_handle& cell) const {
+    return internal_locate_with_type(query,cell.get_data());
+  }
+  Location<Cell_handle,SWIG_Triangulation_3::Locate_type> locate_with_type (const Point& query,const Vertex_handle& hint) const {
+    return internal_locate_with_type(query,hint.get_data());
+  }
+  //location of the rows (x,y,z) of an array, the indices being those of to_arrays()
+  Location_batch locate_batch(SWIG_CGAL::Buffer<double> queries) const {
+    typedef typename Point::cpp_base                                    Cpp_point;
+    typedef typename Triangulation::Cell_handle                         Cpp_cell_handle;
+    typedef SWIG_CGAL::Array_point_map<EPIC_Kernel::Point_3,3>          Point_map;
+    const std::size_t n = SWIG_CGAL::number_of_rows(queries,3);
+    const double* data = queries.data();
+    const Triangulation& t = get_data();
+    std::unordered_map<Cpp_cell_handle,int,CGAL::Handle_hash_function> cell_index;
+    cell_index.reserve(t.number_of_finite_cells());
+    int nc = 0;
+    for (typename Triangulation::Finite_cells_iterator c = t.finite_cells_begin(); c != t.finite_cells_end(); ++c)
+      cell_index[c] = nc++;
+    return SWIG_CGAL::locate_in_spatial_order<SWIG_Triangulation_3::internal::Locate_concurrency_tag,Cpp_cell_handle>(n,
+      CGAL::Spatial_sort_traits_adapter_3<EPIC_Kernel,Point_map>(Point_map(data,3)),
+      [&t,&cell_index,data](std::size_t i, Cpp_cell_handle hint, int& index, signed char& type){
+        typename Triangulation::Locate_type lt;
+        int li, lj;
+        Cpp_cell_handle c = t.locate(SWIG_Triangulation_3::internal::make_query_point<Cpp_point>(data+3*i,Weighted_tag()),lt,li,lj,hint);
+        typename std::unordered_map<Cpp_cell_handle,int,CGAL::Handle_hash_function>::const_iterator it = cell_index.find(c);
+        index = it == cell_index.end() ? -1 : it->second;
+        type = static_cast<signed char>(lt);
+        return c;
+      });
+  }
   Bounded_side side_of_cell (const Point& p,const Cell_handle& c,Reference_wrapper<SWIG_Triangulation_3::Locate_type> & lt, Reference_wrapper<int>& li, Reference_wrapper<int>& lj){
     return CGAL::enum_cast<Bounded_side>( get_data().side_of_cell(p.get_data(),c.get_data(),(typename cpp_base::Locate_type&) lt.object(),convert(li),convert(lj)) );
   }
@@ -182,26 +307,80 @@ public:
     return CGAL::enum_cast<Bounded_side>( get_data().side_of_edge(p.get_data(),c.get_data(),(typename cpp_base::Locate_type&) lt.object(),convert(li)) );    
   }
 //Flips
-  SWIG_CGAL_FORWARD_CALL_1(bool,flip,Edge)
-  SWIG_CGAL_FORWARD_CALL_3(bool,flip,Cell_handle,int,int)
-  SWIG_CGAL_FORWARD_CALL_1(void,flip_flippable,Edge)
-  SWIG_CGAL_FORWARD_CALL_3(void,flip_flippable,Cell_handle,int,int)
-  SWIG_CGAL_FORWARD_CALL_1(bool,flip,Facet)
-  SWIG_CGAL_FORWARD_CALL_2(bool,flip,Cell_handle,int)
-  SWIG_CGAL_FORWARD_CALL_1(void,flip_flippable,Facet)
-  SWIG_CGAL_FORWARD_CALL_2(void,flip_flippable,Cell_handle,int)
+  SWIG_CGAL_FORWARD_MODIFYING_CALL_1(bool,flip,Edge)
+  SWIG_CGAL_FORWARD_MODIFYING_CALL_3(bool,flip,Cell_handle,int,int)
+  SWIG_CGAL_FORWARD_MODIFYING_CALL_1(void,flip_flippable,Edge)
+  SWIG_CGAL_FORWARD_MODIFYING_CALL_3(void,flip_flippable,Cell_handle,int,int)
+  SWIG_CGAL_FORWARD_MODIFYING_CALL_1(bool,flip,Facet)
+  SWIG_CGAL_FORWARD_MODIFYING_CALL_2(bool,flip,Cell_handle,int)
+  SWIG_CGAL_FORWARD_MODIFYING_CALL_1(void,flip_flippable,Facet)
+  SWIG_CGAL_FORWARD_MODIFYING_CALL_2(void,flip_flippable,Cell_handle,int)
 //Insertions
-  SWIG_CGAL_FORWARD_CALL_1(Vertex_handle,insert,Point)
-  SWIG_CGAL_FORWARD_CALL_AND_REF_2(Vertex_handle,insert,Point,Cell_handle)
-  SWIG_CGAL_FORWARD_CALL_AND_REF_2(Vertex_handle,insert,Point,Vertex_handle)
-  int insert(Point_range range){ return get_data().insert(SWIG_CGAL::get_begin(range),SWIG_CGAL::get_end(range)); }
-  SWIG_CGAL_FORWARD_CALL_AND_REF_2(Vertex_handle,insert_in_cell,Point,Cell_handle)
-  SWIG_CGAL_FORWARD_CALL_AND_REF_2(Vertex_handle,insert_in_facet,Point,Facet)
-  SWIG_CGAL_FORWARD_CALL_AND_REF_3(Vertex_handle,insert_in_facet,Point,Cell_handle,int)
-  SWIG_CGAL_FORWARD_CALL_AND_REF_2(Vertex_handle,insert_in_edge,Point,Edge)
-  SWIG_CGAL_FORWARD_CALL_AND_REF_4(Vertex_handle,insert_in_edge,Point,Cell_handle,int,int)
-  SWIG_CGAL_FORWARD_CALL_AND_REF_2(Vertex_handle,insert_outside_convex_hull,Point,Cell_handle)
-  SWIG_CGAL_FORWARD_CALL_AND_REF_1(Vertex_handle,insert_outside_affine_hull,Point)
+  SWIG_CGAL_FORWARD_MODIFYING_CALL_1(Vertex_handle,insert,Point)
+  SWIG_CGAL_FORWARD_MODIFYING_CALL_AND_REF_2(Vertex_handle,insert,Point,Cell_handle)
+  SWIG_CGAL_FORWARD_MODIFYING_CALL_AND_REF_2(Vertex_handle,insert,Point,Vertex_handle)
+  int insert(Point_range range){ check_not_frozen("insert"); return static_cast<int>(SWIG_Triangulation_3::insert_range(get_data(),SWIG_CGAL::get_begin(range),SWIG_CGAL::get_end(range))); }
+  //insertion of the rows (x,y,z), or (x,y,z,weight) for weighted points, of an array
+  //in spatial order; `vertices` gets the vertex of each row in the order of the rows.
+  //Without `vertices`, triangulations with CGAL::Parallel_tag insert the rows concurrently
+  int insert_from_array(SWIG_CGAL::Buffer<double> coords){ check_not_frozen("insert_from_array"); return static_cast<int>(insert_array_rows(coords,nullptr,typename Triangulation::Concurrency_tag())); }
+  int insert_from_array(SWIG_CGAL::Buffer<double> coords, Vertex_handle_output_iterator vertices){
+    check_not_frozen("insert_from_array");
+    std::vector<typename Triangulation::Vertex_handle> row_vertices;
+    int n=static_cast<int>(insert_array_rows(coords,&row_vertices));
+    std::copy(row_vertices.begin(),row_vertices.end(),vertices);
+    return n;
+  }
+  SWIG_CGAL_FORWARD_MODIFYING_CALL_AND_REF_2(Vertex_handle,insert_in_cell,Point,Cell_handle)
+  SWIG_CGAL_FORWARD_MODIFYING_CALL_AND_REF_2(Vertex_handle,insert_in_facet,Point,Facet)
+  SWIG_CGAL_FORWARD_MODIFYING_CALL_AND_REF_3(Vertex_handle,insert_in_facet,Point,Cell_handle,int)
+  SWIG_CGAL_FORWARD_MODIFYING_CALL_AND_REF_2(Vertex_handle,insert_in_edge,Point,Edge)
+  SWIG_CGAL_FORWARD_MODIFYING_CALL_AND_REF_4(Vertex_handle,insert_in_edge,Point,Cell_handle,int,int)
+  SWIG_CGAL_FORWARD_MODIFYING_CALL_AND_REF_2(Vertex_handle,insert_outside_convex_hull,Point,Cell_handle)
+  SWIG_CGAL_FORWARD_MODIFYING_CALL_AND_REF_1(Vertex_handle,insert_outside_affine_hull,Point)
+  #ifndef SWIG
+  std::size_t insert_array_rows(const SWIG_CGAL::Buffer<double>& coords, std::vector<typename Triangulation::Vertex_handle>* vertices)
+  {
+    typedef typename Point::cpp_base                                    Cpp_point;
+    typedef SWIG_CGAL::Array_point_map<EPIC_Kernel::Point_3,3>          Point_map;
+    const std::size_t row_size = Weighted_tag::value ? 4 : 3;
+    const double* data = coords.data();
+    Triangulation& t = get_data();
+    return SWIG_CGAL::insert_in_spatial_order(t, SWIG_CGAL::number_of_rows(coords,row_size),
+      CGAL::Spatial_sort_traits_adapter_3<EPIC_Kernel,Point_map>(Point_map(data,row_size)),
+      [data,row_size](std::size_t i){ return SWIG_Triangulation_3::internal::make_point<Cpp_point>(data+row_size*i,Weighted_tag()); },
+      [&t](const Cpp_point& p, typename Triangulation::Vertex_handle previous){
+        return t.insert(p, previous==typename Triangulation::Vertex_handle() ? typename Triangulation::Cell_handle() : previous->cell());
+      },
+      vertices);
+  }
+  std::size_t insert_array_rows(const SWIG_CGAL::Buffer<double>& coords, std::vector<typename Triangulation::Vertex_handle>* vertices, CGAL::Sequential_tag)
+  {
+    return insert_array_rows(coords,vertices);
+  }
+  #ifdef CGAL_LINKED_WITH_TBB
+  std::size_t insert_array_rows(const SWIG_CGAL::Buffer<double>& coords, std::vector<typename Triangulation::Vertex_handle>* vertices, CGAL::Parallel_tag)
+  {
+    if (vertices!=nullptr) return insert_array_rows(coords,vertices);
+    const std::size_t row_size = Weighted_tag::value ? 4 : 3;
+    const std::size_t n = SWIG_CGAL::number_of_rows(coords,row_size);
+    const double* data = coords.data();
+    std::vector<typename Triangulation::Point> points;
+    points.reserve(n);
+    for (std::size_t i=0;i<n;++i)
+      points.push_back(SWIG_Triangulation_3::internal::make_point<typename Triangulation::Point>(data+row_size*i,Weighted_tag()));
+    return SWIG_Triangulation_3::internal::insert_points(get_data(),points);
+  }
+  #endif
+  #endif
+//Export of the finite vertices and cells as arrays of points and of indices
+  Triangulation_3_arrays to_arrays(bool with_neighbors=false) const { return Triangulation_3_arrays(get_data(),with_neighbors); }
+  //same values as to_arrays() without neighbors, written in `points` and `cells`, e.g. direct java.nio buffers
+  void write_arrays(SWIG_CGAL::Buffer<double> points, SWIG_CGAL::Buffer<int> cells) const {
+    SWIG_CGAL::check_output_buffer(points,3*std::size_t(get_data().number_of_vertices()),"points");
+    SWIG_CGAL::check_output_buffer(cells,4*std::size_t(get_data().number_of_finite_cells()),"cells");
+    write_triangulation_3_arrays(get_data(),points.data(),cells.data());
+  }
 //Traversal of the Triangulation
   Finite_vertices_iterator      finite_vertices(){return Finite_vertices_iterator(get_data().finite_vertices_begin(),get_data().finite_vertices_end());}
   Finite_edges_iterator         finite_edges(){return Finite_edges_iterator(get_data().finite_edges_begin(),get_data().finite_edges_end());}
@@ -224,15 +403,16 @@ public:
   SWIG_CGAL_FORWARD_CALL_AND_REF_4(Facet_circulator,incident_facets,Cell_handle,int,int,Facet)
   SWIG_CGAL_FORWARD_CALL_5(Facet_circulator,incident_facets,Cell_handle,int,int,Cell_handle,int)  
 //Traversal of the incident cells, facets and edges, and the adjacent vertices of a given vertex
-  void incident_cells(const Vertex_handle& v, Cell_handle_output_iterator out){get_data().incident_cells(v.get_data(),out);}
-  void finite_incident_cells(const Vertex_handle& v, Cell_handle_output_iterator out){get_data().finite_incident_cells(v.get_data(),out);}
-  void incident_facets(const Vertex_handle& v, Facet_output_iterator out){    get_data().incident_facets(v.get_data(),out);  }
-  void finite_incident_facets(const Vertex_handle& v, Facet_output_iterator out){get_data().finite_incident_facets(v.get_data(),out);}
-  void incident_edges(const Vertex_handle& v, Edge_output_iterator out){get_data().incident_edges(v.get_data(),out);}
-  void finite_incident_edges(const Vertex_handle& v, Edge_output_iterator out){get_data().finite_incident_edges(v.get_data(),out);}
-  void adjacent_vertices(const Vertex_handle& v, Vertex_handle_output_iterator out){get_data().adjacent_vertices(v.get_data(),out);}
-  void finite_adjacent_vertices(const Vertex_handle& v, Vertex_handle_output_iterator out){get_data().finite_adjacent_vertices(v.get_data(),out);}
-  SWIG_CGAL_FORWARD_CALL_1(int,degree,Vertex_handle)  
+  //(serialized, as they mark the cells visited)
+  void incident_cells(const Vertex_handle& v, Cell_handle_output_iterator out){std::lock_guard<std::mutex> lock(freeze_state.mutex()); get_data().incident_cells(v.get_data(),out);}
+  void finite_incident_cells(const Vertex_handle& v, Cell_handle_output_iterator out){std::lock_guard<std::mutex> lock(freeze_state.mutex()); get_data().finite_incident_cells(v.get_data(),out);}
+  void incident_facets(const Vertex_handle& v, Facet_output_iterator out){std::lock_guard<std::mutex> lock(freeze_state.mutex()); get_data().incident_facets(v.get_data(),out);}
+  void finite_incident_facets(const Vertex_handle& v, Facet_output_iterator out){std::lock_guard<std::mutex> lock(freeze_state.mutex()); get_data().finite_incident_facets(v.get_data(),out);}
+  void incident_edges(const Vertex_handle& v, Edge_output_iterator out){std::lock_guard<std::mutex> lock(freeze_state.mutex()); get_data().incident_edges(v.get_data(),out);}
+  void finite_incident_edges(const Vertex_handle& v, Edge_output_iterator out){std::lock_guard<std::mutex> lock(freeze_state.mutex()); get_data().finite_incident_edges(v.get_data(),out);}
+  void adjacent_vertices(const Vertex_handle& v, Vertex_handle_output_iterator out){std::lock_guard<std::mutex> lock(freeze_state.mutex()); get_data().adjacent_vertices(v.get_data(),out);}
+  void finite_adjacent_vertices(const Vertex_handle& v, Vertex_handle_output_iterator out){std::lock_guard<std::mutex> lock(freeze_state.mutex()); get_data().finite_adjacent_vertices(v.get_data(),out);}
+  int degree(const Vertex_handle& v){std::lock_guard<std::mutex> lock(freeze_state.mutex()); return static_cast<int>(get_data().degree(v.get_data()));}  
 //Traversal between adjacent cells
   SWIG_CGAL_FORWARD_CALL_2(int,mirror_index,Cell_handle,int)
   SWIG_CGAL_FORWARD_CALL_AND_REF_2(Vertex_handle,mirror_vertex,Cell_handle,int)  
@@ -263,6 +443,7 @@ public:
     else out << std::setprecision(prec) << get_data();
   }
   void read_from_file(const char* fname){
+    check_not_frozen("read_from_file");
     std::ifstream in(fname);
     if (!in) std::cerr << "Error cannot open file: " << fname << std::endl;
     else{
@@ -274,6 +455,50 @@ public:
     }
   }
   #endif
+  //combinatorics as raw index arrays and double coordinates, see Binary_io.h
+  void write_binary(const char* fname) const {
+    std::ofstream out(fname, std::ios::binary);
+    if (!out) throw std::runtime_error(std::string("Cannot create file ") + fname);
+    SWIG_Triangulation_3::write_binary(out,get_data());
+  }
+  void read_binary(const char* fname){
+    check_not_frozen("read_binary");
+    std::ifstream in(fname, std::ios::binary);
+    if (!in) throw std::runtime_error(std::string("Cannot open file ") + fname);
+    read_binary(in);
+  }
+//Binary state, in the format of write_binary()
+  #ifndef SWIG
+  void write_state(std::ostream& os) {SWIG_Triangulation_3::write_binary(os,get_data());}
+  void read_state(const char* data, std::size_t size,
+                  const std::shared_ptr<boost::interprocess::mapped_region>&)
+  {
+    check_not_frozen("load_state");
+    SWIG_CGAL::Memory_istream in(data, size);
+    read_binary(in);
+  }
+  #endif
+  SWIG_CGAL_BINARY_STATE_FUNCTIONS
+protected:
+  #ifndef SWIG
+  void read_binary(std::istream& in){
+    Triangulation* t=new Triangulation();
+    try{
+      SWIG_Triangulation_3::read_binary(in,*t);
+    }
+    catch(...){
+      delete t;
+      throw;
+    }
+    if (own_triangulation) delete data_ptr;
+    else{
+      own_triangulation=true;
+      reset(mem_holder);
+    }
+    data_ptr=t;
+  }
+  #endif
+public:
 //Queries
   bool is_cell (Vertex_handle u,Vertex_handle v,Vertex_handle w,Vertex_handle x,Cell_handle & c,Reference_wrapper<int>& i,Reference_wrapper<int> & j,Reference_wrapper<int> & k,Reference_wrapper<int> & l){
     return get_data().is_cell(convert(u),convert(v),convert(w),convert(x),convert(c),convert(i),convert(j),convert(k),convert(l));
@@ -284,6 +509,7 @@ public:
 //Deep copy
   Self deepcopy() const {return Self(get_data());}
   void deepcopy(const Self& other){
+    check_not_frozen("deepcopy");
     if (!own_triangulation){
       data_ptr=new Triangulation();
       reset(mem_holder);
@@ -310,6 +536,30 @@ public:
     return *this;
   }
   #endif
+//Memory
+  //the vertices and cells of the data structure, free slots included
+  SWIG_CGAL::Memory_usage memory_usage() const
+  {
+    return SWIG_CGAL::Memory_usage(SWIG_CGAL::internal::compact_container_bytes(get_data().tds().vertices())
+                                   + SWIG_CGAL::internal::compact_container_bytes(get_data().tds().cells()));
+  }
+  //replaces the triangulation by a copy, which has no free slots: the handles
+  //to its vertices and cells become invalid. The triangulation of a complex
+  //(see C3T3::triangulation()) is shrunk by the complex.
+  void shrink_to_fit()
+  {
+    check_not_frozen("shrink_to_fit");
+    if (!own_triangulation)
+      throw std::runtime_error("The triangulation belongs to another object, shrink it instead");
+    Triangulation t(get_data());
+    get_data().swap(t);
+  }
+//Concurrent queries
+  //the triangulation can then be queried from several threads at the same time,
+  //and the functions modifying it throw (it is not frozen for the other wrappers
+  //of the same triangulation, e.g. those returned by C3T3::triangulation())
+  void freeze(){ freeze_state.freeze([](){}); }
+  bool is_frozen() const { return freeze_state.is_frozen(); }
 //Special for SWIG
   bool same_internal_object(const Self& other) {return other.data_ptr==data_ptr;}
 };
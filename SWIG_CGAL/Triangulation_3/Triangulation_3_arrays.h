@@ -0,0 +1,123 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+
+#ifndef SWIG_CGAL_TRIANGULATION_3_TRIANGULATION_3_ARRAYS_H
+#define SWIG_CGAL_TRIANGULATION_3_TRIANGULATION_3_ARRAYS_H
+
+#include <SWIG_CGAL/Common/Buffer.h>
+
+#include <CGAL/Unique_hash_map.h>
+
+#include <memory>
+#include <vector>
+
+// Result of Triangulation_3_wrapper::to_arrays(): row i of point_array() is
+// the point of the i-th finite vertex, row j of cell_array() the indices of the
+// vertices of the j-th finite cell, and row j of neighbor_array() (if computed)
+// the indices of its neighbors, -1 being an infinite cell. Neighbor k is
+// opposite to vertex k, as in the triangulation.
+class Triangulation_3_arrays
+{
+  std::shared_ptr<std::vector<double> > points_sptr;
+  std::shared_ptr<std::vector<int> >    cells_sptr;
+  std::shared_ptr<std::vector<int> >    neighbors_sptr;
+
+public:
+  Triangulation_3_arrays()
+    : points_sptr(new std::vector<double>())
+    , cells_sptr(new std::vector<int>())
+    , neighbors_sptr(new std::vector<int>()) {}
+
+  #ifndef SWIG
+  template <class Triangulation>
+  Triangulation_3_arrays(const Triangulation& t, bool with_neighbors)
+    : Triangulation_3_arrays()
+  {
+    typedef typename Triangulation::Vertex_handle Vertex_handle;
+    typedef typename Triangulation::Cell_handle   Cell_handle;
+
+    CGAL::Unique_hash_map<Vertex_handle, int> vertex_index(-1, t.number_of_vertices());
+    points_sptr->reserve(3 * t.number_of_vertices());
+    int nv = 0;
+    for (typename Triangulation::Finite_vertices_iterator v = t.finite_vertices_begin();
+         v != t.finite_vertices_end(); ++v)
+    {
+      vertex_index[v] = nv++;
+      points_sptr->push_back(v->point().x());
+      points_sptr->push_back(v->point().y());
+      points_sptr->push_back(v->point().z());
+    }
+
+    CGAL::Unique_hash_map<Cell_handle, int> cell_index(-1, with_neighbors ? t.number_of_cells() : 1);
+    int nc = 0;
+    for (typename Triangulation::Finite_cells_iterator c = t.finite_cells_begin();
+         c != t.finite_cells_end(); ++c)
+    {
+      if (with_neighbors)
+        cell_index[c] = nc++;
+      for (int i = 0; i < 4; ++i)
+        cells_sptr->push_back(vertex_index[c->vertex(i)]);
+    }
+
+    if (!with_neighbors) return;
+    neighbors_sptr->reserve(cells_sptr->size());
+    for (typename Triangulation::Finite_cells_iterator c = t.finite_cells_begin();
+         c != t.finite_cells_end(); ++c)
+      for (int i = 0; i < 4; ++i)
+        neighbors_sptr->push_back(cell_index[c->neighbor(i)]);
+  }
+  #endif
+
+  int number_of_points() const { return int(points_sptr->size() / 3); }
+  int number_of_cells() const { return int(cells_sptr->size() / 4); }
+
+  // (number_of_points(), 3)
+  SWIG_CGAL::Buffer<double> point_array() const
+  {
+    return SWIG_CGAL::Buffer<double>(points_sptr->data(), points_sptr->size() / 3, 3,
+                                     points_sptr, true);
+  }
+  // (number_of_cells(), 4)
+  SWIG_CGAL::Buffer<int> cell_array() const
+  {
+    return SWIG_CGAL::Buffer<int>(cells_sptr->data(), cells_sptr->size() / 4, 4,
+                                  cells_sptr, true);
+  }
+  // (number_of_cells(), 4), or empty if the neighbors were not computed
+  SWIG_CGAL::Buffer<int> neighbor_array() const
+  {
+    return SWIG_CGAL::Buffer<int>(neighbors_sptr->data(), neighbors_sptr->size() / 4, 4,
+                                  neighbors_sptr, true);
+  }
+};
+
+#ifndef SWIG
+// Writes the rows of point_array() and cell_array() of
+// Triangulation_3_arrays(t,false) in place, in arrays holding at least
+// 3*t.number_of_vertices() and 4*t.number_of_finite_cells() values
+template <class Triangulation>
+void write_triangulation_3_arrays(const Triangulation& t, double* points, int* cells)
+{
+  typedef typename Triangulation::Vertex_handle Vertex_handle;
+
+  CGAL::Unique_hash_map<Vertex_handle, int> vertex_index(-1, t.number_of_vertices());
+  int nv = 0;
+  for (typename Triangulation::Finite_vertices_iterator v = t.finite_vertices_begin();
+       v != t.finite_vertices_end(); ++v, ++nv)
+  {
+    vertex_index[v] = nv;
+    points[3 * nv]     = v->point().x();
+    points[3 * nv + 1] = v->point().y();
+    points[3 * nv + 2] = v->point().z();
+  }
+  for (typename Triangulation::Finite_cells_iterator c = t.finite_cells_begin();
+       c != t.finite_cells_end(); ++c, cells += 4)
+    for (int i = 0; i < 4; ++i)
+      cells[i] = vertex_index[c->vertex(i)];
+}
+#endif
+
+#endif //SWIG_CGAL_TRIANGULATION_3_TRIANGULATION_3_ARRAYS_H
@@ -19,6 +19,14 @@
   SWIG_CGAL_declare_triangulation_3_internal(Internal_Triangulation_3_##EXPOSEDNAME,CLASSNAME_PREFIX,CPPTYPE,Point_3,CGAL::Tag_false,MEMHOLDER)
   
   %typemap(javaimports)          Delaunay_triangulation_3_wrapper%{import CGAL.Kernel.Point_3; import CGAL.Kernel.Line_3; import CGAL.Kernel.Bounded_side; import java.util.Iterator; import java.util.Collection;%}  
+  //triangulation of the rows (x,y,z) of a direct java.nio buffer, read in place
+  %typemap(javacode) Delaunay_triangulation_3_wrapper %{
+  public static $javaclassname fromDirectBuffers(java.nio.DoubleBuffer points) {
+    $javaclassname t = new $javaclassname();
+    t.insert_from_array(points);
+    return t;
+  }
+  %}
   SWIG_CGAL_declare_identifier_of_template_class(EXPOSEDNAME,Delaunay_triangulation_3_wrapper<CPPTYPE,SWIG_Triangulation_3::CGAL_Vertex_handle<CPPTYPE,Point_3>,SWIG_Triangulation_3::CGAL_Cell_handle<CPPTYPE,Point_3>,MEMHOLDER >)
 %enddef
 
@@ -20,6 +20,14 @@
 
 
   %typemap(javaimports)          Regular_triangulation_3_wrapper%{import CGAL.Kernel.Point_3; import CGAL.Kernel.Weighted_point_3; import CGAL.Kernel.Bounded_side; import java.util.Iterator; import java.util.Collection;%}  
+  //triangulation of the rows (x,y,z,weight) of a direct java.nio buffer, read in place
+  %typemap(javacode) Regular_triangulation_3_wrapper %{
+  public static $javaclassname fromDirectBuffers(java.nio.DoubleBuffer points) {
+    $javaclassname t = new $javaclassname();
+    t.insert_from_array(points);
+    return t;
+  }
+  %}
   SWIG_CGAL_declare_identifier_of_template_class(EXPOSEDNAME,Regular_triangulation_3_wrapper<CPPTYPE,SWIG_Triangulation_3::CGAL_Vertex_handle<CPPTYPE,Weighted_point_3>,SWIG_Triangulation_3::CGAL_Cell_handle<CPPTYPE,Weighted_point_3>,MEMHOLDER >)
 %enddef
 
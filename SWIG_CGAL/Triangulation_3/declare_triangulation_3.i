@@ -24,6 +24,8 @@
   %include "std_pair.i"
   SWIG_CGAL_declare_identifier_of_template_class(CLASSNAME_PREFIX##_Facet,std::pair<SWIG_Triangulation_3::CGAL_Cell_handle<CPPTYPE,POINT_TYPE>,int>)
   SWIG_CGAL_declare_identifier_of_template_class(CLASSNAME_PREFIX##_Edge,SWIG_CGAL::Triple<SWIG_Triangulation_3::CGAL_Cell_handle<CPPTYPE,POINT_TYPE>,int,int>)
+  //result of locate_with_type()
+  SWIG_CGAL_declare_identifier_of_template_class(CLASSNAME_PREFIX##_Location,Location<SWIG_Triangulation_3::CGAL_Cell_handle<CPPTYPE,POINT_TYPE>,SWIG_Triangulation_3::Locate_type>)
 
   //typemaps for Output iterators
   #if !SWIG_CGAL_NON_SUPPORTED_TARGET_LANGUAGE
@@ -53,7 +55,19 @@
   SWIG_CGAL_declare_generic_output_iterator(CLASSNAME_PREFIX##_Edge_output_iterator,CLASSNAME_PREFIX##_Edge_output_iterator_nested_iterator,CLASSNAME_PREFIX##_iEdge)
   #endif
   //Triangulation
-  %typemap(javaimports)  Triangulation_3_wrapper%{import CGAL.Kernel.Point_3; import CGAL.Kernel.POINT_TYPE;import CGAL.Kernel.Segment_3; import CGAL.Kernel.Triangle_3; import CGAL.Kernel.Tetrahedron_3; import CGAL.Kernel.Ref_int; import CGAL.Kernel.Bounded_side; import java.util.Iterator; import java.util.Collection;%}
+  %typemap(javaimports)  Triangulation_3_wrapper%{import CGAL.Kernel.Point_3; import CGAL.Kernel.POINT_TYPE; import CGAL.Kernel.Memory_usage;import CGAL.Kernel.Segment_3; import CGAL.Kernel.Triangle_3; import CGAL.Kernel.Tetrahedron_3; import CGAL.Kernel.Ref_int; import CGAL.Kernel.Bounded_side; import java.util.Iterator; import java.util.Collection;%}
+  //direct java.nio buffers, see CGAL.Java.Direct_buffers: the buffers of the
+  //arrays of to_arrays() are mapped on them, the others are written in place
+  %typemap(javacode) Triangulation_3_wrapper %{
+  public void toDirectBuffers(java.nio.DoubleBuffer points, java.nio.IntBuffer cells) {
+    write_arrays(points, cells);
+  }
+
+  public CGAL.Java.Direct_buffers toDirectBuffers() {
+    Triangulation_3_arrays arrays = to_arrays(false);
+    return new CGAL.Java.Direct_buffers(arrays.point_array(), arrays.cell_array(), null, arrays);
+  }
+  %}
   SWIG_CGAL_declare_identifier_of_template_class(EXPOSEDNAME,Triangulation_3_wrapper<CPPTYPE,POINT_TYPE,SWIG_Triangulation_3::CGAL_Vertex_handle<CPPTYPE,POINT_TYPE>,SWIG_Triangulation_3::CGAL_Cell_handle<CPPTYPE,POINT_TYPE>,WTAG,MEMHOLDER >)
 
 
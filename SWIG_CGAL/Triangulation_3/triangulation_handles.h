@@ -8,6 +8,7 @@
 #define SWIG_CGAL_TRIANGULATION_3_TRIANGULATION_HANDLES_H
 
 #include <SWIG_CGAL/Common/Macros.h>
+#include <SWIG_CGAL/Kernel/Pooled_allocation.h>
 #include <SWIG_CGAL/Common/Reference_wrapper.h>
 
 namespace SWIG_Triangulation_3{
@@ -23,6 +24,7 @@ public:
   typedef typename Triangulation::Vertex_handle cpp_base;
   const cpp_base& get_data() const {return data;}
         cpp_base& get_data()       {return data;}
+  SWIG_CGAL_POOLED_ALLOCATION
   CGAL_Vertex_handle(cpp_base v):data(v){}
   #endif
   typedef CGAL_Cell_handle<Triangulation,Point> Cell_handle;
@@ -57,6 +59,7 @@ public:
   CGAL_Cell_handle(cpp_base v):data(v){}
   const cpp_base& get_data() const {return data;}
         cpp_base& get_data()       {return data;}
+  SWIG_CGAL_POOLED_ALLOCATION
   #endif
   
   typedef CGAL_Vertex_handle<Triangulation,Point> Vertex_handle;
@@ -9,13 +9,46 @@
 #include <SWIG_CGAL/Kernel/typedefs.h>
 #include <CGAL/Triangulation_3.h>
 #include <CGAL/Regular_triangulation_3.h>
+#include <CGAL/Regular_triangulation_cell_base_3.h>
+#include <CGAL/Regular_triangulation_vertex_base_3.h>
 
 #include <CGAL/Delaunay_triangulation_3.h>
+#include <CGAL/Delaunay_triangulation_cell_base_3.h>
+#include <CGAL/Triangulation_data_structure_3.h>
+#include <CGAL/Triangulation_vertex_base_3.h>
+#include <CGAL/Triangulation_hierarchy_3.h>
 
+//The default vertex and cell bases are used on purpose: a cell only stores its
+//4 vertex and 4 neighbor handles, and a vertex its point and one incident cell.
+//Do not add info fields here, they would be paid for by all the cells.
 typedef CGAL::Triangulation_3<EPIC_Kernel>                              CGAL_T3;
 typedef CGAL::Delaunay_triangulation_3<EPIC_Kernel>                     CGAL_DT3;
 
+//Delaunay triangulation with a hierarchy of triangulations of samples of the
+//points, for random order insertions and locate() calls without a good hint.
+//Only the bottom level is stored by write_binary(): read_binary() rebuilds
+//the upper levels by inserting the points read (see Binary_io.h).
+typedef CGAL::Delaunay_triangulation_3<EPIC_Kernel, CGAL::Default,
+                                       CGAL::Fast_location>            CGAL_FDT3;
+
+//Delaunay and regular triangulations whose range insertions are concurrent (sequential without TBB)
+#ifdef CGAL_LINKED_WITH_TBB
+typedef CGAL::Parallel_tag                                              PDT3_Concurrency_tag;
+#else
+typedef CGAL::Sequential_tag                                            PDT3_Concurrency_tag;
+#endif
+typedef CGAL::Triangulation_data_structure_3<
+  CGAL::Triangulation_vertex_base_3<EPIC_Kernel>,
+  CGAL::Delaunay_triangulation_cell_base_3<EPIC_Kernel>,
+  PDT3_Concurrency_tag>                                                 PDT3_Tds;
+typedef CGAL::Delaunay_triangulation_3<EPIC_Kernel, PDT3_Tds>           CGAL_PDT3;
+
 typedef EPIC_Kernel                                                     RT_traits;
 typedef CGAL::Regular_triangulation_3< RT_traits >                      CGAL_RT3;
+typedef CGAL::Triangulation_data_structure_3<
+  CGAL::Regular_triangulation_vertex_base_3<RT_traits>,
+  CGAL::Regular_triangulation_cell_base_3<RT_traits>,
+  PDT3_Concurrency_tag>                                                 PRT3_Tds;
+typedef CGAL::Regular_triangulation_3<RT_traits, PRT3_Tds>              CGAL_PRT3;
 
 #endif //SWIG_CGAL_TRIANGULATION_3_TYPEDEFS_H
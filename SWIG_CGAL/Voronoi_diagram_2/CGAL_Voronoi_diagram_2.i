@@ -50,6 +50,15 @@ SWIG_CGAL_package_common()
   import CGAL.Java.JavaData;
 %}
 
+//typemaps for the export of the cells to arrays
+%include "SWIG_CGAL/typemaps.i"
+SWIG_CGAL_buffer_of_double_typemap_in
+SWIG_CGAL_buffer_of_double_typemap_out
+SWIG_CGAL_buffer_of_int_typemap_out
+
+SWIG_CGAL_release_gil(Voronoi_diagram_2_wrapper::cells_as_polygons)
+SWIG_CGAL_release_gil(Voronoi_diagram_2_wrapper::locate_sites_batch)
+%include "SWIG_CGAL/Voronoi_diagram_2/Voronoi_diagram_2_arrays.h"
 %include "SWIG_CGAL/Voronoi_diagram_2/Voronoi_diagram_2.h"
 %include "SWIG_CGAL/Voronoi_diagram_2/Voronoi_diagram_handles_2.h"
 %include "SWIG_CGAL/Voronoi_diagram_2/Locate_result.h"
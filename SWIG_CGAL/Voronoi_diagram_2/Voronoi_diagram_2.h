@@ -11,8 +11,10 @@
 #include <SWIG_CGAL/Common/Iterator.h>
 #include <SWIG_CGAL/Common/Wrapper_iterator_helper.h>
 #include <SWIG_CGAL/Kernel/Point_2.h>
+#include <SWIG_CGAL/Kernel/Iso_rectangle_2.h>
 #include <SWIG_CGAL/Voronoi_diagram_2/Voronoi_diagram_handles_2.h>
 #include <SWIG_CGAL/Voronoi_diagram_2/Locate_result.h>
+#include <SWIG_CGAL/Voronoi_diagram_2/Voronoi_diagram_2_arrays.h>
 #include <fstream>
 
 
@@ -112,6 +114,22 @@ public:
 //Queries
   typedef Locate_result_wrapper<Vertex_wrapper, Halfedge_wrapper, Face_wrapper> Locate_result;
   SWIG_CGAL_FORWARD_CALL_AND_REF_1(Locate_result,locate, Point_2);
+  //index of the site (in the order of the finite vertices of dual()) whose cell contains each
+  //row (x,y) of `queries`, -1 if the diagram is empty; the queries are walked to concurrently
+  //in spatial order on the graph of the sites when linked with TBB
+  SWIG_CGAL::Buffer<int> locate_sites_batch(SWIG_CGAL::Buffer<double> queries) const {
+    return SWIG_Voronoi_diagram_2::internal::nearest_sites(get_data().dual(), queries);
+  }
+//Export of the cells clipped to a box as arrays, one cell per finite vertex of dual()
+//in iteration order; the cells are computed concurrently when linked with TBB
+  Voronoi_cells cells_as_polygons(const Iso_rectangle_2& bbox) const {
+    return SWIG_Voronoi_diagram_2::internal::clipped_cells(get_data().dual(), bbox.get_data(), nullptr);
+  }
+  //site_array() gives the first row of `sites`, rows (x,y), or (x,y,weight) for power
+  //diagrams, with the coordinates of the site of each cell, e.g. the inserted array
+  Voronoi_cells cells_as_polygons(const Iso_rectangle_2& bbox, SWIG_CGAL::Buffer<double> sites) const {
+    return SWIG_Voronoi_diagram_2::internal::clipped_cells(get_data().dual(), bbox.get_data(), &sites);
+  }
 };
 
 #endif //SWIG_CGAL_VORONOI_DIAGRAM_2_VORONOI_DIAGRAM_2_H
@@ -0,0 +1,324 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2020 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+
+#ifndef SWIG_CGAL_VORONOI_DIAGRAM_2_VORONOI_DIAGRAM_2_ARRAYS_H
+#define SWIG_CGAL_VORONOI_DIAGRAM_2_VORONOI_DIAGRAM_2_ARRAYS_H
+
+#include <SWIG_CGAL/Common/Buffer.h>
+
+#include <memory>
+#include <vector>
+
+#ifndef SWIG
+#include <SWIG_CGAL/Kernel/typedefs.h>
+#include <SWIG_CGAL/Common/Spatial_insertion.h>
+#include <CGAL/Handle_hash_function.h>
+#include <CGAL/Spatial_sort_traits_adapter_2.h>
+#include <CGAL/for_each.h>
+#include <CGAL/spatial_sort.h>
+#include <CGAL/tags.h>
+#include <algorithm>
+#include <array>
+#include <stdexcept>
+#include <unordered_map>
+#endif
+
+// Result of Voronoi_diagram_2_wrapper::cells_as_polygons(): the vertices of
+// the cell c, clipped to the box, are the rows [offsets[c], offsets[c+1])
+// of vertex_array(), counterclockwise. site_array()[c] is the index of the
+// site of the cell c: the index of its vertex in the order of the finite
+// vertices of the dual triangulation, or the first row of the sites given
+// to cells_as_polygons() with these coordinates (-1 if none). The cells
+// that do not meet the box have no vertices.
+class Voronoi_cells
+{
+  std::shared_ptr<std::vector<double> > vertices_sptr;
+  std::shared_ptr<std::vector<int> > offsets_sptr;
+  std::shared_ptr<std::vector<int> > sites_sptr;
+
+public:
+  Voronoi_cells()
+    : vertices_sptr(new std::vector<double>())
+    , offsets_sptr(new std::vector<int>(1, 0))
+    , sites_sptr(new std::vector<int>()) {}
+
+  #ifndef SWIG
+  std::vector<double>& vertices() { return *vertices_sptr; }
+  std::vector<int>& offsets() { return *offsets_sptr; }
+  std::vector<int>& sites() { return *sites_sptr; }
+  #endif
+
+  int number_of_cells() const { return int(offsets_sptr->size()) - 1; }
+
+  // (number of vertices, 2)
+  SWIG_CGAL::Buffer<double> vertex_array() const
+  {
+    return SWIG_CGAL::Buffer<double>(vertices_sptr->data(), vertices_sptr->size() / 2, 2, vertices_sptr, true);
+  }
+  // (number_of_cells() + 1, 1)
+  SWIG_CGAL::Buffer<int> offset_array() const
+  {
+    return SWIG_CGAL::Buffer<int>(offsets_sptr->data(), offsets_sptr->size(), 1, offsets_sptr, true);
+  }
+  // (number_of_cells(), 1)
+  SWIG_CGAL::Buffer<int> site_array() const
+  {
+    return SWIG_CGAL::Buffer<int>(sites_sptr->data(), sites_sptr->size(), 1, sites_sptr, true);
+  }
+};
+
+#ifndef SWIG
+namespace SWIG_Voronoi_diagram_2 {
+
+#ifdef CGAL_LINKED_WITH_TBB
+typedef CGAL::Parallel_tag Concurrency_tag;
+#else
+typedef CGAL::Sequential_tag Concurrency_tag;
+#endif
+
+namespace internal {
+
+// coordinates and weight of the sites of Voronoi and power diagrams
+inline std::array<double, 3> site_coordinates (const EPIC_Kernel::Point_2& p)
+{
+  return {{ p.x(), p.y(), 0. }};
+}
+inline std::array<double, 3> site_coordinates (const EPIC_Kernel::Weighted_point_2& p)
+{
+  return {{ p.point().x(), p.point().y(), p.weight() }};
+}
+inline std::size_t site_row_size (const EPIC_Kernel::Point_2*) { return 2; }
+inline std::size_t site_row_size (const EPIC_Kernel::Weighted_point_2*) { return 3; }
+
+typedef std::array<double, 2> Vertex;
+
+// Keeps the part of the convex polygon where a.x + b.y <= c
+inline void clip (std::vector<Vertex>& polygon, double a, double b, double c, std::vector<Vertex>& buffer)
+{
+  buffer.clear();
+  for (std::size_t i = 0; i < polygon.size(); ++ i)
+  {
+    const Vertex& p = polygon[i];
+    const Vertex& q = polygon[(i + 1) % polygon.size()];
+    const double dp = a * p[0] + b * p[1] - c;
+    const double dq = a * q[0] + b * q[1] - c;
+    if (dp <= 0)
+      buffer.push_back (p);
+    if ((dp < 0 && dq > 0) || (dp > 0 && dq < 0))
+    {
+      const double t = dp / (dp - dq);
+      buffer.push_back (Vertex{{ p[0] + t * (q[0] - p[0]), p[1] + t * (q[1] - p[1]) }});
+    }
+  }
+  polygon.swap (buffer);
+}
+
+// strict comparison of the distances (the power distances for weighted
+// points) of the query q to the sites a and b
+inline bool is_closer (const EPIC_Kernel::Point_2& q, const EPIC_Kernel::Point_2& a, const EPIC_Kernel::Point_2& b)
+{
+  return EPIC_Kernel().compare_distance_2_object() (q, a, b) == CGAL::SMALLER;
+}
+inline bool is_closer (const EPIC_Kernel::Point_2& q, const EPIC_Kernel::Weighted_point_2& a, const EPIC_Kernel::Weighted_point_2& b)
+{
+  return EPIC_Kernel().compare_power_distance_2_object() (q, a, b) == CGAL::SMALLER;
+}
+
+// The sites of the finite vertices of a Delaunay or regular triangulation
+// and their neighbors (from the finite edges, hence also in dimension 1),
+// indexed in the order of the finite vertices iteration.
+template <class Triangulation>
+struct Site_graph
+{
+  typedef typename Triangulation::Point Site;
+
+  std::vector<Site> sites;
+  std::vector<int> offsets; // neighbors of i are [offsets[i], offsets[i+1])
+  std::vector<int> neighbors;
+
+  Site_graph (const Triangulation& dt)
+  {
+    typedef typename Triangulation::Vertex_handle Vertex_handle;
+    std::unordered_map<Vertex_handle, int, CGAL::Handle_hash_function> vertex_index;
+    vertex_index.reserve (dt.number_of_vertices());
+    sites.reserve (dt.number_of_vertices());
+    for (typename Triangulation::Finite_vertices_iterator v = dt.finite_vertices_begin(); v != dt.finite_vertices_end(); ++ v)
+    {
+      vertex_index[v] = int(sites.size());
+      sites.push_back (v->point());
+    }
+    std::vector<std::pair<int, int> > edges;
+    offsets.assign (sites.size() + 1, 0);
+    for (typename Triangulation::Finite_edges_iterator e = dt.finite_edges_begin(); e != dt.finite_edges_end(); ++ e)
+    {
+      const int i = vertex_index[e->first->vertex (Triangulation::cw (e->second))];
+      const int j = vertex_index[e->first->vertex (Triangulation::ccw (e->second))];
+      edges.push_back (std::make_pair (i, j));
+      ++ offsets[i + 1];
+      ++ offsets[j + 1];
+    }
+    for (std::size_t i = 1; i < offsets.size(); ++ i)
+      offsets[i] += offsets[i - 1];
+    neighbors.resize (offsets.back());
+    std::vector<int> next (offsets.begin(), offsets.end() - 1);
+    for (const std::pair<int, int>& e : edges)
+    {
+      neighbors[next[e.first] ++] = e.second;
+      neighbors[next[e.second] ++] = e.first;
+    }
+  }
+
+  // Walks from the site `start` to a neighbor strictly closer to q, as long
+  // as there is one. The cell of a site is the intersection of the half
+  // planes of its bisectors with its neighbors, so the walk stops at a site
+  // whose cell contains q.
+  int nearest_site (const EPIC_Kernel::Point_2& q, int start) const
+  {
+    int v = start;
+    for (;;)
+    {
+      int best = v;
+      for (int k = offsets[v]; k < offsets[v + 1]; ++ k)
+        if (is_closer (q, sites[neighbors[k]], sites[best]))
+          best = neighbors[k];
+      if (best == v)
+        return v;
+      v = best;
+    }
+  }
+};
+
+// Cells of the finite vertices of the Delaunay or regular triangulation dt,
+// clipped to the box, computed by clipping the box with the bisectors (the
+// power bisectors for weighted points) of each site and its neighbors in
+// dt. The cells are computed concurrently when linked with TBB.
+template <class Triangulation>
+Voronoi_cells clipped_cells (const Triangulation& dt, const EPIC_Kernel::Iso_rectangle_2& bbox,
+                             const SWIG_CGAL::Buffer<double>* sites)
+{
+  typedef typename Triangulation::Point Site;
+  const Site_graph<Triangulation> graph (dt);
+
+  // rows of the sites sorted by coordinates, for the site-index mapping
+  std::size_t row_size = 0;
+  std::vector<std::size_t> sorted_rows;
+  if (sites != nullptr)
+  {
+    row_size = site_row_size ((const Site*)nullptr);
+    sorted_rows.resize (SWIG_CGAL::number_of_rows (*sites, row_size));
+    for (std::size_t r = 0; r < sorted_rows.size(); ++ r)
+      sorted_rows[r] = r;
+    const double* data = sites->data();
+    std::stable_sort (sorted_rows.begin(), sorted_rows.end(),
+                      [data, row_size](std::size_t r, std::size_t s)
+                      {
+                        return std::make_pair (data[row_size * r], data[row_size * r + 1])
+                          < std::make_pair (data[row_size * s], data[row_size * s + 1]);
+                      });
+  }
+
+  std::vector<std::vector<Vertex> > cells (graph.sites.size());
+  std::vector<int> site_ids (graph.sites.size());
+  std::vector<std::size_t> ids (graph.sites.size());
+  for (std::size_t i = 0; i < ids.size(); ++ i)
+    ids[i] = i;
+  CGAL::for_each<Concurrency_tag>
+    (ids, [&](const std::size_t& i) -> bool
+     {
+       const std::array<double, 3> p = site_coordinates (graph.sites[i]);
+       std::vector<Vertex>& cell = cells[i];
+       cell.push_back (Vertex{{ bbox.xmin(), bbox.ymin() }});
+       cell.push_back (Vertex{{ bbox.xmax(), bbox.ymin() }});
+       cell.push_back (Vertex{{ bbox.xmax(), bbox.ymax() }});
+       cell.push_back (Vertex{{ bbox.xmin(), bbox.ymax() }});
+       std::vector<Vertex> buffer;
+       for (int k = graph.offsets[i]; k < graph.offsets[i + 1] && !cell.empty(); ++ k)
+       {
+         // x closer (in power distance) to p than to q
+         const std::array<double, 3> q = site_coordinates (graph.sites[graph.neighbors[k]]);
+         clip (cell, 2 * (q[0] - p[0]), 2 * (q[1] - p[1]),
+               q[0] * q[0] + q[1] * q[1] - q[2] - p[0] * p[0] - p[1] * p[1] + p[2], buffer);
+       }
+
+       site_ids[i] = int(i);
+       if (sites != nullptr)
+       {
+         const double* data = sites->data();
+         std::vector<std::size_t>::const_iterator it = std::lower_bound
+           (sorted_rows.begin(), sorted_rows.end(), std::make_pair (p[0], p[1]),
+            [data, row_size](std::size_t r, const std::pair<double, double>& xy)
+            { return std::make_pair (data[row_size * r], data[row_size * r + 1]) < xy; });
+         site_ids[i] = (it != sorted_rows.end() && data[row_size * *it] == p[0]
+                        && data[row_size * *it + 1] == p[1]) ? int(*it) : -1;
+       }
+       return true;
+     });
+
+  Voronoi_cells result;
+  for (std::size_t i = 0; i < cells.size(); ++ i)
+  {
+    for (const Vertex& v : cells[i])
+    {
+      result.vertices().push_back (v[0]);
+      result.vertices().push_back (v[1]);
+    }
+    result.offsets().push_back (int(result.vertices().size() / 2));
+  }
+  result.sites().swap (site_ids);
+  return result;
+}
+
+// Index of the nearest site (in the order of the finite vertices of dt) of
+// each row (x, y) of queries, -1 if dt has no vertices. The queries are
+// walked to in the order of a Hilbert sort, by chunks whose first walks
+// are chained; the chunks are processed concurrently when linked with TBB.
+template <class Triangulation>
+SWIG_CGAL::Buffer<int> nearest_sites (const Triangulation& dt, const SWIG_CGAL::Buffer<double>& queries)
+{
+  typedef SWIG_CGAL::Array_point_map<EPIC_Kernel::Point_2, 2> Point_map;
+  const std::size_t chunk_size = 1024;
+  const std::size_t n = SWIG_CGAL::number_of_rows (queries, 2);
+  const double* data = queries.data();
+  std::vector<int> result (n, -1);
+  const Site_graph<Triangulation> graph (dt);
+  if (graph.sites.empty())
+    return SWIG_CGAL::Buffer<int> (std::move (result));
+
+  std::vector<std::size_t> order (n);
+  for (std::size_t i = 0; i < n; ++ i)
+    order[i] = i;
+  CGAL::spatial_sort (order.begin(), order.end(),
+                      CGAL::Spatial_sort_traits_adapter_2<EPIC_Kernel, Point_map> (Point_map (data, 2)));
+
+  // the first queries of the chunks are close in the Hilbert order
+  std::vector<std::size_t> chunks;
+  int hint = 0;
+  for (std::size_t begin = 0; begin < n; begin += chunk_size)
+  {
+    const std::size_t i = order[begin];
+    hint = result[i] = graph.nearest_site (EPIC_Kernel::Point_2 (data[2 * i], data[2 * i + 1]), hint);
+    chunks.push_back (begin);
+  }
+  CGAL::for_each<Concurrency_tag>
+    (chunks, [&](const std::size_t& begin) -> bool
+     {
+       int previous = result[order[begin]];
+       const std::size_t end = (std::min) (begin + chunk_size, n);
+       for (std::size_t k = begin + 1; k < end; ++ k)
+       {
+         const std::size_t i = order[k];
+         previous = result[i] = graph.nearest_site (EPIC_Kernel::Point_2 (data[2 * i], data[2 * i + 1]), previous);
+       }
+       return true;
+     });
+  return SWIG_CGAL::Buffer<int> (std::move (result));
+}
+
+} // namespace internal
+} // namespace SWIG_Voronoi_diagram_2
+#endif
+
+#endif //SWIG_CGAL_VORONOI_DIAGRAM_2_VORONOI_DIAGRAM_2_ARRAYS_H
@@ -37,6 +37,6 @@
 
   SWIG_CGAL_declare_identifier_of_template_class(WRAPPER_PREFIX##_Locate_result, Locate_result_wrapper<WRAPPER_PREFIX##_Vertex_handle_SWIG_wrapper,WRAPPER_PREFIX##_Halfedge_handle_SWIG_wrapper,WRAPPER_PREFIX##_Face_handle_SWIG_wrapper>)
 
-  %typemap(javaimports)  Voronoi_diagram_2_wrapper %{ import CGAL.Triangulation_2.TRIANGULATION_WRAPPER; import CGAL.Kernel.Point_2; import CGAL.Kernel.Weighted_point_2; import java.util.Iterator; import CGAL.Triangulation_2.TRIANGULATION_WRAPPER##_Face_handle; import CGAL.Triangulation_2.TRIANGULATION_WRAPPER##_Edge; import CGAL.Triangulation_2.TRIANGULATION_WRAPPER##_Vertex_handle; %}
+  %typemap(javaimports)  Voronoi_diagram_2_wrapper %{ import CGAL.Triangulation_2.TRIANGULATION_WRAPPER; import CGAL.Kernel.Point_2; import CGAL.Kernel.Iso_rectangle_2; import CGAL.Kernel.Weighted_point_2; import java.util.Iterator; import CGAL.Triangulation_2.TRIANGULATION_WRAPPER##_Face_handle; import CGAL.Triangulation_2.TRIANGULATION_WRAPPER##_Edge; import CGAL.Triangulation_2.TRIANGULATION_WRAPPER##_Vertex_handle; %}
   SWIG_CGAL_declare_identifier_of_template_class(WRAPPER_PREFIX,Voronoi_diagram_2_wrapper<CPP_BASE,SITE_WRAPPER,TRIANGULATION_WRAPPER##_SWIG_wrapper,TRIANGULATION_WRAPPER##_Vertex_handle_SWIG_wrapper, TRIANGULATION_WRAPPER##_Face_handle_SWIG_wrapper, WRAPPER_PREFIX##_Vertex_handle_SWIG_wrapper,WRAPPER_PREFIX##_Halfedge_handle_SWIG_wrapper,WRAPPER_PREFIX##_Face_handle_SWIG_wrapper>)
 %enddef
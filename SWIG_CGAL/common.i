@@ -121,6 +121,15 @@
 %enddef
 #endif
 
+//records the calls of the entry points when profiling is on (see
+//SWIG_CGAL/Kernel/Profiling.h), in each %exception below, and runs the
+//heavy ones in the Thread_arena entered by the thread (see
+//SWIG_CGAL/Kernel/Thread_pool.h)
+%{
+  #include <SWIG_CGAL/Kernel/Profiling.h>
+  #include <SWIG_CGAL/Kernel/Thread_pool.h>
+%}
+
 //input iterator typemap
 //   Object_typemap_       is the object on which the typemap should be defined (used in the cpp code)
 //   Out_Object_           is the object wrapped by swig that is obtained when calling *
@@ -149,6 +158,7 @@
   %exception Function_name_
   {
     try{
+        SWIG_CGAL::Profiled_call swig_cgal_profiled_call("$name");
         $action
       }
       catch(Bad_element_type){
@@ -177,9 +187,18 @@
   %typemap(javain) Object_typemap_ "$javainput" //replace in java function call to wrapped function
 
   %typemap(in) Object_typemap_ {
-    Input_iterator_wrapper<Out_Object_,Out_Object_cpp_base_> it_end;
-    Input_iterator_wrapper<Out_Object_,Out_Object_cpp_base_> it_begin($input,SWIG_for_java_);
-    $1=std::make_pair(it_begin,it_end);
+    try{
+      Input_iterator_wrapper<Out_Object_,Out_Object_cpp_base_> it_end;
+      Input_iterator_wrapper<Out_Object_,Out_Object_cpp_base_> it_begin($input,SWIG_for_java_);
+      $1=std::make_pair(it_begin,it_end);
+    }
+    catch(std::exception& e){
+      //the range is read before the call, out of the %exception block
+      std::string error_msg("Error in SWIG_CGAL code. Here is the text of the C++ exception:\n");
+      error_msg += e.what();
+      throwJavaException(error_msg.c_str());
+      return $null;
+    }
   }
 %enddef
 #endif
@@ -192,6 +211,7 @@
 %exception
 {
   try{
+      SWIG_CGAL::Profiled_call swig_cgal_profiled_call("$name");
       $action
   }
   catch(std::exception& e){
@@ -217,6 +237,7 @@
 %exception Function_name_
 {
   try{
+      SWIG_CGAL::Profiled_call swig_cgal_profiled_call("$name");
       $action
     }
     catch(Bad_element_type){
@@ -227,6 +248,7 @@
 
 %exception {
    try {
+      SWIG_CGAL::Profiled_call swig_cgal_profiled_call("$name");
       $action
    } catch (std::exception &e) {
       std::string error_msg("Error in SWIG_CGAL code. Here is the text of the C++ exception:\n");
@@ -236,6 +258,53 @@
    }
 }
 
+//Releases the GIL while Function_name_ runs, so that other Python threads
+//can run meanwhile (the function must not use the Python API)
+%define SWIG_CGAL_release_gil(Function_name_)
+%exception Function_name_ {
+   std::string error_msg;
+   Py_BEGIN_ALLOW_THREADS
+   try {
+      SWIG_CGAL::Profiled_call swig_cgal_profiled_call("$name");
+      SWIG_CGAL::run_in_thread_arena([&]() { $action });
+   } catch (std::exception &e) {
+      error_msg = "Error in SWIG_CGAL code. Here is the text of the C++ exception:\n";
+      error_msg += e.what();
+   }
+   Py_END_ALLOW_THREADS
+   if (!error_msg.empty()) {
+      PyErr_SetString(PyExc_Exception, error_msg.c_str());
+      SWIG_fail;
+   }
+}
+%enddef
+
+#elif defined(SWIGJAVA)
+//Runs Function_name_ in the Thread_arena entered by the thread, if any. The
+//arena may run it on one of its worker threads, so that the function must
+//not use the JNIEnv of the caller (no Java iterators or containers)
+%define SWIG_CGAL_release_gil(Function_name_)
+%exception Function_name_
+{
+  try{
+      SWIG_CGAL::Profiled_call swig_cgal_profiled_call("$name");
+      SWIG_CGAL::run_in_thread_arena([&]() { $action });
+  }
+  catch(std::exception& e){
+    std::string error_msg("Error in SWIG_CGAL code. Here is the text of the C++ exception:\n");
+    error_msg += e.what();
+    if ( !throwJavaException(error_msg.c_str()) )
+      throw; //rethrow exception that could not be thrown in java
+  }
+  catch(...){
+    if ( !throwJavaException("Unknown error in SWIG_CGAL code") )
+      throw; //rethrow exception that could not be thrown in java
+  }
+}
+%enddef
+#else
+%define SWIG_CGAL_release_gil(Function_name_)
+%enddef
 #endif
 
 //output iterator typemap
@@ -281,6 +350,7 @@
 %exception next
 {
   try{
+      SWIG_CGAL::Profiled_call swig_cgal_profiled_call("$name");
       $action
     }
     catch(Stop_iteration){//TODO: throw a specify exception
@@ -292,6 +362,7 @@
 %exception __next__
 {
   try{
+      SWIG_CGAL::Profiled_call swig_cgal_profiled_call("$name");
       $action
     }
     catch(Stop_iteration){//TODO: throw a specify exception
@@ -1,2 +1,235 @@
-
 __version__ = '@CGAL_VERSION@'
+
+
+# Profiling of the calls of the bindings, shared by all the modules (see
+# SWIG_CGAL/Kernel/Profiling.h). Also turned on by setting the environment
+# variable CGAL_SWIG_PROFILE=1, the report being written at exit to the file
+# CGAL_SWIG_PROFILE_OUTPUT if set, as CGAL_SWIG_PROFILE_FORMAT (json|chrome).
+def set_profiling(enabled=True):
+    from CGAL import CGAL_Kernel
+    CGAL_Kernel.set_profiling(enabled)
+
+
+def is_profiling():
+    from CGAL import CGAL_Kernel
+    return CGAL_Kernel.is_profiling()
+
+
+def reset_profiling():
+    from CGAL import CGAL_Kernel
+    CGAL_Kernel.reset_profiling()
+
+
+def profiling_report(format='json'):
+    # 'json': statistics per entry point, 'chrome': Chrome trace events
+    from CGAL import CGAL_Kernel
+    return CGAL_Kernel.profiling_report(format)
+
+
+def write_profiling_report(filename, format='json'):
+    from CGAL import CGAL_Kernel
+    if not CGAL_Kernel.write_profiling_report(filename, format):
+        raise IOError("Cannot write the profiling report to " + filename)
+
+
+# Number of threads of the parallel functions of all the modules (see
+# SWIG_CGAL/Kernel/Thread_pool.h), by default limited to the CPU quota of the
+# cgroup of the process, or set by the environment variable
+# CGAL_SWIG_NUM_THREADS. set_num_threads(0) restores the default.
+def set_num_threads(n):
+    from CGAL import CGAL_Kernel
+    CGAL_Kernel.set_num_threads(n)
+
+
+def get_num_threads():
+    from CGAL import CGAL_Kernel
+    return CGAL_Kernel.get_num_threads()
+
+
+class thread_arena(object):
+    # Runs the calls of the block in a TBB task arena with at most
+    # num_threads threads (0 for get_num_threads()), on the NUMA node
+    # numa_node (-1 for any) and, if cores is given (a list of core numbers
+    # or a string like "0-3,8"), with the threads pinned to these cores:
+    #   with CGAL.thread_arena(4):
+    #       jet_estimate_normals(points, 12)
+    def __init__(self, num_threads=0, numa_node=-1, cores=None):
+        if cores is not None and not isinstance(cores, str):
+            cores = ",".join(str(c) for c in cores)
+        self.num_threads = num_threads
+        self.numa_node = numa_node
+        self.cores = cores or ""
+        self.arena = None
+
+    def __enter__(self):
+        from CGAL import CGAL_Kernel
+        self.arena = CGAL_Kernel.Thread_arena(self.num_threads, self.numa_node, self.cores)
+        self.arena.enter()
+        return self.arena
+
+    def __exit__(self, *args):
+        self.arena.exit()
+        self.arena = None
+        return False
+
+
+# Asynchronous calls of the long running functions. run_async(f, *args)
+# calls f(*args) in one of the worker threads shared by all the modules and
+# returns a concurrent.futures.Future (awaitable in asyncio with
+# asyncio.wrap_future()). The functions it is used for release the GIL, so
+# the caller keeps running while they run; their arguments must not be used
+# before the future is done. The modules define <function>_async variants
+# of make_mesh_3, isotropic_remeshing, alpha_wrap_3,
+# advancing_front_surface_reconstruction, classify_with_graphcut and of the
+# registration functions. The number of workers, that is of calls run at
+# the same time, is 1 by default (each call then uses get_num_threads()
+# threads), or the value of the environment variable CGAL_SWIG_ASYNC_WORKERS.
+import threading as _threading
+
+_async_lock = _threading.Lock()
+_async_executor = None
+_async_workers = 0
+
+
+def _executor():
+    global _async_executor
+    with _async_lock:
+        if _async_executor is None:
+            import concurrent.futures
+            import os
+            n = _async_workers or int(os.environ.get("CGAL_SWIG_ASYNC_WORKERS", "1") or 1)
+            _async_executor = concurrent.futures.ThreadPoolExecutor(
+                max_workers=max(1, n), thread_name_prefix="CGAL_async")
+        return _async_executor
+
+
+def set_async_workers(n):
+    # the calls already submitted are run by the previous workers
+    global _async_executor, _async_workers
+    with _async_lock:
+        previous = _async_executor
+        _async_executor = None
+        _async_workers = max(0, n)
+    if previous is not None:
+        previous.shutdown(wait=False)
+
+
+def run_async(function, *args, **kwargs):
+    return _executor().submit(function, *args, **kwargs)
+
+
+def async_variant(function):
+    def call_async(*args, **kwargs):
+        return run_async(function, *args, **kwargs)
+    call_async.__name__ = function.__name__ + "_async"
+    call_async.__doc__ = "Calls %s() with run_async()" % function.__name__
+    return call_async
+
+
+# Pickling of Point_set_3, Polyhedron_3, the triangulations and the AABB
+# trees on arrays (AABB_tree_indexed_Triangle_3_soup, Flat_AABB_tree_3), so
+# that they can be passed to multiprocessing workers without going through
+# files. The state pickled is the compact binary one of save_state().
+# obj.to_shared_memory() writes it in a named shared memory segment and
+# returns its name, from which Class.from_shared_memory(name) loads the
+# object in any process: Flat_AABB_tree_3 and Mapped_point_set_3 (attached
+# to the segment of a Point_set_3) use the segment in place, read-only, the
+# other classes are built from its pages without intermediate copy. The
+# segment is kept until remove_shared_memory(name) is called.
+def remove_shared_memory(name):
+    from CGAL import CGAL_Kernel
+    return CGAL_Kernel.remove_shared_memory(name)
+
+
+def add_pickle_support(cls):
+    def __getstate__(self):
+        return bytes(self.save_state())
+
+    def __setstate__(self, state):
+        self.__init__()
+        self.load_state(state)
+
+    def from_shared_memory(cls, name):
+        out = cls()
+        out.load_shared_memory(name)
+        return out
+
+    cls.__getstate__ = __getstate__
+    cls.__setstate__ = __setstate__
+    cls.from_shared_memory = classmethod(from_shared_memory)
+    return cls
+
+
+# Lazy loading of the modules, to reduce the import time and the memory of
+# the processes using only a few functions (e.g. serverless functions on a
+# cold start). The modules are attributes of the package loaded on first
+# access (CGAL.CGAL_Kernel.Point_3 after import CGAL). With the environment
+# variable CGAL_SWIG_LAZY_IMPORTS=1, or after enable_lazy_imports(), the
+# Python part of a module imported, and of the modules it depends on, is
+# executed on the first access to one of its attributes, so importing
+# CGAL_Polygon_mesh_processing does not load CGAL_Surface_mesh and
+# CGAL_AABB_tree until they are used. Objects of a module not loaded yet
+# can only be returned as plain SWIG pointers: import the modules of the
+# classes used before calling functions returning them, as usual.
+class _Lazy_module_finder(object):
+    def find_spec(self, name, path, target=None):
+        if not name.startswith("CGAL.CGAL_"):
+            return None
+        import importlib.machinery
+        import importlib.util
+        spec = importlib.machinery.PathFinder.find_spec(name, path)
+        # the extensions (CGAL._CGAL_*) are loaded by the Python part
+        if spec is None or not isinstance(spec.loader, (importlib.machinery.SourceFileLoader,
+                                                        importlib.machinery.SourcelessFileLoader)):
+            return None
+        spec.loader = importlib.util.LazyLoader(spec.loader)
+        return spec
+
+
+def enable_lazy_imports(enabled=True):
+    import sys
+    sys.meta_path[:] = [f for f in sys.meta_path if not isinstance(f, _Lazy_module_finder)]
+    if enabled:
+        sys.meta_path.insert(0, _Lazy_module_finder())
+
+
+def _lazy_imports_requested():
+    import os
+    return os.environ.get("CGAL_SWIG_LAZY_IMPORTS", "") not in ("", "0")
+
+
+if _lazy_imports_requested():
+    enable_lazy_imports()
+
+
+def __getattr__(name):
+    if name.startswith("CGAL_"):
+        import importlib
+        try:
+            return importlib.import_module("CGAL." + name)
+        except ModuleNotFoundError as e:
+            if e.name != "CGAL." + name:
+                raise
+    raise AttributeError("module 'CGAL' has no attribute '%s'" % name)
+
+
+# Optional dependencies the modules were built with, e.g. to check that an
+# installed wheel has the parallel versions of the functions (TBB) or the
+# LAS reader (LASlib) before using them. Returns a dictionary with a boolean
+# per dependency, the modules built and the compilation options.
+def build_info():
+    from CGAL import _build_info
+
+    def on(value):
+        return value.upper() in ("1", "ON", "YES", "TRUE", "Y")
+
+    info = dict.fromkeys(("tbb", "laslib", "zlib", "eigen", "opengr", "pointmatcher",
+                          "imageio", "boost_serialization"), False)
+    info.update(_build_info.features)
+    info["tbb_version"] = _build_info.tbb_version if info["tbb"] else None
+    info["cgal_version"] = __version__
+    info["modules"] = list(_build_info.modules)
+    info["lto"] = on(_build_info.lto)
+    info["march"] = _build_info.march or None
+    info["multi_isa"] = on(_build_info.multi_isa) and not _build_info.march
+    return info
@@ -119,6 +119,26 @@ cmake --build . --config Release -j$PAR_JOBS
 cmake --install . --config Release
 cd /cgal-bindings
 
+# Build oneTBB, for the parallel versions of the functions (auditwheel
+# bundles libtbb with the wheel)
+echo "=== Building oneTBB 2021.13.0 ==="
+cd /tmp
+wget -q https://github.com/oneapi-src/oneTBB/archive/refs/tags/v2021.13.0.tar.gz
+tar xzf v2021.13.0.tar.gz
+cd oneTBB-2021.13.0
+mkdir build && cd build
+cmake .. \
+  -DCMAKE_BUILD_TYPE=Release \
+  -DCMAKE_INSTALL_PREFIX=$INSTALL_PREFIX \
+  -DTBB_TEST=OFF \
+  -DTBB_EXAMPLES=OFF \
+  -DTBB_STRICT=OFF \
+  -DTBBMALLOC_PROXY_BUILD=OFF
+cmake --build . --config Release -j$PAR_JOBS
+cmake --install . --config Release
+export TBB_ROOT=$INSTALL_PREFIX
+cd /cgal-bindings
+
 # Build CGAL wheel
 echo "=== Building CGAL wheel ==="
 export LD_LIBRARY_PATH=$INSTALL_PREFIX/lib:$LD_LIBRARY_PATH
@@ -126,9 +146,14 @@ mkdir -p build/build-python/CGAL
 
 $PYTHON_BIN -m pip install --upgrade pip setuptools wheel numpy
 
+# generic x86-64 binaries with link-time optimization, the loops over arrays
+# running their AVX2/AVX-512 versions on the CPUs which have them, and
+# TBB being required so that a wheel is never silently built sequential
 $PYTHON_BIN setup.py bdist_wheel \
   --cmake-prefix-path="$INSTALL_PREFIX;/cgal" \
-  --python-executable=$PYTHON_BIN
+  --python-executable=$PYTHON_BIN \
+  --lto=ON \
+  --require-tbb=ON
 
 # Repair wheel with auditwheel
 echo "=== Repairing wheel with auditwheel ==="
@@ -17,6 +17,16 @@ MACRO(EXTRACT_CPP_AND_LIB_FILES)
 ENDMACRO(EXTRACT_CPP_AND_LIB_FILES)
 
 
+# Records the optional dependency `name` as available or not, according to
+# the value of `found`, in the dictionary returned by CGAL.build_info()
+MACRO(SWIG_CGAL_ADD_BUILD_INFO name found)
+  if (${found})
+    set_property(GLOBAL APPEND PROPERTY SWIG_CGAL_BUILD_INFO "    '${name}': True,")
+  else()
+    set_property(GLOBAL APPEND PROPERTY SWIG_CGAL_BUILD_INFO "    '${name}': False,")
+  endif()
+ENDMACRO()
+
 MACRO(ADD_SWIG_CGAL_LIBRARY libname)
   include_directories(${CMAKE_CURRENT_SOURCE_DIR})
   set(CMAKE_LIBRARY_OUTPUT_DIRECTORY "${COMMON_LIBRARIES_PATH}")
@@ -99,6 +109,16 @@ MACRO(ADD_SWIG_CGAL_PYTHON_MODULE packagename)
     SWIG_ADD_LIBRARY(${MODULENAME}_python LANGUAGE python SOURCES ${INTERFACE_FILES} ${source_files})
 
     set_target_properties (${MODULENAME}_python PROPERTIES OUTPUT_NAME ${MODULENAME})
+    # only the init function of the module is exported (SWIGEXPORT): the
+    # symbols of the template instantiations are bound at link time, which
+    # shrinks the dynamic symbol table and the relocations done by the
+    # dynamic loader on import
+    set_target_properties (${MODULENAME}_python PROPERTIES CXX_VISIBILITY_PRESET hidden
+                                                           VISIBILITY_INLINES_HIDDEN ON)
+    if (CMAKE_CXX_COMPILER_ID MATCHES "GNU|Clang" AND NOT APPLE AND NOT WIN32)
+      # do not load the libraries the module does not use
+      target_link_options (${MODULENAME}_python PRIVATE "LINKER:--as-needed")
+    endif()
     if (WIN32)
       swig_link_libraries (${MODULENAME}_python Python::Module)
     elseif (APPLE)
@@ -107,6 +127,7 @@ MACRO(ADD_SWIG_CGAL_PYTHON_MODULE packagename)
     # .pyd/.so files must NOT be in a /Release or a /Debug directory, or their import path will be wrong.
     set_target_properties (${SWIG_MODULE_${MODULENAME}_python_REAL_NAME} PROPERTIES LIBRARY_OUTPUT_DIRECTORY "${PYTHON_OUTDIR_PREFIX}/CGAL$<$<CONFIG:Release>:>")
     swig_link_libraries (${MODULENAME}_python  CGAL::CGAL ${libstolinkwith})
+    set_property(GLOBAL APPEND PROPERTY SWIG_CGAL_PYTHON_MODULES "'${MODULENAME}'")
     install (FILES ${PYTHON_OUTDIR_PREFIX}/CGAL/${MODULENAME}.py DESTINATION ${PYTHON_MODULE_PATH}/CGAL)
     install (TARGETS ${MODULENAME}_python DESTINATION ${PYTHON_MODULE_PATH}/CGAL)
   endif()
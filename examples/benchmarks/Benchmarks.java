@@ -0,0 +1,412 @@
+import CGAL.Kernel.Memory_usage;
+import CGAL.Kernel.Point_3;
+import CGAL.Point_set_3.Point_set_3;
+import CGAL.Point_set_processing_3.CGAL_Point_set_processing_3;
+import CGAL.Polyhedron_3.Polyhedron_3;
+import CGAL.Polyhedron_3.Polyhedron_3_Facet_handle;
+import CGAL.AABB_tree.AABB_tree_Polyhedron_3_Facet_handle;
+import CGAL.Spatial_searching.Orthogonal_k_neighbor_search_tree_3;
+import CGAL.Spatial_searching.Orthogonal_k_neighbor_search_3;
+import CGAL.Spatial_searching.Point_with_transformed_distance_3;
+import CGAL.Triangulation_2.Delaunay_triangulation_2;
+import CGAL.Triangulation_3.Delaunay_triangulation_3;
+import CGAL.Mesh_3.Mesh_3_Complex_3_in_triangulation_3;
+import CGAL.Mesh_3.CGAL_Mesh_3;
+import CGAL.Mesh_3.Polyhedral_mesh_domain_3;
+import CGAL.Mesh_3.Mesh_3_parameters;
+import CGAL.Mesh_3.Default_mesh_criteria;
+import CGAL.Polygon_mesh_processing.CGAL_Polygon_mesh_processing;
+import CGAL.Classification.Feature_set;
+import CGAL.Classification.Point_set_feature_generator;
+import CGAL.Classification.Feature_family;
+import CGAL.Classification.Label_set;
+import CGAL.Classification.ETHZ_Random_forest_classifier;
+import CGAL.Classification.CGAL_Classification;
+import CGAL.Shape_detection.CGAL_Shape_detection;
+import CGAL.Advancing_front_surface_reconstruction.CGAL_Advancing_front_surface_reconstruction;
+
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.io.File;
+import java.io.IOException;
+import java.nio.DoubleBuffer;
+import java.nio.file.Files;
+import java.nio.file.Paths;
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.HashMap;
+import java.util.LinkedList;
+import java.util.List;
+import java.util.Map;
+
+// Java counterpart of native_benchmarks.cpp: the same cases on the same
+// inputs, through the bindings.
+//
+// usage: java Benchmarks [--repeat N] [package...]
+// Each case prints one line "BENCH <package> <case> <seconds>", the seconds
+// being the best time of the N repetitions, and the cases building a
+// structure print "MEMORY <package> <case> <bytes>", the total of its
+// memory_usage(). The stages of the Pipeline package also print
+// "RSS Pipeline <stage> <bytes>", the peak resident set size of the process
+// during the stage in its first run (Linux 4.0 or later, whose peak can be
+// reset).
+public class Benchmarks {
+
+  // sizes of the synthetic inputs, the same in the three implementations
+  static final int number_of_points = 100000;
+  static final int number_of_queries = 10000;
+  // the Pipeline package runs on pipeline_tiles x pipeline_tiles copies of
+  // b9_training.ply side by side
+  static final int pipeline_tiles = 3;
+
+  static String datadir = "../data";
+  static int repeat = 3;
+
+  // pseudo-random numbers in [0,1) of the 64-bit linear congruential
+  // generator of native_benchmarks.cpp
+  static class Random {
+    long state;
+    Random(long seed) { state = seed; }
+    double next() {
+      state = state * 6364136223846793005L + 1442695040888963407L;
+      return (state >>> 11) * (1. / 9007199254740992.);
+    }
+  }
+
+  static DoubleBuffer allocate(int size) {
+    return ByteBuffer.allocateDirect(8 * size).order(ByteOrder.nativeOrder()).asDoubleBuffer();
+  }
+
+  // (x,y) rows of n points in the unit square
+  static DoubleBuffer square_points(int n, long seed) {
+    Random random = new Random(seed);
+    DoubleBuffer coordinates = allocate(2 * n);
+    for (int i = 0; i < 2 * n; ++i)
+      coordinates.put(i, random.next());
+    return coordinates;
+  }
+
+  // (x,y,z) rows of n points in the cube [-1,1]^3
+  static DoubleBuffer cube_points(int n, long seed) {
+    Random random = new Random(seed);
+    DoubleBuffer coordinates = allocate(3 * n);
+    for (int i = 0; i < 3 * n; ++i)
+      coordinates.put(i, 2. * random.next() - 1.);
+    return coordinates;
+  }
+
+  // n points close to the unit sphere
+  static DoubleBuffer sphere_points(int n, long seed) {
+    Random random = new Random(seed);
+    DoubleBuffer coordinates = allocate(3 * n);
+    for (int i = 0; i < n; ++i) {
+      double z = 2. * random.next() - 1.;
+      double phi = 2. * Math.PI * random.next();
+      double radius = 1. + 0.01 * (random.next() - 0.5);
+      double r = radius * Math.sqrt(1. - z * z);
+      coordinates.put(3 * i, r * Math.cos(phi));
+      coordinates.put(3 * i + 1, r * Math.sin(phi));
+      coordinates.put(3 * i + 2, radius * z);
+    }
+    return coordinates;
+  }
+
+  static List<Point_3> to_points(DoubleBuffer coordinates) {
+    List<Point_3> points = new ArrayList<Point_3>();
+    for (int i = 0; i < coordinates.capacity(); i += 3)
+      points.add(new Point_3(coordinates.get(i), coordinates.get(i + 1), coordinates.get(i + 2)));
+    return points;
+  }
+
+  interface Setup<T> { T make(); }
+  interface Run<T> { void run(T state); }
+
+  // best time of `repeat` runs of run(state), state being made again by
+  // setup() (not timed) before each run; returns the state of the last run
+  static <T> T bench(String package_name, String name, Setup<T> setup, Run<T> run) {
+    double best = Double.MAX_VALUE;
+    T state = null;
+    for (int i = 0; i < repeat; ++i) {
+      state = setup.make();
+      long start = System.nanoTime();
+      run.run(state);
+      best = Math.min(best, (System.nanoTime() - start) * 1e-9);
+    }
+    System.out.println("BENCH " + package_name + " " + name + " " + best);
+    return state;
+  }
+
+  // resets the peak resident set size of the process to its current one,
+  // false if not supported
+  static boolean reset_peak_rss() {
+    try {
+      Files.write(Paths.get("/proc/self/clear_refs"), "5".getBytes());
+      return true;
+    } catch (IOException e) {
+      return false;
+    }
+  }
+
+  // peak resident set size of the process in bytes (VmHWM) since it was last
+  // reset, 0 if unknown
+  static long peak_rss() {
+    try {
+      for (String line : Files.readAllLines(Paths.get("/proc/self/status")))
+        if (line.startsWith("VmHWM:"))
+          return 1024 * Long.parseLong(line.substring(6).trim().split("\\s+")[0]);
+    } catch (IOException e) {
+    }
+    return 0;
+  }
+
+  // `usage` is the Memory_usage of the structure built by the case
+  static void memory(String package_name, String name, Memory_usage usage) {
+    System.out.println("MEMORY " + package_name + " " + name + " " + usage.total());
+  }
+
+  static void bench_point_set_processing() {
+    final DoubleBuffer points = sphere_points(number_of_points, 1);
+    bench("Point_set_processing_3", "compute_average_spacing",
+          () -> Point_set_3.from_arrays(points),
+          ps -> CGAL_Point_set_processing_3.compute_average_spacing(ps, 6));
+    Point_set_3 ps = bench("Point_set_processing_3", "jet_estimate_normals",
+                           () -> Point_set_3.from_arrays(points),
+                           state -> CGAL_Point_set_processing_3.jet_estimate_normals(state, 12));
+    memory("Point_set_processing_3", "jet_estimate_normals", ps.memory_usage());
+  }
+
+  static void bench_aabb_tree() {
+    final Polyhedron_3 P = new Polyhedron_3(datadir + "/elephant.off");
+    final List<Point_3> queries = to_points(cube_points(number_of_queries, 2));
+    bench("AABB_tree", "build", () -> null, state -> {
+      AABB_tree_Polyhedron_3_Facet_handle tree = new AABB_tree_Polyhedron_3_Facet_handle(P.facets());
+      tree.prepare();
+    });
+    final AABB_tree_Polyhedron_3_Facet_handle tree = new AABB_tree_Polyhedron_3_Facet_handle(P.facets());
+    tree.prepare();
+    memory("AABB_tree", "build", tree.memory_usage());
+    bench("AABB_tree", "closest_point_loop", () -> null, state -> {
+      double sum = 0;
+      for (Point_3 q : queries)
+        sum += tree.closest_point(q).x();
+      if (Double.isNaN(sum)) throw new AssertionError("closest_point");
+    });
+  }
+
+  static void bench_kd_tree() {
+    final List<Point_3> points = to_points(cube_points(number_of_points, 3));
+    final List<Point_3> queries = to_points(cube_points(number_of_queries, 4));
+    bench("Kd_tree", "build", () -> null, state -> {
+      Orthogonal_k_neighbor_search_tree_3 tree = new Orthogonal_k_neighbor_search_tree_3(points.iterator());
+      tree.build();
+    });
+    final Orthogonal_k_neighbor_search_tree_3 tree = new Orthogonal_k_neighbor_search_tree_3(points.iterator());
+    tree.build();
+    memory("Kd_tree", "build", tree.memory_usage());
+    bench("Kd_tree", "knn_loop", () -> null, state -> {
+      double sum = 0;
+      for (Point_3 q : queries) {
+        Orthogonal_k_neighbor_search_3 search = new Orthogonal_k_neighbor_search_3(tree, q, 8);
+        for (Point_with_transformed_distance_3 neighbor : search.iterator())
+          sum += neighbor.getSecond();
+      }
+      if (Double.isNaN(sum)) throw new AssertionError("knn");
+    });
+  }
+
+  static void bench_triangulation_2() {
+    final DoubleBuffer points = square_points(number_of_points, 5);
+    Delaunay_triangulation_2 t = bench("Triangulation_2", "delaunay_insert", () -> new Delaunay_triangulation_2(),
+                                       state -> state.insert_from_array(points));
+    memory("Triangulation_2", "delaunay_insert", t.memory_usage());
+  }
+
+  static void bench_triangulation_3() {
+    final DoubleBuffer points = cube_points(number_of_points, 6);
+    Delaunay_triangulation_3 t = bench("Triangulation_3", "delaunay_insert", () -> new Delaunay_triangulation_3(),
+                                       state -> state.insert_from_array(points));
+    memory("Triangulation_3", "delaunay_insert", t.memory_usage());
+  }
+
+  static void bench_mesh_3() {
+    Polyhedron_3 polyhedron = new Polyhedron_3(datadir + "/elephant.off");
+    final Polyhedral_mesh_domain_3 domain = new Polyhedral_mesh_domain_3(polyhedron);
+    final Mesh_3_parameters params = new Mesh_3_parameters();
+    params.no_exude();
+    params.no_perturb();
+    final Default_mesh_criteria criteria = new Default_mesh_criteria();
+    criteria.facet_angle(25).facet_size(0.15).facet_distance(0.008).cell_radius_edge_ratio(3);
+    List<Mesh_3_Complex_3_in_triangulation_3> last = bench("Mesh_3", "make_mesh_3",
+      () -> new ArrayList<Mesh_3_Complex_3_in_triangulation_3>(), state -> {
+      Mesh_3_Complex_3_in_triangulation_3 c3t3 = CGAL_Mesh_3.make_mesh_3(domain, criteria, params);
+      if (c3t3.number_of_cells() == 0) throw new AssertionError("make_mesh_3");
+      state.add(c3t3);
+    });
+    memory("Mesh_3", "make_mesh_3", last.get(0).memory_usage());
+  }
+
+  static void bench_polygon_mesh_processing() {
+    Polyhedron_3 remeshed = bench("Polygon_mesh_processing", "isotropic_remeshing",
+          () -> new Polyhedron_3(datadir + "/elephant.off"),
+          P -> {
+            LinkedList<Polyhedron_3_Facet_handle> flist = new LinkedList<Polyhedron_3_Facet_handle>();
+            for (Polyhedron_3_Facet_handle fh : P.facets())
+              flist.add(fh.clone());
+            CGAL_Polygon_mesh_processing.isotropic_remeshing(flist.iterator(), 0.02, P, 1);
+          });
+    memory("Polygon_mesh_processing", "isotropic_remeshing", remeshed.memory_usage());
+  }
+
+  static void bench_classification() {
+    final Point_set_3 points = new Point_set_3(datadir + "/b9_training.ply");
+    List<Feature_set> last = bench("Classification", "generate_point_based_features",
+      () -> new ArrayList<Feature_set>(), state -> {
+      Feature_set features = new Feature_set();
+      Point_set_feature_generator generator = new Point_set_feature_generator(points, 5);
+      generator.generate_features(features, Feature_family.POINT_BASED_FEATURES.swigValue());
+      state.add(features);
+    });
+    memory("Classification", "generate_point_based_features", last.get(0).memory_usage(points.number_of_points()));
+  }
+
+  // writes the tiles of b9_training.ply translated side by side in the xy
+  // plane as a binary PLY file, and returns their average spacing
+  static double write_pipeline_input(String filename) {
+    Point_set_3 tile = new Point_set_3(datadir + "/b9_training.ply");
+    DoubleBuffer coordinates = tile.point_array();
+    int n = tile.size();
+    double[] extent = new double[2];
+    for (int c = 0; c < 2; ++c) {
+      double min = Double.MAX_VALUE, max = -Double.MAX_VALUE;
+      for (int i = 0; i < n; ++i) {
+        min = Math.min(min, coordinates.get(3 * i + c));
+        max = Math.max(max, coordinates.get(3 * i + c));
+      }
+      extent[c] = max - min;
+    }
+    Point_set_3 scaled = new Point_set_3();
+    for (int tx = 0; tx < pipeline_tiles; ++tx)
+      for (int ty = 0; ty < pipeline_tiles; ++ty) {
+        Point_set_3 copy = new Point_set_3(datadir + "/b9_training.ply");
+        coordinates = copy.point_array();
+        for (int i = 0; i < n; ++i) {
+          coordinates.put(3 * i, coordinates.get(3 * i) + tx * extent[0]);
+          coordinates.put(3 * i + 1, coordinates.get(3 * i + 1) + ty * extent[1]);
+        }
+        scaled.join(copy);
+      }
+    if (!scaled.write(filename))
+      throw new RuntimeException("Cannot write " + filename);
+    return CGAL_Point_set_processing_3.compute_average_spacing(scaled, 6);
+  }
+
+  // best times and peak RSS of the stages of the pipeline, in their order
+  static class Pipeline_stages {
+    final List<String> names = new ArrayList<String>();
+    final Map<String, Double> best = new HashMap<String, Double>();
+    final Map<String, Long> rss = new HashMap<String, Long>();
+    boolean first_run = true;
+
+    void run(String name, Runnable stage) {
+      boolean measure_rss = first_run && reset_peak_rss();
+      long start = System.nanoTime();
+      stage.run();
+      double elapsed = (System.nanoTime() - start) * 1e-9;
+      if (first_run) {
+        names.add(name);
+        best.put(name, elapsed);
+        rss.put(name, measure_rss ? peak_rss() : 0);
+      } else
+        best.put(name, Math.min(best.get(name), elapsed));
+    }
+  }
+
+  // A LiDAR workflow from a PLY file to a classified point set and a
+  // surface, each stage working on the output of the previous one: the
+  // best time of each stage over the runs is reported, as the case <stage>
+  // of the package
+  static void bench_pipeline() {
+    final String filename = "pipeline_input.ply";
+    final double spacing = write_pipeline_input(filename);
+    Pipeline_stages stages = new Pipeline_stages();
+    for (int run = 0; run < repeat; ++run) {
+      final Point_set_3 points = new Point_set_3();
+      stages.run("read_ply", () -> points.read(filename));
+      stages.run("remove_outliers", () -> {
+        CGAL_Point_set_processing_3.remove_outliers(points, 24, 0., 2.);
+        points.collect_garbage();
+      });
+      stages.run("grid_simplify_point_set", () -> {
+        CGAL_Point_set_processing_3.grid_simplify_point_set(points, spacing);
+        points.collect_garbage();
+      });
+      stages.run("jet_estimate_normals", () -> CGAL_Point_set_processing_3.jet_estimate_normals(points, 12));
+      stages.run("mst_orient_normals", () -> {
+        CGAL_Point_set_processing_3.mst_orient_normals(points, 12);
+        points.collect_garbage();
+      });
+      stages.run("region_growing", () -> CGAL_Shape_detection.region_growing(
+        points, points.add_int_map("plane_index"), 20, -1, -1, 0.9, 12));
+
+      final Label_set labels = new Label_set();
+      labels.add("ground");
+      labels.add("vegetation");
+      labels.add("building");
+      final Feature_set features = new Feature_set();
+      final Point_set_feature_generator[] generator = new Point_set_feature_generator[1];
+      stages.run("generate_point_based_features", () -> {
+        generator[0] = new Point_set_feature_generator(points, 5);
+        generator[0].generate_features(features, Feature_family.POINT_BASED_FEATURES.swigValue());
+      });
+      final ETHZ_Random_forest_classifier classifier = new ETHZ_Random_forest_classifier(labels, features);
+      stages.run("train_random_forest",
+                 () -> classifier.train(points.range(points.int_map("label")), true, 25, 20));
+      stages.run("classify_with_graphcut", () -> CGAL_Classification.classify_with_graphcut(
+        points, labels, classifier, generator[0].neighborhood().k_neighbor_query(6), 0.5, 12,
+        points.add_int_map("classification")));
+      final Polyhedron_3 P = new Polyhedron_3();
+      stages.run("advancing_front_surface_reconstruction",
+                 () -> CGAL_Advancing_front_surface_reconstruction.advancing_front_surface_reconstruction(points, P));
+      if (P.size_of_facets() == 0) throw new AssertionError("advancing_front_surface_reconstruction");
+      stages.first_run = false;
+    }
+    for (String name : stages.names) {
+      System.out.println("BENCH Pipeline " + name + " " + stages.best.get(name));
+      if (stages.rss.get(name) > 0)
+        System.out.println("RSS Pipeline " + name + " " + stages.rss.get(name));
+    }
+    new File(filename).delete();
+  }
+
+  public static void main(String args[]) {
+    String env_datadir = System.getenv("DATADIR");
+    if (env_datadir != null)
+      datadir = env_datadir;
+    List<String> packages = new ArrayList<String>();
+    for (int i = 0; i < args.length; ++i) {
+      if (args[i].equals("--repeat") && i + 1 < args.length)
+        repeat = Math.max(1, Integer.parseInt(args[++i]));
+      else
+        packages.add(args[i]);
+    }
+
+    List<String> all = Arrays.asList("Point_set_processing_3", "AABB_tree", "Kd_tree",
+                                     "Triangulation_2", "Triangulation_3", "Mesh_3",
+                                     "Polygon_mesh_processing", "Classification", "Pipeline");
+    for (String package_name : all) {
+      if (!packages.isEmpty() && !packages.contains(package_name))
+        continue;
+      switch (package_name) {
+        case "Point_set_processing_3":  bench_point_set_processing(); break;
+        case "AABB_tree":               bench_aabb_tree(); break;
+        case "Kd_tree":                 bench_kd_tree(); break;
+        case "Triangulation_2":         bench_triangulation_2(); break;
+        case "Triangulation_3":         bench_triangulation_3(); break;
+        case "Mesh_3":                  bench_mesh_3(); break;
+        case "Polygon_mesh_processing": bench_polygon_mesh_processing(); break;
+        case "Classification":          bench_classification(); break;
+        case "Pipeline":                bench_pipeline(); break;
+      }
+    }
+  }
+}
@@ -0,0 +1,385 @@
+# Python counterpart of native_benchmarks.cpp: the same cases on the same
+# inputs, through the bindings.
+#
+# usage: python benchmarks.py [--repeat N] [package...]
+# Each case prints one line "BENCH <package> <case> <seconds>", the seconds
+# being the best time of the N repetitions, and the cases building a
+# structure print "MEMORY <package> <case> <bytes>", the total of its
+# memory_usage(). The stages of the Pipeline package also print
+# "RSS Pipeline <stage> <bytes>", the peak resident set size of the process
+# during the stage in its first run (Linux 4.0 or later, whose peak can be
+# reset). The packages whose
+# module is not available print "SKIP <package> <reason>".
+
+from __future__ import print_function
+
+from array import array
+import math
+import os
+import sys
+import time
+
+datadir = os.environ.get('DATADIR', '../data')
+
+# sizes of the synthetic inputs, the same in the three implementations
+number_of_points = 100000
+number_of_queries = 10000
+# the Pipeline package runs on pipeline_tiles x pipeline_tiles copies of
+# b9_training.ply side by side
+pipeline_tiles = 3
+
+
+class Random(object):
+    # pseudo-random numbers in [0,1) of the 64-bit linear congruential
+    # generator of native_benchmarks.cpp
+    def __init__(self, seed):
+        self.state = seed
+
+    def next(self):
+        self.state = (self.state * 6364136223846793005 + 1442695040888963407) & 0xFFFFFFFFFFFFFFFF
+        return (self.state >> 11) * (1. / 9007199254740992.)
+
+
+def square_points(n, seed):
+    # flat array of the (x,y) rows of n points in the unit square
+    random = Random(seed)
+    return array('d', (random.next() for i in range(2 * n)))
+
+
+def cube_points(n, seed):
+    # flat array of the (x,y,z) rows of n points in the cube [-1,1]^3
+    random = Random(seed)
+    return array('d', (2. * random.next() - 1. for i in range(3 * n)))
+
+
+def sphere_points(n, seed):
+    # flat array of n points close to the unit sphere
+    random = Random(seed)
+    coordinates = array('d')
+    for i in range(n):
+        z = 2. * random.next() - 1.
+        phi = 2. * math.pi * random.next()
+        radius = 1. + 0.01 * (random.next() - 0.5)
+        r = radius * math.sqrt(1. - z * z)
+        coordinates.extend((r * math.cos(phi), r * math.sin(phi), radius * z))
+    return coordinates
+
+
+def bench(package, name, setup, run):
+    # best time of `repeat` runs of run(state), state being made again by
+    # setup() (not timed) before each run; returns the state of the last run
+    best = float('inf')
+    for i in range(repeat):
+        state = setup()
+        start = time.perf_counter()
+        run(state)
+        best = min(best, time.perf_counter() - start)
+    print("BENCH", package, name, best)
+    sys.stdout.flush()
+    return state
+
+
+def reset_peak_rss():
+    # resets the peak resident set size of the process to its current one,
+    # False if not supported
+    try:
+        with open('/proc/self/clear_refs', 'w') as clear_refs:
+            clear_refs.write('5')
+        return True
+    except (IOError, OSError):
+        return False
+
+
+def peak_rss():
+    # peak resident set size of the process in bytes (VmHWM) since it was
+    # last reset, 0 if unknown
+    try:
+        with open('/proc/self/status') as status:
+            for line in status:
+                if line.startswith('VmHWM:'):
+                    return int(line.split()[1]) * 1024
+    except IOError:
+        pass
+    return 0
+
+
+def memory(package, name, usage):
+    # `usage` is the Memory_usage of the structure built by the case
+    print("MEMORY", package, name, usage.total())
+    sys.stdout.flush()
+
+
+def bench_point_set_processing():
+    from CGAL.CGAL_Point_set_3 import Point_set_3
+    from CGAL.CGAL_Point_set_processing_3 import compute_average_spacing
+    from CGAL.CGAL_Point_set_processing_3 import jet_estimate_normals
+
+    points = sphere_points(number_of_points, 1)
+    bench("Point_set_processing_3", "compute_average_spacing",
+          lambda: Point_set_3.from_arrays(points),
+          lambda ps: compute_average_spacing(ps, 6))
+    ps = bench("Point_set_processing_3", "jet_estimate_normals",
+               lambda: Point_set_3.from_arrays(points),
+               lambda ps: jet_estimate_normals(ps, 12))
+    memory("Point_set_processing_3", "jet_estimate_normals", ps.memory_usage())
+
+
+def bench_aabb_tree():
+    from CGAL.CGAL_Kernel import Point_3
+    from CGAL.CGAL_Polyhedron_3 import Polyhedron_3
+    from CGAL.CGAL_AABB_tree import AABB_tree_Polyhedron_3_Facet_handle
+
+    P = Polyhedron_3(datadir + '/elephant.off')
+    queries = cube_points(number_of_queries, 2)
+
+    def build(state):
+        tree = AABB_tree_Polyhedron_3_Facet_handle(P.facets())
+        tree.prepare()
+    bench("AABB_tree", "build", lambda: None, build)
+
+    tree = AABB_tree_Polyhedron_3_Facet_handle(P.facets())
+    tree.prepare()
+    memory("AABB_tree", "build", tree.memory_usage())
+
+    def closest_point_loop(state):
+        total = 0.
+        for i in range(0, len(queries), 3):
+            total += tree.closest_point(Point_3(queries[i], queries[i + 1], queries[i + 2])).x()
+        assert math.isfinite(total)
+    bench("AABB_tree", "closest_point_loop", lambda: None, closest_point_loop)
+
+
+def bench_kd_tree():
+    from CGAL.CGAL_Kernel import Point_3
+    from CGAL.CGAL_Spatial_searching import Orthogonal_k_neighbor_search_tree_3
+    from CGAL.CGAL_Spatial_searching import Orthogonal_k_neighbor_search_3
+
+    coordinates = cube_points(number_of_points, 3)
+    points = [Point_3(coordinates[i], coordinates[i + 1], coordinates[i + 2])
+              for i in range(0, len(coordinates), 3)]
+    queries = cube_points(number_of_queries, 4)
+
+    def build(state):
+        tree = Orthogonal_k_neighbor_search_tree_3(points)
+        tree.build()
+    bench("Kd_tree", "build", lambda: None, build)
+
+    tree = Orthogonal_k_neighbor_search_tree_3(points)
+    tree.build()
+    memory("Kd_tree", "build", tree.memory_usage())
+
+    def knn_loop(state):
+        total = 0.
+        for i in range(0, len(queries), 3):
+            search = Orthogonal_k_neighbor_search_3(
+                tree, Point_3(queries[i], queries[i + 1], queries[i + 2]), 8)
+            for neighbor in search.iterator():
+                total += neighbor[1]
+        assert math.isfinite(total)
+    bench("Kd_tree", "knn_loop", lambda: None, knn_loop)
+
+
+def bench_triangulation_2():
+    from CGAL.CGAL_Triangulation_2 import Delaunay_triangulation_2
+
+    points = square_points(number_of_points, 5)
+    t = bench("Triangulation_2", "delaunay_insert", Delaunay_triangulation_2,
+              lambda t: t.insert_from_array(points))
+    memory("Triangulation_2", "delaunay_insert", t.memory_usage())
+
+
+def bench_triangulation_3():
+    from CGAL.CGAL_Triangulation_3 import Delaunay_triangulation_3
+
+    points = cube_points(number_of_points, 6)
+    t = bench("Triangulation_3", "delaunay_insert", Delaunay_triangulation_3,
+              lambda t: t.insert_from_array(points))
+    memory("Triangulation_3", "delaunay_insert", t.memory_usage())
+
+
+def bench_mesh_3():
+    from CGAL.CGAL_Polyhedron_3 import Polyhedron_3
+    from CGAL.CGAL_Mesh_3 import Polyhedral_mesh_domain_3
+    from CGAL.CGAL_Mesh_3 import Mesh_3_parameters
+    from CGAL.CGAL_Mesh_3 import Default_mesh_criteria
+    from CGAL import CGAL_Mesh_3
+
+    polyhedron = Polyhedron_3(datadir + '/elephant.off')
+    domain = Polyhedral_mesh_domain_3(polyhedron)
+    params = Mesh_3_parameters()
+    params.no_exude()
+    params.no_perturb()
+    criteria = Default_mesh_criteria()
+    criteria.facet_angle(25).facet_size(0.15).facet_distance(0.008).cell_radius_edge_ratio(3)
+
+    def make_mesh_3(state):
+        c3t3 = CGAL_Mesh_3.make_mesh_3(domain, criteria, params)
+        assert c3t3.number_of_cells() > 0
+        state.append(c3t3)
+    c3t3 = bench("Mesh_3", "make_mesh_3", list, make_mesh_3)[0]
+    memory("Mesh_3", "make_mesh_3", c3t3.memory_usage())
+
+
+def bench_polygon_mesh_processing():
+    from CGAL.CGAL_Polyhedron_3 import Polyhedron_3
+    from CGAL import CGAL_Polygon_mesh_processing
+
+    def setup():
+        P = Polyhedron_3(datadir + '/elephant.off')
+        return P, list(P.facets())
+    P = bench("Polygon_mesh_processing", "isotropic_remeshing", setup,
+              lambda state: CGAL_Polygon_mesh_processing.isotropic_remeshing(state[1], 0.02, state[0], 1))[0]
+    memory("Polygon_mesh_processing", "isotropic_remeshing", P.memory_usage())
+
+
+def bench_classification():
+    from CGAL.CGAL_Point_set_3 import Point_set_3
+    from CGAL.CGAL_Classification import Feature_set
+    from CGAL.CGAL_Classification import Point_set_feature_generator
+    from CGAL.CGAL_Classification import POINT_BASED_FEATURES
+
+    points = Point_set_3(datadir + '/b9_training.ply')
+
+    def generate_point_based_features(state):
+        features = Feature_set()
+        generator = Point_set_feature_generator(points, 5)
+        generator.generate_features(features, POINT_BASED_FEATURES)
+        state.append(features)
+    features = bench("Classification", "generate_point_based_features", list,
+                     generate_point_based_features)[0]
+    memory("Classification", "generate_point_based_features", features.memory_usage(points.number_of_points()))
+
+
+def write_pipeline_input(filename):
+    # writes the tiles of b9_training.ply translated side by side in the xy
+    # plane as a binary PLY file, and returns their average spacing
+    from CGAL.CGAL_Point_set_3 import Point_set_3
+    from CGAL.CGAL_Point_set_processing_3 import compute_average_spacing
+
+    tile = Point_set_3(datadir + '/b9_training.ply')
+    coordinates = tile.point_array()
+    n = tile.size()
+    extent = [max(coordinates[i, c] for i in range(n)) - min(coordinates[i, c] for i in range(n))
+              for c in (0, 1)]
+    scaled = Point_set_3()
+    for tx in range(pipeline_tiles):
+        for ty in range(pipeline_tiles):
+            copy = Point_set_3(datadir + '/b9_training.ply')
+            coordinates = copy.point_array()
+            for i in range(n):
+                coordinates[i, 0] += tx * extent[0]
+                coordinates[i, 1] += ty * extent[1]
+            scaled.join(copy)
+    if not scaled.write(filename):
+        raise IOError("Cannot write " + filename)
+    return compute_average_spacing(scaled, 6)
+
+
+def bench_pipeline():
+    # A LiDAR workflow from a PLY file to a classified point set and a
+    # surface, each stage working on the output of the previous one: the
+    # best time of each stage over the runs is reported, as the case <stage>
+    # of the package
+    from CGAL.CGAL_Point_set_3 import Point_set_3
+    from CGAL.CGAL_Point_set_processing_3 import remove_outliers
+    from CGAL.CGAL_Point_set_processing_3 import grid_simplify_point_set
+    from CGAL.CGAL_Point_set_processing_3 import jet_estimate_normals
+    from CGAL.CGAL_Point_set_processing_3 import mst_orient_normals
+    from CGAL.CGAL_Shape_detection import region_growing
+    from CGAL.CGAL_Classification import Label_set
+    from CGAL.CGAL_Classification import Feature_set
+    from CGAL.CGAL_Classification import Point_set_feature_generator
+    from CGAL.CGAL_Classification import POINT_BASED_FEATURES
+    from CGAL.CGAL_Classification import ETHZ_Random_forest_classifier
+    from CGAL.CGAL_Classification import classify_with_graphcut
+    from CGAL.CGAL_Polyhedron_3 import Polyhedron_3
+    from CGAL.CGAL_Advancing_front_surface_reconstruction import advancing_front_surface_reconstruction
+
+    filename = 'pipeline_input.ply'
+    spacing = write_pipeline_input(filename)
+    stages = []
+    best = {}
+    rss = {}
+    for run in range(repeat):
+        def stage(name, function):
+            measure_rss = run == 0 and reset_peak_rss()
+            start = time.perf_counter()
+            result = function()
+            elapsed = time.perf_counter() - start
+            if run == 0:
+                stages.append(name)
+                best[name] = elapsed
+                rss[name] = peak_rss() if measure_rss else 0
+            else:
+                best[name] = min(best[name], elapsed)
+            return result
+
+        points = Point_set_3()
+        stage("read_ply", lambda: points.read(filename))
+
+        def remove(function, *args):
+            function(points, *args)
+            points.collect_garbage()
+        stage("remove_outliers", lambda: remove(remove_outliers, 24, 0., 2.))
+        stage("grid_simplify_point_set", lambda: remove(grid_simplify_point_set, spacing))
+        stage("jet_estimate_normals", lambda: jet_estimate_normals(points, 12))
+        stage("mst_orient_normals", lambda: remove(mst_orient_normals, 12))
+        stage("region_growing", lambda: region_growing(points, points.add_int_map("plane_index"),
+                                                       min_points=20, k=12))
+
+        labels = Label_set()
+        for name in ("ground", "vegetation", "building"):
+            labels.add(name)
+        features = Feature_set()
+
+        def generate_point_based_features():
+            generator = Point_set_feature_generator(points, 5)
+            generator.generate_features(features, POINT_BASED_FEATURES)
+            return generator
+        generator = stage("generate_point_based_features", generate_point_based_features)
+        classifier = ETHZ_Random_forest_classifier(labels, features)
+        stage("train_random_forest",
+              lambda: classifier.train_from_array(points.property_array(points.int_map("label")), True, 25, 20))
+        stage("classify_with_graphcut",
+              lambda: classify_with_graphcut(points, labels, classifier,
+                                             generator.neighborhood().k_neighbor_query(6), 0.5, 12,
+                                             points.add_int_map("classification")))
+        P = Polyhedron_3()
+        stage("advancing_front_surface_reconstruction",
+              lambda: advancing_front_surface_reconstruction(points, P))
+        assert P.size_of_facets() > 0
+    for name in stages:
+        print("BENCH Pipeline", name, best[name])
+        if rss[name] > 0:
+            print("RSS Pipeline", name, rss[name])
+    sys.stdout.flush()
+    os.remove(filename)
+
+
+benchmarks = [("Point_set_processing_3", bench_point_set_processing),
+              ("AABB_tree", bench_aabb_tree),
+              ("Kd_tree", bench_kd_tree),
+              ("Triangulation_2", bench_triangulation_2),
+              ("Triangulation_3", bench_triangulation_3),
+              ("Mesh_3", bench_mesh_3),
+              ("Polygon_mesh_processing", bench_polygon_mesh_processing),
+              ("Classification", bench_classification),
+              ("Pipeline", bench_pipeline)]
+
+repeat = 3
+packages = []
+args = sys.argv[1:]
+while args:
+    arg = args.pop(0)
+    if arg == "--repeat" and args:
+        repeat = max(1, int(args.pop(0)))
+    else:
+        packages.append(arg)
+
+for package, function in benchmarks:
+    if packages and package not in packages:
+        continue
+    try:
+        function()
+    except ImportError as e:
+        print("SKIP", package, e)
@@ -0,0 +1,140 @@
+# Runs the native, Python and Java benchmarks of a set of packages and
+# reports their times side by side, with the overhead of the bindings as
+# the ratio of their time to the native one, followed by the memory used by
+# the structures built by the bindings (the MEMORY lines of their runs) and
+# the peak resident set size of the processes during each stage of the
+# Pipeline package (their RSS lines).
+#
+# usage: python compare_benchmarks.py [--native EXE] [--python] [--java DIR]
+#                                     [--repeat N] [--max-overhead R] [package...]
+#   --native EXE       runs native_benchmarks EXE
+#   --python           runs benchmarks.py with this interpreter
+#   --java DIR         runs the Benchmarks class compiled in DIR
+#   --max-overhead R   fails if a binding is more than R times slower than
+#                      the native code on a case
+# The Python and Java runs use the environment (PYTHONPATH, LD_LIBRARY_PATH,
+# DATADIR) of this script.
+
+from __future__ import print_function
+
+import os
+import subprocess
+import sys
+
+here = os.path.dirname(os.path.abspath(__file__))
+
+
+def run(command, cwd=None):
+    # times of the "BENCH <package> <case> <seconds>" lines printed by command,
+    # and bytes of its "MEMORY <package> <case> <bytes>" and
+    # "RSS <package> <case> <bytes>" lines
+    print("Running", " ".join(command))
+    sys.stdout.flush()
+    process = subprocess.run(command, cwd=cwd, stdout=subprocess.PIPE, universal_newlines=True)
+    times = {}
+    memory = {}
+    rss = {}
+    for line in process.stdout.splitlines():
+        words = line.split()
+        if len(words) == 4 and words[0] == "BENCH":
+            times[(words[1], words[2])] = float(words[3])
+        elif len(words) == 4 and words[0] == "MEMORY":
+            memory[(words[1], words[2])] = int(words[3])
+        elif len(words) == 4 and words[0] == "RSS":
+            rss[(words[1], words[2])] = int(words[3])
+        elif words and words[0] == "SKIP":
+            print(line)
+    if process.returncode != 0:
+        print("Error:", command[0], "exited with code", process.returncode)
+    return times, memory, rss, process.returncode == 0
+
+
+def print_memory(title, columns):
+    # a table of bytes, in MB, of the (name, bytes per case) columns having
+    # bytes
+    columns = [(name, memory) for name, memory in columns if memory]
+    if not columns:
+        return
+    cases = sorted(set(case for name, memory in columns for case in memory))
+    header = "%-24s %-32s" % ("package", "case")
+    for name, memory in columns:
+        header += " %12s" % (name + " (MB)")
+    print()
+    print(title)
+    print(header)
+    for case in cases:
+        line = "%-24s %-32s" % case
+        for name, memory in columns:
+            line += " %12s" % ("%.2f" % (memory[case] / 1e6) if case in memory else "-")
+        print(line)
+
+
+def main(args):
+    native = None
+    python = False
+    java = None
+    repeat = "3"
+    max_overhead = None
+    packages = []
+    while args:
+        arg = args.pop(0)
+        if arg == "--native" and args:
+            native = args.pop(0)
+        elif arg == "--python":
+            python = True
+        elif arg == "--java" and args:
+            java = args.pop(0)
+        elif arg == "--repeat" and args:
+            repeat = args.pop(0)
+        elif arg == "--max-overhead" and args:
+            max_overhead = float(args.pop(0))
+        else:
+            packages.append(arg)
+
+    columns = []
+    success = True
+    if native:
+        times, memory, rss, ok = run([native, "--repeat", repeat] + packages)
+        columns.append(("native", times, memory, rss))
+        success = success and ok
+    if python:
+        times, memory, rss, ok = run([sys.executable, os.path.join(here, "benchmarks.py"), "--repeat", repeat] + packages)
+        columns.append(("python", times, memory, rss))
+        success = success and ok
+    if java:
+        times, memory, rss, ok = run(["java", "-cp", java, "Benchmarks", "--repeat", repeat] + packages, cwd=java)
+        columns.append(("java", times, memory, rss))
+        success = success and ok
+
+    cases = sorted(set(case for name, times, memory, rss in columns for case in times))
+    native_times = dict((column[0], column[1]) for column in columns).get("native", {})
+    header = "%-24s %-32s" % ("package", "case")
+    for name, times, memory, rss in columns:
+        header += " %12s" % (name + " (s)")
+    for name, times, memory, rss in columns:
+        if name != "native" and native_times:
+            header += " %14s" % (name + "/native")
+    print(header)
+    for case in cases:
+        line = "%-24s %-32s" % case
+        for name, times, memory, rss in columns:
+            line += " %12s" % ("%.4f" % times[case] if case in times else "-")
+        for name, times, memory, rss in columns:
+            if name == "native" or not native_times:
+                continue
+            if case not in times or not native_times.get(case):
+                line += " %14s" % "-"
+                continue
+            overhead = times[case] / native_times[case]
+            line += " %14s" % ("%.2f" % overhead)
+            if max_overhead is not None and overhead > max_overhead:
+                print("Error: %s %s is %.2f times slower in %s than in C++" % (case[0], case[1], overhead, name))
+                success = False
+        print(line)
+    print_memory("memory of the structures", [(name, memory) for name, times, memory, rss in columns])
+    print_memory("peak RSS during the stage", [(name, rss) for name, times, memory, rss in columns])
+    return 0 if success else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))
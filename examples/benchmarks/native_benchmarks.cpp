@@ -0,0 +1,588 @@
+// ------------------------------------------------------------------------------
+// Copyright (c) 2024 GeometryFactory (FRANCE)
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+// ------------------------------------------------------------------------------
+
+// Native C++ counterpart of benchmarks.py and Benchmarks.java: the same cases,
+// on the same inputs and with the CGAL types instantiated by the bindings, so
+// that compare_benchmarks.py can report the overhead of the wrappers.
+//
+// usage: native_benchmarks [--data DIR] [--repeat N] [package...]
+// Each case prints one line "BENCH <package> <case> <seconds>", the seconds
+// being the best time of the N repetitions. The stages of the Pipeline
+// package also print "RSS Pipeline <stage> <bytes>", the peak resident set
+// size of the process during the stage in its first run (Linux 4.0 or later,
+// whose peak can be reset).
+
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+
+#include <CGAL/Point_set_3.h>
+#include <CGAL/Point_set_3/IO.h>
+#include <CGAL/compute_average_spacing.h>
+#include <CGAL/jet_estimate_normals.h>
+#include <CGAL/remove_outliers.h>
+#include <CGAL/grid_simplify_point_set.h>
+#include <CGAL/mst_orient_normals.h>
+
+#include <CGAL/Polyhedron_3.h>
+#include <CGAL/Polyhedron_items_with_id_3.h>
+#include <CGAL/IO/Polyhedron_iostream.h>
+
+#include <CGAL/AABB_tree.h>
+#if CGAL_VERSION_NR >= 1060000000
+#include <CGAL/AABB_traits_3.h>
+#else
+#include <CGAL/AABB_traits.h>
+#endif
+#include <CGAL/AABB_face_graph_triangle_primitive.h>
+
+#include <CGAL/Search_traits_3.h>
+#include <CGAL/Orthogonal_k_neighbor_search.h>
+
+#include <CGAL/Delaunay_triangulation_2.h>
+#include <CGAL/Delaunay_triangulation_3.h>
+
+#include <CGAL/Mesh_triangulation_3.h>
+#include <CGAL/Mesh_complex_3_in_triangulation_3.h>
+#include <CGAL/Mesh_criteria_3.h>
+#include <CGAL/Polyhedral_mesh_domain_3.h>
+#include <CGAL/make_mesh_3.h>
+
+#include <CGAL/Polygon_mesh_processing/remesh.h>
+
+#include <CGAL/Classification.h>
+
+#if CGAL_VERSION_NR >= 1050600000
+#include <CGAL/Shape_detection/Region_growing/Region_growing.h>
+#include <CGAL/Shape_detection/Region_growing/Point_set.h>
+#endif
+#include <CGAL/Advancing_front_surface_reconstruction.h>
+
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <memory>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel                  EPIC_Kernel;
+typedef EPIC_Kernel::Point_2                                                 Point_2;
+typedef EPIC_Kernel::Point_3                                                 Point_3;
+
+#ifdef CGAL_LINKED_WITH_TBB
+typedef CGAL::Parallel_tag                                                   Concurrency_tag;
+#else
+typedef CGAL::Sequential_tag                                                 Concurrency_tag;
+#endif
+
+typedef CGAL::Point_set_3<Point_3>                                           Point_set;
+typedef CGAL::Polyhedron_3<EPIC_Kernel, CGAL::Polyhedron_items_with_id_3>    Polyhedron;
+
+typedef CGAL::AABB_face_graph_triangle_primitive<Polyhedron>                 AABB_primitive;
+#if CGAL_VERSION_NR >= 1060000000
+typedef CGAL::AABB_traits_3<EPIC_Kernel, AABB_primitive>                     AABB_traits;
+#else
+typedef CGAL::AABB_traits<EPIC_Kernel, AABB_primitive>                       AABB_traits;
+#endif
+typedef CGAL::AABB_tree<AABB_traits>                                         AABB_tree;
+
+typedef CGAL::Search_traits_3<EPIC_Kernel>                                   Search_traits;
+typedef CGAL::Orthogonal_k_neighbor_search<Search_traits>                    K_neighbor_search;
+typedef K_neighbor_search::Tree                                              Kd_tree;
+
+typedef CGAL::Delaunay_triangulation_2<EPIC_Kernel>                          DT2;
+typedef CGAL::Delaunay_triangulation_3<EPIC_Kernel>                          DT3;
+
+typedef CGAL::Polyhedral_mesh_domain_3<Polyhedron, EPIC_Kernel>              Mesh_domain;
+#ifdef CGAL_LINKED_WITH_TBB
+typedef CGAL::Mesh_triangulation_3<Mesh_domain, CGAL::Default, CGAL::Parallel_tag>::type Mesh_triangulation;
+#else
+typedef CGAL::Mesh_triangulation_3<Mesh_domain>::type                        Mesh_triangulation;
+#endif
+typedef CGAL::Mesh_complex_3_in_triangulation_3<Mesh_triangulation>          C3T3;
+typedef CGAL::Mesh_criteria_3<Mesh_triangulation>                            Mesh_criteria;
+
+typedef CGAL::Classification::Point_set_feature_generator
+<EPIC_Kernel, Point_set, Point_set::Point_map>                               Feature_generator;
+typedef CGAL::Classification::ETHZ::Random_forest_classifier                 Random_forest;
+
+#if CGAL_VERSION_NR >= 1050600000
+typedef CGAL::Shape_detection::Point_set::K_neighbor_query_for_point_set<Point_set> RG_query;
+typedef CGAL::Shape_detection::Point_set::Least_squares_plane_fit_region_for_point_set<Point_set> RG_region;
+typedef CGAL::Shape_detection::Region_growing<RG_query, RG_region>          Region_growing;
+#endif
+
+namespace {
+
+// Sizes of the synthetic inputs, the same in the three implementations
+const std::size_t number_of_points = 100000;
+const std::size_t number_of_queries = 10000;
+// the Pipeline package runs on pipeline_tiles x pipeline_tiles copies of
+// b9_training.ply side by side
+const int pipeline_tiles = 3;
+
+// Pseudo-random numbers in [0,1) of a 64-bit linear congruential generator,
+// so that the Python and Java benchmarks use the same synthetic inputs
+class Random
+{
+  std::uint64_t state;
+public:
+  Random (std::uint64_t seed) : state (seed) { }
+  double next()
+  {
+    state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+    return double(state >> 11) * (1. / 9007199254740992.);
+  }
+};
+
+// (x,y) rows of n points in the unit square
+std::vector<Point_2> square_points (std::size_t n, std::uint64_t seed)
+{
+  Random random (seed);
+  std::vector<Point_2> points;
+  points.reserve (n);
+  for (std::size_t i = 0; i < n; ++ i)
+  {
+    double x = random.next();
+    double y = random.next();
+    points.push_back (Point_2 (x, y));
+  }
+  return points;
+}
+
+// n points in the cube [-1,1]^3
+std::vector<Point_3> cube_points (std::size_t n, std::uint64_t seed)
+{
+  Random random (seed);
+  std::vector<Point_3> points;
+  points.reserve (n);
+  for (std::size_t i = 0; i < n; ++ i)
+  {
+    double x = 2. * random.next() - 1.;
+    double y = 2. * random.next() - 1.;
+    double z = 2. * random.next() - 1.;
+    points.push_back (Point_3 (x, y, z));
+  }
+  return points;
+}
+
+// n points close to the unit sphere
+std::vector<Point_3> sphere_points (std::size_t n, std::uint64_t seed)
+{
+  Random random (seed);
+  std::vector<Point_3> points;
+  points.reserve (n);
+  for (std::size_t i = 0; i < n; ++ i)
+  {
+    double z = 2. * random.next() - 1.;
+    double phi = 2. * CGAL_PI * random.next();
+    double radius = 1. + 0.01 * (random.next() - 0.5);
+    double r = radius * std::sqrt (1. - z * z);
+    points.push_back (Point_3 (r * std::cos (phi), r * std::sin (phi), radius * z));
+  }
+  return points;
+}
+
+struct Options
+{
+  std::string datadir = "../data";
+  int repeat = 3;
+};
+
+// best time of `repeat` runs of `run(state)`, `state` being made again by
+// `setup()` (not timed) before each run
+template <class Setup, class Run>
+void bench (const Options& options, const char* package, const char* name,
+            Setup setup, Run run)
+{
+  double best = std::numeric_limits<double>::max();
+  for (int i = 0; i < options.repeat; ++ i)
+  {
+    auto state = setup();
+    auto start = std::chrono::steady_clock::now();
+    run (state);
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    best = (std::min)(best, elapsed.count());
+  }
+  std::cout << "BENCH " << package << " " << name << " " << best << std::endl;
+}
+
+// resets the peak resident set size of the process to its current one,
+// false if not supported
+bool reset_peak_rss()
+{
+  std::ofstream clear_refs ("/proc/self/clear_refs");
+  clear_refs << "5";
+  clear_refs.close();
+  return bool(clear_refs);
+}
+
+// peak resident set size of the process in bytes (VmHWM) since it was last
+// reset, 0 if unknown
+std::size_t peak_rss()
+{
+  std::ifstream status ("/proc/self/status");
+  std::string line;
+  while (std::getline (status, line))
+    if (line.compare (0, 6, "VmHWM:") == 0)
+    {
+      std::istringstream fields (line.substr (6));
+      std::size_t kb = 0;
+      fields >> kb;
+      return kb * 1024;
+    }
+  return 0;
+}
+
+Polyhedron read_polyhedron (const std::string& filename)
+{
+  Polyhedron P;
+  std::ifstream in (filename);
+  if (!in || !(in >> P))
+    throw std::runtime_error ("Cannot read " + filename);
+  CGAL::set_halfedgeds_items_id (P);
+  return P;
+}
+
+Point_set read_point_set (const std::string& filename)
+{
+  Point_set ps;
+  std::ifstream in (filename, std::ios::binary);
+  if (!in || !(in >> ps) || ps.empty())
+    throw std::runtime_error ("Cannot read " + filename);
+  return ps;
+}
+
+void bench_point_set_processing (const Options& options)
+{
+  const std::vector<Point_3> points = sphere_points (number_of_points, 1);
+  auto make_point_set = [&]()
+  {
+    Point_set ps;
+    ps.reserve (points.size());
+    for (const Point_3& p : points)
+      ps.insert (p);
+    return ps;
+  };
+  bench (options, "Point_set_processing_3", "compute_average_spacing", make_point_set,
+         [](Point_set& ps) { CGAL::compute_average_spacing<Concurrency_tag> (ps, 6); });
+  bench (options, "Point_set_processing_3", "jet_estimate_normals", make_point_set,
+         [](Point_set& ps)
+         {
+           ps.add_normal_map();
+           CGAL::jet_estimate_normals<Concurrency_tag>
+             (ps, 12, ps.parameters().degree_fitting (2));
+         });
+}
+
+void bench_aabb_tree (const Options& options)
+{
+  const Polyhedron P = read_polyhedron (options.datadir + "/elephant.off");
+  const std::vector<Point_3> queries = cube_points (number_of_queries, 2);
+  bench (options, "AABB_tree", "build", [&]() { return 0; },
+         [&](int)
+         {
+           AABB_tree tree (faces (P).first, faces (P).second, P);
+           tree.build();
+           tree.accelerate_distance_queries();
+         });
+  AABB_tree tree (faces (P).first, faces (P).second, P);
+  tree.build();
+  tree.accelerate_distance_queries();
+  bench (options, "AABB_tree", "closest_point_loop", [&]() { return 0; },
+         [&](int)
+         {
+           double sum = 0;
+           for (const Point_3& q : queries)
+             sum += tree.closest_point (q).x();
+           if (!std::isfinite (sum))
+             throw std::runtime_error ("Invalid closest point");
+         });
+}
+
+void bench_kd_tree (const Options& options)
+{
+  const std::vector<Point_3> points = cube_points (number_of_points, 3);
+  const std::vector<Point_3> queries = cube_points (number_of_queries, 4);
+  bench (options, "Kd_tree", "build", [&]() { return 0; },
+         [&](int)
+         {
+           Kd_tree tree (points.begin(), points.end());
+           tree.build();
+         });
+  Kd_tree tree (points.begin(), points.end());
+  tree.build();
+  bench (options, "Kd_tree", "knn_loop", [&]() { return 0; },
+         [&](int)
+         {
+           double sum = 0;
+           for (const Point_3& q : queries)
+           {
+             K_neighbor_search search (tree, q, 8);
+             for (const auto& neighbor : search)
+               sum += neighbor.second;
+           }
+           if (!std::isfinite (sum))
+             throw std::runtime_error ("Invalid distance");
+         });
+}
+
+void bench_triangulation_2 (const Options& options)
+{
+  const std::vector<Point_2> points = square_points (number_of_points, 5);
+  bench (options, "Triangulation_2", "delaunay_insert", [&]() { return DT2(); },
+         [&](DT2& t) { t.insert (points.begin(), points.end()); });
+}
+
+void bench_triangulation_3 (const Options& options)
+{
+  const std::vector<Point_3> points = cube_points (number_of_points, 6);
+  bench (options, "Triangulation_3", "delaunay_insert", [&]() { return DT3(); },
+         [&](DT3& t) { t.insert (points.begin(), points.end()); });
+}
+
+void bench_mesh_3 (const Options& options)
+{
+  Polyhedron P = read_polyhedron (options.datadir + "/elephant.off");
+  Mesh_domain domain (P);
+  Mesh_criteria criteria (CGAL::parameters::facet_angle (25).facet_size (0.15)
+                          .facet_distance (0.008).cell_radius_edge_ratio (3));
+  bench (options, "Mesh_3", "make_mesh_3", [&]() { return 0; },
+         [&](int)
+         {
+           C3T3 c3t3 = CGAL::make_mesh_3<C3T3> (domain, criteria,
+                                                CGAL::parameters::no_perturb().no_exude());
+           if (c3t3.number_of_cells() == 0)
+             throw std::runtime_error ("Empty mesh");
+         });
+}
+
+void bench_polygon_mesh_processing (const Options& options)
+{
+  const Polyhedron P = read_polyhedron (options.datadir + "/elephant.off");
+  bench (options, "Polygon_mesh_processing", "isotropic_remeshing",
+         [&]() { return Polyhedron (P); },
+         [](Polyhedron& Q)
+         {
+           std::vector<Polyhedron::Facet_handle> selection (Q.facets_begin(), Q.facets_end());
+           CGAL::Polygon_mesh_processing::isotropic_remeshing
+             (selection, 0.02, Q, CGAL::Polygon_mesh_processing::parameters::number_of_iterations (1));
+         });
+}
+
+void bench_classification (const Options& options)
+{
+  const Point_set points = read_point_set (options.datadir + "/b9_training.ply");
+  bench (options, "Classification", "generate_point_based_features", [&]() { return 0; },
+         [&](int)
+         {
+           CGAL::Classification::Feature_set features;
+           Feature_generator generator (points, points.point_map(), 5);
+           features.begin_parallel_additions();
+           generator.generate_point_based_features (features);
+           features.end_parallel_additions();
+         });
+}
+
+#if CGAL_VERSION_NR >= 1050600000
+// Writes the tiles of b9_training.ply translated side by side in the xy
+// plane as a binary PLY file, and returns their average spacing
+double write_pipeline_input (const Options& options, const std::string& filename)
+{
+  const Point_set tile = read_point_set (options.datadir + "/b9_training.ply");
+  const CGAL::Bbox_3 bbox = CGAL::bbox_3 (tile.points().begin(), tile.points().end());
+  Point_set scaled;
+  for (int tx = 0; tx < pipeline_tiles; ++ tx)
+    for (int ty = 0; ty < pipeline_tiles; ++ ty)
+    {
+      Point_set copy (tile);
+      const EPIC_Kernel::Vector_3 translation (tx * (bbox.xmax() - bbox.xmin()), ty * (bbox.ymax() - bbox.ymin()), 0);
+      for (Point_set::Index i : copy)
+        copy.point (i) = copy.point (i) + translation;
+      scaled.join (copy);
+    }
+  std::ofstream out (filename, std::ios::binary);
+  if (!out || !CGAL::IO::write_PLY (out, scaled, CGAL::parameters::use_binary_mode (true)))
+    throw std::runtime_error ("Cannot write " + filename);
+  return CGAL::compute_average_spacing<Concurrency_tag> (scaled, 6);
+}
+#endif
+
+// A LiDAR workflow from a PLY file to a classified point set and a surface,
+// each stage working on the output of the previous one: the best time of
+// each stage over the runs is reported, as the case <stage> of the package
+void bench_pipeline (const Options& options)
+{
+#if CGAL_VERSION_NR >= 1050600000
+  const std::string filename = "pipeline_input.ply";
+  const double spacing = write_pipeline_input (options, filename);
+  std::vector<std::string> stages;
+  std::map<std::string, double> best;
+  std::map<std::string, std::size_t> rss;
+  for (int run = 0; run < options.repeat; ++ run)
+  {
+    auto stage = [&](const char* name, const std::function<void()>& function)
+    {
+      const bool measure_rss = run == 0 && reset_peak_rss();
+      auto start = std::chrono::steady_clock::now();
+      function();
+      std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+      if (run == 0)
+      {
+        stages.push_back (name);
+        best[name] = elapsed.count();
+        rss[name] = measure_rss ? peak_rss() : 0;
+      }
+      else
+        best[name] = (std::min)(best[name], elapsed.count());
+    };
+
+    Point_set points;
+    stage ("read_ply", [&]() { points = read_point_set (filename); });
+    stage ("remove_outliers", [&]()
+    {
+      points.remove (CGAL::remove_outliers<Concurrency_tag>
+                     (points, 24, points.parameters().threshold_percent (2.)), points.end());
+      points.collect_garbage();
+    });
+    stage ("grid_simplify_point_set", [&]()
+    {
+      points.remove (CGAL::grid_simplify_point_set (points, spacing), points.end());
+      points.collect_garbage();
+    });
+    stage ("jet_estimate_normals", [&]()
+    {
+      points.add_normal_map();
+      CGAL::jet_estimate_normals<Concurrency_tag> (points, 12);
+    });
+    stage ("mst_orient_normals", [&]()
+    {
+      points.remove (CGAL::mst_orient_normals (points, 12), points.end());
+      points.collect_garbage();
+    });
+    stage ("region_growing", [&]()
+    {
+      const CGAL::Bbox_3 bbox = CGAL::bbox_3 (points.points().begin(), points.points().end());
+      const double diagonal = std::sqrt (CGAL::square (bbox.xmax() - bbox.xmin())
+                                         + CGAL::square (bbox.ymax() - bbox.ymin())
+                                         + CGAL::square (bbox.zmax() - bbox.zmin()));
+      RG_query query = CGAL::Shape_detection::Point_set::make_k_neighbor_query
+        (points, CGAL::parameters::k_neighbors (12));
+      RG_region region = CGAL::Shape_detection::Point_set::make_least_squares_plane_fit_region
+        (points, CGAL::parameters::maximum_distance (0.01 * diagonal)
+                 .maximum_angle (180 * std::acos (0.9) / CGAL_PI).minimum_region_size (20));
+      Region_growing region_growing (points, query, region);
+      Point_set::Property_map<int> plane_map = points.add_property_map<int> ("plane_index", -1).first;
+      int plane = 0;
+      std::vector<Region_growing::Primitive_and_region> regions;
+      region_growing.detect (std::back_inserter (regions));
+      for (const auto& primitive_and_region : regions)
+      {
+        for (Point_set::Index i : primitive_and_region.second)
+          plane_map[i] = plane;
+        ++ plane;
+      }
+    });
+    CGAL::Classification::Label_set labels;
+    labels.add ("ground");
+    labels.add ("vegetation");
+    labels.add ("building");
+    CGAL::Classification::Feature_set features;
+    std::unique_ptr<Feature_generator> generator;
+    stage ("generate_point_based_features", [&]()
+    {
+      generator.reset (new Feature_generator (points, points.point_map(), 5));
+      features.begin_parallel_additions();
+      generator->generate_point_based_features (features);
+      features.end_parallel_additions();
+    });
+    Random_forest classifier (labels, features);
+    stage ("train_random_forest", [&]()
+    {
+      const Point_set::Property_map<int> ground_truth = points.property_map<int> ("label").first;
+      classifier.train<Concurrency_tag> (points.range (ground_truth), true, 25, 20);
+    });
+    stage ("classify_with_graphcut", [&]()
+    {
+      std::vector<int> classification (points.size(), -1);
+      CGAL::Classification::classify_with_graphcut<Concurrency_tag>
+        (points, points.point_map(), labels, classifier,
+         generator->neighborhood().k_neighbor_query (6), 0.5, 12, classification);
+    });
+    stage ("advancing_front_surface_reconstruction", [&]()
+    {
+      std::vector<std::array<std::size_t, 3> > facets;
+      CGAL::advancing_front_surface_reconstruction (points.points().begin(), points.points().end(),
+                                                    std::back_inserter (facets));
+      if (facets.empty())
+        throw std::runtime_error ("Empty reconstruction");
+    });
+  }
+  for (const std::string& name : stages)
+  {
+    std::cout << "BENCH Pipeline " << name << " " << best[name] << std::endl;
+    if (rss[name] > 0)
+      std::cout << "RSS Pipeline " << name << " " << rss[name] << std::endl;
+  }
+  std::remove (filename.c_str());
+#else
+  (void)options;
+  std::cout << "SKIP Pipeline needs CGAL 5.6 or later" << std::endl;
+#endif
+}
+
+} // end anonymous namespace
+
+int main (int argc, char** argv)
+{
+  Options options;
+  std::set<std::string> packages;
+  for (int i = 1; i < argc; ++ i)
+  {
+    const std::string arg = argv[i];
+    if (arg == "--data" && i + 1 < argc)
+      options.datadir = argv[++ i];
+    else if (arg == "--repeat" && i + 1 < argc)
+      options.repeat = (std::max)(1, std::atoi (argv[++ i]));
+    else
+      packages.insert (arg);
+  }
+  if (const char* datadir = std::getenv ("DATADIR"))
+    if (options.datadir == "../data")
+      options.datadir = datadir;
+
+  auto selected = [&](const char* package)
+  {
+    return packages.empty() || packages.count (package) != 0;
+  };
+
+  try
+  {
+    if (selected ("Point_set_processing_3"))  bench_point_set_processing (options);
+    if (selected ("AABB_tree"))               bench_aabb_tree (options);
+    if (selected ("Kd_tree"))                 bench_kd_tree (options);
+    if (selected ("Triangulation_2"))         bench_triangulation_2 (options);
+    if (selected ("Triangulation_3"))         bench_triangulation_3 (options);
+    if (selected ("Mesh_3"))                  bench_mesh_3 (options);
+    if (selected ("Polygon_mesh_processing")) bench_polygon_mesh_processing (options);
+    if (selected ("Classification"))          bench_classification (options);
+    if (selected ("Pipeline"))                bench_pipeline (options);
+  }
+  catch (const std::exception& e)
+  {
+    std::cerr << "Error: " << e.what() << std::endl;
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
@@ -2,6 +2,14 @@ import CGAL.Kernel.Point_3;
 import CGAL.Kernel.Triangle_3;
 import CGAL.Kernel.Ray_3;
 import CGAL.AABB_tree.AABB_tree_Triangle_3_soup;
+import CGAL.AABB_tree.AABB_tree_indexed_Triangle_3_soup;
+import CGAL.AABB_tree.Flat_AABB_tree_3;
+import CGAL.AABB_tree.Ray_hit_batch;
+import CGAL.AABB_tree.Closest_point_batch;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.DoubleBuffer;
+import java.nio.IntBuffer;
 import java.util.Vector;
 
 
@@ -20,6 +28,9 @@ public class AABB_triangle_3_example {
 
     // constructs AABB tree
     AABB_tree_Triangle_3_soup tree = new AABB_tree_Triangle_3_soup(triangles.iterator());
+    // constructs the hierarchy and the distance query search tree now rather
+    // than at the first query
+    tree.prepare();
 
     // counts #intersections
     Ray_3 ray_query =  new Ray_3(a,b);
@@ -30,5 +41,45 @@ public class AABB_triangle_3_example {
     Point_3 closest_point = tree.closest_point(point_query);
     double sqd = tree.squared_distance(point_query);
     System.out.println("squared distance: "+ sqd);
+
+    // batched queries on (n,3) arrays, run in parallel
+    DoubleBuffer origins = ByteBuffer.allocateDirect(6*8).order(ByteOrder.nativeOrder()).asDoubleBuffer();
+    origins.put(new double[]{2,2,2, 0.1,0.1,2});
+    DoubleBuffer directions = ByteBuffer.allocateDirect(6*8).order(ByteOrder.nativeOrder()).asDoubleBuffer();
+    directions.put(new double[]{-1,-1,-1, 0,0,-1});
+    Ray_hit_batch hits = tree.first_intersection_batch(origins, directions);
+    IntBuffer ids = hits.primitive_id_array();
+    DoubleBuffer parameters = hits.parameter_array();
+    for (int q = 0; q < hits.number_of_queries(); ++q)
+      System.out.println("ray "+q+" hits primitive "+ids.get(q)+" at t = "+parameters.get(q));
+
+    Closest_point_batch closest = tree.closest_point_batch(origins);
+    System.out.println("closest primitive of first query: "+closest.primitive_id_array().get(0));
+    DoubleBuffer sq_distances = tree.squared_distance_batch(origins);
+    System.out.println("squared distance of first query: "+sq_distances.get(0));
+
+    // tree on (V,3) vertex and (F,3) vertex index arrays: the primitive id is
+    // the row of the triangle in the index array
+    DoubleBuffer vertices = ByteBuffer.allocateDirect(12*8).order(ByteOrder.nativeOrder()).asDoubleBuffer();
+    vertices.put(new double[]{1,0,0, 0,1,0, 0,0,1, 0,0,0});
+    IntBuffer faces = ByteBuffer.allocateDirect(9*4).order(ByteOrder.nativeOrder()).asIntBuffer();
+    faces.put(new int[]{0,1,2, 0,1,3, 0,3,2});
+    AABB_tree_indexed_Triangle_3_soup indexed_tree = new AABB_tree_indexed_Triangle_3_soup(vertices, faces);
+    indexed_tree.prepare();
+    System.out.println(indexed_tree.size()+" triangles, "+indexed_tree.number_of_vertices()+" vertices");
+    System.out.println("squared distance: "+ indexed_tree.squared_distance(point_query));
+    Ray_hit_batch indexed_hits = indexed_tree.first_intersection_batch(origins, directions);
+    System.out.println("first ray hits primitive "+indexed_hits.primitive_id_array().get(0));
+
+    // flat tree on the same arrays: once built it can be saved, and loaded
+    // back by mapping the file in memory
+    Flat_AABB_tree_3 flat_tree = new Flat_AABB_tree_3(vertices, faces);
+    flat_tree.build();
+    String filename = System.getProperty("java.io.tmpdir")+"/aabb_tree_example.bin";
+    flat_tree.save(filename);
+    Flat_AABB_tree_3 loaded_tree = Flat_AABB_tree_3.load(filename);
+    System.out.println(loaded_tree.size()+" triangles loaded, mapped: "+loaded_tree.is_mapped());
+    Ray_hit_batch loaded_hits = loaded_tree.first_intersection_batch(origins, directions);
+    System.out.println("first ray hits primitive "+loaded_hits.primitive_id_array().get(0));
   }
 }
@@ -6,9 +6,17 @@ import CGAL.Classification.Label;
 import CGAL.Classification.Label_set;
 import CGAL.Classification.Feature_set;
 import CGAL.Classification.Point_set_feature_generator;
+import CGAL.Classification.Feature_family;
 import CGAL.Classification.ETHZ_Random_forest_classifier;
 import CGAL.Classification.CGAL_Classification;
 import CGAL.Classification.Evaluation;
+import CGAL.Classification.Graphcut_statistics;
+import CGAL.Classification.Alpha_expansion_implementation;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.FloatBuffer;
+import java.nio.IntBuffer;
+import java.nio.LongBuffer;
 
 public class Classification_example{
   public static void main(String args[]){
@@ -34,10 +42,40 @@ public class Classification_example{
       generator.generate_normal_based_features(features, points.normal_map());
     features.end_parallel_additions();
 
+    // the families available in the point set in one call, computed in parallel
+    Feature_set families = new Feature_set();
+    generator.generate_features(families);
+    if (families.size() < features.size())
+      throw new AssertionError("Unexpected number of features");
+
+    // a subset of the families, at two of the scales only
+    Feature_set subset = new Feature_set();
+    IntBuffer scales = ByteBuffer.allocateDirect(2*4).order(ByteOrder.nativeOrder()).asIntBuffer();
+    scales.put(0, 0).put(1, 2);
+    generator.select_scales(scales);
+    generator.generate_features(subset, Feature_family.POINT_BASED_FEATURES.swigValue());
+    generator.select_scales(ByteBuffer.allocateDirect(0).asIntBuffer());
+    if (subset.size() == 0 || subset.size() >= features.size())
+      throw new AssertionError("Unexpected number of selected features");
+
     System.out.println("10 first features are:");
     for (int i = 0; i < Math.min(features.size(), 10); ++ i)
       System.out.println(" Feature " + i + " : " + features.get(i).name());
 
+    // all the values at once, one row per point
+    int nf = features.size();
+    FloatBuffer matrix = features.to_matrix(points.size());
+    if (matrix.capacity() != points.size() * nf
+        || Math.abs(matrix.get(nf + 2) - features.get(2).value(1)) > 1e-6)
+      throw new AssertionError("Unexpected feature matrix");
+
+    // features given as a column (kept apart from the features of the classifier)
+    Feature_set columns = new Feature_set();
+    FloatBuffer zero = ByteBuffer.allocateDirect(points.size()*4).order(ByteOrder.nativeOrder()).asFloatBuffer();
+    columns.add_feature("zero", zero);
+    if (columns.size() != 1)
+      throw new AssertionError("The feature was not added");
+
     Point_set_3_Int_map classification = points.int_map("label");
     if (!classification.is_valid())
     {
@@ -57,9 +95,23 @@ public class Classification_example{
                      50, // num_trees
                      30); // max_depth
 
+    // trees added on balanced subsamples of at most 10000 points per label,
+    // trained in parallel from the labels viewed as an int32 buffer
+    classifier.train_from_array(points.property_array(training), false, 8, 30, 10000);
+
     System.out.println("Saving classifier's trained configuration...");
     classifier.save_configuration("trained_random_forest.gz");
 
+    // the forest is parsed once per process, then shared by the classifiers
+    // loading the same file
+    ETHZ_Random_forest_classifier reloaded = new ETHZ_Random_forest_classifier(labels, features);
+    reloaded.load_cached_configuration("trained_random_forest.gz");
+    ETHZ_Random_forest_classifier reloaded_again = new ETHZ_Random_forest_classifier(labels, features);
+    reloaded_again.load_cached_configuration("trained_random_forest.gz");
+    // classifier sharing the trained forest without copying it
+    ETHZ_Random_forest_classifier shared = new ETHZ_Random_forest_classifier(labels, features, classifier);
+    ETHZ_Random_forest_classifier.clear_configuration_cache();
+
     // classification map will be overwritten
     if (args.length > 0)
     {
@@ -76,9 +128,33 @@ public class Classification_example{
       {
         System.out.println("Classifying with local smoothing...");
         CGAL_Classification.classify_with_local_smoothing (points, labels, classifier,
-                                                           generator.neighborhood().k_neighbor_query(6),
+                                                           generator.neighbor_query(0),
                                                            classification);
       }
+      else if (args[0].equals("-G") || args[0].equals("--subdivided-graphcut"))
+      {
+        System.out.println("Classifying with graphcut on subdivisions...");
+        Graphcut_statistics stats = CGAL_Classification.classify_with_graphcut_subdivided
+          (points, labels, classifier, generator.neighborhood().k_neighbor_query(6),
+           0.5, // strength of graphcut
+           20 * generator.radius_neighbors(0), // size of the subdivisions
+           classification,
+           Alpha_expansion_implementation.ALPHA_EXPANSION_BOOST_COMPRESSED_SPARSE_ROW.swigValue());
+        System.out.println("  " + stats.number_of_subdivisions() + " subdivisions in " + stats.total_time()
+                           + " s (neighborhood " + stats.neighborhood_time() + " s, energy "
+                           + stats.energy_time() + " s, graphcut " + stats.graphcut_time() + " s)");
+      }
+      else if (args[0].equals("-t") || args[0].equals("--tiled"))
+      {
+        System.out.println("Classifying by tiles...");
+        int nb_scales = generator.number_of_scales();
+        // same scales as the generator, halo covering the largest scale
+        CGAL_Classification.classify_tiled (points, labels, classifier,
+                                            nb_scales, generator.grid_resolution(0),
+                                            20 * generator.radius_neighbors(nb_scales - 1),
+                                            generator.radius_neighbors(nb_scales - 1),
+                                            classification);
+      }
       else
       {
         System.out.println ("Unknown option " + args[0]);
@@ -101,6 +177,14 @@ public class Classification_example{
     System.out.println(" * Mean F1 score = " + evaluation.mean_f1_score());
     System.out.println(" * Mean IoU = " + evaluation.mean_intersection_over_union());
 
+    // the same evaluation accumulated over int32 label arrays, as it would be over tiles
+    Evaluation streamed = new Evaluation(labels);
+    streamed.append(points.property_array(training), points.property_array(classification));
+    if (streamed.number_of_items() != evaluation.number_of_items())
+      throw new AssertionError("Unexpected number of evaluated items");
+    LongBuffer confusion = streamed.confusion_matrix();
+    System.out.println(" * Confusion of ground and building = " + confusion.get(1));
+
     System.out.println("Per label evaluation:");
 
     Label[] all_labels = {ground, vegetation, building };
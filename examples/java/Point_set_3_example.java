@@ -1,10 +1,16 @@
 import CGAL.Kernel.Point_3;
 import CGAL.Kernel.Vector_3;
 import CGAL.Point_set_3.Point_set_3;
+import CGAL.Point_set_3.Mapped_point_set_3;
+import CGAL.Point_set_3.Point_set_3_chunk_reader;
 import CGAL.Point_set_3.Point_set_3_Vector_map;
 import CGAL.Point_set_3.Point_set_3_Float_map;
 
 import java.util.Vector;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.DoubleBuffer;
+import java.nio.IntBuffer;
 
 public class Point_set_3_example{
   public static void main(String arg[]){
@@ -48,6 +54,15 @@ public class Point_set_3_example{
     for (Vector_3 n : points.normals())
       System.out.println(" * " + n);
 
+    // Zero-copy access to the coordinates through a DoubleBuffer
+    DoubleBuffer coords = points.point_array();
+    System.out.println("Point array has " + coords.capacity() / 3 + " point(s)");
+    coords.put(2, 0.5);
+    System.out.println("Point 0 modified through the buffer = " + points.point(0));
+    DoubleBuffer normals = points.normal_array();
+    System.out.println("Normal 4 read from the buffer = " + normals.get(12) + " "
+                       + normals.get(13) + " " + normals.get(14));
+
     // Removal
     System.out.println("Removing point at index 2...");
     points.remove(2);
@@ -102,6 +117,18 @@ public class Point_set_3_example{
       points.remove_float_map(intensity);
     }
 
+    // Bulk construction from direct buffers
+    DoubleBuffer coordinates = ByteBuffer.allocateDirect(9 * 8).order(ByteOrder.nativeOrder()).asDoubleBuffer();
+    coordinates.put(new double[] { 0., 0., 0., 1., 0., 0., 0., 1., 0. });
+    Point_set_3 bulk = Point_set_3.from_arrays(coordinates);
+    System.out.println("Point set built from arrays has " + bulk.size() + " point(s)");
+
+    // Zero-copy access to a property column
+    IntBuffer labels = bulk.property_array(bulk.add_int_map("label"));
+    labels.put(1, 12);
+    System.out.println("Label of point 1 modified through the buffer = "
+                       + bulk.int_map("label").get(1));
+
     // Reading a file
     System.out.println("Clearing and reading" + datafile);
     points.clear();
@@ -115,6 +142,18 @@ public class Point_set_3_example{
       System.out.print(" '" + p + "'");
     System.out.println("");
 
+    // Reading a file block by block
+    Point_set_3_chunk_reader reader = new Point_set_3_chunk_reader(datafile, 1000);
+    int nb_chunks = 0;
+    int nb_read = 0;
+    for (Point_set_3 chunk = reader.next(); !chunk.empty(); chunk = reader.next())
+    {
+      nb_chunks += 1;
+      nb_read += chunk.size();
+    }
+    System.out.println(datafile + " read in " + nb_chunks + " block(s) of " + nb_read
+                       + " point(s) in total");
+
     // Writing the point set to different formats
     System.out.println("Writing output to xyz...");
     if (!points.write("test.xyz"))
@@ -125,9 +164,36 @@ public class Point_set_3_example{
     System.out.println("Writing output to ply...");
     if (!points.write("test.ply"))
       System.out.println("Cannot write test.ply"); // this sould NOT be displayed
+    System.out.println("Writing output to ps3 (columnar, memory mappable)...");
+    if (!points.write("test.ps3"))
+      System.out.println("Cannot write test.ps3"); // this sould NOT be displayed
     System.out.println("Trying to write output to doc...");
     if (!points.write("test.doc"))
       System.out.println("Cannot write test.doc"); // this should be displayed
+
+    // Memory-mapped access to a columnar file
+    Mapped_point_set_3 mapped = new Mapped_point_set_3("test.ps3");
+    System.out.println("test.ps3 has " + mapped.size() + " point(s)");
+    DoubleBuffer mapped_points = mapped.point_array();
+    System.out.println("First point of test.ps3 = " + mapped_points.get(0) + " "
+                       + mapped_points.get(1) + " " + mapped_points.get(2)
+                       + " (read-only: " + mapped_points.isReadOnly() + ")");
+    Point_set_3 reloaded = mapped.load();
+    System.out.println("Reloaded point set has " + reloaded.size() + " point(s)");
+    // out of core: the points are processed by blocks, one block in memory at a time
+    long block_size = 1000, nb_loaded = 0;
+    for (long first = 0; first < mapped.size(); first += block_size)
+      nb_loaded += mapped.load_range(first, Math.min(block_size, mapped.size() - first)).size();
+    System.out.println("Reloaded by blocks of " + block_size + " point(s), " + nb_loaded + " in total");
+
+    // Compressed columnar file, with a partial reload
+    System.out.println("Writing output to psz (compressed columnar)...");
+    if (points.write("test.psz"))
+    {
+      Mapped_point_set_3 compressed = new Mapped_point_set_3("test.psz");
+      Point_set_3 partial = compressed.load(new String[] { "normal" });
+      System.out.println("Partially reloaded point set has " + partial.size() + " point(s)");
+    }
   }
 
 }
@@ -1,9 +1,13 @@
 import CGAL.Kernel.Point_3;
 import CGAL.Kernel.Vector_3;
+import CGAL.Kernel.Cancellation_token;
 import CGAL.Point_set_3.Point_set_3;
 import CGAL.Point_set_processing_3.CGAL_Point_set_processing_3;
+import CGAL.Point_set_processing_3.Neighborhood_cache;
+import CGAL.Point_set_processing_3.Point_set_pipeline;
 
 import java.util.Vector;
+import java.nio.DoubleBuffer;
 
 public class Point_set_processing_3_example{
   public static void main(String arg[]){
@@ -41,6 +45,16 @@ public class Point_set_processing_3_example{
                                                                        wlop_point_set); // Output
     
     System.out.println("Output of WLOP has " + points.size() + " points");
+
+    System.out.println("Running a cancelled jet_smooth_point_set..." );
+    Cancellation_token token = new Cancellation_token();
+    token.cancel();
+    try {
+      CGAL_Point_set_processing_3.jet_smooth_point_set(points, k, 0., 2, 2, token);
+    } catch (RuntimeException e) {
+      System.out.println("Cancelled");
+    }
+    token.reset();
                                        
     System.out.println("Running grid_simplify_point_set..." );
     CGAL_Point_set_processing_3.grid_simplify_point_set(points, avg_space/5);
@@ -78,6 +92,28 @@ public class Point_set_processing_3_example{
     System.out.println("Running pca_estimate_normals...");
     CGAL_Point_set_processing_3.pca_estimate_normals(points, 24);
 
+    System.out.println("Sharing the neighborhoods between several estimations...");
+    Neighborhood_cache cache = new Neighborhood_cache(points, 24);
+    System.out.println("Average spacing from the cache = " + cache.compute_average_spacing());
+    cache.pca_estimate_normals();
+    cache.jet_estimate_normals();
+    cache.remove_outliers(1.5);
+    System.out.println(points.size() + " point(s) remaining, neighborhoods rebuilt: " + cache.update());
+    points.collect_garbage();
+
+    System.out.println("Running a whole processing chain in one call...");
+    Point_set_pipeline pipeline = new Point_set_pipeline();
+    pipeline.add_remove_outliers(24, 1.5);
+    pipeline.add_grid_simplify_point_set(0.01);
+    pipeline.add_jet_estimate_normals(24);
+    pipeline.add_mst_orient_normals(24);
+    pipeline.run(points);
+    String[] stages = pipeline.stage_names();
+    DoubleBuffer timings = pipeline.timings();
+    for (int i = 0; i < stages.length; ++ i)
+      System.out.println(" * " + stages[i] + " ran in " + timings.get(i) + " second(s)");
+    System.out.println(points.size() + " point(s) remaining");
+
     System.out.println("Writing to ply");
     points.write("oni.ply");
   }
@@ -3,6 +3,11 @@ import CGAL.Kernel.Vector_3;
 import CGAL.Point_set_3.Point_set_3;
 import CGAL.Point_set_3.Point_set_3_Int_map;
 import CGAL.Shape_detection.CGAL_Shape_detection;
+import CGAL.Shape_detection.Ransac_shapes;
+import CGAL.Shape_detection.Region_growing_neighbor_query;
+import CGAL.Point_set_processing_3.Neighborhood_cache;
+import java.nio.DoubleBuffer;
+import java.nio.IntBuffer;
 
 public class Shape_detection_example{
   public static void main(String arg[]){
@@ -18,6 +23,13 @@ public class Shape_detection_example{
                                                          20); // min_points
     System.out.println(nb_planes + " planes(s) detected");
 
+    System.out.println("Detecting planes with region growing (sphere query on a voxel grid)");
+    nb_planes = CGAL_Shape_detection.region_growing (points, plane_map,
+                                                     20, // min_points
+                                                     -1, -1, 0.9, 0, // default params
+                                                     true); // use_voxel_grid
+    System.out.println(nb_planes + " planes(s) detected");
+
     System.out.println("Detecting planes with region growing (k-neighbor query)");
     nb_planes = CGAL_Shape_detection.region_growing (points, plane_map,
                                                      20, // min_points
@@ -25,6 +37,18 @@ public class Shape_detection_example{
                                                      12); // k
     System.out.println(nb_planes + " planes(s) detected");
     
+    System.out.println("Sweeping the region growing parameters with a single neighbor query");
+    Region_growing_neighbor_query query = Region_growing_neighbor_query.create_sphere(points);
+    for (double epsilon = 0.5 * query.radius(); epsilon < 2.5 * query.radius(); epsilon += 0.5 * query.radius()) {
+      nb_planes = CGAL_Shape_detection.region_growing_with_neighbor_query (points, plane_map, query, 20, epsilon);
+      System.out.println(" * epsilon " + epsilon + ": " + nb_planes + " planes(s) detected");
+    }
+
+    System.out.println("Detecting planes with region growing (neighbors of a Neighborhood_cache)");
+    query = Region_growing_neighbor_query.create_from_neighborhood_cache(new Neighborhood_cache(points, 12));
+    nb_planes = CGAL_Shape_detection.region_growing_with_neighbor_query (points, plane_map, query, 20);
+    System.out.println(nb_planes + " planes(s) detected");
+
     System.out.println("Detecting planes with efficient RANSAC");
     String[] planes = CGAL_Shape_detection.efficient_RANSAC (points, plane_map);
     System.out.println(planes.length + " planes(s) detected, first 10 planes are:");
@@ -79,5 +103,24 @@ public class Shape_detection_example{
       if (shape_map.get(idx) == 0)
         inliers_of_first_shape.insert(points.point(idx));
     System.out.println(inliers_of_first_shape.size() + " inliers(s) recovered");
+
+    System.out.println("Detecting planes and cylinders with efficient RANSAC, results as arrays");
+    DoubleBuffer coordinates = points.point_array();
+    double min = Double.MAX_VALUE, max = -Double.MAX_VALUE;
+    for (int i = 0; i < coordinates.capacity(); ++i) {
+      min = Math.min(min, coordinates.get(i));
+      max = Math.max(max, coordinates.get(i));
+    }
+    Ransac_shapes result = CGAL_Shape_detection.efficient_RANSAC_arrays (points, 20, -1, -1, 0.9, 0.01,
+                                                                         true, false, true, false, false, (max - min) / 2);
+    IntBuffer shape_ids = result.shape_id_array();
+    DoubleBuffer parameters = result.shape_parameter_array();
+    if (shape_ids.capacity() != points.size() || parameters.capacity() != 8 * result.number_of_shapes())
+      throw new AssertionError("Wrong sizes of the shape arrays");
+    System.out.println(result.number_of_shapes() + " shape(s) detected");
+
+    System.out.println("Detecting planes with region growing on blocks processed in parallel");
+    nb_planes = CGAL_Shape_detection.region_growing_on_blocks (points, plane_map, (max - min) / 2, 20);
+    System.out.println(nb_planes + " planes(s) detected");
   }
 }
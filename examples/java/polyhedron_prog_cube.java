@@ -31,5 +31,14 @@ public class polyhedron_prog_cube{
     Polyhedron_3 P=new Polyhedron_3();
     Polyhedron_3_Halfedge_handle h = make_cube_3(P);
     assert !P.is_tetrahedron(h);
+    // ids are given to the items created by the editing operations
+    if (!P.has_compact_ids())
+      throw new AssertionError("Ids should be compact");
+    P.erase_facet(h);
+    if (P.has_compact_ids())
+      throw new AssertionError("Ids should not be compact after a removal");
+    P.compact();
+    if (!P.has_compact_ids())
+      throw new AssertionError("Ids should be compact");
   }
 }
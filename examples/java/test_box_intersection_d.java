@@ -6,6 +6,11 @@ import CGAL.Box_intersection_d.Collect_ids_callback_2;
 import CGAL.Box_intersection_d.CGAL_Box_intersection_d;
 import CGAL.Box_intersection_d.Box_with_id_2;
 import CGAL.Box_intersection_d.Pair_of_int;
+import CGAL.Box_intersection_d.Intersection_test;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.DoubleBuffer;
+import java.nio.IntBuffer;
 
 public class test_box_intersection_d{
   public static void main(String arg[]){
@@ -50,6 +55,46 @@ public class test_box_intersection_d{
       System.out.println(p.getFirst()+" "+(p.getSecond()-offset));
     }
 
+    //Same query on arrays of boxes (xmin, ymin, xmax, ymax)
+    DoubleBuffer boxes_1 = box_array(segments_1);
+    DoubleBuffer boxes_2 = box_array(segments_2);
+    IntBuffer pairs = CGAL_Box_intersection_d.box_intersection_d_arrays(boxes_1, boxes_2, 2);
+    int nb_pairs = 0;
+    for (Pair_of_int p : callback.ids() )
+      ++nb_pairs;
+    if (pairs.capacity() != 2 * nb_pairs)
+      throw new AssertionError("Unexpected number of pairs");
+    System.out.println("Ids of segments which bbox intersect (arrays)");
+    for (int k = 0; k < nb_pairs; ++k)
+      System.out.println(pairs.get(2 * k)+" "+(pairs.get(2 * k + 1)-offset));
+
+    //Pairs of the second set
+    IntBuffer self_pairs = CGAL_Box_intersection_d.box_self_intersection_d_arrays(boxes_2, 2);
+    System.out.println(self_pairs.capacity() / 2 + " pairs of boxes of the second set intersect");
+
+    //Narrow phase in the sweep: only the pairs of segments that intersect
+    IntBuffer segment_pairs = CGAL_Box_intersection_d.box_intersecting_pairs_arrays(
+      segment_array(segments_1), segment_array(segments_2), Intersection_test.SEGMENT_2_SEGMENT_2);
+    System.out.println("Ids of segments which intersect");
+    for (int k = 0; k < segment_pairs.capacity() / 2; ++k)
+      System.out.println(segment_pairs.get(2 * k)+" "+(segment_pairs.get(2 * k + 1)-offset));
+
   }
-}
 
+  static DoubleBuffer box_array(Vector<Segment_2> segments){
+    DoubleBuffer coords = ByteBuffer.allocateDirect(segments.size() * 4 * 8).order(ByteOrder.nativeOrder()).asDoubleBuffer();
+    for(Segment_2 s : segments)
+    {
+      Bbox_2 b = s.bbox();
+      coords.put(b.xmin()).put(b.ymin()).put(b.xmax()).put(b.ymax());
+    }
+    return coords;
+  }
+
+  static DoubleBuffer segment_array(Vector<Segment_2> segments){
+    DoubleBuffer coords = ByteBuffer.allocateDirect(segments.size() * 4 * 8).order(ByteOrder.nativeOrder()).asDoubleBuffer();
+    for(Segment_2 s : segments)
+      coords.put(s.source().x()).put(s.source().y()).put(s.target().x()).put(s.target().y());
+    return coords;
+  }
+}
@@ -0,0 +1,65 @@
+import CGAL.Java.Direct_buffers;
+import CGAL.Polyhedron_3.Polyhedron_3;
+import CGAL.Point_set_3.Point_set_3;
+import CGAL.Triangulation_3.Delaunay_triangulation_3;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.DoubleBuffer;
+import java.nio.IntBuffer;
+
+public class test_direct_buffers {
+  static void check(boolean b, String what){
+    if (!b) throw new RuntimeException(what);
+  }
+
+  public static void main(String arg[]){
+    // a tetrahedron, the coordinates being preceded by 3 unused values
+    // read from the position of the buffer
+    DoubleBuffer vertices = Direct_buffers.allocate_doubles(15);
+    vertices.put(new double[]{-1,-1,-1, 0,0,0, 1,0,0, 0,1,0, 0,0,1});
+    vertices.position(3);
+    IntBuffer faces = Direct_buffers.allocate_ints(12);
+    faces.put(new int[]{0,2,1, 0,1,3, 0,3,2, 1,2,3}).rewind();
+
+    Polyhedron_3 P = Polyhedron_3.fromDirectBuffers(vertices, faces);
+    check(P.size_of_vertices() == 4 && P.size_of_facets() == 4, "fromDirectBuffers");
+
+    // written in place, e.g. in a slice of a buffer shared with native code
+    ByteBuffer bytes = ByteBuffer.allocateDirect(8*16).order(ByteOrder.nativeOrder());
+    DoubleBuffer out = bytes.asDoubleBuffer();
+    out.position(4);
+    IntBuffer out_faces = Direct_buffers.allocate_ints(12);
+    P.toDirectBuffers(out, out_faces);
+    check(out.get(4) == 0 && out.get(7) == 1 && out.get(15) == 1, "toDirectBuffers vertices");
+    check(out_faces.get(11) == 3, "toDirectBuffers faces");
+
+    Direct_buffers arrays = P.toDirectBuffers();
+    check(arrays.vertices.capacity() == 12 && arrays.faces.capacity() == 12, "toDirectBuffers()");
+
+    // the buffers must be large enough and writable
+    try {
+      P.toDirectBuffers(Direct_buffers.allocate_doubles(6), out_faces);
+      check(false, "too small buffer not rejected");
+    } catch (RuntimeException e) {}
+    try {
+      P.toDirectBuffers(out.asReadOnlyBuffer(), out_faces);
+      check(false, "read-only buffer not rejected");
+    } catch (RuntimeException e) {}
+
+    vertices.rewind().position(3);
+    Point_set_3 points = Point_set_3.fromDirectBuffers(vertices);
+    check(points.size() == 4, "Point_set_3.fromDirectBuffers");
+    Direct_buffers point_arrays = points.toDirectBuffers();
+    check(point_arrays.vertices.get(11) == 1 && point_arrays.normals == null, "Point_set_3.toDirectBuffers");
+
+    Delaunay_triangulation_3 dt = Delaunay_triangulation_3.fromDirectBuffers(vertices);
+    check(dt.number_of_vertices() == 4 && dt.number_of_finite_cells() == 1, "Delaunay_triangulation_3.fromDirectBuffers");
+    Direct_buffers dt_arrays = dt.toDirectBuffers();
+    check(dt_arrays.vertices.capacity() == 12 && dt_arrays.faces.capacity() == 4, "Delaunay_triangulation_3.toDirectBuffers");
+    IntBuffer cells = Direct_buffers.allocate_ints(4);
+    dt.toDirectBuffers(Direct_buffers.allocate_doubles(12), cells);
+    check(cells.get(0) + cells.get(1) + cells.get(2) + cells.get(3) == 6, "cells");
+
+    System.out.println("OK");
+  }
+}
@@ -8,10 +8,17 @@ import CGAL.Triangulation_3.Delaunay_triangulation_3_Vertex_handle;
 import CGAL.Triangulation_3.Delaunay_triangulation_3_Facet;
 import CGAL.Triangulation_3.Delaunay_triangulation_3_Edge;
 import CGAL.Triangulation_3.Delaunay_triangulation_3_Cell_handle;
+import CGAL.Triangulation_3.Parallel_Delaunay_triangulation_3;
+import CGAL.Triangulation_3.Location_batch;
 import CGAL.Kernel.Bounded_side;
 import CGAL.Kernel.Ref_int;
+import CGAL.Java.Packed_iterator;
 import java.util.LinkedList;
 import java.util.Iterator;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.DoubleBuffer;
+import java.nio.IntBuffer;
 
 
 public class test_dt3 {
@@ -38,6 +45,68 @@ public class test_dt3 {
   Delaunay_triangulation_3 tbis=new Delaunay_triangulation_3(lsti.iterator());
   System.out.println("create with range OK");   
   System.out.println(tbis.number_of_vertices());   
+
+  LinkedList<Point_3> grid=new LinkedList<Point_3>();
+  for (int i=0;i<20;++i)
+    for (int j=0;j<20;++j)
+      for (int k=0;k<20;++k)
+        grid.add(new Point_3(i+0.01*j,j+0.01*k,k+0.01*i));
+  Parallel_Delaunay_triangulation_3 pt=new Parallel_Delaunay_triangulation_3(grid.iterator());
+  if (pt.number_of_vertices()!=8000 || !pt.is_valid()) throw new AssertionError("parallel insertion");
+  if (pt.insert(lsti.iterator())!=4 || !pt.is_valid()) throw new AssertionError("parallel insertion");
+  System.out.println("parallel insert range OK");
+
+  DoubleBuffer coords=ByteBuffer.allocateDirect(8*3*grid.size()).order(ByteOrder.nativeOrder()).asDoubleBuffer();
+  for (Point_3 p : grid){ coords.put(p.x()); coords.put(p.y()); coords.put(p.z()); }
+  Delaunay_triangulation_3 ta=new Delaunay_triangulation_3();
+  LinkedList<Delaunay_triangulation_3_Vertex_handle> row_vertices=new LinkedList<Delaunay_triangulation_3_Vertex_handle>();
+  if (ta.insert_from_array(coords,row_vertices)!=8000 || !ta.is_valid() || !row_vertices.get(10).point().equals(grid.get(10)))
+    throw new AssertionError("insert_from_array");
+  System.out.println("insert from array OK");
+
+  double[] packed=new double[3*grid.size()];
+  long[] pointers=new long[grid.size()];
+  int n=0;
+  for (Point_3 p : grid){
+    packed[3*n]=p.x(); packed[3*n+1]=p.y(); packed[3*n+2]=p.z();
+    pointers[n++]=Point_3.getCPtr(p);
+  }
+  Delaunay_triangulation_3 tp=new Delaunay_triangulation_3(Packed_iterator.<Point_3>of_coordinates(packed,3));
+  if (tp.number_of_vertices()!=8000) throw new AssertionError("packed coordinates");
+  tp.clear();
+  DoubleBuffer all_coords=coords.duplicate();
+  all_coords.position(0);
+  if (tp.insert(Packed_iterator.<Point_3>of_coordinates(all_coords,3))!=8000) throw new AssertionError("packed buffer");
+  tp.clear();
+  if (tp.insert(Packed_iterator.<Point_3>of_pointers(pointers,grid))!=8000) throw new AssertionError("packed pointers");
+  try{
+    tp.insert(Packed_iterator.<Point_3>of_coordinates(packed,2));
+    throw new AssertionError("packed dimension");
+  }
+  catch(CGAL.Java.SWIGCGALException e){}
+  System.out.println("insert packed range OK");
+
+  DoubleBuffer queries=ByteBuffer.allocateDirect(8*6).order(ByteOrder.nativeOrder()).asDoubleBuffer();
+  queries.put(new double[]{1.5,1.5,1.5,1000,1000,1000});
+  Location_batch locations=ta.locate_batch(queries);
+  if (locations.size()!=2 || locations.index_array().get(0)<0 || locations.index_array().get(1)!=-1)
+    throw new AssertionError("locate_batch");
+
+  ta.write_binary("/tmp/dt3.bin");
+  Delaunay_triangulation_3 tb=new Delaunay_triangulation_3();
+  tb.read_binary("/tmp/dt3.bin");
+  if (!tb.is_valid() || tb.number_of_vertices()!=ta.number_of_vertices() || tb.number_of_cells()!=ta.number_of_cells())
+    throw new AssertionError("binary round trip");
+  System.out.println("binary round trip OK");
+
+  IntBuffer ids=ByteBuffer.allocateDirect(4*2).order(ByteOrder.nativeOrder()).asIntBuffer();
+  ids.put(new int[]{0,1});
+  DoubleBuffer moved=ByteBuffer.allocateDirect(8*6).order(ByteOrder.nativeOrder()).asDoubleBuffer();
+  moved.put(new double[]{0.01,0.01,0.01,1000,1000,1000});
+  IntBuffer new_ids=tb.move_batch(ids,moved);
+  if (!tb.is_valid() || tb.number_of_vertices()!=ta.number_of_vertices() || new_ids.capacity()!=2)
+    throw new AssertionError("move_batch");
+  System.out.println("move batch OK");
     
   Iterator<Delaunay_triangulation_3_Vertex_handle> it=t.finite_vertices();
   for (Delaunay_triangulation_3_Vertex_handle v : t.finite_vertices())
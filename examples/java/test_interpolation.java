@@ -1,12 +1,18 @@
 import CGAL.Triangulation_2.Delaunay_triangulation_2;
 import CGAL.Triangulation_2.Delaunay_triangulation_2_Edge;
 import CGAL.Triangulation_2.Delaunay_triangulation_2_Face_handle;
+import CGAL.Triangulation_2.Delaunay_triangulation_2_Vertex_handle;
 import CGAL.Kernel.Point_2;
 import CGAL.Interpolation.CGAL_Interpolation;
 import CGAL.Interpolation.Point_2_and_double;
 import CGAL.Interpolation.Double_and_bool;
 import CGAL.Interpolation.Data_access_double_2;
 import CGAL.Interpolation.Data_access_vector_2;
+import CGAL.Interpolation.Interpolation_method;
+import CGAL.Interpolation.Neighbor_coordinates_3;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.DoubleBuffer;
 import java.util.LinkedList;
 
 public class test_interpolation {
@@ -36,6 +42,19 @@ public class test_interpolation {
 
     System.out.println( "   Tested interpolation on " + p + " interpolation: "
         + res + " exact: " + (a + bx* p.x()+ by* p.y()) );
+
+    //same values set from arrays
+    DoubleBuffer points = ByteBuffer.allocateDirect(8*18).order(ByteOrder.nativeOrder()).asDoubleBuffer();
+    DoubleBuffer values = ByteBuffer.allocateDirect(8*9).order(ByteOrder.nativeOrder()).asDoubleBuffer();
+    for (int y=0 ; y<3 ; y++)
+      for (int x=0 ; x<3 ; x++){
+        points.put(x).put(y);
+        values.put(a + bx* x+ by*y);
+      }
+    Data_access_double_2 array_values=new Data_access_double_2();
+    array_values.set_from_arrays(points,values);
+    if (CGAL_Interpolation.linear_interpolation(coords.iterator(),norm,array_values)!=res)
+      throw new AssertionError("set_from_arrays");
   }
   
   public static void test_sibson_gradient()
@@ -77,6 +96,80 @@ public class test_interpolation {
   }
   
   
+  public static void test_interpolate_grid()
+  {
+    Delaunay_triangulation_2 dt=new Delaunay_triangulation_2();
+    for (int y=0 ; y<4 ; y++)
+      for (int x=0 ; x<4 ; x++)
+        dt.insert(new Point_2(x,y));
+
+    //values of a linear function in the order of the finite vertices
+    DoubleBuffer values = ByteBuffer.allocateDirect(8*16).order(ByteOrder.nativeOrder()).asDoubleBuffer();
+    for (Delaunay_triangulation_2_Vertex_handle v : dt.finite_vertices())
+      values.put(0.25 + 1.3*v.point().x() - 0.7*v.point().y());
+
+    //a vertex, a point in a face, a point on an edge and a point outside the convex hull
+    double[] xy = {1, 1, 1.3, 0.34, 2.5, 1, 5, 5};
+    DoubleBuffer queries = ByteBuffer.allocateDirect(8*xy.length).order(ByteOrder.nativeOrder()).asDoubleBuffer();
+    queries.put(xy);
+
+    DoubleBuffer linear = CGAL_Interpolation.natural_neighbor_interpolate_grid(dt,values,queries);
+    for (int i=0 ; i<3 ; i++)
+      if (Math.abs(linear.get(i) - (0.25 + 1.3*xy[2*i] - 0.7*xy[2*i+1])) > 1e-10)
+        throw new AssertionError("natural_neighbor_interpolate_grid");
+    if (!Double.isNaN(linear.get(3)))
+      throw new AssertionError("natural_neighbor_interpolate_grid outside the convex hull");
+
+    DoubleBuffer sibson = CGAL_Interpolation.natural_neighbor_interpolate_grid(dt,values,queries,Interpolation_method.SIBSON_C1_INTERPOLATION,0);
+    if (Math.abs(sibson.get(1) - (0.25 + 1.3*1.3 - 0.7*0.34)) > 1e-6 || sibson.get(3)!=0)
+      throw new AssertionError("natural_neighbor_interpolate_grid with Sibson's interpolant");
+
+    //gradients of the linear function, undefined on the convex hull
+    DoubleBuffer gradients = CGAL_Interpolation.sibson_gradient_fitting_nn_2_arrays(dt,values);
+    int i=0;
+    for (Delaunay_triangulation_2_Vertex_handle v : dt.finite_vertices()){
+      boolean interior = v.point().x()>0 && v.point().x()<3 && v.point().y()>0 && v.point().y()<3;
+      if ( interior ? Math.abs(gradients.get(2*i)-1.3) > 1e-6 || Math.abs(gradients.get(2*i+1)+0.7) > 1e-6
+                    : !Double.isNaN(gradients.get(2*i)) )
+        throw new AssertionError("sibson_gradient_fitting_nn_2_arrays");
+      ++i;
+    }
+    DoubleBuffer quadratic = CGAL_Interpolation.natural_neighbor_interpolate_grid(dt,values,queries,Interpolation_method.QUADRATIC_INTERPOLATION,0,gradients);
+    if (Math.abs(quadratic.get(1) - (0.25 + 1.3*1.3 - 0.7*0.34)) > 1e-6)
+      throw new AssertionError("natural_neighbor_interpolate_grid with the quadratic interpolant");
+    System.out.println("   Tested interpolation of an array of points");
+  }
+
+  public static void test_surface_neighbor_coordinates_3_arrays()
+  {
+    //a 5x5 grid in the plane z=0 and two queries with normal (0,0,1)
+    DoubleBuffer points = ByteBuffer.allocateDirect(8*75).order(ByteOrder.nativeOrder()).asDoubleBuffer();
+    for (int y=0 ; y<5 ; y++)
+      for (int x=0 ; x<5 ; x++)
+        points.put(x).put(y).put(0);
+    DoubleBuffer queries = ByteBuffer.allocateDirect(8*6).order(ByteOrder.nativeOrder()).asDoubleBuffer();
+    queries.put(new double[]{1.5, 2.25, 0, 2.2, 2.4, 0.1});
+    DoubleBuffer normals = ByteBuffer.allocateDirect(8*6).order(ByteOrder.nativeOrder()).asDoubleBuffer();
+    normals.put(new double[]{0, 0, 1, 0, 0, 1});
+
+    Neighbor_coordinates_3 nc = CGAL_Interpolation.surface_neighbor_coordinates_3_arrays(points,queries,normals,16);
+    if (nc.number_of_queries()!=2)
+      throw new AssertionError("surface_neighbor_coordinates_3_arrays");
+    for (int q=0 ; q<2 ; q++){
+      if (nc.status_array().get(q)==0)
+        throw new AssertionError("surface_neighbor_coordinates_3_arrays failed");
+      //the coordinates reproduce the query projected on the plane
+      double x=0, sum=0;
+      for (int j=nc.offset_array().get(q) ; j<nc.offset_array().get(q+1) ; j++){
+        x += nc.weight_array().get(j) * points.get(3*nc.index_array().get(j));
+        sum += nc.weight_array().get(j);
+      }
+      if (Math.abs(sum-1)>1e-10 || Math.abs(x-queries.get(3*q))>1e-10)
+        throw new AssertionError("surface_neighbor_coordinates_3_arrays coordinates");
+    }
+    System.out.println("   Tested surface neighbor coordinates of an array of points");
+  }
+
   public static void main(String arg[])
   {
     System.out.println("Testing interpolation");
@@ -110,5 +203,7 @@ public class test_interpolation {
     
     test_linear_interpolation();
     test_sibson_gradient();
+    test_interpolate_grid();
+    test_surface_neighbor_coordinates_3_arrays();
   }
 }
@@ -12,6 +12,11 @@ import CGAL.Mesh_2.Mesh_2_predicate;
 import java.util.LinkedList;
 import CGAL.Kernel.Point_2;
 import CGAL.Mesh_2.Face_badness;
+import CGAL.Mesh_2.Mesh_2_batch_result;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.DoubleBuffer;
+import java.nio.IntBuffer;
 
 public class test_mesh_2 {
   public static void test_conforming()
@@ -136,9 +141,28 @@ public class test_mesh_2 {
     System.out.println("Number of vertices: " + cdt.number_of_vertices() );
   }
   
+  public static void test_batch()
+  {
+    // two squares, each given as a closed ring of points
+    double[] coords={0,0, 1,0, 1,1, 0,1, 2,0, 4,0, 4,2, 2,2};
+    DoubleBuffer points=ByteBuffer.allocateDirect(8*coords.length).order(ByteOrder.nativeOrder()).asDoubleBuffer();
+    points.put(coords);
+    IntBuffer polygon_offsets=ByteBuffer.allocateDirect(4*3).order(ByteOrder.nativeOrder()).asIntBuffer();
+    polygon_offsets.put(new int[]{0,4,8});
+
+    Mesh_2_batch_result batch=
+      CGAL_Mesh_2.mesh_polygons_batch(points,polygon_offsets,new Delaunay_mesh_size_criteria_2(0.125, 0.5));
+    IntBuffer triangle_offsets=batch.triangle_offsets();
+    if ( batch.number_of_polygons()!=2 || triangle_offsets.get(2)!=batch.number_of_triangles()
+         || triangle_offsets.get(1)==0 || triangle_offsets.get(1)==triangle_offsets.get(2) )
+      throw new AssertionError("Batch meshing");
+    System.out.println("Number of triangles in the batch: " + batch.number_of_triangles() );
+  }
+
   public static void main(String arg[]){
     test_conforming();
     test_meshing();
     test_mesh_class();
+    test_batch();
   }
 };
\ No newline at end of file
@@ -1,19 +1,31 @@
 import CGAL.Polyhedron_3.Polyhedron_3;
 import CGAL.Mesh_3.Mesh_3_Complex_3_in_triangulation_3;
+import CGAL.Mesh_3.C3T3_arrays;
 import CGAL.Mesh_3.CGAL_Mesh_3;
 import CGAL.Mesh_3.Mesh_optimization_return_code;
 import CGAL.Mesh_3.Polyhedral_mesh_domain_3;
 import CGAL.Mesh_3.Mesh_3_parameters;
+import CGAL.Mesh_3.Mesh_3_refinement_monitor;
 import CGAL.Mesh_3.Default_mesh_criteria;
 import CGAL.Mesh_3.User_mesh_criteria;
 import CGAL.Mesh_3.Cell_predicate;
 import CGAL.Mesh_3.Facet_predicate;
+import CGAL.Mesh_3.Labeled_mesh_domain_3;
+import CGAL.Kernel.Point_3;
 import java.util.LinkedList;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.DoubleBuffer;
 
 public class test_mesh_3 {
   public static void main(String arg[]){
     Polyhedron_3 poly=new Polyhedron_3("../data/elephant.off");
     Mesh_3_parameters params=new Mesh_3_parameters();
+    //concurrent meshing is the default when the module is built with TBB
+    params.set_parallel(2,32);
+    if ( params.is_parallel()!=Mesh_3_parameters.concurrency_available() )
+      throw new RuntimeException("Unexpected concurrency of the mesher");
+    System.out.println("Concurrent meshing: "+params.is_parallel());
     Polyhedral_mesh_domain_3 domain= new Polyhedral_mesh_domain_3(poly);
     Mesh3CellCriteria cell_pred_base=new Mesh3CellCriteria();
     Mesh3FacetCriteria facet_pred_base=new Mesh3FacetCriteria();
@@ -28,14 +40,63 @@ public class test_mesh_3 {
     System.out.println("Done");
     res.output_to_medit("/tmp/medit_out.mesh");    
 
+    C3T3_arrays arrays=res.to_arrays();
+    if (arrays.number_of_cells()!=res.number_of_cells() || arrays.cell_array().capacity()!=4*arrays.number_of_cells())
+      throw new AssertionError("C3T3 to_arrays");
+    if (arrays.surface_patch_index_array().capacity()!=2*arrays.number_of_facets())
+      throw new AssertionError("C3T3 to_arrays");
+    res.write_meshb("/tmp/medit_out.meshb");
+    res.write_vtu("/tmp/medit_out.vtu");
+    if ( new java.io.File("/tmp/medit_out.vtu").length()<8*3*arrays.number_of_points() )
+      throw new AssertionError("C3T3 write_vtu");
+
+    res.write_binary("/tmp/c3t3.bin");
+    Mesh_3_Complex_3_in_triangulation_3 reloaded=new Mesh_3_Complex_3_in_triangulation_3();
+    reloaded.read_binary("/tmp/c3t3.bin");
+    if (reloaded.number_of_cells()!=res.number_of_cells() || reloaded.number_of_facets()!=res.number_of_facets())
+      throw new AssertionError("C3T3 binary round trip");
+
     System.out.println("Refining mesh...");
     Default_mesh_criteria new_criteria = new Default_mesh_criteria();
     new_criteria.cell_radius_edge_ratio(3).cell_size(0.03);
 
     // Mesh refinement
+    params.set_sequential();
+    if ( params.is_parallel() )
+      throw new RuntimeException("Sequential meshing expected");
     CGAL_Mesh_3.refine_mesh_3(res, domain, new_criteria,params);
     
     System.out.println("Done");
     res.output_to_medit("/tmp/medit_out_ref.mesh");
+
+    // Refinement budget
+    Mesh_3_parameters budget_params=new Mesh_3_parameters();
+    budget_params.no_exude();
+    budget_params.no_perturb();
+    budget_params.set_refinement_budget(0,500);
+    Mesh_3_Complex_3_in_triangulation_3 small=
+      CGAL_Mesh_3.make_mesh_3(domain, new_criteria, budget_params);
+    Mesh_3_refinement_monitor monitor=budget_params.refinement_monitor();
+    if ( !monitor.stopped_early() || !small.triangulation().is_valid() )
+      throw new AssertionError("Refinement budget");
+
+    // Implicit function domain: sphere of radius 0.8 sampled on a grid
+    int n=21;
+    double h=2./(n-1);
+    DoubleBuffer values=ByteBuffer.allocateDirect(8*n*n*n).order(ByteOrder.nativeOrder()).asDoubleBuffer();
+    for (int k=0;k<n;++k)
+      for (int j=0;j<n;++j)
+        for (int i=0;i<n;++i){
+          double x=-1+i*h, y=-1+j*h, z=-1+k*h;
+          values.put(Math.sqrt(x*x+y*y+z*z)-0.8);
+        }
+    Labeled_mesh_domain_3 implicit_domain=
+      Labeled_mesh_domain_3.create_implicit_grid_domain(values,n,n,n,new Point_3(-1,-1,-1),h,h,h);
+    Default_mesh_criteria sphere_criteria = new Default_mesh_criteria();
+    sphere_criteria.facet_angle(25).facet_size(0.15).facet_distance(0.01).cell_radius_edge_ratio(3);
+    Mesh_3_Complex_3_in_triangulation_3 sphere=
+      CGAL_Mesh_3.make_mesh_3(implicit_domain,sphere_criteria,params);
+    if ( sphere.number_of_cells()==0 )
+      throw new RuntimeException("Empty mesh of the implicit domain");
   }
 };
\ No newline at end of file
@@ -1,6 +1,7 @@
 import CGAL.Polygon_mesh_processing.CGAL_Polygon_mesh_processing;
 import CGAL.Polygon_mesh_processing.Facet_pair;
 import CGAL.Polygon_mesh_processing.Polygon_mesh_slicer;
+import CGAL.Polygon_mesh_processing.Polyline_batch;
 import CGAL.Polygon_mesh_processing.Side_of_triangle_mesh;
 import CGAL.Polygon_mesh_processing.Halfedge_pair;
 import CGAL.Polygon_mesh_processing.Integer_triple;
@@ -8,6 +9,9 @@ import CGAL.Polygon_mesh_processing.Point_3_Vector;
 import CGAL.Polygon_mesh_processing.Polygon_Vector;
 import CGAL.Polygon_mesh_processing.Polylines;
 import CGAL.Polygon_mesh_processing.Int_Vector;
+import CGAL.Polygon_mesh_processing.Surface_mesh_3_Vector;
+import CGAL.Polygon_mesh_processing.Hole_filling_mode;
+import CGAL.Polygon_mesh_processing.Hole_filling_statistics;
 
 import CGAL.Polyhedron_3.Polyhedron_3;
 import CGAL.Polyhedron_3.Polyhedron_3_Halfedge_handle;
@@ -18,6 +22,16 @@ import CGAL.Kernel.Plane_3;
 import CGAL.Kernel.Vector_3;
 import CGAL.Kernel.Bbox_3;
 import CGAL.Kernel.Bounded_side;
+import CGAL.AABB_tree.AABB_tree_Polyhedron_3_Facet_handle;
+import CGAL.AABB_tree.AABB_tree_Surface_mesh_3;
+import CGAL.Surface_mesh.Surface_mesh_3;
+
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.DoubleBuffer;
+import java.nio.FloatBuffer;
+import java.nio.IntBuffer;
+import java.nio.LongBuffer;
 
 import java.util.LinkedList;
 
@@ -90,6 +104,12 @@ public class test_pmp {
        flist.add(fh.clone());
     CGAL_Polygon_mesh_processing.isotropic_remeshing(
       flist.iterator(),0.25, P);
+    flist.clear();
+    for (Polyhedron_3_Facet_handle fh : P.facets())
+      flist.add(fh.clone());
+    CGAL_Polygon_mesh_processing.isotropic_remeshing(
+      flist.iterator(), 0.05, P, 3, true);
+    assert P.is_valid() && P.has_compact_ids();
 // split_long_edges
     hlist.clear();
     for (Polyhedron_3_Halfedge_handle hh : P.halfedges())
@@ -121,6 +141,20 @@ public class test_pmp {
     CGAL_Polygon_mesh_processing.triangulate_refine_and_fair_hole(P, h, outf, outv, 1.4);
     h=P.make_hole(hlist.getFirst());
     CGAL_Polygon_mesh_processing.triangulate_refine_and_fair_hole(P, h, outf, outv, 1.4, 1);
+// fill_all_holes
+    P=get_poly();
+    P.make_hole(P.halfedges().next());
+    Hole_filling_statistics stats =
+      CGAL_Polygon_mesh_processing.fill_all_holes(P, 0, Hole_filling_mode.TRIANGULATE_REFINE_AND_FAIR_HOLE);
+    if (stats.number_of_holes()!=1 || stats.number_of_filled_holes()!=1)
+      throw new AssertionError("Incorrect number of filled holes");
+    if (stats.border_size_array().get(0)!=3 || !P.is_closed() ||
+        P.size_of_facets()!=3+stats.facet_count_array().get(0))
+      throw new AssertionError("Incorrect hole filling");
+    P.make_hole(P.halfedges().next());
+    stats = CGAL_Polygon_mesh_processing.fill_all_holes(P, 2, Hole_filling_mode.TRIANGULATE_HOLE);
+    if (stats.status_array().get(0)!=-1 || P.is_closed())
+      throw new AssertionError("A too large hole was filled");
 // triangulate_hole_polyline
     LinkedList<Point_3> points = new LinkedList<Point_3>();
     points.add( new Point_3( 0, 0, 0) );
@@ -146,6 +180,9 @@ public class test_pmp {
 // self_intersections
     LinkedList<Facet_pair> out = new LinkedList<Facet_pair>();
     CGAL_Polygon_mesh_processing.self_intersections(P, out);
+    IntBuffer pairs = CGAL_Polygon_mesh_processing.self_intersections(P);
+    if (pairs.capacity()!=2*out.size())
+      throw new AssertionError("Incorrect number of self intersecting pairs");
   }
 
   public static void test_orientation_functions()
@@ -248,6 +285,17 @@ public class test_pmp {
     normals.clear();
     CGAL_Polygon_mesh_processing.compute_vertex_normals(P, normals);
     if (normals.size()!=P.size_of_vertices()) throw new AssertionError("Pb 6");
+//  into arrays, then only around the first facet
+    DoubleBuffer face_normals = ByteBuffer.allocateDirect(3*8*P.size_of_facets()).order(ByteOrder.nativeOrder()).asDoubleBuffer();
+    CGAL_Polygon_mesh_processing.compute_face_normals(P, face_normals);
+    FloatBuffer vertex_normals = ByteBuffer.allocateDirect(3*4*P.size_of_vertices()).order(ByteOrder.nativeOrder()).asFloatBuffer();
+    CGAL_Polygon_mesh_processing.compute_vertex_normals(P, vertex_normals);
+    if (Math.abs(vertex_normals.get(0)-normals.get(0).x())>1e-5) throw new AssertionError("Pb 7");
+    P.compact();
+    IntBuffer changed = ByteBuffer.allocateDirect(4).order(ByteOrder.nativeOrder()).asIntBuffer();
+    changed.put(0, 0);
+    CGAL_Polygon_mesh_processing.compute_face_normals(P, face_normals, changed);
+    CGAL_Polygon_mesh_processing.compute_vertex_normals(P, vertex_normals, changed);
   }
 
   public static void test_connected_components_functions()
@@ -329,6 +377,17 @@ public class test_pmp {
     slicer.slice(new Plane_3(1,0,0,-0.5), slice);
     if (slice.size()!=1) throw new AssertionError("Incorrect size");
     if (slice.get(0).size()==0) throw new AssertionError("no points created");
+    // one plane per row: a, b, c, d
+    DoubleBuffer planes = ByteBuffer.allocateDirect(12*8).order(ByteOrder.nativeOrder()).asDoubleBuffer();
+    planes.put(new double[]{1,0,0,-0.5, 1,0,0,-4, 0,1,0,-0.25});
+    Polyline_batch batch = slicer.slice_batch(planes);
+    if (batch.number_of_planes()!=3) throw new AssertionError("Incorrect number of planes");
+    LongBuffer plane_offsets = batch.plane_offset_array();
+    if (plane_offsets.get(1)-plane_offsets.get(0)!=1 || plane_offsets.get(2)!=plane_offsets.get(1))
+      throw new AssertionError("Incorrect number of polylines");
+    LongBuffer polyline_offsets = batch.polyline_offset_array();
+    if (polyline_offsets.get(1)-polyline_offsets.get(0)!=slice.get(0).size())
+      throw new AssertionError("Incorrect number of points");
   }
 
   public static void test_side_of_triangle_mesh()
@@ -342,6 +401,71 @@ public class test_pmp {
       throw new AssertionError("Pt should be on boundary");
     if (f.bounded_side(new Point_3(4,0,0))!=Bounded_side.ON_UNBOUNDED_SIDE )
       throw new AssertionError("Pt should be on unbounded side");
+    DoubleBuffer points = ByteBuffer.allocateDirect(9*8).order(ByteOrder.nativeOrder()).asDoubleBuffer();
+    points.put(new double[]{0.25,0.25,0.25, 0,0,0, 4,0,0});
+    ByteBuffer sides = f.bounded_side_batch(points);
+    if (sides.get(0)!=1 || sides.get(1)!=0 || sides.get(2)!=-1)
+      throw new AssertionError("Incorrect batch sides");
+    // reuse an existing tree on the facets
+    AABB_tree_Polyhedron_3_Facet_handle tree = new AABB_tree_Polyhedron_3_Facet_handle(P.facets());
+    Side_of_triangle_mesh g = new Side_of_triangle_mesh(tree);
+    if (g.bounded_side(new Point_3(0.25,0.25,0.25))!=Bounded_side.ON_BOUNDED_SIDE )
+      throw new AssertionError("Pt should be on bounded side");
+    sides = g.bounded_side_batch(points);
+    if (sides.get(0)!=1 || sides.get(1)!=0 || sides.get(2)!=-1)
+      throw new AssertionError("Incorrect batch sides");
+    // the tree of P is cached until P is modified
+    sides = new Side_of_triangle_mesh(P).bounded_side_batch(points);
+    if (sides.get(0)!=1 || sides.get(1)!=0 || sides.get(2)!=-1)
+      throw new AssertionError("Incorrect batch sides with the cached tree");
+    Point_3 p = new Point_3(1.2,0.05,0.05);
+    if (new Side_of_triangle_mesh(P).bounded_side(p)!=Bounded_side.ON_UNBOUNDED_SIDE)
+      throw new AssertionError("Pt should be on unbounded side");
+    for (Polyhedron_3_Vertex_handle vh : P.vertices())
+      if (vh.point().x()==1) vh.set_point(new Point_3(2,0,0));
+    if (new Side_of_triangle_mesh(P).bounded_side(p)!=Bounded_side.ON_BOUNDED_SIDE)
+      throw new AssertionError("The cached tree was not updated");
+    P.clear_cache();
+  }
+
+  public static Surface_mesh_3 get_tetrahedron(double shift){
+    DoubleBuffer vertices = ByteBuffer.allocateDirect(12*8).order(ByteOrder.nativeOrder()).asDoubleBuffer();
+    vertices.put(new double[]{shift,0,0, 1+shift,0,0, shift,1,0, shift,0,1});
+    IntBuffer faces = ByteBuffer.allocateDirect(12*4).order(ByteOrder.nativeOrder()).asIntBuffer();
+    faces.put(new int[]{0,2,1, 0,1,3, 0,3,2, 1,2,3});
+    return new Surface_mesh_3(vertices, faces);
+  }
+
+  public static void test_surface_mesh(){
+    System.out.println("Testing Surface_mesh_3 variants...");
+    Surface_mesh_3 M = get_tetrahedron(0);
+    if (M.number_of_vertices()!=4 || M.number_of_faces()!=4 || !M.is_closed())
+      throw new AssertionError("Incorrect tetrahedron");
+    if (!CGAL_Polygon_mesh_processing.is_outward_oriented(M))
+      throw new AssertionError("Tetrahedron should be outward oriented");
+    if (Math.abs(CGAL_Polygon_mesh_processing.volume(M)-1./6)>1e-12)
+      throw new AssertionError("Incorrect volume");
+    if (CGAL_Polygon_mesh_processing.compute_face_normals(M).capacity()!=12)
+      throw new AssertionError("Incorrect number of face normals");
+    // the tree shares the mesh
+    AABB_tree_Surface_mesh_3 tree = new AABB_tree_Surface_mesh_3(M);
+    if (tree.size()!=4 || Math.abs(tree.squared_distance(new Point_3(2,0,0))-1)>1e-12)
+      throw new AssertionError("Incorrect tree");
+    CGAL_Polygon_mesh_processing.isotropic_remeshing(0.1, M);
+    M.collect_garbage();
+    if (M.number_of_faces()<=4 || !M.is_closed())
+      throw new AssertionError("Incorrect remeshing");
+    Surface_mesh_3 U = new Surface_mesh_3();
+    if (!CGAL_Polygon_mesh_processing.corefine_and_compute_union(get_tetrahedron(0), get_tetrahedron(0.5), U) || !U.is_closed())
+      throw new AssertionError("Incorrect union");
+    // two overlapping tetrahedra and a distant one
+    Surface_mesh_3_Vector parts = new Surface_mesh_3_Vector();
+    parts.add(get_tetrahedron(0));
+    parts.add(get_tetrahedron(0.5));
+    parts.add(get_tetrahedron(10));
+    Surface_mesh_3 V = new Surface_mesh_3();
+    if (!CGAL_Polygon_mesh_processing.corefine_and_compute_union_all(parts, V) || V.number_of_faces()!=U.number_of_faces()+4)
+      throw new AssertionError("Incorrect n-ary union");
   }
 
   public static void main(String arg[]){
@@ -356,5 +480,6 @@ public class test_pmp {
     test_miscellaneous_functions();
     test_polygon_mesh_slicer();
     test_side_of_triangle_mesh();
+    test_surface_mesh();
   }
 }
@@ -88,5 +88,15 @@ public class test_polyhedron {
     System.out.println(p.size_of_vertices()); 
     for (Polyhedron_3_Vertex_handle hh : p.vertices())
       System.out.println(hh.point()); 
+
+    //round trip through flat arrays
+    Polyhedron_3 t=Polyhedron_3.from_arrays(new double[]{0,0,0, 1,0,0, 0,1,0, 0,0,1},
+                                            new int[]{0,2,1, 0,1,3, 0,3,2, 1,2,3});
+    if (t.size_of_vertices()!=4 || t.size_of_facets()!=4 || !t.is_closed())
+      throw new AssertionError("Incorrect polyhedron built from arrays");
+    java.nio.DoubleBuffer vertices=t.vertex_array();
+    java.nio.IntBuffer faces=t.face_array();
+    if (vertices.capacity()!=12 || faces.capacity()!=12 || vertices.get(3)!=1)
+      throw new AssertionError("Incorrect arrays exported from a polyhedron");
   }
 };
@@ -3,8 +3,13 @@ import CGAL.Kernel.Weighted_point_3;
 import CGAL.Kernel.CGAL_Kernel;
 import CGAL.Triangulation_3.Regular_triangulation_3;
 import CGAL.Triangulation_3.Regular_triangulation_3_Vertex_handle;
+import CGAL.Triangulation_3.Parallel_Regular_triangulation_3;
 import java.util.LinkedList;
 import java.util.Iterator;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.DoubleBuffer;
+import java.nio.IntBuffer;
 
 public class test_rt3 {
   public static void main(String arg[]){
@@ -24,6 +29,21 @@ public class test_rt3 {
   lsti.add(new Weighted_point_3(new Point_3(14,0,45),4));     
   t.insert(lsti.iterator());
   System.out.println("insert range OK");   
+
+  //the center of the cube, with a negative weight, is hidden by the corners
+  DoubleBuffer coords=ByteBuffer.allocateDirect(8*4*9).order(ByteOrder.nativeOrder()).asDoubleBuffer();
+  for (int x=0;x<2;++x)
+    for (int y=0;y<2;++y)
+      for (int z=0;z<2;++z)
+        coords.put(new double[]{x,y,z,0});
+  coords.put(new double[]{0.5,0.5,0.5,-10});
+  Parallel_Regular_triangulation_3 pt=new Parallel_Regular_triangulation_3();
+  if (pt.insert_from_array(coords)!=8 || !pt.is_valid())
+    throw new AssertionError("insert_from_array");
+  IntBuffer hidden=pt.hidden_rows(coords);
+  if (hidden.capacity()!=1 || hidden.get(0)!=8)
+    throw new AssertionError("hidden_rows");
+  System.out.println("parallel insert from array OK");
     
     
   Iterator<Regular_triangulation_3_Vertex_handle> it=t.finite_vertices();
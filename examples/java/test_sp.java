@@ -4,6 +4,11 @@ import CGAL.Spatial_searching.Orthogonal_incremental_neighbor_search_tree_2;
 import CGAL.Spatial_searching.Orthogonal_incremental_neighbor_search_2;
 import CGAL.Spatial_searching.Orthogonal_incremental_neighbor_search_tree_3;
 import CGAL.Spatial_searching.Orthogonal_incremental_neighbor_search_3;
+import CGAL.Spatial_searching.Orthogonal_k_neighbor_search_tree_3;
+import CGAL.Spatial_searching.Neighbor_batch;
+import CGAL.Spatial_searching.Radius_neighbors;
+import CGAL.Spatial_searching.Index_kd_tree_3;
+import CGAL.Spatial_searching.Voxel_grid_3;
 import CGAL.Spatial_searching.K_neighbor_search_tree_2;
 import CGAL.Spatial_searching.K_neighbor_search_2;
 import CGAL.Spatial_searching.Point_with_transformed_distance_2;
@@ -17,6 +22,11 @@ import CGAL.Spatial_searching.Orthogonal_k_neighbor_search_with_info_3;
 import CGAL.Spatial_searching.Point_with_info_with_transformed_distance_3;
 import CGAL.Java.JavaData;
 import java.util.LinkedList;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.DoubleBuffer;
+import java.nio.IntBuffer;
+import java.nio.LongBuffer;
 
 
 
@@ -85,7 +95,26 @@ public class test_sp {
     
     for (Point_with_transformed_distance_3 p : search.iterator())
       System.out.println(p.getFirst()+" "+p.getSecond());    
-    
+
+    //batched k-nearest neighbor queries: 3 coordinates per query
+    Orthogonal_k_neighbor_search_tree_3 tree2=new Orthogonal_k_neighbor_search_tree_3(lst.iterator());
+    tree2.build(true); //parallel splitting, same tree as build()
+    DoubleBuffer queries = ByteBuffer.allocateDirect(6*8).order(ByteOrder.nativeOrder()).asDoubleBuffer();
+    queries.put(new double[]{0,0,0, 40,2,3});
+    Neighbor_batch neighbors = tree2.knn_batch(queries,2);
+    IntBuffer indices = neighbors.index_array();
+    DoubleBuffer distances = neighbors.distance_array();
+    for (int q=0; q<neighbors.number_of_queries(); ++q)
+      for (int j=0; j<neighbors.k(); ++j)
+        System.out.println(q+": #"+indices.get(q*neighbors.k()+j)+" "+distances.get(q*neighbors.k()+j));
+
+    //radius graph in compressed sparse row layout
+    Radius_neighbors graph = tree2.radius_neighbors_csr(queries,10);
+    LongBuffer offsets = graph.offset_array();
+    IntBuffer ids = graph.index_array();
+    for (int q=0; q<graph.number_of_queries(); ++q)
+      for (long i=offsets.get(q); i<offsets.get(q+1); ++i)
+        System.out.println(q+": #"+ids.get((int)i));
   }
   
   public static void test_with_info_3()
@@ -108,10 +137,45 @@ public class test_sp {
         
   }
   
+  public static void test_index_tree()
+  {
+    System.out.println("Test index tree");
+    DoubleBuffer coordinates = ByteBuffer.allocateDirect(18*8).order(ByteOrder.nativeOrder()).asDoubleBuffer();
+    coordinates.put(new double[]{0,0,1, 0,4,2, 44,0,3, 44,5,4, 444,51,5, 14,1,7});
+    IntBuffer ids = ByteBuffer.allocateDirect(6*4).order(ByteOrder.nativeOrder()).asIntBuffer();
+    ids.put(new int[]{10,11,12,13,14,15});
+    Index_kd_tree_3 tree = new Index_kd_tree_3(coordinates,ids);
+    tree.build();
+    System.out.println(tree.nearest(new Point_3(40,2,3)));
+    IntBuffer in_sphere = tree.search(new Point_3(0,0,0),5);
+    System.out.println(in_sphere.capacity()+" point(s) in sphere");
+
+    String filename = System.getProperty("java.io.tmpdir") + "/test_sp.kdt";
+    tree.save(filename);
+    Index_kd_tree_3 loaded = Index_kd_tree_3.load(filename);
+    new java.io.File(filename).delete();
+    System.out.println(loaded.nearest(new Point_3(40,2,3)));
+  }
+
+  public static void test_voxel_grid()
+  {
+    System.out.println("Test voxel grid");
+    DoubleBuffer coordinates = ByteBuffer.allocateDirect(18*8).order(ByteOrder.nativeOrder()).asDoubleBuffer();
+    coordinates.put(new double[]{0,0,1, 0,4,2, 44,0,3, 44,5,4, 444,51,5, 14,1,7});
+    Voxel_grid_3 grid = new Voxel_grid_3(coordinates,10);
+    System.out.println(grid.number_of_voxels()+" voxel(s) for "+grid.size()+" point(s)");
+    IntBuffer in_sphere = grid.search(new Point_3(0,0,0),5);
+    System.out.println(in_sphere.capacity()+" point(s) in sphere");
+    IntBuffer representatives = grid.representative_array();
+    System.out.println(representatives.capacity()+" point(s) kept by grid simplification");
+  }
+
   public static void main(String arg[]){
     test_2d();
     test_3d();
     test_with_info_3();
+    test_index_tree();
+    test_voxel_grid();
     
 
   }
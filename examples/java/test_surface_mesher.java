@@ -10,9 +10,16 @@ import CGAL.Surface_mesher.Gray_level_image_3;
 import CGAL.Surface_mesher.Implicit_surface_Gray_level_image_3;
 import CGAL.Surface_mesher.Surface_mesh_default_criteria_3;
 import CGAL.Surface_mesher.Surface_mesher_tag;
+import CGAL.Surface_mesher.Sdf_grid_3;
+import CGAL.Surface_mesher.Implicit_surface_Sdf_grid_3;
+import CGAL.Surface_mesher.C2T3_arrays;
 import CGAL.Polyhedron_3.Polyhedron_3;
 import java.util.LinkedList;
 import java.io.File;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.DoubleBuffer;
+import java.nio.IntBuffer;
 
 public class test_surface_mesher {
   public static void main(String arg[]){
@@ -36,6 +43,32 @@ public class test_surface_mesher {
     for (Surface_mesh_default_triangulation_3_Edge f : c2t3.boundary_edges())
       ++i;
 
+    // Signed distance to the sphere of radius 0.8 sampled on a grid
+    int n=21;
+    double h=2./(n-1);
+    DoubleBuffer values=ByteBuffer.allocateDirect(8*n*n*n).order(ByteOrder.nativeOrder()).asDoubleBuffer();
+    for (int k=0;k<n;++k)
+      for (int j=0;j<n;++j)
+        for (int l=0;l<n;++l){
+          double x=-1+l*h, y=-1+j*h, z=-1+k*h;
+          values.put(Math.sqrt(x*x+y*y+z*z)-0.8);
+        }
+    Sdf_grid_3 sdf=new Sdf_grid_3(values,n,n,n,new Point_3(-1,-1,-1),h,h,h);
+    Surface_mesh_default_triangulation_3 sdf_tri=new Surface_mesh_default_triangulation_3();
+    Complex_2_in_triangulation_3 sdf_c2t3=new Complex_2_in_triangulation_3(sdf_tri);
+    CGAL_Surface_mesher.make_surface_mesh(sdf_c2t3,
+      new Implicit_surface_Sdf_grid_3(sdf,new Sphere_3(new Point_3(0,0,0),1),1e-5),
+      new Surface_mesh_default_criteria_3(30.,0.1,0.01),Surface_mesher_tag.MANIFOLD_TAG);
+    if (sdf_c2t3.number_of_facets()==0)
+      throw new AssertionError("Empty mesh of the SDF grid");
+    C2T3_arrays arrays=sdf_c2t3.to_arrays();
+    IntBuffer triangles=arrays.triangle_array();
+    if (arrays.number_of_triangles()!=sdf_c2t3.number_of_facets() || triangles.capacity()!=3*arrays.number_of_triangles())
+      throw new AssertionError("Wrong number of triangles");
+    if (arrays.point_array().capacity()!=3*arrays.number_of_points())
+      throw new AssertionError("Wrong number of points");
+    sdf_c2t3.write_ply("/tmp/test_sdf_sphere.ply");
+
     File f = new File("skull_2.9.inr");
     if(!f.isFile()){
       System.err.println("Error: Cannot open skull_2.9.inr");
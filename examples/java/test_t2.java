@@ -15,11 +15,16 @@ import CGAL.Triangulation_2.Constrained_Delaunay_triangulation_plus_2_Constraint
 import CGAL.Triangulation_2.Constrained_Delaunay_triangulation_plus_2_Constraint_id;
 import CGAL.Triangulation_2.Constrained_Delaunay_triangulation_plus_2_Context;
 import CGAL.Triangulation_2.Locate_type;
+import CGAL.Triangulation_2.Triangulation_2_arrays;
 import CGAL.Kernel.Ref_int;
 import CGAL.Triangulation_2.Ref_Locate_type_2;
 import CGAL.Java.JavaData;
 import java.util.Iterator;
 import java.util.LinkedList;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.DoubleBuffer;
+import java.nio.IntBuffer;
 
 public class test_t2 {
   public static void main(String arg[]){
@@ -175,6 +180,27 @@ public class test_t2 {
     if (loc.object()==Locate_type.VERTEX && res.vertex(rint.object()).point().equals(array[0])) System.out.println("Locate OK");
     else    throw new AssertionError("ERROR!!!!");
     
+
+    //insertion from an array of coordinates
+    double[] xy = {0, 0, 1, 0, 0, 1, 1, 1, 0.5, 0.5, 0, 0};
+    DoubleBuffer coords = ByteBuffer.allocateDirect(8*xy.length).order(ByteOrder.nativeOrder()).asDoubleBuffer();
+    coords.put(xy);
+    Delaunay_triangulation_2 dt_array = new Delaunay_triangulation_2();
+    if (dt_array.insert_from_array(coords)!=5 || !dt_array.is_valid())
+      throw new AssertionError("insert_from_array");
+
+    //bulk insertion of constraints: a square and a diagonal
+    DoubleBuffer square = ByteBuffer.allocateDirect(8*8).order(ByteOrder.nativeOrder()).asDoubleBuffer();
+    square.put(new double[]{0,0,1,0,1,1,0,1});
+    IntBuffer segments = ByteBuffer.allocateDirect(4*10).order(ByteOrder.nativeOrder()).asIntBuffer();
+    segments.put(new int[]{0,1,1,2,2,3,3,0,0,2});
+    Constrained_Delaunay_triangulation_plus_2 cdt_array = new Constrained_Delaunay_triangulation_plus_2();
+    if (cdt_array.insert_constraints(square,segments)!=4 || !cdt_array.is_valid())
+      throw new AssertionError("insert_constraints");
+
+    Triangulation_2_arrays arrays = cdt_array.to_arrays();
+    if (arrays.number_of_faces()!=2 || arrays.face_array().capacity()!=6 || arrays.constrained_edge_array().get(0)!=1)
+      throw new AssertionError("to_arrays");
   }
 
 
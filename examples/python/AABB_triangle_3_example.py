@@ -1,8 +1,13 @@
 from __future__ import print_function
+from array import array
 from CGAL.CGAL_Kernel import Point_3
 from CGAL.CGAL_Kernel import Triangle_3
 from CGAL.CGAL_Kernel import Ray_3
 from CGAL.CGAL_AABB_tree import AABB_tree_Triangle_3_soup
+from CGAL.CGAL_AABB_tree import AABB_tree_indexed_Triangle_3_soup
+from CGAL.CGAL_AABB_tree import Flat_AABB_tree_3
+import os
+import tempfile
 
 a = Point_3(1.0, 0.0, 0.0)
 b = Point_3(0.0, 1.0, 0.0)
@@ -16,6 +21,9 @@ triangles.append(Triangle_3(a, d, c))
 
 # constructs AABB tree
 tree = AABB_tree_Triangle_3_soup(triangles)
+# constructs the hierarchy and the distance query search tree now rather
+# than at the first query
+tree.prepare()
 
 # counts #intersections
 ray_query = Ray_3(a, b)
@@ -27,3 +35,57 @@ point_query = Point_3(2.0, 2.0, 2.0)
 closest_point = tree.closest_point(point_query)
 sqd = tree.squared_distance(point_query)
 print("squared distance: ", sqd)
+
+# batched queries on (n,3) arrays, run in parallel
+origins = array('d', [2.0, 2.0, 2.0, 0.1, 0.1, 2.0])
+directions = array('d', [-1.0, -1.0, -1.0, 0.0, 0.0, -1.0])
+hits = tree.first_intersection_batch(origins, directions)
+ids = hits.primitive_id_array()
+parameters = hits.parameter_array()
+points = hits.point_array()
+for q in range(hits.number_of_queries()):
+    print("ray", q, "hits primitive", ids[q], "at t =", parameters[q],
+          (points[q, 0], points[q, 1], points[q, 2]))
+
+queries = array('d', [2.0, 2.0, 2.0, -1.0, 0.0, 0.0])
+closest = tree.closest_point_batch(queries)
+print("closest primitives:", list(closest.primitive_id_array()))
+print("squared distances:", list(tree.squared_distance_batch(queries)))
+
+# tree on (V,3) vertex and (F,3) vertex index arrays: the primitive id is
+# the row of the triangle in the index array
+vertices = array('d', [1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0])
+faces = array('i', [0, 1, 2, 0, 1, 3, 0, 3, 2])
+indexed_tree = AABB_tree_indexed_Triangle_3_soup(vertices, faces)
+indexed_tree.prepare()
+print(indexed_tree.size(), "triangles,", indexed_tree.number_of_vertices(), "vertices")
+print("squared distance: ", indexed_tree.squared_distance(point_query))
+hits = indexed_tree.first_intersection_batch(origins, directions)
+print("hit primitives:", list(hits.primitive_id_array()))
+
+# slices by the planes z=0.5 and x=2 (a, b, c, d of ax+by+cz+d=0): the
+# intersections of plane q are the rows offsets[q] to offsets[q+1]-1, with
+# their type (2 for a segment) and vertices
+slices = indexed_tree.plane_intersections_batch(array('d', [0.0, 0.0, 1.0, -0.5, 1.0, 0.0, 0.0, -2.0]))
+offsets = slices.offset_array()
+assert list(offsets) == [0, 2, 2]
+assert sorted(slices.primitive_id_array()) == [0, 2]
+assert list(slices.type_array()) == [2, 2]
+segments = slices.point_array()
+for k in range(offsets[0], offsets[1]):
+    print("slice of primitive", slices.primitive_id_array()[k], ":",
+          [segments[k, i] for i in range(6)])
+
+# flat tree on the same arrays: once built it can be saved, and loaded back
+# by mapping the file in memory
+flat_tree = Flat_AABB_tree_3(vertices, faces)
+flat_tree.build()
+filename = os.path.join(tempfile.gettempdir(), "aabb_tree_example.bin")
+flat_tree.save(filename)
+loaded_tree = Flat_AABB_tree_3.load(filename)
+print(loaded_tree.size(), "triangles loaded, mapped:", loaded_tree.is_mapped())
+hits = loaded_tree.first_intersection_batch(origins, directions)
+print("hit primitives:", list(hits.primitive_id_array()))
+print("squared distances:", list(loaded_tree.squared_distance_batch(queries)))
+del loaded_tree, hits
+os.remove(filename)
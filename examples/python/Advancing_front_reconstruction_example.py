@@ -17,3 +17,25 @@ P = Polyhedron_3()
 advancing_front_surface_reconstruction(points, P)
 
 P.write_to_file("oni.off")
+
+# reconstructions from an array of points, sharing the Delaunay triangulation
+coords = points.point_array()
+n = points.size()
+facets = advancing_front_surface_reconstruction_arrays(coords).tolist()
+
+
+def facet_set(facets):
+    # the order of the facets depends on the (concurrent) insertion order
+    return set(tuple(sorted(f)) for f in facets)
+
+print("reconstruction from an array:", len(facets), "facets")
+assert len(facets) > 0
+assert all(0 <= i < n for f in facets for i in f)
+
+dt = Advancing_front_triangulation_3.from_array(coords)
+assert dt.number_of_vertices() <= n
+assert facet_set(dt.reconstruct().tolist()) == facet_set(facets)
+for ratio in [2, 10]:
+    print("radius ratio bound", ratio, ":", len(dt.reconstruct(ratio).tolist()), "facets")
+# the same triangulation again, with the default parameters
+assert facet_set(dt.reconstruct().tolist()) == facet_set(facets)
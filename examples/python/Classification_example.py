@@ -6,6 +6,7 @@ from CGAL.CGAL_Classification import *
 
 import sys
 import os
+from array import array
 
 datadir = os.environ.get('DATADIR', '../data')
 datafile = datadir + '/b9_training.ply'
@@ -37,10 +38,40 @@ if points.has_int_map("red") and points.has_int_map(
 
 features.end_parallel_additions()
 
+# the same families in one call: all those available in the point set,
+# computed in parallel
+families = Feature_set()
+generator.generate_features(families)
+assert families.size() >= features.size()
+
+# a subset of the families, at two of the scales only
+subset = Feature_set()
+generator.select_scales(array('i', [0, 2]))
+generator.generate_features(subset, POINT_BASED_FEATURES | COLOR_BASED_FEATURES)
+generator.select_scales(array('i'))
+assert 0 < subset.size() < features.size()
+
 print("10 first features are:")
 for idx in range(min(10, features.size())):
     print(" Feature", idx, ":", features.get(idx).name())
 
+# all the values at once, one row per point (numpy.asarray() wraps it)
+matrix = features.to_matrix(points.size())
+assert matrix.shape == (points.size(), features.size())
+assert abs(matrix[1, 2] - features.get(2).value(1)) < 1e-6
+
+# features given as columns, here the squared first two features (kept
+# apart from the features of the classifier)
+columns = Feature_set()
+extra = array('f', [0.] * (2 * points.size()))
+for idx in range(points.size()):
+    extra[2 * idx] = matrix[idx, 0] ** 2
+    extra[2 * idx + 1] = matrix[idx, 1] ** 2
+columns.add_features(extra, 2, "squared")
+alone = columns.add_feature("zero", array('f', [0.] * points.size()))
+assert columns.size() == 3 and alone.value(0) == 0.
+assert columns.get(0).name() == "squared_0"
+
 classification = points.int_map("label")
 if not classification.is_valid():
     print("No ground truth found. Exiting.")
@@ -55,9 +86,26 @@ print("Training random forest classifier...")
 classifier = ETHZ_Random_forest_classifier(labels, features)
 classifier.train(points.range(training), num_trees=50, max_depth=30)
 
+# the same training, the trees trained in parallel from the labels viewed as
+# an int32 array
+classifier.train_from_array(points.property_array(training), True, 50, 30)
+
+# trees added on balanced subsamples of at most 10000 points per label
+classifier.train_from_array(points.property_array(training), False, 8, 30, 10000)
+
 print("Saving classifier's trained configuration...")
 classifier.save_configuration("trained_random_forest.gz")
 
+# the forest is parsed once per process, then shared by the classifiers
+# loading the same file
+reloaded = ETHZ_Random_forest_classifier(labels, features)
+reloaded.load_cached_configuration("trained_random_forest.gz")
+reloaded_again = ETHZ_Random_forest_classifier(labels, features)
+reloaded_again.load_cached_configuration("trained_random_forest.gz")
+# classifier sharing the trained forest without copying it
+shared = ETHZ_Random_forest_classifier(labels, features, classifier)
+ETHZ_Random_forest_classifier.clear_configuration_cache()
+
 # classification map will be overwritten
 if len(sys.argv) > 1:
     if sys.argv[1] == "-g" or sys.argv[1] == "--graphcut":
@@ -74,7 +122,33 @@ if len(sys.argv) > 1:
         print("Classifying with local smoothing...")
         classify_with_local_smoothing(
             points, labels, classifier,
-            generator.neighborhood().k_neighbor_query(6), classification)
+            generator.neighbor_query(0), classification)
+    elif sys.argv[1] == "-G" or sys.argv[1] == "--subdivided-graphcut":
+        print("Classifying with graphcut on subdivisions...")
+        stats = classify_with_graphcut_subdivided(
+            points, labels, classifier,
+            generator.neighborhood().k_neighbor_query(6),
+            0.5,  # strength of graphcut
+            20 * generator.radius_neighbors(0),  # size of the subdivisions
+            classification,
+            ALPHA_EXPANSION_BOOST_COMPRESSED_SPARSE_ROW)
+        print(" ", stats.number_of_subdivisions(), "subdivisions in",
+              stats.total_time(), "s (neighborhood", stats.neighborhood_time(),
+              "s, energy", stats.energy_time(), "s, graphcut",
+              stats.graphcut_time(), "s)")
+    elif sys.argv[1] == "-t" or sys.argv[1] == "--tiled":
+        print("Classifying by tiles...")
+        coords = points.point_array()
+        extent = max(
+            max(coords[i, c] for i in range(points.size())) -
+            min(coords[i, c] for i in range(points.size())) for c in (0, 1))
+        # same scales as the generator, halo covering the largest scale
+        classify_tiled(points, labels, classifier,
+                       generator.number_of_scales(),
+                       generator.grid_resolution(0),
+                       extent / 2,
+                       generator.radius_neighbors(generator.number_of_scales() - 1),
+                       classification)
     else:
         print("Unknown option", sys.argv[1])
         exit(-1)
@@ -93,9 +167,46 @@ print(" * Accuracy =", evaluation.accuracy())
 print(" * Mean F1 score =", evaluation.mean_f1_score())
 print(" * Mean IoU =", evaluation.mean_intersection_over_union())
 
+# the same evaluation accumulated over two halves of int32 label arrays,
+# as it would be over tiles
+gt = points.property_array(training).cast('B').cast('i')
+res = points.property_array(classification).cast('B').cast('i')
+half = points.size() // 2
+streamed = Evaluation(labels)
+streamed.append(gt[:half], res[:half])
+streamed.append(Evaluation(labels, gt[half:], res[half:]))
+assert streamed.number_of_items() == evaluation.number_of_items()
+assert abs(streamed.accuracy() - evaluation.accuracy()) < 1e-9
+print(" * Confusion matrix (rows: ground truth):", streamed.confusion_matrix().tolist())
+
 print("Per label evaluation:")
 
 for label in [ground, vegetation, building]:
     print(" *", label.name(), ": precision =", evaluation.precision(label),
           "; recall =", evaluation.recall(label), "; iou =",
           evaluation.intersection_over_union(label))
+
+# Classification of clusters of points (here the cells of a grid in the xy
+# plane, usually the regions of a region growing) instead of the points
+print("Classifying clusters...")
+coords = points.point_array()
+cell_size = 4 * generator.radius_neighbors(0)
+cells = {}
+region_ids = array('i')
+for i in range(points.size()):
+    cell = (int(coords[i, 0] // cell_size), int(coords[i, 1] // cell_size))
+    region_ids.append(cells.setdefault(cell, len(cells)))
+clusters = Cluster_set(points, region_ids)
+assert clusters.size() == len(cells)
+assert sum(clusters.number_of_points(c) for c in range(clusters.size())) == points.size()
+
+cluster_features = Feature_set()
+clusters.generate_features(cluster_features, features)
+# mean and variance of each point feature, size and vertical extent
+assert cluster_features.size() == 2 * features.size() + 2
+cluster_classifier = ETHZ_Random_forest_classifier(labels, cluster_features)
+cluster_classifier.train_from_array(clusters.cluster_ground_truth(points.property_array(training)))
+cluster_classification = points.add_int_map("cluster_label")
+clusters.classify(labels, cluster_classifier, cluster_classification)
+evaluation = Evaluation(labels, points.range(training), points.range(cluster_classification))
+print(" *", clusters.size(), "clusters, accuracy =", evaluation.accuracy())
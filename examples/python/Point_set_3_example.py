@@ -1,7 +1,9 @@
 from CGAL.CGAL_Kernel import Point_3
 from CGAL.CGAL_Kernel import Vector_3
 from CGAL.CGAL_Point_set_3 import Point_set_3
+from CGAL.CGAL_Point_set_3 import Mapped_point_set_3
 
+import array
 import os
 
 datadir = os.environ.get('DATADIR', '../data')
@@ -39,6 +41,23 @@ print("Normal set:")
 for n in points.normals():
     print(" *", n)
 
+# Zero-copy access to the coordinates through the buffer protocol
+# (numpy.asarray() can wrap these views without copying)
+coords = points.point_array()
+print("Point array has shape", coords.shape)
+coords[0, 2] = 0.5
+print("Point 0 modified through the array =", points.point(0))
+normals = points.normal_array()
+print("Normal 4 read from the array =", normals[4, 0], normals[4, 1], normals[4, 2])
+
+# Iterators of coordinates and indices exported in C++ to arrays
+# (without creating one Python object per value)
+print("Points exported from the iterator =", points.points().to_array().tolist())
+normal_it = points.normals()
+print("First two normals =", normal_it.next_batch(2).tolist())
+print("Remaining normals =", normal_it.next_batch(100).tolist())
+print("Indices =", points.indices().to_array().tolist())
+
 # Removal
 print("Removing point at index 2...")
 points.remove(2)
@@ -63,6 +82,15 @@ points.collect_garbage()
 print("Point set has", points.size(), "point(s) and", points.garbage_size(),
       "garbage point(s)")
 
+# compact() gives the same result as collect_garbage() in one pass per
+# property array
+kept = [(points.point(idx), points.normal(idx)) for idx in points.indices() if idx != 0]
+points.remove(0)
+points.compact()
+assert points.garbage_size() == 0
+assert [(str(points.point(i)), str(points.normal(i))) for i in range(points.size())] \
+    == [(str(p), str(n)) for p, n in kept]
+
 # Dynamic property addition
 print("Adding intensity map...")
 intensity = points.add_float_map("intensity")
@@ -87,6 +115,39 @@ if intensity.is_valid():
     # Removing the map
     points.remove_float_map(intensity)
 
+# Bulk construction from contiguous arrays (numpy arrays work the same way)
+coordinates = array.array('d', [0., 0., 0., 1., 0., 0., 0., 1., 0.])
+labels = array.array('i', [4, 2, 7])
+bulk = Point_set_3.from_arrays(coordinates, label=labels)
+print("Point set built from arrays has", bulk.size(), "point(s) and properties",
+      bulk.properties())
+print("Label of point 2 =", bulk.int_map("label").get(2))
+
+# Zero-copy access to a property column
+label_column = bulk.property_array("label")
+label_column[0] = 12
+print("Label of point 0 modified through the array =", bulk.int_map("label").get(0))
+bulk.set_property_array("weight", array.array('d', [0.5, 1., 2.]))
+print("Sum of weights =", sum(bulk.property_array("weight")))
+
+# Narrow columns: 1 byte per point for a uint8 property, 2 for a uint16 one
+bulk.set_property_array("red", array.array('B', [255, 0, 16]))
+bulk.set_property_array("intensity", array.array('H', [1000, 2000, 65535]))
+bulk.set_property_array("scan_angle", array.array('f', [-1.5, 0., 2.5]))
+assert bulk.has_uint8_map("red") and not bulk.has_int_map("red")
+assert bulk.uint8_map("red").get(0) == 255
+assert bulk.property_array("intensity").itemsize == 2
+assert bulk.float32_map("scan_angle").get(2) == 2.5
+classification = bulk.add_uint8_map("classification", 2)
+classification.set(1, 6)
+assert list(bulk.property_array(classification)) == [2, 6, 2]
+bulk.write("narrow.ps3")
+narrow = Mapped_point_set_3("narrow.ps3")
+assert narrow.has_uint16_map("intensity") and narrow.uint16_array("intensity")[2] == 65535
+bulk.write("narrow.ply")
+narrow = Point_set_3("narrow.ply")
+assert narrow.has_uint8_map("red") and narrow.has_float32_map("scan_angle")
+
 # Reading a file
 print("Clearing and reading", datafile)
 points.clear()
@@ -95,6 +156,14 @@ print(datafile, "has", points.size(), "point(s) and", points.garbage_size(),
       "garbage point(s)")
 print(datafile, "has the following properties:", (points.properties()))
 
+# Reading a file block by block
+nb_chunks = 0
+nb_read = 0
+for chunk in Point_set_3.read_chunks(datafile, 1000):
+    nb_chunks += 1
+    nb_read += chunk.size()
+print(datafile, "read in", nb_chunks, "block(s) of", nb_read, "point(s) in total")
+
 # Writing the point set to different formats
 print("Writing output to xyz...")
 if not points.write("test.xyz"):
@@ -105,6 +174,35 @@ if not points.write("test.off"):
 print("Writing output to ply...")
 if not points.write("test.ply"):
     print("Cannot write test.ply")  # this sould NOT be displayed
+print("Writing output to ps3 (columnar, memory mappable)...")
+if not points.write("test.ps3"):
+    print("Cannot write test.ps3")  # this sould NOT be displayed
 print("Trying to write output to doc...")
 if not points.write("test.doc"):
     print("Cannot write test.doc")  # this should be displayed
+
+# Memory-mapped access to a columnar file
+mapped = Mapped_point_set_3("test.ps3")
+print("test.ps3 has", mapped.size(), "point(s) and the following columns:",
+      mapped.properties())
+mapped_points = mapped.point_array()
+print("First point of test.ps3 =", mapped_points[0, 0], mapped_points[0, 1],
+      mapped_points[0, 2], "(read-only:", mapped_points.readonly, ")")
+reloaded = mapped.load()
+print("Reloaded point set has", reloaded.size(), "point(s)")
+# out of core: the points are processed by blocks, one block in memory at a time
+block_size = 1000
+nb_loaded = 0
+for first in range(0, mapped.size(), block_size):
+    block = mapped.load_range(first, min(block_size, mapped.size() - first))
+    nb_loaded += block.size()
+assert nb_loaded == mapped.size()
+print("Reloaded by blocks of", block_size, "point(s)")
+
+# Compressed columnar file, with a partial reload
+print("Writing output to psz (compressed columnar)...")
+if points.write("test.psz"):
+    compressed = Mapped_point_set_3("test.psz")
+    partial = compressed.load(["normal"])
+    print("Partially reloaded point set has", partial.size(), "point(s) and the following properties:",
+          partial.properties())
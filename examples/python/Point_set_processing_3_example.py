@@ -1,10 +1,13 @@
 from __future__ import print_function
 from CGAL.CGAL_Kernel import Point_3
 from CGAL.CGAL_Kernel import Vector_3
+from CGAL.CGAL_Kernel import Cancellation_token
 from CGAL.CGAL_Point_set_3 import Point_set_3
+from CGAL.CGAL_Triangulation_3 import Parallel_Delaunay_triangulation_3
 from CGAL.CGAL_Point_set_processing_3 import *
 
 import os
+import threading
 
 datadir = os.environ.get('DATADIR', '../data')
 datafile = datadir + '/oni.xyz'
@@ -42,8 +45,46 @@ wlop_simplify_and_regularize_point_set(
     wlop_point_set)  # Output
 print("Output of WLOP has", points.size(), "points")
 
+print("Running seeded wlop_simplify_and_regularize_point_set twice...")
+# with a seed, repeated runs give the same points
+first, second = Point_set_3(), Point_set_3()
+wlop_simplify_and_regularize_point_set(points, first, number_of_iterations=5, seed=42)
+wlop_simplify_and_regularize_point_set(points, second, number_of_iterations=5, seed=42)
+assert first.point_array().tolist() == second.point_array().tolist()
+
+print("Running wlop_simplify_and_regularize_point_set in a thread...")
+# the GIL is released during the call: this thread keeps running
+token = Cancellation_token()
+wlop_point_set = Point_set_3()
+thread = threading.Thread(target=wlop_simplify_and_regularize_point_set,
+                          args=(points, wlop_point_set),
+                          kwargs={"token": token})
+thread.start()
+while thread.is_alive():
+    thread.join(0.1)
+    print("Progress:", int(100 * token.progress()), "%")
+
+print("Running a cancelled jet_smooth_point_set...")
+token.cancel()
+try:
+    jet_smooth_point_set(points, k, token=token)
+except Exception:
+    print("Cancelled")
+token.reset()
+
+print("Running a streaming grid simplification...")
+# only one point per occupied cell is kept in memory
+streaming = Streaming_grid_simplify_point_set(avg_space / 5)
+streaming.insert(points)
+streamed = streaming.result()
+assert streamed.size() == streaming.number_of_cells()
+file_streaming = Streaming_grid_simplify_point_set(avg_space / 5)
+print(file_streaming.insert_file(datafile, chunk_size=1000), "point(s) streamed from",
+      datafile, "to", file_streaming.number_of_cells(), "cell(s)")
+
 print("Running grid_simplify_point_set...")
 grid_simplify_point_set(points, avg_space / 5)
+assert points.size() == streamed.size()
 print(points.size(), "point(s) remaining,", points.garbage_size(),
       "point(s) removed")
 points.collect_garbage()
@@ -75,11 +116,88 @@ points.add_normal_map()
 print("Running jet_estimate_normals...")
 jet_estimate_normals(points, 24)
 
+print("Running estimate_local_k_neighbor_scales...")
+local_k = points.add_int_map("local_k")
+estimate_local_k_neighbor_scales(points, local_k)
+print("Local k between", min(points.property_array(local_k).tolist()),
+      "and", max(points.property_array(local_k).tolist()))
+local_range = points.add_float_map("local_range")
+estimate_local_range_scales(points, local_range)
+assert min(points.property_array(local_range).tolist()) > 0.
+
+print("Running jet_estimate_normals_with_k_map...")
+# one pass with the number of neighbors adapted to the local density
+jet_estimate_normals_with_k_map(points, local_k)
+pca_estimate_normals_with_k_map(points, local_k)
+points.remove_int_map(local_k)
+points.remove_float_map(local_range)
+
 print("Running mst_orient_normals...")
 mst_orient_normals(points, 24)
 
+print("Running tiled_mst_orient_normals, marking the unoriented points...")
+unoriented = points.add_int_map("unoriented")
+size_before = points.size()
+coords = points.point_array().tolist()
+extent = max(max(c[d] for c in coords) - min(c[d] for c in coords) for d in range(3))
+# tiles of a quarter of the extent, oriented in parallel
+tiled_mst_orient_normals(points, 24, extent / 4, unoriented_map=unoriented)
+assert points.size() == size_before
+print(sum(points.property_array(unoriented).tolist()), "point(s) could not be oriented")
+points.remove_int_map(unoriented)
+
 print("Running pca_estimate_normals...")
 pca_estimate_normals(points, 24)
 
+print("Sharing the neighborhoods between several estimations...")
+cache = Neighborhood_cache(points, 24)
+print("Average spacing from the cache =", cache.compute_average_spacing())
+cache.pca_estimate_normals()
+cache.jet_estimate_normals()
+cache.remove_outliers(threshold_percent=1.5)
+print(points.size(), "point(s) remaining, neighborhoods rebuilt:", cache.update())
+points.collect_garbage()
+
+print("Scoring outliers without removing them...")
+scores = points.add_float_map("outlier_score")
+flags = points.add_int_map("outlier")
+size_before = points.size()
+nb_outliers = remove_statistical_outliers(points, 24, std_ratio=2., scores=scores,
+                                          outlier_map=flags, remove=False)
+assert points.size() == size_before
+assert sum(points.property_array(flags).tolist()) == nb_outliers
+print(nb_outliers, "statistical outlier(s), largest score",
+      max(points.property_array(scores).tolist()))
+cache = Neighborhood_cache(points, 24)
+cache.compute_outlier_scores(scores)
+print(cache.remove_radius_outliers(avg_space, 4, flags, False), "radius outlier(s)")
+points.remove_int_map(flags)
+points.remove_float_map(scores)
+
+print("Running vcm_estimate_normals...")
+vcm_estimate_normals(points, 2 * avg_space, 4 * avg_space)
+# the offset covariances are computed once per triangulation and reused
+# by the convolutions
+dt = Parallel_Delaunay_triangulation_3()
+vcm = Voronoi_covariance_measure(points, 2 * avg_space)
+vcm.compute_in_triangulation(dt)
+assert dt.number_of_vertices() == points.size()
+covariances = vcm.covariance_array(4 * avg_space)
+assert covariances.shape == (points.size(), 6)
+assert vcm.offset_covariance_array().shape == (points.size(), 6)
+vcm.estimate_normals(0., k=k)
+Voronoi_covariance_measure(points, 2 * avg_space).compute_in_triangulation(dt)
+
+print("Running a whole processing chain in one call...")
+pipeline = Point_set_pipeline()
+pipeline.add_remove_outliers(24, threshold_percent=1.5)
+pipeline.add_grid_simplify_point_set(0.01)
+pipeline.add_jet_estimate_normals(24)
+pipeline.add_mst_orient_normals(24)
+pipeline.run(points)
+for name, seconds in zip(pipeline.stage_names(), pipeline.timings()):
+    print(" *", name, "ran in", seconds, "second(s)")
+print(points.size(), "point(s) remaining")
+
 print("Writing to ply")
 points.write("oni.ply")
@@ -272,6 +272,83 @@ try:
 except Exception as e:
     print(f"Real data example skipped: {e}")
 
+# =============================================================================
+# Example 3b: Transformation computed on downsampled copies
+# =============================================================================
+print("\n" + "=" * 60)
+print("Coarse to fine ICP Example")
+print("=" * 60)
+
+try:
+    point_set_1 = create_bunny_shape(1000)
+    point_set_2 = apply_transformation(point_set_1, tx=0.1, ty=0.1, tz=0.05, angle=math.pi/12)
+    psp.pca_estimate_normals(point_set_1, 24)
+    psp.pca_estimate_normals(point_set_2, 24)
+    before = [point_set_2.point(i).x() for i in range(point_set_2.size())]
+
+    # ICP on grids of decreasing cell sizes, the points are not moved
+    from array import array
+    result = psp.registration_transformation_pointmatcher(
+        point_set_1, point_set_2, grid_sizes=array('d', [0.2, 0.05]), dry_run=True)
+    assert [point_set_2.point(i).x() for i in range(point_set_2.size())] == before
+    matrix = result.transform_array().tolist()
+    assert len(matrix) == 4 and matrix[3] == [0., 0., 0., 1.]
+    print(f"Converged: {result.converged()}, transformation: {matrix}")
+
+    # the transformation computed at low resolution is applied to the full cloud
+    result.apply(point_set_2)
+    point_set_2.write("aligned_coarse_to_fine.ply")
+except Exception as e:
+    print(f"Coarse to fine registration failed or not available: {e}")
+
+# =============================================================================
+# Example 4: Registration of several scans in one call
+# =============================================================================
+print("\n" + "=" * 60)
+print("Multi-scan Registration Example")
+print("=" * 60)
+
+try:
+    base = create_bunny_shape(1000)
+    scans = [base] + [apply_transformation(base, tx=0.05 * i, ty=0.02 * i, angle=i * math.pi / 24)
+                      for i in range(1, 4)]
+    for scan in scans:
+        psp.pca_estimate_normals(scan, 24)
+
+    registration = psp.Multi_registration(0.02)
+    for scan in scans:
+        registration.add_scan(scan)
+    # the pairs to align are the scans with overlapping bounding boxes
+    nb_edges = registration.add_overlapping_edges()
+    assert nb_edges == 6
+
+    failed = False
+    try:
+        registration.add_edge(0, 0)
+    except Exception:
+        failed = True
+    assert failed
+
+    # all the pairs are aligned in parallel, then refined by ICP
+    registration.run_opengr(number_of_samples=200, accuracy=0.01, overlap=0.8,
+                            maximum_running_time=60)
+    registration.run_icp()
+    import numpy as np
+    edges = np.asarray(registration.edge_array())
+    transforms = np.asarray(registration.transform_array())
+    fitness = np.asarray(registration.fitness_array())
+    assert edges.shape == (6, 2) and transforms.shape == (6, 16) and fitness.shape == (6,)
+    print(f"Fitness of the pairs: {fitness}")
+
+    registration.optimize_poses(reference=0)
+    poses = np.asarray(registration.pose_array()).reshape(-1, 4, 4)
+    assert poses.shape == (4, 4, 4)
+    assert np.allclose(poses[0], np.identity(4))
+    print(f"Registered scans: {list(registration.registered_array())}")
+    registration.apply_poses()
+except Exception as e:
+    print(f"Multi-scan registration failed or not available: {e}")
+
 print("\n" + "=" * 60)
 print("Registration examples completed!")
 print("=" * 60)
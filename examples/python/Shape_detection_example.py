@@ -3,6 +3,7 @@ from CGAL.CGAL_Kernel import Point_3
 from CGAL.CGAL_Kernel import Vector_3
 from CGAL.CGAL_Point_set_3 import Point_set_3
 from CGAL.CGAL_Shape_detection import *
+from CGAL.CGAL_Point_set_processing_3 import Neighborhood_cache
 
 import os
 
@@ -17,10 +18,34 @@ plane_map = points.add_int_map("plane_index")
 nb_planes = region_growing(points, plane_map, min_points=20)
 print(nb_planes, "planes(s) detected")
 
+print("Detecting planes with region growing (sphere query on a voxel grid)")
+nb_planes = region_growing(points, plane_map, min_points=20, use_voxel_grid=True)
+print(nb_planes, "planes(s) detected")
+
 print("Detecting planes with region growing (k-neighbor query)")
 nb_planes = region_growing(points, plane_map, min_points=20, k=12)
 print(nb_planes, "planes(s) detected")
 
+print("Sweeping the region growing parameters with a single neighbor query")
+query = Region_growing_neighbor_query.create_sphere(points)
+for epsilon in (0.5 * query.radius(), query.radius(), 2 * query.radius()):
+    nb_planes = region_growing_with_neighbor_query(points, plane_map, query,
+                                                   min_points=20, epsilon=epsilon)
+    print(" * epsilon", epsilon, ":", nb_planes, "planes(s) detected")
+
+print("Detecting planes with region growing (neighbors of a Neighborhood_cache)")
+cache = Neighborhood_cache(points, 12)
+query = Region_growing_neighbor_query.create_from_neighborhood_cache(cache)
+nb_planes = region_growing_with_neighbor_query(points, plane_map, query, min_points=20)
+print(nb_planes, "planes(s) detected")
+
+# a query only serves the point set it was built on
+try:
+    region_growing_with_neighbor_query(Point_set_3(), plane_map, query)
+    assert False
+except Exception:
+    pass
+
 print("Detecting planes with efficient RANSAC")
 planes = efficient_RANSAC(points, plane_map)
 print(len(planes), "planes(s) detected, first 10 planes are:")
@@ -86,3 +111,71 @@ for idx in points.indices():
     if shape_map.get(idx) == 0:
         inliers_of_first_shape.insert(points.point(idx))
 print(inliers_of_first_shape.size(), "inliers(s) recovered")
+
+print("Detecting everything possible with efficient RANSAC, results as arrays")
+result = efficient_RANSAC_arrays(points,
+                                 min_points=5,
+                                 epsilon=1.,
+                                 cluster_epsilon=1.2,
+                                 normal_threshold=0.85,
+                                 planes=True,
+                                 cylinders=True,
+                                 spheres=True,
+                                 cones=True,
+                                 tori=True)
+types = result.shape_type_array().tolist()
+parameters = result.shape_parameter_array().tolist()
+shape_ids = result.shape_id_array().tolist()
+assert len(types) == result.number_of_shapes()
+assert len(parameters) == 8 * result.number_of_shapes()
+assert len(shape_ids) == points.size()
+assert all(-1 <= s < result.number_of_shapes() for s in shape_ids)
+print(result.number_of_shapes(), "shape(s) detected,",
+      types.count(RANSAC_PLANE), "plane(s)")
+
+print("Sweeping epsilon with a detector preprocessed once")
+detector = Efficient_RANSAC_detector(points, planes=True, cylinders=True)
+assert detector.number_of_points() == points.size()
+for eps in (0.5, 1., 2.):
+    result = detector.detect(min_points=5, epsilon=eps, cluster_epsilon=1.2, normal_threshold=0.85)
+    assert len(result.shape_id_array().tolist()) == points.size()
+    print(" epsilon", eps, ":", result.number_of_shapes(), "shape(s) detected")
+
+print("Detecting planes with efficient RANSAC on tiles")
+coordinates = points.point_array().tolist()
+extent = max(coordinates) - min(coordinates)
+result = efficient_RANSAC_arrays(points, min_points=20, tile_size=extent / 2)
+assert len(result.shape_id_array().tolist()) == points.size()
+print(result.number_of_shapes(), "plane(s) detected")
+
+print("Detecting planes with region growing on blocks processed in parallel")
+nb_planes = region_growing_on_blocks(points, plane_map, extent / 2, min_points=20)
+print(nb_planes, "planes(s) detected")
+
+print("Planar segmentation of the facets of a polyhedron")
+from CGAL.CGAL_Polyhedron_3 import Polyhedron_3
+P = Polyhedron_3()
+P.make_tetrahedron(Point_3(0, 0, 0), Point_3(1, 0, 0), Point_3(0, 1, 0), Point_3(0, 0, 1))
+try:
+    regions = region_growing_on_polyhedron(P)
+    assert regions.number_of_items() == P.size_of_facets()
+    assert regions.number_of_regions() == 4
+    assert len(regions.primitive_array().tolist()) == 16
+except RuntimeError:
+    print(" needs CGAL 5.6 or later")
+
+print("Detecting 2D lines with region growing")
+from array import array
+points_2 = array('d')
+normals_2 = array('d')
+for i in range(50):
+    points_2.extend([i * 0.02, 0.])
+    normals_2.extend([0., 1.])
+    points_2.extend([2., i * 0.02])
+    normals_2.extend([1., 0.])
+try:
+    lines = region_growing_lines_2(points_2, normals_2, min_points=10, epsilon=0.01, cluster_epsilon=0.05)
+    assert lines.number_of_items() == 100
+    assert lines.number_of_regions() == 2
+except RuntimeError:
+    print(" needs CGAL 5.6 or later")
@@ -25,3 +25,64 @@ CGAL_Mesh_2.refine_Delaunay_mesh_2(cdt,
                                    Delaunay_mesh_size_criteria_2(0.125, 0.5))
 
 print("Number of vertices: ", cdt.number_of_vertices())
+
+print("Meshing a batch of polygons...")
+from array import array
+# two squares and a triangle, each given as a closed ring of points
+points = array('d', [0, 0, 1, 0, 1, 1, 0, 1,
+                     2, 0, 4, 0, 4, 2, 2, 2,
+                     5, 0, 6, 0, 5, 1])
+polygon_offsets = array('i', [0, 4, 8, 11])
+batch = CGAL_Mesh_2.mesh_polygons_batch(points, polygon_offsets,
+                                        Delaunay_mesh_size_criteria_2(0.125, 0.5))
+vertex_offsets = batch.vertex_offsets().tolist()
+triangle_offsets = batch.triangle_offsets().tolist()
+triangles = batch.triangle_array().tolist()
+assert batch.number_of_polygons() == 3
+assert vertex_offsets[-1] == batch.number_of_points()
+assert triangle_offsets[-1] == batch.number_of_triangles()
+for p in range(3):
+    assert triangle_offsets[p] < triangle_offsets[p + 1]
+    for t in range(triangle_offsets[p], triangle_offsets[p + 1]):
+        for v in triangles[3 * t:3 * t + 3]:
+            assert vertex_offsets[p] <= v < vertex_offsets[p + 1]
+print("Number of triangles: ", batch.number_of_triangles())
+
+try:
+    CGAL_Mesh_2.mesh_polygons_batch(points, array('i', [0, 2, 11]),
+                                    Delaunay_mesh_size_criteria_2())
+    assert False, "a polygon with 2 points must be rejected"
+except Exception:
+    pass
+
+print("Meshing with a sizing field...")
+from CGAL.CGAL_Mesh_2 import Mesh_2_sizing_field
+from CGAL.CGAL_Mesh_2 import Delaunay_mesh_sizing_field_criteria_2
+# sizes at scattered points, interpolated with natural neighbor coordinates:
+# small near (-4,0), large elsewhere
+samples = array('d', [-4, 0, 4, 0, 0, -1, 0, 1])
+field = Mesh_2_sizing_field.create_from_samples(samples, array('d', [0.05, 1, 1, 1]))
+field.make_lipschitz(0.2)
+assert abs(field.value(Point_2(-4, 0)) - 0.05) < 1e-9
+assert field.value(Point_2(0, 1)) < 1
+cdt = Mesh_2_Constrained_Delaunay_triangulation_2()
+va = cdt.insert(Point_2(-4, 0))
+vb = cdt.insert(Point_2(0, -1))
+vc = cdt.insert(Point_2(4, 0))
+vd = cdt.insert(Point_2(0, 1))
+cdt.insert_constraint(va, vb)
+cdt.insert_constraint(vb, vc)
+cdt.insert_constraint(vc, vd)
+cdt.insert_constraint(vd, va)
+CGAL_Mesh_2.refine_Delaunay_mesh_2(cdt, Delaunay_mesh_sizing_field_criteria_2(0.125, field))
+print("Number of vertices: ", cdt.number_of_vertices())
+
+# sizes on a 3x3 grid of [-4,4]x[-1,1]
+field = Mesh_2_sizing_field.create_from_grid(array('d', [0.2, 0.5, 0.2,
+                                                         0.2, 0.5, 0.2,
+                                                         0.2, 0.5, 0.2]),
+                                             3, 3, Point_2(-4, -1), 4, 1)
+assert abs(field.value(Point_2(-2, 0)) - 0.35) < 1e-9
+batch = CGAL_Mesh_2.mesh_polygons_batch(points, polygon_offsets,
+                                        Delaunay_mesh_sizing_field_criteria_2(0.125, field))
+assert batch.number_of_polygons() == 3
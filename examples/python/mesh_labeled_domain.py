@@ -0,0 +1,97 @@
+from CGAL.CGAL_Kernel import Point_3
+from CGAL.CGAL_Mesh_3 import Labeled_mesh_domain_3
+from CGAL.CGAL_Mesh_3 import Mesh_3_parameters
+from CGAL.CGAL_Mesh_3 import Default_mesh_criteria
+from CGAL.CGAL_Mesh_3 import Sizing_field_mesh_criteria
+from CGAL.CGAL_Mesh_3 import Mesh_3_sizing_field
+from CGAL import CGAL_Mesh_3
+
+from array import array
+
+n = 21
+h = 2. / (n - 1)
+origin = Point_3(-1, -1, -1)
+
+# Signed distance to the sphere of radius 0.8 sampled on a n^3 grid,
+# x varying fastest
+values = array('d')
+labels = array('i')
+for k in range(n):
+    for j in range(n):
+        for i in range(n):
+            x, y, z = -1 + i * h, -1 + j * h, -1 + k * h
+            d = (x * x + y * y + z * z) ** 0.5
+            values.append(d - 0.8)
+            # two nested labels: 2 in the inner ball, 1 in the outer shell
+            labels.append(2 if d < 0.4 else (1 if d < 0.8 else 0))
+
+params = Mesh_3_parameters()
+params.no_exude()
+params.no_perturb()
+criteria = Default_mesh_criteria()
+criteria.facet_angle(25).facet_size(0.15).facet_distance(
+    0.01).cell_radius_edge_ratio(3).cell_size(0.2)
+
+# Implicit function domain (trilinear interpolation of the samples)
+implicit_domain = Labeled_mesh_domain_3.create_implicit_grid_domain(
+    values, n, n, n, origin, h, h, h)
+c3t3 = CGAL_Mesh_3.make_mesh_3(implicit_domain, criteria, params)
+assert c3t3.number_of_cells() > 0
+subdomains = c3t3.to_arrays().subdomain_index_array().tolist()
+assert all(s == 1 for s in subdomains)
+
+# Optimization with statistics
+opt_params = Mesh_3_parameters()
+opt_params.set_odt(10, 5, 0.02, 0.01)
+opt_params.set_perturb(5, 0)
+opt_params.set_exude(5, 0)
+stats = CGAL_Mesh_3.optimize_mesh_3(c3t3, implicit_domain, opt_params)
+assert [stats.phase(i).name() for i in range(stats.number_of_phases())] == \
+    ["odt", "perturb", "exude"]
+assert stats.number_of_threads() >= 1
+odt = stats.phase(0)
+assert odt.moved_vertices() > 0
+assert 0 < odt.min_dihedral_angle_before() <= odt.average_dihedral_angle_before()
+assert stats.phase(1).min_dihedral_angle_before() == odt.min_dihedral_angle_after()
+assert stats.phase(2).moved_vertices() == 0
+for i in range(stats.number_of_phases()):
+    p = stats.phase(i)
+    print(p.name(), p.return_code(), p.time(), "s, min dihedral angle",
+          p.min_dihedral_angle_before(), "->", p.min_dihedral_angle_after())
+
+# Adaptive mesh: sizes sampled on the grid, small near the plane z=0
+sizes = array('d')
+for k in range(n):
+    for j in range(n):
+        for i in range(n):
+            sizes.append(0.05 + 0.3 * abs(-1 + k * h))
+field = Mesh_3_sizing_field.create_from_grid(sizes, n, n, n, origin, h, h, h)
+field.make_lipschitz(0.5)
+assert abs(field.value(Point_3(0, 0, 0)) - 0.05) < 1e-9
+assert field.value(Point_3(0, 0, 0.9)) <= 0.05 + 0.5 * 0.9 + 1e-9
+sizing_criteria = Sizing_field_mesh_criteria()
+sizing_criteria.facet_angle(25).facet_size(field).facet_distance(
+    0.01).cell_radius_edge_ratio(3).cell_size(field)
+adaptive = CGAL_Mesh_3.make_mesh_3(implicit_domain, sizing_criteria, params)
+assert adaptive.number_of_cells() > c3t3.number_of_cells()
+
+# Sizes at scattered points, linearly interpolated
+samples = array('d', [0, 0, -1, 0, 0, 1, 1, 1, 1, -1, -1, 1, 1, -1, 0])
+field = Mesh_3_sizing_field.create_from_samples(samples, array('d', [0.1, 0.3, 0.3, 0.3, 0.2]))
+assert abs(field.value(Point_3(0, 0, -1)) - 0.1) < 1e-9
+
+# Labeled image domain
+image_domain = Labeled_mesh_domain_3.create_labeled_image_domain(
+    labels, n, n, n, origin, h, h, h)
+c3t3 = CGAL_Mesh_3.make_mesh_3(image_domain, criteria, params)
+subdomains = c3t3.to_arrays().subdomain_index_array().tolist()
+assert set(subdomains) == {1, 2}
+c3t3.output_to_medit("out_labeled.mesh")
+
+# Wrong number of values
+try:
+    Labeled_mesh_domain_3.create_labeled_image_domain(
+        labels, n, n, n + 1, origin, h, h, h)
+    assert False
+except Exception:
+    pass
@@ -26,9 +26,16 @@ mesher.set_criteria(Delaunay_mesh_size_criteria_2(0.125, 0.05))
 mesher.refine_mesh()
 
 print("Number of vertices: ", cdt.number_of_vertices())
+before = CGAL_Mesh_2.quality_histogram(cdt)
+print("Minimum angle: ", before.min_angle(), " maximum aspect ratio: ", before.max_aspect_ratio())
 print("Run Lloyd optimization...")
 params = Mesh_2_parameters()
 params.set_max_iteration_number(10)
 CGAL_Mesh_2.lloyd_optimize_mesh_2(cdt, params)
 print("done.")
 print("Number of vertices: ", cdt.number_of_vertices())
+after = CGAL_Mesh_2.quality_histogram(cdt, 6)
+print("Minimum angle: ", after.min_angle(), " maximum aspect ratio: ", after.max_aspect_ratio())
+print("Faces per minimum angle bin: ", list(after.min_angle_count_array()))
+assert sum(after.min_angle_count_array()) == after.number_of_faces()
+assert len(after.min_angle_bin_array()) == 7 and after.min_angle_bin_array()[6] == 60
@@ -0,0 +1,53 @@
+from CGAL.CGAL_Polyhedron_3 import Polyhedron_3
+from CGAL.CGAL_Mesh_3 import Polyhedral_complex_mesh_domain_3
+from CGAL.CGAL_Mesh_3 import Mesh_3_parameters
+from CGAL.CGAL_Mesh_3 import Default_mesh_criteria
+from CGAL import CGAL_Mesh_3
+
+
+def write_cube(filename, h):
+    points = [(x, y, z) for z in (-h, h) for y in (-h, h) for x in (-h, h)]
+    # two outward oriented triangles per face
+    triangles = [(0, 2, 3), (0, 3, 1), (4, 5, 7), (4, 7, 6),
+                 (0, 1, 5), (0, 5, 4), (2, 6, 7), (2, 7, 3),
+                 (0, 4, 6), (0, 6, 2), (1, 3, 7), (1, 7, 5)]
+    with open(filename, "w") as f:
+        f.write("OFF\n%d %d 0\n" % (len(points), len(triangles)))
+        for p in points:
+            f.write("%g %g %g\n" % p)
+        for t in triangles:
+            f.write("3 %d %d %d\n" % t)
+
+
+# Two materials: an inner cube (subdomain 2) inside a larger one (subdomain 1)
+write_cube("outer_cube.off", 1)
+write_cube("inner_cube.off", 0.5)
+
+domain = Polyhedral_complex_mesh_domain_3()
+domain.add_polyhedron(Polyhedron_3("outer_cube.off"), 1, 0)
+domain.add_polyhedron(Polyhedron_3("inner_cube.off"), 2, 1)
+assert domain.number_of_polyhedra() == 2
+# the cube edges are protected
+domain.detect_features(60)
+
+params = Mesh_3_parameters()
+params.no_exude()
+params.no_perturb()
+criteria = Default_mesh_criteria()
+criteria.edge_size(0.2).facet_angle(25).facet_size(0.2).facet_distance(
+    0.01).cell_radius_edge_ratio(3).cell_size(0.3)
+
+# One conforming mesh of both materials
+c3t3 = CGAL_Mesh_3.make_mesh_3(domain, criteria, params)
+arrays = c3t3.to_arrays()
+assert set(arrays.subdomain_index_array().tolist()) == {1, 2}
+patches = set(tuple(p) for p in arrays.surface_patch_index_array().tolist())
+assert patches == {(0, 1), (1, 2)}
+c3t3.output_to_medit("out_complex.mesh")
+
+# The domain cannot be modified once used
+try:
+    domain.detect_borders()
+    assert False
+except Exception:
+    pass
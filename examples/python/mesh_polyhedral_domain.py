@@ -18,6 +18,10 @@ domain = Polyhedral_mesh_domain_3(polyhedron)
 params = Mesh_3_parameters()
 params.no_exude()
 params.no_perturb()
+# concurrent meshing is the default when the module is built with TBB
+assert params.is_parallel() == Mesh_3_parameters.concurrency_available()
+params.set_parallel(2, 32)
+assert params.is_parallel() == Mesh_3_parameters.concurrency_available()
 
 # Mesh criteria (no cell_size set)
 criteria = Default_mesh_criteria()
@@ -29,12 +33,84 @@ c3t3 = CGAL_Mesh_3.make_mesh_3(domain, criteria, params)
 # Output
 c3t3.output_to_medit("out_1.mesh")
 
+# Export to arrays
+arrays = c3t3.to_arrays()
+assert arrays.number_of_cells() == c3t3.number_of_cells()
+assert arrays.number_of_facets() == c3t3.number_of_facets()
+cells = arrays.cell_array()
+assert cells.shape == (arrays.number_of_cells(), 4)
+assert max(max(c) for c in cells.tolist()) < arrays.number_of_points()
+assert len(arrays.subdomain_index_array()) == arrays.number_of_cells()
+assert arrays.facet_array().shape == (arrays.number_of_facets(), 3)
+
+# Binary MEDIT and VTU files
+import struct
+c3t3.write_meshb("out_1.meshb")
+with open("out_1.meshb", "rb") as f:
+    code, version = struct.unpack("=ii", f.read(8))
+    assert code == 1 and version == 3
+c3t3.write_vtu("out_1.vtu")
+with open("out_1.vtu", "rb") as f:
+    header = f.read(512)
+    assert b'NumberOfCells="%d"' % arrays.number_of_cells() in header
+
+tr_arrays = c3t3.triangulation().to_arrays(True)
+assert tr_arrays.neighbor_array().shape == tr_arrays.cell_array().shape
+
+# Binary round trip
+c3t3.write_binary("out_1.c3t3")
+reloaded = Mesh_3_Complex_3_in_triangulation_3()
+reloaded.read_binary("out_1.c3t3")
+assert reloaded.number_of_cells() == c3t3.number_of_cells()
+assert reloaded.number_of_facets() == c3t3.number_of_facets()
+assert reloaded.triangulation().is_valid()
+
 # Set tetrahedron size (keep cell_radius_edge), ignore facets
 new_criteria = Default_mesh_criteria()
 new_criteria.cell_radius_edge_ratio(3).cell_size(0.03)
 
 # Mesh refinement
+params.set_sequential()
+assert not params.is_parallel()
 CGAL_Mesh_3.refine_mesh_3(c3t3, domain, new_criteria, params)
 
 # Output
 c3t3.output_to_medit("out_2.mesh")
+
+# Isotropic remeshing of the complex, in place
+from array import array
+try:
+    remeshed = c3t3.deepcopy()
+    CGAL_Mesh_3.tetrahedral_isotropic_remeshing(remeshed, 0.05, 2)
+    assert remeshed.triangulation().is_valid()
+    assert remeshed.number_of_cells() > 0
+    # target edge length per cell of the complex, halved in a slab
+    cells = remeshed.to_arrays()
+    points = cells.point_array()
+    sizes = array('d', [0.025 if points[c[0]][0] > 0 else 0.05 for c in cells.cell_array().tolist()])
+    params.set_parallel()
+    CGAL_Mesh_3.tetrahedral_isotropic_remeshing(remeshed, sizes, 1, True, params)
+    assert remeshed.triangulation().is_valid()
+except RuntimeError as e:
+    print(e)
+
+# Refinement budget: the refinement stops early with a valid complex
+budget_params = Mesh_3_parameters()
+budget_params.no_exude()
+budget_params.no_perturb()
+budget_params.set_refinement_budget(0, 500)
+small = CGAL_Mesh_3.make_mesh_3(domain, new_criteria, budget_params)
+monitor = budget_params.refinement_monitor()
+assert monitor.stopped_early()
+assert monitor.number_of_vertices() >= 500
+assert small.triangulation().is_valid()
+
+# Stop requested from another thread while the refinement runs without the GIL
+import threading
+budget_params.set_refinement_budget(0, 0)
+stopper = threading.Timer(0.01, monitor.stop)
+stopper.start()
+stopped = CGAL_Mesh_3.make_mesh_3(domain, new_criteria, budget_params)
+stopper.join()
+assert stopped.triangulation().is_valid()
+print("stopped early:", monitor.stopped_early(), "after", monitor.elapsed_time(), "s")
@@ -26,3 +26,49 @@ def make_cube_3(P):
 P = Polyhedron_3()
 h = make_cube_3(P)
 assert not P.is_tetrahedron(h)
+
+# ids are given to the items created by the editing operations
+assert sorted(v.id() for v in P.vertices()) == list(range(8))
+assert P.has_compact_ids()
+P.erase_facet(h)
+assert not P.has_compact_ids()
+P.compact()
+assert P.has_compact_ids()
+
+# iterators over handles are exported in C++ as the ids of the items
+assert sorted(P.vertices().to_array().tolist()) == list(range(P.size_of_vertices()))
+assert sorted(P.facets().to_array().tolist()) == list(range(P.size_of_facets()))
+it = P.halfedges()
+first = it.next_batch(5).tolist()
+assert first + it.to_array().tolist() == [e.id() for e in P.halfedges()]
+assert len(first) == 5
+
+# round trip through (V,3) and (F,3) arrays
+from array import array
+vertices = array('d', [0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1])
+faces = array('i', [0, 2, 1, 0, 1, 3, 0, 3, 2, 1, 2, 3])
+T = Polyhedron_3.from_arrays(vertices, faces)
+assert T.size_of_vertices() == 4 and T.size_of_facets() == 4 and T.is_closed()
+V, F = T.to_arrays()
+assert V.shape == (4, 3) and F.shape == (4, 3)
+assert sum(V.tolist(), []) == list(vertices)
+assert sorted(map(sorted, F.tolist())) == sorted(map(sorted, zip(*[iter(faces)] * 3)))
+
+# facets of any degree in compressed sparse rows: a pyramid
+vertices = array('d', [0, 0, 0, 1, 0, 0, 1, 1, 0, 0, 1, 0, 0.5, 0.5, 1])
+offsets = array('i', [0, 4, 7, 10, 13, 16])
+indices = array('i', [0, 3, 2, 1, 0, 1, 4, 1, 2, 4, 2, 3, 4, 3, 0, 4])
+T = Polyhedron_3.from_csr_arrays(vertices, offsets, indices)
+assert T.size_of_vertices() == 5 and T.size_of_facets() == 5 and T.is_closed()
+
+# repair: the repeated vertex of the base is removed, the degenerate and the
+# duplicated facets are skipped
+offsets = array('i', [0, 5, 8, 11, 14, 17, 20, 23])
+indices = array('i', [0, 0, 3, 2, 1, 0, 1, 4, 1, 2, 4, 2, 3, 4, 3, 0, 4, 4, 4, 1, 0, 1, 4])
+try:
+    Polyhedron_3.from_csr_arrays(vertices, offsets, indices)
+    assert False
+except Exception:
+    pass
+T = Polyhedron_3.from_csr_arrays(vertices, offsets, indices, True)
+assert T.size_of_facets() == 5 and T.is_closed() and T.is_valid()
@@ -2,6 +2,8 @@ from __future__ import print_function
 from CGAL.CGAL_Kernel import Point_3
 from CGAL.CGAL_Kernel import Weighted_point_3
 from CGAL.CGAL_Triangulation_3 import Regular_triangulation_3
+from CGAL.CGAL_Triangulation_3 import Parallel_Regular_triangulation_3
+from array import array
 
 # generate points on a 3D grid
 P = []
@@ -33,3 +35,13 @@ while T.number_of_vertices() > 0:
     count += 1
 
 assert count == number_of_points
+
+# insertion of rows (x,y,z,weight), concurrent when CGAL is linked with TBB;
+# the last point, with a negative weight, is hidden by the cube corners
+rows = [c for x in (0, 1) for y in (0, 1) for z in (0, 1) for c in (x, y, z, 0)]
+rows += [0.5, 0.5, 0.5, -10]
+coords = array('d', rows)
+PT = Parallel_Regular_triangulation_3()
+assert PT.insert_from_array(coords) == 8
+assert PT.is_valid()
+assert PT.hidden_rows(coords).tolist() == [8]
@@ -2,9 +2,14 @@ from CGAL.CGAL_Kernel import Point_3
 from CGAL.CGAL_Triangulation_3 import Delaunay_triangulation_3
 from CGAL.CGAL_Triangulation_3 import Delaunay_triangulation_3_Cell_handle
 from CGAL.CGAL_Triangulation_3 import Delaunay_triangulation_3_Vertex_handle
+from CGAL.CGAL_Triangulation_3 import Parallel_Delaunay_triangulation_3
+from CGAL.CGAL_Triangulation_3 import Fast_location_Delaunay_triangulation_3
 from CGAL.CGAL_Triangulation_3 import Ref_Locate_type_3
 from CGAL.CGAL_Triangulation_3 import VERTEX
+from CGAL.CGAL_Triangulation_3 import CELL
+from CGAL.CGAL_Triangulation_3 import OUTSIDE_CONVEX_HULL
 from CGAL.CGAL_Kernel import Ref_int
+from array import array
 
 L = []
 L.append(Point_3(0, 0, 0))
@@ -40,6 +45,12 @@ nc = c.neighbor(li.object())
 nli = Ref_int()
 assert nc.has_vertex(v, nli)
 
+# same location returned by value, without the reference wrappers
+location = T.locate_with_type(p)
+assert location.locate_type() == VERTEX
+assert location.handle() == c and location.li() == li.object()
+assert T.locate_with_type(p, c).locate_type() == VERTEX
+
 T.write_to_file("output", 14)
 
 T1 = Delaunay_triangulation_3()
@@ -48,3 +59,107 @@ T1.read_from_file("output")
 assert T1.is_valid()
 assert T1.number_of_vertices() == T.number_of_vertices()
 assert T1.number_of_cells() == T.number_of_cells()
+
+# bulk insertion, concurrent when CGAL is linked with TBB
+grid = [Point_3(i + 0.01 * j, j + 0.01 * k, k + 0.01 * i)
+        for i in range(20) for j in range(20) for k in range(20)]
+PT = Parallel_Delaunay_triangulation_3(grid)
+assert PT.number_of_vertices() == 8000
+assert PT.is_valid()
+assert PT.insert(V) == 3
+assert PT.is_valid()
+
+# insertion from an array of coordinates, with the vertex of each row
+coords = array('d', [c for p in grid[:1000] for c in (p.x(), p.y(), p.z())])
+T2 = Delaunay_triangulation_3()
+vertices = []
+assert T2.insert_from_array(coords, vertices) == 1000
+assert T2.is_valid()
+assert len(vertices) == 1000
+assert vertices[10].point() == grid[10]
+assert PT.insert_from_array(coords) == 0
+
+# export to arrays
+arrays = T2.to_arrays(True)
+assert arrays.number_of_points() == T2.number_of_vertices()
+assert arrays.number_of_cells() == T2.number_of_finite_cells()
+points = arrays.point_array()
+cells = arrays.cell_array()
+neighbors = arrays.neighbor_array()
+assert points.shape == (arrays.number_of_points(), 3)
+assert cells.shape == (arrays.number_of_cells(), 4)
+assert neighbors.shape == cells.shape
+flat_neighbors = [n for c in neighbors.tolist() for n in c]
+assert min(flat_neighbors) == -1
+assert max(flat_neighbors) < arrays.number_of_cells()
+assert T2.to_arrays().neighbor_array().shape == (0, 4)
+
+# batched point location, indices being those of to_arrays()
+queries = array('d', [1.5, 1.5, 1.5, 1000, 1000, 1000, grid[0].x(), grid[0].y(), grid[0].z()])
+locations = T2.locate_batch(queries)
+assert locations.size() == 3
+indices = locations.index_array().tolist()
+types = locations.locate_type_array().tolist()
+assert types[0] == CELL and 0 <= indices[0] < arrays.number_of_cells()
+assert types[1] == OUTSIDE_CONVEX_HULL and indices[1] == -1
+assert types[2] == VERTEX
+
+# binary round trip
+T2.write_binary("dt3.bin")
+T3 = Delaunay_triangulation_3()
+T3.read_binary("dt3.bin")
+assert T3.is_valid()
+assert T3.number_of_vertices() == T2.number_of_vertices()
+assert T3.number_of_cells() == T2.number_of_cells()
+assert T3.to_arrays().point_array().tolist() == points.tolist()
+try:
+    T3.read_binary("does_not_exist.bin")
+    assert False
+except Exception:
+    pass
+
+# batched moves: small displacements of every vertex
+n = T3.number_of_vertices()
+old = T3.to_arrays().point_array().tolist()
+ids = array('i', range(n))
+moved = array('d', [c + 0.01 for p in old for c in p])
+new_ids = T3.move_batch(ids, moved).tolist()
+assert T3.is_valid()
+assert T3.number_of_vertices() == n
+new_points = T3.to_arrays().point_array().tolist()
+assert all(abs(new_points[new_ids[i]][0] - old[i][0] - 0.01) < 1e-12 for i in range(n))
+try:
+    T3.move_batch(array('i', [0, 0]), array('d', [0, 0, 0, 1, 1, 1]))
+    assert False
+except Exception:
+    pass
+
+# hierarchy for random order insertions and locate() without hint
+import random
+shuffled = list(grid)
+random.shuffle(shuffled)
+FT = Fast_location_Delaunay_triangulation_3()
+for p in shuffled[:2000]:
+    FT.insert(p)
+assert FT.number_of_vertices() == 2000
+assert FT.is_valid()
+c = FT.locate(shuffled[10], lt, li, lj)
+assert lt.object() == VERTEX
+assert c.vertex(li.object()).point() == shuffled[10]
+# the upper levels of the hierarchy are rebuilt when reading
+FT.write_binary("fast_location.bin")
+FT2 = Fast_location_Delaunay_triangulation_3()
+FT2.read_binary("fast_location.bin")
+assert FT2.number_of_vertices() == 2000
+assert FT2.is_valid()
+FT2.locate(shuffled[20], lt, li, lj)
+assert lt.object() == VERTEX
+
+# batched removal, concurrent for the parallel triangulation
+n = PT.number_of_vertices()
+assert PT.remove_batch(array('i', list(range(0, n, 10)) + [0])) == (n + 9) // 10
+assert PT.number_of_vertices() == n - (n + 9) // 10
+assert PT.is_valid()
+n = FT.number_of_vertices()
+assert FT.remove_batch(array('i', range(0, n, 3))) == (n + 2) // 3
+assert FT.is_valid()
@@ -0,0 +1,133 @@
+from __future__ import print_function
+from CGAL.CGAL_Kernel import Point_3
+from CGAL.CGAL_Kernel import Sphere_3
+from CGAL.CGAL_Surface_mesher import Surface_mesh_default_triangulation_3
+from CGAL.CGAL_Surface_mesher import Complex_2_in_triangulation_3
+from CGAL.CGAL_Surface_mesher import Surface_mesh_default_criteria_3
+from CGAL.CGAL_Surface_mesher import Surface_mesher_tag
+from CGAL.CGAL_Surface_mesher import Sdf_grid_3
+from CGAL.CGAL_Surface_mesher import Implicit_surface_Sdf_grid_3
+from CGAL.CGAL_Surface_mesher import Poisson_reconstruction_function
+from CGAL.CGAL_Surface_mesher import Implicit_surface_Poisson_reconstruction_function
+from CGAL.CGAL_Surface_mesher import Gray_level_image_3
+from CGAL.CGAL_Polyhedron_3 import Polyhedron_3
+from CGAL import CGAL_Surface_mesher
+
+from array import array
+import math
+
+# Signed distance to the sphere of radius 0.8 sampled on a n^3 grid,
+# x varying fastest
+n = 21
+h = 2. / (n - 1)
+values = array('d')
+for k in range(n):
+    for j in range(n):
+        for i in range(n):
+            x, y, z = -1 + i * h, -1 + j * h, -1 + k * h
+            values.append(math.sqrt(x * x + y * y + z * z) - 0.8)
+sdf = Sdf_grid_3(values, n, n, n, Point_3(-1, -1, -1), h, h, h)
+assert sdf.value(Point_3(0, 0, 0)) < 0
+assert abs(sdf.value(Point_3(0.8, 0, 0))) < 1e-9
+
+tr = Surface_mesh_default_triangulation_3()
+c2t3 = Complex_2_in_triangulation_3(tr)
+surface = Implicit_surface_Sdf_grid_3(sdf, Sphere_3(Point_3(0, 0, 0), 1), 1e-5)
+criteria = Surface_mesh_default_criteria_3(30., 0.1, 0.01)
+CGAL_Surface_mesher.make_surface_mesh(c2t3, surface, criteria, Surface_mesher_tag.MANIFOLD_TAG)
+print("SDF grid: ", c2t3.number_of_facets(), " facets")
+assert c2t3.number_of_facets() > 0
+
+# Export of the facets as arrays: a closed surface, oriented outward
+arrays = c2t3.to_arrays()
+assert arrays.number_of_triangles() == c2t3.number_of_facets()
+coords = arrays.point_array().tolist()
+triangles = arrays.triangle_array().tolist()
+assert len(triangles) == 3 * c2t3.number_of_facets()
+volume = 0
+for t in range(0, len(triangles), 3):
+    p, q, r = [coords[3 * triangles[t + k]:3 * triangles[t + k] + 3] for k in range(3)]
+    volume += (p[0] * (q[1] * r[2] - q[2] * r[1]) - p[1] * (q[0] * r[2] - q[2] * r[0])
+               + p[2] * (q[0] * r[1] - q[1] * r[0])) / 6
+assert abs(volume - 4 * math.pi * 0.8 ** 3 / 3) < 0.1
+c2t3.write_ply("sdf_sphere.ply")
+with open("sdf_sphere.ply", "rb") as f:
+    assert f.read(3) == b"ply"
+
+# Gray level image given as an array of floats, the voxels of the ball of
+# radius 0.8 centered at (1,1,1) being above the isovalue 0.2: several
+# isovalues meshed at once
+voxels = array('f', [1 - math.sqrt((i * h - 1) ** 2 + (j * h - 1) ** 2 + (k * h - 1) ** 2)
+                     for k in range(n) for j in range(n) for i in range(n)])
+image = Gray_level_image_3(voxels, n, n, n, h, h, h, 0.2)
+assert (image.xdim(), image.ydim(), image.zdim()) == (n, n, n)
+meshes = CGAL_Surface_mesher.make_surface_meshes(image, array('d', [0.2, 0.5]),
+                                                 Sphere_3(Point_3(1, 1, 1), 1), criteria,
+                                                 Surface_mesher_tag.MANIFOLD_TAG)
+assert meshes.number_of_meshes() == 2
+for m, radius in enumerate((0.8, 0.5)):
+    coords = meshes.mesh(m).point_array().tolist()
+    assert meshes.mesh(m).number_of_triangles() > 0
+    for p in range(0, len(coords), 3):
+        r = math.sqrt(sum((coords[p + c] - 1) ** 2 for c in range(3)))
+        assert abs(r - radius) < 2 * h
+try:
+    Gray_level_image_3(voxels, n, n, n + 1, h, h, h, 0.2)
+    assert False
+except Exception:
+    pass
+
+# Poisson surface reconstruction of points of the unit sphere with their normals
+points = array('d')
+normals = array('d')
+m = 30
+for i in range(m):
+    theta = math.pi * (i + 0.5) / m
+    for j in range(2 * m):
+        phi = math.pi * j / m
+        p = (math.sin(theta) * math.cos(phi), math.sin(theta) * math.sin(phi), math.cos(theta))
+        points.extend(p)
+        normals.extend(p)
+function = Poisson_reconstruction_function(points, normals)
+assert function.value(function.get_inner_point()) < 0
+spacing = function.average_spacing()
+bsphere = function.bounding_sphere()
+radius = 5 * math.sqrt(bsphere.squared_radius())
+
+tr = Surface_mesh_default_triangulation_3()
+c2t3 = Complex_2_in_triangulation_3(tr)
+surface = Implicit_surface_Poisson_reconstruction_function(
+    function, Sphere_3(function.get_inner_point(), radius * radius), 1e-3 * spacing)
+criteria = Surface_mesh_default_criteria_3(20., 30 * spacing, 0.375 * spacing)
+CGAL_Surface_mesher.make_surface_mesh(c2t3, surface, criteria, Surface_mesher_tag.MANIFOLD_WITH_BOUNDARY_TAG)
+print("Poisson reconstruction: ", c2t3.number_of_facets(), " facets")
+assert c2t3.number_of_facets() > 0
+CGAL_Surface_mesher.output_surface_facets_to_off("poisson_sphere.off", c2t3)
+
+# The same function solved with the direct solver, then meshed at two
+# resolutions without solving again
+for solver in ("ldlt", "conjugate_gradient"):
+    function = Poisson_reconstruction_function(points, normals, solver, 1e-8, 1000, 2)
+    assert function.value(function.get_inner_point()) < 0
+coarse, fine = Polyhedron_3(), Polyhedron_3()
+assert CGAL_Surface_mesher.poisson_surface_mesh(function, coarse, 20, 60, 0.75)
+assert CGAL_Surface_mesher.poisson_surface_mesh(function, fine)
+assert 0 < coarse.size_of_facets() < fine.size_of_facets()
+
+P = Polyhedron_3()
+assert CGAL_Surface_mesher.poisson_surface_reconstruction_delaunay(points, normals, P)
+print("Poisson reconstruction (delaunay): ", P.size_of_facets(), " facets")
+assert P.size_of_facets() > 0
+
+try:
+    Poisson_reconstruction_function(points, normals, "lu")
+    assert False
+except Exception:
+    pass
+
+# Mismatched normals
+try:
+    Poisson_reconstruction_function(points, array('d', [0, 0, 1]))
+    assert False
+except Exception:
+    pass
@@ -53,3 +53,18 @@ lst_wp.append(Weighted_point_2(Point_2(444, 51), 1))
 lst_wp.append(Weighted_point_2(Point_2(14, 1), 1))
 
 was.make_alpha_shape(lst_wp)
+
+# creation from an array and boundaries for several alpha values
+from array import array
+coords = array('d', [0, 0, 0, 4, 44, 0, 44, 5, 444, 51, 14, 1])
+t3 = Alpha_shape_2.from_array(coords, 0, GENERAL)
+assert t3.number_of_vertices() == 6
+alphas = array('d', [t3.get_nth_alpha(i) for i in range(1, t3.number_of_alphas() + 1)])
+boundaries = t3.boundary_edges_for_alphas(alphas)
+assert boundaries.number_of_alphas() == len(alphas)
+offsets = boundaries.offset_array().tolist()
+edges = boundaries.edge_array().tolist()
+print("boundary edges per alpha:", [offsets[i + 1] - offsets[i] for i in range(len(alphas))])
+# the same edges as the classification after set_alpha
+t3.set_alpha(alphas[-1])
+assert offsets[-1] - offsets[-2] == len(list(t3.alpha_shape_edges()))
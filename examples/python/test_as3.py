@@ -0,0 +1,66 @@
+from __future__ import print_function
+from array import array
+from CGAL.CGAL_Alpha_shape_3 import Alpha_shape_3
+from CGAL.CGAL_Alpha_shape_3 import Fixed_alpha_shape_3
+from CGAL.CGAL_Alpha_shape_3 import GENERAL, REGULARIZED
+
+# the 27 points of a 3x3x3 grid, the convex hull is the cube [0,2]^3
+coords = array('d')
+for x in range(3):
+    for y in range(3):
+        for z in range(3):
+            coords.extend([x, y, z])
+
+
+def signed_volume(points, facets):
+    # volume enclosed by the facets, positive if they are oriented outward
+    vol = 0.
+    for f in facets:
+        p, q, r = points[f[0]], points[f[1]], points[f[2]]
+        vol += (p[0] * (q[1] * r[2] - q[2] * r[1])
+                - p[1] * (q[0] * r[2] - q[2] * r[0])
+                + p[2] * (q[0] * r[1] - q[1] * r[0])) / 6.
+    return vol
+
+
+a3 = Alpha_shape_3.from_array(coords, 100, REGULARIZED)
+assert a3.number_of_vertices() == 27
+assert a3.get_mode() == REGULARIZED
+points = a3.point_array().tolist()
+facets = a3.boundary_facet_array().tolist()
+print("alpha shape:", len(facets), "boundary facets, volume", a3.volume(), "area", a3.area())
+assert len(facets) == 48  # 2x2 squares of 2 triangles on each face of the cube
+assert abs(a3.volume() - 8) < 1e-9
+assert abs(a3.area() - 24) < 1e-9
+assert abs(signed_volume(points, facets) - 8) < 1e-9
+
+# below the alpha of the unit cubes, the regularized shape is empty
+a3.set_alpha(0.1)
+assert a3.volume() == 0
+assert len(a3.boundary_facet_array().tolist()) == 0
+alphas = a3.alpha_values().tolist()
+assert len(alphas) == a3.number_of_alphas()
+assert alphas == sorted(alphas)
+optimal = a3.find_optimal_alpha(1)
+assert a3.number_of_solid_components(optimal) == 1
+a3.set_mode(GENERAL)
+assert a3.get_mode() == GENERAL
+
+# the same shape for a single alpha
+f3 = Fixed_alpha_shape_3.from_array(coords, 100)
+assert f3.number_of_vertices() == 27
+assert f3.get_alpha() == 100
+assert abs(f3.volume() - 8) < 1e-9
+assert abs(f3.area() - 24) < 1e-9
+fixed_points = f3.point_array().tolist()
+fixed_facets = f3.boundary_facet_array().tolist()
+assert len(fixed_facets) == 48
+assert abs(signed_volume(fixed_points, fixed_facets) - 8) < 1e-9
+
+# coplanar points have no 3D alpha shape
+failed = False
+try:
+    Fixed_alpha_shape_3.from_array(array('d', [0, 0, 0, 1, 0, 0, 0, 1, 0, 1, 1, 0]), 1)
+except Exception:
+    failed = True
+assert failed
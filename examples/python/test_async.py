@@ -0,0 +1,42 @@
+from __future__ import print_function
+
+import asyncio
+import os
+
+import CGAL
+from CGAL import CGAL_Alpha_wrap_3
+from CGAL.CGAL_Polyhedron_3 import Polyhedron_3
+
+datadir = os.environ.get('DATADIR', '../data')
+
+P = Polyhedron_3(datadir + '/elephant.off')
+
+# the wraps run in the worker threads while this thread keeps running
+CGAL.set_async_workers(2)
+wraps = [Polyhedron_3() for i in range(2)]
+futures = [CGAL_Alpha_wrap_3.alpha_wrap_3_async(P, 0.1, 0.01, Q) for Q in wraps]
+for f in futures:
+    assert f.result() is None
+for Q in wraps:
+    assert Q.size_of_facets() > 0
+assert wraps[0].size_of_facets() == wraps[1].size_of_facets()
+
+
+# awaitable from asyncio
+async def wrap():
+    Q = Polyhedron_3()
+    await asyncio.wrap_future(CGAL_Alpha_wrap_3.alpha_wrap_3_async(P, 0.1, 0.01, Q))
+    return Q.size_of_facets()
+
+assert asyncio.run(wrap()) == wraps[0].size_of_facets()
+
+# the exceptions are raised by result()
+try:
+    CGAL_Alpha_wrap_3.alpha_wrap_3_async(None, 0.1, 0.01, Polyhedron_3()).result()
+    assert False
+except Exception:
+    pass
+
+assert CGAL.run_async(sum, [1, 2, 3]).result() == 6
+CGAL.set_async_workers(0)
+print("async calls OK")
@@ -37,3 +37,63 @@ Q.write_to_file("soup_wrapped.off")
 # test with a point set as input
 CGAL_Alpha_wrap_3.alpha_wrap_3(points, 0.1, 0.5, Q)
 Q.write_to_file("points_wrapped.off")
+
+# test with arrays as input
+from array import array
+from CGAL.CGAL_Surface_mesh import Surface_mesh_3
+coords = array('d', [0, 0, 0, 0, 1, 0, 1, 0, 0])
+triangles = array('i', [0, 1, 2])
+S = Surface_mesh_3()
+CGAL_Alpha_wrap_3.alpha_wrap_3(coords, triangles, 0.1, 0.01, S)
+assert S.number_of_faces() > 0
+faces = S.face_array().tolist()
+assert all(0 <= v < S.number_of_vertices() for f in faces for v in f)
+CGAL_Alpha_wrap_3.alpha_wrap_3(coords, 0.1, 0.5, Q)
+assert Q.size_of_facets() > 0
+failed = False
+try:
+    CGAL_Alpha_wrap_3.alpha_wrap_3(coords, array('i', [0, 1, 3]), 0.1, 0.01, S)
+except Exception:
+    failed = True
+assert failed  # index out of range
+
+# wraps of several levels of detail with the same oracle
+from CGAL.CGAL_Alpha_wrap_3 import Alpha_wrap_3_oracle
+oracle = Alpha_wrap_3_oracle.from_triangle_soup(coords, triangles)
+assert not oracle.empty()
+lods = []
+for alpha, offset in [(0.4, 0.04), (0.2, 0.02), (0.1, 0.01)]:
+    lod = Surface_mesh_3()
+    oracle.wrap(alpha, offset, lod)
+    assert lod.number_of_faces() > 0
+    lods.append(lod)
+S = Surface_mesh_3()
+CGAL_Alpha_wrap_3.alpha_wrap_3(coords, triangles, 0.1, 0.01, S)
+assert S.number_of_faces() == lods[-1].number_of_faces()
+
+import threading
+point_oracle = Alpha_wrap_3_oracle.from_points(coords)
+outputs = [Polyhedron_3() for k in range(4)]
+threads = [threading.Thread(target=point_oracle.wrap, args=(0.1 * (k + 1), 0.5, outputs[k]))
+           for k in range(4)]
+for t in threads:
+    t.start()
+for t in threads:
+    t.join()
+assert all(P.size_of_facets() > 0 for P in outputs)
+
+# wrap stopped by a budget of Steiner points
+from CGAL.CGAL_Kernel import Cancellation_token
+token = Cancellation_token()
+coarse = Surface_mesh_3()
+assert not oracle.wrap(0.01, 0.001, coarse, 10, 0, token)
+assert coarse.number_of_faces() > 0
+assert token.progress() == 1
+assert oracle.wrap(0.4, 0.04, coarse, 0, 60)
+token.cancel()
+failed = False
+try:
+    oracle.wrap(0.1, 0.01, coarse, 0, 0, token)
+except Exception:
+    failed = True
+assert failed
@@ -39,3 +39,73 @@ offset = len(bboxes_1)
 print("Ids of segments which bbox intersect")
 for p in callback.ids():
     print(p[0], p[1] - offset)
+
+# Same query on arrays of boxes (xmin, ymin, xmax, ymax)
+from array import array
+from CGAL.CGAL_Box_intersection_d import box_intersection_d_arrays
+from CGAL.CGAL_Box_intersection_d import box_self_intersection_d_arrays
+
+
+def box_array(segments):
+    coords = array('d')
+    for s in segments:
+        b = s.bbox()
+        coords.extend([b.xmin(), b.ymin(), b.xmax(), b.ymax()])
+    return coords
+
+
+pairs = box_intersection_d_arrays(box_array(segments_1), box_array(segments_2), 2)
+assert pairs.shape[1] == 2
+found = sorted((p[0], p[1] - offset) for p in pairs.tolist())
+expected = sorted((p[0], p[1] - offset) for p in callback.ids())
+assert found == expected
+
+# with user ids, and the second set against itself
+ids_1 = array('i', [10, 11, 12])
+ids_2 = array('i', [20, 21, 22])
+pairs = box_intersection_d_arrays(box_array(segments_1), ids_1, box_array(segments_2), ids_2, 2)
+assert sorted(tuple(p) for p in pairs.tolist()) == sorted((10 + a, 20 + b) for a, b in found)
+pairs = box_self_intersection_d_arrays(box_array(segments_2), 2)
+print("Pairs of segments of the second set which bbox intersect:", pairs.tolist())
+
+# Narrow phase in the sweep: only the pairs of segments that intersect
+from CGAL.CGAL_Box_intersection_d import box_intersecting_pairs_arrays
+from CGAL.CGAL_Box_intersection_d import box_self_intersecting_pairs_arrays
+from CGAL.CGAL_Box_intersection_d import SEGMENT_2_SEGMENT_2, TRIANGLE_3_TRIANGLE_3
+
+
+def segment_array(segments):
+    coords = array('d')
+    for s in segments:
+        coords.extend([s.source().x(), s.source().y(), s.target().x(), s.target().y()])
+    return coords
+
+
+pairs = box_intersecting_pairs_arrays(segment_array(segments_1), segment_array(segments_2), SEGMENT_2_SEGMENT_2)
+print("Ids of segments which intersect:", [(p[0], p[1] - offset) for p in pairs.tolist()])
+
+# the boxes of the first two triangles intersect, not the triangles
+triangles = array('d', [0, 0, 0, 1, 0, 0, 0, 1, 0,
+                        0.9, 0.9, 0, 1, 1, 0, 0.9, 1, 1,
+                        0, 0, -1, 0.2, 0.2, 1, 0, 0.2, 1])
+pairs = box_self_intersecting_pairs_arrays(triangles, TRIANGLE_3_TRIANGLE_3)
+assert sorted(tuple(sorted(p)) for p in pairs.tolist()) == [(0, 2)]
+
+# Persistent index: only the pairs involving moved boxes are reported
+from CGAL.CGAL_Box_intersection_d import Box_index_3
+from CGAL.CGAL_Kernel import Bbox_3
+from CGAL.CGAL_Box_intersection_d import Box_with_id_3
+
+index = Box_index_3()
+# a row of unit boxes, two consecutive ones touching
+index.update(array('i', range(10)), array('d', [c for i in range(10) for c in (i, 0, 0, i + 1, 1, 1)]))
+assert index.number_of_boxes() == 10
+assert len(index.query_changed().tolist()) == 9
+assert len(index.query_changed().tolist()) == 0
+# box 3 moves away from its neighbors, box 10 is added over box 7
+index.update(array('i', [3, 10]), array('d', [3, 5, 0, 4, 6, 1, 7.5, 0.5, 0.5, 7.6, 0.6, 0.6]))
+index.update(Box_with_id_3(Bbox_3(0, 0, 0, 0.1, 0.1, 0.1), 11))
+assert sorted(tuple(p) for p in index.query_changed().tolist()) == [(10, 7), (11, 0)]
+index.remove(array('i', [10]))
+index.rebuild()
+assert len(index.query_all().tolist()) == 8
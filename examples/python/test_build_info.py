@@ -0,0 +1,24 @@
+from __future__ import print_function
+
+import importlib
+
+import CGAL
+
+info = CGAL.build_info()
+print(info)
+
+for name in ("tbb", "laslib", "zlib", "eigen", "opengr", "pointmatcher", "imageio",
+             "boost_serialization", "lto", "multi_isa", "lean_polyhedron"):
+    assert isinstance(info[name], bool), name
+assert info["cgal_version"] == CGAL.__version__
+assert (info["tbb_version"] is not None) == info["tbb"]
+
+# the modules reported are the ones installed
+assert "CGAL_Kernel" in info["modules"]
+for module in info["modules"]:
+    importlib.import_module("CGAL." + module)
+assert ("CGAL_Surface_mesher" in info["modules"]) == info["imageio"]
+assert ("CGAL_Polygon_mesh_processing" in info["modules"]) == info["eigen"]
+if "CGAL_Point_set_processing_3" in info["modules"]:
+    assert info["opengr"] and info["pointmatcher"]
+print("build info OK")
@@ -0,0 +1,43 @@
+from __future__ import print_function
+import numpy as np
+
+from CGAL.CGAL_Mesh_2 import make_conforming_Delaunay_2, make_conforming_Gabriel_2
+from CGAL.CGAL_Mesh_2 import Constrained_Delaunay_triangulation_conformer_2
+from CGAL.CGAL_Triangulation_2 import Constrained_Delaunay_triangulation_2
+
+# the constraints of the conforming example, as arrays
+points = np.array([[5., 5.], [-5., 5.], [4., 3.], [5., -5.],
+                   [6., 6.], [-6., 6.], [-6., -6.], [6., -6.]])
+segments = np.array([[0, 1], [1, 2], [2, 3], [3, 0],
+                     [4, 5], [5, 6], [6, 7], [7, 4]], dtype=np.int32)
+
+for conform in (make_conforming_Delaunay_2, make_conforming_Gabriel_2):
+    arrays = conform(points, segments)
+    assert arrays.number_of_points() >= len(points)
+    faces = arrays.face_array()
+    assert faces.shape[1] == 3 and faces.min() >= 0 and faces.max() < arrays.number_of_points()
+    # the input points are all vertices
+    out = arrays.point_array()
+    for p in points:
+        assert np.min(np.sum((out - p) ** 2, axis=1)) == 0
+
+try:
+    make_conforming_Delaunay_2(points, np.array([[0, 8]], dtype=np.int32))
+    assert False
+except Exception:
+    pass
+
+# incremental: adding constraints to a conforming triangulation keeps it conforming
+cdt = Constrained_Delaunay_triangulation_2()
+make_conforming_Gabriel_2(cdt, points[:4], segments[:4])
+assert Constrained_Delaunay_triangulation_conformer_2(cdt).is_conforming_Gabriel()
+n = cdt.number_of_vertices()
+added = make_conforming_Gabriel_2(cdt, points[4:], segments[4:] - 4)
+assert added >= 4 and cdt.number_of_vertices() == n + added
+assert Constrained_Delaunay_triangulation_conformer_2(cdt).is_conforming_Gabriel()
+
+cdt = Constrained_Delaunay_triangulation_2()
+make_conforming_Delaunay_2(cdt, points[4:], segments[4:] - 4)
+make_conforming_Delaunay_2(cdt, points[:4], segments[:4])
+assert Constrained_Delaunay_triangulation_conformer_2(cdt).is_conforming_Delaunay()
+print("conforming OK")
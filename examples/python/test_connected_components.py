@@ -0,0 +1,39 @@
+from __future__ import print_function
+
+import numpy as np
+
+from CGAL.CGAL_Polyhedron_3 import Polyhedron_3
+from CGAL.CGAL_Surface_mesh import Surface_mesh_3
+from CGAL import CGAL_Polygon_mesh_processing as pmp
+
+# two disjoint tetrahedra, the second one twice as large
+tet = np.array([[0, 0, 0], [1, 0, 0], [0, 1, 0], [0, 0, 1]], dtype=float)
+vertices = np.vstack([tet, 2 * tet + 5])
+faces = np.array([[0, 2, 1], [0, 1, 3], [0, 3, 2], [1, 2, 3]], dtype=np.int32)
+faces = np.vstack([faces, faces + 4])
+
+P = Polyhedron_3.from_arrays(vertices, faces)
+labels = pmp.connected_component_labels(P)
+ids = np.asarray(labels.component_id_array())
+assert ids.dtype == np.int32 and ids.shape == (8,)
+assert list(ids) == [0, 0, 0, 0, 1, 1, 1, 1]
+assert labels.number_of_components() == 2
+assert list(np.asarray(labels.face_count_array())) == [4, 4]
+
+area = 1.5 + np.sqrt(3) / 2
+assert np.allclose(np.asarray(labels.area_array()), [area, 4 * area])
+bboxes = np.asarray(labels.bbox_array())
+assert bboxes.shape == (2, 6)
+assert np.allclose(bboxes, [[0, 0, 0, 1, 1, 1], [5, 5, 5, 7, 7, 7]])
+
+# the same labels for a Surface_mesh_3
+M = Surface_mesh_3(vertices, faces)
+M_labels = pmp.connected_component_labels(M)
+assert list(np.asarray(M_labels.component_id_array())) == list(ids)
+assert np.allclose(np.asarray(M_labels.area_array()), [area, 4 * area])
+
+# keeps the largest component with the labels
+pmp.keep_connected_components(P, np.array([1], dtype=np.int32), labels)
+assert P.size_of_facets() == 4
+
+print("connected components OK")
@@ -0,0 +1,53 @@
+from __future__ import print_function
+from array import array
+import sys
+
+from CGAL.CGAL_Constrained_triangulation_3 import make_conforming_constrained_Delaunay_triangulation_3
+
+
+def volume(p, q, r, s):
+    u = [q[i] - p[i] for i in range(3)]
+    v = [r[i] - p[i] for i in range(3)]
+    w = [s[i] - p[i] for i in range(3)]
+    return (u[0] * (v[1] * w[2] - v[2] * w[1]) - u[1] * (v[0] * w[2] - v[2] * w[0])
+            + u[2] * (v[0] * w[1] - v[1] * w[0])) / 6.
+
+
+# the unit cube as 6 quads, with a point outside to have cells around it
+points = array('d', [0, 0, 0, 1, 0, 0, 1, 1, 0, 0, 1, 0,
+                     0, 0, 1, 1, 0, 1, 1, 1, 1, 0, 1, 1,
+                     3, 3, 3])
+quads = array('i', [0, 3, 2, 1, 4, 5, 6, 7, 0, 1, 5, 4,
+                    2, 3, 7, 6, 1, 2, 6, 5, 0, 4, 7, 3])
+try:
+    cdt = make_conforming_constrained_Delaunay_triangulation_3(points, memoryview(quads).cast('B').cast('i', [6, 4]))
+except RuntimeError:
+    print("make_conforming_constrained_Delaunay_triangulation_3 needs CGAL 6.1 or later")
+    sys.exit(0)
+
+assert cdt.number_of_vertices() >= 9
+# each quad is covered by at least 2 constrained facets
+assert cdt.number_of_constrained_facets() >= 12
+assert set(cdt.facet_polygon_array()) == set(range(6))
+
+# the cells labelled > 0 fill the cube
+xyz = cdt.point_array()
+cells = cdt.cell_array()
+components = cdt.cell_component_array()
+assert cdt.number_of_components() == 2
+inside = 0.
+for j in range(cdt.number_of_cells()):
+    if components[j] > 0:
+        inside += abs(volume(*[[xyz[cells[j, k], i] for i in range(3)] for k in range(4)]))
+assert abs(inside - 1) < 1e-9, inside
+
+# the same cube as compressed sparse rows
+offsets = array('i', [0, 4, 8, 12, 16, 20, 24])
+assert make_conforming_constrained_Delaunay_triangulation_3(points, offsets, quads).number_of_components() == 2
+
+try:
+    make_conforming_constrained_Delaunay_triangulation_3(points, array('i', [0, 1, 9]))
+    assert False
+except Exception:
+    pass
+print("constrained triangulation 3 OK")
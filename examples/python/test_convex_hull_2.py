@@ -21,3 +21,20 @@ n = Point_2()
 
 CGAL_Convex_hull_2.ch_n_point(L, n)
 print(n)
+
+# same hull from an array of coordinates, as indices of the points
+from array import array
+coords = array('d')
+for p in L:
+    coords.extend([p.x(), p.y()])
+hull = CGAL_Convex_hull_2.convex_hull_2(coords)
+print("hull indices:", hull.tolist())
+assert sorted(hull.tolist()) == [0, 1, 3, 6]
+assert sorted(CGAL_Convex_hull_2.ch_graham_andrew(coords).tolist()) == [0, 1, 3, 6]
+
+# one hull per label, the last point having no label
+labels = array('i', [0, 0, 0, 1, 1, 1, -1])
+hulls = CGAL_Convex_hull_2.convex_hulls_2_by_label(coords, labels)
+assert hulls.number_of_hulls() == 2
+assert hulls.offset_array().tolist() == [0, 3, 6]
+assert abs(hulls.area_array()[0] - 0.5) < 1e-12
@@ -32,3 +32,47 @@ planes.append(Plane_3(0, 0, 1, -1))
 res.clear()
 CGAL_Convex_hull_3.halfspace_intersection_3(planes, res)
 print("halfspace intersection has ", res.size_of_vertices(), " vertices")
+
+# same hull from an array of coordinates, without a polyhedron
+from array import array
+coords = array('d')
+for p in pts:
+    coords.extend([p.x(), p.y(), p.z()])
+coords.extend([0.5, 0.5, 0.5])  # inside
+hull = CGAL_Convex_hull_3.convex_hull_3_arrays(coords)
+assert hull.number_of_hulls() == 1
+assert sorted(hull.vertex_array().tolist()) == list(range(8))
+assert len(hull.triangle_array().tolist()) == 12
+extremes = CGAL_Convex_hull_3.convex_hull_3_arrays(coords, True)
+assert len(extremes.triangle_array().tolist()) == 0
+
+# two clusters: the cube and a tetrahedron
+coords.extend([2, 0, 0, 3, 0, 0, 2, 1, 0, 2, 0, 1])
+hulls = CGAL_Convex_hull_3.convex_hulls_3_arrays(coords, array('i', [0, 9, 13]))
+print("vertices per hull:", hulls.vertex_offset_array().tolist())
+assert hulls.triangle_offset_array().tolist() == [0, 12, 16]
+assert abs(hulls.volume_array()[0] - 1) < 1e-12
+assert abs(hulls.area_array()[0] - 6) < 1e-12
+
+# same clusters given by labels, the point inside the cube being ignored
+labels = array('i', [0] * 8 + [-1] + [1] * 4)
+hulls = CGAL_Convex_hull_3.convex_hulls_by_label(coords, labels)
+assert hulls.number_of_hulls() == 2
+assert abs(hulls.volume_array()[1] - 1. / 6) < 1e-12
+print("volumes:", hulls.volume_array().tolist(), "areas:", hulls.area_array().tolist())
+
+# halfspace intersections of sets of planes (a, b, c, d): unit cube, the
+# cube translated by 0.5, and an empty intersection
+cube = [-1, 0, 0, 0, 1, 0, 0, -1, 0, -1, 0, 0, 0, 1, 0, -1, 0, 0, -1, 0, 0, 0, 1, -1]
+shifted = [-1, 0, 0, 0.5, 1, 0, 0, -1.5, 0, -1, 0, 0.5, 0, 1, 0, -1.5, 0, 0, -1, 0.5, 0, 0, 1, -1.5]
+empty = [1, 0, 0, 0, -1, 0, 0, 1]
+planes_array = array('d', cube + shifted + empty)
+offsets = array('i', [0, 6, 12, 14])
+polytopes = CGAL_Convex_hull_3.halfspace_intersections_3_arrays(planes_array, offsets)
+assert polytopes.number_of_polytopes() == 3
+assert polytopes.vertex_offset_array().tolist() == [0, 8, 16, 16]
+assert polytopes.triangle_offset_array().tolist() == [0, 12, 24, 24]
+assert CGAL_Convex_hull_3.do_intersect_polytopes_3(array('d', cube), array('d', shifted))
+assert not CGAL_Convex_hull_3.do_intersect_polytopes_3(array('d', cube), array('d', empty))
+tests = CGAL_Convex_hull_3.do_intersect_polytopes_3_arrays(planes_array, offsets, array('i', [0, 1, 1, 2]))
+assert tests.tolist() == [1, 0]
@@ -0,0 +1,51 @@
+from __future__ import print_function
+
+from array import array
+
+from CGAL.CGAL_Kernel import Point_2, Point_3, Vector_3
+from CGAL.CGAL_Kernel import Point_2_array, Point_3_array, Vector_3_array
+
+points = Point_3_array(array('d', [0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1]))
+assert len(points) == 4
+assert points[1] == Point_3(1, 0, 0)
+assert points[-1] == Point_3(0, 0, 1)
+points.append(Point_3(1, 1, 1))
+points[0] = Point_3(-1, -1, -1)
+assert points[0].x() == -1
+
+# the view shares the coordinates of the points
+view = memoryview(points.array())
+assert view.shape == (5, 3)
+view[1, 2] = 5
+assert points[1] == Point_3(1, 0, 5)
+
+# slices are copies
+tail = points[2:]
+assert len(tail) == 3 and tail[0] == Point_3(0, 1, 0)
+tail.scale(2)
+assert points[2] == Point_3(0, 1, 0) and tail[0] == Point_3(0, 2, 0)
+assert len(points[::2]) == 3
+
+points.translate(array('d', [1, 2, 3]))
+assert points[2] == Point_3(1, 3, 3)
+
+vectors = Vector_3_array()
+vectors.extend(array('d', [1, 2, 3, 4, 5, 6]))
+assert vectors[1] == Vector_3(4, 5, 6)
+
+points_2 = Point_2_array(array('d', [0, 1, 2, 3]))
+assert points_2.deepcopy()[1] == Point_2(2, 3)
+
+failed = False
+try:
+    points[10]
+except Exception:
+    failed = True
+assert failed
+
+# used in place by the bindings
+from CGAL import CGAL_Alpha_wrap_3
+from CGAL.CGAL_Surface_mesh import Surface_mesh_3
+wrap = Surface_mesh_3()
+CGAL_Alpha_wrap_3.alpha_wrap_3(points, 0.5, 0.1, wrap)
+assert wrap.number_of_faces() > 0
@@ -0,0 +1,99 @@
+from __future__ import print_function
+
+from array import array
+import threading
+
+from CGAL.CGAL_Kernel import Point_3, Ray_3, Triangle_3
+from CGAL.CGAL_AABB_tree import AABB_tree_Triangle_3_soup
+from CGAL.CGAL_Spatial_searching import Orthogonal_k_neighbor_search_tree_3
+from CGAL.CGAL_Triangulation_3 import Delaunay_triangulation_3
+
+
+def run_in_threads(query, nb_threads=4):
+    errors = []
+
+    def worker():
+        try:
+            query()
+        except Exception as e:
+            errors.append(e)
+    threads = [threading.Thread(target=worker) for i in range(nb_threads)]
+    for t in threads:
+        t.start()
+    for t in threads:
+        t.join()
+    assert not errors, errors
+
+
+def assert_frozen(function, *args):
+    try:
+        function(*args)
+        assert False
+    except Exception as e:
+        assert "frozen" in str(e)
+
+
+# AABB tree: freeze() builds the hierarchy and the distance search tree
+triangles = [Triangle_3(Point_3(i, 0, 0), Point_3(i + 1, 0, 0), Point_3(i, 1, 0))
+             for i in range(100)]
+tree = AABB_tree_Triangle_3_soup(triangles)
+assert not tree.is_frozen()
+tree.freeze()
+assert tree.is_frozen()
+expected = [tree.squared_distance(Point_3(i, 0, 1)) for i in range(100)]
+
+
+def aabb_queries():
+    for k in range(20):
+        for i in range(100):
+            assert tree.squared_distance(Point_3(i, 0, 1)) == expected[i]
+        assert tree.number_of_intersected_primitives(Ray_3(Point_3(0.5, 0.1, 1), Point_3(0.5, 0.1, -1))) == 1
+        assert list(tree.squared_distance_batch(array('d', [0, 0, 1]))) == [expected[0]]
+
+
+run_in_threads(aabb_queries)
+assert_frozen(tree.clear)
+assert_frozen(tree.rebuild, triangles)
+assert tree.size() == 100
+
+# kd-tree: freeze() builds the tree and the index tree of the batched queries
+points = [Point_3(i % 10, (i // 10) % 10, i // 100) for i in range(1000)]
+kd_tree = Orthogonal_k_neighbor_search_tree_3(points)
+kd_tree.freeze()
+assert kd_tree.is_frozen()
+queries = array('d', [0.1, 0.1, 0.1, 5.2, 5.1, 5.3])
+
+
+def kd_queries():
+    for k in range(20):
+        assert list(kd_tree.radius_neighbor_counts(queries, 0.5)) == [1, 1]
+        assert kd_tree.knn_batch(queries, 3).number_of_queries() == 2
+
+
+run_in_threads(kd_queries)
+assert_frozen(kd_tree.insert, Point_3(0, 0, 0))
+assert_frozen(kd_tree.clear)
+assert kd_tree.size() == 1000
+
+# triangulation
+dt = Delaunay_triangulation_3(points)
+dt.freeze()
+assert dt.is_frozen()
+v = dt.nearest_vertex(Point_3(3.1, 4.1, 5.1))
+
+
+def dt_queries():
+    for k in range(200):
+        assert dt.nearest_vertex(Point_3(3.1, 4.1, 5.1)) == v
+        dt.locate(Point_3(2.5, 2.5, 2.5))
+        cells = []
+        dt.incident_cells(v, cells)
+        assert cells
+
+
+run_in_threads(dt_queries)
+assert_frozen(dt.insert, Point_3(20, 20, 20))
+assert_frozen(dt.remove, v)
+assert_frozen(dt.clear)
+assert dt.number_of_vertices() == 1000
+print("frozen queries OK")
@@ -0,0 +1,45 @@
+from __future__ import print_function
+
+import numpy as np
+
+from CGAL.CGAL_HalfedgeDS import HalfedgeDS
+
+# two triangles sharing the edge (1,2)
+vertices = np.array([[0, 0], [1, 0], [0, 1], [1, 1]], dtype=float)
+faces = np.array([[0, 1, 2], [2, 1, 3]], dtype=np.int32)
+
+hds = HalfedgeDS.from_arrays(vertices, faces)
+assert hds.size_of_vertices() == 4 and hds.size_of_faces() == 2
+assert hds.size_of_halfedges() == 10
+assert np.array_equal(np.asarray(hds.vertex_array()), vertices)
+# the faces, up to a rotation of their vertices
+out_faces = np.asarray(hds.face_array())
+assert out_faces.shape == (2, 3)
+for f, g in zip(out_faces, faces):
+    assert any(np.array_equal(np.roll(f, i), g) for i in range(3))
+
+t = hds.topology()
+next_ = np.asarray(t.next_array())
+prev = np.asarray(t.prev_array())
+opposite = np.asarray(t.opposite_array())
+vertex = np.asarray(t.vertex_array())
+face = np.asarray(t.face_array())
+h = np.arange(hds.size_of_halfedges())
+assert next_.dtype == np.int32
+assert np.array_equal(opposite[opposite], h) and np.all(opposite != h)
+assert np.array_equal(prev[next_], h)
+# 3 halfedges around each face, the border ones having no face
+assert np.array_equal(np.bincount(face[face >= 0]), [3, 3])
+assert np.count_nonzero(face < 0) == 4
+# next of a halfedge starts at its target
+assert np.array_equal(vertex[opposite[next_]], vertex)
+assert np.array_equal(vertex[np.asarray(t.vertex_halfedge_array())], np.arange(4))
+assert np.array_equal(face[np.asarray(t.face_halfedge_array())], [0, 1])
+
+try:
+    HalfedgeDS.from_arrays(vertices, np.array([[0, 1, 2], [0, 1, 3]], dtype=np.int32))
+    assert False, "inconsistent orientation not detected"
+except Exception:
+    pass
+
+print("HalfedgeDS arrays OK")
@@ -0,0 +1,59 @@
+from __future__ import print_function
+
+import os
+import subprocess
+import sys
+
+# Import time of the modules, each one measured in a new interpreter, with
+# the default imports and with the lazy ones (CGAL_SWIG_LAZY_IMPORTS=1).
+# The import of a module with lazy imports includes the first access to one
+# of its attributes, which loads its dependencies as needed.
+modules = [("CGAL_Kernel", "Point_3"),
+           ("CGAL_Polyhedron_3", "Polyhedron_3"),
+           ("CGAL_AABB_tree", "AABB_tree_Polyhedron_3_Facet_handle"),
+           ("CGAL_Polygon_mesh_processing", "isotropic_remeshing")]
+
+script = """
+import time
+t = time.perf_counter()
+import CGAL.%s as m
+getattr(m, "%s")
+print(time.perf_counter() - t)
+"""
+
+
+def import_time(module, attribute, lazy, repeat=3):
+    env = dict(os.environ)
+    env["CGAL_SWIG_LAZY_IMPORTS"] = "1" if lazy else "0"
+    times = []
+    for i in range(repeat):
+        out = subprocess.check_output([sys.executable, "-c", script % (module, attribute)], env=env)
+        times.append(float(out.decode().strip()))
+    return min(times)
+
+
+if __name__ == '__main__':
+    print("%-32s %10s %10s" % ("module", "eager (ms)", "lazy (ms)"))
+    for module, attribute in modules:
+        print("%-32s %10.1f %10.1f" % (module, 1000 * import_time(module, attribute, False),
+                                       1000 * import_time(module, attribute, True)))
+
+    # the package itself does not load any module
+    out = subprocess.check_output([sys.executable, "-c",
+                                   "import sys, CGAL; print(any(m.startswith('CGAL.CGAL_') for m in sys.modules))"])
+    assert out.decode().strip() == "False"
+
+    # with lazy imports, the dependencies not used are not loaded
+    env = dict(os.environ)
+    env["CGAL_SWIG_LAZY_IMPORTS"] = "1"
+    out = subprocess.check_output([sys.executable, "-c", """
+import sys
+import CGAL.CGAL_Polygon_mesh_processing as pmp
+from CGAL.CGAL_Polyhedron_3 import Polyhedron_3
+P = Polyhedron_3()
+P.make_tetrahedron()
+pmp.triangulate_faces(P)
+print(P.size_of_facets(), type(sys.modules['CGAL.CGAL_AABB_tree']).__name__)
+"""], env=env)
+    assert out.decode().split() == ["4", "_LazyModule"], out
+    print("import time OK")
@@ -0,0 +1,79 @@
+from __future__ import print_function
+
+import math
+from array import array
+
+from CGAL import CGAL_Kernel_batch
+from CGAL.CGAL_Kernel import Point_2, orientation
+
+# orientation_2, with nearly collinear rows decided by the exact predicate
+p = array('d', [0, 0, 0, 0, 0.5, 0.5, 0, 0])
+q = array('d', [1, 0, 1, 0, 12, 12, 1, 1])
+r = array('d', [0, 1, 0, -1, 24, 24, 2, 2])
+o = CGAL_Kernel_batch.orientation_2_batch(p, q, r).tolist()
+assert o == [1, -1, 0, 0]
+for i in range(4):
+    expected = orientation(Point_2(p[2*i], p[2*i+1]), Point_2(q[2*i], q[2*i+1]), Point_2(r[2*i], r[2*i+1]))
+    assert int(expected) == o[i]
+
+# a large number of rows, processed by blocks
+n = 10000
+p = array('d', [0, 0, 0] * n)
+q = array('d', [1, 0, 0] * n)
+r = array('d', [0, 1, 0] * n)
+s = array('d', [x for i in range(n) for x in (0, 0, (i % 3) - 1)])
+o = CGAL_Kernel_batch.orientation_3_batch(p, q, r, s).tolist()
+assert o == [(i % 3) - 1 for i in range(n)]
+
+# insphere and incircle
+circle = CGAL_Kernel_batch.side_of_oriented_circle_batch(array('d', [0, 0, 0, 0]), array('d', [1, 0, 1, 0]),
+                                                         array('d', [0, 1, 0, 1]), array('d', [0.5, 0.5, 2, 2]))
+assert circle.tolist() == [1, -1]
+sphere = CGAL_Kernel_batch.side_of_oriented_sphere_batch(array('d', [0, 0, 0]), array('d', [1, 0, 0]),
+                                                         array('d', [0, 1, 0]), array('d', [0, 0, 1]),
+                                                         array('d', [1, 1, 1]))
+assert sphere.tolist() == [0]
+
+d = CGAL_Kernel_batch.squared_distance_3_batch(array('d', [0, 0, 0, 1, 1, 1]), array('d', [1, 2, 2, 1, 1, 1]))
+assert d.tolist() == [9, 0]
+
+seg = CGAL_Kernel_batch.do_intersect_segment_2_batch(array('d', [0, 0, 1, 1, 0, 0, 1, 0]),
+                                                     array('d', [0, 1, 1, 0, 0, 1, 1, 1]))
+assert seg.tolist() == [1, 0]
+triangle = array('d', [0, 0, 0, 1, 0, 0, 0, 1, 0])
+ts = CGAL_Kernel_batch.do_intersect_triangle_3_segment_3_batch(triangle + triangle,
+                                                               array('d', [0.2, 0.2, -1, 0.2, 0.2, 1,
+                                                                           2, 2, -1, 2, 2, 1]))
+assert ts.tolist() == [1, 0]
+tt = CGAL_Kernel_batch.do_intersect_triangle_3_batch(triangle,
+                                                     array('d', [0.2, 0.2, -1, 0.2, 0.2, 1, 1, 1, 0]))
+assert tt.tolist() == [1]
+
+# intersections with their type (0 none, 1 point, 2 segment, 3 triangle)
+# and vertices, padded with NaN
+inter = CGAL_Kernel_batch.intersection_segment_2_batch(array('d', [0, 0, 2, 2, 0, 0, 2, 0, 0, 0, 1, 0]),
+                                                       array('d', [0, 2, 2, 0, 0, 1, 1, 1, 0.5, 0, 3, 0]))
+assert inter.type_array().tolist() == [1, 0, 2]
+points = inter.point_array()
+assert points.shape == (3, 6)
+assert points[0, 0] == 1 and points[0, 1] == 1 and math.isnan(points[0, 2])
+assert sorted([points[2, 0], points[2, 2]]) == [0.5, 1]
+assert all(math.isnan(points[1, i]) for i in range(6))
+inter = CGAL_Kernel_batch.intersection_triangle_3_segment_3_batch(triangle + triangle,
+                                                                  array('d', [0.2, 0.2, -1, 0.2, 0.2, 1,
+                                                                              2, 2, -1, 2, 2, 1]))
+assert inter.type_array().tolist() == [1, 0]
+assert [inter.point_array()[0, i] for i in range(3)] == [0.2, 0.2, 0]
+inter = CGAL_Kernel_batch.intersection_triangle_3_ray_3_batch(triangle, array('d', [0.25, 0.25, 1, 0, 0, -1]))
+assert inter.type_array().tolist() == [1]
+inter = CGAL_Kernel_batch.intersection_triangle_3_plane_3_batch(triangle + triangle + triangle,
+                                                                array('d', [1, 0, 0, -0.5, 0, 0, 1, 0, 0, 0, 1, -1]))
+assert inter.type_array().tolist() == [2, 3, 0]
+assert inter.number_of_intersections() == 2
+
+failed = False
+try:
+    CGAL_Kernel_batch.squared_distance_2_batch(array('d', [0, 0]), array('d', [0, 0, 1, 1]))
+except Exception:
+    failed = True
+assert failed  # different numbers of rows
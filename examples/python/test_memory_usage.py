@@ -0,0 +1,42 @@
+from __future__ import print_function
+
+from array import array
+
+from CGAL.CGAL_Kernel import Point_3
+from CGAL.CGAL_Point_set_3 import Point_set_3
+from CGAL.CGAL_Spatial_searching import Orthogonal_k_neighbor_search_tree_3
+from CGAL.CGAL_Triangulation_3 import Delaunay_triangulation_3
+
+points = [Point_3(i % 10, (i // 10) % 10, i // 100) for i in range(1000)]
+
+# triangulation: shrink_to_fit() keeps the triangulation
+dt = Delaunay_triangulation_3(points)
+usage = dt.memory_usage()
+assert usage.structure() > 0
+assert usage.total() == usage.structure() + usage.properties() + usage.search_index() + usage.caches()
+dt.shrink_to_fit()
+assert dt.number_of_vertices() == 1000
+assert dt.memory_usage().total() <= usage.total()
+
+# kd-tree: the nodes are counted once the tree is built
+kd_tree = Orthogonal_k_neighbor_search_tree_3(points)
+assert kd_tree.memory_usage().search_index() == 0
+kd_tree.build()
+assert kd_tree.memory_usage().search_index() > 0
+
+# point set: the properties are counted apart from the points
+coordinates = array('d', [float(i) for i in range(300)])
+ps = Point_set_3.from_arrays(coordinates)
+assert ps.memory_usage().properties() == 0
+ps.add_normal_map()
+assert ps.memory_usage().properties() > 0
+# shrink_to_fit() collects the removed points, its property maps stay valid
+labels = ps.add_int_map("label")
+for i in range(100):
+    labels.set(i, i)
+ps.remove(0)
+ps.shrink_to_fit()
+assert ps.number_of_points() == 99
+assert not ps.has_garbage()
+assert sorted(labels.get(i) for i in range(99)) == list(range(1, 100))
+print("memory usage OK")
@@ -0,0 +1,42 @@
+from __future__ import print_function
+
+import numpy as np
+
+from CGAL.CGAL_Polyhedron_3 import Polyhedron_3
+from CGAL.CGAL_Surface_mesh import Surface_mesh_3
+from CGAL.CGAL_Point_set_3 import Point_set_3
+from CGAL import CGAL_Polygon_mesh_processing as pmp
+
+# the unit cube, and the same cube moved by 0.1 along x
+vertices = np.array([[x, y, z] for x in (0, 1) for y in (0, 1) for z in (0, 1)], dtype=float)
+faces = np.array([[0, 1, 3], [0, 3, 2], [4, 6, 7], [4, 7, 5], [0, 4, 5], [0, 5, 1],
+                  [2, 3, 7], [2, 7, 6], [0, 2, 6], [0, 6, 4], [1, 5, 7], [1, 7, 3]], dtype=np.int32)
+moved = vertices + [0.1, 0, 0]
+
+points = np.array([[0.5, 0.5, 0.5], [0.5, 0.5, 1.5], [0.2, 0.5, 0.5], [2., 0.5, 0.5]])
+for make in (Polyhedron_3.from_arrays, Surface_mesh_3):
+    cube, other = make(vertices, faces), make(moved, faces)
+    assert pmp.approximate_Hausdorff_distance(cube, cube, 100) < 1e-9
+    d = pmp.approximate_symmetric_Hausdorff_distance(cube, other, 1000)
+    assert 0.09 < d < 0.11
+    assert abs(pmp.max_distance_to_triangle_mesh(points, cube) - 1) < 1e-9
+
+    assert np.allclose(pmp.distances_to_triangle_mesh(points, cube), [0.5, 0.5, 0.2, 1])
+    assert np.allclose(pmp.distances_to_triangle_mesh(points, cube, True), [-0.5, 0.5, -0.2, 1])
+
+    # written in place, in a property of a point set
+    scan = Point_set_3.from_arrays(points)
+    deviation = scan.add_float_map("deviation")
+    pmp.distances_to_triangle_mesh(scan.point_array(), cube, scan.property_array(deviation), True)
+    assert np.allclose(scan.property_array(deviation), [-0.5, 0.5, -0.2, 1])
+    out = np.zeros(4, dtype=np.float32)
+    pmp.distances_to_triangle_mesh(points, cube, out, True)
+    assert np.allclose(out, [-0.5, 0.5, -0.2, 1])
+
+# signed distances need a closed mesh
+try:
+    pmp.distances_to_triangle_mesh(points, Surface_mesh_3(vertices, faces[:10]), True)
+    assert False
+except Exception:
+    pass
+print("mesh distances OK")
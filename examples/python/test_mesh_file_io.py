@@ -0,0 +1,45 @@
+from __future__ import print_function
+
+import os
+import tempfile
+
+from CGAL.CGAL_Polyhedron_3 import Polyhedron_3
+
+datadir = os.environ.get('DATADIR', '../data')
+
+P = Polyhedron_3(datadir + '/elephant.off')
+Q = Polyhedron_3()
+Q.read_mesh(datadir + '/elephant.off')
+assert Q.size_of_vertices() == P.size_of_vertices()
+assert Q.size_of_facets() == P.size_of_facets()
+
+tmpdir = tempfile.mkdtemp()
+for extension in ["off", "obj", "ply", "stl"]:
+    filename = os.path.join(tmpdir, "elephant." + extension)
+    assert Q.write_mesh(filename)
+    R = Polyhedron_3()
+    R.read_mesh(filename)
+    assert R.size_of_vertices() == Q.size_of_vertices(), extension
+    assert R.size_of_facets() == Q.size_of_facets(), extension
+    assert R.is_valid()
+    if extension != "stl":  # STL stores float coordinates
+        assert list(R.vertex_array()) == list(Q.vertex_array()), extension
+    os.remove(filename)
+
+# polygons of any degree, with relative OBJ indices
+filename = os.path.join(tmpdir, "pyramid.obj")
+with open(filename, "w") as f:
+    f.write("v 0 0 0\nv 1 0 0\nv 1 1 0\nv 0 1 0\nv 0.5 0.5 1\n"
+            "f 1 4 3 2\nf 1/1 2/1 5/1\nf -4 -3 -1\nf 3 4 5\nf 4 1 5\n")
+R = Polyhedron_3()
+R.read_mesh(filename)
+assert R.size_of_facets() == 5 and R.is_closed()
+os.remove(filename)
+
+try:
+    R.read_mesh(os.path.join(tmpdir, "missing.off"))
+    assert False
+except Exception:
+    pass
+os.rmdir(tmpdir)
+print("mesh file I/O OK")
@@ -0,0 +1,34 @@
+from __future__ import print_function
+
+import math
+
+import numpy as np
+
+from CGAL.CGAL_Polyhedron_3 import Polyhedron_3
+from CGAL.CGAL_Surface_mesh import Surface_mesh_3
+from CGAL import CGAL_Polygon_mesh_processing as pmp
+
+vertices = np.array([[0, 0, 0], [1, 0, 0], [0, 1, 0], [0, 0, 1]], dtype=float)
+faces = np.array([[0, 2, 1], [0, 1, 3], [0, 3, 2], [1, 2, 3]], dtype=np.int32)
+
+for mesh in [Polyhedron_3.from_arrays(vertices, faces), Surface_mesh_3(vertices, faces)]:
+    areas = np.asarray(pmp.face_areas(mesh))
+    assert np.allclose(areas, [0.5, 0.5, 0.5, math.sqrt(3) / 2])
+
+    centroids = np.asarray(pmp.face_centroids(mesh))
+    assert centroids.shape == (4, 3)
+    assert np.allclose(centroids, vertices[faces].mean(axis=1))
+
+    lengths = np.sort(np.asarray(pmp.edge_lengths(mesh)))
+    assert np.allclose(lengths, [1, 1, 1] + [math.sqrt(2)] * 3)
+
+    # angles between the normals, positive as the tetrahedron is convex
+    angles = np.sort(np.asarray(pmp.dihedral_angles(mesh)))
+    assert angles.shape == (6,)
+    assert np.allclose(angles, [90] * 3 + [math.degrees(math.acos(-1 / math.sqrt(3)))] * 3)
+
+# NaN on the border
+triangle = Polyhedron_3.from_arrays(vertices[:3], faces[:1])
+assert np.all(np.isnan(np.asarray(pmp.dihedral_angles(triangle))))
+
+print("mesh measures OK")
@@ -0,0 +1,52 @@
+from __future__ import print_function
+
+import numpy as np
+
+from CGAL.CGAL_Polyhedron_3 import Polyhedron_3
+from CGAL.CGAL_Surface_mesh import Surface_mesh_3
+from CGAL import CGAL_Surface_mesh_simplification as sms
+
+
+# n x n grid of the unit square, two triangles per cell, of height z(x,y)
+def grid(n, z=lambda x, y: 0 * x):
+    x, y = np.meshgrid(np.linspace(0, 1, n + 1), np.linspace(0, 1, n + 1))
+    vertices = np.column_stack([x.ravel(), y.ravel(), z(x, y).ravel()])
+    faces = []
+    for j in range(n):
+        for i in range(n):
+            v = j * (n + 1) + i
+            faces += [[v, v + 1, v + n + 2], [v, v + n + 2, v + n + 1]]
+    return vertices, np.array(faces, dtype=np.int32)
+
+
+def number_of_faces(mesh):
+    return mesh.size_of_facets() if isinstance(mesh, Polyhedron_3) else mesh.number_of_faces()
+
+
+vertices, faces = grid(20)
+bumps = grid(20, lambda x, y: 0.2 * np.sin(6 * x) * np.sin(6 * y))
+for make in (Polyhedron_3.from_arrays, Surface_mesh_3):
+    for policy in ("plane", "lindstrom_turk"):
+        mesh = make(vertices, faces)
+        assert sms.edge_collapse(mesh, 100, 0, policy) > 0
+        assert number_of_faces(mesh) <= 100
+
+    # the flat grid is decimated without error, not the bumps
+    flat, curved = make(vertices, faces), make(*bumps)
+    sms.edge_collapse(flat, 10, 1e-6)
+    sms.edge_collapse(curved, 10, 1e-6)
+    assert number_of_faces(flat) <= 10 < number_of_faces(curved)
+
+    meshes = [make(*grid(n)) for n in (5, 10, 20)]
+    removed = np.asarray(sms.edge_collapse_batch(meshes, 0.5))
+    assert len(removed) == 3 and (removed > 0).all()
+    for mesh, n in zip(meshes, (5, 10, 20)):
+        assert number_of_faces(mesh) <= n * n
+
+    try:
+        sms.edge_collapse(make(vertices, faces), 10, 0, "quadric")
+        assert False
+    except Exception:
+        pass
+
+print("OK")
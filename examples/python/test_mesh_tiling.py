@@ -0,0 +1,49 @@
+from __future__ import print_function
+
+import numpy as np
+
+from CGAL.CGAL_Kernel import Point_3, Vector_3
+from CGAL.CGAL_Polyhedron_3 import Polyhedron_3
+from CGAL.CGAL_Surface_mesh import Surface_mesh_3
+from CGAL import CGAL_Polygon_mesh_processing as pmp
+
+# a 2x2 square made of 2 triangles
+vertices = np.array([[0, 0, 0], [2, 0, 0], [2, 2, 0], [0, 2, 0]], dtype=float)
+faces = np.array([[0, 1, 2], [0, 2, 3]], dtype=np.int32)
+
+
+def tile_areas(tiles):
+    areas = []
+    for t in range(tiles.number_of_tiles()):
+        v = np.asarray(tiles.tile_vertices(t))
+        f = np.asarray(tiles.tile_faces(t))
+        n = np.cross(v[f[:, 1]] - v[f[:, 0]], v[f[:, 2]] - v[f[:, 0]])
+        areas.append(0.5 * np.linalg.norm(n, axis=1).sum())
+    return np.array(areas)
+
+
+for mesh in [Polyhedron_3.from_arrays(vertices, faces), Surface_mesh_3(vertices, faces)]:
+    tiles = pmp.split_by_grid(mesh, Point_3(0, 0, 0), 0.5)
+    assert tiles.number_of_tiles() == 16
+    keys = np.asarray(tiles.key_array())
+    assert keys.shape == (16, 3) and keys[:, :2].max() == 3 and keys[:, 2].max() == 0
+    assert np.allclose(tile_areas(tiles), 0.25)
+    # the vertices on the diagonal are shared by the pieces of both triangles
+    assert np.all(np.diff(np.asarray(tiles.vertex_offset_array())) == 4)
+
+    # the tiles as meshes
+    P = Polyhedron_3.from_arrays(tiles.tile_vertices(5), tiles.tile_faces(5))
+    assert P.size_of_facets() == 2
+
+    # split along x only
+    tiles = pmp.split_by_grid(mesh, Point_3(0, 0, 0), Vector_3(1, 0, 0))
+    assert tiles.number_of_tiles() == 2
+    assert np.allclose(tile_areas(tiles), 2)
+
+    # planes x = 1 and x + y = 2
+    planes = np.array([[1, 0, 0, -1], [1, 1, 0, -2]], dtype=float)
+    tiles = pmp.split_by_planes(mesh, planes)
+    assert [list(k) for k in np.asarray(tiles.key_array())] == [[0, 0], [0, 1], [1, 0], [1, 1]]
+    assert np.allclose(tile_areas(tiles), [1.5, 0.5, 0.5, 1.5])
+
+print("mesh tiling OK")
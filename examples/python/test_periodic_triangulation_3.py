@@ -0,0 +1,76 @@
+from __future__ import print_function
+import random
+from array import array
+
+from CGAL.CGAL_Kernel import Iso_cuboid_3
+from CGAL.CGAL_Periodic_3_triangulation_3 import Periodic_3_Delaunay_triangulation_3
+from CGAL.CGAL_Periodic_3_triangulation_3 import Periodic_3_regular_triangulation_3
+
+
+def volume(p, q, r, s):
+    u = [q[i] - p[i] for i in range(3)]
+    v = [r[i] - p[i] for i in range(3)]
+    w = [s[i] - p[i] for i in range(3)]
+    return (u[0] * (v[1] * w[2] - v[2] * w[1]) - u[1] * (v[0] * w[2] - v[2] * w[0])
+            + u[2] * (v[0] * w[1] - v[1] * w[0])) / 6.
+
+
+def check_covering(t, side):
+    # the cells of the 1-sheeted covering tile the domain
+    arrays = t.to_arrays()
+    points = arrays.point_array()
+    cells = arrays.cell_array()
+    offsets = arrays.offset_array()
+    total = 0.
+    for j in range(arrays.number_of_cells()):
+        corners = [[points[cells[j, k], i] + side * offsets[j, 3 * k + i] for i in range(3)]
+                   for k in range(4)]
+        total += abs(volume(*corners))
+    assert abs(total - side ** 3) < 1e-9, total
+    return arrays
+
+
+random.seed(1)
+side = 2.
+domain = Iso_cuboid_3(0, 0, 0, side, side, side)
+coordinates = array('d', [random.uniform(0, side) for i in range(3 * 1000)])
+
+t = Periodic_3_Delaunay_triangulation_3(domain)
+assert t.insert_from_array(coordinates) == 1000
+assert t.is_valid()
+assert t.is_triangulation_in_1_sheet()
+arrays = check_covering(t, side)
+assert arrays.number_of_points() == 1000
+print(t.number_of_vertices(), "vertices,", t.number_of_cells(), "cells")
+
+large = Periodic_3_Delaunay_triangulation_3(domain)
+assert large.insert_from_array(coordinates, True) == 1000
+assert large.number_of_cells() == t.number_of_cells()
+
+weighted = array('d')
+for i in range(1000):
+    weighted.extend(coordinates[3 * i:3 * i + 3])
+    weighted.append(random.uniform(0, 0.01))
+rt = Periodic_3_regular_triangulation_3(domain)
+n = rt.insert_from_array(weighted)
+assert rt.is_valid()
+arrays = check_covering(rt, side)
+assert arrays.point_array().shape == (rt.number_of_vertices(), 4)
+print(n, "weighted vertices (the others are hidden)")
+
+# too few points for the 1-sheeted covering
+small = Periodic_3_Delaunay_triangulation_3(domain)
+small.insert_from_array(array('d', [0.5, 0.5, 0.5]))
+assert not small.is_triangulation_in_1_sheet()
+try:
+    small.to_arrays()
+    assert False
+except Exception:
+    pass
+
+# points outside of [min,max) of the domain
+try:
+    t.insert_from_array(array('d', [side, 0, 0]))
+    assert False
+except Exception:
+    pass
@@ -0,0 +1,94 @@
+from __future__ import print_function
+
+from array import array
+import multiprocessing
+import os
+import pickle
+
+import CGAL
+from CGAL.CGAL_Kernel import Point_3
+from CGAL.CGAL_Polyhedron_3 import Polyhedron_3
+from CGAL.CGAL_Point_set_3 import Point_set_3, Mapped_point_set_3
+from CGAL.CGAL_Triangulation_3 import Delaunay_triangulation_3
+from CGAL.CGAL_AABB_tree import AABB_tree_indexed_Triangle_3_soup, Flat_AABB_tree_3
+
+datadir = os.environ.get('DATADIR', '../data')
+
+
+def number_of_facets(P):
+    return P.size_of_facets()
+
+
+def mapped_size(name):
+    # in the worker, the columns are views on the segment
+    points = Mapped_point_set_3.from_shared_memory(name)
+    return points.size(), list(points.point_array()[1])
+
+
+def flat_tree_distance(name):
+    tree = Flat_AABB_tree_3.from_shared_memory(name)
+    return list(tree.squared_distance_batch(array('d', [0.25, 0.25, 1])))
+
+
+if __name__ == '__main__':
+    # pickle round trips
+    P = Polyhedron_3(datadir + '/elephant.off')
+    Q = pickle.loads(pickle.dumps(P))
+    assert Q.size_of_vertices() == P.size_of_vertices()
+    assert Q.size_of_facets() == P.size_of_facets()
+    assert list(Q.vertex_array()) == list(P.vertex_array())
+
+    points = Point_set_3()
+    for i in range(100):
+        points.insert(Point_3(i, i % 7, i % 3))
+    points.add_float_map("weight")
+    points2 = pickle.loads(pickle.dumps(points))
+    assert points2.size() == 100 and points2.has_float_map("weight")
+    assert list(points2.point_array()[5]) == [5., 5., 2.]
+
+    dt = Delaunay_triangulation_3([Point_3(i % 10, (i // 10) % 10, i // 100) for i in range(500)])
+    dt2 = pickle.loads(pickle.dumps(dt))
+    assert dt2.number_of_vertices() == dt.number_of_vertices()
+    assert dt2.number_of_cells() == dt.number_of_cells()
+    assert dt2.is_valid()
+
+    vertices = array('d', [0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1])
+    faces = array('i', [0, 1, 2, 0, 1, 3, 0, 2, 3, 1, 2, 3])
+    soup = AABB_tree_indexed_Triangle_3_soup(vertices, faces)
+    soup2 = pickle.loads(pickle.dumps(soup))
+    assert soup2.size() == 4
+    assert soup2.squared_distance(Point_3(0.25, 0.25, -1)) == soup.squared_distance(Point_3(0.25, 0.25, -1))
+
+    flat = Flat_AABB_tree_3(vertices, faces)
+    flat.build()
+    flat2 = pickle.loads(pickle.dumps(flat))
+    assert flat2.is_mapped() and flat2.size() == 4
+
+    # the objects are pickled to be passed to multiprocessing workers
+    pool = multiprocessing.Pool(2)
+    assert pool.map(number_of_facets, [P, P]) == [P.size_of_facets()] * 2
+
+    # shared memory: the workers attach to the segments by their names
+    name = points.to_shared_memory()
+    assert pool.apply(mapped_size, (name,)) == (100, [1., 1., 1.])
+    assert Point_set_3.from_shared_memory(name).size() == 100
+    assert CGAL.remove_shared_memory(name)
+
+    name = flat.to_shared_memory()
+    expected = list(flat.squared_distance_batch(array('d', [0.25, 0.25, 1])))
+    assert pool.apply(flat_tree_distance, (name,)) == expected
+    assert CGAL.remove_shared_memory(name)
+
+    name = dt.to_shared_memory()
+    assert Delaunay_triangulation_3.from_shared_memory(name).number_of_vertices() == 500
+    CGAL.remove_shared_memory(name)
+    pool.close()
+    pool.join()
+
+    # corrupted states are rejected
+    try:
+        Polyhedron_3().load_state(b"not a state")
+        assert False
+    except Exception:
+        pass
+    print("pickle and shared memory OK")
@@ -10,6 +10,8 @@ from CGAL.CGAL_Polygon_mesh_processing import Point_3_Vector
 from CGAL.CGAL_Polygon_mesh_processing import Polygon_Vector
 from CGAL.CGAL_Polygon_mesh_processing import Polylines
 from CGAL.CGAL_Polygon_mesh_processing import Int_Vector
+from CGAL.CGAL_Polygon_mesh_processing import Exact_mesh_3
+from CGAL.CGAL_Polygon_mesh_processing import Heat_method_3
 
 from CGAL.CGAL_Polyhedron_3 import Polyhedron_3
 from CGAL.CGAL_Polyhedron_3 import Polyhedron_3_Halfedge_handle
@@ -20,6 +22,12 @@ from CGAL.CGAL_Kernel import Plane_3
 from CGAL.CGAL_Kernel import Vector_3
 from CGAL.CGAL_Kernel import Bbox_3
 from CGAL.CGAL_Kernel import ON_BOUNDARY, ON_UNBOUNDED_SIDE, ON_BOUNDED_SIDE
+from CGAL.CGAL_AABB_tree import AABB_tree_Polyhedron_3_Facet_handle
+from CGAL.CGAL_AABB_tree import AABB_tree_Surface_mesh_3
+from CGAL.CGAL_Surface_mesh import Surface_mesh_3
+from CGAL.CGAL_Point_set_3 import Point_set_3
+
+from array import array
 
 import os
 
@@ -81,6 +89,11 @@ def test_meshing_functions():
     for fh in P.facets():
         flist.append(fh)
     CGAL_Polygon_mesh_processing.isotropic_remeshing(flist, 0.25, P)
+    flist = []
+    for fh in P.facets():
+        flist.append(fh)
+    CGAL_Polygon_mesh_processing.isotropic_remeshing(flist, 0.05, P, 3, True)
+    assert P.is_valid() and P.has_compact_ids()
     # split_long_edges
     hlist = []
     for hh in P.halfedges():
@@ -88,6 +101,22 @@ def test_meshing_functions():
     CGAL_Polygon_mesh_processing.split_long_edges(hlist, 0.1, P)
 
 
+def test_smoothing_functions():
+    print("Testing smoothing functions...")
+    P = Polyhedron_3(datadir + "/elephant.off")
+    P.compact()
+    fixed = array('i', [0, 1, 2])
+    before = [(p.x(), p.y(), p.z()) for p in P.points()][:3]
+    CGAL_Polygon_mesh_processing.tangential_relaxation(P, 2, fixed)
+    assert [(p.x(), p.y(), p.z()) for p in P.points()][:3] == before
+    CGAL_Polygon_mesh_processing.smooth_shape(P, 0.0001, 1, fixed)
+    try:
+        CGAL_Polygon_mesh_processing.angle_and_area_smoothing(P, 1, fixed, True, False)
+    except RuntimeError:
+        print(" angle_and_area_smoothing needs CGAL 5.5 or later")
+    assert P.is_valid()
+
+
 def test_hole_filling_functions():
     print("Testing hole filling functions...")
     P = get_poly()
@@ -115,6 +144,18 @@ def test_hole_filling_functions():
     h = P.make_hole(hlist[0])
     CGAL_Polygon_mesh_processing.triangulate_refine_and_fair_hole(
         P, h, outf, outv, 1.4, 1)
+    # fill_all_holes
+    P = get_poly()
+    P.make_hole(P.halfedges().next())
+    stats = CGAL_Polygon_mesh_processing.fill_all_holes(
+        P, 0, CGAL_Polygon_mesh_processing.TRIANGULATE_REFINE_AND_FAIR_HOLE)
+    assert stats.number_of_holes() == 1 and stats.number_of_filled_holes() == 1
+    assert stats.border_size_array().tolist() == [3]
+    assert P.is_closed() and P.size_of_facets() == 3 + stats.facet_count_array()[0]
+    P.make_hole(P.halfedges().next())
+    stats = CGAL_Polygon_mesh_processing.fill_all_holes(
+        P, 2, CGAL_Polygon_mesh_processing.TRIANGULATE_HOLE)
+    assert stats.status_array().tolist() == [-1] and not P.is_closed()
     # triangulate_hole_polyline
     points = [Point_3(0, 0, 0), Point_3(1, 0, 0), Point_3(0, 1, 0)]
     third_points = [Point_3(0.5, -1, 0), Point_3(1, 1, 0), Point_3(-1, 0.5, 0)]
@@ -132,6 +173,8 @@ def test_predicate_functions():
     # self_intersections
     out = []
     CGAL_Polygon_mesh_processing.self_intersections(P, out)
+    pairs = CGAL_Polygon_mesh_processing.self_intersections(P)
+    assert (pairs.shape == (len(out), 2))
 
 
 def test_orientation_functions():
@@ -204,6 +247,30 @@ def test_combinatorial_repairing_functions():
     CGAL_Polygon_mesh_processing.remove_isolated_vertices(P)
 
 
+def test_polygon_soup_arrays():
+    print("Testing polygon soup functions on arrays...")
+    # a square with a duplicated point and a degenerate triangle
+    points = array('d', [0, 0, 0, 1, 0, 0, 1, 1, 0, 0, 1, 0, 0, 0, 0])
+    faces = array('i', [0, 1, 2, 4, 2, 3, 0, 1, 1])
+    soup = CGAL_Polygon_mesh_processing.repair_polygon_soup(points, faces)
+    assert soup.number_of_points() == 4
+    assert soup.number_of_faces() == 2
+    assert len(soup.point_array().tolist()) == 12
+    # two triangles with opposite orientations
+    faces = array('i', [0, 1, 2, 0, 3, 2])
+    soup = CGAL_Polygon_mesh_processing.orient_polygon_soup(points, faces)
+    assert soup.number_of_faces() == 2
+    assert not soup.has_duplicated_points()
+    # two crossing triangles
+    points = array('d', [0, 0, 0, 2, 0, 0, 0, 2, 0, 1, 1, -1, 1, 1, 1, 0.2, 0.2, 0])
+    faces = array('i', [0, 1, 2, 3, 4, 5])
+    try:
+        soup = CGAL_Polygon_mesh_processing.autorefine_triangle_soup(points, faces)
+        assert soup.number_of_faces() > 2
+    except RuntimeError:
+        print(" autorefine_triangle_soup needs CGAL 6.0 or later")
+
+
 def test_normal_computation_functions():
     P = get_poly()
     print("Testing normal computation functions...")
@@ -226,6 +293,16 @@ def test_normal_computation_functions():
     normals = []
     CGAL_Polygon_mesh_processing.compute_vertex_normals(P, normals)
     assert (len(normals) == P.size_of_vertices())
+    # into arrays, then only around the first facet
+    face_normals = array('d', [0.] * (3 * P.size_of_facets()))
+    CGAL_Polygon_mesh_processing.compute_face_normals(P, face_normals)
+    vertex_normals = array('f', [0.] * (3 * P.size_of_vertices()))
+    CGAL_Polygon_mesh_processing.compute_vertex_normals(P, vertex_normals)
+    assert abs(vertex_normals[0] - normals[0].x()) < 1e-5
+    P.compact()
+    changed = array('i', [0])
+    CGAL_Polygon_mesh_processing.compute_face_normals(P, face_normals, changed)
+    CGAL_Polygon_mesh_processing.compute_vertex_normals(P, vertex_normals, changed)
 
 
 def test_connected_components_functions():
@@ -283,6 +360,65 @@ def test_geometric_measure_functions():
         CGAL_Polygon_mesh_processing.face_border_length(hh, P)
 
 
+def test_locate_with_AABB_tree():
+    print("Testing locate_with_AABB_tree...")
+    P = Polyhedron_3()
+    P.make_tetrahedron(Point_3(0, 0, 0), Point_3(1, 0, 0), Point_3(0, 1, 0), Point_3(0, 0, 1))
+    queries = array('d', [0.2, 0.3, -1, 0.25, 0.25, 0.25])
+    locations = CGAL_Polygon_mesh_processing.locate_with_AABB_tree(queries, P)
+    assert locations.number_of_queries() == 2
+    faces = locations.face_array().tolist()
+    vertices = locations.vertex_array().tolist()
+    weights = locations.barycentric_array().tolist()
+    assert all(0 <= f < P.size_of_facets() for f in faces)
+    assert all(0 <= v < 4 for v in vertices)
+    assert abs(sum(weights[0:3]) - 1) < 1e-12
+    # interpolation of the coordinates of the vertices
+    points = [p for p in P.points()]
+    x = sum(weights[k] * points[vertices[k]].x() for k in range(3))
+    y = sum(weights[k] * points[vertices[k]].y() for k in range(3))
+    assert abs(x - 0.2) < 1e-12 and abs(y - 0.3) < 1e-12
+    # the tree cached by P is reused
+    assert CGAL_Polygon_mesh_processing.locate_with_AABB_tree(queries, P).face_array().tolist() == faces
+
+
+def test_heat_method():
+    print("Testing heat method...")
+    P = get_poly()
+    heat = Heat_method_3(P)
+    nv = heat.number_of_vertices()
+    assert nv == P.size_of_vertices()
+    d = heat.distances(0).tolist()
+    assert len(d) == nv and abs(d[0]) < 1e-6
+    assert min(heat.distances(array('i', [0, nv - 1])).tolist()) >= -1e-6
+    # one row per source, the factorization being reused
+    batch = heat.distances_batch(array('i', [0, nv - 1])).tolist()
+    assert len(batch) == 2 * nv
+    assert abs(batch[0] - d[0]) < 1e-5 and abs(batch[nv + nv - 1]) < 1e-5
+
+
+def test_sample_triangle_mesh():
+    print("Testing sample_triangle_mesh...")
+    P = get_poly()
+    points = Point_set_3()
+    n = CGAL_Polygon_mesh_processing.sample_triangle_mesh(
+        P, points, CGAL_Polygon_mesh_processing.RANDOM_UNIFORM_SAMPLING, 1000, 42)
+    assert n == points.size() and abs(n - 1000) < 10
+    assert points.has_normal_map()
+    face_ids = points.int_map("face_id")
+    assert all(0 <= face_ids.get(i) < P.size_of_facets() for i in points.indices())
+    # the sample only depends on the seed
+    again = Point_set_3()
+    CGAL_Polygon_mesh_processing.sample_triangle_mesh(
+        P, again, CGAL_Polygon_mesh_processing.RANDOM_UNIFORM_SAMPLING, 1000, 42)
+    assert again.point_array().tolist() == points.point_array().tolist()
+    for mode, parameter in ((CGAL_Polygon_mesh_processing.GRID_SAMPLING, 0.1),
+                            (CGAL_Polygon_mesh_processing.MONTE_CARLO_SAMPLING, 100),
+                            (CGAL_Polygon_mesh_processing.POISSON_DISK_SAMPLING, 0.1)):
+        assert CGAL_Polygon_mesh_processing.sample_triangle_mesh(
+            get_tetrahedron(), points, mode, parameter) > 0
+
+
 def test_miscellaneous_functions():
     print("Testing miscellaneous functions...")
     P = get_poly()
@@ -306,6 +442,16 @@ def test_polygon_mesh_slicer():
     slicer.slice(Plane_3(1, 0, 0, -0.5), slice)
     assert (slice.size() == 1)
     assert (len(slice[0]) != 0)
+    # one plane per row: a, b, c, d
+    planes = array('d', [1, 0, 0, -0.5, 1, 0, 0, -4, 0, 1, 0, -0.25])
+    batch = slicer.slice_batch(planes)
+    assert (batch.number_of_planes() == 3)
+    plane_offsets = list(batch.plane_offset_array())
+    assert (plane_offsets[1] - plane_offsets[0] == 1)
+    assert (plane_offsets[2] - plane_offsets[1] == 0)
+    polyline_offsets = list(batch.polyline_offset_array())
+    assert (polyline_offsets[1] - polyline_offsets[0] == len(slice[0]))
+    assert (batch.point_array().shape == (batch.number_of_points(), 3))
 
 
 def test_side_of_triangle_mesh():
@@ -315,6 +461,86 @@ def test_side_of_triangle_mesh():
     assert (f.bounded_side(Point_3(0.25, 0.25, 0.25)) == ON_BOUNDED_SIDE)
     assert (f.bounded_side(Point_3(0, 0, 0)) == ON_BOUNDARY)
     assert (f.bounded_side(Point_3(4, 0, 0)) == ON_UNBOUNDED_SIDE)
+    points = array('d', [0.25, 0.25, 0.25, 0, 0, 0, 4, 0, 0])
+    assert (list(f.bounded_side_batch(points)) == [1, 0, -1])
+    # reuse an existing tree on the facets
+    tree = AABB_tree_Polyhedron_3_Facet_handle(P.facets())
+    g = Side_of_triangle_mesh(tree)
+    assert (g.bounded_side(Point_3(0.25, 0.25, 0.25)) == ON_BOUNDED_SIDE)
+    assert (list(g.bounded_side_batch(points)) == [1, 0, -1])
+    # the tree of P is cached until P is modified
+    assert (list(Side_of_triangle_mesh(P).bounded_side_batch(points)) == [1, 0, -1])
+    p = Point_3(1.2, 0.05, 0.05)
+    assert (Side_of_triangle_mesh(P).bounded_side(p) == ON_UNBOUNDED_SIDE)
+    for vh in P.vertices():
+        if vh.point().x() == 1:
+            vh.set_point(Point_3(2, 0, 0))
+    assert (Side_of_triangle_mesh(P).bounded_side(p) == ON_BOUNDED_SIDE)
+    P.clear_cache()
+
+
+def get_tetrahedron(shift=0.):
+    vertices = array('d', [shift, 0, 0, 1 + shift, 0, 0, shift, 1, 0, shift, 0, 1])
+    faces = array('i', [0, 2, 1, 0, 1, 3, 0, 3, 2, 1, 2, 3])
+    return Surface_mesh_3(vertices, faces)
+
+
+def test_surface_mesh():
+    print("Testing Surface_mesh_3 variants...")
+    M = get_tetrahedron()
+    assert (M.number_of_vertices() == 4 and M.number_of_faces() == 4)
+    assert (M.is_closed() and M.is_triangle_mesh())
+    assert (CGAL_Polygon_mesh_processing.is_outward_oriented(M))
+    assert (abs(CGAL_Polygon_mesh_processing.volume(M) - 1. / 6) < 1e-12)
+    assert (len(CGAL_Polygon_mesh_processing.compute_face_normals(M)) == 4)
+    assert (len(CGAL_Polygon_mesh_processing.compute_vertex_normals(M)) == 4)
+    # the tree shares the mesh
+    tree = AABB_tree_Surface_mesh_3(M)
+    assert (tree.size() == 4)
+    assert (abs(tree.squared_distance(Point_3(2, 0, 0)) - 1) < 1e-12)
+    CGAL_Polygon_mesh_processing.isotropic_remeshing(0.1, M)
+    M.collect_garbage()
+    assert (M.number_of_faces() > 4 and M.is_closed())
+    assert (abs(CGAL_Polygon_mesh_processing.volume(M) - 1. / 6) < 1e-2)
+    U = Surface_mesh_3()
+    N = get_tetrahedron(0.5)
+    assert (CGAL_Polygon_mesh_processing.corefine_and_compute_union(get_tetrahedron(), N, U))
+    assert (U.is_closed())
+    assert (len(CGAL_Polygon_mesh_processing.connected_components(U)) == U.number_of_faces())
+    # two overlapping tetrahedra and a distant one
+    V = Surface_mesh_3()
+    parts = [get_tetrahedron(), get_tetrahedron(0.5), get_tetrahedron(10)]
+    assert (CGAL_Polygon_mesh_processing.corefine_and_compute_union_all(parts, V))
+    assert (V.number_of_faces() == U.number_of_faces() + 4)
+    assert (parts[0].number_of_faces() == 4)
+
+
+def test_exact_mesh():
+    print("Testing Exact_mesh_3...")
+    A = Exact_mesh_3(get_tetrahedron())
+    B = Exact_mesh_3(get_tetrahedron(0.5))
+    assert (A.number_of_faces() == 4 and A.is_closed())
+    # consecutive operations on the exact intersection points
+    U = Exact_mesh_3()
+    assert (CGAL_Polygon_mesh_processing.corefine_and_compute_union(A, B, U))
+    D = Exact_mesh_3()
+    assert (CGAL_Polygon_mesh_processing.corefine_and_compute_difference(U, Exact_mesh_3(get_tetrahedron(0.5)), D))
+    assert (not D.does_self_intersect())
+    M = Surface_mesh_3()
+    D.to_surface_mesh(M)
+    assert (M.is_closed())
+    assert (abs(CGAL_Polygon_mesh_processing.volume(M) - 7. / 48) < 1e-12)
+    assert (len(D.vertex_array()) == D.number_of_vertices())
+    assert (len(D.face_array()) == D.number_of_faces())
+    D.round_points()
+    assert (D.number_of_vertices() == M.number_of_vertices())
+    # chained operations on double meshes, computed exactly and rounded
+    E = Surface_mesh_3()
+    assert (CGAL_Polygon_mesh_processing.corefine_and_compute_union(get_tetrahedron(), get_tetrahedron(0.5), E, True))
+    F = Surface_mesh_3()
+    assert (CGAL_Polygon_mesh_processing.corefine_and_compute_difference(E, get_tetrahedron(0.5), F, True))
+    assert (F.is_closed())
+    assert (abs(CGAL_Polygon_mesh_processing.volume(F) - 7. / 48) < 1e-12)
 
 
 def test_coref():
@@ -328,14 +554,21 @@ def test_coref():
 
 
 test_meshing_functions()
+test_smoothing_functions()
 test_hole_filling_functions()
 test_predicate_functions()
 test_orientation_functions()
 test_combinatorial_repairing_functions()
+test_polygon_soup_arrays()
 test_normal_computation_functions()
 test_connected_components_functions()
 test_geometric_measure_functions()
+test_locate_with_AABB_tree()
+test_heat_method()
+test_sample_triangle_mesh()
 test_miscellaneous_functions()
 test_polygon_mesh_slicer()
 test_side_of_triangle_mesh()
+test_surface_mesh()
+test_exact_mesh()
 test_coref()
@@ -0,0 +1,40 @@
+from __future__ import print_function
+import numpy as np
+
+from CGAL.CGAL_Kernel import Bbox_3, Point_2, Polygon_2
+from CGAL.CGAL_Point_set_3 import Point_set_3, Point_set_3_octree
+
+rng = np.random.RandomState(0)
+coords = rng.uniform(0, 1, (20000, 3))
+points = Point_set_3.from_arrays(coords)
+octree = Point_set_3_octree(points, 500)
+
+x, y, z = coords[:, 0], coords[:, 1], coords[:, 2]
+in_box = np.flatnonzero((x >= 0.1) & (x <= 0.6) & (y >= 0.2) & (y <= 0.5) & (z >= 0.3) & (z <= 0.9))
+box = Bbox_3(0.1, 0.2, 0.3, 0.6, 0.5, 0.9)
+assert np.array_equal(np.array(points.indices_in_bbox(box)), in_box)
+assert np.array_equal(np.sort(octree.indices_in_bbox(points, box)), in_box)
+
+# a triangle, away from the points on its boundary
+triangle = Polygon_2()
+for p in ((0.1, 0.1), (0.9, 0.1), (0.1, 0.9)):
+    triangle.push_back(Point_2(*p))
+in_prism = np.flatnonzero((x >= 0.1) & (y >= 0.1) & (x + y <= 1.0) & (z >= 0.2) & (z <= 0.7))
+found = np.array(points.indices_in_polygon_2(triangle, 0.2, 0.7))
+assert abs(len(found) - len(in_prism)) <= 2 and len(np.setdiff1d(found, in_prism)) <= 2
+assert np.array_equal(np.sort(octree.indices_in_polygon_2(points, triangle, 0.2, 0.7)), found)
+
+# the half-spaces x <= 0.7, x >= 0.1 and z >= 0.1
+planes = np.array([[1., 0., 0., -0.7], [-1., 0., 0., 0.1], [0., 0., -1., 0.1]])
+in_frustum = np.flatnonzero((x <= 0.7) & (x >= 0.1) & (z >= 0.1))
+assert np.array_equal(np.array(points.indices_in_frustum(planes)), in_frustum)
+assert np.array_equal(np.sort(octree.indices_in_frustum(points, planes)), in_frustum)
+
+# the indices can be given to subset()
+crop = points.subset(points.indices_in_bbox(box))
+assert np.array_equal(np.array(crop.point_array()), coords[in_box])
+
+# with removed points, the indices are the ones of the remaining points
+points.remove(int(in_box[0]))
+assert np.array_equal(np.array(points.indices_in_bbox(box)), in_box[1:])
+print("crop OK")
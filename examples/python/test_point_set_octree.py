@@ -0,0 +1,35 @@
+from __future__ import print_function
+import numpy as np
+
+from CGAL.CGAL_Point_set_3 import Point_set_3, Point_set_3_octree
+
+rng = np.random.RandomState(0)
+coords = rng.uniform(-1, 1, (20000, 3))
+points = Point_set_3.from_arrays(coords)
+
+octree = Point_set_3_octree(points, 500, 10, 2)
+nodes = octree.number_of_nodes()
+ranges = np.array(octree.point_range_array())
+children = np.array(octree.child_range_array())
+boxes = np.array(octree.node_bbox_array())
+index = np.array(octree.index_array())
+assert ranges.shape == (nodes, 2) and tuple(ranges[0]) == (0, 20000)
+assert sorted(index) == list(range(20000))
+for v in range(nodes):
+    p = coords[index[ranges[v, 0]:ranges[v, 1]]]
+    assert np.all(p >= boxes[v, :3] - 1e-12) and np.all(p <= boxes[v, 3:] + 1e-12)
+    if children[v, 0] == children[v, 1]:
+        assert ranges[v, 1] - ranges[v, 0] <= 500
+    else:
+        assert ranges[children[v, 0], 0] == ranges[v, 0]
+        assert ranges[children[v, 1] - 1, 1] == ranges[v, 1]
+
+# at most one sample per cell of a 4x4x4 grid over each node
+offsets = np.array(octree.sample_offset_array())
+assert len(offsets) == nodes + 1 and offsets[1] - offsets[0] <= 64
+
+# reordering the point set makes the ranges index it directly
+octree = Point_set_3_octree(points, 500, 10, 2, True)
+assert np.array_equal(np.array(octree.index_array()), np.arange(20000))
+assert np.array_equal(np.array(points.point_array()), coords[index])
+print("octree OK")
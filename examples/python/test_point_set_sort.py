@@ -0,0 +1,61 @@
+from __future__ import print_function
+import numpy as np
+
+from CGAL.CGAL_Point_set_3 import Point_set_3
+
+rng = np.random.RandomState(0)
+coords = rng.uniform(-1, 1, (1000, 3))
+points = Point_set_3.from_arrays(coords)
+ids = points.add_int_map("id")
+points.property_array(ids)[:] = np.arange(1000, dtype=np.int32)
+points.remove(10)
+
+for mode in ("hilbert", "morton"):
+    before = np.array(points.point_array())
+    order = np.array(points.spatial_sort(mode))
+    assert points.size() == 999 and sorted(order) == list(range(999))
+    after = np.array(points.point_array())
+    # every column follows the points
+    assert np.array_equal(after, before[order])
+    assert np.array_equal(after, coords[np.array(points.property_array(ids))])
+    # consecutive points are closer than in the random order
+    steps = np.linalg.norm(after[1:] - after[:-1], axis=1).mean()
+    assert steps < 0.5 * np.linalg.norm(before[1:] - before[:-1], axis=1).mean()
+    points.permute(np.argsort(order).astype(np.int32))
+    assert np.array_equal(np.array(points.point_array()), before)
+
+for bad in ("peano",):
+    try:
+        points.spatial_sort(bad)
+        assert False
+    except Exception:
+        pass
+try:
+    points.permute(np.zeros(999, dtype=np.int32))
+    assert False
+except Exception:
+    pass
+print("spatial sort OK")
+
+# subsets and joins copy every column
+points = Point_set_3.from_arrays(coords)
+ids = points.add_int_map("id")
+points.property_array(ids)[:] = np.arange(1000, dtype=np.int32)
+picked = np.array([5, 3, 999, 3], dtype=np.int32)
+sub = points.subset(picked)
+assert sub.size() == 4
+assert np.array_equal(np.array(sub.point_array()), coords[picked])
+assert np.array_equal(np.array(sub.property_array(sub.int_map("id"))), picked)
+try:
+    points.subset(np.array([1000], dtype=np.int32))
+    assert False
+except Exception:
+    pass
+
+other = Point_set_3.from_arrays(coords[:10])
+other.add_float_map("weight", 2.0)
+assert sub.join(other) and sub.size() == 14
+assert np.array_equal(np.array(sub.point_array())[4:], coords[:10])
+assert list(np.array(sub.property_array(sub.int_map("id")))[4:]) == [0] * 10
+assert list(np.array(sub.property_array(sub.float_map("weight")))[4:]) == [2.] * 10
+print("subset and join OK")
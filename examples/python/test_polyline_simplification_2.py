@@ -72,3 +72,23 @@ print(
 )
 for vh in cdt.vertices_in_constraint(cid3):
     print(vh.point())
+
+# simplify polylines given as arrays of coordinates and offsets
+from array import array
+from CGAL.CGAL_Polyline_simplification_2 import Stop_above_cost_threshold
+coords = array('d', [0, 0, 1, 0.02, 2, 0, 3, 0.001, 4, 0.002,
+                     0, 1, 1, 1.01, 2, 1,
+                     5, 5])
+offsets = array('i', [0, 5, 8, 9])
+simplified = CGAL_Polyline_simplification_2.simplify_polylines(
+    coords, offsets, Squared_distance_cost(), Stop_above_cost_threshold(0.01))
+new_offsets = simplified.offset_array().tolist()
+assert simplified.number_of_polylines() == 3
+assert new_offsets == [0, 2, 4, 5]
+assert simplified.point_array().tolist()[2] == [0.0, 1.0]
+
+# same simplification on 2x2 tiles, the first polyline crossing the tiles
+tiled = CGAL_Polyline_simplification_2.simplify_polylines_tiled(
+    coords, offsets, Squared_distance_cost(), Stop_above_cost_threshold(0.01), 2)
+assert tiled.offset_array().tolist() == new_offsets
+assert tiled.point_array().tolist() == simplified.point_array().tolist()
@@ -0,0 +1,55 @@
+from __future__ import print_function
+
+import json
+import os
+import tempfile
+
+import CGAL
+from CGAL.CGAL_Kernel import Point_2, Point_3, Polygon_2
+
+CGAL.set_profiling(True)
+CGAL.reset_profiling()
+assert CGAL.is_profiling()
+
+points = [Point_2(i % 7, i // 7) for i in range(1000)]
+polygon = Polygon_2(points)
+assert polygon.size() == 1000
+total = 0.
+for i in range(100):
+    total += Point_3(i, 0, 0).x()
+
+CGAL.set_profiling(False)
+report = json.loads(CGAL.profiling_report())
+entry_points = report["entry_points"]
+assert entry_points
+assert sum(e["calls"] for e in entry_points) >= 1200
+for e in entry_points:
+    assert e["min_time"] <= e["max_time"] <= e["total_time"]
+# the conversion of the list is counted in the construction of the polygon
+assert any(e["conversion_time"] > 0 for e in entry_points)
+assert sum(e["wrapper_objects"] for e in entry_points) >= 1100
+assert report["peak_memory"] > 0
+for e in entry_points[:5]:
+    print(e["name"], e["calls"], e["total_time"], e["conversion_time"], e["wrapper_objects"])
+
+# nothing is recorded when profiling is off
+calls = sum(e["calls"] for e in entry_points)
+Point_3(0, 0, 0)
+assert sum(e["calls"] for e in json.loads(CGAL.profiling_report())["entry_points"]) == calls
+
+trace_file = os.path.join(tempfile.gettempdir(), "cgal_swig_profile.json")
+CGAL.write_profiling_report(trace_file, "chrome")
+with open(trace_file) as f:
+    trace = json.load(f)
+os.remove(trace_file)
+assert len(trace["traceEvents"]) == calls
+assert all(e["ph"] == "X" and e["dur"] >= 0 for e in trace["traceEvents"])
+
+try:
+    CGAL.profiling_report("xml")
+    assert False
+except Exception:
+    pass
+
+CGAL.reset_profiling()
+assert not json.loads(CGAL.profiling_report())["entry_points"]
@@ -1,11 +1,20 @@
 from __future__ import print_function
 
+from array import array
+import os
+import tempfile
+
 from CGAL.CGAL_Kernel import Point_3
 from CGAL.CGAL_Kernel import Point_2
 from CGAL.CGAL_Spatial_searching import Orthogonal_incremental_neighbor_search_tree_2
 from CGAL.CGAL_Spatial_searching import Orthogonal_incremental_neighbor_search_2
 from CGAL.CGAL_Spatial_searching import Orthogonal_incremental_neighbor_search_tree_3
 from CGAL.CGAL_Spatial_searching import Orthogonal_incremental_neighbor_search_3
+from CGAL.CGAL_Spatial_searching import Orthogonal_k_neighbor_search_tree_3
+from CGAL.CGAL_Spatial_searching import Orthogonal_k_neighbor_search_3
+from CGAL.CGAL_Spatial_searching import Index_kd_tree_3
+from CGAL.CGAL_Spatial_searching import Kd_tree_d
+from CGAL.CGAL_Spatial_searching import Voxel_grid_3
 from CGAL.CGAL_Spatial_searching import K_neighbor_search_tree_2
 from CGAL.CGAL_Spatial_searching import K_neighbor_search_2
 from CGAL.CGAL_Spatial_searching import Point_with_transformed_distance_2
@@ -67,6 +76,113 @@ def test_3d():
     for p in search.iterator():
         print(p[0], p[1])
 
+    # batched k-nearest neighbor queries: one row of coordinates per query
+    tree2 = Orthogonal_k_neighbor_search_tree_3(lst)
+    tree2.build(True)  # parallel splitting, same tree as build()
+    queries = array('d', [0, 0, 0, 40, 2, 3])
+    neighbors = tree2.knn_batch(queries, 2)
+    indices = neighbors.index_array()
+    distances = neighbors.distance_array()
+    for q in range(neighbors.number_of_queries()):
+        print([(indices[q, j], distances[q, j]) for j in range(neighbors.k())])
+
+    # radius graph in compressed sparse row layout (scipy.sparse.csr_matrix)
+    graph = tree2.radius_neighbors_csr(queries, 10)
+    offsets = graph.offset_array()
+    ids = graph.index_array()
+    for q in range(graph.number_of_queries()):
+        print(list(ids[offsets[q]:offsets[q + 1]]))
+    print(list(tree2.radius_neighbor_counts(queries, 10)))
+    # approximate searches, with the number of leaves visited per query
+    approximate = tree2.knn_batch(queries, 2, 0.5)
+    assert approximate.leaf_visit_array()[0] >= 1
+    assert approximate.total_leaf_visits() <= 2 * tree2.size()
+    assert tree2.radius_neighbor_counts(queries, 10, 1)[0] >= 1
+    search = Orthogonal_k_neighbor_search_3(tree2, Point_3(0, 0, 0), 2, 0.5)
+    print(search.number_of_leaf_nodes_visited(), "leaf(s) and",
+          search.number_of_items_visited(), "point(s) visited")
+
+    # filtered incremental searches: the closest points with the same label,
+    # at most 2 of them within 50, after at most 5 candidates
+    labels = array('i', [0, 1, 0, 1, 0, 1])
+    found = tree.incremental_search(Point_3(0, 0, 0), 2, 50, labels, 1)
+    print(list(found.index_array()[0]))
+    found = tree.incremental_search_batch(queries, 2, 50, labels, array('i', [0, 1]), 5)
+    indices = found.index_array()
+    print([[indices[q, j] for j in range(found.k())] for q in range(found.number_of_queries())])
+
+
+def test_index_tree():
+    print("Test index tree")
+    coordinates = array('d', [0, 0, 1, 0, 4, 2, 44, 0, 3, 44, 5, 4, 444, 51, 5, 14, 1, 7])
+    ids = array('i', [10, 11, 12, 13, 14, 15])
+    tree = Index_kd_tree_3(coordinates, ids)
+    tree.build()
+    print(tree.nearest(Point_3(40, 2, 3)))
+    parallel_tree = Index_kd_tree_3(coordinates, ids)
+    parallel_tree.build(1, True)
+    print(parallel_tree.nearest(Point_3(40, 2, 3)))
+    print(list(tree.search(Point_3(0, 0, 0), 5)))
+    print(list(tree.radius_neighbors_csr(array('d', [0, 0, 0]), 5).index_array()))
+
+    filename = os.path.join(tempfile.gettempdir(), "test_sp.kdt")
+    tree.save(filename)
+    loaded = Index_kd_tree_3.load(filename)
+    os.remove(filename)
+    neighbors = loaded.knn_batch(array('d', [0, 0, 0]), 3)
+    indices = neighbors.index_array()
+    print([indices[0, j] for j in range(neighbors.k())])
+
+    # searches visiting at most one leaf: bounded time, approximate neighbors
+    loaded.build(1)
+    budgeted = loaded.knn_batch(array('d', [0, 0, 0, 40, 2, 3]), 3, 0, 1)
+    assert list(budgeted.leaf_visit_array()) == [1, 1]
+    # one point per leaf
+    assert budgeted.index_array()[0, 0] != -1
+    assert budgeted.index_array()[0, 1] == -1
+    exact = loaded.knn_batch(array('d', [0, 0, 0]), 3, 0, 0)
+    assert exact.leaf_visit_array()[0] >= 3
+
+
+def test_voxel_grid():
+    print("Test voxel grid")
+    coordinates = array('d', [0, 0, 1, 0, 4, 2, 44, 0, 3, 44, 5, 4, 444, 51, 5, 14, 1, 7])
+    grid = Voxel_grid_3(coordinates, 10)
+    print(grid.number_of_voxels(), "voxel(s) for", grid.size(), "point(s)")
+    print(list(grid.search(Point_3(0, 0, 0), 5)))
+    print(list(grid.radius_neighbor_counts(array('d', [0, 0, 0, 44, 2, 3]), 5)))
+
+    # points of each voxel, and one point per voxel (grid simplification)
+    offsets = grid.voxel_offset_array()
+    ids = grid.index_array()
+    voxels = grid.voxel_coordinate_array()
+    for v in range(grid.number_of_voxels()):
+        print((voxels[v, 0], voxels[v, 1], voxels[v, 2]), list(ids[offsets[v]:offsets[v + 1]]))
+    print(list(grid.representative_array()))
+
+
+def test_kd_tree_d():
+    print("Test dD kd-tree")
+    # two clusters of 4D feature vectors, as a (6,4) array
+    values = array('f', [0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0,
+                         10, 10, 10, 10, 11, 10, 10, 10, 10, 11, 10, 10])
+    points = memoryview(values).cast('B').cast('f', [6, 4])
+    tree = Kd_tree_d(points)
+    print(tree.size(), "point(s) of dimension", tree.dimension())
+    queries = memoryview(array('f', [0.1, 0, 0, 0, 10, 10, 10, 9])).cast('B').cast('f', [2, 4])
+    neighbors = tree.knn_batch(queries, 2)
+    indices = neighbors.index_array()
+    distances = neighbors.distance_array()
+    for q in range(neighbors.number_of_queries()):
+        print([indices[q, j] for j in range(neighbors.k())], [round(distances[q, j], 3) for j in range(neighbors.k())])
+
+    # labels of the queries from the labeled points (-1: unlabeled)
+    labels = array('i', [3, 3, -1, 7, -1, 7])
+    print(list(tree.knn_labels(queries, labels, 3)))
+
 
 test_2d()
 test_3d()
+test_index_tree()
+test_kd_tree_d()
+test_voxel_grid()
@@ -2,8 +2,12 @@ from __future__ import print_function
 from CGAL.CGAL_Kernel import Point_2
 from CGAL.CGAL_Triangulation_2 import Constraint
 from CGAL.CGAL_Triangulation_2 import Constrained_Delaunay_triangulation_plus_2
+from CGAL.CGAL_Triangulation_2 import Delaunay_triangulation_2
+from CGAL.CGAL_Triangulation_2 import Regular_triangulation_2
 from CGAL.CGAL_Triangulation_2 import Ref_Constrained_Delaunay_triangulation_plus_2_Face_handle
 from CGAL.CGAL_Kernel import Ref_int
+from CGAL import CGAL_Triangulation_2
+from array import array
 
 constraints = []
 
@@ -49,9 +53,82 @@ t.is_edge(edges[0][0].vertex(t.cw(edges[0][1])),
 assert (rf.object() == edges[0][0]
         or rf.object() == edges[0][0].neighbor(edges[1]))
 
+# same query with the edge returned by value
+va = edges[0][0].vertex(t.cw(edges[0][1]))
+vb = edges[0][0].vertex(t.ccw(edges[0][1]))
+found = t.find_edge(va, vb)
+assert found.found() and found.vertex() == vb
+assert found.face() == rf.object() and found.index() == ri.object()
+assert t.find_included_edge(va, vb).found()
+location = t.locate_with_type(va.point())
+assert location.locate_type() == CGAL_Triangulation_2.VERTEX
+assert location.handle().vertex(location.li()) == va
+
 print("Nb incident constraints ", len(edges))
 
 print(t.number_of_vertices())
 
 for v in t.finite_vertices():
     print(v.point())
+
+# insertion from arrays of coordinates
+coords = array('d', [0, 0, 1, 0, 0, 1, 1, 1, 0.5, 0.5, 0, 0])
+dt = Delaunay_triangulation_2()
+assert dt.insert_from_array(coords) == 5
+assert dt.is_valid()
+try:
+    dt.insert_from_array(array('d', [0, 0, 1]))
+    assert False
+except Exception:
+    pass
+
+rt = Regular_triangulation_2()
+assert rt.insert_from_array(array('d', [0, 0, 0, 1, 0, 0, 0, 1, 0, 0.5, 0.5, -1])) == 3
+assert rt.is_valid()
+
+locations = dt.locate_batch(array('d', [0.25, 0.5, 5, 5]))
+assert locations.index_array().tolist()[1] == -1
+
+# bulk insertion of constraints: a square and a diagonal
+cdt = Constrained_Delaunay_triangulation_plus_2()
+square = array('d', [0, 0, 1, 0, 1, 1, 0, 1])
+assert cdt.insert_constraints(square, array('i', [0, 1, 1, 2, 2, 3, 3, 0, 0, 2])) == 4
+assert cdt.is_valid()
+assert cdt.number_of_vertices() == 4
+assert len(list(cdt.constraints())) == 5
+try:
+    cdt.insert_constraints(square, array('i', [0, 4]))
+    assert False
+except Exception:
+    pass
+
+# export to arrays, constrained edges being flagged
+arrays = cdt.to_arrays()
+assert arrays.number_of_points() == 4
+assert arrays.number_of_faces() == 2
+assert arrays.point_array().shape == (4, 2)
+faces = arrays.face_array().tolist()
+neighbors = arrays.neighbor_array().tolist()
+flags = arrays.constrained_edge_array().tolist()
+assert all(0 <= i < 4 for f in faces for i in f)
+assert sorted(n for f in neighbors for n in f) == [-1, -1, -1, -1, 0, 1]
+assert all(f == [1, 1, 1] for f in flags)
+assert all(f == [0, 0, 0] for f in dt.to_arrays().constrained_edge_array().tolist())
+
+# ranges given as lists, tuples and generators
+grid = [Point_2(i, j) for i in range(10) for j in range(10)]
+from_list = Delaunay_triangulation_2()
+from_list.insert(grid)
+from_tuple = Delaunay_triangulation_2()
+from_tuple.insert(tuple(grid))
+from_generator = Delaunay_triangulation_2()
+from_generator.insert(p for p in grid)
+assert (from_list.number_of_vertices() == 100)
+assert (from_tuple.number_of_vertices() == 100)
+assert (from_generator.number_of_vertices() == 100)
+failed = False
+try:
+    from_list.insert([Point_2(0, 0), 1])
+except Exception:
+    failed = True
+assert (failed)  # not a point
@@ -0,0 +1,39 @@
+from __future__ import print_function
+
+import CGAL
+
+default = CGAL.get_num_threads()
+assert default >= 1
+print("number of threads:", default)
+
+CGAL.set_num_threads(1)
+assert CGAL.get_num_threads() == 1
+CGAL.set_num_threads(0)
+assert CGAL.get_num_threads() == default
+
+# the arenas are entered for the calls of the block, and nested
+with CGAL.thread_arena(1) as arena:
+    assert arena.max_concurrency() == 1 and arena.is_entered()
+    with CGAL.thread_arena(2) as inner:
+        assert inner.is_entered() and not arena.is_entered()
+    assert arena.is_entered()
+assert not arena.is_entered()
+
+try:
+    from CGAL.CGAL_Point_set_3 import Point_set_3
+    from CGAL.CGAL_Point_set_processing_3 import compute_average_spacing
+    from CGAL.CGAL_Kernel import Point_3
+    points = Point_set_3()
+    for i in range(1000):
+        points.insert(Point_3(i % 10, (i // 10) % 10, i // 100))
+    with CGAL.thread_arena(1):
+        spacing = compute_average_spacing(points, 6)
+    assert abs(spacing - compute_average_spacing(points, 6)) < 1e-12
+except ImportError:
+    pass
+
+try:
+    CGAL.thread_arena(cores="3-1").__enter__()
+    assert False
+except Exception:
+    pass
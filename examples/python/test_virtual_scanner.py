@@ -0,0 +1,37 @@
+from __future__ import print_function
+
+import math
+
+import numpy as np
+
+from CGAL.CGAL_AABB_tree import AABB_tree_indexed_Triangle_3_soup, Flat_AABB_tree_3
+
+# the square [-1,1]^2 in the plane z=2
+vertices = np.array([[-1, -1, 2], [1, -1, 2], [1, 1, 2], [-1, 1, 2]], dtype=float)
+faces = np.array([[0, 1, 2], [0, 2, 3]], dtype=np.int32)
+flat = Flat_AABB_tree_3(vertices, faces)
+flat.build()
+
+for tree in (AABB_tree_indexed_Triangle_3_soup(vertices, faces), flat):
+    # camera at the origin looking along z: the square covers the columns
+    # 0 to 5 of the 40x10 image
+    image = tree.render_depth([10., 10., 0., 4.5], np.eye(4), 40, 10)
+    assert (image.width(), image.height()) == (40, 10)
+    depth = np.asarray(image.depth_array())
+    ids = np.asarray(image.primitive_id_array())
+    assert depth.shape == (10, 40)
+    assert np.allclose(depth[:, :5], 2) and np.isnan(depth[:, 6:]).all()
+    assert (ids[:, 6:] == -1).all() and set(ids[:, :5].flat) == {0, 1}
+    hit = ids.flatten() != -1
+    assert image.number_of_hits() == hit.sum()
+    assert np.allclose(np.asarray(image.normal_array())[hit], [0, 0, -1])
+    assert np.allclose(np.asarray(image.point_array())[hit][:, 2], 2)
+
+    # lidar looking along z (its x axis), one ray forward and one up
+    pose = np.array([[0, 0, -1, 0], [0, 1, 0, 0], [1, 0, 0, 0]], dtype=float)
+    scan = tree.simulate_lidar(pose, [[0, 0], [math.atan(0.25), 0], [0, math.pi / 2]])
+    ranges = np.asarray(scan.depth_array()).flatten()
+    assert np.allclose(ranges[:2], [2, math.sqrt(4.25)]) and math.isnan(ranges[2])
+    assert list(np.asarray(scan.primitive_id_array()).flatten())[2] == -1
+
+print("OK")
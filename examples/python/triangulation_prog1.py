@@ -1,6 +1,8 @@
 from __future__ import print_function
+from array import array
 from CGAL.CGAL_Kernel import Point_2
 from CGAL.CGAL_Triangulation_2 import Triangulation_2
+from CGAL.CGAL_Triangulation_2 import Delaunay_triangulation_hierarchy_2
 from CGAL.CGAL_Triangulation_2 import Triangulation_2_Vertex_circulator
 from CGAL.CGAL_Triangulation_2 import Triangulation_2_Vertex_handle
 
@@ -27,3 +29,12 @@ if vc.hasNext():
         print(iter.point())
         if iter == done:
             break
+
+# Delaunay triangulation hierarchy: fast locate() for points in random order
+dh = Delaunay_triangulation_hierarchy_2()
+dh.insert(points)
+assert dh.is_valid()
+assert dh.nearest_vertex(Point_2(9, 7)).point() == Point_2(9, 8)
+assert dh.remove_batch(array('i', [0, 2, 2])) == 2
+assert dh.number_of_vertices() == len(points) - 2
+assert dh.is_valid()
@@ -81,3 +81,37 @@ for p in queries:
                         if iter == done:
                             break
         print("")
+
+# cells clipped to a box as arrays
+from array import array
+from CGAL.CGAL_Kernel import Iso_rectangle_2
+sites = [Point_2(1, 1), Point_2(3, 1), Point_2(1, 3), Point_2(3, 3)]
+vd4 = Voronoi_diagram_2(sites)
+box = Iso_rectangle_2(Point_2(0, 0), Point_2(4, 4))
+cells = vd4.cells_as_polygons(box)
+assert cells.number_of_cells() == 4
+offsets = cells.offset_array().tolist()
+vertices = cells.vertex_array().tolist()
+total_area = 0.
+for c in range(cells.number_of_cells()):
+    cell = vertices[offsets[c]:offsets[c + 1]]
+    area = sum(cell[k][0] * cell[(k + 1) % len(cell)][1] - cell[(k + 1) % len(cell)][0] * cell[k][1]
+               for k in range(len(cell))) / 2
+    assert abs(area - 4) < 1e-9  # counterclockwise squares of side 2
+    total_area += area
+assert abs(total_area - 16) < 1e-9
+assert sorted(cells.site_array().tolist()) == [0, 1, 2, 3]
+# site-index mapping to the rows of an array of the sites
+rows = array('d', [3, 3, 9, 9, 1, 3, 3, 1, 1, 1, 3, 3])
+mapped = vd4.cells_as_polygons(box, rows).site_array().tolist()
+assert sorted(mapped) == [0, 2, 3, 4]
+
+# nearest site of a batch of queries, in the order of the cells above
+queries = array('d', [0.5, 0.5, 3.9, 0.2, 1.2, 3.5, 2.5, 2.6, 100, 100])
+located = vd4.locate_sites_batch(queries).tolist()
+expected = [(1, 1), (3, 1), (1, 3), (3, 3), (3, 3)]
+for c, (x, y) in zip(located, expected):
+    cell = vertices[offsets[c]:offsets[c + 1]]
+    cx = sum(v[0] for v in cell) / len(cell)
+    cy = sum(v[1] for v in cell) / len(cell)
+    assert abs(cx - x) < 1e-9 and abs(cy - y) < 1e-9
@@ -56,13 +56,17 @@ CGAL_modules = [
     'Convex_hull_2',
     'Convex_hull_3',
     'Classification',  # Requires Eigen 3.1+ (available via submodule)
+    'Constrained_triangulation_3',  # Requires CGAL 6.1+ to triangulate
     'HalfedgeDS',
     'Interpolation',
     'Mesh_2',
+    'Periodic_3_triangulation_3',
     'Point_set_3',
     'Point_set_processing_3',
     'Polygon_mesh_processing',  # Requires Eigen 3.2+ (available via submodule)
     'Polyhedron_3',
+    'Surface_mesh',
+    'Surface_mesh_simplification',  # Requires Eigen 3.2+ (available via submodule)
     'Polyline_simplification_2',
     'Shape_detection',  # Requires Eigen 3.1+ (available via submodule)
     'Spatial_searching',
@@ -70,7 +74,9 @@ CGAL_modules = [
     'AABB_tree',
     'Advancing_front_surface_reconstruction',
     'Alpha_shape_2',
+    'Alpha_shape_3',
     'Kernel',
+    'Kernel_batch',
     'Mesh_3',
     'Surface_mesher',
     'Triangulation_2',
@@ -116,7 +122,11 @@ def get_options():
            ('generator=', None, 'The generator to use for cmake.'),
            ('python-executable=', None, 'The path to the python executable.'),
            ('python-root=', None, 'The path to the Python root directory.'),
-           ('cmake=', None, 'Specify the path to the cmake executable.')
+           ('cmake=', None, 'Specify the path to the cmake executable.'),
+           ('lto=', None, 'ON to build with link-time optimization.'),
+           ('require-tbb=', None, 'ON to fail if TBB is not found, instead of building without parallelism.'),
+           ('lean-polyhedron=', None, 'ON to build Polyhedron_3 without the planes of the facets.'),
+           ('march=', None, 'Specify the CPU the binaries are built for (-march), e.g. native. Generic by default, with AVX2/AVX-512 versions of the loops over arrays.')
          ]
 
 def get_option_pairs():
@@ -145,7 +155,11 @@ def get_option_pairs():
          ('generator', 'generator'),
          ('python_root', 'python_root'),
          ('python_executable', 'python_executable'),
-         ('cmake', 'cmake')}
+         ('cmake', 'cmake'),
+         ('lto', 'lto'),
+         ('require_tbb', 'require_tbb'),
+         ('lean_polyhedron', 'lean_polyhedron'),
+         ('march', 'march')}
   return values
 
 def init_values(obj):
@@ -175,6 +189,10 @@ def init_values(obj):
   obj.cmake= None
   obj.python_root= None
   obj.python_executable= sys.executable
+  obj.lto= None
+  obj.require_tbb= None
+  obj.lean_polyhedron= None
+  obj.march= None
 
 class BuildWheelCommand(bdist_wheel):
   user_options = bdist_wheel.user_options + get_options()
@@ -372,6 +390,14 @@ class my_build_ext(build_ext_orig):
           if sys.platform != 'win32'or sys.platform == 'cygwin':
             cmake_args.append('-DPython_EXECUTABLE='+os.path.join(self.python_root, 'bin','python'))
 
+        if self.lto is not None:
+          cmake_args.append('-DSWIG_CGAL_LTO='+self.lto)
+        if self.require_tbb is not None:
+          cmake_args.append('-DSWIG_CGAL_REQUIRE_TBB='+self.require_tbb)
+        if self.lean_polyhedron is not None:
+          cmake_args.append('-DSWIG_CGAL_LEAN_POLYHEDRON='+self.lean_polyhedron)
+        if self.march is not None:
+          cmake_args.append('-DSWIG_CGAL_MARCH='+self.march)
         cmake_args.append('-DINSTALL_FROM_SETUP=ON')
         cmake_args.append('-DBoost_DEBUG=TRUE')
 